@@ -43,14 +43,19 @@
 #include <blaze/math/Accuracy.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/BandMatrix.h>
 #include <blaze/math/BLAS.h>
+#include <blaze/math/CompactDiagonalMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constraints.h>
+#include <blaze/math/CustomCompressedMatrix.h>
 #include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomTensor.h>
 #include <blaze/math/CustomVector.h>
 #include <blaze/math/DiagonalMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicTensor.h>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/Epsilon.h>
 #include <blaze/math/Functions.h>
@@ -63,11 +68,17 @@
 #include <blaze/math/HybridVector.h>
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
+#include <blaze/math/MatrixBatch.h>
+#include <blaze/math/PackedMatrix.h>
 #include <blaze/math/PaddingFlag.h>
+#include <blaze/math/ReductionFlag.h>
 #include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/SellMatrix.h>
 #include <blaze/math/Serialization.h>
 #include <blaze/math/Shims.h>
 #include <blaze/math/SMP.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/math/SparseDecomposition.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/StorageOrder.h>
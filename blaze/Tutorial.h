@@ -170,6 +170,11 @@
 // values \b Blaze requires <a href="https://en.wikipedia.org/wiki/LAPACK">LAPACK</a>. When either
 // of these features is used it is necessary to link the LAPACK library to the final executable.
 // If no LAPACK library is available the use of these features will result in a linker error.
+// Alternatively, the LAPACK mode can be switched off via the \c BLAZE_LAPACK_MODE switch in the
+// <tt>./blaze/config/LAPACK.h</tt> configuration file (or via the \c BLAZE_LAPACK_MODE option
+// of CMake). In that case the determinant, the LU, the Cholesky (LLH), and the QR decomposition
+// are computed by native, blocked \b Blaze kernels and no LAPACK library is required for these
+// features.
 //
 // Furthermore, it is possible to use Boost threads to run numeric operations in parallel. In this
 // case the Boost library is required to be installed on your system. It is recommended to use the
@@ -281,6 +286,9 @@
 //    customization of the \b Blaze compute kernels. In order to tune the kernels for a specific
 //    architecture and to maximize performance it can be necessary to adjust the thresholds,
 //    especially for a parallel execution (see \ref shared_memory_parallelization).
+//  - <b><tt>./blaze/config/Tuning.h</tt></b>: This file contains the host-specific settings that
+//    can be determined automatically by the tuning tool of the \b Blaze benchmark suite (see
+//    \ref openmp_configuration). These settings take precedence over the default thresholds.
 //
 // For an overview of other customization options and more details, please see the section
 // \ref configuration_files.
@@ -3249,7 +3257,8 @@
 //
 // \note The function is depending on LAPACK kernels. Thus the function can only be used if the
 // fitting LAPACK library is available and linked to the executable. Otherwise a linker error
-// will be created.
+// will be created. In case the \c BLAZE_LAPACK_MODE is switched off, the determinant is computed
+// by means of a native LU decomposition.
 //
 //
 // \n \subsection matrix_operations_matrix_trans trans()
@@ -4196,7 +4205,9 @@
 //
 // \note The functions decompose a dense matrix by means of LAPACK kernels. Thus the functions can
 // only be used if a fitting LAPACK library is available and linked to the executable. Otherwise
-// a linker error will be created.
+// a linker error will be created. In case the \c BLAZE_LAPACK_MODE is switched off, the LU, LLH,
+// and QR decompositions are computed by native, blocked kernels, which perform the update of the
+// trailing matrix by means of the parallel dense matrix multiplication kernels of \b Blaze.
 //
 // \subsection matrix_operations_decomposition_lu LU Decomposition
 //
@@ -8886,13 +8897,30 @@
 // the shared memory parallelization technique (see also \ref cpp_threads_parallelization and
 // \ref boost_threads_parallelization). Therefore the default values cannot guarantee maximum
 // performance for all possible situations and configurations. They merely provide a reasonable
-// standard for the current CPU generation.
+// standard for the current CPU generation. For maximum performance, the thresholds can be
+// determined for the host system by means of the tuning tool of the \b Blaze benchmark suite:
+
+   \code
+   cd blazemark/
+   ./configure
+   make tune
+   \endcode
+
+// The tuning tool measures the serial and parallel performance of all dense vector and dense
+// matrix operations for a range of problem sizes and writes the serial/parallel crossovers as
+// well as the cache sizes that provide the best blocking for the dense matrix multiplication
+// to the configuration file <tt>./blaze/config/Tuning.h</tt>. The settings in this file take
+// precedence over the default settings in <tt>./blaze/config/Thresholds.h</tt> and
+// <tt>./blaze/config/CacheSize.h</tt>. Note that the tuning tool uses the
+// compiler, the compiler flags, and the parallelization technique specified in the
+// <tt>Configfile</tt> of the benchmark suite, which should therefore match the settings of
+// the application.
 //
 //
 // \n \section openmp_first_touch First Touch Policy
 // <hr>
 //
-// So far the \b Blaze library does not (yet) automatically initialize dynamic memory according
+// By default the \b Blaze library does not automatically initialize dynamic memory according
 // to the first touch principle. Consider for instance the following vector triad example:
 
    \code
@@ -8941,6 +8969,21 @@
 // order to achieve the maximum possible performance, it is imperative to initialize the memory
 // according to the later use of the data structures.
 //
+// Alternatively, the first touch initialization can be performed by \b Blaze itself by setting
+// the \c BLAZE_USE_THREAD_AFFINITY switch in the <tt>./blaze/config/SMP.h</tt> configuration
+// file to 1 (or via the \c BLAZE_SMP_THREAD_AFFINITY CMake option). In this case the elements of
+// a newly created \c DynamicVector or \c DynamicMatrix are initialized in parallel (either with
+// the given initial value or with the default value of the element type), using the same
+// partitioning as all parallel assignments. Since the parts of the data are statically assigned
+// to the OpenMP threads, each thread repeatedly works on the same part of the data. Note however
+// that the OpenMP threads additionally have to be bound to the cores of the system, which is
+// controlled via the standard OpenMP environment variables:
+
+   \code
+   export OMP_PROC_BIND=close
+   export OMP_PLACES=cores
+   \endcode
+
 //
 // \n \section openmp_limitations Limitations of the OpenMP Parallelization
 // <hr>
@@ -9133,6 +9176,23 @@
 // the C++11 thread parallelization.
 //
 //
+// \n \section cpp_threads_affinity Thread Affinity
+// <hr>
+//
+// On systems with several NUMA domains the performance of memory-bound operations depends on
+// the placement of the data: Each part of a vector or matrix should be placed in the memory of
+// the thread that repeatedly works on it. By setting the \c BLAZE_USE_THREAD_AFFINITY switch in
+// the <tt>./blaze/config/SMP.h</tt> configuration file to 1 (or via the
+// \c BLAZE_SMP_THREAD_AFFINITY CMake option), the i-th thread of the C++11 (and Boost) thread
+// parallelization is bound to the i-th core available to the process and all parallel
+// assignments hand the same part of the data to the same thread. Additionally, the elements of a newly created
+// \c DynamicVector or \c DynamicMatrix are initialized in parallel (either with the given initial
+// value or with the default value of the element type), such that each thread touches the part
+// of the data it later works on first (first touch policy). Please note that the assignment of
+// the parts to the threads is a best effort: In case a thread is busy for a longer period of
+// time, another thread takes over its part of the work.
+//
+//
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
 //
@@ -9610,6 +9670,32 @@
 // Valid settings for \c BLAZE_DEFAULT_STORAGE_ORDER are blaze::rowMajor and blaze::columnMajor.
 //
 //
+// \n \section sparse_index Sparse Index Type
+// <hr>
+//
+// The elements of all compressed vectors and matrices are stored as value-index-pairs. By
+// default the index of each element is stored as \c size_t. The header file
+// <tt>./blaze/config/SparseIndex.h</tt> allows to reduce the size of the stored index via the
+// \c BLAZE_SPARSE_INDEX_TYPE macro, which reduces the memory footprint and memory traffic of
+// all sparse operations:
+
+   \code
+   #define BLAZE_SPARSE_INDEX_TYPE uint32_t
+   \endcode
+
+// Alternatively the sparse index type can be specified via command line or by defining this
+// symbol manually before including any \b Blaze header file:
+
+   \code
+   #define BLAZE_SPARSE_INDEX_TYPE uint32_t
+   #include <blaze/Blaze.h>
+   \endcode
+
+// Valid settings for \c BLAZE_SPARSE_INDEX_TYPE are \c size_t, \c uint32_t, and \c uint16_t.
+// Note that the size of compressed vectors and the number of columns (row-major) or rows
+// (column-major) of compressed matrices is limited by the range of the index type.
+//
+//
 // \n \section blas_mode BLAS Mode
 // <hr>
 //
@@ -9641,6 +9727,33 @@
 // functionality, but performance may be limited.
 //
 //
+// \n \section lapack_mode LAPACK Mode
+// <hr>
+//
+// By default, \b Blaze computes the determinant and the LU, Cholesky (LLH), and QR decompositions
+// of dense matrices by means of LAPACK. Via the following compilation switch in the configuration
+// file <tt>./blaze/config/LAPACK.h</tt> the LAPACK mode can be disabled:
+
+   \code
+   #define BLAZE_LAPACK_MODE 0
+   \endcode
+
+// Alternatively, the setting can be specified via command line or by defining the symbol manually
+// before including any \b Blaze header file:
+
+   \code
+   #define BLAZE_LAPACK_MODE 0
+   #include <blaze/Blaze.h>
+   \endcode
+
+// In case the LAPACK mode is disabled, these operations are computed by native, blocked \b Blaze
+// kernels (a right-looking LU decomposition with partial pivoting, a blocked Cholesky decomposition,
+// and a blocked Householder QR decomposition), whose trailing matrix updates are based on the
+// (parallel) dense matrix multiplication kernels of \b Blaze. Note however that all other LAPACK
+// based functionality (as for instance the matrix inversion or the computation of eigenvalues and
+// singular values) still requires a LAPACK library.
+//
+//
 // \n \section cache_size Cache Size
 // <hr>
 //
@@ -9688,6 +9801,38 @@
 // the operations. Note that deactivating the vectorization may pose a severe performance
 // limitation for a large number of operations!
 //
+// The instruction set is selected at compile time based on the compiler flags (as for instance
+// \c -mavx2 or \c -march=native). In order to build a single executable for several generations
+// of x86-64 CPUs, \b Blaze optionally provides a runtime CPU dispatch via the compile time switch
+// \c BLAZE_USE_RUNTIME_DISPATCH in the same configuration file:
+
+   \code
+   #define BLAZE_USE_RUNTIME_DISPATCH 1
+   \endcode
+
+// In case the switch is set to 1, the general dense matrix/dense matrix multiplication, the
+// large dense matrix/dense vector multiplication kernels, and the dense vector addition of
+// single and double precision operands are additionally compiled for the SSE2, AVX2/FMA and
+// AVX-512 instruction sets, and the fastest variant supported by the executing CPU is selected
+// at runtime. Therefore an executable compiled for instance for SSE2 uses AVX-512 instructions
+// for these operations on CPUs with AVX-512 support. The runtime CPU dispatch requires GCC or
+// Clang and is disabled by default.
+//
+// Vectorization is also available for the 16-bit floating point storage types \c blaze::float16
+// (IEEE 754 half precision) and \c blaze::bfloat16. Vectors and matrices of these types require
+// only half the memory bandwidth of their single precision counterparts. Their elements are
+// converted to single precision in registers (via F16C or AVX-512 in case of \c float16 and via
+// SSE2 shifts in case of \c bfloat16) and all computations are performed in single precision:
+
+   \code
+   blaze::DynamicMatrix<blaze::float16> A( 1000UL, 1000UL );
+   blaze::DynamicVector<blaze::float16> x( 1000UL );
+   // ... Initialization
+
+   blaze::DynamicVector<float> y( A * x );           // Computation and result in single precision
+   blaze::DynamicVector<blaze::float16> z( A * x );  // Result rounded to half precision
+   \endcode
+//
 //
 // \n \section thresholds Thresholds
 // <hr>
@@ -45,15 +45,18 @@
 #include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Algorithms.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/CheckedDelete.h>
 #include <blaze/util/ColorMacros.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Constraints.h>
+#include <blaze/util/CPUFeatures.h>
 #include <blaze/util/DimensionOf.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EmptyType.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Exception.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Indices.h>
 #include <blaze/util/IntegralConstant.h>
@@ -61,6 +64,7 @@
 #include <blaze/util/InvalidType.h>
 #include <blaze/util/Limits.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/MemoryMap.h>
 #include <blaze/util/MemoryPool.h>
 #include <blaze/util/MPL.h>
 #include <blaze/util/NonCopyable.h>
@@ -75,6 +79,7 @@
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Suffix.h>
 #include <blaze/util/Thread.h>
+#include <blaze/util/ThreadAffinity.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Time.h>
 #include <blaze/util/Timing.h>
@@ -83,5 +88,6 @@
 #include <blaze/util/TypeTraits.h>
 #include <blaze/util/UnsignedValue.h>
 #include <blaze/util/ValueTraits.h>
+#include <blaze/util/Workspace.h>
 
 #endif
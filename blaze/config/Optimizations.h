@@ -120,3 +120,60 @@
 #define BLAZE_USE_OPTIMIZED_KERNELS 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration switch for the workspace of expression temporaries.
+// \ingroup config
+//
+// This configuration switch enables/disables the use of the thread-local workspace (see the
+// Workspace class) for the temporary arrays of expression evaluations, as for instance the
+// packing buffers of the dense matrix multiplication kernels or the temporaries of transpose
+// operations and aliased assignments. In case the switch is set to \a true the temporaries are
+// drawn from the workspace of the calling thread, which avoids any heap allocation once the
+// workspace has grown to the peak demand of the computation. In case the switch is set to
+// \a false all temporaries are allocated on the heap.
+//
+// Possible settings for the workspace:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note It is possible to (de-)activate the workspace via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_WORKSPACE 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_WORKSPACE
+#define BLAZE_USE_WORKSPACE 1
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Size limit for the temporaries drawn from the workspace.
+// \ingroup config
+//
+// This configuration value specifies the maximum size (in bytes) of a single temporary array
+// that is drawn from the thread-local workspace (see BLAZE_USE_WORKSPACE). Temporaries exceeding
+// this limit, as for instance the matrix-sized temporaries of aliased assignments and transpose
+// operations of large matrices, are allocated on the heap and freed immediately after use. This
+// prevents the workspace from permanently holding large blocks of memory, since the memory of
+// the workspace is only released when the thread terminates or shrink() is called. The default
+// limit covers the packing buffers of the dense matrix multiplication kernels for caches of up
+// to 8 MiB.
+//
+// \note It is possible to specify the limit via command line or by defining this symbol manually
+// before including any Blaze header file:
+
+   \code
+   #define BLAZE_WORKSPACE_LIMIT 4194304UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_WORKSPACE_LIMIT
+#define BLAZE_WORKSPACE_LIMIT 4194304UL
+#endif
+//*************************************************************************************************
@@ -58,3 +58,38 @@
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 #endif
 //*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the (de-)activation of the NUMA-aware thread affinity.
+// \ingroup config
+//
+// This compilation switch enables/disables the NUMA-aware placement of the shared-memory
+// parallelization. In case the switch is set to 1, the threads of the C++11 and Boost thread
+// backends are bound to the available processors, the parallel assignments of dense vectors
+// and matrices hand each part of the data to the same thread in every operation, and the
+// elements of a newly created DynamicVector or DynamicMatrix are initialized in parallel with
+// the same partitioning ("first touch"), such that each part of the data is placed in the
+// memory of the processor that repeatedly works on it. In case the OpenMP parallelization is
+// used, the data is initialized in parallel and the parts are statically assigned to the
+// threads, whereas the binding of the threads is controlled via the standard \c OMP_PROC_BIND
+// and \c OMP_PLACES environment variables. In case the switch is set to 0, the threads are not
+// bound and the data is initialized by the creating thread.
+//
+// Possible settings for the thread affinity switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the thread affinity via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_THREAD_AFFINITY 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_THREAD_AFFINITY
+#define BLAZE_USE_THREAD_AFFINITY 0
+#endif
+//*************************************************************************************************
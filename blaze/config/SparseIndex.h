@@ -0,0 +1,79 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/SparseIndex.h
+//  \brief Configuration of the index type of all compressed vectors and matrices
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The index type of the non-zero elements of all compressed vectors and matrices.
+// \ingroup config
+//
+// This type specifies the data type used to store the index of each non-zero element within
+// the blaze::CompressedVector and blaze::CompressedMatrix class templates. Since the elements
+// of these containers are stored as value-index-pairs, a smaller index type reduces both the
+// memory footprint of the containers and the memory traffic of all sparse kernels, which are
+// typically limited by the memory bandwidth. For instance, in case of single precision values
+// a 32-bit index type halves the size of each stored element:
+
+   \code
+   #define BLAZE_SPARSE_INDEX_TYPE uint32_t
+   #include <blaze/Blaze.h>
+
+   // Each non-zero element requires 8 instead of 16 bytes
+   blaze::CompressedMatrix<float,blaze::rowMajor> A( 1000UL, 1000UL );
+   \endcode
+
+// Note that the index type restricts the maximum size of compressed vectors and the maximum
+// number of columns (row-major) or rows (column-major) of compressed matrices, which must not
+// exceed the largest value of the index type. Any attempt to create or resize a compressed
+// vector or matrix beyond this limit results in a \a std::invalid_argument exception. Also
+// note that due to alignment the element size of \c double values is not reduced by a 32-bit
+// index type.
+//
+// Valid settings for the BLAZE_SPARSE_INDEX_TYPE are \c size_t, \c uint32_t, and \c uint16_t.
+// Since the sparse index type is encoded in the mangled names of all compressed vectors and
+// matrices, translation units using different settings cannot accidentally share these
+// containers: any attempt to pass a compressed vector or matrix between them results in a
+// link error. Note that for this reason the setting must be given without namespace
+// qualification (i.e. \c uint32_t instead of \c std::uint32_t).
+//
+// \note It is possible to specify the sparse index type via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SPARSE_INDEX_TYPE uint32_t
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SPARSE_INDEX_TYPE
+#define BLAZE_SPARSE_INDEX_TYPE size_t
+#endif
+//*************************************************************************************************
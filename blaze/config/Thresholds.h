@@ -614,6 +614,39 @@
 #endif
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the total reduction of a dense vector (as for instance computed
+// by the sum(), prod(), min(), max(), or reduce() functions) can be executed in parallel. In case
+// the number of elements of the dense vector is larger or equal to this threshold, the operation
+// is executed in parallel. If the number of elements is below this threshold the operation is
+// executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECREDUCE_THRESHOLD
+#define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
 
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/dense vector multiplication threshold.
@@ -1423,6 +1456,40 @@
 #endif
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief SMP dense matrix reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the total or the row-/columnwise reduction of a dense matrix (as
+// for instance computed by the sum(), min(), max(), or reduce() functions) can be executed in
+// parallel. In case the number of elements of the dense matrix is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 48400 (which corresponds to a matrix size of
+// \f$ 220 \times 220 \f$). In case the threshold is set to 0, the operation is unconditionally
+// executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DMATREDUCE_THRESHOLD 48400UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATREDUCE_THRESHOLD
+#define BLAZE_SMP_DMATREDUCE_THRESHOLD 48400UL
+#endif
+//*************************************************************************************************
+
 
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/row-major dense matrix multiplication threshold.
@@ -1966,3 +2033,235 @@
 #define BLAZE_SMP_TSMATTSMATMULT_THRESHOLD 22500UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix addition threshold.
+// \ingroup config
+//
+// This threshold specifies when a addition between two sparse matrices with the same storage order
+// can be executed in parallel. In case the number of elements of the target matrix is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of elements is
+// below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 360000 (which corresponds to a matrix size of
+// \f$ 600 \times 600 \f$). In case the threshold is set to 0, the operation is unconditionally
+// executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATSMATADD_THRESHOLD 360000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATSMATADD_THRESHOLD
+#define BLAZE_SMP_SMATSMATADD_THRESHOLD 360000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix subtraction threshold.
+// \ingroup config
+//
+// This threshold specifies when a subtraction between two sparse matrices with the same storage order
+// can be executed in parallel. In case the number of elements of the target matrix is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of elements is
+// below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization.
+//
+// The default setting for this threshold is 360000 (which corresponds to a matrix size of
+// \f$ 600 \times 600 \f$). In case the threshold is set to 0, the operation is unconditionally
+// executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATSMATSUB_THRESHOLD 360000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATSMATSUB_THRESHOLD
+#define BLAZE_SMP_SMATSMATSUB_THRESHOLD 360000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP matrix batch threshold.
+// \ingroup config
+//
+// This threshold specifies when a batched operation on a MatrixBatch (as for instance a batched
+// multiplication, inversion, determinant computation, or solution of linear systems) can be
+// executed in parallel. In case the total number of multiply-add operations of all matrices of
+// the batch is larger or equal to this threshold, the lane groups of the batch are distributed
+// among the available threads. Otherwise the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 65536 (which corresponds to a batched multiplication
+// of approximately 2400 \f$ 3 \times 3 \f$ matrices). In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_BATCH_THRESHOLD 65536UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_BATCH_THRESHOLD
+#define BLAZE_SMP_BATCH_THRESHOLD 65536UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP iterative solver threshold.
+// \ingroup config
+//
+// This threshold specifies when the fused vector kernels of the iterative solvers (as for
+// instance the combined update and norm computation of the conjugate gradient method) can be
+// executed in parallel. In case the size of the linear system is larger or equal to this
+// threshold, the kernels are executed in parallel. If the size is below this threshold the
+// kernels are executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// kernels are unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SOLVER_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SOLVER_THRESHOLD
+#define BLAZE_SMP_SOLVER_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse triangular solve threshold.
+// \ingroup config
+//
+// This threshold specifies when a level of a level-scheduled sparse triangular solve or of a
+// level-scheduled incomplete factorization (as for instance performed by the ILU(0) and IC(0)
+// preconditioners) can be executed in parallel. In case the number of non-zero elements within
+// the rows of a level is larger or equal to this threshold, the rows of the level are processed
+// in parallel. If the number of non-zero elements is below this threshold the level is processed
+// single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 16384. In case the threshold is set to 0, all levels
+// are unconditionally processed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATTRSV_THRESHOLD 16384UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATTRSV_THRESHOLD
+#define BLAZE_SMP_SMATTRSV_THRESHOLD 16384UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP supernodal factorization threshold.
+// \ingroup config
+//
+// This threshold specifies when a level of the supernodal elimination tree of a sparse Cholesky
+// or LDLH decomposition (see the SparseLLH and SparseLDLH classes) can be factorized in parallel.
+// In case the total number of elements of the dense supernode panels of a level is larger or
+// equal to this threshold, the supernodes of the level are factorized in parallel. If the number
+// of elements is below this threshold the level is factorized single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 32768. In case the threshold is set to 0, all levels
+// are unconditionally factorized in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SUPERNODAL_THRESHOLD 32768UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SUPERNODAL_THRESHOLD
+#define BLAZE_SMP_SUPERNODAL_THRESHOLD 32768UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP band matrix multiplication threshold.
+// \ingroup config
+//
+// This threshold specifies when a multiplication of a band matrix (see the BandMatrix class
+// template) with a dense vector or a dense matrix can be executed in parallel. In case the
+// number of stored band elements multiplied by the number of processed vectors (i.e. 1 for a
+// matrix/vector multiplication and the number of columns (or rows) of the dense matrix operand
+// for a matrix/matrix multiplication) is larger or equal to this threshold, the operation is
+// executed in parallel. If the number of elements is below this threshold the operation is
+// executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs.
+//
+// The default setting for this threshold is 65536. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_BANDMULT_THRESHOLD 65536UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_BANDMULT_THRESHOLD
+#define BLAZE_SMP_BANDMULT_THRESHOLD 65536UL
+#endif
+//*************************************************************************************************
@@ -0,0 +1,58 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/Tuning.h
+//  \brief Configuration of the host-specific tuning settings
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief Host-specific tuning settings.
+// \ingroup config
+//
+// This configuration file contains the host-specific settings that have been determined by the
+// tuning tool of the Blaze benchmark suite. The tuning tool measures the serial and parallel
+// performance of the dense vector and dense matrix operations on the host system and sweeps
+// the cache sizes that determine the blocking of the dense matrix multiplication. Via the
+// following command the file is regenerated with the settings that provide the best performance on the host system:
+
+   \code
+   cd blazemark/
+   ./configure
+   make tune
+   \endcode
+
+// All settings in this file take precedence over the default settings in the configuration
+// files <tt>./blaze/config/Thresholds.h</tt> and <tt>./blaze/config/CacheSize.h</tt>. In the
+// default version of this file no setting is specified and therefore all default settings are
+// used. Note that it is still possible to specify every setting via command line or by defining
+// the according symbol manually before including any Blaze header file.
+*/
+//*************************************************************************************************
@@ -62,3 +62,35 @@
 #define BLAZE_USE_VECTORIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for (de-)activation of the runtime CPU dispatch.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime selection of the SIMD kernels for the
+// dense matrix/matrix multiplication, the dense matrix/dense vector multiplication, and the
+// dense vector addition. In case the switch is set to 1, the Blaze library compiles these
+// kernels for the SSE2, AVX2/FMA, and AVX-512 instruction sets and selects the fastest kernel
+// supported by the executing CPU on first use. This allows to build a single binary for the
+// baseline x86-64 target that nevertheless exploits the full width of more modern CPUs. In case
+// the switch is set to 0, all operations are exclusively vectorized for the instruction set of
+// the compilation target. Note that the runtime dispatch is only available for the GNU and
+// Clang compilers on x86-64 platforms and is silently ignored on all other platforms.
+//
+// Possible settings for the runtime dispatch switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the runtime dispatch via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_RUNTIME_DISPATCH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_RUNTIME_DISPATCH
+#define BLAZE_USE_RUNTIME_DISPATCH 0
+#endif
+//*************************************************************************************************
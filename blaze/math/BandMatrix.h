@@ -0,0 +1,215 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/BandMatrix.h
+//  \brief Header file for the complete BandMatrix implementation
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_BANDMATRIX_H_
+#define _BLAZE_MATH_BANDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/BandDecomposition.h>
+#include <blaze/math/dense/BandMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/BandDVecMultExpr.h>
+#include <blaze/math/expressions/DMatBandMultExpr.h>
+#include <blaze/math/views/Band.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for BandMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of BandMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+class Rand< BandMatrix<Type,SO> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   inline const BandMatrix<Type,SO> generate( size_t n, size_t kl, size_t ku ) const;
+
+   template< typename Arg >
+   inline const BandMatrix<Type,SO> generate( size_t n, size_t kl, size_t ku,
+                                              const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   inline void randomize( BandMatrix<Type,SO>& matrix ) const;
+
+   template< typename Arg >
+   inline void randomize( BandMatrix<Type,SO>& matrix, const Arg& min, const Arg& max ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random BandMatrix.
+//
+// \param n The number of rows and columns of the random matrix.
+// \param kl The number of subdiagonals of the random matrix.
+// \param ku The number of superdiagonals of the random matrix.
+// \return The generated random matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const BandMatrix<Type,SO>
+   Rand< BandMatrix<Type,SO> >::generate( size_t n, size_t kl, size_t ku ) const
+{
+   BandMatrix<Type,SO> matrix( n, kl, ku );
+   randomize( matrix );
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random BandMatrix.
+//
+// \param n The number of rows and columns of the random matrix.
+// \param kl The number of subdiagonals of the random matrix.
+// \param ku The number of superdiagonals of the random matrix.
+// \param min The smallest possible value for a band element.
+// \param max The largest possible value for a band element.
+// \return The generated random matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO >       // Storage order
+template< typename Arg >  // Min/max argument type
+inline const BandMatrix<Type,SO>
+   Rand< BandMatrix<Type,SO> >::generate( size_t n, size_t kl, size_t ku,
+                                          const Arg& min, const Arg& max ) const
+{
+   BandMatrix<Type,SO> matrix( n, kl, ku );
+   randomize( matrix, min, max );
+   return matrix;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a BandMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \return void
+//
+// This function randomizes all elements inside of the band of the given matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void Rand< BandMatrix<Type,SO> >::randomize( BandMatrix<Type,SO>& matrix ) const
+{
+   using blaze::randomize;
+
+   const size_t n ( matrix.rows() );
+   const size_t kl( matrix.lowerBandwidth() );
+   const size_t ku( matrix.upperBandwidth() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t jbegin( ( i > kl )?( i-kl ):( 0UL ) );
+      const size_t jend  ( min( n, i+ku+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         randomize( matrix(i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a BandMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param min The smallest possible value for a band element.
+// \param max The largest possible value for a band element.
+// \return void
+//
+// This function randomizes all elements inside of the band of the given matrix.
+*/
+template< typename Type   // Data type of the matrix
+        , bool SO >       // Storage order
+template< typename Arg >  // Min/max argument type
+inline void Rand< BandMatrix<Type,SO> >::randomize( BandMatrix<Type,SO>& matrix,
+                                                    const Arg& min, const Arg& max ) const
+{
+   using blaze::randomize;
+
+   const size_t n ( matrix.rows() );
+   const size_t kl( matrix.lowerBandwidth() );
+   const size_t ku( matrix.upperBandwidth() );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const size_t jbegin( ( i > kl )?( i-kl ):( 0UL ) );
+      const size_t jend  ( blaze::min( n, i+ku+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         randomize( matrix(i,j), min, max );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
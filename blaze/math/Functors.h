@@ -43,6 +43,7 @@
 #include <blaze/math/functors/Abs.h>
 #include <blaze/math/functors/Acos.h>
 #include <blaze/math/functors/Acosh.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Asin.h>
 #include <blaze/math/functors/Asinh.h>
 #include <blaze/math/functors/Atan.h>
@@ -76,6 +77,7 @@
 #include <blaze/math/functors/Log10.h>
 #include <blaze/math/functors/Max.h>
 #include <blaze/math/functors/Min.h>
+#include <blaze/math/functors/Mult.h>
 #include <blaze/math/functors/Noop.h>
 #include <blaze/math/functors/Pow.h>
 #include <blaze/math/functors/Real.h>
@@ -83,7 +85,9 @@
 #include <blaze/math/functors/Serial.h>
 #include <blaze/math/functors/Sin.h>
 #include <blaze/math/functors/Sinh.h>
+#include <blaze/math/functors/SqrAbs.h>
 #include <blaze/math/functors/Sqrt.h>
+#include <blaze/math/functors/Sub.h>
 #include <blaze/math/functors/Tan.h>
 #include <blaze/math/functors/Tanh.h>
 #include <blaze/math/functors/Trans.h>
@@ -0,0 +1,820 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandDecomposition.h
+//  \brief Header file for the native band LU, band Cholesky, and tridiagonal solvers
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BANDDECOMPOSITION_H_
+#define _BLAZE_MATH_DENSE_BANDDECOMPOSITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/BandMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given band solver kernel for the given range of right-hand sides.
+// \ingroup band_matrix
+//
+// \param work The number of band elements traversed per right-hand side.
+// \param nrhs The number of right-hand sides.
+// \param kernel The solver kernel, called as \c kernel(first,last).
+// \return void
+//
+// In case the total work exceeds the band matrix multiplication threshold, the \a nrhs
+// right-hand sides are distributed among the available threads. Otherwise the kernel is
+// executed serially.
+*/
+template< typename Kernel >  // Type of the solver kernel
+inline void bandSolveFor( size_t work, size_t nrhs, const Kernel& kernel )
+{
+   if( work*nrhs < SMP_BANDMULT_THRESHOLD || nrhs < 2UL ) {
+      kernel( 0UL, nrhs );
+   }
+   else {
+      smpFor( 0UL, nrhs, kernel );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BAND LU DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unblocked LU decomposition with partial pivoting of a band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix to be decomposed; the upper bandwidth must be large enough for fill-in.
+// \param ipiv Auxiliary array for the pivot indices; size >= \a n.
+// \return \a true in case the matrix is nonsingular, \a false if an exactly zero pivot was found.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO >      // Storage order of the band matrix
+bool gbtrf_backend( BandMatrix<Type,SO>& A, int* ipiv )
+{
+   const size_t n ( A.rows() );
+   const size_t kl( A.lowerBandwidth() );
+   const size_t ku( A.upperBandwidth() );
+
+   bool nonsingular( true );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const size_t iend( min( n, j+kl+1UL ) );
+      const size_t jend( min( n, j+ku+1UL ) );
+
+      size_t p( j );
+      auto pmax( abs( real( A(j,j) ) ) + abs( imag( A(j,j) ) ) );
+
+      for( size_t i=j+1UL; i<iend; ++i ) {
+         const auto tmp( abs( real( A(i,j) ) ) + abs( imag( A(i,j) ) ) );
+         if( tmp > pmax ) {
+            p    = i;
+            pmax = tmp;
+         }
+      }
+
+      ipiv[j] = numeric_cast<int>( p+1UL );
+
+      if( isDefault( A(p,j) ) ) {
+         nonsingular = false;
+         continue;
+      }
+
+      if( p != j ) {
+         for( size_t l=j; l<jend; ++l ) {
+            std::swap( A(p,l), A(j,l) );
+         }
+      }
+
+      const Type inv( Type(1) / A(j,j) );
+      for( size_t i=j+1UL; i<iend; ++i ) {
+         A(i,j) *= inv;
+      }
+
+      for( size_t i=j+1UL; i<iend; ++i ) {
+         const Type tmp( A(i,j) );
+         for( size_t l=j+1UL; l<jend; ++l ) {
+            A(i,l) -= tmp * A(j,l);
+         }
+      }
+   }
+
+   return nonsingular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native LU decomposition with partial pivoting of the given band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= \a n.
+// \return void
+//
+// This function is the native counterpart of the LAPACK gbtrf() function: It performs an LU
+// decomposition with partial pivoting of the given \f$ N \times N \f$ band matrix with \a KL
+// subdiagonals and \a KU superdiagonals without ever leaving the band storage format. Due to
+// the row interchanges the upper bandwidth of \a A is increased to \f$ \min(N-1,KL+KU) \f$.
+// Afterwards the band matrix contains the unit lower triangular factor \a L (without the unit
+// diagonal) in its subdiagonals and the upper triangular factor \a U in its diagonal and
+// superdiagonals, and \f$ A = P \cdot L \cdot U \f$ holds independent of the storage order.
+// The (1-based) pivot indices in \a ipiv refer to the row interchanges in the order in which
+// they have been applied, which is the format expected by the gbtrs() function. The cost of
+// the decomposition is \f$ O(N \cdot KL \cdot (KL+KU)) \f$. In case the matrix is singular
+// the decomposition is completed nonetheless, but the solve functions must not be used.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO >      // Storage order of the band matrix
+void gbtrf( BandMatrix<Type,SO>& A, int* ipiv )
+{
+   const size_t n( A.rows() );
+
+   if( n == 0UL ) {
+      return;
+   }
+
+   A.resize( n, A.lowerBandwidth(), min( n-1UL, A.lowerBandwidth()+A.upperBandwidth() ) );
+
+   gbtrf_backend( A, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solves a single right-hand side with the LU decomposition of a band matrix.
+// \ingroup band_matrix
+//
+// \param A The LU decomposed band matrix.
+// \param b The right-hand side, which is overwritten by the solution.
+// \param ipiv The pivot indices of the decomposition.
+// \return void
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT >  // Type of the right-hand side
+void gbtrs_backend( const BandMatrix<Type,SO>& A, VT& b, const int* ipiv )
+{
+   const size_t n ( A.rows() );
+   const size_t kl( A.lowerBandwidth() );
+   const size_t ku( A.upperBandwidth() );
+
+   // Applying the row interchanges and solving L*y = P^T*b
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const size_t p( ipiv[j] - 1 );
+      if( p != j ) {
+         std::swap( b[p], b[j] );
+      }
+
+      const size_t iend( min( n, j+kl+1UL ) );
+      for( size_t i=j+1UL; i<iend; ++i ) {
+         b[i] -= A(i,j) * b[j];
+      }
+   }
+
+   // Solving U*x = y
+   for( size_t j=n; j-- > 0UL; )
+   {
+      b[j] /= A(j,j);
+
+      const size_t ibegin( ( j > ku )?( j-ku ):( 0UL ) );
+      for( size_t i=ibegin; i<j; ++i ) {
+         b[i] -= A(i,j) * b[j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solver for a band linear system of equations (\f$ A*x=b \f$) based on the LU
+//        decomposition of the band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix decomposed by the gbtrf() function.
+// \param b The right-hand side vector, which is overwritten by the solution vector.
+// \param ipiv The pivot indices determined by the gbtrf() function.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// This function is the native counterpart of the LAPACK gbtrs() function. It solves the linear
+// system in \f$ O(N \cdot (2KL+KU)) \f$ by a forward substitution with the pivoted factor \a L
+// and a backward substitution with the upper factor \a U.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT    // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the right-hand side vector
+void gbtrs( const BandMatrix<Type,SO>& A, DenseVector<VT,TF>& b, const int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+
+   if( (~b).size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   gbtrs_backend( A, ~b, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solver for a band linear system of equations with multiple right-hand sides
+//        (\f$ A*X=B \f$) based on the LU decomposition of the band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix decomposed by the gbtrf() function.
+// \param B The matrix of right-hand sides (one per column), which is overwritten by the solution.
+// \param ipiv The pivot indices determined by the gbtrf() function.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+//
+// This function is the native counterpart of the LAPACK gbtrs() function. The columns of \a B
+// are solved independently of each other and are distributed among the available threads in
+// case the total work exceeds the SMP band multiplication threshold.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void gbtrs( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B, const int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+
+   if( (~B).rows() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   MT& X( ~B );
+
+   bandSolveFor( A.capacity(), X.columns(), [&A,&X,ipiv]( size_t first, size_t last )
+   {
+      for( size_t j=first; j<last; ++j ) {
+         auto x( column( X, j ) );
+         gbtrs_backend( A, x, ipiv );
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solver for a band linear system of equations (\f$ A*x=b \f$).
+// \ingroup band_matrix
+//
+// \param A The band matrix, which is overwritten by its LU decomposition.
+// \param b The right-hand side vector, which is overwritten by the solution vector.
+// \param ipiv Auxiliary array for the pivot indices; size >= \a n.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK gbsv() function. It combines the
+// gbtrf() and gbtrs() functions. In case the band matrix is singular, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT    // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the right-hand side vector
+void gbsv( BandMatrix<Type,SO>& A, DenseVector<VT,TF>& b, int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+
+   const size_t n( A.rows() );
+
+   if( (~b).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   if( n == 0UL ) {
+      return;
+   }
+
+   A.resize( n, A.lowerBandwidth(), min( n-1UL, A.lowerBandwidth()+A.upperBandwidth() ) );
+
+   if( !gbtrf_backend( A, ipiv ) ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+
+   gbtrs_backend( A, ~b, ipiv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solver for a band linear system of equations with multiple right-hand sides
+//        (\f$ A*X=B \f$).
+// \ingroup band_matrix
+//
+// \param A The band matrix, which is overwritten by its LU decomposition.
+// \param B The matrix of right-hand sides (one per column), which is overwritten by the solution.
+// \param ipiv Auxiliary array for the pivot indices; size >= \a n.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function is the native counterpart of the LAPACK gbsv() function. It combines the
+// gbtrf() and gbtrs() functions. In case the band matrix is singular, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void gbsv( BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B, int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+
+   const size_t n( A.rows() );
+
+   if( (~B).rows() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   if( n == 0UL ) {
+      return;
+   }
+
+   A.resize( n, A.lowerBandwidth(), min( n-1UL, A.lowerBandwidth()+A.upperBandwidth() ) );
+
+   if( !gbtrf_backend( A, ipiv ) ) {
+      BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+   }
+
+   gbtrs( A, ~B, ipiv );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BAND CHOLESKY DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Native Cholesky decomposition of the given positive definite band matrix.
+// \ingroup band_matrix
+//
+// \param A The symmetric (or Hermitian) positive definite band matrix to be decomposed.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function is the native counterpart of the LAPACK pbtrf() function: It computes the
+// Cholesky decomposition \f$ A = L \cdot L^H \f$ of the given symmetric (or Hermitian) positive
+// definite band matrix. Only the diagonal and the \a KL subdiagonals of \a A are referenced and
+// overwritten by the lower triangular factor \a L, which has the same lower bandwidth as \a A.
+// The superdiagonals are not referenced. The cost of the decomposition is \f$ O(N \cdot KL^2) \f$.
+// In case the matrix is not positive definite, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO >      // Storage order of the band matrix
+void pbtrf( BandMatrix<Type,SO>& A )
+{
+   using RT = UnderlyingBuiltin_<Type>;
+
+   const size_t n ( A.rows() );
+   const size_t kl( A.lowerBandwidth() );
+
+   for( size_t j=0UL; j<n; ++j )
+   {
+      const size_t kbegin( ( j > kl )?( j-kl ):( 0UL ) );
+
+      RT d( real( A(j,j) ) );
+      for( size_t k=kbegin; k<j; ++k ) {
+         d -= real( A(j,k) * conj( A(j,k) ) );
+      }
+
+      if( !( d > RT(0) ) ) {
+         BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+      }
+
+      d = std::sqrt( d );
+      A(j,j) = d;
+
+      const size_t iend( min( n, j+kl+1UL ) );
+      for( size_t i=j+1UL; i<iend; ++i ) {
+         Type tmp( A(i,j) );
+         for( size_t k=( ( i > kl )?( i-kl ):( 0UL ) ); k<j; ++k ) {
+            tmp -= A(i,k) * conj( A(j,k) );
+         }
+         A(i,j) = tmp / d;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Solves a single right-hand side with the Cholesky decomposition of a band matrix.
+// \ingroup band_matrix
+//
+// \param L The Cholesky decomposed band matrix.
+// \param b The right-hand side, which is overwritten by the solution.
+// \return void
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT >  // Type of the right-hand side
+void pbtrs_backend( const BandMatrix<Type,SO>& L, VT& b )
+{
+   const size_t n ( L.rows() );
+   const size_t kl( L.lowerBandwidth() );
+
+   // Solving L*y = b
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const size_t kbegin( ( i > kl )?( i-kl ):( 0UL ) );
+      for( size_t k=kbegin; k<i; ++k ) {
+         b[i] -= L(i,k) * b[k];
+      }
+      b[i] /= real( L(i,i) );
+   }
+
+   // Solving L^H*x = y
+   for( size_t i=n; i-- > 0UL; )
+   {
+      const size_t kend( min( n, i+kl+1UL ) );
+      for( size_t k=i+1UL; k<kend; ++k ) {
+         b[i] -= conj( L(k,i) ) * b[k];
+      }
+      b[i] /= real( L(i,i) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solver for a positive definite band linear system of equations (\f$ A*x=b \f$)
+//        based on the Cholesky decomposition of the band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix decomposed by the pbtrf() function.
+// \param b The right-hand side vector, which is overwritten by the solution vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// This function is the native counterpart of the LAPACK pbtrs() function.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT    // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the right-hand side vector
+void pbtrs( const BandMatrix<Type,SO>& A, DenseVector<VT,TF>& b )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+
+   if( (~b).size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   pbtrs_backend( A, ~b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solver for a positive definite band linear system of equations with multiple
+//        right-hand sides (\f$ A*X=B \f$) based on the Cholesky decomposition of the band matrix.
+// \ingroup band_matrix
+//
+// \param A The band matrix decomposed by the pbtrf() function.
+// \param B The matrix of right-hand sides (one per column), which is overwritten by the solution.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+//
+// This function is the native counterpart of the LAPACK pbtrs() function. The columns of \a B
+// are solved independently of each other and are distributed among the available threads in
+// case the total work exceeds the SMP band multiplication threshold.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void pbtrs( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+
+   if( (~B).rows() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   MT& X( ~B );
+
+   bandSolveFor( A.capacity(), X.columns(), [&A,&X]( size_t first, size_t last )
+   {
+      for( size_t j=first; j<last; ++j ) {
+         auto x( column( X, j ) );
+         pbtrs_backend( A, x );
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solver for a positive definite band linear system of equations (\f$ A*x=b \f$).
+// \ingroup band_matrix
+//
+// \param A The band matrix, which is overwritten by its Cholesky factor.
+// \param b The right-hand side vector, which is overwritten by the solution vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function is the native counterpart of the LAPACK pbsv() function. It combines the
+// pbtrf() and pbtrs() functions.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT    // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the right-hand side vector
+void pbsv( BandMatrix<Type,SO>& A, DenseVector<VT,TF>& b )
+{
+   if( (~b).size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   pbtrf( A );
+   pbtrs( A, ~b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native solver for a positive definite band linear system of equations with multiple
+//        right-hand sides (\f$ A*X=B \f$).
+// \ingroup band_matrix
+//
+// \param A The band matrix, which is overwritten by its Cholesky factor.
+// \param B The matrix of right-hand sides (one per column), which is overwritten by the solution.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function is the native counterpart of the LAPACK pbsv() function. It combines the
+// pbtrf() and pbtrs() functions.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void pbsv( BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B )
+{
+   if( (~B).rows() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   pbtrf( A );
+   pbtrs( A, ~B );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIDIAGONAL SOLVER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward elimination of the Thomas algorithm for a tridiagonal band matrix.
+// \ingroup band_matrix
+//
+// \param A The tridiagonal band matrix.
+// \param c The modified superdiagonal; size >= \a n.
+// \param d The inverted modified diagonal; size >= \a n.
+// \return void
+// \exception std::invalid_argument Invalid non-tridiagonal matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO >      // Storage order of the band matrix
+void thomas_factor( const BandMatrix<Type,SO>& A, DynamicVector<Type>& c, DynamicVector<Type>& d )
+{
+   if( A.lowerBandwidth() > 1UL || A.upperBandwidth() > 1UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-tridiagonal matrix provided" );
+   }
+
+   const size_t n( A.rows() );
+
+   c.resize( n, false );
+   d.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Type beta( ( i == 0UL )?( A(i,i) ):( A(i,i) - A(i,i-1UL) * c[i-1UL] ) );
+
+      if( isDefault( beta ) ) {
+         BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+      }
+
+      d[i] = Type(1) / beta;
+      c[i] = ( i+1UL < n )?( A(i,i+1UL) * d[i] ):( Type(0) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forward and backward substitution of the Thomas algorithm for a single right-hand side.
+// \ingroup band_matrix
+//
+// \param A The tridiagonal band matrix.
+// \param c The modified superdiagonal computed by thomas_factor().
+// \param d The inverted modified diagonal computed by thomas_factor().
+// \param b The right-hand side, which is overwritten by the solution.
+// \return void
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT >  // Type of the right-hand side
+void thomas_backend( const BandMatrix<Type,SO>& A, const DynamicVector<Type>& c,
+                     const DynamicVector<Type>& d, VT& b )
+{
+   const size_t n( A.rows() );
+
+   if( n == 0UL ) {
+      return;
+   }
+
+   b[0UL] *= d[0UL];
+   for( size_t i=1UL; i<n; ++i ) {
+      b[i] = ( b[i] - A(i,i-1UL) * b[i-1UL] ) * d[i];
+   }
+
+   for( size_t i=n-1UL; i-- > 0UL; ) {
+      b[i] -= c[i] * b[i+1UL];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solver for a tridiagonal linear system of equations (\f$ A*x=b \f$) via the Thomas
+//        algorithm.
+// \ingroup band_matrix
+//
+// \param A The tridiagonal band matrix (KL <= 1, KU <= 1).
+// \param b The right-hand side vector, which is overwritten by the solution vector.
+// \return void
+// \exception std::invalid_argument Invalid non-tridiagonal matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the given tridiagonal linear system in \f$ O(N) \f$ by means of the
+// Thomas algorithm, i.e. a Gaussian elimination without pivoting. In contrast to the gbsv()
+// function the band matrix is not modified. Since no pivoting is performed, the algorithm is
+// only guaranteed to be stable for diagonally dominant or symmetric positive definite matrices.
+// In case a zero pivot is encountered, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT    // Type of the right-hand side vector
+        , bool TF >      // Transpose flag of the right-hand side vector
+void thomas( const BandMatrix<Type,SO>& A, DenseVector<VT,TF>& b )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT );
+
+   if( (~b).size() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   DynamicVector<Type> c, d;
+   thomas_factor( A, c, d );
+   thomas_backend( A, c, d, ~b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solver for a tridiagonal linear system of equations with multiple right-hand sides
+//        (\f$ A*X=B \f$) via the Thomas algorithm.
+// \ingroup band_matrix
+//
+// \param A The tridiagonal band matrix (KL <= 1, KU <= 1).
+// \param B The matrix of right-hand sides (one per column), which is overwritten by the solution.
+// \return void
+// \exception std::invalid_argument Invalid non-tridiagonal matrix provided.
+// \exception std::invalid_argument Invalid right-hand side matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the given tridiagonal linear system by means of the Thomas algorithm.
+// The elimination of the matrix is performed only once, the columns of \a B are solved
+// independently of each other and are distributed among the available threads in case the
+// total work exceeds the SMP band multiplication threshold.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void thomas( const BandMatrix<Type,SO>& A, DenseMatrix<MT,SO2>& B )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+
+   if( (~B).rows() != A.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side matrix provided" );
+   }
+
+   DynamicVector<Type> c, d;
+   thomas_factor( A, c, d );
+
+   MT& X( ~B );
+
+   bandSolveFor( A.capacity(), X.columns(), [&A,&c,&d,&X]( size_t first, size_t last )
+   {
+      for( size_t j=first; j<last; ++j ) {
+         auto x( column( X, j ) );
+         thomas_backend( A, c, d, x );
+      }
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
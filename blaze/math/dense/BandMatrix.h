@@ -0,0 +1,2498 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BandMatrix.h
+//  \brief Implementation of a square dense matrix in band storage format
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BANDMATRIX_H_
+#define _BLAZE_MATH_DENSE_BANDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsBandMatrix.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/IsView.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup band_matrix BandMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a square dense matrix in band storage format.
+// \ingroup band_matrix
+//
+// The BandMatrix class template represents a square \f$ N \times N \f$ matrix, whose non-zero
+// elements are restricted to a band around the diagonal: The \a KL subdiagonals below and the
+// \a KU superdiagonals above the diagonal. Only the \f$ N(KL+KU+1) \f$ elements of the band are
+// stored. The type of the elements and the storage order of the matrix can be specified via the
+// two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class BandMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BandMatrix can be used with any numeric
+//          element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// The elements are stored in the band format of LAPACK: Every row (for row-major matrices) or
+// column (for column-major matrices) occupies \f$ KL+KU+1 \f$ consecutive elements, which hold
+// the part of the row or column inside of the band. In case of column-major matrices the layout
+// is identical to the layout expected by the LAPACK \c gb functions (with a leading dimension of
+// \f$ KL+KU+1 \f$), in case of row-major matrices it is identical to the layout of the transpose.
+// The positions of the storage that correspond to elements outside of the matrix (in the first
+// and last rows or columns) are kept at zero.
+//
+// A BandMatrix provides read access to all elements of the matrix (the elements outside of the
+// band are 0) and write access to all elements inside of the band. The bandwidths are set on
+// construction or via the resize() function; the conversion from another matrix detects the
+// bandwidths of the given matrix:
+
+   \code
+   using blaze::BandMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::columnMajor;
+
+   BandMatrix<double,columnMajor> A( 100000UL, 1UL, 1UL );  // Tridiagonal 100000x100000 matrix
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      A(i,i) = 2.0;
+      if( i > 0UL ) A(i,i-1UL) = -1.0;
+      if( i+1UL < A.rows() ) A(i,i+1UL) = -1.0;
+   }
+
+   DynamicVector<double> x( 100000UL ), y;
+   DynamicMatrix<double,columnMajor> B( 100000UL, 16UL ), C;
+   // ... Initialization
+
+   y = A * x;          // Banded matrix/vector multiplication
+   C = A * B;          // Banded matrix/dense matrix multiplication
+
+   BandMatrix<double,columnMajor> D( A * A );  // Pentadiagonal product of two band matrices
+
+   thomas( A, y );     // Solution of the tridiagonal system A*x=y (see BandDecomposition.h)
+   \endcode
+
+// The multiplications with dense vectors and dense matrices only traverse the stored band and
+// require \f$ O(N(KL+KU+1)) \f$ operations per vector. They are vectorized for the built-in
+// element types (in case the element type of the vector matches the element type of the matrix)
+// and are parallelized in case the amount of work exceeds the \c SMP_BANDMULT_THRESHOLD. The
+// product of two band matrices results in a band matrix with the sum of the bandwidths. All
+// other operations treat a BandMatrix like any other dense matrix, i.e. the result of for
+// instance an addition of a band matrix and a dense matrix is a DynamicMatrix.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class BandMatrix
+   : public DenseMatrix< BandMatrix<Type,SO>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   using SIMDType = SIMDTrait_<Type>;  //!< SIMD type of the matrix elements.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = BandMatrix<Type,SO>;      //!< Type of this BandMatrix instance.
+   using BaseType       = DenseMatrix<This,SO>;     //!< Base type of this BandMatrix instance.
+   using ResultType     = DynamicMatrix<Type,SO>;   //!< Result type for expression template evaluations.
+   using OppositeType   = DynamicMatrix<Type,!SO>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = DynamicMatrix<Type,!SO>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                     //!< Type of the matrix elements.
+   using ReturnType     = const Type;               //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;              //!< Data type for composite expression templates.
+   using Reference      = Type&;                    //!< Reference to a non-constant band element.
+   using ConstReference = const Type;               //!< Reference to a constant matrix element.
+   using Pointer        = Type*;                    //!< Pointer to a non-constant band element.
+   using ConstPointer   = const Type*;              //!< Pointer to a constant band element.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BandMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = BandMatrix<NewType,SO>;  //!< The type of the other BandMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a BandMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = BandMatrix<Type,SO>;  //!< The type of the other BandMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of a row (or column) of the band matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = Type;                             //!< Type of the underlying elements.
+      using PointerType      = const Type*;                      //!< Pointer return type.
+      using ReferenceType    = const Type;                       //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : matrix_( nullptr )  // Reference to the band matrix
+         , row_   ( 0UL )      // The current row index of the iterator
+         , column_( 0UL )      // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param matrix The band matrix.
+      // \param row Initial row index of the iterator.
+      // \param column Initial column index of the iterator.
+      */
+      inline ConstIterator( const BandMatrix& matrix, size_t row, size_t column ) noexcept
+         : matrix_( &matrix )  // Reference to the band matrix
+         , row_   ( row     )  // The current row index of the iterator
+         , column_( column  )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( size_t inc ) noexcept {
+         ( SO )?( row_ += inc ):( column_ += inc );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( size_t dec ) noexcept {
+         ( SO )?( row_ -= dec ):( column_ -= dec );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         ( SO )?( ++row_ ):( ++column_ );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) noexcept {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() noexcept {
+         ( SO )?( --row_ ):( --column_ );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) noexcept {
+         const ConstIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReferenceType operator*() const {
+         return (*matrix_)( row_, column_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      friend inline bool operator==( const ConstIterator& lhs, const ConstIterator& rhs ) noexcept {
+         return ( SO )?( lhs.row_ == rhs.row_ ):( lhs.column_ == rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      friend inline bool operator!=( const ConstIterator& lhs, const ConstIterator& rhs ) noexcept {
+         return ( SO )?( lhs.row_ != rhs.row_ ):( lhs.column_ != rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      friend inline bool operator<( const ConstIterator& lhs, const ConstIterator& rhs ) noexcept {
+         return ( SO )?( lhs.row_ < rhs.row_ ):( lhs.column_ < rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      friend inline bool operator>( const ConstIterator& lhs, const ConstIterator& rhs ) noexcept {
+         return ( SO )?( lhs.row_ > rhs.row_ ):( lhs.column_ > rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      friend inline bool operator<=( const ConstIterator& lhs, const ConstIterator& rhs ) noexcept {
+         return ( SO )?( lhs.row_ <= rhs.row_ ):( lhs.column_ <= rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      friend inline bool operator>=( const ConstIterator& lhs, const ConstIterator& rhs ) noexcept {
+         return ( SO )?( lhs.row_ >= rhs.row_ ):( lhs.column_ >= rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return ( SO )?( row_ - rhs.row_ ):( column_ - rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) noexcept {
+         if( SO )
+            return ConstIterator( *it.matrix_, it.row_ + inc, it.column_ );
+         else
+            return ConstIterator( *it.matrix_, it.row_, it.column_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ConstIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) noexcept {
+         return it + inc;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) noexcept {
+         if( SO )
+            return ConstIterator( *it.matrix_, it.row_ - dec, it.column_ );
+         else
+            return ConstIterator( *it.matrix_, it.row_, it.column_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const BandMatrix* matrix_;  //!< Reference to the band matrix.
+      size_t row_;                //!< The current row index of the iterator.
+      size_t column_;             //!< The current column index of the iterator.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Since a full row (or column) of a band matrix
+       cannot be loaded as SIMD vectors the flag is set to \a false. */
+   enum : bool { simdEnabled = false };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since the SMP assignments split the operands into submatrices, which are
+       not available for the band storage format, the flag is set to \a false. Note that the
+       multiplications with dense vectors and dense matrices are nevertheless executed in
+       parallel (see canSMPAssign()). */
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BandMatrix() noexcept;
+   explicit inline BandMatrix( size_t n, size_t kl, size_t ku );
+   explicit inline BandMatrix( size_t n, size_t kl, size_t ku, const Type& init );
+
+   template< typename MT, bool SO2 >
+   explicit inline BandMatrix( const Matrix<MT,SO2>& m );
+
+   template< typename MT, bool SO2 >
+   explicit inline BandMatrix( const Matrix<MT,SO2>& m, size_t kl, size_t ku );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename MT, bool SO2 >
+   inline BandMatrix& operator=( const Matrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 >
+   inline BandMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 >
+   inline BandMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, BandMatrix >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, BandMatrix >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t lowerBandwidth() const noexcept;
+   inline size_t upperBandwidth() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline bool   inBand( size_t i, size_t j ) const noexcept;
+   inline size_t index( size_t i, size_t j ) const noexcept;
+   inline void   reset();
+   inline void   clear();
+   inline void   resize( size_t n, size_t kl, size_t ku, bool preserve=true );
+   inline void   swap( BandMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename T1, typename T2 >
+   struct VectorizedKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            IsSame<T1,Type>::value && IsSame<T2,Type>::value &&
+                            IsBuiltin<Type>::value && IsVectorizable<Type>::value &&
+                            HasSIMDAdd<Type,Type>::value && HasSIMDMult<Type,Type>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< bool TF, typename T1, typename T2 >
+   inline void mult( T1* y, const T2* x, bool parallel ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T2, bool SO2 >
+   static inline void bandwidths( const BandMatrix<T2,SO2>& m, size_t& kl, size_t& ku );
+
+   template< typename MT, bool SO2 >
+   static inline void bandwidths( const DenseMatrix<MT,SO2>& m, size_t& kl, size_t& ku );
+
+   template< typename MT, bool SO2 >
+   static inline void bandwidths( const SparseMatrix<MT,SO2>& m, size_t& kl, size_t& ku );
+
+   template< typename MT >
+   inline void setup( const MT& m, size_t kl, size_t ku );
+
+   template< bool SUB, typename MT >
+   inline void update( const MT& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Kernel functions****************************************************************************
+   /*!\name Kernel functions */
+   //@{
+   template< typename T1, typename T2 >
+   inline void lineKernel( T1* y, const T2* x, size_t begin, size_t end ) const;
+
+   template< typename T1, typename T2 >
+   inline void stripKernel( T1* y, const T2* x, size_t begin, size_t end ) const;
+
+   template< typename T1, typename T2 >
+   static inline DisableIf_< VectorizedKernel<T1,T2>, T1 >
+      dot( const Type* a, const T2* x, size_t n ) noexcept;
+
+   template< typename T1, typename T2 >
+   static inline EnableIf_< VectorizedKernel<T1,T2>, T1 >
+      dot( const Type* a, const T2* x, size_t n ) noexcept;
+
+   template< typename T1, typename T2 >
+   static inline DisableIf_< VectorizedKernel<T1,T2> >
+      axpy( T1* y, const Type* a, T2 alpha, size_t n ) noexcept;
+
+   template< typename T1, typename T2 >
+   static inline EnableIf_< VectorizedKernel<T1,T2> >
+      axpy( T1* y, const Type* a, T2 alpha, size_t n ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Values = std::vector< Type, AlignedAllocator<Type> >;  //!< Type of the value array.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;   //!< The current number of rows and columns of the matrix.
+   size_t kl_;  //!< The number of subdiagonals of the band.
+   size_t ku_;  //!< The number of superdiagonals of the band.
+   Values v_;   //!< The elements of the band in LAPACK band storage format.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   template< typename Type2, bool SO2 > friend class BandMatrix;
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BandMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix() noexcept
+   : n_ ( 0UL )  // The current number of rows and columns of the matrix
+   , kl_( 0UL )  // The number of subdiagonals of the band
+   , ku_( 0UL )  // The number of superdiagonals of the band
+   , v_ ()       // The elements of the band in LAPACK band storage format
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a \f$ N \times N \f$ BandMatrix with \a kl subdiagonals and \a ku
+//        superdiagonals.
+//
+// \param n The number of rows and columns of the matrix.
+// \param kl The number of subdiagonals of the band \f$[0..N-1]\f$.
+// \param ku The number of superdiagonals of the band \f$[0..N-1]\f$.
+// \exception std::invalid_argument Invalid bandwidths for band matrix.
+//
+// All elements of the matrix are initialized to 0. In case one of the given bandwidths is not
+// smaller than \a n, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( size_t n, size_t kl, size_t ku )
+   : n_ ( n  )  // The current number of rows and columns of the matrix
+   , kl_( kl )  // The number of subdiagonals of the band
+   , ku_( ku )  // The number of superdiagonals of the band
+   , v_ ()      // The elements of the band in LAPACK band storage format
+{
+   if( ( kl >= n || ku >= n ) && ( n > 0UL || kl > 0UL || ku > 0UL ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid bandwidths for band matrix" );
+   }
+
+   v_.resize( n*(kl+ku+1UL), Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of all elements of the band.
+//
+// \param n The number of rows and columns of the matrix.
+// \param kl The number of subdiagonals of the band \f$[0..N-1]\f$.
+// \param ku The number of superdiagonals of the band \f$[0..N-1]\f$.
+// \param init The initial value of the elements of the band.
+// \exception std::invalid_argument Invalid bandwidths for band matrix.
+//
+// All elements inside of the band are initialized to \a init, all elements outside of the band
+// are 0. In case one of the given bandwidths is not smaller than \a n, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline BandMatrix<Type,SO>::BandMatrix( size_t n, size_t kl, size_t ku, const Type& init )
+   : BandMatrix( n, kl, ku )
+{
+   for( size_t i=0UL; i<n_; ++i ) {
+      const size_t jbegin( ( i > kl_ )?( i-kl_ ):( 0UL ) );
+      const size_t jend  ( min( n_, i+ku_+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         v_[index(i,j)] = init;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted into band storage.
+// \exception std::invalid_argument Invalid setup of band matrix.
+//
+// The bandwidths of the band matrix are set to the bandwidths of the given matrix, i.e. to the
+// distance of the farthest non-zero element below and above the diagonal. In case the given
+// matrix is not square, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline BandMatrix<Type,SO>::BandMatrix( const Matrix<MT,SO2>& m )
+   : BandMatrix()
+{
+   if( (~m).rows() != (~m).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of band matrix" );
+   }
+
+   CompositeType_<MT> tmp( ~m );
+
+   size_t kl( 0UL ), ku( 0UL );
+   bandwidths( tmp, kl, ku );
+
+   setup( tmp, kl, ku );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices with explicitly given bandwidths.
+//
+// \param m Matrix to be converted into band storage.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+// \exception std::invalid_argument Invalid setup of band matrix.
+//
+// In case the given matrix is not square, in case one of the bandwidths is not smaller than the
+// number of rows of \a m, or in case the given matrix contains non-zero elements outside of the
+// specified band, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline BandMatrix<Type,SO>::BandMatrix( const Matrix<MT,SO2>& m, size_t kl, size_t ku )
+   : BandMatrix()
+{
+   if( (~m).rows() != (~m).columns() ||
+       ( ( kl >= (~m).rows() || ku >= (~m).rows() ) && ( (~m).rows() > 0UL || kl > 0UL || ku > 0UL ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of band matrix" );
+   }
+
+   CompositeType_<MT> tmp( ~m );
+
+   size_t lower( 0UL ), upper( 0UL );
+   bandwidths( tmp, lower, upper );
+
+   if( lower > kl || upper > ku ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of band matrix" );
+   }
+
+   setup( tmp, kl, ku );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the elements of the band.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed band element.
+//
+// This function grants write access to the elements inside of the band, i.e. it requires that
+// \f$ i-KL \le j \le i+KU \f$. This precondition as well as the access indices are only checked
+// in case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform
+// a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Reference
+   BandMatrix<Type,SO>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_USER_ASSERT( inBand( i, j ), "Element is not part of the band" );
+
+   return v_[index(i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function returns the value of the specified element, which is 0 for all elements outside
+// of the band. It only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstReference
+   BandMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   if( inBand( i, j ) )
+      return v_[index(i,j)];
+   else
+      return Type();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the elements of the band.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed band element.
+// \exception std::out_of_range Invalid matrix access index.
+// \exception std::invalid_argument Invalid access to element outside of the band.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices and of the position of the element with respect to the band.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Reference
+   BandMatrix<Type,SO>::at( size_t i, size_t j )
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   if( !inBand( i, j ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid access to element outside of the band" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstReference
+   BandMatrix<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the band matrix. The position of
+// the element \f$ a_{ij} \f$ of the band within the storage is given by the index() function.
+// The positions of the storage that do not correspond to an element of the matrix must remain 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::Pointer BandMatrix<Type,SO>::data() noexcept
+{
+   return v_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the band elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the band matrix. The position of
+// the element \f$ a_{ij} \f$ of the band within the storage is given by the index() function.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstPointer BandMatrix<Type,SO>::data() const noexcept
+{
+   return v_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return \a nullptr.
+//
+// Since the full rows (or columns) of a band matrix are not stored, this function always returns
+// \a nullptr. It is provided for the compatibility with dense row and column views, which use
+// the null pointer to detect that no contiguous storage is available.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstPointer BandMatrix<Type,SO>::data( size_t i ) const noexcept
+{
+   UNUSED_PARAMETER( i );
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the band matrix is row-major, the function returns an iterator to the first element
+// of row \a i, in case it is column-major, the function returns an iterator to the first element
+// of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator
+   BandMatrix<Type,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid band matrix row/column access index" );
+
+   if( SO )
+      return ConstIterator( *this, 0UL, i );
+   else
+      return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the band matrix is row-major, the function returns an iterator to the first element
+// of row \a i, in case it is column-major, the function returns an iterator to the first element
+// of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator
+   BandMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the band matrix is row-major, the function returns an iterator just past the last
+// element of row \a i, in case it is column-major, the function returns an iterator just past
+// the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator
+   BandMatrix<Type,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid band matrix row/column access index" );
+
+   if( SO )
+      return ConstIterator( *this, n_, i );
+   else
+      return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the band matrix is row-major, the function returns an iterator just past the last
+// element of row \a i, in case it is column-major, the function returns an iterator just past
+// the last element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename BandMatrix<Type,SO>::ConstIterator
+   BandMatrix<Type,SO>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid setup of band matrix.
+//
+// The matrix is resized according to the given matrix and initialized as a copy of this matrix.
+// The bandwidths are set to the bandwidths of the given matrix. In case the given matrix is not
+// square, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   BandMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown. In case the given matrix has non-zero elements outside of the band, the bandwidths
+// of the band matrix are extended accordingly.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const BandMatrix tmp( ~rhs );
+      update<false>( tmp );
+   }
+   else {
+      CompositeType_<MT> tmp( ~rhs );
+      update<false>( tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown. In case the given matrix has non-zero elements outside of the band, the bandwidths
+// of the band matrix are extended accordingly.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline BandMatrix<Type,SO>& BandMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      const BandMatrix tmp( ~rhs );
+      update<true>( tmp );
+   }
+   else {
+      CompositeType_<MT> tmp( ~rhs );
+      update<true>( tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, BandMatrix<Type,SO> >&
+   BandMatrix<Type,SO>::operator*=( Other rhs )
+{
+   for( Type& value : v_ ) {
+      value *= rhs;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, BandMatrix<Type,SO> >&
+   BandMatrix<Type,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      const size_t jbegin( ( i > kl_ )?( i-kl_ ):( 0UL ) );
+      const size_t jend  ( min( n_, i+ku_+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         v_[index(i,j)] /= rhs;
+      }
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of subdiagonals of the band.
+//
+// \return The lower bandwidth \a KL of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::lowerBandwidth() const noexcept
+{
+   return kl_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of superdiagonals of the band.
+//
+// \return The upper bandwidth \a KU of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::upperBandwidth() const noexcept
+{
+   return ku_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows/columns of the band storage.
+//
+// \return The leading dimension \f$ KL+KU+1 \f$ of the band storage.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::spacing() const noexcept
+{
+   return kl_ + ku_ + 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the matrix.
+//
+// \return The number of stored elements, i.e. \f$ N(KL+KU+1) \f$.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::capacity() const noexcept
+{
+   return v_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the band matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<n_; ++i )
+      nonzeros += nonZeros( i );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   const size_t lo( SO ? ku_ : kl_ );
+   const size_t hi( SO ? kl_ : ku_ );
+   const size_t lbegin( ( i > lo )?( i-lo ):( 0UL ) );
+   const size_t lend  ( min( n_, i+hi+1UL ) );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t l=lbegin; l<lend; ++l ) {
+      if( !isDefault( v_[i*spacing()+lo+l-i] ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the specified element is part of the band.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return \a true in case \f$ i-KL \le j \le i+KU \f$, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::inBand( size_t i, size_t j ) const noexcept
+{
+   return ( i <= j+kl_ ) && ( j <= i+ku_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the specified element within the band storage.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The position of the element within the storage returned by data().
+//
+// This function returns the position of the element \f$ a_{ij} \f$ within the band storage,
+// which is \f$ j(KL+KU+1)+KU+i-j \f$ for column-major matrices (the LAPACK band layout) and
+// \f$ i(KL+KU+1)+KL+j-i \f$ for row-major matrices. The element has to be part of the band.
+// This precondition is only checked in case BLAZE_USER_ASSERT() is active.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t BandMatrix<Type,SO>::index( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_ && j < n_, "Invalid band matrix access index" );
+   BLAZE_USER_ASSERT( inBand( i, j ), "Element is not part of the band" );
+
+   if( SO )
+      return j*spacing() + ku_ + i - j;
+   else
+      return i*spacing() + kl_ + j - i;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all elements of the band to 0. The bandwidths remain unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::reset()
+{
+   std::fill( v_.begin(), v_.end(), Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size and the bandwidths of the matrix are 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::clear()
+{
+   BandMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size and the bandwidths of the matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param kl The new number of subdiagonals of the band \f$[0..N-1]\f$.
+// \param ku The new number of superdiagonals of the band \f$[0..N-1]\f$.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid bandwidths for band matrix.
+//
+// This function resizes the matrix and changes its bandwidths. In case \a preserve is \a true,
+// all elements that are part of both the old and the new band are preserved; new elements are
+// initialized to 0. Note that this function may invalidate all existing iterators and views.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::resize( size_t n, size_t kl, size_t ku, bool preserve )
+{
+   if( n == n_ && kl == kl_ && ku == ku_ )
+      return;
+
+   BandMatrix tmp( n, kl, ku );
+
+   if( preserve )
+   {
+      const size_t m( min( n, n_ ) );
+      const size_t lower( min( kl, kl_ ) );
+      const size_t upper( min( ku, ku_ ) );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         const size_t jbegin( ( i > lower )?( i-lower ):( 0UL ) );
+         const size_t jend  ( min( m, i+upper+1UL ) );
+         for( size_t j=jbegin; j<jend; ++j ) {
+            tmp.v_[tmp.index(i,j)] = v_[index(i,j)];
+         }
+      }
+   }
+
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two band matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void BandMatrix<Type,SO>::swap( BandMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( n_ , m.n_  );
+   swap( kl_, m.kl_ );
+   swap( ku_, m.ku_ );
+   v_.swap( m.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the bandwidths of the given band matrix.
+//
+// \param m The band matrix.
+// \param kl The resulting number of non-zero subdiagonals.
+// \param ku The resulting number of non-zero superdiagonals.
+// \return void
+//
+// This function only traverses the stored band of \a m in order to determine the distance of
+// the farthest non-zero element below and above the diagonal.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename T2    // Data type of the given band matrix
+        , bool SO2 >     // Storage order of the given band matrix
+inline void BandMatrix<Type,SO>::bandwidths( const BandMatrix<T2,SO2>& m, size_t& kl, size_t& ku )
+{
+   kl = 0UL;
+   ku = 0UL;
+
+   for( size_t i=0UL; i<m.n_; ++i ) {
+      const size_t jbegin( ( i > m.kl_ )?( i-m.kl_ ):( 0UL ) );
+      const size_t jend  ( min( m.n_, i+m.ku_+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         if( isDefault( m.v_[m.index(i,j)] ) ) continue;
+         if( i > j ) kl = max( kl, i-j );
+         else        ku = max( ku, j-i );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the bandwidths of the given dense matrix.
+//
+// \param m The dense matrix.
+// \param kl The resulting number of non-zero subdiagonals.
+// \param ku The resulting number of non-zero superdiagonals.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the given dense matrix
+        , bool SO2 >     // Storage order of the given dense matrix
+inline void BandMatrix<Type,SO>::bandwidths( const DenseMatrix<MT,SO2>& m, size_t& kl, size_t& ku )
+{
+   kl = 0UL;
+   ku = 0UL;
+
+   const size_t M( (~m).rows()    );
+   const size_t N( (~m).columns() );
+
+   for( size_t k=0UL; k<( SO2 ? N : M ); ++k ) {
+      for( size_t l=0UL; l<( SO2 ? M : N ); ++l ) {
+         const size_t i( SO2 ? l : k );
+         const size_t j( SO2 ? k : l );
+         if( isDefault( (~m)(i,j) ) ) continue;
+         if( i > j ) kl = max( kl, i-j );
+         else        ku = max( ku, j-i );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the bandwidths of the given sparse matrix.
+//
+// \param m The sparse matrix.
+// \param kl The resulting number of non-zero subdiagonals.
+// \param ku The resulting number of non-zero superdiagonals.
+// \return void
+//
+// This function only traverses the non-zero elements of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the given sparse matrix
+        , bool SO2 >     // Storage order of the given sparse matrix
+inline void BandMatrix<Type,SO>::bandwidths( const SparseMatrix<MT,SO2>& m, size_t& kl, size_t& ku )
+{
+   kl = 0UL;
+   ku = 0UL;
+
+   const size_t K( SO2 ? (~m).columns() : (~m).rows() );
+
+   for( size_t k=0UL; k<K; ++k ) {
+      for( auto element=(~m).begin(k); element!=(~m).end(k); ++element ) {
+         if( isDefault( element->value() ) ) continue;
+         const size_t i( SO2 ? element->index() : k );
+         const size_t j( SO2 ? k : element->index() );
+         if( i > j ) kl = max( kl, i-j );
+         else        ku = max( ku, j-i );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the band matrix from the given matrix.
+//
+// \param m The matrix to be converted into band storage.
+// \param kl The number of subdiagonals of the band.
+// \param ku The number of superdiagonals of the band.
+// \return void
+//
+// This function sets up the band matrix with the given bandwidths and copies the elements of
+// the band of \a m. The elements of \a m outside of the band are required to be zero.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the foreign matrix
+inline void BandMatrix<Type,SO>::setup( const MT& m, size_t kl, size_t ku )
+{
+   BandMatrix tmp( m.rows(), kl, ku );
+
+   for( size_t k=0UL; k<tmp.n_; ++k ) {
+      const size_t lo( SO ? ku : kl );
+      const size_t hi( SO ? kl : ku );
+      const size_t lbegin( ( k > lo )?( k-lo ):( 0UL ) );
+      const size_t lend  ( min( tmp.n_, k+hi+1UL ) );
+      for( size_t l=lbegin; l<lend; ++l ) {
+         tmp.v_[k*tmp.spacing()+lo+l-k] = ( SO )?( m(l,k) ):( m(k,l) );
+      }
+   }
+
+   swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition/subtraction of the given matrix.
+//
+// \param m The matrix to be added (SUB=false) or subtracted (SUB=true).
+// \return void
+//
+// This function extends the bandwidths of the band matrix to the bandwidths of \a m (if
+// necessary) and adds (or subtracts) the band of \a m.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< bool SUB       // Compilation flag for subtractions
+        , typename MT >  // Type of the foreign matrix
+inline void BandMatrix<Type,SO>::update( const MT& m )
+{
+   size_t kl( 0UL ), ku( 0UL );
+   bandwidths( m, kl, ku );
+
+   if( kl > kl_ || ku > ku_ ) {
+      resize( n_, max( kl, kl_ ), max( ku, ku_ ) );
+   }
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      const size_t jbegin( ( i > kl )?( i-kl ):( 0UL ) );
+      const size_t jend  ( min( n_, i+ku+1UL ) );
+      for( size_t j=jbegin; j<jend; ++j ) {
+         if( SUB ) v_[index(i,j)] -= m(i,j);
+         else      v_[index(i,j)] += m(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool BandMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool BandMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false since the rows (or columns) of a band matrix are not aligned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the multiplication of the matrix with a dense vector is large
+// enough to be executed in parallel, i.e. whether the number of stored elements exceeds the
+// \c SMP_BANDMULT_THRESHOLD.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool BandMatrix<Type,SO>::canSMPAssign() const noexcept
+{
+   return ( capacity() >= SMP_BANDMULT_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of the band matrix with a dense vector.
+//
+// \param y Contiguous, zero-initialized storage of the target vector.
+// \param x Contiguous storage of the right-hand side vector.
+// \param parallel \a true in case the multiplication may be executed in parallel.
+// \return void
+//
+// This function computes \f$ \vec{y}=A*\vec{x} \f$ (TF=false) or \f$ \vec{y}^T=\vec{x}^T*A \f$
+// (TF=true). In case the stored rows (or columns) correspond to the rows (or columns) of the
+// product, every element of \a y is computed as a dot product of a stored row (or column) with
+// a segment of \a x. Otherwise the stored rows (or columns) are scaled and added to segments of
+// \a y. In case \a parallel is \a true and more than one thread is available, the elements of
+// \a y are split into parts of equal size, which are computed concurrently.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< bool TF         // Transpose flag of the vector operands
+        , typename T1     // Element type of the target vector
+        , typename T2 >   // Element type of the right-hand side vector
+inline void BandMatrix<Type,SO>::mult( T1* y, const T2* x, bool parallel ) const
+{
+   // Rows of the band storage (true) or columns of the band storage (false)
+   const bool direct( SO == TF );
+
+   const size_t parts( ( parallel && getNumThreads() > 1UL && !isSerialSectionActive() )
+                       ?( min( n_, getNumThreads() * 2UL ) ):( 1UL ) );
+
+   if( parts <= 1UL ) {
+      if( direct ) lineKernel ( y, x, 0UL, n_ );
+      else         stripKernel( y, x, 0UL, n_ );
+      return;
+   }
+
+   smpFor( 0UL, parts, [&]( size_t first, size_t last ) {
+      for( size_t p=first; p<last; ++p ) {
+         const size_t begin( ( n_ * p ) / parts );
+         const size_t end  ( ( n_ * (p+1UL) ) / parts );
+         if( direct ) lineKernel ( y, x, begin, end );
+         else         stripKernel( y, x, begin, end );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication kernel for the stored rows/columns of the band.
+//
+// \param y Contiguous storage of the target vector.
+// \param x Contiguous storage of the right-hand side vector.
+// \param begin The index of the first row/column of the band storage.
+// \param end The index one past the last row/column of the band storage.
+// \return void
+//
+// This function computes the elements \a begin to \a end of \a y as dot products of the
+// according stored rows/columns of the band with \a x.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename T1     // Element type of the target vector
+        , typename T2 >   // Element type of the right-hand side vector
+inline void BandMatrix<Type,SO>::lineKernel( T1* y, const T2* x, size_t begin, size_t end ) const
+{
+   const size_t lo( SO ? ku_ : kl_ );
+   const size_t hi( SO ? kl_ : ku_ );
+   const size_t ld( spacing() );
+
+   for( size_t k=begin; k<end; ++k ) {
+      const size_t lbegin( ( k > lo )?( k-lo ):( 0UL ) );
+      const size_t lend  ( min( n_, k+hi+1UL ) );
+      y[k] = dot<T1>( v_.data()+k*ld+lo+lbegin-k, x+lbegin, lend-lbegin );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication kernel for the transpose of the band storage.
+//
+// \param y Contiguous, zero-initialized storage of the target vector.
+// \param x Contiguous storage of the right-hand side vector.
+// \param begin The index of the first element of \a y to be computed.
+// \param end The index one past the last element of \a y to be computed.
+// \return void
+//
+// This function computes the elements \a begin to \a end of \a y by adding the according
+// segments of all stored rows/columns that intersect the range, scaled by the according
+// element of \a x. Each segment is stored contiguously.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename T1     // Element type of the target vector
+        , typename T2 >   // Element type of the right-hand side vector
+inline void BandMatrix<Type,SO>::stripKernel( T1* y, const T2* x, size_t begin, size_t end ) const
+{
+   if( begin >= end )
+      return;
+
+   const size_t lo( SO ? ku_ : kl_ );
+   const size_t hi( SO ? kl_ : ku_ );
+   const size_t ld( spacing() );
+
+   const size_t kbegin( ( begin > hi )?( begin-hi ):( 0UL ) );
+   const size_t kend  ( min( n_, end+lo ) );
+
+   for( size_t k=kbegin; k<kend; ++k ) {
+      const size_t lbegin( max( begin, ( k > lo )?( k-lo ):( 0UL ) ) );
+      const size_t lend  ( min( end, k+hi+1UL ) );
+      if( lbegin < lend ) {
+         axpy( y+lbegin, v_.data()+k*ld+lo+lbegin-k, x[k], lend-lbegin );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dot product of a segment of the band storage and a vector segment.
+//
+// \param a The first stored element of the segment.
+// \param x The first element of the vector segment.
+// \param n The number of elements of the segment.
+// \return The resulting dot product.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename T1     // Type of the result
+        , typename T2 >   // Element type of the vector
+inline DisableIf_< typename BandMatrix<Type,SO>::template VectorizedKernel<T1,T2>, T1 >
+   BandMatrix<Type,SO>::dot( const Type* a, const T2* x, size_t n ) noexcept
+{
+   T1 sum = T1();
+
+   for( size_t j=0UL; j<n; ++j ) {
+      sum += a[j] * x[j];
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized dot product of a segment of the band storage and a vector segment.
+//
+// \param a The first stored element of the segment.
+// \param x The first element of the vector segment.
+// \param n The number of elements of the segment.
+// \return The resulting dot product.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename T1     // Type of the result
+        , typename T2 >   // Element type of the vector
+inline EnableIf_< typename BandMatrix<Type,SO>::template VectorizedKernel<T1,T2>, T1 >
+   BandMatrix<Type,SO>::dot( const Type* a, const T2* x, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   SIMDType xmm1, xmm2;
+   size_t j( 0UL );
+
+   for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
+      xmm1 += loadu( a+j          ) * loadu( x+j          );
+      xmm2 += loadu( a+j+SIMDSIZE ) * loadu( x+j+SIMDSIZE );
+   }
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      xmm1 += loadu( a+j ) * loadu( x+j );
+   }
+
+   T1 sum( blaze::sum( xmm1 + xmm2 ) );
+
+   for( ; j<n; ++j ) {
+      sum += a[j] * x[j];
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default update of a vector segment with a scaled segment of the band storage.
+//
+// \param y The first element of the target vector segment.
+// \param a The first stored element of the segment.
+// \param alpha The scaling factor.
+// \param n The number of elements of the segment.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename T1     // Element type of the target vector
+        , typename T2 >   // Type of the scaling factor
+inline DisableIf_< typename BandMatrix<Type,SO>::template VectorizedKernel<T1,T2> >
+   BandMatrix<Type,SO>::axpy( T1* y, const Type* a, T2 alpha, size_t n ) noexcept
+{
+   for( size_t j=0UL; j<n; ++j ) {
+      y[j] += a[j] * alpha;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized update of a vector segment with a scaled segment of the band storage.
+//
+// \param y The first element of the target vector segment.
+// \param a The first stored element of the segment.
+// \param alpha The scaling factor.
+// \param n The number of elements of the segment.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename T1     // Element type of the target vector
+        , typename T2 >   // Type of the scaling factor
+inline EnableIf_< typename BandMatrix<Type,SO>::template VectorizedKernel<T1,T2> >
+   BandMatrix<Type,SO>::axpy( T1* y, const Type* a, T2 alpha, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   const SIMDType factor( set( alpha ) );
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      storeu( y+j, loadu( y+j ) + loadu( a+j ) * factor );
+   }
+   for( ; j<n; ++j ) {
+      y[j] += a[j] * alpha;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BANDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BandMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( BandMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void clear( BandMatrix<Type,SO>& m );
+
+template< bool RF, typename Type, bool SO >
+inline bool isDefault( const BandMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isIntact( const BandMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( BandMatrix<Type,SO>& a, BandMatrix<Type,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( BandMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given band matrix.
+// \ingroup band_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( BandMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given band matrix is in default state.
+// \ingroup band_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the band matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::BandMatrix<double> A;
+   // ... Initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const BandMatrix<Type,SO>& m )
+{
+   return ( m.rows() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given band matrix are intact.
+// \ingroup band_matrix
+//
+// \param m The band matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks the size of the band storage and verifies that the positions of the
+// storage that do not correspond to an element of the matrix are 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isIntact( const BandMatrix<Type,SO>& m )
+{
+   const size_t n ( m.rows() );
+   const size_t ld( m.spacing() );
+   const size_t lo( SO ? m.upperBandwidth() : m.lowerBandwidth() );
+
+   if( m.capacity() != n*ld || ( n > 0UL && ld > n+n-1UL ) )
+      return false;
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( size_t p=0UL; p<ld; ++p ) {
+         if( ( k+p < lo || k+p >= n+lo ) && !isDefault( m.data()[k*ld+p] ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two band matrices.
+// \ingroup band_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( BandMatrix<Type,SO>& a, BandMatrix<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BAND MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a band matrix with a dense vector.
+// \ingroup band_matrix
+//
+// \param A The band matrix.
+// \param x The right-hand side dense vector.
+// \param parallel \a true in case the multiplication may be executed in parallel.
+// \return The resulting vector.
+//
+// This function computes the product \f$ A*\vec{x} \f$ (for column vectors) or
+// \f$ \vec{x}^T*A \f$ (for row vectors). In case \a x does not provide contiguous storage,
+// \a x is copied into a temporary vector first.
+*/
+template< typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT    // Type of the right-hand side dense vector
+        , bool TF >      // Transpose flag of the vectors
+inline DynamicVector< MultTrait_< Type, ElementType_<VT> >, TF >
+   bandmv( const BandMatrix<Type,SO>& A, const DenseVector<VT,TF>& x, bool parallel )
+{
+   BLAZE_INTERNAL_ASSERT( (~x).size() == A.columns(), "Invalid vector size" );
+
+   using XET = ElementType_<VT>;
+   using ET  = MultTrait_< Type, XET >;
+
+   using XT = IfTrue_< HasConstDataAccess<VT>::value && !IsView<VT>::value
+                     , const VT&
+                     , const DynamicVector<XET,TF> >;
+
+   XT px( ~x );  // Contiguous storage of the right-hand side dense vector
+
+   DynamicVector<ET,TF> y( A.rows(), ET() );
+   A.template mult<TF>( y.data(), px.data(), parallel );
+
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial multiplication of a band matrix with a dense vector.
+// \ingroup band_matrix
+//
+// \param y The target dense vector.
+// \param A The band matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function computes the product \f$ A*\vec{x} \f$ (for column vectors) or
+// \f$ \vec{x}^T*A \f$ (for row vectors) and, depending on \a OP, assigns it to (0), adds it to
+// (1) or subtracts it from (2) the dense vector \a y.
+*/
+template< size_t OP      // Type of the operation
+        , typename VT1   // Type of the target dense vector
+        , typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT2   // Type of the right-hand side dense vector
+        , bool TF >      // Transpose flag of the vectors
+inline void bmv( DenseVector<VT1,TF>& y, const BandMatrix<Type,SO>& A,
+                 const DenseVector<VT2,TF>& x )
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows(), "Invalid vector size" );
+
+   const auto tmp( bandmv( A, ~x, false ) );
+
+   if( OP == 0UL )
+      assign( ~y, tmp );
+   else if( OP == 1UL )
+      addAssign( ~y, tmp );
+   else
+      subAssign( ~y, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP multiplication of a band matrix with a dense vector.
+// \ingroup band_matrix
+//
+// \param y The target dense vector.
+// \param A The band matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function computes the product \f$ A*\vec{x} \f$ (for column vectors) or
+// \f$ \vec{x}^T*A \f$ (for row vectors) and, depending on \a OP, assigns it to (0), adds it to
+// (1) or subtracts it from (2) the dense vector \a y. In case the number of stored elements
+// exceeds the \c SMP_BANDMULT_THRESHOLD, the elements of the product are distributed among
+// the available threads.
+*/
+template< size_t OP      // Type of the operation
+        , typename VT1   // Type of the target dense vector
+        , typename Type  // Data type of the band matrix
+        , bool SO        // Storage order of the band matrix
+        , typename VT2   // Type of the right-hand side dense vector
+        , bool TF >      // Transpose flag of the vectors
+inline void smpBmv( DenseVector<VT1,TF>& y, const BandMatrix<Type,SO>& A,
+                    const DenseVector<VT2,TF>& x )
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows(), "Invalid vector size" );
+
+   const auto tmp( bandmv( A, ~x, A.canSMPAssign() ) );
+
+   if( OP == 0UL )
+      smpAssign( ~y, tmp );
+   else if( OP == 1UL )
+      smpAddAssign( ~y, tmp );
+   else
+      smpSubAssign( ~y, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of two band matrices (\f$ A=B*C \f$).
+// \ingroup band_matrix
+//
+// \param lhs The left-hand side band matrix for the multiplication.
+// \param rhs The right-hand side band matrix for the multiplication.
+// \return The resulting band matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator computes the product of two band matrices. The result is a band matrix with
+// the storage order of the left-hand side operand, whose bandwidths are the sums of the
+// bandwidths of the two operands (limited by the size of the matrices). Each element of the
+// band of the result is computed from the overlap of a row of \a lhs and a column of \a rhs,
+// i.e. the product requires \f$ O(N(KL+KU+1)^2) \f$ operations. In case the number of stored
+// elements of the result exceeds the \c SMP_BANDMULT_THRESHOLD, the rows (or columns) of the
+// result are computed in parallel. In case the current sizes of the two given matrices don't
+// match, a \a std::invalid_argument is thrown.
+*/
+template< typename T1  // Data type of the left-hand side band matrix
+        , bool SO1     // Storage order of the left-hand side band matrix
+        , typename T2  // Data type of the right-hand side band matrix
+        , bool SO2 >   // Storage order of the right-hand side band matrix
+inline const BandMatrix< MultTrait_<T1,T2>, SO1 >
+   operator*( const BandMatrix<T1,SO1>& lhs, const BandMatrix<T2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_<T1,T2>;
+
+   if( lhs.columns() != rhs.rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   const size_t n ( lhs.rows() );
+   const size_t kl( n > 0UL ? min( n-1UL, lhs.lowerBandwidth() + rhs.lowerBandwidth() ) : 0UL );
+   const size_t ku( n > 0UL ? min( n-1UL, lhs.upperBandwidth() + rhs.upperBandwidth() ) : 0UL );
+
+   BandMatrix<ET,SO1> result( n, kl, ku );
+
+   auto kernel = [&]( size_t first, size_t last )
+   {
+      for( size_t k=first; k<last; ++k )
+      {
+         const size_t lbegin( ( k > ( SO1 ? ku : kl ) )?( k - ( SO1 ? ku : kl ) ):( 0UL ) );
+         const size_t lend  ( min( n, k + ( SO1 ? kl : ku ) + 1UL ) );
+
+         for( size_t l=lbegin; l<lend; ++l )
+         {
+            const size_t i( SO1 ? l : k );
+            const size_t j( SO1 ? k : l );
+
+            const size_t pbegin( max( ( i > lhs.lowerBandwidth() )?( i-lhs.lowerBandwidth() ):( 0UL ),
+                                      ( j > rhs.upperBandwidth() )?( j-rhs.upperBandwidth() ):( 0UL ) ) );
+            const size_t pend  ( min( n, i+lhs.upperBandwidth()+1UL, j+rhs.lowerBandwidth()+1UL ) );
+
+            ET sum = ET();
+            for( size_t p=pbegin; p<pend; ++p ) {
+               sum += lhs.data()[lhs.index(i,p)] * rhs.data()[rhs.index(p,j)];
+            }
+            result(i,j) = sum;
+         }
+      }
+   };
+
+   if( result.canSMPAssign() ) {
+      smpFor( 0UL, n, kernel );
+   }
+   else {
+      kernel( 0UL, n );
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISBANDMATRIX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsBandMatrix< BandMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSQUARE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsSquare< BandMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct SubmatrixTrait< BandMatrix<T,SO> >
+{
+   using Type = DynamicMatrix<T,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct RowTrait< BandMatrix<T,SO> >
+{
+   using Type = DynamicVector<T,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct ColumnTrait< BandMatrix<T,SO> >
+{
+   using Type = DynamicVector<T,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,917 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/BlockedDecomposition.h
+//  \brief Header file for the native blocked LU, Cholesky, and QR decomposition kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BLOCKEDDECOMPOSITION_H_
+#define _BLAZE_MATH_DENSE_BLOCKEDDECOMPOSITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given trailing matrix update kernel for the given range of rows/columns.
+// \ingroup dense_matrix
+//
+// \param m The size of the updated rows/columns.
+// \param n The number of rows/columns to be updated.
+// \param kernel The update kernel, called as \c kernel(first,last).
+// \return void
+//
+// In case the size of the trailing matrix exceeds the dense matrix/dense matrix multiplication
+// threshold, the \a n rows/columns are distributed among the available threads. Otherwise the
+// kernel is executed serially.
+*/
+template< typename Kernel >  // Type of the update kernel
+inline void decompositionFor( size_t m, size_t n, const Kernel& kernel )
+{
+   if( m*n < SMP_DMATDMATMULT_THRESHOLD ) {
+      kernel( 0UL, n );
+   }
+   else {
+      smpFor( 0UL, n, kernel );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the dense matrix multiplication kernels.
+// \ingroup dense_matrix
+//
+// In case the given element type provides a SIMD addition and multiplication, the trailing
+// matrix updates are performed by the mmm() and lmmm() kernels. Otherwise a scalar kernel is
+// used.
+*/
+template< typename ET >  // Element type of the matrices
+struct UseDecompositionKernel
+{
+   enum : bool { value = HasSIMDAdd<ET,ET>::value && HasSIMDMult<ET,ET>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dense matrix multiplication for the trailing matrix updates (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+*/
+template< typename MT1   // Type of the target matrix
+        , typename MT2   // Type of the left-hand side operand
+        , typename MT3   // Type of the right-hand side operand
+        , typename ET >  // Type of the scaling factors
+inline EnableIf_< UseDecompositionKernel<ET> >
+   decompositionMult( MT1& C, const MT2& A, const MT3& B, ET alpha, ET beta )
+{
+   mmm( C, A, B, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dense matrix multiplication for the trailing matrix updates (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+*/
+template< typename MT1   // Type of the target matrix
+        , typename MT2   // Type of the left-hand side operand
+        , typename MT3   // Type of the right-hand side operand
+        , typename ET >  // Type of the scaling factors
+inline DisableIf_< UseDecompositionKernel<ET> >
+   decompositionMult( MT1& C, const MT2& A, const MT3& B, ET alpha, ET beta )
+{
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      if( isDefault( beta ) ) {
+         for( size_t i=0UL; i<M; ++i ) {
+            reset( C(i,j) );
+         }
+      }
+      else if( !isOne( beta ) ) {
+         for( size_t i=0UL; i<M; ++i ) {
+            C(i,j) *= beta;
+         }
+      }
+
+      for( size_t k=0UL; k<K; ++k ) {
+         const ET tmp( alpha * B(k,j) );
+         for( size_t i=0UL; i<M; ++i ) {
+            C(i,j) += A(i,k) * tmp;
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lower dense matrix multiplication for the trailing matrix updates (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function only updates the lower part (including the diagonal) of the target matrix.
+// Since the lmmm() kernel may write to the upper part of its target matrix, the product is
+// computed into a temporary matrix.
+*/
+template< typename MT1   // Type of the target matrix
+        , typename MT2   // Type of the left-hand side operand
+        , typename MT3   // Type of the right-hand side operand
+        , typename ET >  // Type of the scaling factor
+inline EnableIf_< UseDecompositionKernel<ET> >
+   decompositionLowerMult( MT1& C, const MT2& A, const MT3& B, ET alpha )
+{
+   const size_t M( A.rows() );
+
+   DynamicMatrix<ET,columnMajor> D( M, M );
+   lmmm( D, A, B, alpha, ET(0) );
+
+   for( size_t j=0UL; j<M; ++j ) {
+      for( size_t i=j; i<M; ++i ) {
+         C(i,j) += D(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lower dense matrix multiplication for the trailing matrix updates (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function only updates the lower part (including the diagonal) of the target matrix.
+*/
+template< typename MT1   // Type of the target matrix
+        , typename MT2   // Type of the left-hand side operand
+        , typename MT3   // Type of the right-hand side operand
+        , typename ET >  // Type of the scaling factor
+inline DisableIf_< UseDecompositionKernel<ET> >
+   decompositionLowerMult( MT1& C, const MT2& A, const MT3& B, ET alpha )
+{
+   const size_t M( A.rows()    );
+   const size_t K( A.columns() );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         ET tmp{};
+         for( size_t k=0UL; k<K; ++k ) {
+            tmp += A(i,k) * B(k,j);
+         }
+         C(i,j) += alpha * tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forms the triangular factor of a block reflector (\f$ H = I - V*T*V^H \f$).
+// \ingroup dense_matrix
+//
+// \param A The column-major matrix containing the elementary reflectors below the diagonal.
+// \param col The index of the first reflector.
+// \param jb The number of reflectors.
+// \param tau The scalar factors of the elementary reflectors.
+// \param V The resulting unit lower trapezoidal matrix of Householder vectors.
+// \param T The resulting upper triangular factor of the block reflector.
+// \return void
+//
+// This function forms the explicit Householder vectors and the upper triangular factor \a T
+// of the block reflector \f$ H = H(col) H(col+1) ... H(col+jb-1) \f$ (see the LAPACK larft()
+// function, forward direction, columnwise storage).
+*/
+template< typename MT    // Type of the matrix
+        , typename ET >  // Element type of the block reflector
+void formBlockReflector( const MT& A, size_t col, size_t jb, const ET* tau,
+                         DynamicMatrix<ET,columnMajor>& V, DynamicMatrix<ET,columnMajor>& T )
+{
+   const size_t m( A.rows() - col );
+
+   V.resize( m, jb, false );
+   T.resize( jb, jb, false );
+   reset( V );
+   reset( T );
+
+   for( size_t j=0UL; j<jb; ++j ) {
+      V(j,j) = ET(1);
+      for( size_t i=j+1UL; i<m; ++i ) {
+         V(i,j) = A(col+i,col+j);
+      }
+   }
+
+   for( size_t i=0UL; i<jb; ++i )
+   {
+      T(i,i) = tau[i];
+
+      if( isDefault<strict>( tau[i] ) )
+         continue;
+
+      for( size_t j=0UL; j<i; ++j ) {
+         ET tmp{};
+         for( size_t k=i; k<m; ++k ) {
+            tmp += conj( V(k,j) ) * V(k,i);
+         }
+         T(j,i) = -tau[i] * tmp;
+      }
+
+      for( size_t j=0UL; j<i; ++j ) {
+         ET tmp{};
+         for( size_t k=j; k<i; ++k ) {
+            tmp += T(j,k) * T(k,i);
+         }
+         T(j,i) = tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies a block reflector from the left (\f$ C = C - V*X*V^H*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target column-major dense matrix.
+// \param V The unit lower trapezoidal matrix of Householder vectors.
+// \param X The triangular factor \a T (for \a H) or \f$ T^H \f$ (for \f$ H^H \f$).
+// \return void
+//
+// This function applies the given block reflector to the given matrix by means of three
+// dense matrix/dense matrix multiplications. The columns of \a C are updated in parallel.
+*/
+template< typename MT    // Type of the target matrix
+        , typename ET >  // Element type of the block reflector
+void applyBlockReflector( MT& C, const DynamicMatrix<ET,columnMajor>& V,
+                          const DynamicMatrix<ET,columnMajor>& X )
+{
+   const size_t m ( C.rows()    );
+   const size_t n ( C.columns() );
+   const size_t jb( V.columns() );
+
+   const DynamicMatrix<ET,columnMajor> VH( ctrans( V ) );
+
+   decompositionFor( m, n, [&C,&V,&X,&VH,m,jb]( size_t first, size_t last )
+   {
+      auto C1( submatrix<unaligned>( C, 0UL, first, m, last-first ) );
+
+      DynamicMatrix<ET,columnMajor> W1( jb, last-first );
+      DynamicMatrix<ET,columnMajor> W2( jb, last-first );
+
+      decompositionMult( W1, VH, C1, ET(1), ET(0) );
+      decompositionMult( W2, X, W1, ET(1), ET(0) );
+      decompositionMult( C1, V, W2, ET(-1), ET(1) );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LU DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked right-looking LU decomposition of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The column-major matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+void blockedGetrf_backend( MT& A, int* ipiv )
+{
+   using ET = ElementType_<MT>;
+
+   const size_t m( A.rows()    );
+   const size_t n( A.columns() );
+   const size_t k( min( m, n ) );
+
+   for( size_t jj=0UL; jj<k; jj+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t jend( min( jj+DECOMPOSITION_BLOCK_SIZE, k ) );
+
+      // Unblocked factorization of the current panel
+      for( size_t j=jj; j<jend; ++j )
+      {
+         size_t p( j );
+         auto pmax( abs( real( A(j,j) ) ) + abs( imag( A(j,j) ) ) );
+
+         for( size_t i=j+1UL; i<m; ++i ) {
+            const auto tmp( abs( real( A(i,j) ) ) + abs( imag( A(i,j) ) ) );
+            if( tmp > pmax ) {
+               p    = i;
+               pmax = tmp;
+            }
+         }
+
+         ipiv[j] = numeric_cast<int>( p+1UL );
+
+         if( !isDefault<strict>( A(p,j) ) )
+         {
+            if( p != j ) {
+               for( size_t l=jj; l<jend; ++l ) {
+                  std::swap( A(p,l), A(j,l) );
+               }
+            }
+
+            const ET inv( ET(1) / A(j,j) );
+            for( size_t i=j+1UL; i<m; ++i ) {
+               A(i,j) *= inv;
+            }
+         }
+
+         for( size_t l=j+1UL; l<jend; ++l ) {
+            const ET tmp( A(j,l) );
+            for( size_t i=j+1UL; i<m; ++i ) {
+               A(i,l) -= A(i,j) * tmp;
+            }
+         }
+      }
+
+      // Applying the row interchanges to the columns left and right of the panel
+      for( size_t j=jj; j<jend; ++j ) {
+         const size_t p( ipiv[j] - 1 );
+         if( p != j ) {
+            for( size_t l=0UL; l<jj; ++l ) {
+               std::swap( A(p,l), A(j,l) );
+            }
+            for( size_t l=jend; l<n; ++l ) {
+               std::swap( A(p,l), A(j,l) );
+            }
+         }
+      }
+
+      if( jend == n )
+         continue;
+
+      // Computing the block row of U and updating the trailing matrix
+      decompositionFor( m-jj, n-jend, [&A,m,jj,jend]( size_t first, size_t last )
+      {
+         for( size_t l=jend+first; l<jend+last; ++l ) {
+            for( size_t j=jj; j<jend; ++j ) {
+               const ET tmp( A(j,l) );
+               for( size_t i=j+1UL; i<jend; ++i ) {
+                  A(i,l) -= A(i,j) * tmp;
+               }
+            }
+         }
+
+         if( jend < m ) {
+            const auto A21( submatrix<unaligned>( A, jend, jj, m-jend, jend-jj ) );
+            const auto A12( submatrix<unaligned>( A, jj, jend+first, jend-jj, last-first ) );
+            auto A22( submatrix<unaligned>( A, jend, jend+first, m-jend, last-first ) );
+            decompositionMult( A22, A21, A12, ET(-1), ET(1) );
+         }
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked LU decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function is the native counterpart of the LAPACK getrf() wrapper function: It performs
+// a right-looking, blocked LU decomposition with partial pivoting of the given \a m-by-\a n
+// dense matrix and produces exactly the same decomposition and (1-based) pivot indices as the
+// getrf() function (i.e. \f$ A = P \cdot L \cdot U \f$ for column-major matrices and
+// \f$ A = L \cdot U \cdot P \f$ for row-major matrices). The update of the trailing matrix is
+// performed via the dense matrix/dense matrix multiplication kernels and is parallelized over
+// the columns of the trailing matrix. Row-major matrices are decomposed by means of a temporary
+// column-major matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedGetrf( DenseMatrix<MT,SO>& A, int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( SO == columnMajor ) {
+      blockedGetrf_backend( ~A, ipiv );
+   }
+   else {
+      DynamicMatrix<ElementType_<MT>,columnMajor> tmp( trans( ~A ) );
+      blockedGetrf_backend( tmp, ipiv );
+      ~A = trans( tmp );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CHOLESKY DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked Cholesky decomposition of the lower part of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \return void
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+*/
+template< typename MT >  // Type of the dense matrix
+void blockedPotrf_backend( MT& A )
+{
+   using ET = ElementType_<MT>;
+   using RT = UnderlyingBuiltin_<ET>;
+
+   const size_t n( A.rows() );
+
+   for( size_t jj=0UL; jj<n; jj+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t jend( min( jj+DECOMPOSITION_BLOCK_SIZE, n ) );
+
+      // Unblocked factorization of the diagonal block
+      for( size_t j=jj; j<jend; ++j )
+      {
+         RT d( real( A(j,j) ) );
+         for( size_t k=jj; k<j; ++k ) {
+            d -= real( A(j,k) * conj( A(j,k) ) );
+         }
+
+         if( !( d > RT(0) ) ) {
+            BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+         }
+
+         d = std::sqrt( d );
+         A(j,j) = d;
+
+         for( size_t i=j+1UL; i<jend; ++i ) {
+            ET tmp( A(i,j) );
+            for( size_t k=jj; k<j; ++k ) {
+               tmp -= A(i,k) * conj( A(j,k) );
+            }
+            A(i,j) = tmp / d;
+         }
+      }
+
+      if( jend == n )
+         continue;
+
+      // Computing the block column of L
+      decompositionFor( jend-jj, n-jend, [&A,jj,jend]( size_t first, size_t last )
+      {
+         for( size_t i=jend+first; i<jend+last; ++i ) {
+            for( size_t j=jj; j<jend; ++j ) {
+               ET tmp( A(i,j) );
+               for( size_t k=jj; k<j; ++k ) {
+                  tmp -= A(i,k) * conj( A(j,k) );
+               }
+               A(i,j) = tmp / real( A(j,j) );
+            }
+         }
+      } );
+
+      // Updating the lower part of the trailing matrix
+      const auto L21( submatrix<unaligned>( A, jend, jj, n-jend, jend-jj ) );
+      const DynamicMatrix<ET,columnMajor> W( ctrans( L21 ) );
+
+      decompositionFor( n-jend, n-jend, [&A,&L21,&W,jj,jend]( size_t first, size_t last )
+      {
+         const auto L1( submatrix<unaligned>( L21, first, 0UL, last-first, jend-jj ) );
+
+         if( first > 0UL ) {
+            auto A1( submatrix<unaligned>( A, jend+first, jend, last-first, first ) );
+            decompositionMult( A1, L1, submatrix<unaligned>( W, 0UL, 0UL, jend-jj, first ), ET(-1), ET(1) );
+         }
+
+         auto A2( submatrix<unaligned>( A, jend+first, jend+first, last-first, last-first ) );
+         decompositionLowerMult( A2, L1, submatrix<unaligned>( W, 0UL, first, jend-jj, last-first ), ET(-1) );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked Cholesky decomposition of the given dense positive definite matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param uplo \c 'L' to use the lower part of the matrix, \c 'U' to use the upper part.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid uplo argument provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function is the native counterpart of the LAPACK potrf() wrapper function: It performs
+// a blocked Cholesky decomposition of the given symmetric positive definite (or Hermitian
+// positive definite) matrix. In case \a uplo is set to \c 'L' the lower part of the matrix is
+// overwritten by the lower triangular factor \f$ L \f$ (\f$ A = L \cdot L^H \f$), in case it
+// is set to \c 'U' the upper part is overwritten by the upper triangular factor \f$ U \f$
+// (\f$ A = U^H \cdot U \f$). The other part of the matrix is not referenced. The update of
+// the trailing matrix is performed via the dense matrix/dense matrix multiplication kernels
+// and is parallelized over the rows of the trailing matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedPotrf( DenseMatrix<MT,SO>& A, char uplo )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( uplo != 'L' && uplo != 'U' ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid uplo argument provided" );
+   }
+
+   if( uplo == 'L' ) {
+      blockedPotrf_backend( ~A );
+   }
+   else {
+      DynamicMatrix<ElementType_<MT>,SO> tmp( ctrans( ~A ) );
+      blockedPotrf_backend( tmp );
+
+      const size_t n( tmp.rows() );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=i; j<n; ++j ) {
+            (~A)(i,j) = conj( tmp(j,i) );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  QR DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked Householder QR decomposition of a column-major dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The column-major matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+void blockedGeqrf_backend( MT& A, ElementType_<MT>* tau )
+{
+   using ET = ElementType_<MT>;
+   using RT = UnderlyingBuiltin_<ET>;
+
+   const size_t m( A.rows()    );
+   const size_t n( A.columns() );
+   const size_t k( min( m, n ) );
+
+   DynamicMatrix<ET,columnMajor> V, T;
+
+   for( size_t jj=0UL; jj<k; jj+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t jend( min( jj+DECOMPOSITION_BLOCK_SIZE, k ) );
+
+      // Unblocked factorization of the current panel
+      for( size_t j=jj; j<jend; ++j )
+      {
+         const ET alpha( A(j,j) );
+
+         RT xnorm( 0 );
+         for( size_t i=j+1UL; i<m; ++i ) {
+            xnorm += real( A(i,j) * conj( A(i,j) ) );
+         }
+
+         if( xnorm == RT(0) && imag( alpha ) == RT(0) ) {
+            tau[j] = ET(0);
+            continue;
+         }
+
+         const RT norm( std::sqrt( real( alpha * conj( alpha ) ) + xnorm ) );
+         const RT beta( real( alpha ) >= RT(0) ? -norm : norm );
+
+         tau[j] = ( ET(beta) - alpha ) / ET(beta);
+
+         const ET scale( ET(1) / ( alpha - ET(beta) ) );
+         for( size_t i=j+1UL; i<m; ++i ) {
+            A(i,j) *= scale;
+         }
+         A(j,j) = ET(1);
+
+         for( size_t l=j+1UL; l<jend; ++l ) {
+            ET tmp{};
+            for( size_t i=j; i<m; ++i ) {
+               tmp += conj( A(i,j) ) * A(i,l);
+            }
+            tmp *= conj( tau[j] );
+            for( size_t i=j; i<m; ++i ) {
+               A(i,l) -= A(i,j) * tmp;
+            }
+         }
+
+         A(j,j) = ET(beta);
+      }
+
+      if( jend == n )
+         continue;
+
+      // Applying the block reflector H^H to the trailing matrix
+      formBlockReflector( A, jj, jend-jj, tau+jj, V, T );
+      const DynamicMatrix<ET,columnMajor> TH( ctrans( T ) );
+
+      auto C( submatrix<unaligned>( A, jj, jend, m-jj, n-jend ) );
+      applyBlockReflector( C, V, TH );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked QR decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function is the native counterpart of the LAPACK geqrf() wrapper function: It performs
+// a blocked Householder QR decomposition of the given \a m-by-\a n dense matrix and uses the
+// same representation of \c Q and \c R as the geqrf() function. The block reflectors are
+// applied to the trailing matrix via the dense matrix/dense matrix multiplication kernels in
+// parallel. Row-major matrices are decomposed by means of a temporary column-major matrix.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedGeqrf( DenseMatrix<MT,SO>& A, ElementType_<MT>* tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   if( SO == columnMajor ) {
+      blockedGeqrf_backend( ~A, tau );
+   }
+   else {
+      DynamicMatrix<ElementType_<MT>,columnMajor> tmp( ~A );
+      blockedGeqrf_backend( tmp, tau );
+      ~A = tmp;
+
+      const size_t k( min( tmp.rows(), tmp.columns() ) );
+      for( size_t i=0UL; i<k; ++i ) {
+         tau[i] = conj( tau[i] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocked reconstruction of \c Q from a QR decomposition of a column-major matrix.
+// \ingroup dense_matrix
+//
+// \param A The column-major matrix containing the elementary reflectors.
+// \param tau The scalar factors of the elementary reflectors.
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+void blockedUngqr_backend( MT& A, const ElementType_<MT>* tau )
+{
+   using ET = ElementType_<MT>;
+
+   const size_t m( A.rows()    );
+   const size_t k( A.columns() );
+
+   if( k == 0UL )
+      return;
+
+   DynamicMatrix<ET,columnMajor> V, T;
+
+   for( size_t jj=( (k-1UL) / DECOMPOSITION_BLOCK_SIZE ) * DECOMPOSITION_BLOCK_SIZE; ;
+        jj-=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t jend( min( jj+DECOMPOSITION_BLOCK_SIZE, k ) );
+
+      // Applying the block reflector H to the already formed columns
+      if( jend < k ) {
+         formBlockReflector( A, jj, jend-jj, tau+jj, V, T );
+         auto C( submatrix<unaligned>( A, jj, jend, m-jj, k-jend ) );
+         applyBlockReflector( C, V, T );
+      }
+
+      // Unblocked reconstruction of the columns of the current block
+      for( size_t j=jend; j-- > jj; )
+      {
+         if( j+1UL < jend ) {
+            A(j,j) = ET(1);
+            for( size_t l=j+1UL; l<jend; ++l ) {
+               ET tmp{};
+               for( size_t i=j; i<m; ++i ) {
+                  tmp += conj( A(i,j) ) * A(i,l);
+               }
+               tmp *= tau[j];
+               for( size_t i=j; i<m; ++i ) {
+                  A(i,l) -= A(i,j) * tmp;
+               }
+            }
+         }
+
+         for( size_t i=j+1UL; i<m; ++i ) {
+            A(i,j) *= -tau[j];
+         }
+         A(j,j) = ET(1) - tau[j];
+
+         for( size_t i=0UL; i<j; ++i ) {
+            A(i,j) = ET(0);
+         }
+      }
+
+      if( jj == 0UL )
+         break;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked reconstruction of the matrix \c Q from a QR decomposition.
+// \ingroup dense_matrix
+//
+// \param A The decomposed matrix.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function is the native counterpart of the LAPACK orgqr() and ungqr() wrapper functions:
+// It reconstructs the matrix \c Q from a QR decomposition computed by the geqrf() or
+// blockedGeqrf() functions. On exit, the first min(\a m,\a n) columns of the matrix contain
+// the Q matrix with orthonormal columns. The block reflectors are applied via the dense
+// matrix/dense matrix multiplication kernels in parallel.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void blockedUngqr( DenseMatrix<MT,SO>& A, const ElementType_<MT>* tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_<MT> );
+
+   using ET = ElementType_<MT>;
+
+   const size_t m( (~A).rows() );
+   const size_t k( min( m, (~A).columns() ) );
+
+   auto Q( submatrix<unaligned>( ~A, 0UL, 0UL, m, k ) );
+
+   if( SO == columnMajor ) {
+      blockedUngqr_backend( Q, tau );
+   }
+   else {
+      DynamicMatrix<ET,columnMajor> tmp( Q );
+
+      const std::unique_ptr<ET[]> ctau( new ET[k] );
+      for( size_t i=0UL; i<k; ++i ) {
+         ctau[i] = conj( tau[i] );
+      }
+
+      blockedUngqr_backend( tmp, ctau.get() );
+      Q = tmp;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -103,10 +103,12 @@
 #include <blaze/util/constraints/Volatile.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
 #include <blaze/util/Misalignment.h>
 #include <blaze/util/Template.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
 #include <blaze/util/typetraits/IsIntegral.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
@@ -692,6 +694,14 @@ class CustomMatrix
    //**********************************************************************************************
 
  private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void initPadding( FalseType );
+   inline void initPadding( TrueType ) noexcept;
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -834,10 +844,7 @@ inline CustomMatrix<Type,AF,PF,SO>::CustomMatrix( Type* ptr, size_t m, size_t n,
    }
 
    if( PF && IsVectorizable<Type>::value ) {
-      for( size_t i=0UL; i<m_; ++i ) {
-         for( size_t j=n_; j<nn_; ++j )
-            v_[i*nn_+j] = Type();
-      }
+      initPadding( IsConst<Type>() );
    }
 }
 //*************************************************************************************************
@@ -1895,6 +1902,44 @@ inline void CustomMatrix<Type,AF,PF,SO>::swap( CustomMatrix& m ) noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Initialization of the padding elements of the matrix.
+//
+// \return void
+//
+// This function resets all padding elements of the matrix to their default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline void CustomMatrix<Type,AF,PF,SO>::initPadding( FalseType )
+{
+   for( size_t i=0UL; i<m_; ++i ) {
+      for( size_t j=n_; j<nn_; ++j )
+         v_[i*nn_+j] = Type();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the padding elements of the matrix.
+//
+// \return void
+//
+// In case of a constant element type the padding elements cannot be modified and are expected
+// to be properly initialized by the owner of the given array.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF        // Padding flag
+        , bool SO >      // Storage order
+inline void CustomMatrix<Type,AF,PF,SO>::initPadding( TrueType ) noexcept
+{}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -3568,6 +3613,14 @@ class CustomMatrix<Type,AF,PF,true>
    //**********************************************************************************************
 
  private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void initPadding( FalseType );
+   inline void initPadding( TrueType ) noexcept;
+   //@}
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
@@ -3704,10 +3757,7 @@ inline CustomMatrix<Type,AF,PF,true>::CustomMatrix( Type* ptr, size_t m, size_t
    }
 
    if( PF && IsVectorizable<Type>::value ) {
-      for( size_t j=0UL; j<n_; ++j )
-         for( size_t i=m_; i<mm_; ++i ) {
-            v_[i+j*mm_] = Type();
-      }
+      initPadding( IsConst<Type>() );
    }
 }
 /*! \endcond */
@@ -4773,6 +4823,46 @@ inline void CustomMatrix<Type,AF,PF,true>::swap( CustomMatrix& m ) noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the padding elements of the matrix.
+//
+// \return void
+//
+// This function resets all padding elements of the matrix to their default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void CustomMatrix<Type,AF,PF,true>::initPadding( FalseType )
+{
+   for( size_t j=0UL; j<n_; ++j ) {
+      for( size_t i=m_; i<mm_; ++i )
+         v_[i+j*mm_] = Type();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the padding elements of the matrix.
+//
+// \return void
+//
+// In case of a constant element type the padding elements cannot be modified and are expected
+// to be properly initialized by the owner of the given array.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void CustomMatrix<Type,AF,PF,true>::initPadding( TrueType ) noexcept
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
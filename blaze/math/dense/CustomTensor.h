@@ -0,0 +1,1370 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/CustomTensor.h
+//  \brief Header file for the implementation of a customizable tensor
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_CUSTOMTENSOR_H_
+#define _BLAZE_MATH_DENSE_CUSTOMTENSOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/DenseTensor.h>
+#include <blaze/math/dense/DynamicTensor.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseTensor.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Functors.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup custom_tensor CustomTensor
+// \ingroup dense_tensor
+*/
+/*!\brief Efficient implementation of a customizable tensor.
+// \ingroup custom_tensor
+//
+// The CustomTensor class template provides the functionality to represent an external array of
+// elements of arbitrary type and a fixed size as a native \b Blaze dense tensor data structure.
+// Thus in contrast to all other dense tensor types a custom tensor does not perform any kind
+// of memory allocation by itself, but it is provided with an existing array of element during
+// construction. A custom tensor can therefore be considered an alias to the existing array. The
+// type of the elements, the properties of the given array of elements can be specified via the
+// following three template parameters:
+
+   \code
+   template< typename Type, bool AF, bool PF >
+   class CustomTensor;
+   \endcode
+
+//  - Type: specifies the type of the tensor elements. CustomTensor can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - AF  : specifies whether the represented, external arrays are properly aligned with
+//          respect to the available instruction set (SSE, AVX, ...) or not.
+//  - PF  : specified whether the represented, external arrays are properly padded with
+//          respect to the available instruction set (SSE, AVX, ...) or not.
+//
+// The memory layout of the given array is expected to be identical to the layout of a
+// DynamicTensor: Within a page two consecutive rows are separated by \a nn elements and the
+// \f$ O \f$ pages of \f$ M \f$ rows each are stored directly one after another:
+
+   \code
+   using blaze::CustomTensor;
+   using blaze::aligned;
+   using blaze::unaligned;
+   using blaze::padded;
+   using blaze::unpadded;
+
+   // Creating an unaligned, unpadded 2x2x3 tensor
+   std::vector<double> vec( 12UL );
+   CustomTensor<double,unaligned,unpadded> A( &vec[0], 2UL, 2UL, 3UL );
+
+   // Creating an aligned, padded 2x2x3 tensor with a spacing of 4 elements between two rows
+   std::unique_ptr<double[],Deallocate> memory( allocate<double>( 16UL ) );
+   CustomTensor<double,aligned,padded> B( memory.get(), 2UL, 2UL, 3UL, 4UL );
+   \endcode
+
+// In case of a padded tensor the padding elements of all rows are initialized as default on
+// construction. As in case of CustomMatrix the custom tensor does \b NOT take responsibility
+// for the given array of elements!
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+class CustomTensor
+   : public DenseTensor< CustomTensor<Type,AF,PF> >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = CustomTensor<Type,AF,PF>;          //!< Type of this CustomTensor instance.
+   using BaseType       = DenseTensor<This>;                 //!< Base type of this CustomTensor instance.
+   using ResultType     = DynamicTensor< RemoveConst_<Type> >;  //!< Result type for expression template evaluations.
+   using ElementType    = Type;                              //!< Type of the tensor elements.
+   using SIMDType       = SIMDTrait_<ElementType>;           //!< SIMD type of the tensor elements.
+   using ReturnType     = const Type&;                       //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                       //!< Data type for composite expression templates.
+   using Reference      = Type&;                             //!< Reference to a non-constant tensor value.
+   using ConstReference = const Type&;                       //!< Reference to a constant tensor value.
+   using Pointer        = Type*;                             //!< Pointer to a non-constant tensor value.
+   using ConstPointer   = const Type*;                       //!< Pointer to a constant tensor value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the tensor is involved
+       in can be optimized via SIMD operations. In case the element type of the tensor is a
+       vectorizable data type, the \a simdEnabled compilation flag is set to \a true, otherwise
+       it is set to \a false. */
+   enum : bool { simdEnabled = IsVectorizable<Type>::value };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the tensor can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CustomTensor();
+   explicit inline CustomTensor( Type* ptr, size_t o, size_t m, size_t n );
+   explicit inline CustomTensor( Type* ptr, size_t o, size_t m, size_t n, size_t nn );
+
+   inline CustomTensor( const CustomTensor& t );
+   inline CustomTensor( CustomTensor&& t ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t k, size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t k, size_t i, size_t j );
+   inline ConstReference at( size_t k, size_t i, size_t j ) const;
+   inline Pointer        data() noexcept;
+   inline ConstPointer   data() const noexcept;
+   inline Pointer        data( size_t k, size_t i ) noexcept;
+   inline ConstPointer   data( size_t k, size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline CustomTensor& operator=( const Type& rhs );
+
+                           inline CustomTensor& operator=( const CustomTensor& rhs );
+                           inline CustomTensor& operator=( CustomTensor&& rhs ) noexcept;
+   template< typename TT > inline CustomTensor& operator=( const DenseTensor<TT>& rhs );
+
+   template< typename TT > inline CustomTensor& operator+=( const DenseTensor<TT>& rhs );
+   template< typename TT > inline CustomTensor& operator-=( const DenseTensor<TT>& rhs );
+   template< typename TT > inline CustomTensor& operator%=( const DenseTensor<TT>& rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, CustomTensor >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, CustomTensor >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t pages      () const noexcept;
+   inline size_t rows       () const noexcept;
+   inline size_t columns    () const noexcept;
+   inline size_t spacing    () const noexcept;
+   inline size_t pageSpacing() const noexcept;
+   inline size_t capacity   () const noexcept;
+   inline size_t nonZeros   () const;
+   inline void   reset      ();
+   inline void   clear      ();
+   inline void   swap       ( CustomTensor& t ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t k, size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t k, size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t k, size_t i, size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t o_;   //!< The current number of pages of the tensor.
+   size_t m_;   //!< The current number of rows of the tensor.
+   size_t n_;   //!< The current number of columns of the tensor.
+   size_t nn_;  //!< The number of elements between two rows.
+   Type* BLAZE_RESTRICT v_;  //!< The custom array of elements.
+                             /*!< Access to the tensor elements is gained via the function call
+                                  operator. The element \f$ (k,i,j) \f$ is stored at the position
+                                  \f$ (k \cdot M + i) \cdot nn + j \f$ of the array. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CustomTensor.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomTensor<Type,AF,PF>::CustomTensor()
+   : o_ ( 0UL )      // The current number of pages of the tensor
+   , m_ ( 0UL )      // The current number of rows of the tensor
+   , n_ ( 0UL )      // The current number of columns of the tensor
+   , nn_( 0UL )      // The number of elements between two rows
+   , v_ ( nullptr )  // The custom array of elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a tensor of size \f$ o \times m \times n \f$.
+//
+// \param ptr The array of elements to be used by the tensor.
+// \param o The number of pages of the array of elements.
+// \param m The number of rows of the array of elements.
+// \param n The number of columns of the array of elements.
+// \exception std::invalid_argument Invalid setup of custom tensor.
+//
+// This constructor creates an unpadded custom tensor of size \f$ o \times m \times n \f$. The
+// construction fails if ...
+//
+//  - ... the passed pointer is \c nullptr;
+//  - ... the alignment flag \a AF is set to \a aligned, but the passed pointer or the rows of
+//    the tensor are not properly aligned according to the available instruction set (SSE,
+//    AVX, ...).
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+//
+// \note This constructor is \b NOT available for padded custom tensors!
+// \note The custom tensor does \b NOT take responsibility for the given array of elements!
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomTensor<Type,AF,PF>::CustomTensor( Type* ptr, size_t o, size_t m, size_t n )
+   : o_ ( o )    // The current number of pages of the tensor
+   , m_ ( m )    // The current number of rows of the tensor
+   , n_ ( n )    // The current number of columns of the tensor
+   , nn_( n )    // The number of elements between two rows
+   , v_ ( ptr )  // The custom array of elements
+{
+   BLAZE_STATIC_ASSERT( PF == unpadded );
+
+   if( ptr == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of elements" );
+   }
+
+   if( AF && ( !checkAlignment( ptr ) || nn_ % SIMDSIZE != 0UL ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid alignment detected" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a tensor of size \f$ o \times m \times n \f$.
+//
+// \param ptr The array of elements to be used by the tensor.
+// \param o The number of pages of the array of elements.
+// \param m The number of rows of the array of elements.
+// \param n The number of columns of the array of elements.
+// \param nn The total number of elements between two rows.
+// \exception std::invalid_argument Invalid setup of custom tensor.
+//
+// This constructor creates a custom tensor of size \f$ o \times m \times n \f$. The construction
+// fails if ...
+//
+//  - ... the passed pointer is \c nullptr;
+//  - ... the alignment flag \a AF is set to \a aligned, but the passed pointer or the rows of
+//    the tensor are not properly aligned according to the available instruction set (SSE,
+//    AVX, ...);
+//  - ... the specified spacing \a nn is insufficient for the given data type \a Type and the
+//    available instruction set.
+//
+// In all failure cases a \a std::invalid_argument exception is thrown.
+//
+// \note The custom tensor does \b NOT take responsibility for the given array of elements!
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomTensor<Type,AF,PF>::CustomTensor( Type* ptr, size_t o, size_t m, size_t n, size_t nn )
+   : o_ ( o )    // The current number of pages of the tensor
+   , m_ ( m )    // The current number of rows of the tensor
+   , n_ ( n )    // The current number of columns of the tensor
+   , nn_( nn )   // The number of elements between two rows
+   , v_ ( ptr )  // The custom array of elements
+{
+   if( ptr == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid array of elements" );
+   }
+
+   if( nn_ < n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid spacing between rows" );
+   }
+
+   if( AF && ( !checkAlignment( ptr ) || nn_ % SIMDSIZE != 0UL ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid alignment detected" );
+   }
+
+   if( PF && IsVectorizable<Type>::value && ( nn_ < nextMultiple<size_t>( n_, SIMDSIZE ) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Insufficient capacity for padded tensor" );
+   }
+
+   if( PF && IsVectorizable<Type>::value ) {
+      for( size_t l=0UL; l<o_*m_; ++l ) {
+         for( size_t j=n_; j<nn_; ++j )
+            v_[l*nn_+j] = Type();
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CustomTensor.
+//
+// \param t Tensor to be copied.
+//
+// The copy constructor initializes the custom tensor as an exact copy of the given custom tensor.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomTensor<Type,AF,PF>::CustomTensor( const CustomTensor& t )
+   : o_ ( t.o_  )  // The current number of pages of the tensor
+   , m_ ( t.m_  )  // The current number of rows of the tensor
+   , n_ ( t.n_  )  // The current number of columns of the tensor
+   , nn_( t.nn_ )  // The number of elements between two rows
+   , v_ ( t.v_  )  // The custom array of elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for CustomTensor.
+//
+// \param t The tensor to be moved into this instance.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomTensor<Type,AF,PF>::CustomTensor( CustomTensor&& t ) noexcept
+   : o_ ( t.o_  )  // The current number of pages of the tensor
+   , m_ ( t.m_  )  // The current number of rows of the tensor
+   , n_ ( t.n_  )  // The current number of columns of the tensor
+   , nn_( t.nn_ )  // The number of elements between two rows
+   , v_ ( t.v_  )  // The custom array of elements
+{
+   t.o_  = 0UL;
+   t.m_  = 0UL;
+   t.n_  = 0UL;
+   t.nn_ = 0UL;
+   t.v_  = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 3D-access to the tensor elements.
+//
+// \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomTensor<Type,AF,PF>::Reference
+   CustomTensor<Type,AF,PF>::operator()( size_t k, size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( k<o_, "Invalid page access index"   );
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[(k*m_+i)*nn_+j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 3D-access to the tensor elements.
+//
+// \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomTensor<Type,AF,PF>::ConstReference
+   CustomTensor<Type,AF,PF>::operator()( size_t k, size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( k<o_, "Invalid page access index"   );
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[(k*m_+i)*nn_+j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the tensor elements.
+//
+// \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid tensor access index.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomTensor<Type,AF,PF>::Reference
+   CustomTensor<Type,AF,PF>::at( size_t k, size_t i, size_t j )
+{
+   if( k >= o_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid page access index" );
+   }
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(k,i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the tensor elements.
+//
+// \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid tensor access index.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomTensor<Type,AF,PF>::ConstReference
+   CustomTensor<Type,AF,PF>::at( size_t k, size_t i, size_t j ) const
+{
+   if( k >= o_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid page access index" );
+   }
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(k,i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the tensor elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the custom tensor. Note that you
+// can NOT assume that all tensor elements lie adjacent to each other! The custom tensor may
+// use techniques such as padding to improve the alignment of the data. Whereas the number of
+// elements within a row are given by the \c columns() member function, the total number of
+// elements including padding is given by the \c spacing() member function.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomTensor<Type,AF,PF>::Pointer
+   CustomTensor<Type,AF,PF>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the tensor elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the custom tensor. Note that you
+// can NOT assume that all tensor elements lie adjacent to each other! The custom tensor may
+// use techniques such as padding to improve the alignment of the data. Whereas the number of
+// elements within a row are given by the \c columns() member function, the total number of
+// elements including padding is given by the \c spacing() member function.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomTensor<Type,AF,PF>::ConstPointer
+   CustomTensor<Type,AF,PF>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the tensor elements of row \a i of page \a k.
+//
+// \param k The page index.
+// \param i The row index.
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomTensor<Type,AF,PF>::Pointer
+   CustomTensor<Type,AF,PF>::data( size_t k, size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( k<o_, "Invalid page access index" );
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"  );
+   return v_ + (k*m_+i)*nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the tensor elements of row \a i of page \a k.
+//
+// \param k The page index.
+// \param i The row index.
+// \return Pointer to the internal element storage.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline typename CustomTensor<Type,AF,PF>::ConstPointer
+   CustomTensor<Type,AF,PF>::data( size_t k, size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( k<o_, "Invalid page access index" );
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"  );
+   return v_ + (k*m_+i)*nn_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all tensor elements.
+//
+// \param rhs Scalar value to be assigned to all tensor elements.
+// \return Reference to the assigned tensor.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomTensor<Type,AF,PF>& CustomTensor<Type,AF,PF>::operator=( const Type& rhs )
+{
+   smpFill( *this, rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CustomTensor.
+//
+// \param rhs Tensor to be copied.
+// \return Reference to the assigned tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// The tensor is initialized as a copy of the given tensor. In case the current sizes of the two
+// tensors don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomTensor<Type,AF,PF>& CustomTensor<Type,AF,PF>::operator=( const CustomTensor& rhs )
+{
+   if( rhs.pages() != o_ || rhs.rows() != m_ || rhs.columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   smpAssign( *this, rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for CustomTensor.
+//
+// \param rhs The tensor to be moved into this instance.
+// \return Reference to the assigned tensor.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline CustomTensor<Type,AF,PF>& CustomTensor<Type,AF,PF>::operator=( CustomTensor&& rhs ) noexcept
+{
+   o_  = rhs.o_;
+   m_  = rhs.m_;
+   n_  = rhs.n_;
+   nn_ = rhs.nn_;
+   v_  = rhs.v_;
+
+   rhs.o_  = 0UL;
+   rhs.m_  = 0UL;
+   rhs.n_  = 0UL;
+   rhs.nn_ = 0UL;
+   rhs.v_  = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different dense tensors.
+//
+// \param rhs Dense tensor to be copied.
+// \return Reference to the assigned tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// The tensor is initialized as a copy of the given tensor. In case the current sizes of the two
+// tensors don't match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename TT >  // Type of the right-hand side dense tensor
+inline CustomTensor<Type,AF,PF>& CustomTensor<Type,AF,PF>::operator=( const DenseTensor<TT>& rhs )
+{
+   if( (~rhs).pages() != o_ || (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   smpAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a dense tensor (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side tensor to be added to the tensor.
+// \return Reference to the tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// In case the current sizes of the two tensors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename TT >  // Type of the right-hand side dense tensor
+inline CustomTensor<Type,AF,PF>& CustomTensor<Type,AF,PF>::operator+=( const DenseTensor<TT>& rhs )
+{
+   if( (~rhs).pages() != o_ || (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   smpUpdate( *this, ~rhs, Add() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a dense tensor (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side tensor to be subtracted from the tensor.
+// \return Reference to the tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// In case the current sizes of the two tensors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename TT >  // Type of the right-hand side dense tensor
+inline CustomTensor<Type,AF,PF>& CustomTensor<Type,AF,PF>::operator-=( const DenseTensor<TT>& rhs )
+{
+   if( (~rhs).pages() != o_ || (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   smpUpdate( *this, ~rhs, Sub() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a dense tensor
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side tensor for the Schur product.
+// \return Reference to the tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// In case the current sizes of the two tensors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+template< typename TT >  // Type of the right-hand side dense tensor
+inline CustomTensor<Type,AF,PF>& CustomTensor<Type,AF,PF>::operator%=( const DenseTensor<TT>& rhs )
+{
+   if( (~rhs).pages() != o_ || (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   smpUpdate( *this, ~rhs, Mult() );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a tensor and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the tensor.
+*/
+template< typename Type     // Data type of the tensor
+        , bool AF           // Alignment flag
+        , bool PF >         // Padding flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, CustomTensor<Type,AF,PF> >&
+   CustomTensor<Type,AF,PF>::operator*=( Other rhs )
+{
+   smpAssign( *this, (*this) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a tensor by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the tensor.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the tensor
+        , bool AF           // Alignment flag
+        , bool PF >         // Padding flag
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, CustomTensor<Type,AF,PF> >&
+   CustomTensor<Type,AF,PF>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   smpAssign( *this, (*this) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of pages of the tensor.
+//
+// \return The number of pages of the tensor.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomTensor<Type,AF,PF>::pages() const noexcept
+{
+   return o_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the tensor.
+//
+// \return The number of rows of the tensor.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomTensor<Type,AF,PF>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the tensor.
+//
+// \return The number of columns of the tensor.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomTensor<Type,AF,PF>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows.
+//
+// \return The spacing between the beginning of two rows.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomTensor<Type,AF,PF>::spacing() const noexcept
+{
+   return nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two pages.
+//
+// \return The spacing between the beginning of two pages.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomTensor<Type,AF,PF>::pageSpacing() const noexcept
+{
+   return m_*nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the tensor.
+//
+// \return The capacity of the tensor.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomTensor<Type,AF,PF>::capacity() const noexcept
+{
+   return o_*m_*nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the tensor
+//
+// \return The number of non-zero elements in the tensor.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline size_t CustomTensor<Type,AF,PF>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<o_; ++k )
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            if( !isDefault( (*this)(k,i,j) ) )
+               ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void CustomTensor<Type,AF,PF>::reset()
+{
+   using blaze::clear;
+
+   for( size_t k=0UL; k<o_; ++k )
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            clear( (*this)(k,i,j) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ O \times M \times N \f$ tensor.
+//
+// \return void
+//
+// After the clear() function, the size of the tensor is 0.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void CustomTensor<Type,AF,PF>::clear()
+{
+   o_  = 0UL;
+   m_  = 0UL;
+   n_  = 0UL;
+   nn_ = 0UL;
+   v_  = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two tensors.
+//
+// \param t The tensor to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void CustomTensor<Type,AF,PF>::swap( CustomTensor& t ) noexcept
+{
+   using std::swap;
+
+   swap( o_ , t.o_  );
+   swap( m_ , t.m_  );
+   swap( n_ , t.n_  );
+   swap( nn_, t.nn_ );
+   swap( v_ , t.v_  );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the tensor can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this tensor, \a false if not.
+*/
+template< typename Type     // Data type of the tensor
+        , bool AF           // Alignment flag
+        , bool PF >         // Padding flag
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomTensor<Type,AF,PF>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the tensor is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this tensor, \a false if not.
+*/
+template< typename Type     // Data type of the tensor
+        , bool AF           // Alignment flag
+        , bool PF >         // Padding flag
+template< typename Other >  // Data type of the foreign expression
+inline bool CustomTensor<Type,AF,PF>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the tensor is properly aligned in memory.
+//
+// \return \a true in case the tensor is aligned, \a false if not.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline bool CustomTensor<Type,AF,PF>::isAligned() const noexcept
+{
+   return ( AF || ( checkAlignment( v_ ) && spacing() % SIMDSIZE == 0UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the tensor can be used in SMP assignments.
+//
+// \return \a true in case the tensor can be used in SMP assignments, \a false if not.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline bool CustomTensor<Type,AF,PF>::canSMPAssign() const noexcept
+{
+   return ( pages() * rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Load of a SIMD element of the tensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+BLAZE_ALWAYS_INLINE typename CustomTensor<Type,AF,PF>::SIMDType
+   CustomTensor<Type,AF,PF>::load( size_t k, size_t i, size_t j ) const noexcept
+{
+   if( AF )
+      return loada( k, i, j );
+   else
+      return loadu( k, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned load of a SIMD element of the tensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+BLAZE_ALWAYS_INLINE typename CustomTensor<Type,AF,PF>::SIMDType
+   CustomTensor<Type,AF,PF>::loada( size_t k, size_t i, size_t j ) const noexcept
+{
+   using blaze::loada;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( k < o_, "Invalid page access index" );
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= ( PF ? nn_ : n_ ), "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( v_+(k*m_+i)*nn_+j ), "Invalid alignment detected" );
+
+   return loada( v_+(k*m_+i)*nn_+j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned load of a SIMD element of the tensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+BLAZE_ALWAYS_INLINE typename CustomTensor<Type,AF,PF>::SIMDType
+   CustomTensor<Type,AF,PF>::loadu( size_t k, size_t i, size_t j ) const noexcept
+{
+   using blaze::loadu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( k < o_, "Invalid page access index" );
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= ( PF ? nn_ : n_ ), "Invalid column access index" );
+
+   return loadu( v_+(k*m_+i)*nn_+j );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CUSTOMTENSOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CustomTensor operators */
+//@{
+template< typename Type, bool AF, bool PF >
+inline void reset( CustomTensor<Type,AF,PF>& t );
+
+template< typename Type, bool AF, bool PF >
+inline void clear( CustomTensor<Type,AF,PF>& t );
+
+template< typename Type, bool AF, bool PF >
+inline bool isIntact( const CustomTensor<Type,AF,PF>& t ) noexcept;
+
+template< typename Type, bool AF, bool PF >
+inline void swap( CustomTensor<Type,AF,PF>& a, CustomTensor<Type,AF,PF>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given custom tensor.
+// \ingroup custom_tensor
+//
+// \param t The tensor to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void reset( CustomTensor<Type,AF,PF>& t )
+{
+   t.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given custom tensor.
+// \ingroup custom_tensor
+//
+// \param t The tensor to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void clear( CustomTensor<Type,AF,PF>& t )
+{
+   t.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given custom tensor are intact.
+// \ingroup custom_tensor
+//
+// \param t The custom tensor to be tested.
+// \return \a true in case the given tensor's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline bool isIntact( const CustomTensor<Type,AF,PF>& t ) noexcept
+{
+   return ( t.columns() <= t.spacing() && t.pages() * t.rows() * t.spacing() <= t.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two custom tensors.
+// \ingroup custom_tensor
+//
+// \param a The first tensor to be swapped.
+// \param b The second tensor to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the tensor
+        , bool AF        // Alignment flag
+        , bool PF >      // Padding flag
+inline void swap( CustomTensor<Type,AF,PF>& a, CustomTensor<Type,AF,PF>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool AF, bool PF >
+struct IsAligned< CustomTensor<T,AF,PF> >
+   : public BoolConstant<AF>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPADDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool AF, bool PF >
+struct IsPadded< CustomTensor<T,AF,PF> >
+   : public BoolConstant<PF>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,583 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/DenseTensor.h
+//  \brief Header file for utility functions for dense tensors
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_DENSETENSOR_H_
+#define _BLAZE_MATH_DENSE_DENSETENSOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iomanip>
+#include <ostream>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseTensor.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DenseTensor operators */
+//@{
+template< typename TT1, typename TT2 >
+inline bool operator==( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs );
+
+template< typename TT1, typename TT2 >
+inline bool operator!=( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs );
+
+template< typename TT >
+inline std::ostream& operator<<( std::ostream& os, const DenseTensor<TT>& t );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality operator for the comparison of two dense tensors.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side tensor for the comparison.
+// \param rhs The right-hand side tensor for the comparison.
+// \return \a true if the two tensors are equal, \a false if not.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+inline bool operator==( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs )
+{
+   using CT1 = CompositeType_<TT1>;
+   using CT2 = CompositeType_<TT2>;
+
+   // Early exit in case the tensor sizes don't match
+   if( (~lhs).pages() != (~rhs).pages() || (~lhs).rows() != (~rhs).rows() ||
+       (~lhs).columns() != (~rhs).columns() )
+      return false;
+
+   // Evaluation of the two dense tensor operands
+   CT1 A( ~lhs );
+   CT2 B( ~rhs );
+
+   // In order to compare the two tensors, the data values of the lower-order data
+   // type are converted to the higher-order data type within the equal function.
+   for( size_t k=0UL; k<A.pages(); ++k ) {
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=0UL; j<A.columns(); ++j ) {
+            if( !equal( A(k,i,j), B(k,i,j) ) ) return false;
+         }
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality operator for the comparison of two dense tensors.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side tensor for the comparison.
+// \param rhs The right-hand side tensor for the comparison.
+// \return \a true if the two tensors are not equal, \a false if they are equal.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+inline bool operator!=( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs )
+{
+   return !( lhs == rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Global output operator for dense tensors.
+// \ingroup dense_tensor
+//
+// \param os Reference to the output stream.
+// \param t Reference to a constant tensor object.
+// \return Reference to the output stream.
+//
+// The pages of the tensor are printed one after another in the same format as dense matrices,
+// separated by an empty line.
+*/
+template< typename TT >  // Type of the dense tensor
+inline std::ostream& operator<<( std::ostream& os, const DenseTensor<TT>& t )
+{
+   CompositeType_<TT> tmp( ~t );
+
+   for( size_t k=0UL; k<tmp.pages(); ++k ) {
+      if( k != 0UL ) os << "\n";
+      for( size_t i=0UL; i<tmp.rows(); ++i ) {
+         os << "( ";
+         for( size_t j=0UL; j<tmp.columns(); ++j ) {
+            os << std::setw(12) << tmp(k,i,j) << " ";
+         }
+         os << ")\n";
+      }
+   }
+
+   return os;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized tensor assignment kernel.
+// \ingroup dense_tensor
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+struct DTensVectorizedAssign
+{
+   enum : bool { value = useOptimizedKernels &&
+                         TT1::simdEnabled && TT2::simdEnabled &&
+                         IsSIMDCombinable< ElementType_<TT1>, ElementType_<TT2> >::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized tensor update kernel.
+// \ingroup dense_tensor
+*/
+template< typename TT1   // Type of the left-hand side dense tensor
+        , typename TT2   // Type of the right-hand side dense tensor
+        , typename OP >  // Type of the update operation
+struct DTensVectorizedUpdate
+{
+   enum : bool { value = DTensVectorizedAssign<TT1,TT2>::value &&
+                         OP::BLAZE_TEMPLATE simdEnabled< ElementType_<TT1>, ElementType_<TT2> >() };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default assignment of a range of rows of a dense tensor to a dense tensor.
+// \ingroup dense_tensor
+//
+// \param lhs The target dense tensor.
+// \param rhs The right-hand side dense tensor to be assigned.
+// \param begin The index of the first row of the range.
+// \param end The index one past the last row of the range.
+// \return void
+//
+// The rows of all pages of the tensors are enumerated consecutively, i.e. row \a i of page \a k
+// has the index \f$ k*M+i \f$, where \f$ M \f$ is the number of rows per page.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+inline DisableIf_< DTensVectorizedAssign<TT1,TT2> >
+   dtensAssignRows( TT1& lhs, const TT2& rhs, size_t begin, size_t end )
+{
+   const size_t m( lhs.rows() );
+   const size_t n( lhs.columns() );
+
+   for( size_t l=begin; l<end; ++l )
+   {
+      const size_t k( l / m );
+      const size_t i( l % m );
+
+      ElementType_<TT1>* BLAZE_RESTRICT ptr( lhs.data( k, i ) );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         ptr[j] = rhs(k,i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized assignment of a range of rows of a dense tensor to a dense tensor.
+// \ingroup dense_tensor
+//
+// \param lhs The target dense tensor.
+// \param rhs The right-hand side dense tensor to be assigned.
+// \param begin The index of the first row of the range.
+// \param end The index one past the last row of the range.
+// \return void
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+inline EnableIf_< DTensVectorizedAssign<TT1,TT2> >
+   dtensAssignRows( TT1& lhs, const TT2& rhs, size_t begin, size_t end )
+{
+   using ET = ElementType_<TT1>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+   constexpr bool   isAligned( IsAligned<TT1>::value );
+
+   const size_t m( lhs.rows() );
+   const size_t n( lhs.columns() );
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+
+   for( size_t l=begin; l<end; ++l )
+   {
+      const size_t k( l / m );
+      const size_t i( l % m );
+
+      ET* BLAZE_RESTRICT ptr( lhs.data( k, i ) );
+      size_t j( 0UL );
+
+      for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
+         if( isAligned ) {
+            storea( ptr+j         , rhs.load(k,i,j         ) );
+            storea( ptr+j+SIMDSIZE, rhs.load(k,i,j+SIMDSIZE) );
+         }
+         else {
+            storeu( ptr+j         , rhs.load(k,i,j         ) );
+            storeu( ptr+j+SIMDSIZE, rhs.load(k,i,j+SIMDSIZE) );
+         }
+      }
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         if( isAligned ) storea( ptr+j, rhs.load(k,i,j) );
+         else            storeu( ptr+j, rhs.load(k,i,j) );
+      }
+      for( ; j<n; ++j ) {
+         ptr[j] = rhs(k,i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default update of a range of rows of a dense tensor by a dense tensor.
+// \ingroup dense_tensor
+//
+// \param lhs The target dense tensor.
+// \param rhs The right-hand side dense tensor.
+// \param op The update operation (e.g. Add, Sub, or Mult).
+// \param begin The index of the first row of the range.
+// \param end The index one past the last row of the range.
+// \return void
+*/
+template< typename TT1   // Type of the left-hand side dense tensor
+        , typename TT2   // Type of the right-hand side dense tensor
+        , typename OP >  // Type of the update operation
+inline DisableIf_< DTensVectorizedUpdate<TT1,TT2,OP> >
+   dtensUpdateRows( TT1& lhs, const TT2& rhs, OP op, size_t begin, size_t end )
+{
+   const size_t m( lhs.rows() );
+   const size_t n( lhs.columns() );
+
+   for( size_t l=begin; l<end; ++l )
+   {
+      const size_t k( l / m );
+      const size_t i( l % m );
+
+      ElementType_<TT1>* BLAZE_RESTRICT ptr( lhs.data( k, i ) );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         ptr[j] = op( ptr[j], rhs(k,i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized update of a range of rows of a dense tensor by a dense tensor.
+// \ingroup dense_tensor
+//
+// \param lhs The target dense tensor.
+// \param rhs The right-hand side dense tensor.
+// \param op The update operation (e.g. Add, Sub, or Mult).
+// \param begin The index of the first row of the range.
+// \param end The index one past the last row of the range.
+// \return void
+*/
+template< typename TT1   // Type of the left-hand side dense tensor
+        , typename TT2   // Type of the right-hand side dense tensor
+        , typename OP >  // Type of the update operation
+inline EnableIf_< DTensVectorizedUpdate<TT1,TT2,OP> >
+   dtensUpdateRows( TT1& lhs, const TT2& rhs, OP op, size_t begin, size_t end )
+{
+   using ET = ElementType_<TT1>;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+   constexpr bool   isAligned( IsAligned<TT1>::value );
+
+   const size_t m( lhs.rows() );
+   const size_t n( lhs.columns() );
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+
+   for( size_t l=begin; l<end; ++l )
+   {
+      const size_t k( l / m );
+      const size_t i( l % m );
+
+      ET* BLAZE_RESTRICT ptr( lhs.data( k, i ) );
+      size_t j( 0UL );
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         if( isAligned ) storea( ptr+j, op.load( loada( ptr+j ), rhs.load(k,i,j) ) );
+         else            storeu( ptr+j, op.load( loadu( ptr+j ), rhs.load(k,i,j) ) );
+      }
+      for( ; j<n; ++j ) {
+         ptr[j] = op( ptr[j], rhs(k,i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of a dense tensor to a dense tensor.
+// \ingroup dense_tensor
+//
+// \param lhs The target dense tensor.
+// \param rhs The right-hand side dense tensor to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+inline void assign( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == (~rhs).pages()  , "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   dtensAssignRows( ~lhs, ~rhs, 0UL, (~lhs).pages()*(~lhs).rows() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Update of a dense tensor by a dense tensor via the given operation.
+// \ingroup dense_tensor
+//
+// \param lhs The target dense tensor.
+// \param rhs The right-hand side dense tensor.
+// \param op The update operation (e.g. Add, Sub, or Mult).
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// addition, subtraction, or Schur product assignment operators.
+*/
+template< typename TT1   // Type of the left-hand side dense tensor
+        , typename TT2   // Type of the right-hand side dense tensor
+        , typename OP >  // Type of the update operation
+inline void update( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == (~rhs).pages()  , "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   dtensUpdateRows( ~lhs, ~rhs, op, 0UL, (~lhs).pages()*(~lhs).rows() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP assignment of a dense tensor to a dense tensor.
+// \ingroup dense_tensor
+//
+// \param lhs The target dense tensor.
+// \param rhs The right-hand side dense tensor to be assigned.
+// \return void
+//
+// This function distributes the rows of all pages of the tensor among the available threads
+// in case the right-hand side tensor is SMP assignable and its size exceeds the threshold for
+// the parallel assignment of dense matrices (\c SMP_DMATASSIGN_THRESHOLD). Otherwise, the
+// assignment is performed serially.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+inline void smpAssign( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == (~rhs).pages()  , "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   TT1& target( ~lhs );
+   const TT2& source( ~rhs );
+
+   if( !TT1::smpAssignable || !TT2::smpAssignable || !source.canSMPAssign() ) {
+      assign( lhs, rhs );
+      return;
+   }
+
+   smpFor( 0UL, target.pages()*target.rows(), [&]( size_t begin, size_t end ) {
+      dtensAssignRows( target, source, begin, end );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP update of a dense tensor by a dense tensor via the given operation.
+// \ingroup dense_tensor
+//
+// \param lhs The target dense tensor.
+// \param rhs The right-hand side dense tensor.
+// \param op The update operation (e.g. Add, Sub, or Mult).
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// addition, subtraction, or Schur product assignment operators.
+*/
+template< typename TT1   // Type of the left-hand side dense tensor
+        , typename TT2   // Type of the right-hand side dense tensor
+        , typename OP >  // Type of the update operation
+inline void smpUpdate( DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( (~lhs).pages()   == (~rhs).pages()  , "Invalid number of pages"   );
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   TT1& target( ~lhs );
+   const TT2& source( ~rhs );
+
+   if( !TT1::smpAssignable || !TT2::smpAssignable || !source.canSMPAssign() ) {
+      update( lhs, rhs, op );
+      return;
+   }
+
+   smpFor( 0UL, target.pages()*target.rows(), [&]( size_t begin, size_t end ) {
+      dtensUpdateRows( target, source, op, begin, end );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP initialization of all elements of a dense tensor.
+// \ingroup dense_tensor
+//
+// \param lhs The dense tensor to be initialized.
+// \param value The initial value of all elements of the tensor.
+// \return void
+//
+// This function sets all elements of the given tensor to the given value. In case the tensor
+// is SMP assignable and large enough, the rows of the tensor are initialized in parallel, which
+// additionally places the memory pages of the tensor close to the threads that later work on
+// them (first-touch policy).
+//
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dense tensors. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename TT >  // Type of the dense tensor
+inline void smpFill( DenseTensor<TT>& lhs, const ElementType_<TT>& value )
+{
+   TT& target( ~lhs );
+
+   const auto kernel = [&]( size_t begin, size_t end )
+   {
+      const size_t m( target.rows() );
+      const size_t n( target.columns() );
+
+      for( size_t l=begin; l<end; ++l ) {
+         ElementType_<TT>* BLAZE_RESTRICT ptr( target.data( l/m, l%m ) );
+         for( size_t j=0UL; j<n; ++j ) {
+            ptr[j] = value;
+         }
+      }
+   };
+
+   if( !TT::smpAssignable || !target.canSMPAssign() ) {
+      kernel( 0UL, target.pages()*target.rows() );
+      return;
+   }
+
+   smpFor( 0UL, target.pages()*target.rows(), kernel );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
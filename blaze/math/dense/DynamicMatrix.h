@@ -46,13 +46,16 @@
 #include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/dense/CustomMatrix.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Transpose.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Forward.h>
 #include <blaze/math/Functions.h>
 #include <blaze/math/InitializerList.h>
+#include <blaze/math/PaddingFlag.h>
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/shims/IsDefault.h>
@@ -95,6 +98,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Max.h>
@@ -118,6 +122,7 @@
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 #include <blaze/util/Unused.h>
+#include <blaze/util/Workspace.h>
 
 
 namespace blaze {
@@ -425,6 +430,16 @@ class DynamicMatrix
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct WorkspaceAssign {
+      enum : bool { value = useWorkspace && IsNumeric<Type>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! The number of elements packed within a single SIMD element.
    enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
@@ -503,6 +518,12 @@ class DynamicMatrix
    /*!\name Utility functions */
    //@{
    inline size_t addPadding( size_t value ) const noexcept;
+
+   template< typename MT >
+   inline DisableIf_<WorkspaceAssign<MT> > assignTemporary( const MT& rhs );
+
+   template< typename MT >
+   inline EnableIf_<WorkspaceAssign<MT> > assignTemporary( const MT& rhs );
    //@}
    //**********************************************************************************************
 
@@ -568,7 +589,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix() noexcept
 // \param n The number of columns of the matrix.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! In case the thread affinity is enabled (see the
+// \c BLAZE_USE_THREAD_AFFINITY switch), the elements of a matrix with numeric element type
+// are default initialized in parallel to place the memory in the NUMA domains of the threads
+// that will work on it.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -579,6 +603,12 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
+#if BLAZE_THREAD_AFFINITY_MODE
+   if( IsNumeric<Type>::value ) {
+      smpFill( *this, Type() );
+   }
+#endif
+
    if( IsVectorizable<Type>::value ) {
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j ) {
@@ -599,7 +629,9 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In case the thread affinity is
+// enabled (see the \c BLAZE_USE_THREAD_AFFINITY switch), the elements are initialized in parallel
+// to place the memory in the NUMA domains of the threads that will work on it.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -610,6 +642,17 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
+#if BLAZE_THREAD_AFFINITY_MODE
+   smpFill( *this, init );
+
+   if( IsVectorizable<Type>::value ) {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=n_; j<nn_; ++j ) {
+            v_[i*nn_+j] = Type();
+         }
+      }
+   }
+#else
    for( size_t i=0UL; i<m; ++i ) {
       for( size_t j=0UL; j<n_; ++j )
          v_[i*nn_+j] = init;
@@ -619,6 +662,7 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& in
             v_[i*nn_+j] = Type();
       }
    }
+#endif
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -1368,8 +1412,7 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator=( const Matrix<M
       ctranspose();
    }
    else if( !IsSame<MT,IT>::value && (~rhs).canAlias( this ) ) {
-      DynamicMatrix tmp( ~rhs );
-      swap( tmp );
+      assignTemporary( ~rhs );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
@@ -1510,8 +1553,7 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::operator*=( const Matrix<
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   DynamicMatrix tmp( *this * (~rhs) );
-   swap( tmp );
+   assignTemporary( *this * (~rhs) );
 
    return *this;
 }
@@ -1959,6 +2001,61 @@ inline size_t DynamicMatrix<Type,SO>::addPadding( size_t value ) const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Assignment of the given matrix via a temporary matrix (default implementation).
+//
+// \param rhs The matrix to be assigned.
+// \return void
+//
+// This function assigns the given matrix, which is potentially aliased with this matrix, by
+// means of a temporary matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the matrix to be assigned
+inline DisableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE WorkspaceAssign<MT> >
+   DynamicMatrix<Type,SO>::assignTemporary( const MT& rhs )
+{
+   DynamicMatrix tmp( rhs );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment of the given matrix via a workspace-backed temporary matrix.
+//
+// \param rhs The matrix to be assigned.
+// \return void
+//
+// This function assigns the given matrix, which is potentially aliased with this matrix, by
+// means of a temporary matrix. The temporary matrix is drawn from the workspace of the calling
+// thread (see BLAZE_USE_WORKSPACE) and the current memory of the matrix is reused whenever
+// possible. Thus in the steady state no heap allocation is required.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the matrix to be assigned
+inline EnableIf_<typename DynamicMatrix<Type,SO>::BLAZE_TEMPLATE WorkspaceAssign<MT> >
+   DynamicMatrix<Type,SO>::assignTemporary( const MT& rhs )
+{
+   const size_t m( (~rhs).rows() );
+   const size_t n( (~rhs).columns() );
+   const size_t spacing( nextMultiple<size_t>( n, SIMDSIZE ) );
+
+   WorkspaceArray<Type> buffer( m*spacing );
+   CustomMatrix<Type,aligned,padded,SO> tmp( buffer.data(), m, n, spacing );
+
+   if( IsSparseMatrix<MT>::value )
+      tmp.reset();
+   smpAssign( tmp, ~rhs );
+
+   resize( m, n, false );
+   smpAssign( *this, tmp );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -1971,6 +2068,11 @@ inline size_t DynamicMatrix<Type,SO>::addPadding( size_t value ) const noexcept
 /*!\brief In-place transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// Square matrices are transposed by swapping mirrored SIMD register blocks. Non-square matrices
+// are transposed in-place by following the cycles of the transposition permutation, which only
+// requires one additional bit per element. Only in case the current capacity of the matrix is
+// not sufficient for the padded, transposed matrix, a new array is allocated.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -1978,26 +2080,20 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
 {
    using std::swap;
 
-   constexpr size_t block( BLOCK_SIZE );
-
    if( m_ == n_ )
    {
-      for( size_t ii=0UL; ii<m_; ii+=block ) {
-         const size_t iend( min( ii+block, m_ ) );
-         for( size_t jj=0UL; jj<=ii; jj+=block ) {
-            for( size_t i=ii; i<iend; ++i ) {
-               const size_t jend( min( jj+block, n_, i ) );
-               for( size_t j=jj; j<jend; ++j ) {
-                  swap( v_[i*nn_+j], v_[j*nn_+i] );
-               }
-            }
-         }
-      }
+      squareTranspose( m_, v_, nn_ );
+   }
+   else if( n_*addPadding( m_ ) <= capacity_ )
+   {
+      const size_t nn( addPadding( m_ ) );
+      inplaceTranspose( m_, n_, v_, nn_, nn );
+      swap( m_, n_ );
+      nn_ = nn;
    }
    else
    {
-      DynamicMatrix tmp( trans(*this) );
-      this->swap( tmp );
+      assignTemporary( trans(*this) );
    }
 
    return *this;
@@ -2036,10 +2132,19 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose()
          }
       }
    }
+   else if( n_*addPadding( m_ ) <= capacity_ )
+   {
+      transpose();
+
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            conjugate( v_[i*nn_+j] );
+         }
+      }
+   }
    else
    {
-      DynamicMatrix tmp( ctrans(*this) );
-      swap( tmp );
+      assignTemporary( ctrans(*this) );
    }
 
    return *this;
@@ -3493,6 +3598,14 @@ class DynamicMatrix<Type,true>
    };
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename MT >
+   struct WorkspaceAssign {
+      enum : bool { value = useWorkspace && IsNumeric<Type>::value };
+   };
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! The number of elements packed within a single SIMD element.
    enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
@@ -3571,6 +3684,12 @@ class DynamicMatrix<Type,true>
    /*!\name Utility functions */
    //@{
    inline size_t addPadding( size_t minRows ) const noexcept;
+
+   template< typename MT >
+   inline DisableIf_<WorkspaceAssign<MT> > assignTemporary( const MT& rhs );
+
+   template< typename MT >
+   inline EnableIf_<WorkspaceAssign<MT> > assignTemporary( const MT& rhs );
    //@}
    //**********************************************************************************************
 
@@ -3630,7 +3749,10 @@ inline DynamicMatrix<Type,true>::DynamicMatrix() noexcept
 // \param n The number of columns of the matrix.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! In case the thread affinity is enabled (see the
+// \c BLAZE_USE_THREAD_AFFINITY switch), the elements of a matrix with numeric element type
+// are default initialized in parallel to place the memory in the NUMA domains of the threads
+// that will work on it.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
@@ -3640,6 +3762,12 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
+#if BLAZE_THREAD_AFFINITY_MODE
+   if( IsNumeric<Type>::value ) {
+      smpFill( *this, Type() );
+   }
+#endif
+
    if( IsVectorizable<Type>::value ) {
       for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i ) {
@@ -3662,7 +3790,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 // \param n The number of columns of the matrix.
 // \param init The initial value of the matrix elements.
 //
-// All matrix elements are initialized with the specified value.
+// All matrix elements are initialized with the specified value. In case the thread affinity is
+// enabled (see the \c BLAZE_USE_THREAD_AFFINITY switch), the elements are initialized in parallel
+// to place the memory in the NUMA domains of the threads that will work on it.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
@@ -3672,6 +3802,17 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
+#if BLAZE_THREAD_AFFINITY_MODE
+   smpFill( *this, init );
+
+   if( IsVectorizable<Type>::value ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=m_; i<mm_; ++i ) {
+            v_[i+j*mm_] = Type();
+         }
+      }
+   }
+#else
    for( size_t j=0UL; j<n_; ++j ) {
       for( size_t i=0UL; i<m_; ++i )
          v_[i+j*mm_] = init;
@@ -3681,6 +3822,7 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type&
             v_[i+j*mm_] = Type();
       }
    }
+#endif
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -4449,8 +4591,7 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator=( const Matr
       ctranspose();
    }
    else if( !IsSame<MT,IT>::value && (~rhs).canAlias( this ) ) {
-      DynamicMatrix tmp( ~rhs );
-      swap( tmp );
+      assignTemporary( ~rhs );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
@@ -4595,8 +4736,7 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::operator*=( const Mat
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   DynamicMatrix tmp( *this * (~rhs) );
-   swap( tmp );
+   assignTemporary( *this * (~rhs) );
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 
@@ -5051,6 +5191,63 @@ inline size_t DynamicMatrix<Type,true>::addPadding( size_t values ) const noexce
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of the given matrix via a temporary matrix (default implementation).
+//
+// \param rhs The matrix to be assigned.
+// \return void
+//
+// This function assigns the given matrix, which is potentially aliased with this matrix, by
+// means of a temporary matrix.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >  // Type of the matrix to be assigned
+inline DisableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE WorkspaceAssign<MT> >
+   DynamicMatrix<Type,true>::assignTemporary( const MT& rhs )
+{
+   DynamicMatrix tmp( rhs );
+   swap( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment of the given matrix via a workspace-backed temporary matrix.
+//
+// \param rhs The matrix to be assigned.
+// \return void
+//
+// This function assigns the given matrix, which is potentially aliased with this matrix, by
+// means of a temporary matrix. The temporary matrix is drawn from the workspace of the calling
+// thread (see BLAZE_USE_WORKSPACE) and the current memory of the matrix is reused whenever
+// possible. Thus in the steady state no heap allocation is required.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >  // Type of the matrix to be assigned
+inline EnableIf_<typename DynamicMatrix<Type,true>::BLAZE_TEMPLATE WorkspaceAssign<MT> >
+   DynamicMatrix<Type,true>::assignTemporary( const MT& rhs )
+{
+   const size_t m( (~rhs).rows() );
+   const size_t n( (~rhs).columns() );
+   const size_t spacing( nextMultiple<size_t>( m, SIMDSIZE ) );
+
+   WorkspaceArray<Type> buffer( spacing*n );
+   CustomMatrix<Type,aligned,padded,true> tmp( buffer.data(), m, n, spacing );
+
+   if( IsSparseMatrix<MT>::value )
+      tmp.reset();
+   smpAssign( tmp, ~rhs );
+
+   resize( m, n, false );
+   smpAssign( *this, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -5064,32 +5261,31 @@ inline size_t DynamicMatrix<Type,true>::addPadding( size_t values ) const noexce
 /*!\brief In-place transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// Square matrices are transposed by swapping mirrored SIMD register blocks. Non-square matrices
+// are transposed in-place by following the cycles of the transposition permutation, which only
+// requires one additional bit per element. Only in case the current capacity of the matrix is
+// not sufficient for the padded, transposed matrix, a new array is allocated.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
 {
    using std::swap;
 
-   constexpr size_t block( BLOCK_SIZE );
-
    if( m_ == n_ )
    {
-      for( size_t jj=0UL; jj<n_; jj+=block ) {
-         const size_t jend( min( jj+block, n_ ) );
-         for( size_t ii=0UL; ii<=jj; ii+=block ) {
-            for( size_t j=jj; j<jend; ++j ) {
-               const size_t iend( min( ii+block, m_, j ) );
-               for( size_t i=ii; i<iend; ++i ) {
-                  swap( v_[i+j*mm_], v_[j+i*mm_] );
-               }
-            }
-         }
-      }
+      squareTranspose( n_, v_, mm_ );
+   }
+   else if( m_*addPadding( n_ ) <= capacity_ )
+   {
+      const size_t mm( addPadding( n_ ) );
+      inplaceTranspose( n_, m_, v_, mm_, mm );
+      swap( m_, n_ );
+      mm_ = mm;
    }
    else
    {
-      DynamicMatrix tmp( trans(*this) );
-      this->swap( tmp );
+      assignTemporary( trans(*this) );
    }
 
    return *this;
@@ -5129,10 +5325,19 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose()
          }
       }
    }
+   else if( m_*addPadding( n_ ) <= capacity_ )
+   {
+      transpose();
+
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            conjugate( v_[i+j*mm_] );
+         }
+      }
+   }
    else
    {
-      DynamicMatrix tmp( ctrans(*this) );
-      this->swap( tmp );
+      assignTemporary( ctrans(*this) );
    }
 
    return *this;
@@ -0,0 +1,1540 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/DynamicTensor.h
+//  \brief Header file for the implementation of a dynamic dense tensor
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_DYNAMICTENSOR_H_
+#define _BLAZE_MATH_DENSE_DYNAMICTENSOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DenseTensor.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseTensor.h>
+#include <blaze/math/Functions.h>
+#include <blaze/math/Functors.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Vectorizable.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup dynamic_tensor DynamicTensor
+// \ingroup dense_tensor
+*/
+/*!\brief Efficient implementation of a dynamic \f$ O \times M \times N \f$ tensor.
+// \ingroup dynamic_tensor
+//
+// The DynamicTensor class template is the representation of an arbitrary sized rank-3 tensor
+// with \f$ O \cdot M \cdot N \f$ dynamically allocated elements of arbitrary type. The tensor
+// consists of \f$ O \f$ pages, each of which is a row-major \f$ M \times N \f$ matrix. The type
+// of the elements can be specified via the single template parameter:
+
+   \code
+   template< typename Type >
+   class DynamicTensor;
+   \endcode
+
+// All elements of the tensor are stored in a single contiguous, properly aligned array. Within
+// a page the rows are padded in the same way as the rows of a row-major DynamicMatrix, i.e. the
+// distance between two rows is given by the spacing() function. The pages are stored directly
+// one after another, i.e. the distance between two pages is pageSpacing() = M * spacing():
+
+                 \f[\left(\begin{array}{*{5}{c}}
+                 0          & 1          & 2          & \cdots & N-1           \\
+                 N'         & N'+1       & N'+2       & \cdots & N'+N-1        \\
+                 \vdots     & \vdots     & \vdots     & \ddots & \vdots        \\
+                 MN'        & MN'+1      & MN'+2      & \cdots & MN'+N-1       \\
+                 \vdots     & \vdots     & \vdots     & \ddots & \vdots        \\
+                 \end{array}\right)\f]
+
+// The individual pages, rows, and columns of a tensor can be accessed as dense matrices via the
+// pageslice(), rowslice(), and columnslice() functions. Tensors support elementwise additions,
+// subtractions, Schur products, and scalings, which are evaluated via SIMD operations and in
+// parallel, and batched matrix multiplications, which multiply the tensor page by page:
+
+   \code
+   using blaze::DynamicTensor;
+   using blaze::DynamicMatrix;
+
+   DynamicTensor<double> A( 10UL, 64UL, 32UL ), B( 10UL, 32UL, 48UL ), C;
+   DynamicMatrix<double> M( 48UL, 16UL );
+   // ... Initialization
+
+   C = A * B;                  // Batched product of the pages of A and B
+   C = C * M;                  // Multiplication of each page of C with the matrix M
+   C = 2.0 * C + ( C % C );    // Elementwise operations
+
+   pageslice( C, 3UL ) = 0.0;  // Resetting the fourth page of C
+   \endcode
+*/
+template< typename Type >  // Data type of the tensor
+class DynamicTensor
+   : public DenseTensor< DynamicTensor<Type> >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = DynamicTensor<Type>;   //!< Type of this DynamicTensor instance.
+   using BaseType       = DenseTensor<This>;     //!< Base type of this DynamicTensor instance.
+   using ResultType     = This;                  //!< Result type for expression template evaluations.
+   using ElementType    = Type;                  //!< Type of the tensor elements.
+   using SIMDType       = SIMDTrait_<Type>;      //!< SIMD type of the tensor elements.
+   using ReturnType     = const Type&;           //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;           //!< Data type for composite expression templates.
+   using Reference      = Type&;                 //!< Reference to a non-constant tensor value.
+   using ConstReference = const Type&;           //!< Reference to a constant tensor value.
+   using Pointer        = Type*;                 //!< Pointer to a non-constant tensor value.
+   using ConstPointer   = const Type*;           //!< Pointer to a constant tensor value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the tensor is involved
+       in can be optimized via SIMD operations. In case the element type of the tensor is a
+       vectorizable data type, the \a simdEnabled compilation flag is set to \a true, otherwise
+       it is set to \a false. */
+   enum : bool { simdEnabled = IsVectorizable<Type>::value };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the tensor can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DynamicTensor() noexcept;
+   explicit inline DynamicTensor( size_t o, size_t m, size_t n );
+   explicit inline DynamicTensor( size_t o, size_t m, size_t n, const Type& init );
+   explicit inline DynamicTensor( initializer_list< initializer_list< initializer_list<Type> > > list );
+
+                           inline DynamicTensor( const DynamicTensor& t );
+                           inline DynamicTensor( DynamicTensor&& t ) noexcept;
+   template< typename TT > inline DynamicTensor( const DenseTensor<TT>& t );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~DynamicTensor();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t k, size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t k, size_t i, size_t j );
+   inline ConstReference at( size_t k, size_t i, size_t j ) const;
+   inline Pointer        data() noexcept;
+   inline ConstPointer   data() const noexcept;
+   inline Pointer        data( size_t k, size_t i ) noexcept;
+   inline ConstPointer   data( size_t k, size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline DynamicTensor& operator=( const Type& rhs );
+   inline DynamicTensor& operator=( initializer_list< initializer_list< initializer_list<Type> > > list );
+
+                           inline DynamicTensor& operator=( const DynamicTensor& rhs );
+                           inline DynamicTensor& operator=( DynamicTensor&& rhs ) noexcept;
+   template< typename TT > inline DynamicTensor& operator=( const DenseTensor<TT>& rhs );
+
+   template< typename TT > inline DynamicTensor& operator+=( const DenseTensor<TT>& rhs );
+   template< typename TT > inline DynamicTensor& operator-=( const DenseTensor<TT>& rhs );
+   template< typename TT > inline DynamicTensor& operator%=( const DenseTensor<TT>& rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, DynamicTensor >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_<IsNumeric<Other>, DynamicTensor >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t pages      () const noexcept;
+   inline size_t rows       () const noexcept;
+   inline size_t columns    () const noexcept;
+   inline size_t spacing    () const noexcept;
+   inline size_t pageSpacing() const noexcept;
+   inline size_t capacity   () const noexcept;
+   inline size_t nonZeros   () const;
+   inline void   reset      ();
+   inline void   clear      ();
+          void   resize     ( size_t o, size_t m, size_t n, bool preserve=true );
+   inline void   swap       ( DynamicTensor& t ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
+   //**********************************************************************************************
+
+ public:
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t k, size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t k, size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t k, size_t i, size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t addPadding( size_t value ) const noexcept;
+   inline void   initPadding() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t o_;                //!< The current number of pages of the tensor.
+   size_t m_;                //!< The current number of rows of the tensor.
+   size_t n_;                //!< The current number of columns of the tensor.
+   size_t nn_;               //!< The alignment adjusted number of columns.
+   size_t capacity_;         //!< The maximum capacity of the tensor.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated tensor elements.
+                             /*!< Access to the tensor elements is gained via the function call
+                                  operator. The element \f$ (k,i,j) \f$ is stored at the position
+                                  \f$ (k \cdot M + i) \cdot N' + j \f$ of the array, where
+                                  \f$ N' \f$ is the alignment adjusted number of columns. */
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for DynamicTensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline DynamicTensor<Type>::DynamicTensor() noexcept
+   : o_       ( 0UL )      // The current number of pages of the tensor
+   , m_       ( 0UL )      // The current number of rows of the tensor
+   , n_       ( 0UL )      // The current number of columns of the tensor
+   , nn_      ( 0UL )      // The alignment adjusted number of columns
+   , capacity_( 0UL )      // The maximum capacity of the tensor
+   , v_       ( nullptr )  // The tensor elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a tensor of size \f$ O \times M \times N \f$. No element initialization
+//        is performed!
+//
+// \param o The number of pages of the tensor.
+// \param m The number of rows of the tensor.
+// \param n The number of columns of the tensor.
+//
+// \note This constructor is only responsible to allocate the required dynamic memory. No
+// element initialization is performed!
+*/
+template< typename Type >  // Data type of the tensor
+inline DynamicTensor<Type>::DynamicTensor( size_t o, size_t m, size_t n )
+   : o_       ( o )                            // The current number of pages of the tensor
+   , m_       ( m )                            // The current number of rows of the tensor
+   , n_       ( n )                            // The current number of columns of the tensor
+   , nn_      ( addPadding( n ) )              // The alignment adjusted number of columns
+   , capacity_( o_*m_*nn_ )                    // The maximum capacity of the tensor
+   , v_       ( allocate<Type>( capacity_ ) )  // The tensor elements
+{
+#if BLAZE_THREAD_AFFINITY_MODE
+   if( IsNumeric<Type>::value ) {
+      smpFill( *this, Type() );
+   }
+#endif
+
+   initPadding();
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a homogenous initialization of all \f$ O \times M \times N \f$ tensor
+//        elements.
+//
+// \param o The number of pages of the tensor.
+// \param m The number of rows of the tensor.
+// \param n The number of columns of the tensor.
+// \param init The initial value of the tensor elements.
+//
+// All tensor elements are initialized with the specified value. The initialization is performed
+// in parallel for large tensors, which places the memory pages close to the threads that later
+// work on them.
+*/
+template< typename Type >  // Data type of the tensor
+inline DynamicTensor<Type>::DynamicTensor( size_t o, size_t m, size_t n, const Type& init )
+   : DynamicTensor( o, m, n )
+{
+   smpFill( *this, init );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all tensor elements.
+//
+// \param list The initializer list.
+//
+// This constructor provides the option to explicitly initialize the elements of the tensor by
+// means of a nested initializer list:
+
+   \code
+   blaze::DynamicTensor<int> A{ { { 1, 2, 3 }, { 4, 5, 6 } },
+                                { { 7, 8, 9 }, { 0, 1, 2 } } };
+   \endcode
+
+// The tensor is sized according to the number of pages of the initializer list, the maximum
+// number of rows of all pages, and the maximum number of columns of all rows. Missing values
+// are initialized as default.
+*/
+template< typename Type >  // Data type of the tensor
+inline DynamicTensor<Type>::DynamicTensor( initializer_list< initializer_list< initializer_list<Type> > > list )
+   : DynamicTensor()
+{
+   *this = list;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for DynamicTensor.
+//
+// \param t Tensor to be copied.
+//
+// The copy constructor is explicitly defined due to the required dynamic memory management
+// and in order to enable/facilitate NRV optimization.
+*/
+template< typename Type >  // Data type of the tensor
+inline DynamicTensor<Type>::DynamicTensor( const DynamicTensor& t )
+   : DynamicTensor( t.o_, t.m_, t.n_ )
+{
+   BLAZE_INTERNAL_ASSERT( capacity_ <= t.capacity_, "Invalid capacity estimation" );
+
+   smpAssign( *this, t );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for DynamicTensor.
+//
+// \param t The tensor to be moved into this instance.
+*/
+template< typename Type >  // Data type of the tensor
+inline DynamicTensor<Type>::DynamicTensor( DynamicTensor&& t ) noexcept
+   : o_       ( t.o_        )  // The current number of pages of the tensor
+   , m_       ( t.m_        )  // The current number of rows of the tensor
+   , n_       ( t.n_        )  // The current number of columns of the tensor
+   , nn_      ( t.nn_       )  // The alignment adjusted number of columns
+   , capacity_( t.capacity_ )  // The maximum capacity of the tensor
+   , v_       ( t.v_        )  // The tensor elements
+{
+   t.o_        = 0UL;
+   t.m_        = 0UL;
+   t.n_        = 0UL;
+   t.nn_       = 0UL;
+   t.capacity_ = 0UL;
+   t.v_        = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different dense tensors.
+//
+// \param t Dense tensor to be copied.
+*/
+template< typename Type >  // Data type of the tensor
+template< typename TT >    // Type of the foreign dense tensor
+inline DynamicTensor<Type>::DynamicTensor( const DenseTensor<TT>& t )
+   : DynamicTensor( (~t).pages(), (~t).rows(), (~t).columns() )
+{
+   smpAssign( *this, ~t );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for DynamicTensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline DynamicTensor<Type>::~DynamicTensor()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 3D-access to the tensor elements.
+//
+// \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename DynamicTensor<Type>::Reference
+   DynamicTensor<Type>::operator()( size_t k, size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( k<o_, "Invalid page access index"   );
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[(k*m_+i)*nn_+j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 3D-access to the tensor elements.
+//
+// \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename DynamicTensor<Type>::ConstReference
+   DynamicTensor<Type>::operator()( size_t k, size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( k<o_, "Invalid page access index"   );
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<n_, "Invalid column access index" );
+   return v_[(k*m_+i)*nn_+j];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the tensor elements.
+//
+// \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid tensor access index.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename DynamicTensor<Type>::Reference
+   DynamicTensor<Type>::at( size_t k, size_t i, size_t j )
+{
+   if( k >= o_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid page access index" );
+   }
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(k,i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the tensor elements.
+//
+// \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid tensor access index.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename DynamicTensor<Type>::ConstReference
+   DynamicTensor<Type>::at( size_t k, size_t i, size_t j ) const
+{
+   if( k >= o_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid page access index" );
+   }
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(k,i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the tensor elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the dynamic tensor. Note that you
+// can NOT assume that all tensor elements lie adjacent to each other! The dynamic tensor may
+// use techniques such as padding to improve the alignment of the data. Whereas the number of
+// elements within a row are given by the \c columns() member function, the total number of
+// elements including padding is given by the \c spacing() member function.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename DynamicTensor<Type>::Pointer
+   DynamicTensor<Type>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the tensor elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the dynamic tensor. Note that you
+// can NOT assume that all tensor elements lie adjacent to each other! The dynamic tensor may
+// use techniques such as padding to improve the alignment of the data. Whereas the number of
+// elements within a row are given by the \c columns() member function, the total number of
+// elements including padding is given by the \c spacing() member function.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename DynamicTensor<Type>::ConstPointer
+   DynamicTensor<Type>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the tensor elements of row \a i of page \a k.
+//
+// \param k The page index.
+// \param i The row index.
+// \return Pointer to the internal element storage.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename DynamicTensor<Type>::Pointer
+   DynamicTensor<Type>::data( size_t k, size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( k<o_, "Invalid page access index" );
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"  );
+   return v_ + (k*m_+i)*nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the tensor elements of row \a i of page \a k.
+//
+// \param k The page index.
+// \param i The row index.
+// \return Pointer to the internal element storage.
+*/
+template< typename Type >  // Data type of the tensor
+inline typename DynamicTensor<Type>::ConstPointer
+   DynamicTensor<Type>::data( size_t k, size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( k<o_, "Invalid page access index" );
+   BLAZE_USER_ASSERT( i<m_, "Invalid row access index"  );
+   return v_ + (k*m_+i)*nn_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Homogenous assignment to all tensor elements.
+//
+// \param rhs Scalar value to be assigned to all tensor elements.
+// \return Reference to the assigned tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( const Type& rhs )
+{
+   smpFill( *this, rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List assignment to all tensor elements.
+//
+// \param list The initializer list.
+//
+// This assignment operator offers the option to directly assign to all elements of the tensor
+// by means of a nested initializer list. The tensor is resized according to the given
+// initializer list and missing values are reset to their default state.
+*/
+template< typename Type >  // Data type of the tensor
+inline DynamicTensor<Type>&
+   DynamicTensor<Type>::operator=( initializer_list< initializer_list< initializer_list<Type> > > list )
+{
+   size_t m( 0UL ), n( 0UL );
+
+   for( const auto& page : list ) {
+      m = max( m, page.size() );
+      n = max( n, determineColumns( page ) );
+   }
+
+   resize( list.size(), m, n, false );
+
+   size_t k( 0UL );
+
+   for( const auto& page : list )
+   {
+      size_t i( 0UL );
+
+      for( const auto& rowList : page ) {
+         std::fill( std::copy( rowList.begin(), rowList.end(), data(k,i) ), data(k,i)+nn_, Type() );
+         ++i;
+      }
+      for( ; i<m_; ++i ) {
+         std::fill( data(k,i), data(k,i)+nn_, Type() );
+      }
+      ++k;
+   }
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for DynamicTensor.
+//
+// \param rhs Tensor to be copied.
+// \return Reference to the assigned tensor.
+//
+// The tensor is resized according to the given \f$ O \times M \times N \f$ tensor and
+// initialized as a copy of this tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( const DynamicTensor& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   resize( rhs.o_, rhs.m_, rhs.n_, false );
+   smpAssign( *this, rhs );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for DynamicTensor.
+//
+// \param rhs The tensor to be moved into this instance.
+// \return Reference to the assigned tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( DynamicTensor&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   o_        = rhs.o_;
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   nn_       = rhs.nn_;
+   capacity_ = rhs.capacity_;
+   v_        = rhs.v_;
+
+   rhs.o_        = 0UL;
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.nn_       = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.v_        = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different dense tensors.
+//
+// \param rhs Dense tensor to be copied.
+// \return Reference to the assigned tensor.
+//
+// The tensor is resized according to the given \f$ O \times M \times N \f$ tensor and
+// initialized as a copy of this tensor. Since all tensor operations are evaluated elementwise
+// or into temporaries, the given tensor may safely refer to this tensor.
+*/
+template< typename Type >  // Data type of the tensor
+template< typename TT >    // Type of the right-hand side dense tensor
+inline DynamicTensor<Type>& DynamicTensor<Type>::operator=( const DenseTensor<TT>& rhs )
+{
+   resize( (~rhs).pages(), (~rhs).rows(), (~rhs).columns(), false );
+   smpAssign( *this, ~rhs );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a dense tensor (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side tensor to be added to the tensor.
+// \return Reference to the tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// In case the current sizes of the two tensors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type >  // Data type of the tensor
+template< typename TT >    // Type of the right-hand side dense tensor
+inline DynamicTensor<Type>& DynamicTensor<Type>::operator+=( const DenseTensor<TT>& rhs )
+{
+   if( (~rhs).pages() != o_ || (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   smpUpdate( *this, ~rhs, Add() );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a dense tensor (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side tensor to be subtracted from the tensor.
+// \return Reference to the tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// In case the current sizes of the two tensors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type >  // Data type of the tensor
+template< typename TT >    // Type of the right-hand side dense tensor
+inline DynamicTensor<Type>& DynamicTensor<Type>::operator-=( const DenseTensor<TT>& rhs )
+{
+   if( (~rhs).pages() != o_ || (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   smpUpdate( *this, ~rhs, Sub() );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a dense tensor
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side tensor for the Schur product.
+// \return Reference to the tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// In case the current sizes of the two tensors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type >  // Data type of the tensor
+template< typename TT >    // Type of the right-hand side dense tensor
+inline DynamicTensor<Type>& DynamicTensor<Type>::operator%=( const DenseTensor<TT>& rhs )
+{
+   if( (~rhs).pages() != o_ || (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   smpUpdate( *this, ~rhs, Mult() );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a tensor and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the tensor.
+*/
+template< typename Type >   // Data type of the tensor
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, DynamicTensor<Type> >&
+   DynamicTensor<Type>::operator*=( Other rhs )
+{
+   smpAssign( *this, (*this) * rhs );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a tensor by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the tensor.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type >   // Data type of the tensor
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_<IsNumeric<Other>, DynamicTensor<Type> >&
+   DynamicTensor<Type>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   smpAssign( *this, (*this) / rhs );
+
+   BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of pages of the tensor.
+//
+// \return The number of pages of the tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t DynamicTensor<Type>::pages() const noexcept
+{
+   return o_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the tensor.
+//
+// \return The number of rows of the tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t DynamicTensor<Type>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the tensor.
+//
+// \return The number of columns of the tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t DynamicTensor<Type>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two rows.
+//
+// \return The spacing between the beginning of two rows.
+//
+// This function returns the spacing between the beginning of two rows, i.e. the total number
+// of elements of a row.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t DynamicTensor<Type>::spacing() const noexcept
+{
+   return nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the spacing between the beginning of two pages.
+//
+// \return The spacing between the beginning of two pages.
+//
+// This function returns the spacing between the beginning of two pages, i.e. the total number
+// of elements of a page including the padding elements.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t DynamicTensor<Type>::pageSpacing() const noexcept
+{
+   return m_*nn_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the tensor.
+//
+// \return The capacity of the tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t DynamicTensor<Type>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the tensor
+//
+// \return The number of non-zero elements in the tensor.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t DynamicTensor<Type>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<o_; ++k )
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            if( !isDefault( (*this)(k,i,j) ) )
+               ++nonzeros;
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type >  // Data type of the tensor
+inline void DynamicTensor<Type>::reset()
+{
+   using blaze::clear;
+
+   for( size_t k=0UL; k<o_; ++k )
+      for( size_t i=0UL; i<m_; ++i )
+         for( size_t j=0UL; j<n_; ++j )
+            clear( (*this)(k,i,j) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ O \times M \times N \f$ tensor.
+//
+// \return void
+//
+// After the clear() function, the size of the tensor is 0.
+*/
+template< typename Type >  // Data type of the tensor
+inline void DynamicTensor<Type>::clear()
+{
+   resize( 0UL, 0UL, 0UL, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the tensor.
+//
+// \param o The new number of pages of the tensor.
+// \param m The new number of rows of the tensor.
+// \param n The new number of columns of the tensor.
+// \param preserve \a true if the old values of the tensor should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the tensor using the given size to \f$ o \times m \times n \f$. During
+// this operation, new dynamic memory may be allocated in case the capacity of the tensor is too
+// small. Note that this function may invalidate all existing views (pageslices, rowslices, ...)
+// on the tensor if it is used to shrink the tensor. Additionally, the resize operation
+// potentially changes all tensor elements. In order to preserve the old tensor values, the
+// \a preserve flag can be set to \a true. However, new tensor elements are not initialized!
+*/
+template< typename Type >  // Data type of the tensor
+void DynamicTensor<Type>::resize( size_t o, size_t m, size_t n, bool preserve )
+{
+   using blaze::min;
+
+   if( o == o_ && m == m_ && n == n_ ) return;
+
+   const size_t nn( addPadding( n ) );
+
+   if( preserve )
+   {
+      Type* BLAZE_RESTRICT v = allocate<Type>( o*m*nn );
+      const size_t min_o( min( o, o_ ) );
+      const size_t min_m( min( m, m_ ) );
+      const size_t min_n( min( n, n_ ) );
+
+      for( size_t k=0UL; k<min_o; ++k ) {
+         for( size_t i=0UL; i<min_m; ++i ) {
+            transfer( data(k,i), data(k,i)+min_n, v+(k*m+i)*nn );
+         }
+      }
+
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = o*m*nn;
+   }
+   else if( o*m*nn > capacity_ ) {
+      Type* BLAZE_RESTRICT v = allocate<Type>( o*m*nn );
+      std::swap( v_, v );
+      deallocate( v );
+      capacity_ = o*m*nn;
+   }
+
+   o_  = o;
+   m_  = m;
+   n_  = n;
+   nn_ = nn;
+
+   initPadding();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two tensors.
+//
+// \param t The tensor to be swapped.
+// \return void
+*/
+template< typename Type >  // Data type of the tensor
+inline void DynamicTensor<Type>::swap( DynamicTensor& t ) noexcept
+{
+   using std::swap;
+
+   swap( o_ , t.o_  );
+   swap( m_ , t.m_  );
+   swap( n_ , t.n_  );
+   swap( nn_, t.nn_ );
+   swap( capacity_, t.capacity_ );
+   swap( v_ , t.v_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Add the necessary amount of padding to the given value.
+//
+// \param value The value to be padded.
+// \return The padded value.
+//
+// This function increments the given \a value by the necessary amount of padding based on the
+// vector's data type \a Type.
+*/
+template< typename Type >  // Data type of the tensor
+inline size_t DynamicTensor<Type>::addPadding( size_t value ) const noexcept
+{
+   if( usePadding && IsVectorizable<Type>::value )
+      return nextMultiple<size_t>( value, SIMDSIZE );
+   else return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the padding elements of all rows of the tensor.
+//
+// \return void
+*/
+template< typename Type >  // Data type of the tensor
+inline void DynamicTensor<Type>::initPadding() noexcept
+{
+   if( IsVectorizable<Type>::value ) {
+      for( size_t l=0UL; l<o_*m_; ++l ) {
+         for( size_t j=n_; j<nn_; ++j ) {
+            v_[l*nn_+j] = Type();
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the dynamic tensor are intact.
+//
+// \return \a true in case the dynamic tensor's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the dynamic tensor are intact, i.e. if its
+// state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type >  // Data type of the tensor
+inline bool DynamicTensor<Type>::isIntact() const noexcept
+{
+   if( o_ * m_ * nn_ > capacity_ )
+      return false;
+
+   if( IsVectorizable<Type>::value ) {
+      for( size_t l=0UL; l<o_*m_; ++l ) {
+         for( size_t j=n_; j<nn_; ++j ) {
+            if( v_[l*nn_+j] != Type() )
+               return false;
+         }
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the tensor can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this tensor, \a false if not.
+*/
+template< typename Type >   // Data type of the tensor
+template< typename Other >  // Data type of the foreign expression
+inline bool DynamicTensor<Type>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the tensor is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this tensor, \a false if not.
+*/
+template< typename Type >   // Data type of the tensor
+template< typename Other >  // Data type of the foreign expression
+inline bool DynamicTensor<Type>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the tensor is properly aligned in memory.
+//
+// \return \a true in case the tensor is aligned, \a false if not.
+//
+// This function returns whether the tensor is guaranteed to be properly aligned in memory, i.e.
+// whether the beginning and the end of each row of the tensor are guaranteed to conform to the
+// alignment restrictions of the element type \a Type.
+*/
+template< typename Type >  // Data type of the tensor
+inline bool DynamicTensor<Type>::isAligned() const noexcept
+{
+   return ( usePadding || columns() % SIMDSIZE == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the tensor can be used in SMP assignments.
+//
+// \return \a true in case the tensor can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the tensor can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// elements of the tensor).
+*/
+template< typename Type >  // Data type of the tensor
+inline bool DynamicTensor<Type>::canSMPAssign() const noexcept
+{
+   return ( pages() * rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Load of a SIMD element of the tensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type >  // Data type of the tensor
+BLAZE_ALWAYS_INLINE typename DynamicTensor<Type>::SIMDType
+   DynamicTensor<Type>::load( size_t k, size_t i, size_t j ) const noexcept
+{
+   if( usePadding )
+      return loada( k, i, j );
+   else
+      return loadu( k, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned load of a SIMD element of the tensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type >  // Data type of the tensor
+BLAZE_ALWAYS_INLINE typename DynamicTensor<Type>::SIMDType
+   DynamicTensor<Type>::loada( size_t k, size_t i, size_t j ) const noexcept
+{
+   using blaze::loada;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( k < o_, "Invalid page access index" );
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= nn_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( !usePadding || j % SIMDSIZE == 0UL, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( checkAlignment( v_+(k*m_+i)*nn_+j ), "Invalid alignment detected" );
+
+   return loada( v_+(k*m_+i)*nn_+j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned load of a SIMD element of the tensor.
+//
+// \param k Access index for the page. The index has to be in the range [0..O-1].
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Type >  // Data type of the tensor
+BLAZE_ALWAYS_INLINE typename DynamicTensor<Type>::SIMDType
+   DynamicTensor<Type>::loadu( size_t k, size_t i, size_t j ) const noexcept
+{
+   using blaze::loadu;
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( Type );
+
+   BLAZE_INTERNAL_ASSERT( k < o_, "Invalid page access index" );
+   BLAZE_INTERNAL_ASSERT( i < m_, "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( j < n_, "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( j + SIMDSIZE <= nn_, "Invalid column access index" );
+
+   return loadu( v_+(k*m_+i)*nn_+j );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DYNAMICTENSOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name DynamicTensor operators */
+//@{
+template< typename Type >
+inline void reset( DynamicTensor<Type>& t );
+
+template< typename Type >
+inline void clear( DynamicTensor<Type>& t );
+
+template< typename Type >
+inline bool isIntact( const DynamicTensor<Type>& t ) noexcept;
+
+template< typename Type >
+inline void swap( DynamicTensor<Type>& a, DynamicTensor<Type>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given dynamic tensor.
+// \ingroup dynamic_tensor
+//
+// \param t The tensor to be resetted.
+// \return void
+*/
+template< typename Type >  // Data type of the tensor
+inline void reset( DynamicTensor<Type>& t )
+{
+   t.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given dynamic tensor.
+// \ingroup dynamic_tensor
+//
+// \param t The tensor to be cleared.
+// \return void
+*/
+template< typename Type >  // Data type of the tensor
+inline void clear( DynamicTensor<Type>& t )
+{
+   t.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given dynamic tensor are intact.
+// \ingroup dynamic_tensor
+//
+// \param t The dynamic tensor to be tested.
+// \return \a true in case the given tensor's invariants are intact, \a false otherwise.
+*/
+template< typename Type >  // Data type of the tensor
+inline bool isIntact( const DynamicTensor<Type>& t ) noexcept
+{
+   return t.isIntact();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two dynamic tensors.
+// \ingroup dynamic_tensor
+//
+// \param a The first tensor to be swapped.
+// \param b The second tensor to be swapped.
+// \return void
+*/
+template< typename Type >  // Data type of the tensor
+inline void swap( DynamicTensor<Type>& a, DynamicTensor<Type>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsAligned< DynamicTensor<T> >
+   : public BoolConstant<usePadding>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPADDED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsPadded< DynamicTensor<T> >
+   : public BoolConstant<usePadding>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -85,6 +85,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
 #include <blaze/util/algorithms/Transfer.h>
@@ -529,7 +530,10 @@ inline DynamicVector<Type,TF>::DynamicVector() noexcept
 // \param n The size of the vector.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! In case the thread affinity is enabled (see the
+// \c BLAZE_USE_THREAD_AFFINITY switch), the elements of a vector with numeric element type
+// are default initialized in parallel to place the memory in the NUMA domains of the threads
+// that will work on it.
 */
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
@@ -538,6 +542,12 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
    , capacity_( addPadding( n ) )              // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
+#if BLAZE_THREAD_AFFINITY_MODE
+   if( IsNumeric<Type>::value ) {
+      smpFill( *this, Type() );
+   }
+#endif
+
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
          v_[i] = Type();
@@ -554,7 +564,9 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
 // \param n The size of the vector.
 // \param init The initial value of the vector elements.
 //
-// All vector elements are initialized with the specified value.
+// All vector elements are initialized with the specified value. In case the thread affinity is
+// enabled (see the \c BLAZE_USE_THREAD_AFFINITY switch), the elements are initialized in parallel
+// to place the memory in the NUMA domains of the threads that will work on it.
 */
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
@@ -563,8 +575,12 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
    , capacity_( addPadding( n ) )              // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
+#if BLAZE_THREAD_AFFINITY_MODE
+   smpFill( *this, init );
+#else
    for( size_t i=0UL; i<size_; ++i )
       v_[i] = init;
+#endif
 
    if( IsVectorizable<Type>::value ) {
       for( size_t i=size_; i<capacity_; ++i )
@@ -51,12 +51,16 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, bool > class BandMatrix;
 template< typename, bool, bool, bool > class CustomMatrix;
+template< typename, bool, bool > class CustomTensor;
 template< typename, bool, bool, bool > class CustomVector;
 template< typename, bool > class DynamicVector;
 template< typename, bool > class DynamicMatrix;
+template< typename > class DynamicTensor;
 template< typename, size_t, size_t, bool > class HybridMatrix;
 template< typename, size_t, bool > class HybridVector;
+template< typename > class PackedMatrix;
 template< typename, size_t, size_t, bool > class StaticMatrix;
 template< typename, size_t, bool > class StaticVector;
 
@@ -47,11 +47,13 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/BlockedDecomposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/LAPACK.h>
 
 
 namespace blaze {
@@ -165,7 +167,11 @@ void llh( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L )
       }
    }
 
+#if BLAZE_LAPACK_MODE
    potrf( l, 'L' );
+#else
+   blockedPotrf( l, 'L' );
+#endif
 }
 //*************************************************************************************************
 
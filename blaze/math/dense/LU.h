@@ -51,10 +51,12 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/BlockedDecomposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/NumericCast.h>
 
@@ -111,7 +113,11 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
    int* ipiv  ( helper.get() );
    int* permut( ipiv + mindim );
 
+#if BLAZE_LAPACK_MODE
    getrf( ~A, ipiv );
+#else
+   blockedGetrf( ~A, ipiv );
+#endif
 
    for( int i=0; i<size; ++i ) {
       permut[i] = i;
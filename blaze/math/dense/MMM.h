@@ -56,6 +56,8 @@
 #include <blaze/math/constraints/Lower.h>
 #include <blaze/math/constraints/Upper.h>
 #include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/PackedMMM.h>
+#include <blaze/math/dispatch/Dispatch.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsOne.h>
@@ -98,7 +100,11 @@ namespace blaze {
 // multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
 // be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
 // row-major dense matrix type. The element types of all three matrices must be SIMD
-// combinable, i.e. must provide a common SIMD interface.
+// combinable, i.e. must provide a common SIMD interface. In case the runtime dispatch mode is
+// active (see BLAZE_USE_RUNTIME_DISPATCH) and all three matrices provide direct access to their
+// single or double precision elements, the multiplication is performed by the fastest kernel
+// variant supported by the executing CPU. Otherwise, in case all three matrices provide direct
+// access to their floating point elements, the packed kernels are used (see packedGemm()).
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
 void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
@@ -138,6 +144,12 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   if( dispatchGemm( ~C, A, B, alpha, beta ) )
+      return;
+
+   if( packedMmm<0UL>( ~C, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( M, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
 
@@ -598,7 +610,11 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
 // multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
 // be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
 // column-major dense matrix type. The element types of all three matrices must be SIMD
-// combinable, i.e. must provide a common SIMD interface.
+// combinable, i.e. must provide a common SIMD interface. In case the runtime dispatch mode is
+// active (see BLAZE_USE_RUNTIME_DISPATCH) and all three matrices provide direct access to their
+// single or double precision elements, the multiplication is performed by the fastest kernel
+// variant supported by the executing CPU. Otherwise, in case all three matrices provide direct
+// access to their floating point elements, the packed kernels are used (see packedGemm()).
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
 void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
@@ -638,6 +654,12 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   if( dispatchGemm( ~C, A, B, alpha, beta ) )
+      return;
+
+   if( packedMmm<0UL>( ~C, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, N );
 
@@ -1122,7 +1144,8 @@ inline void mmm( MT1& C, const MT2& A, const MT3& B )
 // multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
 // be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
 // row-major dense matrix type. The element types of all three matrices must be SIMD
-// combinable, i.e. must provide a common SIMD interface.
+// combinable, i.e. must provide a common SIMD interface. In case all three matrices provide
+// direct access to their floating point elements, the packed kernels are used (see packedGemm()).
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
 void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
@@ -1166,11 +1189,14 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   decltype(auto) c( derestrict( ~C ) );
+
+   if( packedMmm<1UL>( c, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( M, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
 
-   decltype(auto) c( derestrict( ~C ) );
-
    if( isDefault( beta ) ) {
       reset( c );
    }
@@ -1648,7 +1674,8 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 // multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
 // be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
 // column-major dense matrix type. The element types of all three matrices must be SIMD
-// combinable, i.e. must provide a common SIMD interface.
+// combinable, i.e. must provide a common SIMD interface. In case all three matrices provide
+// direct access to their floating point elements, the packed kernels are used (see packedGemm()).
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
 void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
@@ -1692,11 +1719,14 @@ void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   decltype(auto) c( derestrict( ~C ) );
+
+   if( packedMmm<1UL>( c, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, N );
 
-   decltype(auto) c( derestrict( ~C ) );
-
    if( isDefault( beta ) ) {
       reset( c );
    }
@@ -2192,7 +2222,8 @@ inline void lmmm( MT1& C, const MT2& A, const MT3& B )
 // multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
 // be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
 // row-major dense matrix type. The element types of all three matrices must be SIMD
-// combinable, i.e. must provide a common SIMD interface.
+// combinable, i.e. must provide a common SIMD interface. In case all three matrices provide
+// direct access to their floating point elements, the packed kernels are used (see packedGemm()).
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
 void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
@@ -2236,11 +2267,14 @@ void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   decltype(auto) c( derestrict( ~C ) );
+
+   if( packedMmm<2UL>( c, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( M, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, JBLOCK );
 
-   decltype(auto) c( derestrict( ~C ) );
-
    if( isDefault( beta ) ) {
       reset( c );
    }
@@ -2710,7 +2744,8 @@ void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 // multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must
 // be non-expression dense matrix types, \a C must be a non-expression, non-adaptor,
 // column-major dense matrix type. The element types of all three matrices must be SIMD
-// combinable, i.e. must provide a common SIMD interface.
+// combinable, i.e. must provide a common SIMD interface. In case all three matrices provide
+// direct access to their floating point elements, the packed kernels are used (see packedGemm()).
 */
 template< typename MT1, typename MT2, typename MT3, typename ST >
 void ummm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
@@ -2754,11 +2789,14 @@ void ummm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
 
+   decltype(auto) c( derestrict( ~C ) );
+
+   if( packedMmm<2UL>( c, A, B, alpha, beta ) )
+      return;
+
    DynamicMatrix<ET2,false> A2( IBLOCK, KBLOCK );
    DynamicMatrix<ET3,true>  B2( KBLOCK, N );
 
-   decltype(auto) c( derestrict( ~C ) );
-
    if( isDefault( beta ) ) {
       reset( c );
    }
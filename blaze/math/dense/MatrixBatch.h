@@ -0,0 +1,2057 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MatrixBatch.h
+//  \brief Header file for the implementation of a batch of small fixed-size matrices
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MATRIXBATCH_H_
+#define _BLAZE_MATH_DENSE_MATRIXBATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/shims/Abs.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDMax.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Restrict.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup matrix_batch MatrixBatch
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a batch of small, fixed-size dense matrices.
+// \ingroup matrix_batch
+//
+// The MatrixBatch class template represents an arbitrary number of independent \a M-by-\a N
+// matrices, which are processed by batched, vectorized kernels. The type of the elements and
+// the number of rows and columns of the matrices can be specified via the three template
+// parameters:
+
+   \code
+   template< typename Type, size_t M, size_t N >
+   class MatrixBatch;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. MatrixBatch can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - M   : specifies the number of rows of each matrix.
+//  - N   : specifies the number of columns of each matrix.
+//
+// In contrast to an array of StaticMatrix instances, the matrices are stored in a structure of
+// arrays layout: The batch is divided into lane groups of \a lanes matrices (where \a lanes is
+// the number of elements in a SIMD vector of the element type) and the same element of all
+// matrices of a lane group is stored contiguously. Therefore the batched operations (mult(),
+// invert(), det(), and solve()) fill all SIMD lanes with elements of different matrices and
+// process \a lanes matrices at once. Additionally, the lane groups are distributed among the
+// available threads in case the batch exceeds the \c SMP_BATCH_THRESHOLD.
+//
+// The following example gives an impression of the use of MatrixBatch:
+
+   \code
+   using blaze::MatrixBatch;
+   using blaze::StaticMatrix;
+
+   MatrixBatch<double,3UL,3UL> A( 10000UL ), B( 10000UL ), C;  // Batches of 10000 3x3 matrices
+
+   StaticMatrix<double,3UL,3UL> K;
+   // ... Initialization of K
+
+   A.set( 0UL, K );   // Setting the first matrix of the batch
+   A(1UL,0UL,2UL) = 2.0;  // Setting element (0,2) of the second matrix of the batch
+
+   C = A * B;     // Batched matrix multiplication
+   invert( C );   // Batched in-place inversion
+
+   const blaze::DynamicVector<double> d( det( A ) );  // Batched determinant computation
+
+   const StaticMatrix<double,3UL,3UL> C0( C.get( 0UL ) );  // Extracting the first matrix
+   \endcode
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+class MatrixBatch
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This        = MatrixBatch<Type,M,N>;           //!< Type of this MatrixBatch instance.
+   using ElementType = Type;                            //!< Type of the matrix elements.
+   using MatrixType  = StaticMatrix<Type,M,N,rowMajor>;  //!< Type of a single matrix of the batch.
+
+   using Reference      = Type&;        //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;  //!< Reference to a constant matrix value.
+   using Pointer        = Type*;        //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;  //!< Pointer to a constant matrix value.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! The number of interleaved matrices per lane group.
+   enum : size_t { lanes = SIMDTrait<Type>::size };
+
+   //! The number of elements per lane group.
+   enum : size_t { groupSize = M * N * lanes };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MatrixBatch() noexcept;
+   explicit inline MatrixBatch( size_t n );
+
+   inline MatrixBatch( const MatrixBatch& b );
+   inline MatrixBatch( MatrixBatch&& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MatrixBatch();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t k, size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t k, size_t i, size_t j );
+   inline ConstReference at( size_t k, size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline Pointer        data  ( size_t g ) noexcept;
+   inline ConstPointer   data  ( size_t g ) const noexcept;
+   inline MatrixType     get   ( size_t k ) const;
+
+   template< typename MT, bool SO >
+   inline void set( size_t k, const DenseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline MatrixBatch& operator=( const MatrixBatch& rhs );
+   inline MatrixBatch& operator=( MatrixBatch&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size  () const noexcept;
+   inline size_t groups() const noexcept;
+   inline void   reset ();
+   inline void   clear ();
+   inline void   resize( size_t n );
+   inline void   swap  ( MatrixBatch& b ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t offset( size_t k, size_t i, size_t j ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;             //!< The current number of matrices.
+   size_t groups_;           //!< The current number of lane groups.
+   Type* BLAZE_RESTRICT v_;  //!< The dynamically allocated matrix elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_STATIC_ASSERT( M > 0UL && N > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MatrixBatch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>::MatrixBatch() noexcept
+   : size_  ( 0UL )      // The current number of matrices
+   , groups_( 0UL )      // The current number of lane groups
+   , v_     ( nullptr )  // The matrix elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a batch of \a n matrices.
+//
+// \param n The number of matrices of the batch.
+//
+// All elements of all matrices are default initialized (i.e. initialized to zero for all
+// built-in data types).
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>::MatrixBatch( size_t n )
+   : size_  ( n )                                // The current number of matrices
+   , groups_( ( n + lanes - 1UL ) / lanes )      // The current number of lane groups
+   , v_     ( allocate<Type>( groups_*groupSize ) )  // The matrix elements
+{
+   std::fill( v_, v_+groups_*groupSize, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for MatrixBatch.
+//
+// \param b Batch to be copied.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>::MatrixBatch( const MatrixBatch& b )
+   : size_  ( b.size_ )                          // The current number of matrices
+   , groups_( b.groups_ )                        // The current number of lane groups
+   , v_     ( allocate<Type>( groups_*groupSize ) )  // The matrix elements
+{
+   std::copy( b.v_, b.v_+groups_*groupSize, v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MatrixBatch.
+//
+// \param b The batch to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>::MatrixBatch( MatrixBatch&& b ) noexcept
+   : size_  ( b.size_ )    // The current number of matrices
+   , groups_( b.groups_ )  // The current number of lane groups
+   , v_     ( b.v_ )       // The matrix elements
+{
+   b.size_   = 0UL;
+   b.groups_ = 0UL;
+   b.v_      = nullptr;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for MatrixBatch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>::~MatrixBatch()
+{
+   deallocate( v_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 3D-access to the matrix elements.
+//
+// \param k Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::Reference
+   MatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid batch access index"  );
+   BLAZE_USER_ASSERT( i<M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N    , "Invalid column access index" );
+   return v_[offset(k,i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 3D-access to the matrix elements.
+//
+// \param k Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::ConstReference
+   MatrixBatch<Type,M,N>::operator()( size_t k, size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid batch access index"  );
+   BLAZE_USER_ASSERT( i<M    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<N    , "Invalid column access index" );
+   return v_[offset(k,i,j)];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param k Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid batch access index.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::Reference
+   MatrixBatch<Type,M,N>::at( size_t k, size_t i, size_t j )
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid batch access index" );
+   }
+   if( i >= M || j >= N ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+   return (*this)(k,i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param k Access index for the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid batch access index.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::ConstReference
+   MatrixBatch<Type,M,N>::at( size_t k, size_t i, size_t j ) const
+{
+   if( k >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid batch access index" );
+   }
+   if( i >= M || j >= N ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+   return (*this)(k,i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. Note that the elements
+// are stored in lane groups of \a lanes matrices; within a lane group, the element \f$(i,j)\f$
+// of the \a l-th matrix is stored at the offset \f$ (i \cdot N + j) \cdot lanes + l \f$.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::Pointer
+   MatrixBatch<Type,M,N>::data() noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the batch. Note that the elements
+// are stored in lane groups of \a lanes matrices; within a lane group, the element \f$(i,j)\f$
+// of the \a l-th matrix is stored at the offset \f$ (i \cdot N + j) \cdot lanes + l \f$.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::ConstPointer
+   MatrixBatch<Type,M,N>::data() const noexcept
+{
+   return v_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of a specific lane group.
+//
+// \param g The lane group index.
+// \return Pointer to the internal element storage of the lane group.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::Pointer
+   MatrixBatch<Type,M,N>::data( size_t g ) noexcept
+{
+   BLAZE_USER_ASSERT( g < groups_, "Invalid lane group access index" );
+   return v_ + g*groupSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of a specific lane group.
+//
+// \param g The lane group index.
+// \return Pointer to the internal element storage of the lane group.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::ConstPointer
+   MatrixBatch<Type,M,N>::data( size_t g ) const noexcept
+{
+   BLAZE_USER_ASSERT( g < groups_, "Invalid lane group access index" );
+   return v_ + g*groupSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a copy of the \a k-th matrix of the batch.
+//
+// \param k The index of the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \return The \a k-th matrix of the batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline typename MatrixBatch<Type,M,N>::MatrixType
+   MatrixBatch<Type,M,N>::get( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid batch access index" );
+
+   MatrixType A;
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         A(i,j) = v_[offset(k,i,j)];
+      }
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the \a k-th matrix of the batch.
+//
+// \param k The index of the matrix. The index has to be in the range \f$[0..size-1]\f$.
+// \param A The new \a M-by-\a N matrix (as for instance a StaticMatrix or a HybridMatrix).
+// \return void
+// \exception std::invalid_argument Invalid matrix size.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+template< typename MT    // Type of the dense matrix
+        , bool SO >      // Storage order of the dense matrix
+inline void MatrixBatch<Type,M,N>::set( size_t k, const DenseMatrix<MT,SO>& A )
+{
+   BLAZE_USER_ASSERT( k<size_, "Invalid batch access index" );
+
+   if( (~A).rows() != M || (~A).columns() != N ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix size" );
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         v_[offset(k,i,j)] = (~A)(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for MatrixBatch.
+//
+// \param rhs Batch to be copied.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>& MatrixBatch<Type,M,N>::operator=( const MatrixBatch& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   MatrixBatch tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for MatrixBatch.
+//
+// \param rhs The batch to be moved into this instance.
+// \return Reference to the assigned batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline MatrixBatch<Type,M,N>& MatrixBatch<Type,M,N>::operator=( MatrixBatch&& rhs ) noexcept
+{
+   deallocate( v_ );
+
+   size_   = rhs.size_;
+   groups_ = rhs.groups_;
+   v_      = rhs.v_;
+
+   rhs.size_   = 0UL;
+   rhs.groups_ = 0UL;
+   rhs.v_      = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of matrices of the batch.
+//
+// \return The number of matrices.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline size_t MatrixBatch<Type,M,N>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of lane groups of the batch.
+//
+// \return The number of lane groups.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline size_t MatrixBatch<Type,M,N>::groups() const noexcept
+{
+   return groups_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void MatrixBatch<Type,M,N>::reset()
+{
+   std::fill( v_, v_+groups_*groupSize, Type() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the batch.
+//
+// \return void
+//
+// After the clear() function, the size of the batch is 0.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void MatrixBatch<Type,M,N>::clear()
+{
+   resize( 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the number of matrices of the batch.
+//
+// \param n The new number of matrices of the batch.
+// \return void
+//
+// This function changes the number of matrices of the batch. The values of the first
+// min(\a n, \a size) matrices are preserved, all new matrices are default initialized.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void MatrixBatch<Type,M,N>::resize( size_t n )
+{
+   const size_t groups( ( n + lanes - 1UL ) / lanes );
+   const size_t last  ( std::min( size_, groups*lanes ) );
+
+   if( groups != groups_ ) {
+      MatrixBatch tmp( groups*lanes );
+      std::copy( v_, v_+std::min( groups, groups_ )*groupSize, tmp.v_ );
+      swap( tmp );
+   }
+
+   for( size_t k=n; k<last; ++k ) {
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            v_[offset(k,i,j)] = Type();
+         }
+      }
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+//
+// \param b The batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void MatrixBatch<Type,M,N>::swap( MatrixBatch& b ) noexcept
+{
+   std::swap( size_  , b.size_   );
+   std::swap( groups_, b.groups_ );
+   std::swap( v_     , b.v_      );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the storage offset of the given matrix element.
+//
+// \param k Index of the matrix.
+// \param i Row index.
+// \param j Column index.
+// \return The offset of the element within the internal storage.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline size_t MatrixBatch<Type,M,N>::offset( size_t k, size_t i, size_t j ) const noexcept
+{
+   return ( k / lanes ) * groupSize + ( i*N + j ) * lanes + ( k % lanes );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIXBATCH OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MatrixBatch operators */
+//@{
+template< typename Type, size_t M, size_t N >
+inline void reset( MatrixBatch<Type,M,N>& b );
+
+template< typename Type, size_t M, size_t N >
+inline void clear( MatrixBatch<Type,M,N>& b );
+
+template< typename Type, size_t M, size_t N >
+inline void swap( MatrixBatch<Type,M,N>& a, MatrixBatch<Type,M,N>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given batch.
+// \ingroup matrix_batch
+//
+// \param b The batch to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void reset( MatrixBatch<Type,M,N>& b )
+{
+   b.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given batch.
+// \ingroup matrix_batch
+//
+// \param b The batch to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void clear( MatrixBatch<Type,M,N>& b )
+{
+   b.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two batches.
+// \ingroup matrix_batch
+//
+// \param a The first batch to be swapped.
+// \param b The second batch to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+inline void swap( MatrixBatch<Type,M,N>& a, MatrixBatch<Type,M,N>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCHED KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar element access for the batched kernels.
+// \ingroup matrix_batch
+//
+// This auxiliary class processes a single matrix of a lane group per kernel call.
+*/
+template< typename Type >  // Data type of the matrices
+struct BatchScalarAccess
+{
+   using ElementType = Type;
+   using ValueType   = Type;
+
+   enum : size_t { size = 1UL };
+
+   static inline ValueType load( const Type* address ) { return *address; }
+   static inline void store( Type* address, const ValueType& value ) { *address = value; }
+   static inline ValueType set( const Type& value ) { return value; }
+
+   template< typename T >
+   static inline auto magnitude( const T& value ) { return abs( value ); }
+
+   template< typename T >
+   static inline T maximum( const T& a, const T& b ) { return ( a < b )?( b ):( a ); }
+
+   template< typename T >
+   static inline T lane( const T& value, size_t /*s*/ ) { return value; }
+
+   template< typename T >
+   static inline T total( const T& value ) { return value; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD element access for the batched kernels.
+// \ingroup matrix_batch
+//
+// This auxiliary class processes all matrices of a lane group per kernel call.
+*/
+template< typename Type >  // Data type of the matrices
+struct BatchSIMDAccess
+{
+   using ElementType = Type;
+   using ValueType   = SIMDTrait_<Type>;
+
+   enum : size_t { size = SIMDTrait<Type>::size };
+
+   static inline ValueType load( const Type* address ) { return loada( address ); }
+   static inline void store( Type* address, const ValueType& value ) { storea( address, value ); }
+   static inline ValueType set( const Type& value ) { return blaze::set( value ); }
+
+   static inline ValueType magnitude( const ValueType& value ) { return max( value, ValueType() - value ); }
+   static inline ValueType maximum( const ValueType& a, const ValueType& b ) { return max( a, b ); }
+   static inline Type lane( const ValueType& value, size_t s ) { return value[s]; }
+   static inline Type total( const ValueType& value ) { return sum( value ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the element access for the batched kernels.
+// \ingroup matrix_batch
+//
+// The SIMD access is selected in case the element type provides all vectorized operations
+// required by the batched kernels. Otherwise the scalar access is used.
+*/
+template< typename Type >  // Data type of the matrices
+using BatchAccess = If_< BoolConstant< useOptimizedKernels &&
+                                       IsVectorizable<Type>::value &&
+                                       HasSIMDAdd<Type,Type>::value &&
+                                       HasSIMDSub<Type,Type>::value &&
+                                       HasSIMDMult<Type,Type>::value &&
+                                       HasSIMDDiv<Type,Type>::value &&
+                                       HasSIMDMax<Type,Type>::value >
+                       , BatchSIMDAccess<Type>
+                       , BatchScalarAccess<Type> >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given batch kernel for all lane groups.
+// \ingroup matrix_batch
+//
+// \param size The total number of multiply-add operations of the batched operation.
+// \param groups The number of lane groups.
+// \param kernel The batch kernel, called as \c kernel(first,last).
+// \return void
+//
+// In case the number of operations is larger or equal to the SMP batch threshold, the lane
+// groups are distributed among the available threads. Otherwise the kernel is executed serially.
+*/
+template< typename Kernel >  // Type of the batch kernel
+inline void batchFor( size_t size, size_t groups, const Kernel& kernel )
+{
+   if( size < SMP_BATCH_THRESHOLD ) {
+      kernel( 0UL, groups );
+   }
+   else {
+      smpFor( 0UL, groups, kernel );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of active matrices in the given lane groups.
+// \ingroup matrix_batch
+//
+// \param size The total number of matrices of the batch.
+// \param k The index of the first matrix of the lane groups.
+// \return The number of active matrices in the \a L lanes starting at matrix \a k.
+*/
+template< size_t L >  // Number of lanes
+inline size_t batchActive( size_t size, size_t k ) noexcept
+{
+   return ( size - k < L )?( size - k ):( L );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resets the inactive matrices of a partially filled lane group.
+// \ingroup matrix_batch
+//
+// \param dst The lane group.
+// \param elements The number of elements per matrix.
+// \param active The number of active matrices in the lane group.
+// \return void
+//
+// This function restores the invariant that the inactive matrices of a partially filled lane
+// group are default initialized after a batched kernel has been applied to the lane group.
+*/
+template< size_t L         // Number of matrices per lane group
+        , typename Type >  // Data type of the matrices
+inline void batchClear( Type* dst, size_t elements, size_t active )
+{
+   for( size_t e=0UL; e<elements; ++e ) {
+      for( size_t l=active; l<L; ++l ) {
+         dst[e*L+l] = Type();
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of lane groups processed by a single call of the determinant kernel.
+// \ingroup matrix_batch
+//
+// The determinant kernel processes several lane groups at once in order to interleave the
+// otherwise strictly sequential chains of dependent SIMD operations of a single lane group.
+*/
+template< size_t N >  // Number of rows and columns of the system matrices
+struct BatchInterleave
+{
+   enum : size_t { value = ( N <= 4UL ? 4UL : ( N <= 8UL ? 2UL : 1UL ) ) };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batched multiplication kernel for a single lane group (\f$ C=A*B \f$).
+// \ingroup matrix_batch
+//
+// \param C The target lane group (row-major \a M-by-\a N elements per matrix).
+// \param A The left-hand side lane group (row-major \a M-by-\a K elements per matrix).
+// \param B The right-hand side lane group (row-major \a K-by-\a N elements per matrix).
+// \return void
+//
+// The rows of the target matrices are accumulated in registers and written after the according
+// row of the left-hand side matrices has been processed. Therefore \a C may alias with \a A,
+// but not with \a B.
+*/
+template< typename Access  // Type of the element access
+        , size_t M         // Number of rows of the left-hand side matrices
+        , size_t K         // Number of columns of the left-hand side matrices
+        , size_t N         // Number of columns of the right-hand side matrices
+        , size_t L         // Number of matrices per lane group
+        , typename Type >  // Data type of the matrices
+inline void batchMultKernel( Type* C, const Type* A, const Type* B )
+{
+   using ValueType = typename Access::ValueType;
+
+   for( size_t l=0UL; l<L; l+=Access::size )
+   {
+      for( size_t i=0UL; i<M; ++i )
+      {
+         ValueType a( Access::load( A+(i*K)*L+l ) );
+         ValueType c[N];
+
+         for( size_t j=0UL; j<N; ++j ) {
+            c[j] = a * Access::load( B+j*L+l );
+         }
+
+         for( size_t k=1UL; k<K; ++k ) {
+            a = Access::load( A+(i*K+k)*L+l );
+            for( size_t j=0UL; j<N; ++j ) {
+               c[j] = c[j] + a * Access::load( B+(k*N+j)*L+l );
+            }
+         }
+
+         for( size_t j=0UL; j<N; ++j ) {
+            Access::store( C+(i*N+j)*L+l, c[j] );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partial pivoting for the matrices processed by a single kernel call.
+// \ingroup matrix_batch
+//
+// \param R The register block of the processed matrices (row-major \a N-by-\a C elements).
+// \param k The index of the current elimination step.
+// \param swapped Per-matrix flag for the row interchanges.
+// \param singular Per-matrix flag for singular matrices.
+// \return \a true in case any matrix requires a row interchange or is singular, \a false if not.
+//
+// This function determines the pivot elements of the \a k-th column of the \a Access::size
+// matrices processed by a single kernel call. The magnitudes of the column elements are
+// compared via SIMD operations, so only in case a matrix requires a row interchange (or is
+// singular) the register block is spilled and the according rows are swapped individually. In case the
+// column of a matrix is zero (i.e. the matrix is singular), the diagonal element is set to 1
+// to avoid a division by zero in the elimination. Note that the per-matrix flags are only
+// updated in case the function returns \a true.
+*/
+template< typename Access  // Type of the element access
+        , size_t N         // Number of rows
+        , size_t C         // Number of columns
+        , typename VT >    // Type of the register block
+inline bool batchPivot( VT* R, size_t k, bool* swapped, bool* singular )
+{
+   using Type = typename Access::ElementType;
+
+   constexpr size_t S( Access::size );
+
+   const auto diag( Access::magnitude( R[k*C+k] ) );
+   auto pmax( diag );
+
+   for( size_t i=k+1UL; i<N; ++i ) {
+      pmax = Access::maximum( pmax, Access::magnitude( R[i*C+k] ) );
+   }
+
+   // The ratio of the maximum and the diagonal magnitude is exactly 1 in case the diagonal
+   // element is a valid pivot, larger than 1 in case a row interchange is required, and
+   // infinite or NaN in case the column is zero.
+   if( Access::total( pmax / diag ) == S )
+      return false;
+
+   alignas( AlignmentOf<Type>::value ) Type fix[S];
+   alignas( AlignmentOf<Type>::value ) Type mask[N][S];
+
+   for( size_t s=0UL; s<S; ++s )
+   {
+      singular[s] = isDefault( Access::lane( pmax, s ) );
+      swapped[s]  = false;
+      fix[s]      = ( singular[s] )?( Type(1) ):( Type() );
+
+      for( size_t i=k+1UL; i<N; ++i ) {
+         mask[i][s] = Type();
+      }
+
+      if( singular[s] || !( Access::lane( diag, s ) < Access::lane( pmax, s ) ) )
+         continue;
+
+      for( size_t i=k+1UL; i<N; ++i ) {
+         if( !( Access::lane( Access::magnitude( R[i*C+k] ), s ) < Access::lane( pmax, s ) ) ) {
+            mask[i][s] = Type(1);
+            swapped[s] = true;
+            break;
+         }
+      }
+   }
+
+   R[k*C+k] = R[k*C+k] + Access::load( fix );
+
+   // Row interchanges in the form of blends, which are exact for finite values
+   for( size_t i=k+1UL; i<N; ++i )
+   {
+      const VT m( Access::load( mask[i] ) );
+      const VT n( Access::set( Type(1) ) - m );
+
+      for( size_t j=k; j<C; ++j ) {
+         const VT rk( R[k*C+j] );
+         R[k*C+j] = rk * n + R[i*C+j] * m;
+         R[i*C+j] = R[i*C+j] * n + rk * m;
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Closed-form cofactor kernels for small square matrices.
+// \ingroup matrix_batch
+//
+// The BatchCofactor class template provides the closed-form computation of the determinant and
+// the adjugate of the \a N-by-\a N matrices of a lane group for \f$ N \le 4 \f$. The formulas
+// correspond to the ones used for the inversion and determinant computation of single dense
+// matrices (see the invert() and det() functions), but are applied to all matrices of a lane
+// group at once. For all other matrix sizes the class template derives from FalseType.
+*/
+template< size_t N >  // Number of rows and columns
+struct BatchCofactor
+   : public FalseType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BatchCofactor class template for \f$ 1 \times 1 \f$ matrices.
+// \ingroup matrix_batch
+*/
+template<>
+struct BatchCofactor<1UL>
+   : public TrueType
+{
+   template< typename VT >
+   static inline VT det( const VT* A ) {
+      return A[0];
+   }
+
+   template< typename VT >
+   static inline VT adjugate( const VT* A, VT* B, const VT& one ) {
+      B[0] = one;
+      return A[0];
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BatchCofactor class template for \f$ 2 \times 2 \f$ matrices.
+// \ingroup matrix_batch
+*/
+template<>
+struct BatchCofactor<2UL>
+   : public TrueType
+{
+   template< typename VT >
+   static inline VT det( const VT* A ) {
+      return A[0]*A[3] - A[1]*A[2];
+   }
+
+   template< typename VT >
+   static inline VT adjugate( const VT* A, VT* B, const VT& /*one*/ ) {
+      B[0] =  A[3];
+      B[1] = VT() - A[1];
+      B[2] = VT() - A[2];
+      B[3] =  A[0];
+      return A[0]*A[3] - A[1]*A[2];
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BatchCofactor class template for \f$ 3 \times 3 \f$ matrices.
+// \ingroup matrix_batch
+*/
+template<>
+struct BatchCofactor<3UL>
+   : public TrueType
+{
+   template< typename VT >
+   static inline VT det( const VT* A ) {
+      return A[0] * ( A[4]*A[8] - A[5]*A[7] ) +
+             A[1] * ( A[5]*A[6] - A[3]*A[8] ) +
+             A[2] * ( A[3]*A[7] - A[4]*A[6] );
+   }
+
+   template< typename VT >
+   static inline VT adjugate( const VT* A, VT* B, const VT& /*one*/ ) {
+      B[0] = A[4]*A[8] - A[5]*A[7];
+      B[3] = A[5]*A[6] - A[3]*A[8];
+      B[6] = A[3]*A[7] - A[4]*A[6];
+      B[1] = A[2]*A[7] - A[1]*A[8];
+      B[4] = A[0]*A[8] - A[2]*A[6];
+      B[7] = A[1]*A[6] - A[0]*A[7];
+      B[2] = A[1]*A[5] - A[2]*A[4];
+      B[5] = A[2]*A[3] - A[0]*A[5];
+      B[8] = A[0]*A[4] - A[1]*A[3];
+      return A[0]*B[0] + A[1]*B[3] + A[2]*B[6];
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the BatchCofactor class template for \f$ 4 \times 4 \f$ matrices.
+// \ingroup matrix_batch
+*/
+template<>
+struct BatchCofactor<4UL>
+   : public TrueType
+{
+   template< typename VT >
+   static inline VT det( const VT* A ) {
+      const VT tmp1( A[10]*A[15] - A[11]*A[14] );
+      const VT tmp2( A[ 9]*A[15] - A[11]*A[13] );
+      const VT tmp3( A[ 9]*A[14] - A[10]*A[13] );
+      const VT tmp4( A[ 8]*A[15] - A[11]*A[12] );
+      const VT tmp5( A[ 8]*A[14] - A[10]*A[12] );
+      const VT tmp6( A[ 8]*A[13] - A[ 9]*A[12] );
+
+      return A[0] * ( A[5]*tmp1 - A[6]*tmp2 + A[7]*tmp3 ) -
+             A[1] * ( A[4]*tmp1 - A[6]*tmp4 + A[7]*tmp5 ) +
+             A[2] * ( A[4]*tmp2 - A[5]*tmp4 + A[7]*tmp6 ) -
+             A[3] * ( A[4]*tmp3 - A[5]*tmp5 + A[6]*tmp6 );
+   }
+
+   template< typename VT >
+   static inline VT adjugate( const VT* A, VT* B, const VT& /*one*/ ) {
+      VT tmp1( A[10]*A[15] - A[11]*A[14] );
+      VT tmp2( A[ 9]*A[15] - A[11]*A[13] );
+      VT tmp3( A[ 9]*A[14] - A[10]*A[13] );
+
+      B[ 0] = A[5]*tmp1 - A[6]*tmp2 + A[7]*tmp3;
+      B[ 1] = A[2]*tmp2 - A[1]*tmp1 - A[3]*tmp3;
+
+      VT tmp4( A[8]*A[15] - A[11]*A[12] );
+      VT tmp5( A[8]*A[14] - A[10]*A[12] );
+
+      B[ 4] = A[6]*tmp4 - A[4]*tmp1 - A[7]*tmp5;
+      B[ 5] = A[0]*tmp1 - A[2]*tmp4 + A[3]*tmp5;
+
+      tmp1 = A[8]*A[13] - A[9]*A[12];
+
+      B[ 8] = A[4]*tmp2 - A[5]*tmp4 + A[7]*tmp1;
+      B[ 9] = A[1]*tmp4 - A[0]*tmp2 - A[3]*tmp1;
+      B[12] = A[5]*tmp5 - A[4]*tmp3 - A[6]*tmp1;
+      B[13] = A[0]*tmp3 - A[1]*tmp5 + A[2]*tmp1;
+
+      tmp1 = A[2]*A[7] - A[3]*A[6];
+      tmp2 = A[1]*A[7] - A[3]*A[5];
+      tmp3 = A[1]*A[6] - A[2]*A[5];
+
+      B[ 2] = A[13]*tmp1 - A[14]*tmp2 + A[15]*tmp3;
+      B[ 3] = A[10]*tmp2 - A[ 9]*tmp1 - A[11]*tmp3;
+
+      tmp4 = A[0]*A[7] - A[3]*A[4];
+      tmp5 = A[0]*A[6] - A[2]*A[4];
+
+      B[ 6] = A[14]*tmp4 - A[12]*tmp1 - A[15]*tmp5;
+      B[ 7] = A[ 8]*tmp1 - A[10]*tmp4 + A[11]*tmp5;
+
+      tmp1 = A[0]*A[5] - A[1]*A[4];
+
+      B[10] = A[12]*tmp2 - A[13]*tmp4 + A[15]*tmp1;
+      B[11] = A[ 9]*tmp4 - A[ 8]*tmp2 - A[11]*tmp1;
+      B[14] = A[13]*tmp5 - A[12]*tmp3 - A[14]*tmp1;
+      B[15] = A[ 8]*tmp3 - A[ 9]*tmp5 + A[10]*tmp1;
+
+      return A[0]*B[0] + A[1]*B[4] + A[2]*B[8] + A[3]*B[12];
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batched closed-form solution of linear systems for a single lane group.
+// \ingroup matrix_batch
+//
+// \param A The lane group of system matrices (\a N-by-\a N).
+// \param B The lane group of right-hand sides (\a N-by-\a R), or \c nullptr in order to use
+//          the identity matrix as right-hand side.
+// \param X The lane group of solutions (\a N-by-\a R).
+// \param active The number of active matrices in the lane group.
+// \return \a true in case all active matrices are non-singular, \a false if not.
+//
+// This function computes \f$ X=A^{-1}B \f$ via the adjugate of the system matrices. Note that
+// \a X may alias with \a A or \a B.
+*/
+template< typename Access  // Type of the element access
+        , size_t N         // Number of rows and columns of the system matrices
+        , size_t R         // Number of columns of the right-hand sides
+        , size_t L         // Number of matrices per lane group
+        , typename Type >  // Data type of the matrices
+bool batchCofactorKernel( const Type* A, const Type* B, Type* X, size_t active )
+{
+   using ValueType = typename Access::ValueType;
+
+   bool nonsingular( true );
+
+   for( size_t l=0UL; l<L; l+=Access::size )
+   {
+      ValueType a[N*N], c[N*N], b[N*R];
+
+      for( size_t e=0UL; e<N*N; ++e ) {
+         a[e] = Access::load( A+e*L+l );
+      }
+
+      for( size_t e=0UL; B != nullptr && e<N*R; ++e ) {
+         b[e] = Access::load( B+e*L+l );
+      }
+
+      const ValueType det( BatchCofactor<N>::adjugate( a, c, Access::set( Type(1) ) ) );
+
+      for( size_t s=0UL; s<Access::size && l+s<active; ++s ) {
+         if( !isDivisor( Access::lane( det, s ) ) )
+            nonsingular = false;
+      }
+
+      const ValueType idet( Access::set( Type(1) ) / det );
+
+      if( B == nullptr ) {
+         for( size_t e=0UL; e<N*N; ++e ) {
+            Access::store( X+e*L+l, c[e] * idet );
+         }
+         continue;
+      }
+
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=0UL; j<R; ++j ) {
+            ValueType x( c[i*N] * b[j] );
+            for( size_t k=1UL; k<N; ++k ) {
+               x = x + c[i*N+k] * b[k*R+j];
+            }
+            Access::store( X+(i*R+j)*L+l, x * idet );
+         }
+      }
+   }
+
+   return nonsingular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batched Gauss-Jordan elimination with partial pivoting for a single lane group.
+// \ingroup matrix_batch
+//
+// \param A The lane group of system matrices (\a N-by-\a N).
+// \param B The lane group of right-hand sides (\a N-by-\a R), or \c nullptr in order to use
+//          the identity matrix as right-hand side.
+// \param X The lane group of solutions (\a N-by-\a R).
+// \param active The number of active matrices in the lane group.
+// \return \a true in case all active matrices are non-singular, \a false if not.
+//
+// This function reduces the augmented matrices \f$ [A|B] \f$ to \f$ [I|A^{-1}B] \f$. The pivoting
+// is performed individually for each matrix, the elimination is performed for all matrices of
+// the lane group at once. Note that \a X may alias with \a A or \a B.
+*/
+template< typename Access  // Type of the element access
+        , size_t N         // Number of rows and columns of the system matrices
+        , size_t R         // Number of columns of the right-hand sides
+        , size_t L         // Number of matrices per lane group
+        , typename Type >  // Data type of the matrices
+bool batchGaussJordanKernel( const Type* A, const Type* B, Type* X, size_t active )
+{
+   using ValueType = typename Access::ValueType;
+
+   constexpr size_t S( Access::size );
+   constexpr size_t C( N+R );
+   constexpr size_t U( L/S );
+
+   ValueType W[U][N*C];
+   bool swapped [U][S];
+   bool singular[U][S];
+   bool nonsingular( true );
+
+   for( size_t u=0UL; u<U; ++u )
+   {
+      const size_t l( u*S );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            W[u][i*C+j] = Access::load( A+(i*N+j)*L+l );
+         }
+         for( size_t j=0UL; j<R; ++j ) {
+            W[u][i*C+N+j] = ( B != nullptr )
+                            ?( Access::load( B+(i*R+j)*L+l ) )
+                            :( Access::set( i == j ? Type(1) : Type() ) );
+         }
+      }
+   }
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      for( size_t u=0UL; u<U; ++u ) {
+         if( !batchPivot<Access,N,C>( W[u], k, swapped[u], singular[u] ) )
+            continue;
+
+         for( size_t s=0UL; s<S; ++s ) {
+            if( singular[u][s] && u*S+s < active )
+               nonsingular = false;
+         }
+      }
+
+      ValueType factor[U];
+
+      for( size_t u=0UL; u<U; ++u ) {
+         factor[u] = Access::set( Type(1) ) / W[u][k*C+k];
+      }
+
+      for( size_t j=k+1UL; j<C; ++j ) {
+         for( size_t u=0UL; u<U; ++u ) {
+            W[u][k*C+j] = W[u][k*C+j] * factor[u];
+         }
+      }
+
+      for( size_t i=0UL; i<N; ++i )
+      {
+         if( i == k ) continue;
+
+         for( size_t u=0UL; u<U; ++u ) {
+            factor[u] = W[u][i*C+k];
+         }
+
+         for( size_t j=k+1UL; j<C; ++j ) {
+            for( size_t u=0UL; u<U; ++u ) {
+               W[u][i*C+j] = W[u][i*C+j] - factor[u] * W[u][k*C+j];
+            }
+         }
+      }
+   }
+
+   for( size_t u=0UL; u<U; ++u )
+   {
+      const size_t l( u*S );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=0UL; j<R; ++j ) {
+            Access::store( X+(i*R+j)*L+l, W[u][i*C+N+j] );
+         }
+      }
+   }
+
+   return nonsingular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batched determinant computation for \a Q lane groups.
+// \ingroup matrix_batch
+//
+// \param A The first of \a Q consecutive lane groups of square matrices (\a N-by-\a N).
+// \param D The resulting determinants of the \a Q*L matrices.
+// \return void
+//
+// This function computes the determinants of the matrices of \a Q lane groups by means of a
+// Gaussian elimination with partial pivoting.
+*/
+template< typename Access  // Type of the element access
+        , size_t N         // Number of rows and columns
+        , size_t L         // Number of matrices per lane group
+        , size_t Q         // Number of processed lane groups
+        , typename Type >  // Data type of the matrices
+void batchDetKernel( const Type* A, Type* D )
+{
+   using ValueType = typename Access::ValueType;
+
+   constexpr size_t S( Access::size );
+   constexpr size_t U( Q*L/S );
+
+   ValueType W[U][N*N];
+   bool swapped [U][S];
+   bool singular[U][S];
+
+   for( size_t u=0UL; u<U; ++u ) {
+      for( size_t e=0UL; e<N*N; ++e ) {
+         W[u][e] = Access::load( A+(u*S/L)*N*N*L+e*L+(u*S%L) );
+      }
+   }
+
+   for( size_t e=0UL; e<Q*L; ++e ) {
+      D[e] = Type(1);
+   }
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      for( size_t u=0UL; u<U; ++u ) {
+         if( !batchPivot<Access,N,N>( W[u], k, swapped[u], singular[u] ) )
+            continue;
+
+         for( size_t s=0UL; s<S; ++s ) {
+            if( singular[u][s] ) D[u*S+s] = Type();
+            else if( swapped[u][s] ) D[u*S+s] = -D[u*S+s];
+         }
+      }
+
+      ValueType factor[U];
+
+      for( size_t u=0UL; u<U; ++u ) {
+         factor[u] = Access::set( Type(1) ) / W[u][k*N+k];
+      }
+
+      for( size_t i=k+1UL; i<N; ++i )
+      {
+         ValueType scale[U];
+
+         for( size_t u=0UL; u<U; ++u ) {
+            scale[u] = W[u][i*N+k] * factor[u];
+         }
+
+         for( size_t j=k+1UL; j<N; ++j ) {
+            for( size_t u=0UL; u<U; ++u ) {
+               W[u][i*N+j] = W[u][i*N+j] - scale[u] * W[u][k*N+j];
+            }
+         }
+      }
+   }
+
+   for( size_t u=0UL; u<U; ++u )
+   {
+      ValueType prod( W[u][0] );
+      for( size_t k=1UL; k<N; ++k ) {
+         prod = prod * W[u][k*N+k];
+      }
+
+      for( size_t s=0UL; s<S; ++s ) {
+         D[u*S+s] *= Access::lane( prod, s );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batched closed-form determinant computation for a single lane group.
+// \ingroup matrix_batch
+//
+// \param A The lane group of square matrices (\a N-by-\a N).
+// \param D The resulting determinants of the \a L matrices.
+// \return void
+*/
+template< typename Access  // Type of the element access
+        , size_t N         // Number of rows and columns
+        , size_t L         // Number of matrices per lane group
+        , typename Type >  // Data type of the matrices
+void batchCofactorDetKernel( const Type* A, Type* D )
+{
+   using ValueType = typename Access::ValueType;
+
+   for( size_t l=0UL; l<L; l+=Access::size )
+   {
+      ValueType a[N*N];
+
+      for( size_t e=0UL; e<N*N; ++e ) {
+         a[e] = Access::load( A+e*L+l );
+      }
+
+      const ValueType det( BatchCofactor<N>::det( a ) );
+
+      for( size_t s=0UL; s<Access::size; ++s ) {
+         D[l+s] = Access::lane( det, s );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batched solution of the linear systems \f$ A_k*X_k=B_k \f$ for small system matrices.
+// \ingroup matrix_batch
+//
+// \param A The batch of square system matrices.
+// \param B The batch of right-hand sides, or \c nullptr for the identity matrix.
+// \param X The resulting batch of solutions (with the same size as \a A).
+// \return \a true in case all matrices of \a A are non-singular, \a false if not.
+//
+// This function solves the linear systems \f$ A_k*X_k=B_k \f$ (or computes \f$ A_k^{-1} \f$ if
+// \a B is \c nullptr) by means of the closed-form adjugate of the system matrices. The lane
+// groups are distributed among the available threads in case the batch exceeds the
+// \c SMP_BATCH_THRESHOLD. Note that \a X may refer to the same batch as \a A or \a B.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N       // Number of rows and columns of the system matrices
+        , size_t R >     // Number of columns of the right-hand sides
+EnableIf_< BatchCofactor<N>, bool >
+   batchSolve( const MatrixBatch<Type,N,N>& A, const MatrixBatch<Type,N,R>* B, MatrixBatch<Type,N,R>& X )
+{
+   using Access = BatchAccess<Type>;
+
+   constexpr size_t L( MatrixBatch<Type,N,N>::lanes );
+
+   BLAZE_INTERNAL_ASSERT( A.size() == X.size(), "Invalid batch sizes detected" );
+   BLAZE_INTERNAL_ASSERT( B == nullptr || B->size() == X.size(), "Invalid batch sizes detected" );
+
+   const size_t size( A.size() );
+
+   std::atomic<bool> nonsingular( true );
+
+   batchFor( size*N*N*(N+R), A.groups(), [&A,B,&X,&nonsingular,size]( size_t first, size_t last )
+   {
+      for( size_t g=first; g<last; ++g ) {
+         if( !batchCofactorKernel<Access,N,R,L>( A.data(g), ( B != nullptr ? B->data(g) : nullptr ),
+                                                 X.data(g), batchActive<L>( size, g*L ) ) )
+            nonsingular = false;
+      }
+
+      if( last*L > size ) {
+         batchClear<L>( X.data(last-1UL), N*R, size-(last-1UL)*L );
+      }
+   } );
+
+   return nonsingular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batched solution of the linear systems \f$ A_k*X_k=B_k \f$ for large system matrices.
+// \ingroup matrix_batch
+//
+// \param A The batch of square system matrices.
+// \param B The batch of right-hand sides, or \c nullptr for the identity matrix.
+// \param X The resulting batch of solutions (with the same size as \a A).
+// \return \a true in case all matrices of \a A are non-singular, \a false if not.
+//
+// This function solves the linear systems \f$ A_k*X_k=B_k \f$ (or computes \f$ A_k^{-1} \f$ if
+// \a B is \c nullptr) by means of a Gauss-Jordan elimination with partial pivoting. The lane
+// groups are distributed among the available threads in case the batch exceeds the
+// \c SMP_BATCH_THRESHOLD. Note that \a X may refer to the same batch as \a A or \a B.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N       // Number of rows and columns of the system matrices
+        , size_t R >     // Number of columns of the right-hand sides
+DisableIf_< BatchCofactor<N>, bool >
+   batchSolve( const MatrixBatch<Type,N,N>& A, const MatrixBatch<Type,N,R>* B, MatrixBatch<Type,N,R>& X )
+{
+   using Access = BatchAccess<Type>;
+
+   constexpr size_t L( MatrixBatch<Type,N,N>::lanes );
+
+   BLAZE_INTERNAL_ASSERT( A.size() == X.size(), "Invalid batch sizes detected" );
+   BLAZE_INTERNAL_ASSERT( B == nullptr || B->size() == X.size(), "Invalid batch sizes detected" );
+
+   const size_t size( A.size() );
+
+   std::atomic<bool> nonsingular( true );
+
+   batchFor( size*N*N*(N+R), A.groups(), [&A,B,&X,&nonsingular,size]( size_t first, size_t last )
+   {
+      for( size_t g=first; g<last; ++g ) {
+         if( !batchGaussJordanKernel<Access,N,R,L>( A.data(g), ( B != nullptr ? B->data(g) : nullptr ),
+                                                    X.data(g), batchActive<L>( size, g*L ) ) )
+            nonsingular = false;
+      }
+
+      if( last*L > size ) {
+         batchClear<L>( X.data(last-1UL), N*R, size-(last-1UL)*L );
+      }
+   } );
+
+   return nonsingular;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batched determinant computation for small square matrices.
+// \ingroup matrix_batch
+//
+// \param A The batch of square matrices.
+// \param d The resulting determinants (with the same size as \a A).
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+EnableIf_< BatchCofactor<N> >
+   batchDet( const MatrixBatch<Type,N,N>& A, DynamicVector<Type>& d )
+{
+   using Access = BatchAccess<Type>;
+
+   constexpr size_t L( MatrixBatch<Type,N,N>::lanes );
+
+   const size_t size( A.size() );
+
+   batchFor( size*N*N, A.groups(), [&A,&d,size]( size_t first, size_t last )
+   {
+      Type tmp[L];
+
+      for( size_t g=first; g<last; ++g )
+      {
+         batchCofactorDetKernel<Access,N,L>( A.data(g), tmp );
+
+         const size_t active( batchActive<L>( size, g*L ) );
+         for( size_t l=0UL; l<active; ++l ) {
+            d[g*L+l] = tmp[l];
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Batched determinant computation for large square matrices.
+// \ingroup matrix_batch
+//
+// \param A The batch of square matrices.
+// \param d The resulting determinants (with the same size as \a A).
+// \return void
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+DisableIf_< BatchCofactor<N> >
+   batchDet( const MatrixBatch<Type,N,N>& A, DynamicVector<Type>& d )
+{
+   using Access = BatchAccess<Type>;
+
+   constexpr size_t L( MatrixBatch<Type,N,N>::lanes );
+   constexpr size_t Q( BatchInterleave<N>::value );
+
+   const size_t size( A.size() );
+
+   batchFor( size*N*N*N, A.groups(), [&A,&d,size]( size_t first, size_t last )
+   {
+      Type tmp[Q*L];
+
+      for( size_t g=first; g<last; )
+      {
+         const size_t q( ( g+Q <= last )?( Q ):( 1UL ) );
+
+         if( q == Q )
+            batchDetKernel<Access,N,L,Q>( A.data(g), tmp );
+         else
+            batchDetKernel<Access,N,L,1UL>( A.data(g), tmp );
+
+         const size_t active( batchActive<Q*L>( size, g*L ) );
+         for( size_t l=0UL; l<q*L && l<active; ++l ) {
+            d[g*L+l] = tmp[l];
+         }
+
+         g += q;
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BATCHED OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MatrixBatch operations */
+//@{
+template< typename Type, size_t M, size_t K, size_t N >
+void mult( MatrixBatch<Type,M,N>& C, const MatrixBatch<Type,M,K>& A, const MatrixBatch<Type,K,N>& B );
+
+template< typename Type, size_t M, size_t K, size_t N >
+MatrixBatch<Type,M,N> operator*( const MatrixBatch<Type,M,K>& A, const MatrixBatch<Type,K,N>& B );
+
+template< typename Type, size_t N >
+void invert( MatrixBatch<Type,N,N>& A );
+
+template< typename Type, size_t N >
+DynamicVector<Type> det( const MatrixBatch<Type,N,N>& A );
+
+template< typename Type, size_t N, size_t R >
+void solve( const MatrixBatch<Type,N,N>& A, MatrixBatch<Type,N,R>& X, const MatrixBatch<Type,N,R>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of two matrix batches (\f$ C_k=A_k*B_k \f$).
+// \ingroup matrix_batch
+//
+// \param C The resulting batch of \a M-by-\a N matrices.
+// \param A The batch of left-hand side \a M-by-\a K matrices.
+// \param B The batch of right-hand side \a K-by-\a N matrices.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+//
+// This function computes the products of all pairs of matrices of the two given batches. The
+// target batch is resized accordingly. Note that the target batch may alias with any of the
+// operands.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+void mult( MatrixBatch<Type,M,N>& C, const MatrixBatch<Type,M,K>& A, const MatrixBatch<Type,K,N>& B )
+{
+   using Access = BatchAccess<Type>;
+
+   constexpr size_t L( MatrixBatch<Type,M,N>::lanes );
+
+   if( A.size() != B.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   if( static_cast<const void*>( C.data() ) == static_cast<const void*>( B.data() ) && C.data() != nullptr ) {
+      MatrixBatch<Type,M,N> tmp;
+      mult( tmp, A, B );
+      C.swap( tmp );
+      return;
+   }
+
+   const size_t size( A.size() );
+
+   C.resize( size );
+
+   batchFor( size*M*N*K, C.groups(), [&C,&A,&B]( size_t first, size_t last )
+   {
+      for( size_t g=first; g<last; ++g ) {
+         batchMultKernel<Access,M,K,N,L>( C.data(g), A.data(g), B.data(g) );
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the batched multiplication of two matrix batches.
+// \ingroup matrix_batch
+//
+// \param A The batch of left-hand side \a M-by-\a K matrices.
+// \param B The batch of right-hand side \a K-by-\a N matrices.
+// \return The batch of the resulting \a M-by-\a N matrices.
+// \exception std::invalid_argument Batch sizes do not match.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N >     // Number of columns of the right-hand side matrices
+MatrixBatch<Type,M,N> operator*( const MatrixBatch<Type,M,K>& A, const MatrixBatch<Type,K,N>& B )
+{
+   MatrixBatch<Type,M,N> C;
+   mult( C, A, B );
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched in-place inversion of all matrices of the given batch.
+// \ingroup matrix_batch
+//
+// \param A The batch of square matrices to be inverted.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts all matrices of the given batch. Matrices up to \f$ 4 \times 4 \f$ are
+// inverted by means of closed-form adjugate formulas, larger matrices by means of a Gauss-Jordan
+// elimination with partial pivoting. In case any of the matrices is singular, a
+// \a std::runtime_error exception is thrown. Note that this function only provides the basic
+// exception guarantee, i.e. in case an exception is thrown \a A may already have been modified.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+void invert( MatrixBatch<Type,N,N>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   if( !batchSolve<Type,N,N>( A, nullptr, A ) ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched computation of the determinants of all matrices of the given batch.
+// \ingroup matrix_batch
+//
+// \param A The batch of square matrices.
+// \return The determinants of all matrices of the batch.
+//
+// This function computes the determinants of all matrices of the given batch. Matrices up to
+// \f$ 4 \times 4 \f$ are handled by means of closed-form cofactor formulas, larger matrices by
+// means of a Gaussian elimination with partial pivoting.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N >     // Number of rows and columns
+DynamicVector<Type> det( const MatrixBatch<Type,N,N>& A )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   DynamicVector<Type> d( A.size() );
+   batchDet( A, d );
+   return d;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Batched solution of the linear systems of equations \f$ A_k*X_k=B_k \f$.
+// \ingroup matrix_batch
+//
+// \param A The batch of square system matrices.
+// \param X The resulting batch of solutions.
+// \param B The batch of right-hand sides.
+// \return void
+// \exception std::invalid_argument Batch sizes do not match.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the linear systems of equations for all matrices of the given batches.
+// Each right-hand side is an \a N-by-\a R matrix (i.e. \a R=1 in case of a single right-hand
+// side vector). Systems up to \f$ 4 \times 4 \f$ are solved by means of the closed-form adjugate
+// of the system matrices, larger systems by means of a Gauss-Jordan elimination with partial
+// pivoting. In case any of the system matrices is singular, a \a std::runtime_error exception
+// is thrown. Note that this function only provides the basic exception guarantee, i.e. in
+// case an exception is thrown \a X may already have been modified. Also note that \a X and
+// \a B may refer to the same batch.
+*/
+template< typename Type  // Data type of the matrices
+        , size_t N       // Number of rows and columns of the system matrices
+        , size_t R >     // Number of right-hand side columns
+void solve( const MatrixBatch<Type,N,N>& A, MatrixBatch<Type,N,R>& X, const MatrixBatch<Type,N,R>& B )
+{
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   if( A.size() != B.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Batch sizes do not match" );
+   }
+
+   X.resize( A.size() );
+
+   if( !batchSolve<Type,N,R>( A, &B, X ) ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
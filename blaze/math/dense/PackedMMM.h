@@ -0,0 +1,679 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMMM.h
+//  \brief Header file for the packed dense matrix multiplication kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMMM_H_
+#define _BLAZE_MATH_DENSE_PACKEDMMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/CacheSize.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Unused.h>
+#include <blaze/util/Workspace.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONFIGURATION OF THE PACKED KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocking parameters of the packed dense matrix multiplication kernels.
+// \ingroup dense_matrix
+//
+// The packed kernels compute \f$ C=\alpha*A*B+\beta*C \f$ by means of an \a MR x \a NR register
+// tile (the micro-kernel), which is chosen per instruction set such that all accumulators and
+// the current row of the packed block of \a B fit into the available SIMD registers. The depth
+// \a KC of the packed panels is chosen such that a \a KC x \a NR panel of \a B occupies half of
+// the L1 data cache, the height \a MC of the packed block of \a A is chosen such that it occupies
+// half of the L2 cache, and the width \a NC of the packed block of \a B is chosen such that it
+// occupies half of the last level cache (see the BLAZE_L1_CACHE_SIZE, BLAZE_L2_CACHE_SIZE, and
+// BLAZE_CACHE_SIZE settings in the <tt>./blaze/config/CacheSize.h</tt> configuration file).
+*/
+template< typename T >  // Element type
+struct PackedMMMTraits
+{
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE
+   enum : size_t { MR = 8UL, NV = 3UL };
+#elif BLAZE_AVX_MODE
+   enum : size_t { MR = 6UL, NV = 2UL };
+#else
+   enum : size_t { MR = 4UL, NV = 2UL };
+#endif
+
+   enum : size_t { NR = NV * SIMDSIZE };
+
+   enum : size_t { KC = min( max( ( l1CacheSize / 2UL ) / ( NR * sizeof(T) ), 64UL ), 1024UL ) & size_t(-8) };
+
+   enum : size_t { MC = max( ( ( l2CacheSize / 2UL ) / ( KC * sizeof(T) ) ) / MR, 1UL ) * MR };
+
+   enum : size_t { NC = max( min( ( cacheSize / 2UL ) / ( KC * sizeof(T) ), 4096UL ) / NR, 1UL ) * NR };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKING ROUTINES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the left-hand side operand of a matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the block.
+// \param k The number of columns of the block.
+// \param A Pointer to the first element of the block.
+// \param rsa The distance between two consecutive rows of \a A.
+// \param csa The distance between two consecutive columns of \a A.
+// \param buffer The aligned target buffer.
+// \return void
+//
+// This function packs the given block into consecutive panels of \a MR rows, in which the \a MR
+// values of every column are stored consecutively. The last panel is padded with zeros.
+*/
+template< size_t MR     // Number of rows per panel
+        , typename T >  // Element type
+void packA( size_t m, size_t k, const T* A, size_t rsa, size_t csa, T* buffer )
+{
+   for( size_t i=0UL; i<m; i+=MR )
+   {
+      const size_t mr( min( MR, m-i ) );
+      const T* const a( A + i*rsa );
+      T* const panel( buffer + i*k );
+
+      if( csa == 1UL ) {
+         for( size_t r=0UL; r<mr; ++r ) {
+            for( size_t l=0UL; l<k; ++l ) {
+               panel[l*MR+r] = a[r*rsa+l];
+            }
+         }
+      }
+      else {
+         for( size_t l=0UL; l<k; ++l ) {
+            for( size_t r=0UL; r<mr; ++r ) {
+               panel[l*MR+r] = a[r*rsa+l*csa];
+            }
+         }
+      }
+
+      for( size_t l=0UL; l<k; ++l ) {
+         for( size_t r=mr; r<MR; ++r ) {
+            panel[l*MR+r] = T(0);
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the right-hand side operand of a matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param k The number of rows of the block.
+// \param n The number of columns of the block.
+// \param B Pointer to the first element of the block.
+// \param rsb The distance between two consecutive rows of \a B.
+// \param csb The distance between two consecutive columns of \a B.
+// \param buffer The aligned target buffer.
+// \return void
+//
+// This function packs the given block into consecutive panels of \a NR columns, in which the
+// \a NR values of every row are stored consecutively. The last panel is padded with zeros.
+*/
+template< size_t NR     // Number of columns per panel
+        , typename T >  // Element type
+void packB( size_t k, size_t n, const T* B, size_t rsb, size_t csb, T* buffer )
+{
+   for( size_t j=0UL; j<n; j+=NR )
+   {
+      const size_t nr( min( NR, n-j ) );
+      const T* const b( B + j*csb );
+      T* const panel( buffer + j*k );
+
+      if( csb == 1UL ) {
+         for( size_t l=0UL; l<k; ++l ) {
+            for( size_t c=0UL; c<nr; ++c ) {
+               panel[l*NR+c] = b[l*rsb+c];
+            }
+            for( size_t c=nr; c<NR; ++c ) {
+               panel[l*NR+c] = T(0);
+            }
+         }
+      }
+      else {
+         for( size_t c=0UL; c<nr; ++c ) {
+            for( size_t l=0UL; l<k; ++l ) {
+               panel[l*NR+c] = b[l*rsb+c*csb];
+            }
+         }
+         for( size_t l=0UL; l<k; ++l ) {
+            for( size_t c=nr; c<NR; ++c ) {
+               panel[l*NR+c] = T(0);
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MICRO-KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper for the complete unrolling of the loops of the micro-kernels.
+// \ingroup dense_matrix
+//
+// The PackedUnroll class template calls the given function for all indices in the range
+// \f$ [I..N) \f$. In contrast to a loop, the calls are guaranteed to be unrolled, which enables
+// the compiler to keep the accumulators of the micro-kernels in SIMD registers independent of
+// the optimization level.
+*/
+template< size_t I    // Current index
+        , size_t N >  // Number of indices
+struct PackedUnroll
+{
+   template< typename F >
+   static BLAZE_ALWAYS_INLINE void apply( const F& f )
+   {
+      f( I );
+      PackedUnroll<I+1UL,N>::apply( f );
+   }
+};
+
+template< size_t N >  // Number of indices
+struct PackedUnroll<N,N>
+{
+   template< typename F >
+   static BLAZE_ALWAYS_INLINE void apply( const F& )
+   {}
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the product of a packed panel of \a A and a packed panel of \a B.
+// \ingroup dense_matrix
+//
+// \param k The depth of the two panels.
+// \param a Pointer to the packed panel of \a A (\a MR consecutive values per column).
+// \param b Pointer to the packed panel of \a B (\a NV SIMD vectors per row).
+// \param xmm The \a MR x \a NV accumulators.
+// \return void
+*/
+template< size_t MR     // Number of rows of the register tile
+        , size_t NV     // Number of SIMD vectors per row of the register tile
+        , typename T >  // Element type
+BLAZE_ALWAYS_INLINE void packedProduct( size_t k, const T* a, const T* b, SIMDTrait_<T> (&xmm)[MR][NV] )
+{
+   using SIMDType = SIMDTrait_<T>;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+
+   for( size_t l=0UL; l<k; ++l )
+   {
+      SIMDType b1[NV];
+
+      PackedUnroll<0UL,NV>::apply( [&]( size_t v ) {
+         b1[v] = loada( b+v*SIMDSIZE );
+      } );
+
+      PackedUnroll<0UL,MR>::apply( [&]( size_t r ) {
+         const SIMDType a1( set( a[r] ) );
+         PackedUnroll<0UL,NV>::apply( [&]( size_t v ) {
+            xmm[r][v] += a1 * b1[v];
+         } );
+      } );
+
+      a += MR;
+      b += NV*SIMDSIZE;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Micro-kernel for a complete \a MR x \a NR tile of \f$ C+=\alpha*A*B \f$.
+// \ingroup dense_matrix
+//
+// \param k The depth of the two panels.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param a Pointer to the packed panel of \a A.
+// \param b Pointer to the packed panel of \a B.
+// \param C Pointer to the first element of the row-major tile of \a C.
+// \param ldc The distance between two consecutive rows of \a C.
+// \return void
+*/
+template< size_t MR     // Number of rows of the register tile
+        , size_t NV     // Number of SIMD vectors per row of the register tile
+        , typename T >  // Element type
+void packedKernel( size_t k, T alpha, const T* a, const T* b, T* C, size_t ldc )
+{
+   using SIMDType = SIMDTrait_<T>;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size };
+
+   SIMDType xmm[MR][NV];
+
+   packedProduct<MR,NV>( k, a, b, xmm );
+
+   const SIMDType factor( set( alpha ) );
+
+   PackedUnroll<0UL,MR>::apply( [&]( size_t r ) {
+      PackedUnroll<0UL,NV>::apply( [&]( size_t v ) {
+         T* const c( C+r*ldc+v*SIMDSIZE );
+         storeu( c, loadu( c ) + xmm[r][v] * factor );
+      } );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Micro-kernel for a partial tile of \f$ C+=\alpha*A*B \f$.
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the tile (at most \a MR).
+// \param n The number of columns of the tile (at most \a NV SIMD vectors).
+// \param k The depth of the two panels.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param a Pointer to the packed panel of \a A.
+// \param b Pointer to the packed panel of \a B.
+// \param C Pointer to the first element of the row-major tile of \a C.
+// \param ldc The distance between two consecutive rows of \a C.
+// \param diag The offset of the diagonal of \a C with respect to the tile.
+// \return void
+//
+// This function handles the tiles at the lower and right border of \a C and the tiles crossing
+// the diagonal of a lower (\a UPLO = 1) or upper (\a UPLO = 2) restricted product. In the latter
+// two cases, only the elements \f$ (r,c) \f$ with \f$ c-r \le diag \f$ or \f$ c-r \ge diag \f$,
+// respectively, are updated.
+*/
+template< size_t MR     // Number of rows of the register tile
+        , size_t NV     // Number of SIMD vectors per row of the register tile
+        , size_t UPLO   // Restriction of the result (0: none, 1: lower, 2: upper)
+        , typename T >  // Element type
+void packedEdgeKernel( size_t m, size_t n, size_t k, T alpha, const T* a, const T* b,
+                       T* C, size_t ldc, ptrdiff_t diag )
+{
+   using SIMDType = SIMDTrait_<T>;
+
+   enum : size_t { SIMDSIZE = SIMDTrait<T>::size, NR = NV*SIMDSIZE };
+
+   SIMDType xmm[MR][NV];
+
+   packedProduct<MR,NV>( k, a, b, xmm );
+
+   alignas( AlignmentOf<T>::value ) T tmp[MR*NR];
+
+   PackedUnroll<0UL,MR>::apply( [&]( size_t r ) {
+      PackedUnroll<0UL,NV>::apply( [&]( size_t v ) {
+         storea( tmp+r*NR+v*SIMDSIZE, xmm[r][v] );
+      } );
+   } );
+
+   for( size_t r=0UL; r<m; ++r )
+   {
+      const size_t jbegin( ( UPLO == 2UL )
+                           ?( min( size_t( max( ptrdiff_t( r ) + diag, ptrdiff_t( 0 ) ) ), n ) )
+                           :( 0UL ) );
+      const size_t jend  ( ( UPLO == 1UL )
+                           ?( min( size_t( max( ptrdiff_t( r ) + diag + 1, ptrdiff_t( 0 ) ) ), n ) )
+                           :( n ) );
+
+      for( size_t c=jbegin; c<jend; ++c ) {
+         C[r*ldc+c] += alpha * tmp[r*NR+c];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED MATRIX MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed kernel for a dense matrix/dense matrix multiplication (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param m The number of rows of \a A and \a C.
+// \param n The number of columns of \a B and \a C.
+// \param k The number of columns of \a A and rows of \a B.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the first element of \a A.
+// \param rsa The distance between two consecutive rows of \a A.
+// \param csa The distance between two consecutive columns of \a A.
+// \param lowerA \a true in case \a A is a lower triangular matrix.
+// \param upperA \a true in case \a A is an upper triangular matrix.
+// \param B Pointer to the first element of \a B.
+// \param rsb The distance between two consecutive rows of \a B.
+// \param csb The distance between two consecutive columns of \a B.
+// \param lowerB \a true in case \a B is a lower triangular matrix.
+// \param upperB \a true in case \a B is an upper triangular matrix.
+// \param C Pointer to the first element of the row-major matrix \a C.
+// \param ldc The distance between two consecutive rows of \a C.
+// \return void
+//
+// This function implements the GotoBLAS/BLIS scheme: An \a KC x \a NC block of \a B is packed
+// into panels of \a NR columns, which remain in the last level cache, and every \a MC x \a KC
+// block of \a A is packed into panels of \a MR rows, which remain in the L2 cache. The packed
+// panels are then streamed through the \a MR x \a NR micro-kernel (see PackedMMMTraits). In
+// case \a UPLO is 1 or 2, only the lower or upper part of \a C is updated, respectively. Blocks,
+// tiles, and ranges of the inner dimension that only contribute zeros due to the triangular
+// shape of \a A or \a B are skipped.
+*/
+template< size_t UPLO   // Restriction of the result (0: none, 1: lower, 2: upper)
+        , typename T >  // Element type
+void packedGemm( size_t m, size_t n, size_t k, T alpha,
+                 const T* A, size_t rsa, size_t csa, bool lowerA, bool upperA,
+                 const T* B, size_t rsb, size_t csb, bool lowerB, bool upperB,
+                 T* C, size_t ldc )
+{
+   using Traits = PackedMMMTraits<T>;
+
+   constexpr size_t MR( Traits::MR );
+   constexpr size_t NV( Traits::NV );
+   constexpr size_t NR( Traits::NR );
+   constexpr size_t KC( Traits::KC );
+   constexpr size_t MC( Traits::MC );
+   constexpr size_t NC( Traits::NC );
+
+   BLAZE_STATIC_ASSERT( KC > 0UL && MC % MR == 0UL && NC % NR == 0UL );
+
+   if( m == 0UL || n == 0UL || k == 0UL )
+      return;
+
+   const size_t kcmax( min( KC, k ) );
+   const size_t mcmax( ( min( MC, m ) + MR - 1UL ) / MR * MR );
+   const size_t ncmax( ( min( NC, n ) + NR - 1UL ) / NR * NR );
+
+   WorkspaceArray<T> abuffer( mcmax*kcmax );
+   WorkspaceArray<T> bbuffer( kcmax*ncmax );
+
+   for( size_t jc=0UL; jc<n; jc+=NC )
+   {
+      const size_t nc( min( NC, n-jc ) );
+
+      for( size_t pc=0UL; pc<k; pc+=KC )
+      {
+         const size_t kc( min( KC, k-pc ) );
+
+         if( ( lowerB && pc+kc <= jc ) || ( upperB && pc >= jc+nc ) )
+            continue;
+
+         packB<NR>( kc, nc, B+pc*rsb+jc*csb, rsb, csb, bbuffer.data() );
+
+         for( size_t ic=0UL; ic<m; ic+=MC )
+         {
+            const size_t mc( min( MC, m-ic ) );
+
+            if( ( UPLO == 1UL && jc > ic+mc-1UL ) || ( UPLO == 2UL && jc+nc-1UL < ic ) ||
+                ( lowerA && pc >= ic+mc ) || ( upperA && pc+kc <= ic ) )
+               continue;
+
+            packA<MR>( mc, kc, A+ic*rsa+pc*csa, rsa, csa, abuffer.data() );
+
+            for( size_t jr=0UL; jr<nc; jr+=NR )
+            {
+               const size_t nr( min( NR, nc-jr ) );
+               const size_t j( jc+jr );
+
+               for( size_t ir=0UL; ir<mc; ir+=MR )
+               {
+                  const size_t mr( min( MR, mc-ir ) );
+                  const size_t i( ic+ir );
+
+                  if( ( UPLO == 1UL && j > i+mr-1UL ) || ( UPLO == 2UL && j+nr-1UL < i ) )
+                     continue;
+
+                  size_t lbegin( 0UL );
+                  size_t lend  ( kc );
+
+                  if( upperA && i > pc ) lbegin = max( lbegin, i-pc );
+                  if( lowerB && j > pc ) lbegin = max( lbegin, j-pc );
+                  if( lowerA ) lend = min( lend, i+mr > pc ? i+mr-pc : 0UL );
+                  if( upperB ) lend = min( lend, j+nr > pc ? j+nr-pc : 0UL );
+
+                  if( lbegin >= lend )
+                     continue;
+
+                  const T* const a( abuffer.data() + ir*kc + lbegin*MR );
+                  const T* const b( bbuffer.data() + jr*kc + lbegin*NR );
+                  T* const c( C+i*ldc+j );
+
+                  const bool full( mr == MR && nr == NR &&
+                                   ( UPLO != 1UL || j+NR-1UL <= i ) &&
+                                   ( UPLO != 2UL || j >= i+MR-1UL ) );
+
+                  if( full ) {
+                     packedKernel<MR,NV>( lend-lbegin, alpha, a, b, c, ldc );
+                  }
+                  else {
+                     packedEdgeKernel<MR,NV,UPLO>( mr, nr, lend-lbegin, alpha, a, b, c, ldc,
+                                                   ptrdiff_t( i ) - ptrdiff_t( j ) );
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the packed matrix multiplication kernels.
+// \ingroup dense_matrix
+//
+// The packed kernels are used in case all three matrices provide direct access to their single
+// or double precision elements and the element types are SIMD enabled.
+*/
+template< typename T1, typename T2, typename T3 >
+struct UsePackedKernel
+   : public BoolConstant< HasMutableDataAccess<T1>::value &&
+                          HasConstDataAccess<T2>::value &&
+                          HasConstDataAccess<T3>::value &&
+                          T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+                          IsFloatingPoint< ElementType_<T1> >::value &&
+                          IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                          IsSame< ElementType_<T1>, ElementType_<T3> >::value &&
+                          ( SIMDTrait< ElementType_<T1> >::size > 1UL ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for operands that are not suited for the packed matrix multiplication kernels.
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return \a false.
+*/
+template< size_t UPLO     // Restriction of the result (0: none, 1: lower, 2: upper)
+        , typename MT1    // Type of the left-hand side target matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3    // Type of the right-hand side matrix operand
+        , typename ST >   // Type of the scaling factors
+inline DisableIf_< UsePackedKernel<MT1,MT2,MT3>, bool >
+   packedMmm( MT1& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   UNUSED_PARAMETER( C, A, B, alpha, beta );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed dense matrix/dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return \a true.
+//
+// This function computes \f$ C=\alpha*A*B+\beta*C \f$ by means of packedGemm(). In case \a UPLO
+// is 1 or 2, only the lower or upper part of \a C is computed, respectively. Column-major target
+// matrices are handled by computing \f$ C^T=\alpha*B^T*A^T+\beta*C^T \f$ instead.
+*/
+template< size_t UPLO     // Restriction of the result (0: none, 1: lower, 2: upper)
+        , typename MT1    // Type of the left-hand side target matrix
+        , typename MT2    // Type of the left-hand side matrix operand
+        , typename MT3    // Type of the right-hand side matrix operand
+        , typename ST >   // Type of the scaling factors
+inline EnableIf_< UsePackedKernel<MT1,MT2,MT3>, bool >
+   packedMmm( MT1& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET = ElementType_<MT1>;
+
+   BLAZE_INTERNAL_ASSERT( A.rows()    == C.rows()    , "Invalid number of rows detected"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == C.columns() , "Invalid number of columns detected" );
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()    , "Invalid matrix sizes detected"      );
+
+   if( isDefault( beta ) ) {
+      reset( C );
+   }
+   else if( !isOne( beta ) ) {
+      C *= beta;
+   }
+
+   const size_t rsa( IsRowMajorMatrix<MT2>::value ? A.spacing() : 1UL );
+   const size_t csa( IsRowMajorMatrix<MT2>::value ? 1UL : A.spacing() );
+   const size_t rsb( IsRowMajorMatrix<MT3>::value ? B.spacing() : 1UL );
+   const size_t csb( IsRowMajorMatrix<MT3>::value ? 1UL : B.spacing() );
+
+   if( IsRowMajorMatrix<MT1>::value ) {
+      packedGemm<UPLO>( A.rows(), B.columns(), A.columns(), ET( alpha ),
+                        A.data(), rsa, csa, IsLower<MT2>::value, IsUpper<MT2>::value,
+                        B.data(), rsb, csb, IsLower<MT3>::value, IsUpper<MT3>::value,
+                        C.data(), C.spacing() );
+   }
+   else {
+      constexpr size_t TUPLO( UPLO == 0UL ? 0UL : 3UL-UPLO );
+
+      packedGemm<TUPLO>( B.columns(), A.rows(), A.columns(), ET( alpha ),
+                         B.data(), csb, rsb, IsUpper<MT3>::value, IsLower<MT3>::value,
+                         A.data(), csa, rsa, IsUpper<MT2>::value, IsLower<MT2>::value,
+                         C.data(), C.spacing() );
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,2542 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMatrix.h
+//  \brief Implementation of a dense matrix in packed storage format
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+#define _BLAZE_MATH_DENSE_PACKEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/Diagonal.h>
+#include <blaze/math/constraints/NumericMatrix.h>
+#include <blaze/math/constraints/StrictlyTriangular.h>
+#include <blaze/math/constraints/Triangular.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/IsReal.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPackedMatrix.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyTriangular.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUniLower.h>
+#include <blaze/math/typetraits/IsUniTriangular.h>
+#include <blaze/math/typetraits/IsUniUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/IsView.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup packed_matrix PackedMatrix
+// \ingroup dense_matrix
+*/
+/*!\brief Efficient implementation of a dense symmetric, Hermitian or triangular matrix in packed
+//        storage format.
+// \ingroup packed_matrix
+//
+// The PackedMatrix class template represents a dense, square matrix with symmetric, Hermitian,
+// lower or upper structure, which stores only the \f$ N(N+1)/2 \f$ elements of one triangle of
+// the matrix. The structure, the element type, and the storage order of the matrix are specified
+// by means of the according dense matrix adaptor, which is given as the single template parameter:
+
+   \code
+   template< typename MT >
+   class PackedMatrix;
+   \endcode
+
+//  - MT: specifies the type of the adapted dense matrix. PackedMatrix can be used with any dense
+//        SymmetricMatrix, HermitianMatrix, LowerMatrix, UniLowerMatrix, StrictlyLowerMatrix,
+//        UpperMatrix, UniUpperMatrix, or StrictlyUpperMatrix with numeric element type.
+//
+// The elements are stored in the packed format of LAPACK, i.e. the stored triangle is stored
+// line by line (row by row for row-major matrices, column by column for column-major matrices)
+// without any padding. Lower and upper matrices store their non-zero triangle, symmetric and
+// Hermitian matrices store the lower triangle in case of row-major matrices and the upper
+// triangle in case of column-major matrices. In comparison to the adaptor with full storage
+// the packed format halves the memory requirement. Additionally, the multiplication with a
+// dense vector and the solution of triangular systems (see trsv()) only read the stored
+// triangle: For symmetric and Hermitian matrices every stored element is loaded once and is
+// used for both of its positions within the matrix, which roughly halves the memory traffic of
+// the memory bound matrix/vector multiplication.
+//
+// A PackedMatrix provides read access to all elements of the matrix, including the elements of
+// the triangle that is not stored. It is set up from any other matrix with according structure
+// (in case the given matrix does not provide the required structure, a \a std::invalid_argument
+// exception is thrown) and can be updated via addition and subtraction assignments. Write
+// access to the packed elements is given via the data() and index() functions. The following
+// example demonstrates the use of the PackedMatrix class template:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::LowerMatrix;
+   using blaze::PackedMatrix;
+   using blaze::SymmetricMatrix;
+
+   using Covariance = PackedMatrix< SymmetricMatrix< DynamicMatrix<double> > >;
+   using Factor     = PackedMatrix< LowerMatrix< DynamicMatrix<double> > >;
+
+   Covariance C( 30000UL );  // 30000x30000 symmetric matrix in packed storage
+
+   // Initialization of the lower triangle via direct access to the packed elements
+   for( size_t i=0UL; i<C.rows(); ++i )
+      for( size_t j=0UL; j<=i; ++j )
+         C.data()[C.index(i,j)] = ...;
+
+   DynamicVector<double> x( 30000UL ), y;
+   // ... Initialization of x
+
+   y = C * x;          // Packed symmetric matrix/vector multiplication
+   y = trans( x ) * C; // Packed symmetric vector/matrix multiplication
+
+   Factor L( ... );    // Conversion of a lower matrix into packed storage
+   trsv( L, y );       // Solution of the lower triangular system L*x=y
+   \endcode
+
+// Multiplications with dense vectors are vectorized for the built-in element types (in case
+// the element type of the vector matches the element type of the matrix) and are parallelized
+// in case the number of rows exceeds the \c SMP_DMATDVECMULT_THRESHOLD. All other operations
+// treat a PackedMatrix like any other dense matrix, i.e. the result of for instance an addition
+// of two packed matrices or of a matrix/matrix multiplication is a matrix of the adaptor type
+// \a MT.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+class PackedMatrix
+   : public DenseMatrix< PackedMatrix<MT>, IsColumnMajorMatrix<MT>::value >
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Type     = ElementType_<MT>;  //!< Type of the matrix elements.
+   using SIMDType = SIMDTrait_<Type>;  //!< SIMD type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Storage order of the packed matrix.
+   enum : bool { SO = IsColumnMajorMatrix<MT>::value };
+
+   //! Compilation flag for symmetric and Hermitian matrices.
+   enum : bool { SF = IsSymmetric<MT>::value || IsHermitian<MT>::value };
+
+   //! Compilation flag for Hermitian matrices with complex elements.
+   enum : bool { HF = IsHermitian<MT>::value && !IsSymmetric<MT>::value };
+
+   //! Compilation flag for unitriangular matrices.
+   enum : bool { UF = IsUniTriangular<MT>::value };
+
+   //! Compilation flag for the stored part of each row (or column) of the matrix.
+   /*! The \a LF flag is set to \a true in case the stored part of each row (for row-major
+       matrices) or column (for column-major matrices) ends with the diagonal element and to
+       \a false in case it starts with the diagonal element. */
+   enum : bool { LF = SF || ( IsLower<MT>::value != SO ) };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = PackedMatrix<MT>;        //!< Type of this PackedMatrix instance.
+   using BaseType       = DenseMatrix<This,SO>;    //!< Base type of this PackedMatrix instance.
+   using ResultType     = MT;                      //!< Result type for expression template evaluations.
+   using OppositeType   = OppositeType_<MT>;       //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = TransposeType_<MT>;      //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                    //!< Type of the matrix elements.
+   using ReturnType     = const Type;              //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;             //!< Data type for composite expression templates.
+   using Reference      = const Type;              //!< Reference to a matrix element.
+   using ConstReference = const Type;              //!< Reference to a constant matrix element.
+   using Pointer        = Type*;                   //!< Pointer to a non-constant packed element.
+   using ConstPointer   = const Type*;             //!< Pointer to a constant packed element.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a PackedMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      //! The type of the other PackedMatrix.
+      using Other = PackedMatrix< typename MT::template Rebind<NewType>::Other >;
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a PackedMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = PackedMatrix<MT>;  //!< The type of the other PackedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of a row (or column) of the packed matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = Type;                             //!< Type of the underlying elements.
+      using PointerType      = const Type*;                      //!< Pointer return type.
+      using ReferenceType    = const Type;                       //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : matrix_( nullptr )  // Reference to the packed matrix
+         , row_   ( 0UL )      // The current row index of the iterator
+         , column_( 0UL )      // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param matrix The packed matrix.
+      // \param row Initial row index of the iterator.
+      // \param column Initial column index of the iterator.
+      */
+      inline ConstIterator( const PackedMatrix& matrix, size_t row, size_t column ) noexcept
+         : matrix_( &matrix )  // Reference to the packed matrix
+         , row_   ( row     )  // The current row index of the iterator
+         , column_( column  )  // The current column index of the iterator
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( size_t inc ) noexcept {
+         ( SO )?( row_ += inc ):( column_ += inc );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( size_t dec ) noexcept {
+         ( SO )?( row_ -= dec ):( column_ -= dec );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         ( SO )?( ++row_ ):( ++column_ );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) noexcept {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() noexcept {
+         ( SO )?( --row_ ):( --column_ );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) noexcept {
+         const ConstIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The resulting value.
+      */
+      inline ReferenceType operator*() const {
+         return (*matrix_)( row_, column_ );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      friend inline bool operator==( const ConstIterator& lhs, const ConstIterator& rhs ) noexcept {
+         return ( SO )?( lhs.row_ == rhs.row_ ):( lhs.column_ == rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      friend inline bool operator!=( const ConstIterator& lhs, const ConstIterator& rhs ) noexcept {
+         return ( SO )?( lhs.row_ != rhs.row_ ):( lhs.column_ != rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      friend inline bool operator<( const ConstIterator& lhs, const ConstIterator& rhs ) noexcept {
+         return ( SO )?( lhs.row_ < rhs.row_ ):( lhs.column_ < rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      friend inline bool operator>( const ConstIterator& lhs, const ConstIterator& rhs ) noexcept {
+         return ( SO )?( lhs.row_ > rhs.row_ ):( lhs.column_ > rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      friend inline bool operator<=( const ConstIterator& lhs, const ConstIterator& rhs ) noexcept {
+         return ( SO )?( lhs.row_ <= rhs.row_ ):( lhs.column_ <= rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param lhs The left-hand side iterator.
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      friend inline bool operator>=( const ConstIterator& lhs, const ConstIterator& rhs ) noexcept {
+         return ( SO )?( lhs.row_ >= rhs.row_ ):( lhs.column_ >= rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two iterators.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return ( SO )?( row_ - rhs.row_ ):( column_ - rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, size_t inc ) noexcept {
+         if( SO )
+            return ConstIterator( *it.matrix_, it.row_ + inc, it.column_ );
+         else
+            return ConstIterator( *it.matrix_, it.row_, it.column_ + inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ConstIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( size_t inc, const ConstIterator& it ) noexcept {
+         return it + inc;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, size_t dec ) noexcept {
+         if( SO )
+            return ConstIterator( *it.matrix_, it.row_ - dec, it.column_ );
+         else
+            return ConstIterator( *it.matrix_, it.row_, it.column_ - dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const PackedMatrix* matrix_;  //!< Reference to the packed matrix.
+      size_t row_;                  //!< The current row index of the iterator.
+      size_t column_;               //!< The current column index of the iterator.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SIMD optimization.
+   /*! The \a simdEnabled compilation flag indicates whether expressions the matrix is involved
+       in can be optimized via SIMD operations. Due to the packed storage format the elements
+       of a row (or column) cannot be loaded as SIMD vectors and therefore the flag is set to
+       \a false. */
+   enum : bool { simdEnabled = false };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). Since the SMP assignments split the operands into submatrices, which are
+       not available for the packed storage format, the flag is set to \a false. Note that
+       the multiplication with a dense vector is nevertheless executed in parallel (see
+       canSMPAssign()). */
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedMatrix() noexcept;
+   explicit inline PackedMatrix( size_t n );
+
+   template< typename MT2, bool SO2 >
+   explicit inline PackedMatrix( const Matrix<MT2,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Pointer        data  () noexcept;
+   inline ConstPointer   data  () const noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename MT2, bool SO2 >
+   inline PackedMatrix& operator=( const Matrix<MT2,SO2>& rhs );
+
+   template< typename MT2, bool SO2 >
+   inline PackedMatrix& operator+=( const Matrix<MT2,SO2>& rhs );
+
+   template< typename MT2, bool SO2 >
+   inline PackedMatrix& operator-=( const Matrix<MT2,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline size_t index( size_t i, size_t j ) const noexcept;
+   inline void   reset();
+   inline void   clear();
+   inline void   swap( PackedMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename T1, typename T2 >
+   struct VectorizedKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            IsSame<T1,Type>::value && IsSame<T2,Type>::value &&
+                            IsBuiltin<Type>::value && IsVectorizable<Type>::value &&
+                            HasSIMDAdd<Type,Type>::value && HasSIMDMult<Type,Type>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< bool TF, typename T1, typename T2 >
+   inline void mult( T1* y, const T2* x, bool parallel ) const;
+
+   template< typename T >
+   inline void solve( T* b ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t offset( size_t k ) const noexcept;
+   inline size_t split( size_t p, size_t parts, bool ascending ) const noexcept;
+
+   template< typename MT2 >
+   inline bool isPackable( const MT2& m, bool update ) const;
+
+   template< typename MT2 >
+   inline void setup( const MT2& m );
+
+   template< bool SUB, typename MT2 >
+   inline void update( const MT2& m );
+
+   template< bool SUB >
+   inline void update( const PackedMatrix& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Kernel functions****************************************************************************
+   /*!\name Kernel functions */
+   //@{
+   template< bool CF, typename T1, typename T2 >
+   inline void symmetricKernel( T1* y, const T2* x, size_t begin, size_t end ) const;
+
+   template< typename T1, typename T2 >
+   inline void lineKernel( T1* y, const T2* x, size_t begin, size_t end ) const;
+
+   template< typename T1, typename T2 >
+   inline void stripKernel( T1* y, const T2* x, size_t begin, size_t end ) const;
+
+   template< typename T1, typename T2 >
+   static inline DisableIf_< VectorizedKernel<T1,T2>, T1 >
+      dot( const Type* a, const T2* x, size_t n ) noexcept;
+
+   template< typename T1, typename T2 >
+   static inline EnableIf_< VectorizedKernel<T1,T2>, T1 >
+      dot( const Type* a, const T2* x, size_t n ) noexcept;
+
+   template< typename T1, typename T2 >
+   static inline DisableIf_< VectorizedKernel<T1,T2> >
+      axpy( T1* y, const Type* a, T2 alpha, size_t n ) noexcept;
+
+   template< typename T1, typename T2 >
+   static inline EnableIf_< VectorizedKernel<T1,T2> >
+      axpy( T1* y, const Type* a, T2 alpha, size_t n ) noexcept;
+
+   template< bool CF, typename T1, typename T2 >
+   static inline DisableIf_< VectorizedKernel<T1,T2>, T1 >
+      dotAxpy( T1* y, const Type* a, const T2* x, T2 alpha, size_t n ) noexcept;
+
+   template< bool CF, typename T1, typename T2 >
+   static inline EnableIf_< VectorizedKernel<T1,T2>, T1 >
+      dotAxpy( T1* y, const Type* a, const T2* x, T2 alpha, size_t n ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Values = std::vector< Type, AlignedAllocator<Type> >;  //!< Type of the value array.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;  //!< The current number of rows and columns of the matrix.
+   Values v_;  //!< The elements of the stored triangle of the matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE       ( MT );
+   BLAZE_CONSTRAINT_MUST_BE_ADAPTOR_TYPE            ( MT );
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_MATRIX_TYPE     ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_DIAGONAL_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE        ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE      ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST               ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE            ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PackedMatrix.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline PackedMatrix<MT>::PackedMatrix() noexcept
+   : n_( 0UL )  // The current number of rows and columns of the matrix
+   , v_()       // The elements of the stored triangle of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a \f$ N \times N \f$ PackedMatrix.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// All off-diagonal elements of the matrix are initialized to 0. The diagonal elements are
+// initialized to 1 in case of a unitriangular matrix and to 0 otherwise.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline PackedMatrix<MT>::PackedMatrix( size_t n )
+   : n_( n )                             // The current number of rows and columns of the matrix
+   , v_( n*(n+1UL)/2UL, Type() )  // The elements of the stored triangle of the matrix
+{
+   if( UF ) {
+      for( size_t k=0UL; k<n_; ++k )
+         v_[index(k,k)] = Type(1);
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted into packed storage.
+// \exception std::invalid_argument Invalid setup of packed matrix.
+//
+// In case the given matrix is not square or does not provide the structure of the adaptor
+// \a MT (i.e. is not symmetric, Hermitian, lower, ...), a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename MT2   // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline PackedMatrix<MT>::PackedMatrix( const Matrix<MT2,SO2>& m )
+   : PackedMatrix()
+{
+   setup( ~m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline typename PackedMatrix<MT>::ConstReference
+   PackedMatrix<MT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   if( LF ? ( l <= k ) : ( l >= k ) )
+      return v_[index(i,j)];
+   else if( HF )
+      return conj( v_[index(j,i)] );
+   else if( SF )
+      return v_[index(j,i)];
+   else
+      return Type();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline typename PackedMatrix<MT>::ConstReference
+   PackedMatrix<MT>::at( size_t i, size_t j ) const
+{
+   if( i >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the packed matrix. The position
+// of the element \f$ a_{ij} \f$ of the stored triangle within the storage is given by the
+// index() function. Note that writing to the packed elements bypasses all structural checks,
+// i.e. the diagonal elements of a unitriangular matrix must remain 1, the diagonal elements of
+// a strictly triangular matrix must remain 0, and the diagonal elements of an Hermitian matrix
+// must remain real.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline typename PackedMatrix<MT>::Pointer PackedMatrix<MT>::data() noexcept
+{
+   return v_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the internal element storage.
+//
+// This function returns a pointer to the internal storage of the packed matrix. The position
+// of the element \f$ a_{ij} \f$ of the stored triangle within the storage is given by the
+// index() function.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline typename PackedMatrix<MT>::ConstPointer PackedMatrix<MT>::data() const noexcept
+{
+   return v_.data();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return \a nullptr.
+//
+// Since the rows (or columns) of a packed matrix are not stored contiguously, this function
+// always returns \a nullptr. It is provided for the compatibility with dense row and column
+// views, which use the null pointer to detect that no contiguous storage is available.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline typename PackedMatrix<MT>::ConstPointer PackedMatrix<MT>::data( size_t i ) const noexcept
+{
+   UNUSED_PARAMETER( i );
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the packed matrix is row-major, the function returns an iterator to the first
+// element of row \a i, in case it is column-major, the function returns an iterator to the
+// first element of column \a i.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline typename PackedMatrix<MT>::ConstIterator
+   PackedMatrix<MT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+
+   if( SO )
+      return ConstIterator( *this, 0UL, i );
+   else
+      return ConstIterator( *this, i, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+//
+// In case the packed matrix is row-major, the function returns an iterator to the first
+// element of row \a i, in case it is column-major, the function returns an iterator to the
+// first element of column \a i.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline typename PackedMatrix<MT>::ConstIterator
+   PackedMatrix<MT>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the packed matrix is row-major, the function returns an iterator just past the last
+// element of row \a i, in case it is column-major, the function returns an iterator just past
+// the last element of column \a i.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline typename PackedMatrix<MT>::ConstIterator
+   PackedMatrix<MT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid packed matrix row/column access index" );
+
+   if( SO )
+      return ConstIterator( *this, n_, i );
+   else
+      return ConstIterator( *this, i, n_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+//
+// In case the packed matrix is row-major, the function returns an iterator just past the last
+// element of row \a i, in case it is column-major, the function returns an iterator just past
+// the last element of column \a i.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline typename PackedMatrix<MT>::ConstIterator
+   PackedMatrix<MT>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to packed matrix.
+//
+// The matrix is resized according to the given matrix and initialized as a copy of this
+// matrix. In case the given matrix is not square or does not provide the structure of the
+// adaptor \a MT, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<MT>& PackedMatrix<MT>::operator=( const Matrix<MT2,SO2>& rhs )
+{
+   PackedMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid addition to packed matrix.
+//
+// In case the current sizes of the two matrices don't match or the given matrix does not
+// provide the structure of the adaptor \a MT (in case of unitriangular matrices the given
+// matrix has to be strictly triangular), a \a std::invalid_argument exception is thrown. The
+// addition of another packed matrix of the same type only traverses the packed elements.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<MT>& PackedMatrix<MT>::operator+=( const Matrix<MT2,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_<MT2> tmp( ~rhs );
+
+   if( !isPackable( tmp, true ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid addition to packed matrix" );
+   }
+
+   update<false>( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid subtraction from packed matrix.
+//
+// In case the current sizes of the two matrices don't match or the given matrix does not
+// provide the structure of the adaptor \a MT (in case of unitriangular matrices the given
+// matrix has to be strictly triangular), a \a std::invalid_argument exception is thrown. The
+// subtraction of another packed matrix of the same type only traverses the packed elements.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline PackedMatrix<MT>& PackedMatrix<MT>::operator-=( const Matrix<MT2,SO2>& rhs )
+{
+   if( (~rhs).rows() != n_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_<MT2> tmp( ~rhs );
+
+   if( !isPackable( tmp, true ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid subtraction from packed matrix" );
+   }
+
+   update<true>( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline size_t PackedMatrix<MT>::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline size_t PackedMatrix<MT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored elements of the matrix.
+//
+// \return The number of stored elements, i.e. \f$ N(N+1)/2 \f$.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline size_t PackedMatrix<MT>::capacity() const noexcept
+{
+   return v_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the packed matrix.
+//
+// Note that in case of symmetric and Hermitian matrices the non-zero off-diagonal elements of
+// the stored triangle are counted twice.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline size_t PackedMatrix<MT>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t first( LF ? 0UL : k );
+      const size_t last ( LF ? k+1UL : n_ );
+      for( size_t l=first; l<last; ++l ) {
+         if( !isDefault( v_[offset(k)+l-first] ) )
+            nonzeros += ( SF && l != k )?( 2UL ):( 1UL );
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline size_t PackedMatrix<MT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row/column access index" );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t l=0UL; l<n_; ++l ) {
+      if( !isDefault( SO ? (*this)(l,i) : (*this)(i,l) ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the specified element within the packed storage.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The position of the element within the storage returned by data().
+//
+// This function returns the position of the element \f$ a_{ij} \f$ within the packed storage.
+// The element has to be part of the stored triangle of the matrix: For row-major matrices
+// this is the lower triangle (\f$ i \ge j \f$) in case of symmetric, Hermitian and lower
+// matrices and the upper triangle (\f$ i \le j \f$) in case of upper matrices, for column-major
+// matrices it is the upper triangle in case of symmetric, Hermitian and upper matrices and the
+// lower triangle in case of lower matrices. This precondition is only checked in case
+// BLAZE_USER_ASSERT() is active.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline size_t PackedMatrix<MT>::index( size_t i, size_t j ) const noexcept
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   BLAZE_USER_ASSERT( k < n_ && l < n_, "Invalid packed matrix access index" );
+   BLAZE_USER_ASSERT( LF ? ( l <= k ) : ( l >= k ), "Element is not part of the stored triangle" );
+
+   return offset( k ) + ( LF ? l : l-k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all off-diagonal elements to 0. The diagonal elements are reset to 1 in
+// case of a unitriangular matrix and to 0 otherwise.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline void PackedMatrix<MT>::reset()
+{
+   PackedMatrix tmp( n_ );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the \f$ N \times N \f$ matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline void PackedMatrix<MT>::clear()
+{
+   PackedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two packed matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline void PackedMatrix<MT>::swap( PackedMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( n_, m.n_ );
+   v_.swap( m.v_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the position of the first stored element of the given row/column.
+//
+// \param k The index of the row (row-major) or column (column-major).
+// \return The position of the first stored element within the packed storage.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline size_t PackedMatrix<MT>::offset( size_t k ) const noexcept
+{
+   return ( LF )?( k*(k+1UL)/2UL ):( k*(2UL*n_-k+1UL)/2UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits the rows/columns of the matrix into parts of equal work.
+//
+// \param p The index of the part \f$[0..parts]\f$.
+// \param parts The total number of parts.
+// \param ascending \a true in case the work per row/column grows with its index.
+// \return The index of the first row/column of part \a p.
+//
+// The work per row (or column) of a triangle grows (or shrinks) linearly with its index.
+// Therefore the boundaries of the parts are placed at square roots of the relative amount of
+// work in order to assign all parts approximately the same number of packed elements.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline size_t PackedMatrix<MT>::split( size_t p, size_t parts, bool ascending ) const noexcept
+{
+   if( p >= parts )
+      return n_;
+
+   const double ratio( ascending ? double( p ) / parts : double( parts - p ) / parts );
+   const size_t bound( static_cast<size_t>( n_ * std::sqrt( ratio ) ) );
+
+   return ( ascending )?( bound ):( n_ - bound );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks whether the given matrix provides the structure of the adaptor.
+//
+// \param m The matrix to be checked.
+// \param update \a true in case of an addition or subtraction assignment.
+// \return \a true in case the given matrix provides the required structure, \a false if not.
+//
+// In case of addition and subtraction assignments to unitriangular matrices the given matrix
+// is required to be strictly triangular.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename MT2 >  // Type of the matrix to be checked
+inline bool PackedMatrix<MT>::isPackable( const MT2& m, bool update ) const
+{
+   if( m.rows() != m.columns() )
+      return false;
+
+   if( ( HF && IsHermitian<MT2>::value ) ||
+       ( SF && !HF && IsSymmetric<MT2>::value ) ||
+       ( !SF && IsLower<MT>::value && IsStrictlyLower<MT2>::value ) ||
+       ( !SF && IsUpper<MT>::value && IsStrictlyUpper<MT2>::value ) ||
+       ( !SF && !update && IsLower<MT>::value && IsLower<MT2>::value &&
+         ( IsUniLower<MT>::value == IsUniLower<MT2>::value ) &&
+         ( IsStrictlyLower<MT>::value == IsStrictlyLower<MT2>::value ) ) ||
+       ( !SF && !update && IsUpper<MT>::value && IsUpper<MT2>::value &&
+         ( IsUniUpper<MT>::value == IsUniUpper<MT2>::value ) &&
+         ( IsStrictlyUpper<MT>::value == IsStrictlyUpper<MT2>::value ) ) ||
+       ( !SF && update && !UF && IsLower<MT>::value && IsLower<MT2>::value ) ||
+       ( !SF && update && !UF && IsUpper<MT>::value && IsUpper<MT2>::value ) )
+      return true;
+
+   const bool isStrict( IsStrictlyTriangular<MT>::value || ( UF && update ) );
+
+   for( size_t i=0UL; i<m.rows(); ++i )
+   {
+      if( HF && !isReal( m(i,i) ) )
+         return false;
+      if( !SF && isStrict && !isDefault( m(i,i) ) )
+         return false;
+      if( !SF && UF && !update && !isOne( m(i,i) ) )
+         return false;
+
+      for( size_t j=0UL; j<i; ++j ) {
+         if( ( HF && !equal( m(i,j), conj( m(j,i) ) ) ) ||
+             ( SF && !HF && !equal( m(i,j), m(j,i) ) ) ||
+             ( !SF && IsLower<MT>::value && !isDefault( m(j,i) ) ) ||
+             ( !SF && IsUpper<MT>::value && !isDefault( m(i,j) ) ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of the packed matrix from the given matrix.
+//
+// \param m The matrix to be converted into packed storage.
+// \return void
+// \exception std::invalid_argument Invalid setup of packed matrix.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename MT2 >  // Type of the foreign matrix
+inline void PackedMatrix<MT>::setup( const MT2& m )
+{
+   CompositeType_<MT2> tmp( m );
+
+   if( !isPackable( tmp, false ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of packed matrix" );
+   }
+
+   n_ = tmp.rows();
+   v_.resize( n_*(n_+1UL)/2UL );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t first( LF ? 0UL : k );
+      const size_t last ( LF ? k+1UL : n_ );
+      Type* line( v_.data() + offset( k ) - first );
+      for( size_t l=first; l<last; ++l ) {
+         line[l] = ( SO )?( tmp(l,k) ):( tmp(k,l) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition/subtraction of the stored triangle of the given matrix.
+//
+// \param m The matrix to be added (SUB=false) or subtracted (SUB=true).
+// \return void
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< bool SUB        // Compilation flag for subtractions
+        , typename MT2 >  // Type of the foreign matrix
+inline void PackedMatrix<MT>::update( const MT2& m )
+{
+   for( size_t k=0UL; k<n_; ++k ) {
+      const size_t first( LF ? 0UL : k );
+      const size_t last ( LF ? k+1UL : n_ );
+      Type* line( v_.data() + offset( k ) - first );
+      for( size_t l=first; l<last; ++l ) {
+         if( UF && l == k ) continue;
+         if( SUB ) line[l] -= ( SO )?( m(l,k) ):( m(k,l) );
+         else      line[l] += ( SO )?( m(l,k) ):( m(k,l) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition/subtraction of another packed matrix of the same type.
+//
+// \param m The packed matrix to be added (SUB=false) or subtracted (SUB=true).
+// \return void
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< bool SUB >     // Compilation flag for subtractions
+inline void PackedMatrix<MT>::update( const PackedMatrix& m )
+{
+   const size_t size( v_.size() );
+   const Type* values( m.v_.data() );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      if( SUB ) v_[i] -= values[i];
+      else      v_[i] += values[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename MT >     // Type of the adapted dense matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<MT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename MT >     // Type of the adapted dense matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool PackedMatrix<MT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false since the rows (or columns) of a packed matrix are not aligned.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline bool PackedMatrix<MT>::isAligned() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the multiplication of the matrix with a dense vector is large
+// enough to be executed in parallel, i.e. whether the number of rows of the matrix exceeds the
+// \c SMP_DMATDVECMULT_THRESHOLD.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline bool PackedMatrix<MT>::canSMPAssign() const noexcept
+{
+   return ( rows() > SMP_DMATDVECMULT_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of the packed matrix with a dense vector.
+//
+// \param y Contiguous, zero-initialized storage of the target vector.
+// \param x Contiguous storage of the right-hand side vector.
+// \param parallel \a true in case the multiplication may be executed in parallel.
+// \return void
+//
+// This function computes \f$ \vec{y}=A*\vec{x} \f$ (TF=false) or \f$ \vec{y}^T=\vec{x}^T*A \f$
+// (TF=true). Symmetric and Hermitian matrices are processed via a fused kernel that loads every
+// stored element once and uses it for both of its positions in the matrix. In case \a parallel
+// is \a true and more than one thread is available, the rows (or columns) are split into parts
+// of approximately the same number of packed elements, which are processed concurrently. For
+// symmetric and Hermitian matrices each part accumulates into a private vector.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< bool TF         // Transpose flag of the vector operands
+        , typename T1     // Element type of the target vector
+        , typename T2 >   // Element type of the right-hand side vector
+inline void PackedMatrix<MT>::mult( T1* y, const T2* x, bool parallel ) const
+{
+   // Rows of the stored triangle (true) or columns of the stored triangle (false)
+   const bool direct( SO == TF );
+
+   const size_t parts( ( parallel && getNumThreads() > 1UL && !isSerialSectionActive() )
+                       ?( getNumThreads() * 2UL ):( 1UL ) );
+
+   if( SF )
+   {
+      if( parts == 1UL ) {
+         symmetricKernel<SO!=TF>( y, x, 0UL, n_ );
+         return;
+      }
+
+      std::vector< std::vector<T1> > partial( parts-1UL );
+
+      smpFor( 0UL, parts, [&]( size_t first, size_t last ) {
+         for( size_t p=first; p<last; ++p ) {
+            const size_t begin( split( p    , parts, true ) );
+            const size_t end  ( split( p+1UL, parts, true ) );
+            if( p == 0UL ) {
+               symmetricKernel<SO!=TF>( y, x, begin, end );
+            }
+            else {
+               partial[p-1UL].assign( end, T1() );
+               symmetricKernel<SO!=TF>( partial[p-1UL].data(), x, begin, end );
+            }
+         }
+      } );
+
+      for( size_t p=0UL; p<partial.size(); ++p ) {
+         const size_t size( partial[p].size() );
+         for( size_t i=0UL; i<size; ++i ) {
+            y[i] += partial[p][i];
+         }
+      }
+   }
+   else if( direct )
+   {
+      if( parts == 1UL ) {
+         lineKernel( y, x, 0UL, n_ );
+         return;
+      }
+
+      smpFor( 0UL, parts, [&]( size_t first, size_t last ) {
+         for( size_t p=first; p<last; ++p ) {
+            lineKernel( y, x, split( p, parts, LF ), split( p+1UL, parts, LF ) );
+         }
+      } );
+   }
+   else
+   {
+      if( parts == 1UL ) {
+         stripKernel( y, x, 0UL, n_ );
+         return;
+      }
+
+      smpFor( 0UL, parts, [&]( size_t first, size_t last ) {
+         for( size_t p=first; p<last; ++p ) {
+            stripKernel( y, x, split( p, parts, !LF ), split( p+1UL, parts, !LF ) );
+         }
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place solution of the triangular system \f$ A*\vec{x}=\vec{b} \f$.
+//
+// \param b Contiguous storage of the right-hand side vector, overwritten by the solution.
+// \return void
+//
+// This function performs a forward (lower matrices) or backward (upper matrices) substitution.
+// Row-major matrices are processed row by row via dot products, column-major matrices column
+// by column via vector updates, such that in both cases the packed elements are traversed
+// contiguously.
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized solution of triangular systems. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename T >   // Element type of the right-hand side vector
+inline void PackedMatrix<MT>::solve( T* b ) const
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+
+   if( IsLower<MT>::value )
+   {
+      for( size_t k=0UL; k<n_; ++k )
+      {
+         const Type* line( v_.data() + offset( k ) );
+
+         if( !SO ) {
+            b[k] -= dot<T>( line, b, k );
+            if( !UF ) b[k] /= line[k];
+         }
+         else {
+            if( !UF ) b[k] /= line[0];
+            axpy( b+k+1UL, line+1UL, T( -b[k] ), n_-k-1UL );
+         }
+      }
+   }
+   else
+   {
+      for( size_t k=n_; k-->0UL; )
+      {
+         const Type* line( v_.data() + offset( k ) );
+
+         if( !SO ) {
+            b[k] -= dot<T>( line+1UL, b+k+1UL, n_-k-1UL );
+            if( !UF ) b[k] /= line[0];
+         }
+         else {
+            if( !UF ) b[k] /= line[k];
+            axpy( b, line, T( -b[k] ), k );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused multiplication kernel for symmetric and Hermitian matrices.
+//
+// \param y Contiguous storage of the target vector.
+// \param x Contiguous storage of the right-hand side vector.
+// \param begin The index of the first row/column of the stored triangle.
+// \param end The index one past the last row/column of the stored triangle.
+// \return void
+//
+// This function processes the rows/columns \a begin to \a end of the stored triangle. Each
+// stored off-diagonal element contributes to two elements of \a y, in case of Hermitian
+// matrices once via its conjugate (CF=false: the conjugate is used for the mirrored element,
+// CF=true: the conjugate is used for the stored element).
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< bool CF         // Conjugation flag
+        , typename T1     // Element type of the target vector
+        , typename T2 >   // Element type of the right-hand side vector
+inline void PackedMatrix<MT>::symmetricKernel( T1* y, const T2* x, size_t begin, size_t end ) const
+{
+   for( size_t k=begin; k<end; ++k ) {
+      const Type* line( v_.data() + offset( k ) );
+      y[k] += dotAxpy<CF>( y, line, x, x[k], k ) + line[k] * x[k];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication kernel for the rows/columns of the stored triangle.
+//
+// \param y Contiguous storage of the target vector.
+// \param x Contiguous storage of the right-hand side vector.
+// \param begin The index of the first row/column of the stored triangle.
+// \param end The index one past the last row/column of the stored triangle.
+// \return void
+//
+// This function computes the elements \a begin to \a end of \a y as dot products of the
+// according rows/columns of the stored triangle with \a x.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename T1     // Element type of the target vector
+        , typename T2 >   // Element type of the right-hand side vector
+inline void PackedMatrix<MT>::lineKernel( T1* y, const T2* x, size_t begin, size_t end ) const
+{
+   for( size_t k=begin; k<end; ++k ) {
+      const Type* line( v_.data() + offset( k ) );
+      y[k] = ( LF )?( dot<T1>( line, x, k+1UL ) ):( dot<T1>( line, x+k, n_-k ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication kernel for the transpose of the stored triangle.
+//
+// \param y Contiguous storage of the target vector.
+// \param x Contiguous storage of the right-hand side vector.
+// \param begin The index of the first element of \a y to be computed.
+// \param end The index one past the last element of \a y to be computed.
+// \return void
+//
+// This function computes the elements \a begin to \a end of \a y by adding the according
+// segments of all rows/columns of the stored triangle, scaled by the according element of
+// \a x. Each segment is stored contiguously.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename T1     // Element type of the target vector
+        , typename T2 >   // Element type of the right-hand side vector
+inline void PackedMatrix<MT>::stripKernel( T1* y, const T2* x, size_t begin, size_t end ) const
+{
+   if( begin >= end )
+      return;
+
+   if( LF ) {
+      for( size_t k=begin; k<n_; ++k ) {
+         const size_t last( ( k < end )?( k+1UL ):( end ) );
+         axpy( y+begin, v_.data()+offset(k)+begin, x[k], last-begin );
+      }
+   }
+   else {
+      for( size_t k=0UL; k<end; ++k ) {
+         const size_t first( ( k > begin )?( k ):( begin ) );
+         axpy( y+first, v_.data()+offset(k)+(first-k), x[k], end-first );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default dot product of a segment of the packed storage and a vector segment.
+//
+// \param a The first packed element of the segment.
+// \param x The first element of the vector segment.
+// \param n The number of elements of the segment.
+// \return The resulting dot product.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename T1     // Type of the result
+        , typename T2 >   // Element type of the vector
+inline DisableIf_< typename PackedMatrix<MT>::template VectorizedKernel<T1,T2>, T1 >
+   PackedMatrix<MT>::dot( const Type* a, const T2* x, size_t n ) noexcept
+{
+   T1 sum = T1();
+
+   for( size_t j=0UL; j<n; ++j ) {
+      sum += a[j] * x[j];
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized dot product of a segment of the packed storage and a vector segment.
+//
+// \param a The first packed element of the segment.
+// \param x The first element of the vector segment.
+// \param n The number of elements of the segment.
+// \return The resulting dot product.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename T1     // Type of the result
+        , typename T2 >   // Element type of the vector
+inline EnableIf_< typename PackedMatrix<MT>::template VectorizedKernel<T1,T2>, T1 >
+   PackedMatrix<MT>::dot( const Type* a, const T2* x, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   SIMDType xmm1, xmm2;
+   size_t j( 0UL );
+
+   for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
+      xmm1 += loadu( a+j          ) * loadu( x+j          );
+      xmm2 += loadu( a+j+SIMDSIZE ) * loadu( x+j+SIMDSIZE );
+   }
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      xmm1 += loadu( a+j ) * loadu( x+j );
+   }
+
+   T1 sum( blaze::sum( xmm1 + xmm2 ) );
+
+   for( ; j<n; ++j ) {
+      sum += a[j] * x[j];
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default update of a vector segment with a scaled segment of the packed storage.
+//
+// \param y The first element of the target vector segment.
+// \param a The first packed element of the segment.
+// \param alpha The scaling factor.
+// \param n The number of elements of the segment.
+// \return void
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename T1     // Element type of the target vector
+        , typename T2 >   // Type of the scaling factor
+inline DisableIf_< typename PackedMatrix<MT>::template VectorizedKernel<T1,T2> >
+   PackedMatrix<MT>::axpy( T1* y, const Type* a, T2 alpha, size_t n ) noexcept
+{
+   for( size_t j=0UL; j<n; ++j ) {
+      y[j] += a[j] * alpha;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized update of a vector segment with a scaled segment of the packed storage.
+//
+// \param y The first element of the target vector segment.
+// \param a The first packed element of the segment.
+// \param alpha The scaling factor.
+// \param n The number of elements of the segment.
+// \return void
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< typename T1     // Element type of the target vector
+        , typename T2 >   // Type of the scaling factor
+inline EnableIf_< typename PackedMatrix<MT>::template VectorizedKernel<T1,T2> >
+   PackedMatrix<MT>::axpy( T1* y, const Type* a, T2 alpha, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   const SIMDType factor( set( alpha ) );
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      storeu( y+j, loadu( y+j ) + loadu( a+j ) * factor );
+   }
+   for( ; j<n; ++j ) {
+      y[j] += a[j] * alpha;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default fused dot product and update for a segment of the packed storage.
+//
+// \param y The first element of the target vector segment to be updated.
+// \param a The first packed element of the segment.
+// \param x The first element of the vector segment for the dot product.
+// \param alpha The scaling factor for the update.
+// \param n The number of elements of the segment.
+// \return The resulting dot product.
+//
+// This function computes the dot product of the segment with \a x and adds the segment, scaled
+// by \a alpha, to \a y in a single pass over the packed elements. In case of Hermitian matrices
+// the conjugate elements are used for the dot product (CF=true) or the update (CF=false).
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< bool CF         // Conjugation flag
+        , typename T1     // Element type of the target vector
+        , typename T2 >   // Element type of the right-hand side vector
+inline DisableIf_< typename PackedMatrix<MT>::template VectorizedKernel<T1,T2>, T1 >
+   PackedMatrix<MT>::dotAxpy( T1* y, const Type* a, const T2* x, T2 alpha, size_t n ) noexcept
+{
+   T1 sum = T1();
+
+   for( size_t j=0UL; j<n; ++j ) {
+      const Type value( HF ? conj( a[j] ) : a[j] );
+      sum  += ( CF ? value : a[j] ) * x[j];
+      y[j] += ( CF ? a[j] : value ) * alpha;
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized fused dot product and update for a segment of the packed storage.
+//
+// \param y The first element of the target vector segment to be updated.
+// \param a The first packed element of the segment.
+// \param x The first element of the vector segment for the dot product.
+// \param alpha The scaling factor for the update.
+// \param n The number of elements of the segment.
+// \return The resulting dot product.
+//
+// This function computes the dot product of the segment with \a x and adds the segment, scaled
+// by \a alpha, to \a y in a single pass over the packed elements.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+template< bool CF         // Conjugation flag
+        , typename T1     // Element type of the target vector
+        , typename T2 >   // Element type of the right-hand side vector
+inline EnableIf_< typename PackedMatrix<MT>::template VectorizedKernel<T1,T2>, T1 >
+   PackedMatrix<MT>::dotAxpy( T1* y, const Type* a, const T2* x, T2 alpha, size_t n ) noexcept
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t jpos( n & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( n - ( n % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   const SIMDType factor( set( alpha ) );
+   SIMDType xmm1, xmm2;
+   size_t j( 0UL );
+
+   for( ; (j+SIMDSIZE) < jpos; j+=SIMDSIZE*2UL ) {
+      const SIMDType a1( loadu( a+j          ) );
+      const SIMDType a2( loadu( a+j+SIMDSIZE ) );
+      xmm1 += a1 * loadu( x+j          );
+      xmm2 += a2 * loadu( x+j+SIMDSIZE );
+      storeu( y+j         , loadu( y+j          ) + a1 * factor );
+      storeu( y+j+SIMDSIZE, loadu( y+j+SIMDSIZE ) + a2 * factor );
+   }
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      const SIMDType a1( loadu( a+j ) );
+      xmm1 += a1 * loadu( x+j );
+      storeu( y+j, loadu( y+j ) + a1 * factor );
+   }
+
+   T1 sum( blaze::sum( xmm1 + xmm2 ) );
+
+   for( ; j<n; ++j ) {
+      sum  += a[j] * x[j];
+      y[j] += a[j] * alpha;
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedMatrix operators */
+//@{
+template< typename MT >
+inline void reset( PackedMatrix<MT>& m );
+
+template< typename MT >
+inline void clear( PackedMatrix<MT>& m );
+
+template< bool RF, typename MT >
+inline bool isDefault( const PackedMatrix<MT>& m );
+
+template< typename MT >
+inline bool isIntact( const PackedMatrix<MT>& m );
+
+template< typename MT >
+inline void swap( PackedMatrix<MT>& a, PackedMatrix<MT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline void reset( PackedMatrix<MT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given packed matrix.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline void clear( PackedMatrix<MT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given packed matrix is in default state.
+// \ingroup packed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the packed matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::PackedMatrix< blaze::SymmetricMatrix< blaze::DynamicMatrix<double> > > A;
+   // ... Initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+*/
+template< bool RF        // Relaxation flag
+        , typename MT >  // Type of the adapted dense matrix
+inline bool isDefault( const PackedMatrix<MT>& m )
+{
+   return ( m.rows() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given packed matrix are intact.
+// \ingroup packed_matrix
+//
+// \param m The packed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline bool isIntact( const PackedMatrix<MT>& m )
+{
+   return ( m.capacity() == m.rows()*(m.rows()+1UL)/2UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two packed matrices.
+// \ingroup packed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename MT >  // Type of the adapted dense matrix
+inline void swap( PackedMatrix<MT>& a, PackedMatrix<MT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of a packed matrix with a dense vector.
+// \ingroup packed_matrix
+//
+// \param A The packed matrix.
+// \param x The right-hand side dense vector.
+// \param parallel \a true in case the multiplication may be executed in parallel.
+// \return The resulting vector.
+//
+// This function computes the product \f$ A*\vec{x} \f$ (for column vectors) or
+// \f$ \vec{x}^T*A \f$ (for row vectors). In case \a x does not provide contiguous storage,
+// \a x is copied into a temporary vector first.
+*/
+template< typename MT  // Type of the adapted dense matrix
+        , typename VT  // Type of the right-hand side dense vector
+        , bool TF >    // Transpose flag of the vectors
+inline DynamicVector< MultTrait_< ElementType_<MT>, ElementType_<VT> >, TF >
+   packedmv( const PackedMatrix<MT>& A, const DenseVector<VT,TF>& x, bool parallel )
+{
+   BLAZE_INTERNAL_ASSERT( (~x).size() == A.columns(), "Invalid vector size" );
+
+   using XET = ElementType_<VT>;
+   using ET  = MultTrait_< ElementType_<MT>, XET >;
+
+   using XT = IfTrue_< HasConstDataAccess<VT>::value && !IsView<VT>::value
+                     , const VT&
+                     , const DynamicVector<XET,TF> >;
+
+   XT px( ~x );  // Contiguous storage of the right-hand side dense vector
+
+   DynamicVector<ET,TF> y( A.rows(), ET() );
+   A.template mult<TF>( y.data(), px.data(), parallel );
+
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial multiplication of a packed matrix with a dense vector.
+// \ingroup packed_matrix
+//
+// \param y The target dense vector.
+// \param A The packed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function computes the product \f$ A*\vec{x} \f$ (for column vectors) or
+// \f$ \vec{x}^T*A \f$ (for row vectors) and, depending on \a OP, assigns it to (0), adds it to
+// (1) or subtracts it from (2) the dense vector \a y.
+*/
+template< size_t OP      // Type of the operation
+        , typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the adapted dense matrix
+        , typename VT2   // Type of the right-hand side dense vector
+        , bool TF >      // Transpose flag of the vectors
+inline void pmv( DenseVector<VT1,TF>& y, const PackedMatrix<MT>& A, const DenseVector<VT2,TF>& x )
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows(), "Invalid vector size" );
+
+   const auto tmp( packedmv( A, ~x, false ) );
+
+   if( OP == 0UL )
+      assign( ~y, tmp );
+   else if( OP == 1UL )
+      addAssign( ~y, tmp );
+   else
+      subAssign( ~y, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP multiplication of a packed matrix with a dense vector.
+// \ingroup packed_matrix
+//
+// \param y The target dense vector.
+// \param A The packed matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function computes the product \f$ A*\vec{x} \f$ (for column vectors) or
+// \f$ \vec{x}^T*A \f$ (for row vectors) and, depending on \a OP, assigns it to (0), adds it to
+// (1) or subtracts it from (2) the dense vector \a y. In case the number of rows exceeds the
+// \c SMP_DMATDVECMULT_THRESHOLD, the rows (or columns) of the stored triangle are distributed
+// among the available threads.
+*/
+template< size_t OP      // Type of the operation
+        , typename VT1   // Type of the target dense vector
+        , typename MT    // Type of the adapted dense matrix
+        , typename VT2   // Type of the right-hand side dense vector
+        , bool TF >      // Transpose flag of the vectors
+inline void smpPmv( DenseVector<VT1,TF>& y, const PackedMatrix<MT>& A,
+                    const DenseVector<VT2,TF>& x )
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows(), "Invalid vector size" );
+
+   const auto tmp( packedmv( A, ~x, A.canSMPAssign() ) );
+
+   if( OP == 0UL )
+      smpAssign( ~y, tmp );
+   else if( OP == 1UL )
+      smpAddAssign( ~y, tmp );
+   else
+      smpSubAssign( ~y, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIANGULAR SYSTEMS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Solution of a triangular system in packed storage (\f$ A*\vec{x}=\vec{b} \f$).
+// \ingroup packed_matrix
+//
+// \param A The triangular system matrix.
+// \param b The right-hand side vector, overwritten by the solution vector.
+// \return void
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// This function solves the triangular system \f$ A*\vec{x}=\vec{b} \f$ by means of a forward
+// (lower matrices) or backward (upper matrices) substitution, which only reads the packed
+// elements of \a A. The solution is written to \a b. In case the size of \a b does not match
+// the size of \a A, a \a std::invalid_argument exception is thrown. Note that the function
+// can only be used with lower, unilower, upper and uniupper matrices; any attempt to use it
+// with symmetric, Hermitian or strictly triangular matrices results in a compilation error.
+// In case the system matrix is singular, the result is undefined.
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::LowerMatrix;
+   using blaze::PackedMatrix;
+
+   LowerMatrix< DynamicMatrix<double> > L;
+   // ... Initialization
+
+   const PackedMatrix< LowerMatrix< DynamicMatrix<double> > > P( L );
+
+   DynamicVector<double> b;
+   // ... Initialization
+
+   trsv( P, b );  // Computes the solution of L*x=b in-place
+   \endcode
+*/
+template< typename MT    // Type of the adapted dense matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline void trsv( const PackedMatrix<MT>& A, DenseVector<VT,false>& b )
+{
+   BLAZE_CONSTRAINT_MUST_BE_TRIANGULAR_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_STRICTLY_TRIANGULAR_MATRIX_TYPE( MT );
+
+   if( A.rows() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   DynamicVector< ElementType_<VT>, false > x( ~b );
+   A.solve( x.data() );
+   ~b = x;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPACKEDMATRIX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct IsPackedMatrix< PackedMatrix<MT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSQUARE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct IsSquare< PackedMatrix<MT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSYMMETRIC SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct IsSymmetric< PackedMatrix<MT> >
+   : public BoolConstant< IsSymmetric<MT>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISHERMITIAN SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct IsHermitian< PackedMatrix<MT> >
+   : public BoolConstant< IsHermitian<MT>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct IsLower< PackedMatrix<MT> >
+   : public BoolConstant< IsLower<MT>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUNILOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct IsUniLower< PackedMatrix<MT> >
+   : public BoolConstant< IsUniLower<MT>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSTRICTLYLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct IsStrictlyLower< PackedMatrix<MT> >
+   : public BoolConstant< IsStrictlyLower<MT>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct IsUpper< PackedMatrix<MT> >
+   : public BoolConstant< IsUpper<MT>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUNIUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct IsUniUpper< PackedMatrix<MT> >
+   : public BoolConstant< IsUniUpper<MT>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSTRICTLYUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct IsStrictlyUpper< PackedMatrix<MT> >
+   : public BoolConstant< IsStrictlyUpper<MT>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct SubmatrixTrait< PackedMatrix<MT> >
+{
+   using Type = SubmatrixTrait_<MT>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct RowTrait< PackedMatrix<MT> >
+{
+   using Type = RowTrait_<MT>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT >
+struct ColumnTrait< PackedMatrix<MT> >
+{
+   using Type = ColumnTrait_<MT>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -49,6 +49,7 @@
 #include <blaze/math/constraints/StrictlyTriangular.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
+#include <blaze/math/dense/BlockedDecomposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/geqrf.h>
@@ -57,6 +58,7 @@
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/views/Submatrix.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/EnableIf.h>
 
@@ -94,7 +96,11 @@ template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsBuiltin< ElementType_<MT1> > >
    qr_backend( MT1& A, const ElementType_<MT1>* tau )
 {
+#if BLAZE_LAPACK_MODE
    orgqr( A, tau );
+#else
+   blockedUngqr( A, tau );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -116,7 +122,11 @@ template< typename MT1 >  // Type of matrix A
 inline EnableIf_<IsComplex< ElementType_<MT1> > >
    qr_backend( MT1& A, const ElementType_<MT1>* tau )
 {
+#if BLAZE_LAPACK_MODE
    ungqr( A, tau );
+#else
+   blockedUngqr( A, tau );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -211,7 +221,11 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    if( m < n )
    {
       r = A;
+#if BLAZE_LAPACK_MODE
       geqrf( r, tau.get() );
+#else
+      blockedGeqrf( r, tau.get() );
+#endif
       (~Q) = submatrix( r, 0UL, 0UL, m, m );
       qr_backend( ~Q, tau.get() );
 
@@ -224,7 +238,11 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    else
    {
       (~Q) = A;
+#if BLAZE_LAPACK_MODE
       geqrf( ~Q, tau.get() );
+#else
+      blockedGeqrf( ~Q, tau.get() );
+#endif
 
       resize( ~R, n, n, false );
       reset( r );
@@ -0,0 +1,305 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/TensorMult.h
+//  \brief Header file for the batched multiplication of dense tensors
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_DENSE_TENSORMULT_H_
+#define _BLAZE_MATH_DENSE_TENSORMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicTensor.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseTensor.h>
+#include <blaze/math/expressions/DMatSerialExpr.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/views/PageSlice.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BATCHED MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given page kernel for all pages of a batched product.
+// \ingroup dense_tensor
+//
+// \param o The number of pages of the target tensor.
+// \param m The number of rows of the target tensor.
+// \param n The number of columns of the target tensor.
+// \param kernel The kernel to be executed for a single page.
+// \return void
+//
+// This function executes the given \a kernel for all \a o pages of an \f$ o \times m \times n \f$
+// target tensor. In case the single pages are too small to be parallelized by themselves (i.e.
+// below the SMP_DMATDMATMULT_THRESHOLD) the pages are distributed among the available threads
+// and each page product is evaluated serially. Otherwise the pages are processed one after
+// another and each page product is parallelized by the dense matrix multiplication itself.
+// The kernel is called with the page index and a flag indicating serial execution.
+*/
+template< typename Kernel >  // Type of the page kernel
+inline void dtensMultFor( size_t o, size_t m, size_t n, const Kernel& kernel )
+{
+   if( o > 1UL && m*n < SMP_DMATDMATMULT_THRESHOLD && o*m*n >= SMP_DMATDMATMULT_THRESHOLD ) {
+      smpFor( 0UL, o, [&]( size_t first, size_t last ) {
+         for( size_t k=first; k<last; ++k )
+            kernel( k, true );
+      } );
+   }
+   else {
+      for( size_t k=0UL; k<o; ++k )
+         kernel( k, false );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Batched multiplication of two dense tensors (\f$ C_k=A_k*B_k \f$).
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor for the batched multiplication.
+// \param rhs The right-hand side dense tensor for the batched multiplication.
+// \return The resulting tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// This operator computes the page-wise matrix product of two dense tensors, i.e. the \a k-th page
+// of the resulting \f$ O \times M \times N \f$ tensor is the product of the \a k-th page of the
+// \f$ O \times M \times K \f$ tensor \a lhs and the \a k-th page of the \f$ O \times K \times N \f$
+// tensor \a rhs:
+
+   \code
+   blaze::DynamicTensor<double> A( 16UL, 10UL, 20UL ), B( 16UL, 20UL, 30UL ), C;
+   // ... Initialization
+
+   C = A * B;  // 16 products of a 10x20 and a 20x30 matrix
+   \endcode
+
+// In contrast to the matrix products, the batched product is evaluated immediately. All page
+// products are computed by the dense matrix multiplication kernels (including the BLAS kernels,
+// if enabled). In case the single page products are small, the pages are processed in parallel.
+// In case the number of pages of the two tensors or the inner dimensions don't match, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+inline const DynamicTensor< MultTrait_< ElementType_<TT1>, ElementType_<TT2> > >
+   operator*( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_< ElementType_<TT1>, ElementType_<TT2> >;
+
+   if( (~lhs).pages() != (~rhs).pages() || (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   If_< IsExpression<TT1>, const ResultType_<TT1>, const TT1& > A( ~lhs );  // Evaluation of the left-hand side operand
+   If_< IsExpression<TT2>, const ResultType_<TT2>, const TT2& > B( ~rhs );  // Evaluation of the right-hand side operand
+
+   const size_t o( A.pages() );
+   const size_t m( A.rows() );
+   const size_t n( B.columns() );
+
+   DynamicTensor<ET> C( o, m, n );
+
+   if( m == 0UL || n == 0UL )
+      return C;
+
+   if( A.columns() == 0UL ) {
+      reset( C );
+      return C;
+   }
+
+   dtensMultFor( o, m, n, [&]( size_t k, bool isSerial ) {
+      auto Ck( pageslice( C, k ) );
+      if( isSerial )
+         Ck = serial( pageslice( A, k ) * pageslice( B, k ) );
+      else
+         Ck = pageslice( A, k ) * pageslice( B, k );
+   } );
+
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of all pages of a dense tensor with a dense matrix (\f$ C_k=A_k*B \f$).
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor for the multiplication.
+// \param rhs The right-hand side dense matrix for the multiplication.
+// \return The resulting tensor.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator multiplies each page of the \f$ O \times M \times K \f$ tensor \a lhs with the
+// \f$ K \times N \f$ matrix \a rhs. Since the pages of a tensor are stored consecutively, the
+// pages of the tensor form a single \f$ (O \cdot M) \times K \f$ row-major matrix and the batched
+// product is computed by a single (and, if large enough, parallel) matrix multiplication. In
+// case the number of columns of the tensor doesn't match the number of rows of the matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename TT  // Type of the left-hand side dense tensor
+        , typename MT  // Type of the right-hand side dense matrix
+        , bool SO >    // Storage order of the right-hand side dense matrix
+inline const DynamicTensor< MultTrait_< ElementType_<TT>, ElementType_<MT> > >
+   operator*( const DenseTensor<TT>& lhs, const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET  = MultTrait_< ElementType_<TT>, ElementType_<MT> >;
+   using RT  = DynamicTensor<ET>;
+   using TMP = If_< IsExpression<TT>, const ResultType_<TT>, const TT& >;
+   using OT  = RemoveReference_<TMP>;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   TMP A( ~lhs );  // Evaluation of the left-hand side operand
+
+   const size_t o( A.pages() );
+   const size_t m( A.rows() );
+   const size_t n( (~rhs).columns() );
+
+   RT C( o, m, n );
+
+   if( o == 0UL || m == 0UL || n == 0UL )
+      return C;
+
+   if( A.columns() == 0UL ) {
+      reset( C );
+      return C;
+   }
+
+   const CustomMatrix< ElementType_<TT>, IsAligned<OT>::value, IsPadded<OT>::value, rowMajor >
+      AA( const_cast<ElementType_<TT>*>( A.data() ), o*m, A.columns(), A.spacing() );
+
+   CustomMatrix< ET, IsAligned<RT>::value, IsPadded<RT>::value, rowMajor >
+      CC( C.data(), o*m, n, C.spacing() );
+
+   CC = AA * (~rhs);
+
+   return C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a dense matrix with all pages of a dense tensor (\f$ C_k=A*B_k \f$).
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense matrix for the multiplication.
+// \param rhs The right-hand side dense tensor for the multiplication.
+// \return The resulting tensor.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator multiplies the \f$ M \times K \f$ matrix \a lhs with each page of the
+// \f$ O \times K \times N \f$ tensor \a rhs. In case the number of columns of the matrix doesn't
+// match the number of rows of the tensor, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , bool SO      // Storage order of the left-hand side dense matrix
+        , typename TT >  // Type of the right-hand side dense tensor
+inline const DynamicTensor< MultTrait_< ElementType_<MT>, ElementType_<TT> > >
+   operator*( const DenseMatrix<MT,SO>& lhs, const DenseTensor<TT>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = MultTrait_< ElementType_<MT>, ElementType_<TT> >;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_<MT> A( ~lhs );  // Evaluation of the left-hand side operand
+   If_< IsExpression<TT>, const ResultType_<TT>, const TT& > B( ~rhs );  // Evaluation of the right-hand side operand
+
+   const size_t o( B.pages() );
+   const size_t m( A.rows() );
+   const size_t n( B.columns() );
+
+   DynamicTensor<ET> C( o, m, n );
+
+   if( m == 0UL || n == 0UL )
+      return C;
+
+   if( A.columns() == 0UL ) {
+      reset( C );
+      return C;
+   }
+
+   dtensMultFor( o, m, n, [&]( size_t k, bool isSerial ) {
+      auto Ck( pageslice( C, k ) );
+      if( isSerial )
+         Ck = serial( A * pageslice( B, k ) );
+      else
+         Ck = A * pageslice( B, k );
+   } );
+
+   return C;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,634 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Transpose.h
+//  \brief Header file for the blocked and in-place dense matrix transposition kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_TRANSPOSE_H_
+#define _BLAZE_MATH_DENSE_TRANSPOSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  REGISTER BLOCK KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the transposition of square register blocks.
+// \ingroup dense_matrix
+//
+// The TransposeKernel class template transposes square blocks of \a size x \a size elements of
+// type \a T within SIMD registers. Since the SIMD kernels only move bit patterns, they apply to
+// all numeric element types of 4 and 8 bytes (i.e. to \c float, \c double, 32- and 64-bit
+// integers, and \c complex<float>). For all other element types and in case no suitable
+// instruction set is available, the kernel operates on single elements.
+*/
+template< typename T                                              // Element type
+        , size_t N = ( IsNumeric<T>::value ? sizeof(T) : 0UL ) >  // Size of the SIMD elements
+struct TransposeKernel
+{
+   enum : size_t { size = 1UL };
+
+   static BLAZE_ALWAYS_INLINE void transpose( const T* A, size_t, T* B, size_t ) {
+      *B = *A;
+   }
+
+   static BLAZE_ALWAYS_INLINE void swap( T* A, T* B, size_t ) {
+      using std::swap;
+      swap( *A, *B );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_AVX_MODE
+template< typename T >  // Element type
+struct TransposeKernel<T,4UL>
+{
+   enum : size_t { size = 8UL };
+
+   static BLAZE_ALWAYS_INLINE void transpose( __m256& r0, __m256& r1, __m256& r2, __m256& r3,
+                                              __m256& r4, __m256& r5, __m256& r6, __m256& r7 ) noexcept
+   {
+      const __m256 t0( _mm256_unpacklo_ps( r0, r1 ) );
+      const __m256 t1( _mm256_unpackhi_ps( r0, r1 ) );
+      const __m256 t2( _mm256_unpacklo_ps( r2, r3 ) );
+      const __m256 t3( _mm256_unpackhi_ps( r2, r3 ) );
+      const __m256 t4( _mm256_unpacklo_ps( r4, r5 ) );
+      const __m256 t5( _mm256_unpackhi_ps( r4, r5 ) );
+      const __m256 t6( _mm256_unpacklo_ps( r6, r7 ) );
+      const __m256 t7( _mm256_unpackhi_ps( r6, r7 ) );
+
+      const __m256 s0( _mm256_shuffle_ps( t0, t2, 0x44 ) );
+      const __m256 s1( _mm256_shuffle_ps( t0, t2, 0xEE ) );
+      const __m256 s2( _mm256_shuffle_ps( t1, t3, 0x44 ) );
+      const __m256 s3( _mm256_shuffle_ps( t1, t3, 0xEE ) );
+      const __m256 s4( _mm256_shuffle_ps( t4, t6, 0x44 ) );
+      const __m256 s5( _mm256_shuffle_ps( t4, t6, 0xEE ) );
+      const __m256 s6( _mm256_shuffle_ps( t5, t7, 0x44 ) );
+      const __m256 s7( _mm256_shuffle_ps( t5, t7, 0xEE ) );
+
+      r0 = _mm256_permute2f128_ps( s0, s4, 0x20 );
+      r1 = _mm256_permute2f128_ps( s1, s5, 0x20 );
+      r2 = _mm256_permute2f128_ps( s2, s6, 0x20 );
+      r3 = _mm256_permute2f128_ps( s3, s7, 0x20 );
+      r4 = _mm256_permute2f128_ps( s0, s4, 0x31 );
+      r5 = _mm256_permute2f128_ps( s1, s5, 0x31 );
+      r6 = _mm256_permute2f128_ps( s2, s6, 0x31 );
+      r7 = _mm256_permute2f128_ps( s3, s7, 0x31 );
+   }
+
+   static BLAZE_ALWAYS_INLINE void load( const T* A, size_t lda, __m256& r0, __m256& r1, __m256& r2, __m256& r3,
+                                         __m256& r4, __m256& r5, __m256& r6, __m256& r7 ) noexcept
+   {
+      const float* a( reinterpret_cast<const float*>( A ) );
+
+      r0 = _mm256_loadu_ps( a       );
+      r1 = _mm256_loadu_ps( a+  lda );
+      r2 = _mm256_loadu_ps( a+2*lda );
+      r3 = _mm256_loadu_ps( a+3*lda );
+      r4 = _mm256_loadu_ps( a+4*lda );
+      r5 = _mm256_loadu_ps( a+5*lda );
+      r6 = _mm256_loadu_ps( a+6*lda );
+      r7 = _mm256_loadu_ps( a+7*lda );
+   }
+
+   static BLAZE_ALWAYS_INLINE void store( T* B, size_t ldb, __m256 r0, __m256 r1, __m256 r2, __m256 r3,
+                                          __m256 r4, __m256 r5, __m256 r6, __m256 r7 ) noexcept
+   {
+      float* b( reinterpret_cast<float*>( B ) );
+
+      _mm256_storeu_ps( b      , r0 );
+      _mm256_storeu_ps( b+  ldb, r1 );
+      _mm256_storeu_ps( b+2*ldb, r2 );
+      _mm256_storeu_ps( b+3*ldb, r3 );
+      _mm256_storeu_ps( b+4*ldb, r4 );
+      _mm256_storeu_ps( b+5*ldb, r5 );
+      _mm256_storeu_ps( b+6*ldb, r6 );
+      _mm256_storeu_ps( b+7*ldb, r7 );
+   }
+
+   static BLAZE_ALWAYS_INLINE void transpose( const T* A, size_t lda, T* B, size_t ldb ) noexcept
+   {
+      __m256 r0, r1, r2, r3, r4, r5, r6, r7;
+      load( A, lda, r0, r1, r2, r3, r4, r5, r6, r7 );
+      transpose( r0, r1, r2, r3, r4, r5, r6, r7 );
+      store( B, ldb, r0, r1, r2, r3, r4, r5, r6, r7 );
+   }
+
+   static BLAZE_ALWAYS_INLINE void swap( T* A, T* B, size_t ld ) noexcept
+   {
+      __m256 r0, r1, r2, r3, r4, r5, r6, r7;
+      __m256 s0, s1, s2, s3, s4, s5, s6, s7;
+      load( A, ld, r0, r1, r2, r3, r4, r5, r6, r7 );
+      load( B, ld, s0, s1, s2, s3, s4, s5, s6, s7 );
+      transpose( r0, r1, r2, r3, r4, r5, r6, r7 );
+      transpose( s0, s1, s2, s3, s4, s5, s6, s7 );
+      store( B, ld, r0, r1, r2, r3, r4, r5, r6, r7 );
+      store( A, ld, s0, s1, s2, s3, s4, s5, s6, s7 );
+   }
+};
+
+template< typename T >  // Element type
+struct TransposeKernel<T,8UL>
+{
+   enum : size_t { size = 4UL };
+
+   static BLAZE_ALWAYS_INLINE void transpose( __m256d& r0, __m256d& r1, __m256d& r2, __m256d& r3 ) noexcept
+   {
+      const __m256d t0( _mm256_unpacklo_pd( r0, r1 ) );
+      const __m256d t1( _mm256_unpackhi_pd( r0, r1 ) );
+      const __m256d t2( _mm256_unpacklo_pd( r2, r3 ) );
+      const __m256d t3( _mm256_unpackhi_pd( r2, r3 ) );
+
+      r0 = _mm256_permute2f128_pd( t0, t2, 0x20 );
+      r1 = _mm256_permute2f128_pd( t1, t3, 0x20 );
+      r2 = _mm256_permute2f128_pd( t0, t2, 0x31 );
+      r3 = _mm256_permute2f128_pd( t1, t3, 0x31 );
+   }
+
+   static BLAZE_ALWAYS_INLINE void load( const T* A, size_t lda,
+                                         __m256d& r0, __m256d& r1, __m256d& r2, __m256d& r3 ) noexcept
+   {
+      const double* a( reinterpret_cast<const double*>( A ) );
+
+      r0 = _mm256_loadu_pd( a       );
+      r1 = _mm256_loadu_pd( a+  lda );
+      r2 = _mm256_loadu_pd( a+2*lda );
+      r3 = _mm256_loadu_pd( a+3*lda );
+   }
+
+   static BLAZE_ALWAYS_INLINE void store( T* B, size_t ldb,
+                                          __m256d r0, __m256d r1, __m256d r2, __m256d r3 ) noexcept
+   {
+      double* b( reinterpret_cast<double*>( B ) );
+
+      _mm256_storeu_pd( b      , r0 );
+      _mm256_storeu_pd( b+  ldb, r1 );
+      _mm256_storeu_pd( b+2*ldb, r2 );
+      _mm256_storeu_pd( b+3*ldb, r3 );
+   }
+
+   static BLAZE_ALWAYS_INLINE void transpose( const T* A, size_t lda, T* B, size_t ldb ) noexcept
+   {
+      __m256d r0, r1, r2, r3;
+      load( A, lda, r0, r1, r2, r3 );
+      transpose( r0, r1, r2, r3 );
+      store( B, ldb, r0, r1, r2, r3 );
+   }
+
+   static BLAZE_ALWAYS_INLINE void swap( T* A, T* B, size_t ld ) noexcept
+   {
+      __m256d r0, r1, r2, r3, s0, s1, s2, s3;
+      load( A, ld, r0, r1, r2, r3 );
+      load( B, ld, s0, s1, s2, s3 );
+      transpose( r0, r1, r2, r3 );
+      transpose( s0, s1, s2, s3 );
+      store( B, ld, r0, r1, r2, r3 );
+      store( A, ld, s0, s1, s2, s3 );
+   }
+};
+#elif BLAZE_SSE2_MODE
+template< typename T >  // Element type
+struct TransposeKernel<T,4UL>
+{
+   enum : size_t { size = 4UL };
+
+   static BLAZE_ALWAYS_INLINE void load( const T* A, size_t lda,
+                                         __m128& r0, __m128& r1, __m128& r2, __m128& r3 ) noexcept
+   {
+      const float* a( reinterpret_cast<const float*>( A ) );
+
+      r0 = _mm_loadu_ps( a       );
+      r1 = _mm_loadu_ps( a+  lda );
+      r2 = _mm_loadu_ps( a+2*lda );
+      r3 = _mm_loadu_ps( a+3*lda );
+   }
+
+   static BLAZE_ALWAYS_INLINE void store( T* B, size_t ldb,
+                                          __m128 r0, __m128 r1, __m128 r2, __m128 r3 ) noexcept
+   {
+      float* b( reinterpret_cast<float*>( B ) );
+
+      _mm_storeu_ps( b      , r0 );
+      _mm_storeu_ps( b+  ldb, r1 );
+      _mm_storeu_ps( b+2*ldb, r2 );
+      _mm_storeu_ps( b+3*ldb, r3 );
+   }
+
+   static BLAZE_ALWAYS_INLINE void transpose( const T* A, size_t lda, T* B, size_t ldb ) noexcept
+   {
+      __m128 r0, r1, r2, r3;
+      load( A, lda, r0, r1, r2, r3 );
+      _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+      store( B, ldb, r0, r1, r2, r3 );
+   }
+
+   static BLAZE_ALWAYS_INLINE void swap( T* A, T* B, size_t ld ) noexcept
+   {
+      __m128 r0, r1, r2, r3, s0, s1, s2, s3;
+      load( A, ld, r0, r1, r2, r3 );
+      load( B, ld, s0, s1, s2, s3 );
+      _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+      _MM_TRANSPOSE4_PS( s0, s1, s2, s3 );
+      store( B, ld, r0, r1, r2, r3 );
+      store( A, ld, s0, s1, s2, s3 );
+   }
+};
+
+template< typename T >  // Element type
+struct TransposeKernel<T,8UL>
+{
+   enum : size_t { size = 2UL };
+
+   static BLAZE_ALWAYS_INLINE void transpose( const T* A, size_t lda, T* B, size_t ldb ) noexcept
+   {
+      const double* a( reinterpret_cast<const double*>( A ) );
+      double* b( reinterpret_cast<double*>( B ) );
+
+      const __m128d r0( _mm_loadu_pd( a     ) );
+      const __m128d r1( _mm_loadu_pd( a+lda ) );
+
+      _mm_storeu_pd( b    , _mm_unpacklo_pd( r0, r1 ) );
+      _mm_storeu_pd( b+ldb, _mm_unpackhi_pd( r0, r1 ) );
+   }
+
+   static BLAZE_ALWAYS_INLINE void swap( T* A, T* B, size_t ld ) noexcept
+   {
+      double* a( reinterpret_cast<double*>( A ) );
+      double* b( reinterpret_cast<double*>( B ) );
+
+      const __m128d r0( _mm_loadu_pd( a    ) );
+      const __m128d r1( _mm_loadu_pd( a+ld ) );
+      const __m128d s0( _mm_loadu_pd( b    ) );
+      const __m128d s1( _mm_loadu_pd( b+ld ) );
+
+      _mm_storeu_pd( b   , _mm_unpacklo_pd( r0, r1 ) );
+      _mm_storeu_pd( b+ld, _mm_unpackhi_pd( r0, r1 ) );
+      _mm_storeu_pd( a   , _mm_unpacklo_pd( s0, s1 ) );
+      _mm_storeu_pd( a+ld, _mm_unpackhi_pd( s0, s1 ) );
+   }
+};
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a single register block (\f$ B=A^T \f$).
+// \ingroup dense_matrix
+//
+// \param A Pointer to the first element of the source block.
+// \param lda The distance between two consecutive rows of \a A.
+// \param B Pointer to the first element of the target block.
+// \param ldb The distance between two consecutive rows of \a B.
+// \return void
+//
+// This function transposes a square block of TransposeKernel<T>::size rows and columns. Since
+// the entire block is loaded before the first store, \a A and \a B may refer to the same block.
+*/
+template< typename T >  // Element type
+BLAZE_ALWAYS_INLINE void transposeBlock( const T* A, size_t lda, T* B, size_t ldb )
+{
+   TransposeKernel<T>::transpose( A, lda, B, ldb );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swapping transposition of two register blocks (\f$ (A,B)=(B^T,A^T) \f$).
+// \ingroup dense_matrix
+//
+// \param A Pointer to the first element of the first block.
+// \param B Pointer to the first element of the second block.
+// \param ld The distance between two consecutive rows of both \a A and \a B.
+// \return void
+*/
+template< typename T >  // Element type
+BLAZE_ALWAYS_INLINE void swapTransposeBlocks( T* A, T* B, size_t ld )
+{
+   TransposeKernel<T>::swap( A, B, ld );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OUT-OF-PLACE TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a small tile (\f$ B=A^T \f$).
+// \ingroup dense_matrix
+//
+// \param m The number of rows of \a A.
+// \param n The number of columns of \a A.
+// \param A Pointer to the first element of the source tile.
+// \param lda The distance between two consecutive rows of \a A.
+// \param B Pointer to the first element of the target tile.
+// \param ldb The distance between two consecutive rows of \a B.
+// \return void
+*/
+template< typename T >  // Element type
+void transposeTile( size_t m, size_t n, const T* A, size_t lda, T* B, size_t ldb )
+{
+   constexpr size_t S( TransposeKernel<T>::size );
+
+   const size_t mpos( m - m % S );
+   const size_t npos( n - n % S );
+
+   for( size_t i=0UL; i<mpos; i+=S ) {
+      for( size_t j=0UL; j<npos; j+=S ) {
+         transposeBlock( A+i*lda+j, lda, B+j*ldb+i, ldb );
+      }
+   }
+
+   for( size_t i=0UL; i<mpos; ++i ) {
+      for( size_t j=npos; j<n; ++j ) {
+         B[j*ldb+i] = A[i*lda+j];
+      }
+   }
+
+   for( size_t i=mpos; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         B[j*ldb+i] = A[i*lda+j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-oblivious out-of-place transposition of a dense matrix (\f$ B=A^T \f$).
+// \ingroup dense_matrix
+//
+// \param m The number of rows of \a A.
+// \param n The number of columns of \a A.
+// \param A Pointer to the first element of the source matrix.
+// \param lda The distance between two consecutive rows of \a A.
+// \param B Pointer to the first element of the target matrix.
+// \param ldb The distance between two consecutive rows of \a B.
+// \return void
+//
+// This function transposes the row-major \a m x \a n matrix \a A into the row-major \a n x \a m
+// matrix \a B (or, equivalently, the column-major \a n x \a m matrix \a A into the column-major
+// \a m x \a n matrix \a B). The larger of the two dimensions is recursively halved until the
+// tile fits into the L1 cache, independent of the actual cache sizes. Each tile is transposed
+// by means of SIMD register blocks. The two matrices must not overlap.
+*/
+template< typename T >  // Element type
+void blockedTranspose( size_t m, size_t n, const T* A, size_t lda, T* B, size_t ldb )
+{
+   constexpr size_t S   ( TransposeKernel<T>::size );
+   constexpr size_t leaf( 64UL );
+
+   if( m <= leaf && n <= leaf ) {
+      transposeTile( m, n, A, lda, B, ldb );
+   }
+   else if( m >= n ) {
+      const size_t m1( ( m / 2UL ) - ( m / 2UL ) % S );
+      blockedTranspose( m1, n, A, lda, B, ldb );
+      blockedTranspose( m-m1, n, A+m1*lda, lda, B+m1, ldb );
+   }
+   else {
+      const size_t n1( ( n / 2UL ) - ( n / 2UL ) % S );
+      blockedTranspose( m, n1, A, lda, B, ldb );
+      blockedTranspose( m, n-n1, A+n1, lda, B+n1*ldb, ldb );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  IN-PLACE TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a square dense matrix.
+// \ingroup dense_matrix
+//
+// \param n The number of rows and columns of the matrix.
+// \param A Pointer to the first element of the matrix.
+// \param lda The distance between two consecutive rows of \a A.
+// \return void
+//
+// This function transposes the given square matrix in-place by swapping pairs of mirrored
+// tiles. Within the tiles, the transposition is performed by means of SIMD register blocks.
+// For large matrices, the block rows of tiles are processed in parallel.
+*/
+template< typename T >  // Element type
+void squareTranspose( size_t n, T* A, size_t lda )
+{
+   using std::swap;
+
+   constexpr size_t S    ( TransposeKernel<T>::size );
+   constexpr size_t block( 32UL );
+
+   auto kernel = [=]( size_t first, size_t last )
+   {
+      for( size_t ii=first*block; ii<min( last*block, n ); ii+=block )
+      {
+         const size_t iend( min( ii+block, n ) );
+
+         for( size_t jj=0UL; jj<ii; jj+=block )
+         {
+            const size_t jend( min( jj+block, n ) );
+            const size_t ipos( ( S > 1UL )?( iend - ( iend - ii ) % S ):( ii ) );
+            const size_t jpos( ( S > 1UL )?( jend - ( jend - jj ) % S ):( jj ) );
+
+            for( size_t i=ii; i<ipos; i+=S ) {
+               for( size_t j=jj; j<jpos; j+=S ) {
+                  swapTransposeBlocks( A+i*lda+j, A+j*lda+i, lda );
+               }
+               for( size_t k=i; k<i+S; ++k ) {
+                  for( size_t j=jpos; j<jend; ++j ) {
+                     swap( A[k*lda+j], A[j*lda+k] );
+                  }
+               }
+            }
+
+            for( size_t i=ipos; i<iend; ++i ) {
+               for( size_t j=jj; j<jend; ++j ) {
+                  swap( A[i*lda+j], A[j*lda+i] );
+               }
+            }
+         }
+
+         const size_t ipos( ( S > 1UL )?( iend - ( iend - ii ) % S ):( ii ) );
+
+         for( size_t i=ii; i<ipos; i+=S ) {
+            for( size_t j=ii; j<i; j+=S ) {
+               swapTransposeBlocks( A+i*lda+j, A+j*lda+i, lda );
+            }
+            transposeBlock( A+i*lda+i, lda, A+i*lda+i, lda );
+         }
+
+         for( size_t i=ipos; i<iend; ++i ) {
+            for( size_t j=ii; j<i; ++j ) {
+               swap( A[i*lda+j], A[j*lda+i] );
+            }
+         }
+      }
+   };
+
+   const size_t tiles( ( n + block - 1UL ) / block );
+
+   if( n*n < SMP_DMATASSIGN_THRESHOLD )
+      kernel( 0UL, tiles );
+   else
+      smpFor( 0UL, tiles, kernel );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a rectangular dense matrix.
+// \ingroup dense_matrix
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param A Pointer to the first element of the matrix.
+// \param lda The distance between two consecutive rows of the \a m x \a n matrix.
+// \param ldb The distance between two consecutive rows of the transposed \a n x \a m matrix.
+// \return void
+//
+// This function transposes the row-major \a m x \a n matrix stored at \a A in-place into a
+// row-major \a n x \a m matrix with a distance of \a ldb between two rows (or, equivalently,
+// the column-major \a n x \a m matrix into the column-major \a m x \a n matrix). In a first
+// step, the rows are moved together to remove any padding. Then the elements are permuted by
+// following the cycles of the transposition permutation, in which the element at position
+// \f$ p \f$ moves to position \f$ p*m \mod (m*n-1) \f$. The only additional memory is a bit
+// per element to mark the visited positions. Finally the rows are spread to the new distance
+// \a ldb and the padding elements are reset. The given memory must provide space for at least
+// \f$ \max(m*lda,n*ldb) \f$ elements.
+*/
+template< typename T >  // Element type
+void inplaceTranspose( size_t m, size_t n, T* A, size_t lda, size_t ldb )
+{
+   BLAZE_INTERNAL_ASSERT( lda >= n, "Invalid row distance of the source matrix" );
+   BLAZE_INTERNAL_ASSERT( ldb >= m, "Invalid row distance of the target matrix" );
+
+   if( m == 0UL || n == 0UL )
+      return;
+
+   if( lda != n ) {
+      for( size_t i=1UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            A[i*n+j] = std::move( A[i*lda+j] );
+         }
+      }
+   }
+
+   if( m > 1UL && n > 1UL )
+   {
+      const size_t last( m*n - 1UL );
+      std::vector<bool> visited( last, false );
+
+      for( size_t start=1UL; start<last; ++start )
+      {
+         if( visited[start] )
+            continue;
+
+         T tmp( std::move( A[start] ) );
+         size_t pos( start );
+
+         while( true ) {
+            visited[pos] = true;
+            const size_t next( ( pos * n ) % last );
+            if( next == start ) break;
+            A[pos] = std::move( A[next] );
+            pos = next;
+         }
+
+         A[pos] = std::move( tmp );
+      }
+   }
+
+   if( ldb != m ) {
+      for( size_t i=n-1UL; i>0UL; --i ) {
+         for( size_t j=m; j>0UL; --j ) {
+            A[i*ldb+j-1UL] = std::move( A[i*m+j-1UL] );
+         }
+      }
+      for( size_t i=0UL; i<n; ++i ) {
+         for( size_t j=m; j<ldb; ++j ) {
+            A[i*ldb+j] = T();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
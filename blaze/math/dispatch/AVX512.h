@@ -0,0 +1,186 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/AVX512.h
+//  \brief Runtime dispatched compute kernels for the AVX-512F instruction set
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_AVX512_H_
+#define _BLAZE_MATH_DISPATCH_AVX512_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <immintrin.h>
+#include <memory>
+#include <blaze/util/Types.h>
+
+
+
+
+//=================================================================================================
+//
+//  AVX-512F KERNELS
+//
+//=================================================================================================
+
+#if defined(__clang__)
+#  pragma clang attribute push ( __attribute__(( target("avx512f,avx2,fma") )), apply_to = function )
+#else
+#  pragma GCC push_options
+#  pragma GCC target( "avx512f,avx2,fma" )
+#endif
+
+namespace blaze {
+
+namespace dispatch {
+
+namespace avx512 {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Wrapper for the AVX-512F intrinsics used by the runtime dispatched kernels.
+//
+// The Pack class template provides a minimal interface to the AVX-512F intrinsics for single
+// and double precision values. In contrast to the SIMD types of the Blaze library, which are
+// determined by the compilation target, the Pack class template is independent of the compiler
+// flags and therefore enables the compilation of the kernels in Kernels.h for AVX-512F.
+*/
+template< typename T >
+struct Pack;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Pack class template for \c float.
+*/
+template<>
+struct Pack<float>
+{
+   using Type = __m512;  //!< The SIMD type of the instruction set.
+
+   enum : size_t { size = 16UL, rows = 8UL, vectors = 2UL };
+
+   static inline Type load( const float* p ) {
+      return _mm512_loadu_ps( p );
+   }
+
+   static inline void store( float* p, Type a ) {
+      _mm512_storeu_ps( p, a );
+   }
+
+   static inline Type set( float v ) {
+      return _mm512_set1_ps( v );
+   }
+
+   static inline Type zero() {
+      return _mm512_setzero_ps();
+   }
+
+   static inline Type add( Type a, Type b ) {
+      return _mm512_add_ps( a, b );
+   }
+
+   static inline Type fmadd( Type a, Type b, Type c ) {
+      return _mm512_fmadd_ps( a, b, c );
+   }
+
+   static inline float sum( Type a ) {
+      return _mm512_reduce_add_ps( a );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Pack class template for \c double.
+*/
+template<>
+struct Pack<double>
+{
+   using Type = __m512d;  //!< The SIMD type of the instruction set.
+
+   enum : size_t { size = 8UL, rows = 8UL, vectors = 2UL };
+
+   static inline Type load( const double* p ) {
+      return _mm512_loadu_pd( p );
+   }
+
+   static inline void store( double* p, Type a ) {
+      _mm512_storeu_pd( p, a );
+   }
+
+   static inline Type set( double v ) {
+      return _mm512_set1_pd( v );
+   }
+
+   static inline Type zero() {
+      return _mm512_setzero_pd();
+   }
+
+   static inline Type add( Type a, Type b ) {
+      return _mm512_add_pd( a, b );
+   }
+
+   static inline Type fmadd( Type a, Type b, Type c ) {
+      return _mm512_fmadd_pd( a, b, c );
+   }
+
+   static inline double sum( Type a ) {
+      return _mm512_reduce_add_pd( a );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+#include <blaze/math/dispatch/Kernels.h>
+
+} // namespace avx512
+
+} // namespace dispatch
+
+} // namespace blaze
+
+#if defined(__clang__)
+#  pragma clang attribute pop
+#else
+#  pragma GCC pop_options
+#endif
+
+#endif
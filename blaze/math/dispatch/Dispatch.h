@@ -0,0 +1,402 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Dispatch.h
+//  \brief Header file for the runtime CPU dispatch of selected compute kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DISPATCH_DISPATCH_H_
+#define _BLAZE_MATH_DISPATCH_DISPATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/Unused.h>
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+#  include <blaze/math/dispatch/AVX2.h>
+#  include <blaze/math/dispatch/AVX512.h>
+#  include <blaze/math/dispatch/SSE2.h>
+#  include <blaze/util/CPUFeatures.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  KERNEL SELECTION
+//
+//=================================================================================================
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+namespace dispatch {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Set of runtime dispatched compute kernels for a specific element type.
+//
+// The KernelSet class template bundles the instruction set specific variants of all runtime
+// dispatched compute kernels for the element type \a T (either \c float or \c double).
+*/
+template< typename T >  // Element type
+struct KernelSet
+{
+   //! Kernel for the addition of two dense vectors.
+   void (*add)( size_t n, const T* x, const T* y, T* z );
+
+   //! Kernel for a row-major dense matrix/dense vector multiplication.
+   void (*gemv)( size_t m, size_t n, T alpha, const T* A, size_t lda, const T* x, T beta, T* y );
+
+   //! Kernel for a general dense matrix/dense matrix multiplication.
+   void (*gemm)( size_t m, size_t n, size_t k, T alpha, const T* A, size_t rsa, size_t csa,
+                 const T* B, size_t rsb, size_t csb, T beta, T* C, size_t ldc );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selects the kernel variants for the given SIMD instruction sets.
+//
+// \param features The SIMD instruction sets supported by the executing CPU.
+// \return The fastest kernel variants supported by the given instruction sets.
+*/
+template< typename T >  // Element type
+inline KernelSet<T> selectKernels( const CPUFeatures& features )
+{
+   if( features.avx512f && features.avx2 && features.fma ) {
+      return KernelSet<T>{ &avx512::add<T>, &avx512::gemv<T>, &avx512::gemm<T> };
+   }
+   else if( features.avx2 && features.fma ) {
+      return KernelSet<T>{ &avx2::add<T>, &avx2::gemv<T>, &avx2::gemm<T> };
+   }
+   else {
+      return KernelSet<T>{ &sse2::add<T>, &sse2::gemv<T>, &sse2::gemm<T> };
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the kernel variants selected for the executing CPU.
+//
+// \return The fastest kernel variants supported by the executing CPU.
+//
+// The kernel variants are selected during the first call to this function. All subsequent
+// calls return the same set of kernels.
+*/
+template< typename T >  // Element type
+inline const KernelSet<T>& kernels()
+{
+   static const KernelSet<T> set( selectKernels<T>( cpuFeatures() ) );
+   return set;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dispatch
+
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  TYPE TRAITS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check whether the given operands are suited for a runtime dispatched kernel.
+// \ingroup math_type_traits
+//
+// This type trait tests whether the runtime dispatch mode is active and the given target type
+// \a T1 and the operand types \a T2 and \a T3 are suited for a runtime dispatched kernel, i.e.
+// whether all three types provide direct, SIMD-enabled access to their single or double precision
+// elements. In this case, the \a value member constant is set to \a true, the nested type
+// definition \a Type is \a TrueType, and the class derives from \a TrueType. Otherwise \a value
+// is set to \a false, \a Type is \a FalseType, and the class derives from \a FalseType.
+*/
+template< typename T1    // Type of the target operand
+        , typename T2    // Type of the left-hand side operand
+        , typename T3 >  // Type of the right-hand side operand
+struct UseDispatchedKernel
+   : public BoolConstant< BLAZE_RUNTIME_DISPATCH_MODE &&
+                          HasMutableDataAccess<T1>::value &&
+                          HasConstDataAccess<T2>::value &&
+                          HasConstDataAccess<T3>::value &&
+                          T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+                          ( IsFloat< ElementType_<T1> >::value || IsDouble< ElementType_<T1> >::value ) &&
+                          IsSame< ElementType_<T1>, ElementType_<T2> >::value &&
+                          IsSame< ElementType_<T1>, ElementType_<T3> >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCHED KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for operands that are not suited for a runtime dispatched vector addition.
+// \ingroup math
+//
+// \param z The target dense vector.
+// \param x The left-hand side dense vector operand.
+// \param y The right-hand side dense vector operand.
+// \return \a false.
+*/
+template< typename VT1    // Type of the target vector
+        , typename VT2    // Type of the left-hand side vector operand
+        , typename VT3 >  // Type of the right-hand side vector operand
+inline DisableIf_< UseDispatchedKernel<VT1,VT2,VT3>, bool >
+   dispatchAdd( VT1& z, const VT2& x, const VT3& y )
+{
+   UNUSED_PARAMETER( z, x, y );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for operands that are not suited for a runtime dispatched matrix/vector
+//        multiplication.
+// \ingroup math
+//
+// \param y The target dense vector.
+// \param A The left-hand side dense matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return \a false.
+*/
+template< typename VT1   // Type of the target vector
+        , typename MT1   // Type of the left-hand side matrix operand
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factors
+inline DisableIf_< And< UseDispatchedKernel<VT1,MT1,VT2>, IsRowMajorMatrix<MT1> >, bool >
+   dispatchGemv( VT1& y, const MT1& A, const VT2& x, ST alpha, ST beta )
+{
+   UNUSED_PARAMETER( y, A, x, alpha, beta );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for operands that are not suited for a runtime dispatched matrix/matrix
+//        multiplication.
+// \ingroup math
+//
+// \param C The target dense matrix.
+// \param A The left-hand side dense matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return \a false.
+*/
+template< typename MT1   // Type of the target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factors
+inline DisableIf_< UseDispatchedKernel<MT1,MT2,MT3>, bool >
+   dispatchGemm( MT1& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   UNUSED_PARAMETER( C, A, B, alpha, beta );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched addition of two dense vectors (\f$ \vec{z}=\vec{x}+\vec{y} \f$).
+// \ingroup math
+//
+// \param z The target dense vector.
+// \param x The left-hand side dense vector operand.
+// \param y The right-hand side dense vector operand.
+// \return \a true.
+//
+// This function computes the addition of the two given dense vectors by means of the fastest
+// kernel variant supported by the executing CPU.
+*/
+template< typename VT1    // Type of the target vector
+        , typename VT2    // Type of the left-hand side vector operand
+        , typename VT3 >  // Type of the right-hand side vector operand
+inline EnableIf_< UseDispatchedKernel<VT1,VT2,VT3>, bool >
+   dispatchAdd( VT1& z, const VT2& x, const VT3& y )
+{
+   using ET = ElementType_<VT1>;
+
+   BLAZE_INTERNAL_ASSERT( z.size() == x.size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( z.size() == y.size(), "Invalid vector sizes" );
+
+   dispatch::kernels<ET>().add( z.size(), x.data(), y.data(), z.data() );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched row-major dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup math
+//
+// \param y The target dense vector.
+// \param A The left-hand side row-major dense matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return \a true.
+//
+// This function computes the dense matrix/dense vector multiplication by means of the fastest
+// kernel variant supported by the executing CPU.
+*/
+template< typename VT1   // Type of the target vector
+        , typename MT1   // Type of the left-hand side matrix operand
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factors
+inline EnableIf_< And< UseDispatchedKernel<VT1,MT1,VT2>, IsRowMajorMatrix<MT1> >, bool >
+   dispatchGemv( VT1& y, const MT1& A, const VT2& x, ST alpha, ST beta )
+{
+   using ET = ElementType_<VT1>;
+
+   BLAZE_INTERNAL_ASSERT( y.size() == A.rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( x.size() == A.columns(), "Invalid vector size" );
+
+   dispatch::kernels<ET>().gemv( A.rows(), A.columns(), ET( alpha ), A.data(), A.spacing(),
+                                 x.data(), ET( beta ), y.data() );
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Runtime dispatched general dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup math
+//
+// \param C The target dense matrix.
+// \param A The left-hand side dense matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return \a true.
+//
+// This function computes the dense matrix/dense matrix multiplication by means of the fastest
+// kernel variant supported by the executing CPU. All three matrices may be stored in both
+// row-major and column-major order. In case of a column-major target matrix, the transposed
+// product \f$ C^T=\alpha*B^T*A^T+\beta*C^T \f$ is computed instead.
+*/
+template< typename MT1   // Type of the target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factors
+inline EnableIf_< UseDispatchedKernel<MT1,MT2,MT3>, bool >
+   dispatchGemm( MT1& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET = ElementType_<MT1>;
+
+   BLAZE_INTERNAL_ASSERT( C.rows()    == A.rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( C.columns() == B.columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()   , "Invalid matrix sizes"      );
+
+   const size_t rsa( IsRowMajorMatrix<MT2>::value ? A.spacing() : 1UL );
+   const size_t csa( IsRowMajorMatrix<MT2>::value ? 1UL : A.spacing() );
+   const size_t rsb( IsRowMajorMatrix<MT3>::value ? B.spacing() : 1UL );
+   const size_t csb( IsRowMajorMatrix<MT3>::value ? 1UL : B.spacing() );
+
+   if( IsRowMajorMatrix<MT1>::value ) {
+      dispatch::kernels<ET>().gemm( A.rows(), B.columns(), A.columns(), ET( alpha ),
+                                    A.data(), rsa, csa, B.data(), rsb, csb,
+                                    ET( beta ), C.data(), C.spacing() );
+   }
+   else {
+      dispatch::kernels<ET>().gemm( B.columns(), A.rows(), A.columns(), ET( alpha ),
+                                    B.data(), csb, rsb, A.data(), csa, rsa,
+                                    ET( beta ), C.data(), C.spacing() );
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,418 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dispatch/Kernels.h
+//  \brief Instruction set independent part of the runtime dispatched compute kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+// This file is intentionally not protected by an include guard. It contains the instruction set
+// independent part of the runtime dispatched kernels and is included once per instruction set by
+// the according headers in the blaze/math/dispatch directory (see for instance AVX2.h). Prior to
+// every inclusion, the according instruction set has to be selected as compilation target and
+// the class template Pack has to be specialized for \c float and \c double within the enclosing
+// namespace.
+
+
+//=================================================================================================
+//
+//  VECTOR KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for the addition of two dense vectors (\f$ \vec{z}=\vec{x}+\vec{y} \f$).
+//
+// \param n The number of elements of the three vectors.
+// \param x Pointer to the first element of the left-hand side addition operand.
+// \param y Pointer to the first element of the right-hand side addition operand.
+// \param z Pointer to the first element of the target vector.
+// \return void
+*/
+template< typename T >  // Element type
+void add( size_t n, const T* x, const T* y, T* z )
+{
+   using P = Pack<T>;
+
+   enum : size_t { SIMDSIZE = P::size };
+
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*4UL) <= n; i+=SIMDSIZE*4UL ) {
+      P::store( z+i             , P::add( P::load( x+i              ), P::load( y+i              ) ) );
+      P::store( z+i+SIMDSIZE    , P::add( P::load( x+i+SIMDSIZE     ), P::load( y+i+SIMDSIZE     ) ) );
+      P::store( z+i+SIMDSIZE*2UL, P::add( P::load( x+i+SIMDSIZE*2UL ), P::load( y+i+SIMDSIZE*2UL ) ) );
+      P::store( z+i+SIMDSIZE*3UL, P::add( P::load( x+i+SIMDSIZE*3UL ), P::load( y+i+SIMDSIZE*3UL ) ) );
+   }
+
+   for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+      P::store( z+i, P::add( P::load( x+i ), P::load( y+i ) ) );
+   }
+
+   for( ; i<n; ++i ) {
+      z[i] = x[i] + y[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \a R consecutive elements of a row-major matrix/vector multiplication.
+//
+// \param n The number of columns of the matrix.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param A Pointer to the first element of the first of the \a R rows of the matrix.
+// \param lda The distance between two consecutive rows of the matrix.
+// \param x Pointer to the first element of the vector.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \param y Pointer to the first of the \a R elements of the target vector.
+// \return void
+*/
+template< size_t R      // Number of rows
+        , typename T >  // Element type
+inline void gemvBlock( size_t n, T alpha, const T* A, size_t lda, const T* x, T beta, T* y )
+{
+   using P = Pack<T>;
+   using SIMDType = typename P::Type;
+
+   enum : size_t { SIMDSIZE = P::size };
+
+   SIMDType xmm[R];
+
+   for( size_t r=0UL; r<R; ++r ) {
+      xmm[r] = P::zero();
+   }
+
+   size_t j( 0UL );
+
+   for( ; (j+SIMDSIZE) <= n; j+=SIMDSIZE ) {
+      const SIMDType x1( P::load( x+j ) );
+      for( size_t r=0UL; r<R; ++r ) {
+         xmm[r] = P::fmadd( P::load( A+r*lda+j ), x1, xmm[r] );
+      }
+   }
+
+   for( size_t r=0UL; r<R; ++r )
+   {
+      T value( P::sum( xmm[r] ) );
+
+      for( size_t k=j; k<n; ++k ) {
+         value += A[r*lda+k] * x[k];
+      }
+
+      y[r] = ( beta == T(0) ) ? ( alpha * value ) : ( alpha * value + beta * y[r] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for a row-major dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param A Pointer to the first element of the row-major matrix.
+// \param lda The distance between two consecutive rows of the matrix.
+// \param x Pointer to the first element of the vector.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \param y Pointer to the first element of the target vector.
+// \return void
+//
+// In case \a beta is 0, the target vector is not read and may be uninitialized.
+*/
+template< typename T >  // Element type
+void gemv( size_t m, size_t n, T alpha, const T* A, size_t lda, const T* x, T beta, T* y )
+{
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL ) {
+      gemvBlock<4UL>( n, alpha, A+i*lda, lda, x, beta, y+i );
+   }
+
+   for( ; i<m; ++i ) {
+      gemvBlock<1UL>( n, alpha, A+i*lda, lda, x, beta, y+i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MATRIX/MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a block of \a R rows and \a V SIMD vectors of a matrix/matrix multiplication.
+//
+// \param k The number of columns of \a A and rows of \a B.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the packed block of \a A (\a R consecutive values per column).
+// \param B Pointer to the first element of the packed, row-major block of \a B.
+// \param ldb The distance between two consecutive rows of the packed block of \a B.
+// \param C Pointer to the first element of the row-major block of \a C.
+// \param ldc The distance between two consecutive rows of \a C.
+// \return void
+//
+// This function adds \f$ \alpha*A*B \f$ to the given \f$ R \times V*SIMDSIZE \f$ block of \a C.
+*/
+template< size_t R      // Number of rows
+        , size_t V      // Number of SIMD vectors per row
+        , typename T >  // Element type
+inline void gemmBlock( size_t k, T alpha, const T* A, const T* B, size_t ldb, T* C, size_t ldc )
+{
+   using P = Pack<T>;
+   using SIMDType = typename P::Type;
+
+   enum : size_t { SIMDSIZE = P::size };
+
+   SIMDType xmm[R][V];
+
+   for( size_t r=0UL; r<R; ++r ) {
+      for( size_t v=0UL; v<V; ++v ) {
+         xmm[r][v] = P::zero();
+      }
+   }
+
+   for( size_t l=0UL; l<k; ++l )
+   {
+      SIMDType b[V];
+
+      for( size_t v=0UL; v<V; ++v ) {
+         b[v] = P::load( B+l*ldb+v*SIMDSIZE );
+      }
+
+      for( size_t r=0UL; r<R; ++r ) {
+         const SIMDType a( P::set( A[l*R+r] ) );
+         for( size_t v=0UL; v<V; ++v ) {
+            xmm[r][v] = P::fmadd( a, b[v], xmm[r][v] );
+         }
+      }
+   }
+
+   const SIMDType factor( P::set( alpha ) );
+
+   for( size_t r=0UL; r<R; ++r ) {
+      for( size_t v=0UL; v<V; ++v ) {
+         T* const c( C+r*ldc+v*SIMDSIZE );
+         P::store( c, P::fmadd( factor, xmm[r][v], P::load( c ) ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the remaining columns of \a R rows of a matrix/matrix multiplication.
+//
+// \param n The number of remaining columns.
+// \param k The number of columns of \a A and rows of \a B.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the packed block of \a A (\a R consecutive values per column).
+// \param B Pointer to the first element of the packed, row-major block of \a B.
+// \param ldb The distance between two consecutive rows of the packed block of \a B.
+// \param C Pointer to the first element of the row-major block of \a C.
+// \param ldc The distance between two consecutive rows of \a C.
+// \return void
+*/
+template< size_t R      // Number of rows
+        , typename T >  // Element type
+inline void gemmRemainder( size_t n, size_t k, T alpha, const T* A,
+                           const T* B, size_t ldb, T* C, size_t ldc )
+{
+   for( size_t r=0UL; r<R; ++r ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         T value( 0 );
+         for( size_t l=0UL; l<k; ++l ) {
+            value += A[l*R+r] * B[l*ldb+j];
+         }
+         C[r*ldc+j] += alpha * value;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a band of \a R rows of a matrix/matrix multiplication.
+//
+// \param n The number of columns of the packed block of \a B.
+// \param k The number of columns of \a A and rows of \a B.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the first element of the band of \a A.
+// \param rsa The distance between two consecutive rows of \a A.
+// \param csa The distance between two consecutive columns of \a A.
+// \param B Pointer to the packed block of \a B.
+// \param C Pointer to the first element of the row-major band of \a C.
+// \param ldc The distance between two consecutive rows of \a C.
+// \param buffer Buffer for the packed band of \a A (at least \f$ R*k \f$ elements).
+// \return void
+//
+// This function packs the given band of \a A such that the \a R values of every column are
+// stored consecutively and streams the packed band through all panels of the packed block
+// of \a B (see gemm()).
+*/
+template< size_t R      // Number of rows
+        , typename T >  // Element type
+inline void gemmBand( size_t n, size_t k, T alpha, const T* A, size_t rsa, size_t csa,
+                      const T* B, T* C, size_t ldc, T* buffer )
+{
+   enum : size_t { SIMDSIZE = Pack<T>::size, NR = SIMDSIZE * Pack<T>::vectors };
+
+   for( size_t l=0UL; l<k; ++l ) {
+      for( size_t r=0UL; r<R; ++r ) {
+         buffer[l*R+r] = A[r*rsa+l*csa];
+      }
+   }
+
+   size_t j( 0UL );
+
+   for( ; (j+NR) <= n; j+=NR ) {
+      gemmBlock<R,Pack<T>::vectors>( k, alpha, buffer, B+j*k, NR, C+j, ldc );
+   }
+
+   const T* const tail( B+j*k );
+   const size_t ldb( n-j );
+
+   for( ; (j+SIMDSIZE) <= n; j+=SIMDSIZE ) {
+      gemmBlock<R,1UL>( k, alpha, buffer, tail+(j+ldb-n), ldb, C+j, ldc );
+   }
+
+   gemmRemainder<R>( n-j, k, alpha, buffer, tail+(j+ldb-n), ldb, C+j, ldc );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Kernel for a general dense matrix/dense matrix multiplication (\f$ C=\alpha*A*B+\beta*C \f$).
+//
+// \param m The number of rows of \a A and \a C.
+// \param n The number of columns of \a B and \a C.
+// \param k The number of columns of \a A and rows of \a B.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param A Pointer to the first element of \a A.
+// \param rsa The distance between two consecutive rows of \a A.
+// \param csa The distance between two consecutive columns of \a A.
+// \param B Pointer to the first element of \a B.
+// \param rsb The distance between two consecutive rows of \a B.
+// \param csb The distance between two consecutive columns of \a B.
+// \param beta The scaling factor for \f$ C \f$.
+// \param C Pointer to the first element of the row-major matrix \a C.
+// \param ldc The distance between two consecutive rows of \a C.
+// \return void
+//
+// The operands \a A and \a B are specified by means of their row and column strides and can
+// therefore be stored in both row-major and column-major order. Blocks of \a B are packed into
+// consecutive row-major panels of \a vectors SIMD vectors width, which are streamed through
+// packed bands of \a rows rows of \a A. The \a rows and \a vectors constants are specified by
+// the Pack class template of the according instruction set. In case \a beta is 0, \a C is not read
+// and may be uninitialized.
+*/
+template< typename T >  // Element type
+void gemm( size_t m, size_t n, size_t k, T alpha, const T* A, size_t rsa, size_t csa,
+           const T* B, size_t rsb, size_t csb, T beta, T* C, size_t ldc )
+{
+   enum : size_t { KBLOCK = 256UL, JBLOCK = 1024UL / sizeof(T)
+                  , ROWS = Pack<T>::rows, NR = Pack<T>::size * Pack<T>::vectors };
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         C[i*ldc+j] = ( beta == T(0) ) ? T(0) : ( beta * C[i*ldc+j] );
+      }
+   }
+
+   if( k == 0UL )
+      return;
+
+   std::unique_ptr<T[]> bbuffer( new T[KBLOCK*JBLOCK] );
+   std::unique_ptr<T[]> abuffer( new T[KBLOCK*ROWS] );
+
+   for( size_t kk=0UL; kk<k; kk+=KBLOCK )
+   {
+      const size_t kblock( ( kk+KBLOCK <= k )?( KBLOCK ):( k - kk ) );
+
+      for( size_t jj=0UL; jj<n; jj+=JBLOCK )
+      {
+         const size_t jblock( ( jj+JBLOCK <= n )?( JBLOCK ):( n - jj ) );
+
+         size_t jpanel( 0UL );
+
+         for( ; jpanel<jblock; jpanel+=NR )
+         {
+            const size_t jsize( ( jpanel+NR <= jblock )?( NR ):( jblock - jpanel ) );
+            T* const panel( bbuffer.get() + jpanel*kblock );
+
+            for( size_t l=0UL; l<kblock; ++l ) {
+               for( size_t j=0UL; j<jsize; ++j ) {
+                  panel[l*jsize+j] = B[(kk+l)*rsb+(jj+jpanel+j)*csb];
+               }
+            }
+         }
+
+         size_t i( 0UL );
+
+         for( ; (i+ROWS) <= m; i+=ROWS ) {
+            gemmBand<ROWS>( jblock, kblock, alpha, A+i*rsa+kk*csa, rsa, csa,
+                            bbuffer.get(), C+i*ldc+jj, ldc, abuffer.get() );
+         }
+
+         for( ; i<m; ++i ) {
+            gemmBand<1UL>( jblock, kblock, alpha, A+i*rsa+kk*csa, rsa, csa,
+                           bbuffer.get(), C+i*ldc+jj, ldc, abuffer.get() );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
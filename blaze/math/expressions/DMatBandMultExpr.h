@@ -0,0 +1,1183 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatBandMultExpr.h
+//  \brief Header file for the dense matrix/band matrix multiplication expression
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATBANDMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATBANDMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/MatMatMultExpr.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/BandMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsBandMatrix.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DMATBANDMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for multiplications between dense matrices and band matrices.
+// \ingroup dense_matrix_expression
+//
+// The DMatBandMultExpr class represents the compile time expression for the multiplication of
+// a band matrix and a dense matrix (\f$ B*A \f$) or of a dense matrix and a band matrix
+// (\f$ A*B \f$). The storage order \a SO of the expression corresponds to the storage order of
+// the dense matrix operand. The expression only traverses the stored band of the band matrix,
+// i.e. it requires \f$ O(MN(KL+KU+1)) \f$ operations. Depending on the storage order of the
+// dense matrix operand, the expression is evaluated in one of two ways:
+//
+//  - In case every row (row-major) or column (column-major) of the result is a linear combination
+//    of the according rows or columns of the dense matrix operand (\f$ B*A \f$ for row-major
+//    and \f$ A*B \f$ for column-major dense matrices), the lines of the result are computed as
+//    vectorized sums of the at most \f$ KL+KU+1 \f$ involved lines of the dense matrix.
+//  - Otherwise every row or column of the dense matrix operand is multiplied with the band
+//    matrix by means of the vectorized band matrix/vector multiplication kernel.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO >     // Storage order of the dense matrix operand
+class DMatBandMultExpr
+   : public MatMatMultExpr< DenseMatrix< DMatBandMultExpr<MT1,MT2,SO>, SO > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RT1 = ResultType_<MT1>;     //!< Result type of the left-hand side matrix expression.
+   using RT2 = ResultType_<MT2>;     //!< Result type of the right-hand side matrix expression.
+   using ET1 = ElementType_<RT1>;    //!< Element type of the left-hand side matrix expression.
+   using ET2 = ElementType_<RT2>;    //!< Element type of the right-hand side matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the position of the band matrix operand.
+   /*! The \a rightBand compile time constant is set to 1 in case the band matrix is the
+       right-hand side operand (\f$ A*B \f$) and to 0 in case it is the left-hand side operand
+       (\f$ B*A \f$). */
+   enum : bool { rightBand = IsBandMatrix<MT2>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the evaluation strategy of the expression.
+   /*! In case the lines of the dense matrix operand have to be multiplied with the band matrix
+       one by one (\f$ B*A \f$ for column-major and \f$ A*B \f$ for row-major dense matrices),
+       \a lineMode is set to 1. In case the lines of the result are linear combinations of the
+       lines of the dense matrix operand, \a lineMode is set to 0. */
+   enum : bool { lineMode = ( rightBand != SO ) };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Type of the dense matrix operand.
+   using DMT = If_< IsBandMatrix<MT2>, MT1, MT2 >;
+
+   //! Type of the band matrix operand.
+   using BT = If_< IsBandMatrix<MT2>, MT2, MT1 >;
+
+   //! Element type of the band matrix operand.
+   using BET = ElementType_<BT>;
+
+   //! Multiplication result type of the two operands.
+   using MRT = MultTrait_< RemoveAdaptor_<RT1>, RemoveAdaptor_<RT2> >;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the dense matrix operand.
+   enum : bool { evaluateDense = IsComputation<DMT>::value || RequiresEvaluation<DMT>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPAssign struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case the target matrix is SMP assignable, \a value is set to 1 and the
+       expression specific parallel evaluation strategy is selected. Otherwise \a value is set
+       to 0 and the default strategy is chosen. */
+   template< typename T1 >
+   struct UseSMPAssign {
+      enum : bool { value = T1::smpAssignable };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the lines of the dense matrix operand have to be multiplied with the band matrix
+       one by one, the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1 >
+   struct UseLineKernel {
+      enum : bool { value = lineMode };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the lines of the result are computed as linear combinations, the target matrix
+       has the same storage order as the dense matrix operand and all
+       three involved data types are suited for a vectorized computation of the linear
+       combinations, the nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   struct UseVectorizedKernel {
+      enum : bool { value = useOptimizedKernels && !lineMode &&
+                            IsColumnMajorMatrix<T1>::value == SO &&
+                            T1::simdEnabled && T2::simdEnabled &&
+                            IsSIMDCombinable< ElementType_<T1>, ElementType_<T2>, BET >::value &&
+                            HasSIMDMult< ElementType_<T2>, BET >::value &&
+                            HasSIMDAdd< ElementType_<T1>, ElementType_<T1> >::value &&
+                            HasSIMDSub< ElementType_<T1>, ElementType_<T1> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = DMatBandMultExpr<MT1,MT2,SO>;  //!< Type of this DMatBandMultExpr instance.
+
+   //! Result type for expression template evaluations.
+   using ResultType    = IfTrue_< IsColumnMajorMatrix<MRT>::value == SO, MRT, OppositeType_<MRT> >;
+
+   using OppositeType  = OppositeType_<ResultType>;   //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_<ResultType>;    //!< Resulting element type.
+   using SIMDType      = SIMDTrait_<ElementType>;     //!< Resulting SIMD element type.
+   using ReturnType    = const ElementType;           //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;            //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side matrix expression.
+   using LeftOperand = If_< IsExpression<MT1>, const MT1, const MT1& >;
+
+   //! Composite type of the right-hand side matrix expression.
+   using RightOperand = If_< IsExpression<MT2>, const MT2, const MT2& >;
+
+   //! Type for the assignment of the dense matrix operand.
+   using DCT = IfTrue_< evaluateDense, const ResultType_<DMT>, CompositeType_<DMT> >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatBandMultExpr class.
+   //
+   // \param lhs The left-hand side operand of the multiplication expression.
+   // \param rhs The right-hand side operand of the multiplication expression.
+   */
+   explicit inline DMatBandMultExpr( const MT1& lhs, const MT2& rhs ) noexcept
+      : lhs_( lhs )  // Left-hand side operand of the multiplication expression
+      , rhs_( rhs )  // Right-hand side operand of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.columns() == rhs.rows(), "Invalid matrix sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   //
+   // The element is computed from the at most \f$ KL+KU+1 \f$ elements of the band that
+   // contribute to it.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+      const BT& B( bandOperand() );
+      const size_t k( rightBand ? j : i );
+      const size_t lo( rightBand ? B.upperBandwidth() : B.lowerBandwidth() );
+      const size_t hi( rightBand ? B.lowerBandwidth() : B.upperBandwidth() );
+      const size_t pbegin( ( k > lo )?( k-lo ):( 0UL ) );
+      const size_t pend  ( min( B.rows(), k+hi+1UL ) );
+
+      ElementType tmp = ElementType();
+
+      for( size_t p=pbegin; p<pend; ++p ) {
+         if( rightBand )
+            tmp += lhs_(i,p) * B.data()[B.index(p,j)];
+         else
+            tmp += B.data()[B.index(i,p)] * rhs_(p,j);
+      }
+
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid matrix access index.
+   */
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(i,j);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const noexcept {
+      return lhs_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const noexcept {
+      return rhs_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side matrix operand.
+   //
+   // \return The left-hand side matrix operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side matrix operand.
+   //
+   // \return The right-hand side matrix operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return denseOperand().isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   //
+   // The amount of work of the expression is estimated by the number of stored band elements
+   // multiplied by the number of lines of the dense matrix operand.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( rows() * columns() * bandOperand().spacing() >= SMP_BANDMULT_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Operand selection***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the first of two operands.
+   */
+   template< typename T1, typename T2 >
+   static inline const T1& select( const T1& a, const T2& b, TrueType ) noexcept {
+      UNUSED_PARAMETER( b );
+      return a;
+   }
+
+   /*!\brief Selection of the second of two operands.
+   */
+   template< typename T1, typename T2 >
+   static inline const T2& select( const T1& a, const T2& b, FalseType ) noexcept {
+      UNUSED_PARAMETER( a );
+      return b;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Dense operand access************************************************************************
+   /*!\brief Returns the dense matrix operand.
+   //
+   // \return The dense matrix operand.
+   */
+   inline const DMT& denseOperand() const noexcept {
+      return select( lhs_, rhs_, BoolConstant<rightBand>() );
+   }
+   //**********************************************************************************************
+
+   //**Band operand access*************************************************************************
+   /*!\brief Returns the band matrix operand.
+   //
+   // \return The band matrix operand.
+   */
+   inline const BT& bandOperand() const noexcept {
+      return select( rhs_, lhs_, BoolConstant<rightBand>() );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side operand of the multiplication expression.
+   RightOperand rhs_;  //!< Right-hand side operand of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Line kernel*********************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication of a range of rows/columns of a dense matrix with a band matrix.
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The dense matrix operand.
+   // \param B The band matrix operand.
+   // \param kbegin The index of the first row (row-major) or column (column-major) to compute.
+   // \param kend The index one past the last row (row-major) or column (column-major) to compute.
+   // \return void
+   //
+   // This function computes the product of every row (row-major) or column (column-major) of
+   // the dense matrix operand in the given range with the band matrix and, depending on \a OP,
+   // assigns it to (0), adds it to (1) or subtracts it from (2) the according line of \a C. The
+   // lines are copied into contiguous buffers, which are processed by the vectorized band
+   // matrix/vector multiplication kernel.
+   */
+   template< size_t OP       // Type of the operation
+           , typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the dense matrix operand
+   static inline EnableIf_< UseLineKernel<MT3> >
+      selectKernel( MT3& C, const MT4& A, const BT& B, size_t kbegin, size_t kend )
+   {
+      const size_t L( B.rows() );
+
+      DynamicVector<ElementType> x( L ), y( L );
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         for( size_t l=0UL; l<L; ++l ) {
+            x[l] = A( SO ? l : k, SO ? k : l );
+         }
+
+         reset( y );
+         B.template mult<rightBand>( y.data(), x.data(), false );
+
+         for( size_t l=0UL; l<L; ++l ) {
+            const size_t i( SO ? l : k );
+            const size_t j( SO ? k : l );
+            if( OP == 0UL )      C(i,j)  = y[l];
+            else if( OP == 1UL ) C(i,j) += y[l];
+            else                 C(i,j) -= y[l];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default combination kernel******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default computation of a range of rows/columns of a dense matrix-band matrix
+   //        multiplication as linear combinations of the lines of the dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The dense matrix operand.
+   // \param B The band matrix operand.
+   // \param kbegin The index of the first row (row-major) or column (column-major) to compute.
+   // \param kend The index one past the last row (row-major) or column (column-major) to compute.
+   // \return void
+   //
+   // This function computes every row (row-major) or column (column-major) of the result in the
+   // given range as linear combination of the according lines of the dense matrix operand and,
+   // depending on \a OP, assigns it to (0), adds it to (1) or subtracts it from (2) \a C.
+   */
+   template< size_t OP       // Type of the operation
+           , typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the dense matrix operand
+   static inline DisableIf_< Or< UseLineKernel<MT3>, UseVectorizedKernel<MT3,MT4> > >
+      selectKernel( MT3& C, const MT4& A, const BT& B, size_t kbegin, size_t kend )
+   {
+      const size_t L( SO ? A.rows() : A.columns() );
+      const size_t N( B.rows() );
+
+      const size_t lo  ( rightBand ? B.upperBandwidth() : B.lowerBandwidth() );
+      const size_t hi  ( rightBand ? B.lowerBandwidth() : B.upperBandwidth() );
+      const size_t step( ( IsColumnMajorMatrix<BT>::value == rightBand )?( 1UL ):( B.spacing()-1UL ) );
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         const size_t pbegin( ( k > lo )?( k-lo ):( 0UL ) );
+         const size_t pend  ( min( N, k+hi+1UL ) );
+         const BET* coef( B.data() + ( rightBand ? B.index(pbegin,k) : B.index(k,pbegin) ) );
+
+         for( size_t l=0UL; l<L; ++l )
+         {
+            ElementType tmp = ElementType();
+
+            for( size_t p=pbegin; p<pend; ++p ) {
+               tmp += A( SO ? l : p, SO ? p : l ) * coef[(p-pbegin)*step];
+            }
+
+            const size_t i( SO ? l : k );
+            const size_t j( SO ? k : l );
+            if( OP == 0UL )      C(i,j)  = tmp;
+            else if( OP == 1UL ) C(i,j) += tmp;
+            else                 C(i,j) -= tmp;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized combination kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized computation of a range of rows/columns of a dense matrix-band matrix
+   //        multiplication as linear combinations of the lines of the dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The dense matrix operand.
+   // \param B The band matrix operand.
+   // \param kbegin The index of the first row (row-major) or column (column-major) to compute.
+   // \param kend The index one past the last row (row-major) or column (column-major) to compute.
+   // \return void
+   //
+   // This function computes every row (row-major) or column (column-major) of the result in the
+   // given range as linear combination of the according lines of the dense matrix operand and,
+   // depending on \a OP, assigns it to (0), adds it to (1) or subtracts it from (2) \a C. Each
+   // SIMD vector of the result is accumulated in a register over the at most \f$ KL+KU+1 \f$
+   // contributing lines before it is stored.
+   */
+   template< size_t OP       // Type of the operation
+           , typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the dense matrix operand
+   static inline EnableIf_< UseVectorizedKernel<MT3,MT4> >
+      selectKernel( MT3& C, const MT4& A, const BT& B, size_t kbegin, size_t kend )
+   {
+      constexpr bool remainder( !IsPadded<MT3>::value || !IsPadded<MT4>::value );
+
+      const size_t L( SO ? A.rows() : A.columns() );
+      const size_t N( B.rows() );
+
+      const size_t lpos( remainder ? ( L & size_t(-SIMDSIZE) ) : L );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( L - ( L % SIMDSIZE ) ) == lpos, "Invalid end calculation" );
+
+      const size_t lo  ( rightBand ? B.upperBandwidth() : B.lowerBandwidth() );
+      const size_t hi  ( rightBand ? B.lowerBandwidth() : B.upperBandwidth() );
+      const size_t step( ( IsColumnMajorMatrix<BT>::value == rightBand )?( 1UL ):( B.spacing()-1UL ) );
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         const size_t pbegin( ( k > lo )?( k-lo ):( 0UL ) );
+         const size_t pend  ( min( N, k+hi+1UL ) );
+         const BET* coef( B.data() + ( rightBand ? B.index(pbegin,k) : B.index(k,pbegin) ) );
+
+         size_t l( 0UL );
+
+         for( ; l<lpos; l+=SIMDSIZE )
+         {
+            SIMDType xmm;
+
+            for( size_t p=pbegin; p<pend; ++p ) {
+               xmm += A.load( SO ? l : p, SO ? p : l ) * set( coef[(p-pbegin)*step] );
+            }
+
+            const size_t i( SO ? l : k );
+            const size_t j( SO ? k : l );
+            if( OP == 0UL )      C.store( i, j, xmm );
+            else if( OP == 1UL ) C.store( i, j, C.load(i,j) + xmm );
+            else                 C.store( i, j, C.load(i,j) - xmm );
+         }
+
+         for( ; remainder && l<L; ++l )
+         {
+            ElementType tmp = ElementType();
+
+            for( size_t p=pbegin; p<pend; ++p ) {
+               tmp += A( SO ? l : p, SO ? p : l ) * coef[(p-pbegin)*step];
+            }
+
+            const size_t i( SO ? l : k );
+            const size_t j( SO ? k : l );
+            if( OP == 0UL )      C(i,j)  = tmp;
+            else if( OP == 1UL ) C(i,j) += tmp;
+            else                 C(i,j) -= tmp;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Serial evaluation***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Serial evaluation of a dense matrix-band matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression.
+   // \return void
+   */
+   template< size_t OP       // Type of the operation
+           , typename MT3 >  // Type of the target dense matrix
+   static inline void evaluate( MT3& C, const DMatBandMultExpr& rhs )
+   {
+      DCT A( serial( rhs.denseOperand() ) );  // Evaluation of the dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == C.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == C.columns(), "Invalid number of columns" );
+
+      selectKernel<OP>( C, A, rhs.bandOperand(), 0UL, ( SO ? A.columns() : A.rows() ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Parallel evaluation*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Parallel evaluation of a dense matrix-band matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression.
+   // \return void
+   //
+   // In case the amount of work exceeds the \c SMP_BANDMULT_THRESHOLD, the rows (row-major)
+   // or columns (column-major) of the dense matrix operand are distributed among the available
+   // threads.
+   */
+   template< size_t OP       // Type of the operation
+           , typename MT3 >  // Type of the target dense matrix
+   static inline void smpEvaluate( MT3& C, const DMatBandMultExpr& rhs )
+   {
+      DCT A( rhs.denseOperand() );  // Evaluation of the dense matrix operand
+      const BT& B( rhs.bandOperand() );
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == C.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == C.columns(), "Invalid number of columns" );
+
+      const size_t lines( SO ? A.columns() : A.rows() );
+
+      if( rhs.canSMPAssign() ) {
+         smpFor( 0UL, lines, [&]( size_t first, size_t last ) {
+            selectKernel<OP>( C, A, B, first, last );
+         } );
+      }
+      else {
+         selectKernel<OP>( C, A, B, 0UL, lines );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-band matrix multiplication to a dense matrix
+   //        (\f$ C=B*A \f$ or \f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix-band
+   // matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT3,SO2>& lhs, const DMatBandMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      evaluate<0UL>( ~lhs, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-band matrix multiplication to a sparse matrix
+   //        (\f$ C=B*A \f$ or \f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix-band
+   // matrix multiplication expression to a sparse matrix.
+   */
+   template< typename MT3  // Type of the target sparse matrix
+           , bool SO2 >    // Storage order of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT3,SO2>& lhs, const DMatBandMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = IfTrue_< SO == SO2, ResultType, OppositeType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OppositeType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT3, TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense matrix-band matrix multiplication to a dense matrix
+   //        (\f$ C+=B*A \f$ or \f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense
+   // matrix-band matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void addAssign( DenseMatrix<MT3,SO2>& lhs, const DMatBandMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      evaluate<1UL>( ~lhs, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense matrix-band matrix multiplication to a dense
+   //        matrix (\f$ C-=B*A \f$ or \f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense
+   // matrix-band matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void subAssign( DenseMatrix<MT3,SO2>& lhs, const DMatBandMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      evaluate<2UL>( ~lhs, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse matrices***************************************************
+   // No special implementation for the subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense matrices**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a dense matrix-band matrix multiplication to a dense
+   //        matrix (\f$ C\circ=B*A \f$ or \f$ C\circ=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a dense
+   // matrix-band matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void schurAssign( DenseMatrix<MT3,SO2>& lhs, const DMatBandMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      schurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to sparse matrices*************************************************
+   // No special implementation for the Schur product assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense matrices*************************************************
+   // No special implementation for the multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse matrices************************************************
+   // No special implementation for the multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense matrix-band matrix multiplication to a dense matrix
+   //        (\f$ C=B*A \f$ or \f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense matrix-band
+   // matrix multiplication expression to a dense matrix. Due to the explicit application of
+   // the SFINAE principle this function can only be selected by the compiler in case the
+   // target matrix is SMP assignable.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSMPAssign<MT3> >
+      smpAssign( DenseMatrix<MT3,SO2>& lhs, const DMatBandMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      smpEvaluate<0UL>( ~lhs, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse matrices***********************************************************
+   // No special implementation for the SMP assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense matrix-band matrix multiplication to a dense
+   //        matrix (\f$ C+=B*A \f$ or \f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a dense
+   // matrix-band matrix multiplication expression to a dense matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case the target matrix is SMP assignable.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSMPAssign<MT3> >
+      smpAddAssign( DenseMatrix<MT3,SO2>& lhs, const DMatBandMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      smpEvaluate<1UL>( ~lhs, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse matrices**************************************************
+   // No special implementation for the SMP addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense matrix-band matrix multiplication to a dense
+   //        matrix (\f$ C-=B*A \f$ or \f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a dense
+   // matrix-band matrix multiplication expression to a dense matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case the target matrix is SMP assignable.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSMPAssign<MT3> >
+      smpSubAssign( DenseMatrix<MT3,SO2>& lhs, const DMatBandMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      smpEvaluate<2UL>( ~lhs, rhs );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse matrices***********************************************
+   // No special implementation for the SMP subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( DMT );
+   BLAZE_CONSTRAINT_MUST_FORM_VALID_MATMATMULTEXPR( MT1, MT2 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a band matrix and a dense matrix
+//        (\f$ A=B*C \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side band matrix for the multiplication.
+// \param rhs The right-hand side dense matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication of a band matrix and a dense matrix:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::BandMatrix<double,rowMajor> B;
+   blaze::DynamicMatrix<double,rowMajor> A, C;
+   // ... Resizing and initialization
+   C = B * A;
+   \endcode
+
+// The operator returns an expression representing a dense matrix of the higher-order element
+// type of the two involved matrix element types \a T and \a MT::ElementType. The storage order
+// of the resulting matrix corresponds to the storage order of the dense matrix operand. In case
+// the current number of columns of \a lhs and the current number of rows of \a rhs don't match,
+// a \a std::invalid_argument is thrown.
+*/
+template< typename T   // Data type of the left-hand side band matrix
+        , bool SO1     // Storage order of the left-hand side band matrix
+        , typename MT  // Type of the right-hand side dense matrix
+        , bool SO2 >   // Storage order of the right-hand side dense matrix
+inline decltype(auto)
+   operator*( const BandMatrix<T,SO1>& lhs, const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using ReturnType = const DMatBandMultExpr< BandMatrix<T,SO1>, MT, SO2 >;
+   return ReturnType( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a dense matrix and a band matrix
+//        (\f$ A=B*C \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side dense matrix for the multiplication.
+// \param rhs The right-hand side band matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication of a dense matrix and a band matrix:
+
+   \code
+   using blaze::columnMajor;
+
+   blaze::DynamicMatrix<double,columnMajor> A, C;
+   blaze::BandMatrix<double,columnMajor> B;
+   // ... Resizing and initialization
+   C = A * B;
+   \endcode
+
+// The operator returns an expression representing a dense matrix of the higher-order element
+// type of the two involved matrix element types \a MT::ElementType and \a T. The storage order
+// of the resulting matrix corresponds to the storage order of the dense matrix operand. In case
+// the current number of columns of \a lhs and the current number of rows of \a rhs don't match,
+// a \a std::invalid_argument is thrown.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , bool SO1     // Storage order of the left-hand side dense matrix
+        , typename T   // Data type of the right-hand side band matrix
+        , bool SO2 >   // Storage order of the right-hand side band matrix
+inline decltype(auto)
+   operator*( const DenseMatrix<MT,SO1>& lhs, const BandMatrix<T,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using ReturnType = const DMatBandMultExpr< MT, BandMatrix<T,SO2>, SO1 >;
+   return ReturnType( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a band matrix and a dense
+//        matrix-scalar multiplication expression (\f$ A=B*(C*s1) \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side band matrix.
+// \param rhs The right-hand side dense matrix-scalar multiplication.
+// \return The scaled result matrix.
+//
+// This operator implements the performance optimized treatment of the multiplication of a
+// band matrix and a dense matrix-scalar multiplication. It restructures the expression
+// \f$ A=B*(C*s1) \f$ to the expression \f$ A=(B*C)*s1 \f$.
+*/
+template< typename T     // Data type of the left-hand side band matrix
+        , bool SO1       // Storage order of the left-hand side band matrix
+        , typename MT    // Type of the dense matrix of the right-hand side expression
+        , typename ST    // Type of the scalar of the right-hand side expression
+        , bool SO2 >     // Storage order of the right-hand side expression
+inline decltype(auto)
+   operator*( const BandMatrix<T,SO1>& lhs, const DMatScalarMultExpr<MT,ST,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( (~lhs) * rhs.leftOperand() ) * rhs.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a dense matrix-scalar multiplication
+//        expression and a band matrix (\f$ A=(C*s1)*B \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side dense matrix-scalar multiplication.
+// \param rhs The right-hand side band matrix.
+// \return The scaled result matrix.
+//
+// This operator implements the performance optimized treatment of the multiplication of a
+// dense matrix-scalar multiplication and a band matrix. It restructures the expression
+// \f$ A=(C*s1)*B \f$ to the expression \f$ A=(C*B)*s1 \f$.
+*/
+template< typename MT    // Type of the dense matrix of the left-hand side expression
+        , typename ST    // Type of the scalar of the left-hand side expression
+        , bool SO1       // Storage order of the left-hand side expression
+        , typename T     // Data type of the right-hand side band matrix
+        , bool SO2 >     // Storage order of the right-hand side band matrix
+inline decltype(auto)
+   operator*( const DMatScalarMultExpr<MT,ST,SO1>& lhs, const BandMatrix<T,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( lhs.leftOperand() * (~rhs) ) * lhs.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct Rows< DMatBandMultExpr<MT1,MT2,SO> >
+   : public Rows<MT1>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct Columns< DMatBandMultExpr<MT1,MT2,SO> >
+   : public Columns<MT2>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsAligned< DMatBandMultExpr<MT1,MT2,SO> >
+   : public BoolConstant< IsAligned< If_< IsBandMatrix<MT2>, MT1, MT2 > >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -50,6 +50,7 @@
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/dispatch/Dispatch.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -752,6 +753,11 @@ class DMatDVecMultExpr
    static inline EnableIf_< UseVectorizedDefaultKernel<VT1,MT1,VT2> >
       selectLargeAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
+      using ET = ElementType_<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(1), ET(0) ) )
+         return;
+
       constexpr bool remainder( !IsPadded<MT1>::value || !IsPadded<VT2>::value );
 
       const size_t M( A.rows()    );
@@ -1435,6 +1441,11 @@ class DMatDVecMultExpr
    static inline EnableIf_< UseVectorizedDefaultKernel<VT1,MT1,VT2> >
       selectLargeAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
+      using ET = ElementType_<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(1), ET(1) ) )
+         return;
+
       constexpr bool remainder( !IsPadded<MT1>::value || !IsPadded<VT2>::value );
 
       const size_t M( A.rows()    );
@@ -2091,6 +2102,11 @@ class DMatDVecMultExpr
    static inline EnableIf_< UseVectorizedDefaultKernel<VT1,MT1,VT2> >
       selectLargeSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
+      using ET = ElementType_<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(-1), ET(1) ) )
+         return;
+
       constexpr bool remainder( !IsPadded<MT1>::value || !IsPadded<VT2>::value );
 
       const size_t M( A.rows()    );
@@ -3337,6 +3353,11 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline EnableIf_< UseVectorizedDefaultKernel<VT1,MT1,VT2,ST2> >
       selectLargeAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
+      using ET = ElementType_<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(scalar), ET(0) ) )
+         return;
+
       constexpr bool remainder( !IsPadded<MT1>::value || !IsPadded<VT2>::value );
 
       const size_t M( A.rows()    );
@@ -4038,6 +4059,11 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline EnableIf_< UseVectorizedDefaultKernel<VT1,MT1,VT2,ST2> >
       selectLargeAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
+      using ET = ElementType_<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(scalar), ET(1) ) )
+         return;
+
       constexpr bool remainder( !IsPadded<MT1>::value || !IsPadded<VT2>::value );
 
       const size_t M( A.rows()    );
@@ -4695,6 +4721,11 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline EnableIf_< UseVectorizedDefaultKernel<VT1,MT1,VT2,ST2> >
       selectLargeSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
+      using ET = ElementType_<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(-scalar), ET(1) ) )
+         return;
+
       constexpr bool remainder( !IsPadded<MT1>::value || !IsPadded<VT2>::value );
 
       const size_t M( A.rows()    );
@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MutableDataAccess.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/BlockedDecomposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
@@ -54,6 +55,7 @@
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUniTriangular.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NumericCast.h>
 #include <blaze/util/Types.h>
@@ -336,17 +338,22 @@ ElementType_<MT> detNxN( const DenseMatrix<MT,SO>& dm )
 
    URT A( ~dm );
 
-   int n   ( numeric_cast<int>( A.rows()    ) );
-   int lda ( numeric_cast<int>( A.spacing() ) );
-   int info( 0 );
+   int n( numeric_cast<int>( A.rows() ) );
 
    const std::unique_ptr<int[]> ipiv( new int[n] );
 
+#if BLAZE_LAPACK_MODE
+   int lda ( numeric_cast<int>( A.spacing() ) );
+   int info( 0 );
+
    getrf( n, n, A.data(), lda, ipiv.get(), &info );
 
    if( info > 0 ) {
       return ET(0);
    }
+#else
+   blockedGetrf( A, ipiv.get() );
+#endif
 
    ET determinant = ET(1);
 
@@ -0,0 +1,1319 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DMatDiagMultExpr.h
+//  \brief Header file for the dense matrix/compact diagonal matrix multiplication expression
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DMATDIAGMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DMATDIAGMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/MatMatMultExpr.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsCompactDiagonalMatrix.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DMATDIAGMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for multiplications between dense matrices and compact diagonal
+//        matrices.
+// \ingroup dense_matrix_expression
+//
+// The DMatDiagMultExpr class represents the compile time expression for the multiplication of
+// a compact diagonal matrix and a dense matrix (\f$ D*A \f$, i.e. the scaling of the rows of
+// \f$ A \f$) or of a dense matrix and a compact diagonal matrix (\f$ A*D \f$, i.e. the scaling
+// of the columns of \f$ A \f$). The storage order \a SO of the expression corresponds to the
+// storage order of the dense matrix operand. The expression is evaluated in a single pass over
+// the rows (row-major) or columns (column-major) of the dense matrix operand, which are scaled
+// either by a single diagonal element or elementwise by the vector of diagonal elements.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO >     // Storage order of the dense matrix operand
+class DMatDiagMultExpr
+   : public MatMatMultExpr< DenseMatrix< DMatDiagMultExpr<MT1,MT2,SO>, SO > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RT1 = ResultType_<MT1>;     //!< Result type of the left-hand side matrix expression.
+   using RT2 = ResultType_<MT2>;     //!< Result type of the right-hand side matrix expression.
+   using ET1 = ElementType_<RT1>;    //!< Element type of the left-hand side matrix expression.
+   using ET2 = ElementType_<RT2>;    //!< Element type of the right-hand side matrix expression.
+   using CT1 = CompositeType_<MT1>;  //!< Composite type of the left-hand side matrix expression.
+   using CT2 = CompositeType_<MT2>;  //!< Composite type of the right-hand side matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the scaling mode of the expression.
+   /*! The \a columnScaling compile time constant is set to 1 in case the compact diagonal matrix
+       is the right-hand side operand (\f$ A*D \f$, scaling of the columns) and to 0 in case it
+       is the left-hand side operand (\f$ D*A \f$, scaling of the rows). */
+   enum : bool { columnScaling = IsCompactDiagonalMatrix<MT2>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the broadcast of diagonal elements.
+   /*! In case the scaled lines of the dense matrix operand coincide with its storage order, each
+       row (row-major) or column (column-major) is scaled by a single diagonal element. Otherwise
+       each row or column is scaled elementwise by the vector of diagonal elements. */
+   enum : bool { broadcast = ( columnScaling == SO ) };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Type of the dense matrix operand.
+   using DMT = If_< IsCompactDiagonalMatrix<MT2>, MT1, MT2 >;
+
+   //! Type of the compact diagonal matrix operand.
+   using DT = If_< IsCompactDiagonalMatrix<MT2>, MT2, MT1 >;
+
+   //! Type of the vector of diagonal elements.
+   using DVT = typename DT::DiagonalType;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the dense matrix operand.
+   enum : bool { evaluateDense = IsComputation<DMT>::value || RequiresEvaluation<DMT>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPAssign struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case the target matrix is SMP assignable, \a value is set to 1 and the
+       expression specific parallel evaluation strategy is selected. Otherwise \a value is set
+       to 0 and the default strategy is chosen. */
+   template< typename T1 >
+   struct UseSMPAssign {
+      enum : bool { value = T1::smpAssignable };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the target matrix has the same storage order as the dense matrix operand and all
+       three involved data types are suited for a vectorized computation of the scaling, the
+       nested \value will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   struct UseVectorizedKernel {
+      enum : bool { value = useOptimizedKernels &&
+                            IsColumnMajorMatrix<T1>::value == SO &&
+                            T1::simdEnabled && T2::simdEnabled && T3::simdEnabled &&
+                            IsSIMDCombinable< ElementType_<T1>
+                                            , ElementType_<T2>
+                                            , ElementType_<T3> >::value &&
+                            HasSIMDMult< ElementType_<T2>, ElementType_<T3> >::value &&
+                            HasSIMDAdd< ElementType_<T1>, ElementType_<T1> >::value &&
+                            HasSIMDSub< ElementType_<T1>, ElementType_<T1> >::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = DMatDiagMultExpr<MT1,MT2,SO>;  //!< Type of this DMatDiagMultExpr instance.
+
+   //! Result type for expression template evaluations.
+   using ResultType    = MultTrait_< RemoveAdaptor_<RT1>, RemoveAdaptor_<RT2> >;
+
+   using OppositeType  = OppositeType_<ResultType>;   //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_<ResultType>;    //!< Resulting element type.
+   using SIMDType      = SIMDTrait_<ElementType>;     //!< Resulting SIMD element type.
+   using ReturnType    = const ElementType;           //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;            //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side matrix expression.
+   using LeftOperand = If_< IsExpression<MT1>, const MT1, const MT1& >;
+
+   //! Composite type of the right-hand side matrix expression.
+   using RightOperand = If_< IsExpression<MT2>, const MT2, const MT2& >;
+
+   //! Type for the assignment of the dense matrix operand.
+   using DCT = IfTrue_< evaluateDense, const ResultType_<DMT>, CompositeType_<DMT> >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   enum : size_t { SIMDSIZE = SIMDTrait<ElementType>::size };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DMatDiagMultExpr class.
+   //
+   // \param lhs The left-hand side operand of the multiplication expression.
+   // \param rhs The right-hand side operand of the multiplication expression.
+   */
+   explicit inline DMatDiagMultExpr( const MT1& lhs, const MT2& rhs ) noexcept
+      : lhs_( lhs )  // Left-hand side operand of the multiplication expression
+      , rhs_( rhs )  // Right-hand side operand of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.columns() == rhs.rows(), "Invalid matrix sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+      if( columnScaling )
+         return denseOperand()(i,j) * diagonalOperand().diagonal()[j];
+      else
+         return diagonalOperand().diagonal()[i] * denseOperand()(i,j);
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid matrix access index.
+   */
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(i,j);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const noexcept {
+      return lhs_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const noexcept {
+      return rhs_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side matrix operand.
+   //
+   // \return The left-hand side matrix operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side matrix operand.
+   //
+   // \return The right-hand side matrix operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return denseOperand().isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( rows() * columns() >= SMP_DMATSCALARMULT_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Operand selection***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the first of two operands.
+   */
+   template< typename T1, typename T2 >
+   static inline const T1& select( const T1& a, const T2& b, TrueType ) noexcept {
+      UNUSED_PARAMETER( b );
+      return a;
+   }
+
+   /*!\brief Selection of the second of two operands.
+   */
+   template< typename T1, typename T2 >
+   static inline const T2& select( const T1& a, const T2& b, FalseType ) noexcept {
+      UNUSED_PARAMETER( a );
+      return b;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Dense operand access************************************************************************
+   /*!\brief Returns the dense matrix operand.
+   //
+   // \return The dense matrix operand.
+   */
+   inline const DMT& denseOperand() const noexcept {
+      return select( lhs_, rhs_, BoolConstant<columnScaling>() );
+   }
+   //**********************************************************************************************
+
+   //**Diagonal operand access*********************************************************************
+   /*!\brief Returns the compact diagonal matrix operand.
+   //
+   // \return The compact diagonal matrix operand.
+   */
+   inline const DT& diagonalOperand() const noexcept {
+      return select( rhs_, lhs_, BoolConstant<columnScaling>() );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side operand of the multiplication expression.
+   RightOperand rhs_;  //!< Right-hand side operand of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Default assignment kernel*******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default assignment of a dense matrix-diagonal matrix multiplication to a range of
+   //        rows/columns of a dense matrix (\f$ C=D*A \f$ or \f$ C=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The dense matrix operand.
+   // \param d The vector of diagonal elements.
+   // \param kbegin The index of the first row (row-major) or column (column-major) to compute.
+   // \param kend The index one past the last row (row-major) or column (column-major) to compute.
+   // \return void
+   //
+   // This function implements the default assignment kernel for the scaling of the rows or
+   // columns of a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the dense matrix operand
+   static inline DisableIf_< UseVectorizedKernel<MT3,MT4,DVT> >
+      selectAssignKernel( MT3& C, const MT4& A, const DVT& d, size_t kbegin, size_t kend )
+   {
+      const size_t L( SO ? A.rows() : A.columns() );
+
+      for( size_t k=kbegin; k<kend; ++k ) {
+         for( size_t l=0UL; l<L; ++l ) {
+            const size_t i( SO ? l : k );
+            const size_t j( SO ? k : l );
+            C(i,j) = ( columnScaling )?( A(i,j) * d[j] ):( d[i] * A(i,j) );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized assignment kernel****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized assignment of a dense matrix-diagonal matrix multiplication to a range of
+   //        rows/columns of a dense matrix (\f$ C=D*A \f$ or \f$ C=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The dense matrix operand.
+   // \param d The vector of diagonal elements.
+   // \param kbegin The index of the first row (row-major) or column (column-major) to compute.
+   // \param kend The index one past the last row (row-major) or column (column-major) to compute.
+   // \return void
+   //
+   // This function implements the vectorized assignment kernel for the scaling of the rows or
+   // columns of a dense matrix. Each row (row-major) or column (column-major) is either scaled
+   // by a single, broadcasted diagonal element or elementwise by the vector of diagonal elements.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the dense matrix operand
+   static inline EnableIf_< UseVectorizedKernel<MT3,MT4,DVT> >
+      selectAssignKernel( MT3& C, const MT4& A, const DVT& d, size_t kbegin, size_t kend )
+   {
+      constexpr bool remainder( !IsPadded<MT3>::value || !IsPadded<MT4>::value || !IsPadded<DVT>::value );
+
+      const size_t L( SO ? A.rows() : A.columns() );
+
+      const size_t lpos( remainder ? ( L & size_t(-SIMDSIZE) ) : L );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( L - ( L % SIMDSIZE ) ) == lpos, "Invalid end calculation" );
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         size_t l( 0UL );
+
+         if( broadcast ) {
+            const SIMDType factor( set( d[k] ) );
+            for( ; l<lpos; l+=SIMDSIZE ) {
+               C.store( SO ? l : k, SO ? k : l, factor * A.load( SO ? l : k, SO ? k : l ) );
+            }
+         }
+         else {
+            for( ; l<lpos; l+=SIMDSIZE ) {
+               C.store( SO ? l : k, SO ? k : l, d.load(l) * A.load( SO ? l : k, SO ? k : l ) );
+            }
+         }
+
+         for( ; remainder && l<L; ++l ) {
+            const size_t i( SO ? l : k );
+            const size_t j( SO ? k : l );
+            C(i,j) = ( columnScaling )?( A(i,j) * d[j] ):( d[i] * A(i,j) );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default addition assignment kernel**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default addition assignment of a dense matrix-diagonal matrix multiplication to a
+   //        range of rows/columns of a dense matrix (\f$ C+=D*A \f$ or \f$ C+=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The dense matrix operand.
+   // \param d The vector of diagonal elements.
+   // \param kbegin The index of the first row (row-major) or column (column-major) to compute.
+   // \param kend The index one past the last row (row-major) or column (column-major) to compute.
+   // \return void
+   //
+   // This function implements the default addition assignment kernel for the scaling of the
+   // rows or columns of a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the dense matrix operand
+   static inline DisableIf_< UseVectorizedKernel<MT3,MT4,DVT> >
+      selectAddAssignKernel( MT3& C, const MT4& A, const DVT& d, size_t kbegin, size_t kend )
+   {
+      const size_t L( SO ? A.rows() : A.columns() );
+
+      for( size_t k=kbegin; k<kend; ++k ) {
+         for( size_t l=0UL; l<L; ++l ) {
+            const size_t i( SO ? l : k );
+            const size_t j( SO ? k : l );
+            C(i,j) += ( columnScaling )?( A(i,j) * d[j] ):( d[i] * A(i,j) );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized addition assignment kernel*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized addition assignment of a dense matrix-diagonal matrix multiplication to
+   //        a range of rows/columns of a dense matrix (\f$ C+=D*A \f$ or \f$ C+=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The dense matrix operand.
+   // \param d The vector of diagonal elements.
+   // \param kbegin The index of the first row (row-major) or column (column-major) to compute.
+   // \param kend The index one past the last row (row-major) or column (column-major) to compute.
+   // \return void
+   //
+   // This function implements the vectorized addition assignment kernel for the scaling of the
+   // rows or columns of a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the dense matrix operand
+   static inline EnableIf_< UseVectorizedKernel<MT3,MT4,DVT> >
+      selectAddAssignKernel( MT3& C, const MT4& A, const DVT& d, size_t kbegin, size_t kend )
+   {
+      constexpr bool remainder( !IsPadded<MT3>::value || !IsPadded<MT4>::value || !IsPadded<DVT>::value );
+
+      const size_t L( SO ? A.rows() : A.columns() );
+
+      const size_t lpos( remainder ? ( L & size_t(-SIMDSIZE) ) : L );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( L - ( L % SIMDSIZE ) ) == lpos, "Invalid end calculation" );
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         size_t l( 0UL );
+
+         if( broadcast ) {
+            const SIMDType factor( set( d[k] ) );
+            for( ; l<lpos; l+=SIMDSIZE ) {
+               const size_t i( SO ? l : k );
+               const size_t j( SO ? k : l );
+               C.store( i, j, C.load(i,j) + factor * A.load(i,j) );
+            }
+         }
+         else {
+            for( ; l<lpos; l+=SIMDSIZE ) {
+               const size_t i( SO ? l : k );
+               const size_t j( SO ? k : l );
+               C.store( i, j, C.load(i,j) + d.load(l) * A.load(i,j) );
+            }
+         }
+
+         for( ; remainder && l<L; ++l ) {
+            const size_t i( SO ? l : k );
+            const size_t j( SO ? k : l );
+            C(i,j) += ( columnScaling )?( A(i,j) * d[j] ):( d[i] * A(i,j) );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subtraction assignment kernel*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default subtraction assignment of a dense matrix-diagonal matrix multiplication to
+   //        a range of rows/columns of a dense matrix (\f$ C-=D*A \f$ or \f$ C-=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The dense matrix operand.
+   // \param d The vector of diagonal elements.
+   // \param kbegin The index of the first row (row-major) or column (column-major) to compute.
+   // \param kend The index one past the last row (row-major) or column (column-major) to compute.
+   // \return void
+   //
+   // This function implements the default subtraction assignment kernel for the scaling of the
+   // rows or columns of a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the dense matrix operand
+   static inline DisableIf_< UseVectorizedKernel<MT3,MT4,DVT> >
+      selectSubAssignKernel( MT3& C, const MT4& A, const DVT& d, size_t kbegin, size_t kend )
+   {
+      const size_t L( SO ? A.rows() : A.columns() );
+
+      for( size_t k=kbegin; k<kend; ++k ) {
+         for( size_t l=0UL; l<L; ++l ) {
+            const size_t i( SO ? l : k );
+            const size_t j( SO ? k : l );
+            C(i,j) -= ( columnScaling )?( A(i,j) * d[j] ):( d[i] * A(i,j) );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized subtraction assignment kernel****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized subtraction assignment of a dense matrix-diagonal matrix multiplication
+   //        to a range of rows/columns of a dense matrix (\f$ C-=D*A \f$ or \f$ C-=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The dense matrix operand.
+   // \param d The vector of diagonal elements.
+   // \param kbegin The index of the first row (row-major) or column (column-major) to compute.
+   // \param kend The index one past the last row (row-major) or column (column-major) to compute.
+   // \return void
+   //
+   // This function implements the vectorized subtraction assignment kernel for the scaling of
+   // the rows or columns of a dense matrix.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the dense matrix operand
+   static inline EnableIf_< UseVectorizedKernel<MT3,MT4,DVT> >
+      selectSubAssignKernel( MT3& C, const MT4& A, const DVT& d, size_t kbegin, size_t kend )
+   {
+      constexpr bool remainder( !IsPadded<MT3>::value || !IsPadded<MT4>::value || !IsPadded<DVT>::value );
+
+      const size_t L( SO ? A.rows() : A.columns() );
+
+      const size_t lpos( remainder ? ( L & size_t(-SIMDSIZE) ) : L );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( L - ( L % SIMDSIZE ) ) == lpos, "Invalid end calculation" );
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         size_t l( 0UL );
+
+         if( broadcast ) {
+            const SIMDType factor( set( d[k] ) );
+            for( ; l<lpos; l+=SIMDSIZE ) {
+               const size_t i( SO ? l : k );
+               const size_t j( SO ? k : l );
+               C.store( i, j, C.load(i,j) - factor * A.load(i,j) );
+            }
+         }
+         else {
+            for( ; l<lpos; l+=SIMDSIZE ) {
+               const size_t i( SO ? l : k );
+               const size_t j( SO ? k : l );
+               C.store( i, j, C.load(i,j) - d.load(l) * A.load(i,j) );
+            }
+         }
+
+         for( ; remainder && l<L; ++l ) {
+            const size_t i( SO ? l : k );
+            const size_t j( SO ? k : l );
+            C(i,j) -= ( columnScaling )?( A(i,j) * d[j] ):( d[i] * A(i,j) );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-diagonal matrix multiplication to a dense matrix
+   //        (\f$ C=D*A \f$ or \f$ C=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix-diagonal
+   // matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT3,SO2>& lhs, const DMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      DCT A( serial( rhs.denseOperand() ) );  // Evaluation of the dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      selectAssignKernel( ~lhs, A, rhs.diagonalOperand().diagonal(), 0UL, ( SO ? A.columns() : A.rows() ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a dense matrix-diagonal matrix multiplication to a sparse matrix
+   //        (\f$ C=D*A \f$ or \f$ C=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix-diagonal
+   // matrix multiplication expression to a sparse matrix.
+   */
+   template< typename MT3  // Type of the target sparse matrix
+           , bool SO2 >    // Storage order of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT3,SO2>& lhs, const DMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      using TmpType = IfTrue_< SO == SO2, ResultType, OppositeType >;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OppositeType );
+      BLAZE_CONSTRAINT_MATRICES_MUST_HAVE_SAME_STORAGE_ORDER( MT3, TmpType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const TmpType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a dense matrix-diagonal matrix multiplication to a dense
+   //        matrix (\f$ C+=D*A \f$ or \f$ C+=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a dense
+   // matrix-diagonal matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void addAssign( DenseMatrix<MT3,SO2>& lhs, const DMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      DCT A( serial( rhs.denseOperand() ) );  // Evaluation of the dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      selectAddAssignKernel( ~lhs, A, rhs.diagonalOperand().diagonal(), 0UL, ( SO ? A.columns() : A.rows() ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a dense matrix-diagonal matrix multiplication to a dense
+   //        matrix (\f$ C-=D*A \f$ or \f$ C-=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a dense
+   // matrix-diagonal matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void subAssign( DenseMatrix<MT3,SO2>& lhs, const DMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      DCT A( serial( rhs.denseOperand() ) );  // Evaluation of the dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      selectSubAssignKernel( ~lhs, A, rhs.diagonalOperand().diagonal(), 0UL, ( SO ? A.columns() : A.rows() ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse matrices***************************************************
+   // No special implementation for the subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense matrices**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a dense matrix-diagonal matrix multiplication to a dense
+   //        matrix (\f$ C\circ=D*A \f$ or \f$ C\circ=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a dense
+   // matrix-diagonal matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void schurAssign( DenseMatrix<MT3,SO2>& lhs, const DMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      schurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to sparse matrices*************************************************
+   // No special implementation for the Schur product assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense matrices*************************************************
+   // No special implementation for the multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse matrices************************************************
+   // No special implementation for the multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a dense matrix-diagonal matrix multiplication to a dense matrix
+   //        (\f$ C=D*A \f$ or \f$ C=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a dense matrix-
+   // diagonal matrix multiplication expression to a dense matrix. The rows (row-major) or
+   // columns (column-major) of the dense matrix operand are distributed among the available
+   // threads. Due to the explicit application of the SFINAE principle this function can only
+   // be selected by the compiler in case the target matrix is SMP assignable.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSMPAssign<MT3> >
+      smpAssign( DenseMatrix<MT3,SO2>& lhs, const DMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      DCT A( rhs.denseOperand() );  // Evaluation of the dense matrix operand
+      const DVT& d( rhs.diagonalOperand().diagonal() );
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      MT3& C( ~lhs );
+      const size_t lines( SO ? A.columns() : A.rows() );
+
+      if( rhs.canSMPAssign() ) {
+         smpFor( 0UL, lines, [&]( size_t first, size_t last ) {
+            selectAssignKernel( C, A, d, first, last );
+         } );
+      }
+      else {
+         selectAssignKernel( C, A, d, 0UL, lines );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse matrices***********************************************************
+   // No special implementation for the SMP assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a dense matrix-diagonal matrix multiplication to a dense
+   //        matrix (\f$ C+=D*A \f$ or \f$ C+=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a dense
+   // matrix-diagonal matrix multiplication expression to a dense matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case the target matrix is SMP assignable.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSMPAssign<MT3> >
+      smpAddAssign( DenseMatrix<MT3,SO2>& lhs, const DMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      DCT A( rhs.denseOperand() );  // Evaluation of the dense matrix operand
+      const DVT& d( rhs.diagonalOperand().diagonal() );
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      MT3& C( ~lhs );
+      const size_t lines( SO ? A.columns() : A.rows() );
+
+      if( rhs.canSMPAssign() ) {
+         smpFor( 0UL, lines, [&]( size_t first, size_t last ) {
+            selectAddAssignKernel( C, A, d, first, last );
+         } );
+      }
+      else {
+         selectAddAssignKernel( C, A, d, 0UL, lines );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse matrices**************************************************
+   // No special implementation for the SMP addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a dense matrix-diagonal matrix multiplication to a
+   //        dense matrix (\f$ C-=D*A \f$ or \f$ C-=A*D \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a dense
+   // matrix-diagonal matrix multiplication expression to a dense matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case the target matrix is SMP assignable.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSMPAssign<MT3> >
+      smpSubAssign( DenseMatrix<MT3,SO2>& lhs, const DMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      DCT A( rhs.denseOperand() );  // Evaluation of the dense matrix operand
+      const DVT& d( rhs.diagonalOperand().diagonal() );
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      MT3& C( ~lhs );
+      const size_t lines( SO ? A.columns() : A.rows() );
+
+      if( rhs.canSMPAssign() ) {
+         smpFor( 0UL, lines, [&]( size_t first, size_t last ) {
+            selectSubAssignKernel( C, A, d, first, last );
+         } );
+      }
+      else {
+         selectSubAssignKernel( C, A, d, 0UL, lines );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse matrices***********************************************
+   // No special implementation for the SMP subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( DMT );
+   BLAZE_CONSTRAINT_MUST_FORM_VALID_MATMATMULTEXPR( MT1, MT2 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a dense
+//        matrix (\f$ A=D*B \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side compact diagonal matrix for the multiplication.
+// \param rhs The right-hand side dense matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication of a compact diagonal matrix and a dense matrix,
+// i.e. the scaling of the rows of the dense matrix:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompactDiagonalMatrix<double,rowMajor> D;
+   blaze::DynamicMatrix<double,rowMajor> B, C;
+   // ... Resizing and initialization
+   C = D * B;
+   \endcode
+
+// The operator returns an expression representing a dense matrix of the higher-order element
+// type of the two involved matrix element types \a T and \a MT::ElementType. The storage order
+// of the resulting matrix corresponds to the storage order of the dense matrix operand. In case
+// the current number of columns of \a lhs and the current number of rows of \a rhs don't match,
+// a \a std::invalid_argument is thrown.
+*/
+template< typename T   // Data type of the left-hand side compact diagonal matrix
+        , bool SO1     // Storage order of the left-hand side compact diagonal matrix
+        , typename MT  // Type of the right-hand side dense matrix
+        , bool SO2 >   // Storage order of the right-hand side dense matrix
+inline decltype(auto)
+   operator*( const CompactDiagonalMatrix<T,SO1>& lhs, const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using ReturnType = const DMatDiagMultExpr< CompactDiagonalMatrix<T,SO1>, MT, SO2 >;
+   return ReturnType( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a dense matrix and a compact diagonal
+//        matrix (\f$ A=B*D \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side dense matrix for the multiplication.
+// \param rhs The right-hand side compact diagonal matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication of a dense matrix and a compact diagonal matrix,
+// i.e. the scaling of the columns of the dense matrix:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::DynamicMatrix<double,rowMajor> B, C;
+   blaze::CompactDiagonalMatrix<double,rowMajor> D;
+   // ... Resizing and initialization
+   C = B * D;
+   \endcode
+
+// The operator returns an expression representing a dense matrix of the higher-order element
+// type of the two involved matrix element types \a MT::ElementType and \a T. The storage order
+// of the resulting matrix corresponds to the storage order of the dense matrix operand. In case
+// the current number of columns of \a lhs and the current number of rows of \a rhs don't match,
+// a \a std::invalid_argument is thrown.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , bool SO1     // Storage order of the left-hand side dense matrix
+        , typename T   // Data type of the right-hand side compact diagonal matrix
+        , bool SO2 >   // Storage order of the right-hand side compact diagonal matrix
+inline decltype(auto)
+   operator*( const DenseMatrix<MT,SO1>& lhs, const CompactDiagonalMatrix<T,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using ReturnType = const DMatDiagMultExpr< MT, CompactDiagonalMatrix<T,SO2>, SO1 >;
+   return ReturnType( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a dense
+//        matrix-scalar multiplication expression (\f$ A=D*(B*s1) \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side compact diagonal matrix.
+// \param rhs The right-hand side dense matrix-scalar multiplication.
+// \return The scaled result matrix.
+//
+// This operator implements the performance optimized treatment of the multiplication of a
+// compact diagonal matrix and a dense matrix-scalar multiplication. It restructures the
+// expression \f$ A=D*(B*s1) \f$ to the expression \f$ A=(D*B)*s1 \f$.
+*/
+template< typename T     // Data type of the left-hand side compact diagonal matrix
+        , bool SO1       // Storage order of the left-hand side compact diagonal matrix
+        , typename MT    // Type of the dense matrix of the right-hand side expression
+        , typename ST    // Type of the scalar of the right-hand side expression
+        , bool SO2 >     // Storage order of the right-hand side expression
+inline decltype(auto)
+   operator*( const CompactDiagonalMatrix<T,SO1>& lhs, const DMatScalarMultExpr<MT,ST,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( (~lhs) * rhs.leftOperand() ) * rhs.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a dense matrix-scalar multiplication
+//        expression and a compact diagonal matrix (\f$ A=(B*s1)*D \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side dense matrix-scalar multiplication.
+// \param rhs The right-hand side compact diagonal matrix.
+// \return The scaled result matrix.
+//
+// This operator implements the performance optimized treatment of the multiplication of a
+// dense matrix-scalar multiplication and a compact diagonal matrix. It restructures the
+// expression \f$ A=(B*s1)*D \f$ to the expression \f$ A=(B*D)*s1 \f$.
+*/
+template< typename MT    // Type of the dense matrix of the left-hand side expression
+        , typename ST    // Type of the scalar of the left-hand side expression
+        , bool SO1       // Storage order of the left-hand side expression
+        , typename T     // Data type of the right-hand side compact diagonal matrix
+        , bool SO2 >     // Storage order of the right-hand side compact diagonal matrix
+inline decltype(auto)
+   operator*( const DMatScalarMultExpr<MT,ST,SO1>& lhs, const CompactDiagonalMatrix<T,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( lhs.leftOperand() * (~rhs) ) * lhs.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct Rows< DMatDiagMultExpr<MT1,MT2,SO> >
+   : public Rows<MT1>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct Columns< DMatDiagMultExpr<MT1,MT2,SO> >
+   : public Columns<MT2>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISALIGNED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsAligned< DMatDiagMultExpr<MT1,MT2,SO> >
+   : public BoolConstant< IsAligned< If_< IsCompactDiagonalMatrix<MT2>, MT1, MT2 > >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsLower< DMatDiagMultExpr<MT1,MT2,SO> >
+   : public BoolConstant< And< IsLower<MT1>, IsLower<MT2> >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSTRICTLYLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsStrictlyLower< DMatDiagMultExpr<MT1,MT2,SO> >
+   : public BoolConstant< Or< And< IsStrictlyLower<MT1>, IsLower<MT2> >
+                            , And< IsStrictlyLower<MT2>, IsLower<MT1> > >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsUpper< DMatDiagMultExpr<MT1,MT2,SO> >
+   : public BoolConstant< And< IsUpper<MT1>, IsUpper<MT2> >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSTRICTLYUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsStrictlyUpper< DMatDiagMultExpr<MT1,MT2,SO> >
+   : public BoolConstant< Or< And< IsStrictlyUpper<MT1>, IsUpper<MT2> >
+                            , And< IsStrictlyUpper<MT2>, IsUpper<MT1> > >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
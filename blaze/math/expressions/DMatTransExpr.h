@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/dense/Transpose.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -55,6 +56,8 @@
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -78,6 +81,7 @@
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/IsSame.h>
 
 
 namespace blaze {
@@ -124,6 +128,22 @@ class DMatTransExpr
       enum : bool { value = useAssign };
    };
    /*! \endcond */
+
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseBlockedTranspose struct is a helper struct for the selection of the serial evaluation
+       strategy. In case the dense matrix operand provides low-level data access and the target
+       matrix has the same storage order and element type as the operand and provides mutable
+       low-level data access, \a value is set to 1 and the transposition is performed by the
+       cache-oblivious blocked transposition kernel. Otherwise \a value is set to 0 and the
+       expression is evaluated via the subscript operator. */
+   template< typename MT2, bool SO2 >
+   struct UseBlockedTranspose {
+      enum : bool { value = !useAssign && SO2 != SO &&
+                            HasConstDataAccess<MT>::value && HasMutableDataAccess<MT2>::value &&
+                            IsSame< ElementType_<MT>, ElementType_<MT2> >::value };
+   };
+   /*! \endcond */
    //**********************************************************************************************
 
    //**Parallel evaluation strategy****************************************************************
@@ -419,6 +439,42 @@ class DMatTransExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Blocked assignment to dense matrices********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Blocked assignment of a dense matrix transposition expression to a dense matrix.
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side transposition expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a dense matrix
+   // transposition expression to a dense matrix with the same storage order as the operand.
+   // Instead of traversing the operand with a stride, the memory of the operand is transposed
+   // by the cache-oblivious blocked transposition kernel. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case both
+   // the operand and the target provide low-level data access. In parallel assignments, the
+   // kernel is applied to each submatrix of the target.
+   */
+   template< typename MT2  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseBlockedTranspose<MT2,SO2> >
+      assign( DenseMatrix<MT2,SO2>& lhs, const DMatTransExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const size_t lines ( SO2 ? rhs.dm_.columns() : rhs.dm_.rows()    );
+      const size_t length( SO2 ? rhs.dm_.rows()    : rhs.dm_.columns() );
+
+      blockedTranspose( lines, length, rhs.dm_.data(), rhs.dm_.spacing(),
+                        (~lhs).data(), (~lhs).spacing() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense matrix transposition expression to a sparse matrix.
@@ -0,0 +1,459 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DTensDTensMapExpr.h
+//  \brief Header file for the dense tensor/dense tensor map expression
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DTENSDTENSMAPEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DTENSDTENSMAPEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseTensor.h>
+#include <blaze/math/expressions/Expression.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/Functors.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/Decay.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DTENSDTENSMAPEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the dense tensor-dense tensor map() function.
+// \ingroup dense_tensor_expression
+//
+// The DTensDTensMapExpr class represents the compile time expression for the pairwise evaluation
+// of a binary custom operation on the elements of two dense tensors via the map() function. It
+// is also used to represent the addition (Add), subtraction (Sub), and Schur product (Mult) of
+// two dense tensors. Since all tensor expressions are elementwise, the expression is never
+// evaluated into a temporary but directly assigned row by row to the target tensor.
+*/
+template< typename TT1   // Type of the left-hand side dense tensor
+        , typename TT2   // Type of the right-hand side dense tensor
+        , typename OP >  // Type of the custom operation
+class DTensDTensMapExpr
+   : public Expression< DenseTensor< DTensDTensMapExpr<TT1,TT2,OP> > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using ET1 = ElementType_<TT1>;  //!< Element type of the left-hand side dense tensor expression.
+   using ET2 = ElementType_<TT2>;  //!< Element type of the right-hand side dense tensor expression.
+   using RN1 = ReturnType_<TT1>;   //!< Return type of the left-hand side dense tensor expression.
+   using RN2 = ReturnType_<TT2>;   //!< Return type of the right-hand side dense tensor expression.
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**SIMD support detection**********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the detection of the SIMD capabilities of the given custom operation.
+   struct UseSIMDEnabledFlag {
+      enum : bool { value = OP::BLAZE_TEMPLATE simdEnabled<ET1,ET2>() };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This = DTensDTensMapExpr<TT1,TT2,OP>;  //!< Type of this DTensDTensMapExpr instance.
+
+   //! Return type for expression template evaluations.
+   using ReturnType = decltype( std::declval<OP>()( std::declval<RN1>(), std::declval<RN2>() ) );
+
+   using ElementType   = Decay_<ReturnType>;         //!< Resulting element type.
+   using ResultType    = DynamicTensor<ElementType>;  //!< Result type for expression template evaluations.
+   using CompositeType = const DTensDTensMapExpr&;   //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side dense tensor expression.
+   using LeftOperand = If_< IsExpression<TT1>, const TT1, const TT1& >;
+
+   //! Composite type of the right-hand side dense tensor expression.
+   using RightOperand = If_< IsExpression<TT2>, const TT2, const TT2& >;
+
+   //! Data type of the custom binary operation.
+   using Operation = OP;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = TT1::simdEnabled && TT2::simdEnabled &&
+                               If_< HasSIMDEnabled<OP>, UseSIMDEnabledFlag, HasLoad<OP> >::value };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = TT1::smpAssignable && TT2::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DTensDTensMapExpr class.
+   //
+   // \param lhs The left-hand side dense tensor operand of the map expression.
+   // \param rhs The right-hand side dense tensor operand of the map expression.
+   // \param op The custom binary operation.
+   */
+   explicit inline DTensDTensMapExpr( const TT1& lhs, const TT2& rhs, OP op ) noexcept
+      : lhs_( lhs )  // Left-hand side dense tensor of the map expression
+      , rhs_( rhs )  // Right-hand side dense tensor of the map expression
+      , op_ ( op  )  // The custom binary operation
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 3D-access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t k, size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( k < lhs_.pages()  , "Invalid page access index"   );
+      BLAZE_INTERNAL_ASSERT( i < lhs_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < lhs_.columns(), "Invalid column access index" );
+      return op_( lhs_(k,i,j), rhs_(k,i,j) );
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the tensor.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return Reference to the accessed values.
+   */
+   BLAZE_ALWAYS_INLINE auto load( size_t k, size_t i, size_t j ) const noexcept {
+      BLAZE_INTERNAL_ASSERT( k < lhs_.pages()  , "Invalid page access index"   );
+      BLAZE_INTERNAL_ASSERT( i < lhs_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < lhs_.columns(), "Invalid column access index" );
+      return op_.load( lhs_.load(k,i,j), rhs_.load(k,i,j) );
+   }
+   //**********************************************************************************************
+
+   //**Pages function******************************************************************************
+   /*!\brief Returns the current number of pages of the tensor.
+   //
+   // \return The number of pages of the tensor.
+   */
+   inline size_t pages() const noexcept {
+      return lhs_.pages();
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the tensor.
+   //
+   // \return The number of rows of the tensor.
+   */
+   inline size_t rows() const noexcept {
+      return lhs_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the tensor.
+   //
+   // \return The number of columns of the tensor.
+   */
+   inline size_t columns() const noexcept {
+      return lhs_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side dense tensor operand.
+   //
+   // \return The left-hand side dense tensor operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side dense tensor operand.
+   //
+   // \return The right-hand side dense tensor operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the custom operation.
+   //
+   // \return A copy of the custom operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return lhs_.canAlias( alias ) || rhs_.canAlias( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return lhs_.isAliased( alias ) || rhs_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return lhs_.isAligned() && rhs_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( pages() * rows() * columns() >= SMP_DMATASSIGN_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side dense tensor of the map expression.
+   RightOperand rhs_;  //!< Right-hand side dense tensor of the map expression.
+   Operation    op_;   //!< The custom binary operation.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluates the given binary operation on each single element of the dense tensors
+//        \a lhs and \a rhs.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor operand.
+// \param rhs The right-hand side dense tensor operand.
+// \param op The custom, binary operation.
+// \return The binary operation applied to each single element of \a lhs and \a rhs.
+// \exception std::invalid_argument Tensor sizes do not match.
+//
+// The \a map() function evaluates the given binary operation on each element of the input
+// tensors \a lhs and \a rhs. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a map() function:
+
+   \code
+   blaze::DynamicTensor<double> A, B, C;
+   // ... Resizing and initialization
+   C = map( A, B, []( double x, double y ){ return std::min( x, y ); } );
+   \endcode
+*/
+template< typename TT1   // Type of the left-hand side dense tensor
+        , typename TT2   // Type of the right-hand side dense tensor
+        , typename OP >  // Type of the custom operation
+inline decltype(auto)
+   map( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).pages() != (~rhs).pages() || (~lhs).rows() != (~rhs).rows() ||
+       (~lhs).columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Tensor sizes do not match" );
+   }
+
+   using ReturnType = const DTensDTensMapExpr<TT1,TT2,OP>;
+   return ReturnType( ~lhs, ~rhs, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition operator for the addition of two dense tensors (\f$ A=B+C \f$).
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side tensor for the tensor addition.
+// \param rhs The right-hand side tensor for the tensor addition.
+// \return The sum of the two tensors.
+// \exception std::invalid_argument Tensor sizes do not match.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+inline decltype(auto)
+   operator+( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map( ~lhs, ~rhs, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction operator for the subtraction of two dense tensors (\f$ A=B-C \f$).
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side tensor for the tensor subtraction.
+// \param rhs The right-hand side tensor to be subtracted from the left-hand side tensor.
+// \return The difference of the two tensors.
+// \exception std::invalid_argument Tensor sizes do not match.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+inline decltype(auto)
+   operator-( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map( ~lhs, ~rhs, Sub() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product operator for the elementwise multiplication of two dense tensors
+//        (\f$ A=B \circ C \f$).
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side tensor for the Schur product.
+// \param rhs The right-hand side tensor for the Schur product.
+// \return The Schur product of the two tensors.
+// \exception std::invalid_argument Tensor sizes do not match.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+inline decltype(auto)
+   operator%( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map( ~lhs, ~rhs, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the componentwise minimum of the dense tensors \a lhs and \a rhs.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor operand.
+// \param rhs The right-hand side dense tensor operand.
+// \return The resulting dense tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+inline decltype(auto)
+   min( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map( ~lhs, ~rhs, Min() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the componentwise maximum of the dense tensors \a lhs and \a rhs.
+// \ingroup dense_tensor
+//
+// \param lhs The left-hand side dense tensor operand.
+// \param rhs The right-hand side dense tensor operand.
+// \return The resulting dense tensor.
+// \exception std::invalid_argument Tensor sizes do not match.
+*/
+template< typename TT1    // Type of the left-hand side dense tensor
+        , typename TT2 >  // Type of the right-hand side dense tensor
+inline decltype(auto)
+   max( const DenseTensor<TT1>& lhs, const DenseTensor<TT2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map( ~lhs, ~rhs, Max() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,387 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DTensMapExpr.h
+//  \brief Header file for the dense tensor map expression
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DTENSMAPEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DTENSMAPEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseTensor.h>
+#include <blaze/math/expressions/Expression.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/Functors.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/Decay.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DTENSMAPEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the dense tensor map() function.
+// \ingroup dense_tensor_expression
+//
+// The DTensMapExpr class represents the compile time expression for the evaluation of a custom
+// unary operation on each element of a dense tensor via the map() function.
+*/
+template< typename TT    // Type of the dense tensor
+        , typename OP >  // Type of the custom operation
+class DTensMapExpr
+   : public Expression< DenseTensor< DTensMapExpr<TT,OP> > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using ET = ElementType_<TT>;  //!< Element type of the dense tensor expression.
+   using RN = ReturnType_<TT>;   //!< Return type of the dense tensor expression.
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+   //**********************************************************************************************
+
+   //**SIMD support detection**********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the detection of the SIMD capabilities of the given custom operation.
+   struct UseSIMDEnabledFlag {
+      enum : bool { value = OP::BLAZE_TEMPLATE simdEnabled<ET>() };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This = DTensMapExpr<TT,OP>;  //!< Type of this DTensMapExpr instance.
+
+   //! Return type for expression template evaluations.
+   using ReturnType = decltype( std::declval<OP>()( std::declval<RN>() ) );
+
+   using ElementType   = Decay_<ReturnType>;         //!< Resulting element type.
+   using ResultType    = DynamicTensor<ElementType>;  //!< Result type for expression template evaluations.
+   using CompositeType = const DTensMapExpr&;        //!< Data type for composite expression templates.
+
+   //! Composite data type of the dense tensor expression.
+   using Operand = If_< IsExpression<TT>, const TT, const TT& >;
+
+   //! Data type of the custom unary operation.
+   using Operation = OP;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = TT::simdEnabled &&
+                               If_< HasSIMDEnabled<OP>, UseSIMDEnabledFlag, HasLoad<OP> >::value };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = TT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DTensMapExpr class.
+   //
+   // \param tens The dense tensor operand of the map expression.
+   // \param op The custom unary operation.
+   */
+   explicit inline DTensMapExpr( const TT& tens, OP op ) noexcept
+      : dt_( tens )  // Dense tensor of the map expression
+      , op_( op   )  // The custom unary operation
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 3D-access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t k, size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( k < dt_.pages()  , "Invalid page access index"   );
+      BLAZE_INTERNAL_ASSERT( i < dt_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < dt_.columns(), "Invalid column access index" );
+      return op_( dt_(k,i,j) );
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the tensor.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return Reference to the accessed values.
+   */
+   BLAZE_ALWAYS_INLINE auto load( size_t k, size_t i, size_t j ) const noexcept {
+      BLAZE_INTERNAL_ASSERT( k < dt_.pages()  , "Invalid page access index"   );
+      BLAZE_INTERNAL_ASSERT( i < dt_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < dt_.columns(), "Invalid column access index" );
+      return op_.load( dt_.load(k,i,j) );
+   }
+   //**********************************************************************************************
+
+   //**Pages function******************************************************************************
+   /*!\brief Returns the current number of pages of the tensor.
+   //
+   // \return The number of pages of the tensor.
+   */
+   inline size_t pages() const noexcept {
+      return dt_.pages();
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the tensor.
+   //
+   // \return The number of rows of the tensor.
+   */
+   inline size_t rows() const noexcept {
+      return dt_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the tensor.
+   //
+   // \return The number of columns of the tensor.
+   */
+   inline size_t columns() const noexcept {
+      return dt_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense tensor operand.
+   //
+   // \return The dense tensor operand.
+   */
+   inline Operand operand() const noexcept {
+      return dt_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the custom operation.
+   //
+   // \return A copy of the custom operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return dt_.canAlias( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return dt_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operand of the expression is properly aligned in memory.
+   //
+   // \return \a true in case the operand is aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return dt_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return dt_.canSMPAssign();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand   dt_;  //!< Dense tensor of the map expression.
+   Operation op_;  //!< The custom unary operation.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluates the given custom operation on each single element of the dense tensor \a dt.
+// \ingroup dense_tensor
+//
+// \param dt The input tensor.
+// \param op The custom operation.
+// \return The custom operation applied to each single element of \a dt.
+//
+// The \a map() function evaluates the given custom operation on each element of the input
+// tensor \a dt. The function returns an expression representing this operation.\n
+// The following example demonstrates the use of the \a map() function:
+
+   \code
+   blaze::DynamicTensor<double> A, B;
+   // ... Resizing and initialization
+   B = map( A, []( double d ){ return std::sqrt( d ); } );
+   \endcode
+*/
+template< typename TT    // Type of the dense tensor
+        , typename OP >  // Type of the custom operation
+inline decltype(auto) map( const DenseTensor<TT>& dt, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ReturnType = const DTensMapExpr<TT,OP>;
+   return ReturnType( ~dt, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Applies the \a abs() function to each single element of the dense tensor \a dt.
+// \ingroup dense_tensor
+//
+// \param dt The input tensor.
+// \return The resulting dense tensor.
+*/
+template< typename TT >  // Type of the dense tensor
+inline decltype(auto) abs( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map( ~dt, Abs() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the square root of each single element of the dense tensor \a dt.
+// \ingroup dense_tensor
+//
+// \param dt The input tensor; all elements must be in the range \f$[0..\infty)\f$.
+// \return The square root of each single element of \a dt.
+*/
+template< typename TT >  // Type of the dense tensor
+inline decltype(auto) sqrt( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map( ~dt, Sqrt() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes \f$ e^x \f$ for each single element of the dense tensor \a dt.
+// \ingroup dense_tensor
+//
+// \param dt The input tensor.
+// \return The resulting dense tensor.
+*/
+template< typename TT >  // Type of the dense tensor
+inline decltype(auto) exp( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map( ~dt, Exp() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the natural logarithm for each single element of the dense tensor \a dt.
+// \ingroup dense_tensor
+//
+// \param dt The input tensor; all elements must be in the range \f$[0..\infty)\f$.
+// \return The natural logarithm of each single element of \a dt.
+*/
+template< typename TT >  // Type of the dense tensor
+inline decltype(auto) log( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return map( ~dt, Log() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,390 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DTensScalarMultExpr.h
+//  \brief Header file for the dense tensor/scalar multiplication expression
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DTENSSCALARMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DTENSSCALARMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/Forward.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseTensor.h>
+#include <blaze/math/expressions/Expression.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/typetraits/UnderlyingElement.h>
+#include <blaze/system/Inline.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DTENSSCALARMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for dense tensor-scalar multiplications.
+// \ingroup dense_tensor_expression
+//
+// The DTensScalarMultExpr class represents the compile time expression for multiplications
+// between a dense tensor and a scalar value. It is also used to represent the negation of a
+// dense tensor and the division of a dense tensor by a floating point scalar value, which is
+// performed as multiplication with the reciprocal of the scalar.
+*/
+template< typename TT    // Type of the left-hand side dense tensor
+        , typename ST >  // Type of the right-hand side scalar value
+class DTensScalarMultExpr
+   : public Expression< DenseTensor< DTensScalarMultExpr<TT,ST> > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using ET = ElementType_<TT>;  //!< Element type of the dense tensor expression.
+   using RN = ReturnType_<TT>;   //!< Return type of the dense tensor expression.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = DTensScalarMultExpr<TT,ST>;  //!< Type of this DTensScalarMultExpr instance.
+   using ElementType   = MultTrait_<ET,ST>;           //!< Resulting element type.
+   using ResultType    = DynamicTensor<ElementType>;  //!< Result type for expression template evaluations.
+   using CompositeType = const DTensScalarMultExpr&;  //!< Data type for composite expression templates.
+
+   //! Return type for expression template evaluations.
+   using ReturnType = const ElementType;
+
+   //! Composite type of the left-hand side dense tensor expression.
+   using LeftOperand = If_< IsExpression<TT>, const TT, const TT& >;
+
+   //! Composite type of the right-hand side scalar value.
+   using RightOperand = ST;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = TT::simdEnabled &&
+                               IsNumeric<ET>::value &&
+                               ( HasSIMDMult<ET,ST>::value ||
+                                 HasSIMDMult<UnderlyingElement_<ET>,ST>::value ) };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = TT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DTensScalarMultExpr class.
+   //
+   // \param tensor The left-hand side dense tensor of the multiplication expression.
+   // \param scalar The right-hand side scalar of the multiplication expression.
+   */
+   explicit inline DTensScalarMultExpr( const TT& tensor, ST scalar ) noexcept
+      : tensor_( tensor )  // Left-hand side dense tensor of the multiplication expression
+      , scalar_( scalar )  // Right-hand side scalar of the multiplication expression
+   {}
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 3D-access to the tensor elements.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t k, size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( k < tensor_.pages()  , "Invalid page access index"   );
+      BLAZE_INTERNAL_ASSERT( i < tensor_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < tensor_.columns(), "Invalid column access index" );
+      return tensor_(k,i,j) * scalar_;
+   }
+   //**********************************************************************************************
+
+   //**Load function*******************************************************************************
+   /*!\brief Access to the SIMD elements of the tensor.
+   //
+   // \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return Reference to the accessed values.
+   */
+   BLAZE_ALWAYS_INLINE auto load( size_t k, size_t i, size_t j ) const noexcept {
+      BLAZE_INTERNAL_ASSERT( k < tensor_.pages()  , "Invalid page access index"   );
+      BLAZE_INTERNAL_ASSERT( i < tensor_.rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < tensor_.columns(), "Invalid column access index" );
+      return tensor_.load(k,i,j) * set( scalar_ );
+   }
+   //**********************************************************************************************
+
+   //**Pages function******************************************************************************
+   /*!\brief Returns the current number of pages of the tensor.
+   //
+   // \return The number of pages of the tensor.
+   */
+   inline size_t pages() const noexcept {
+      return tensor_.pages();
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the tensor.
+   //
+   // \return The number of rows of the tensor.
+   */
+   inline size_t rows() const noexcept {
+      return tensor_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the tensor.
+   //
+   // \return The number of columns of the tensor.
+   */
+   inline size_t columns() const noexcept {
+      return tensor_.columns();
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side dense tensor operand.
+   //
+   // \return The left-hand side dense tensor operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return tensor_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side scalar operand.
+   //
+   // \return The right-hand side scalar operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return scalar_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return tensor_.canAlias( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return tensor_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return tensor_.isAligned();
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return tensor_.canSMPAssign();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   LeftOperand  tensor_;  //!< Left-hand side dense tensor of the multiplication expression.
+   RightOperand scalar_;  //!< Right-hand side scalar of the multiplication expression.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL UNARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Unary minus operator for the negation of a dense tensor (\f$ A = -B \f$).
+// \ingroup dense_tensor
+//
+// \param dt The dense tensor to be negated.
+// \return The negation of the tensor.
+*/
+template< typename TT >  // Type of the dense tensor
+inline decltype(auto) operator-( const DenseTensor<TT>& dt )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ScalarType = UnderlyingBuiltin_<TT>;
+   using ReturnType = const DTensScalarMultExpr<TT,ScalarType>;
+   return ReturnType( ~dt, ScalarType(-1) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a dense tensor and a scalar value
+//        (\f$ A=B*s \f$).
+// \ingroup dense_tensor
+//
+// \param tens The left-hand side dense tensor for the multiplication.
+// \param scalar The right-hand side scalar value for the multiplication.
+// \return The scaled result tensor.
+//
+// The operator returns an expression representing a dense tensor of the higher-order element
+// type of the involved data types \a TT::ElementType and \a ST. Note that this operator only
+// works for scalar values of built-in data type.
+*/
+template< typename TT  // Type of the left-hand side dense tensor
+        , typename ST  // Type of the right-hand side scalar
+        , typename = EnableIf_< IsNumeric<ST> > >
+inline decltype(auto) operator*( const DenseTensor<TT>& tens, ST scalar )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ScalarType = MultTrait_< UnderlyingBuiltin_<TT>, ST >;
+   using ReturnType = const DTensScalarMultExpr<TT,ScalarType>;
+   return ReturnType( ~tens, scalar );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a scalar value and a dense tensor
+//        (\f$ A=s*B \f$).
+// \ingroup dense_tensor
+//
+// \param scalar The left-hand side scalar value for the multiplication.
+// \param tens The right-hand side dense tensor for the multiplication.
+// \return The scaled result tensor.
+*/
+template< typename ST  // Type of the left-hand side scalar
+        , typename TT  // Type of the right-hand side dense tensor
+        , typename = EnableIf_< IsNumeric<ST> > >
+inline decltype(auto) operator*( ST scalar, const DenseTensor<TT>& tens )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ScalarType = MultTrait_< ST, UnderlyingBuiltin_<TT> >;
+   using ReturnType = const DTensScalarMultExpr<TT,ScalarType>;
+   return ReturnType( ~tens, scalar );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division operator for the division of a dense tensor by a scalar value
+//        (\f$ A=B/s \f$).
+// \ingroup dense_tensor
+//
+// \param tens The left-hand side dense tensor for the division.
+// \param scalar The right-hand side scalar value for the division.
+// \return The scaled result tensor.
+//
+// The division is performed as multiplication with the reciprocal of the given scalar value.
+// Therefore this operator is only available in case the underlying element type of the result
+// is a floating point type.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename TT  // Type of the left-hand side dense tensor
+        , typename ST  // Type of the right-hand side scalar
+        , typename = EnableIf_< And< IsNumeric<ST>
+                                   , IsFloatingPoint< DivTrait_< UnderlyingBuiltin_<TT>, ST > > > > >
+inline decltype(auto) operator/( const DenseTensor<TT>& tens, ST scalar )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_USER_ASSERT( scalar != ST(0), "Division by zero detected" );
+
+   using ScalarType = DivTrait_< UnderlyingBuiltin_<TT>, ST >;
+   using ReturnType = const DTensScalarMultExpr<TT,ScalarType>;
+   return ReturnType( ~tens, ScalarType(1)/ScalarType(scalar) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
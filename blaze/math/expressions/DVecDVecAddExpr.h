@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/constraints/VecVecAddExpr.h>
+#include <blaze/math/dispatch/Dispatch.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -143,6 +144,19 @@ class DVecDVecAddExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Runtime dispatched evaluation strategy******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! In case the addition expression is evaluated via the subscript operator and the target
+       vector type and the two dense vector operands are suited for a runtime dispatched kernel,
+       the nested \a value will be set to 1, otherwise it will be 0. */
+   template< typename VT >
+   struct UseDispatchedAssign {
+      enum : bool { value = !useAssign && UseDispatchedKernel<VT,VT1,VT2>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Parallel evaluation strategy****************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper structure for the explicit application of the SFINAE principle.
@@ -634,6 +648,34 @@ class DVecDVecAddExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Runtime dispatched assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Runtime dispatched assignment of a dense vector-dense vector addition to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side addition expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a dense vector-dense vector addition expression
+   // to a dense vector by means of the fastest kernel variant supported by the executing CPU.
+   // Due to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the runtime dispatch mode is active and the target vector and both
+   // operands provide direct access to their single or double precision elements.
+   */
+   template< typename VT >  // Type of the target dense vector
+   friend inline EnableIf_< UseDispatchedAssign<VT> >
+      assign( DenseVector<VT,TF>& lhs, const DVecDVecAddExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      dispatchAdd( ~lhs, rhs.lhs_, rhs.rhs_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a dense vector-dense vector addition to a sparse vector.
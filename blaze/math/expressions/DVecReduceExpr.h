@@ -0,0 +1,826 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/DVecReduceExpr.h
+//  \brief Header file for the dense vector reduction expression
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_DVECREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_DVECREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecMapExpr.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/VecReduceExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/SqrAbs.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Template.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasMember.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  DENSE VECTOR REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the dense vector reduction operation.
+// \ingroup dense_vector
+//
+// The DVecReduceExprHelper evaluates to \a true in case the reduction of a dense vector of
+// type \a VT by means of the reduction operation \a OP can be vectorized.
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP >  // Type of the reduction operation
+struct DVecReduceExprHelper
+{
+ private:
+   //**Type definitions****************************************************************************
+   using CT = RemoveReference_< CompositeType_<VT> >;  //!< Composite type of the dense vector.
+   using ET = ElementType_<CT>;                        //!< Element type of the dense vector.
+
+   //! Definition of the HasSIMDEnabled type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasSIMDEnabled, simdEnabled );
+
+   //! Definition of the HasLoad type trait.
+   BLAZE_CREATE_HAS_DATA_OR_FUNCTION_MEMBER_TYPE_TRAIT( HasLoad, load );
+
+   //! Helper structure for the query of the simdEnabled() function of the reduction operation.
+   struct UseSIMDEnabledFlag {
+      enum : bool { value = OP::BLAZE_TEMPLATE simdEnabled<ET,ET>() };
+   };
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   enum : bool { value = useOptimizedKernels && CT::simdEnabled &&
+                         If_< HasSIMDEnabled<OP>, UseSIMDEnabledFlag, HasLoad<OP> >::value };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the serial reduction of the given dense vector for all element
+// types and reduction operations that cannot be vectorized. In case the size of the vector
+// is 0, the function returns the default value of the element type.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline DisableIf_< DVecReduceExprHelper<VT,OP>, ElementType_<VT> >
+   dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   using CT = CompositeType_<VT>;
+   using ET = ElementType_<VT>;
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return ET();
+
+   CT tmp( ~dv );
+
+   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
+
+   ET redux( tmp[0UL] );
+
+   for( size_t i=1UL; i<N; ++i ) {
+      redux = op( redux, tmp[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function implements the vectorized serial reduction of the given dense vector. The
+// SIMD elements of the vector are combined via four independent accumulators, which are
+// reduced horizontally at the end of the computation. The remaining scalar elements are
+// combined with the result in a final scalar loop. In case the size of the vector is 0, the
+// function returns the default value of the element type.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline EnableIf_< DVecReduceExprHelper<VT,OP>, ElementType_<VT> >
+   dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   using CT = CompositeType_<VT>;
+   using ET = ElementType_<VT>;
+
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   const size_t N( (~dv).size() );
+
+   if( N == 0UL ) return ET();
+
+   CT tmp( ~dv );
+
+   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
+
+   const size_t ipos( N & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( N - ( N % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   ET redux{};
+   size_t i( 0UL );
+
+   if( ipos >= SIMDSIZE*4UL )
+   {
+      SIMDTrait_<ET> xmm1( tmp.load(              0UL ) );
+      SIMDTrait_<ET> xmm2( tmp.load( SIMDSIZE         ) );
+      SIMDTrait_<ET> xmm3( tmp.load( SIMDSIZE*2UL     ) );
+      SIMDTrait_<ET> xmm4( tmp.load( SIMDSIZE*3UL     ) );
+
+      for( i=SIMDSIZE*4UL; (i+SIMDSIZE*3UL) < ipos; i+=SIMDSIZE*4UL ) {
+         xmm1 = op.load( xmm1, tmp.load( i              ) );
+         xmm2 = op.load( xmm2, tmp.load( i+SIMDSIZE     ) );
+         xmm3 = op.load( xmm3, tmp.load( i+SIMDSIZE*2UL ) );
+         xmm4 = op.load( xmm4, tmp.load( i+SIMDSIZE*3UL ) );
+      }
+
+      if( (i+SIMDSIZE) < ipos ) {
+         xmm1 = op.load( xmm1, tmp.load( i          ) );
+         xmm2 = op.load( xmm2, tmp.load( i+SIMDSIZE ) );
+         i += SIMDSIZE*2UL;
+      }
+
+      if( i < ipos ) {
+         xmm3 = op.load( xmm3, tmp.load( i ) );
+         i += SIMDSIZE;
+      }
+
+      xmm1 = op.load( xmm1, xmm2 );
+      xmm3 = op.load( xmm3, xmm4 );
+      xmm1 = op.load( xmm1, xmm3 );
+      redux = reduce( xmm1, op );
+   }
+   else if( ipos >= SIMDSIZE*2UL )
+   {
+      SIMDTrait_<ET> xmm1( tmp.load( 0UL      ) );
+      SIMDTrait_<ET> xmm2( tmp.load( SIMDSIZE ) );
+
+      i = SIMDSIZE*2UL;
+
+      if( i < ipos ) {
+         xmm1 = op.load( xmm1, tmp.load( i ) );
+         i += SIMDSIZE;
+      }
+
+      xmm1 = op.load( xmm1, xmm2 );
+      redux = reduce( xmm1, op );
+   }
+   else if( ipos == SIMDSIZE )
+   {
+      const SIMDTrait_<ET> xmm1( tmp.load( 0UL ) );
+      redux = reduce( xmm1, op );
+      i = SIMDSIZE;
+   }
+   else
+   {
+      redux = tmp[0UL];
+      i = 1UL;
+   }
+
+   for( ; i<N; ++i ) {
+      redux = op( redux, tmp[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DVECREDUCEEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Expression object for the blockwise reduction of a dense vector.
+// \ingroup dense_vector_expression
+//
+// The DVecReduceExpr class represents the compile time expression for the blockwise reduction
+// of a dense vector. Each element of the expression represents the reduction of a contiguous
+// block of \a blocksize elements of the dense vector operand. The expression is used for the
+// parallel evaluation of dense vector reductions: the blocks are reduced in parallel via the
+// SMP assignment of the expression, the partial results are combined serially afterwards.
+*/
+template< typename VT  // Type of the dense vector
+        , typename OP  // Type of the reduction operation
+        , bool TF >    // Transpose flag
+class DVecReduceExpr
+   : public VecReduceExpr< DenseVector< DVecReduceExpr<VT,OP,TF>, TF > >
+   , private Computation
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This          = DVecReduceExpr<VT,OP,TF>;                //!< Type of this DVecReduceExpr instance.
+   using ResultType    = DynamicVector< ElementType_<VT>, TF >;  //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_<ResultType>;              //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_<ResultType>;                //!< Resulting element type.
+   using ReturnType    = const ElementType;                       //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;                        //!< Data type for composite expression templates.
+
+   //! Composite data type of the dense vector expression.
+   using Operand = If_< IsExpression<VT>, const VT, const VT& >;
+
+   //! Data type of the reduction operation.
+   using Operation = OP;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = VT::smpAssignable };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the DVecReduceExpr class.
+   //
+   // \param dv The dense vector operand of the reduction expression.
+   // \param op The reduction operation.
+   // \param blocksize The number of elements per reduction block.
+   */
+   explicit inline DVecReduceExpr( const VT& dv, OP op, size_t blocksize ) noexcept
+      : dv_       ( dv )         // Dense vector of the reduction expression
+      , op_       ( op )         // The reduction operation
+      , blocksize_( blocksize )  // The number of elements per reduction block
+   {
+      BLAZE_INTERNAL_ASSERT( blocksize_ > 0UL, "Invalid block size" );
+   }
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < size(), "Invalid vector access index" );
+      const size_t begin( index*blocksize_ );
+      const size_t n( min( blocksize_, dv_.size() - begin ) );
+      return dvecreduce( subvector<unaligned>( dv_, begin, n ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= size() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return ( dv_.size() + blocksize_ - 1UL ) / blocksize_;
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the dense vector operand.
+   //
+   // \return The dense vector operand.
+   */
+   inline Operand operand() const noexcept {
+      return dv_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the reduction operation.
+   //
+   // \return A copy of the reduction operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**Blocksize access****************************************************************************
+   /*!\brief Returns the number of elements per reduction block.
+   //
+   // \return The number of elements per reduction block.
+   */
+   inline size_t blocksize() const noexcept {
+      return blocksize_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return dv_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return dv_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return size() > 1UL;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand   dv_;         //!< Dense vector of the reduction expression.
+   Operation op_;         //!< The reduction operation.
+   size_t    blocksize_;  //!< The number of elements per reduction block.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( VT );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( VT, TF );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL RESTRUCTURING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific subvector of the given blockwise dense vector reduction.
+// \ingroup dense_vector
+//
+// \param vector The constant blockwise dense vector reduction.
+// \param index The index of the first element of the subvector.
+// \param size The size of the subvector.
+// \return View on the specified subvector of the blockwise reduction.
+//
+// This function returns an expression representing the specified subvector of the given
+// blockwise dense vector reduction, i.e. the blockwise reduction of the according section
+// of the dense vector operand.
+*/
+template< bool AF        // Alignment flag
+        , typename VT    // Type of the dense vector
+        , typename OP    // Type of the reduction operation
+        , bool TF >      // Transpose flag
+inline decltype(auto) subvector( const DVecReduceExpr<VT,OP,TF>& vector, size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( index + size <= vector.size(), "Invalid subvector specification" );
+
+   const size_t blocksize( vector.blocksize() );
+   const size_t begin( index*blocksize );
+   const size_t n( min( size*blocksize, vector.operand().size() - begin ) );
+
+   decltype(auto) sv( subvector<unaligned>( vector.operand(), begin, n ) );
+
+   using ReturnType = const DVecReduceExpr< RemoveCV_< RemoveReference_< decltype( sv ) > >, OP, TF >;
+   return ReturnType( sv, vector.operation(), blocksize );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector \a dv by means of the given reduction operation
+// \a op:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( a, blaze::Add() );
+   const double totalsum2 = reduce( a, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// As demonstrated in the example it is possible to pass any binary callable as custom reduction
+// operation. In case the operation provides a \a load() function for SIMD vectors (such as for
+// instance blaze::Add, blaze::Mult, blaze::Min, and blaze::Max), the reduction is vectorized.
+// In case the size of the vector exceeds the \a BLAZE_SMP_DVECREDUCE_THRESHOLD and SMP is
+// enabled, the reduction is performed in parallel. Due to the vectorization and the parallel
+// execution the elements are combined in an unspecified order. Therefore the given operation
+// must be associative and commutative. In case the size of the vector is 0, the function
+// returns the default value of the element type (e.g. 0 in case of fundamental data types).
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline decltype(auto) reduce( const DenseVector<VT,TF>& dv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_<VT>;
+   using ET = ElementType_<VT>;
+   using OT = RemoveCV_< RemoveReference_<CT> >;
+
+   constexpr size_t SIMDSIZE = SIMDTrait<ET>::size;
+
+   CT tmp( ~dv );
+
+   const size_t N( tmp.size() );
+
+   if( !IsSMPAssignable<VT>::value || N < SMP_DVECREDUCE_THRESHOLD || getNumThreads() < 2UL ||
+       isSerialSectionActive() || isParallelSectionActive() ) {
+      return dvecreduce( tmp, op );
+   }
+
+   const size_t parts( getNumThreads() * 4UL );
+   const size_t blocksize( ( ( N - 1UL ) / parts + SIMDSIZE ) & size_t(-SIMDSIZE) );
+
+   const DynamicVector<ET,TF> partial( DVecReduceExpr<OT,OP,TF>( tmp, op, blocksize ) );
+
+   return dvecreduce( partial, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of addition.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector \a dv by means of addition:
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 2, 3, 4 };
+
+   const int totalsum = sum( a );  // Results in 10
+   \endcode
+
+// In case the size of the vector is 0, the function returns 0.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) sum( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given dense vector by means of multiplication.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the given dense vector \a dv by means of multiplication:
+
+   \code
+   blaze::DynamicVector<int> a{ 1, 2, 3, 4 };
+
+   const int totalprod = prod( a );  // Results in 24
+   \endcode
+
+// In case the size of the vector is 0, the function returns 1 (the empty product).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) prod( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~dv).size() == 0UL ) return ElementType_<VT>( 1 );
+
+   return reduce( ~dv, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the smallest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The smallest dense vector element.
+//
+// This function returns the smallest element of the given dense vector. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
+// of fundamental data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) min( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Min() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the largest element of the dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector.
+// \return The largest dense vector element.
+//
+// This function returns the largest element of the given dense vector. This function can
+// only be used for element types that support the smaller-than relationship. In case the
+// vector currently has a size of 0, the returned value is the default value (e.g. 0 in case
+// of fundamental data types).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) max( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~dv, Max() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the squared L2 norm for the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The squared L2 norm of the given dense vector.
+//
+// This function computes the squared L2 norm of the given dense vector, i.e. the sum of the
+// squared absolute values of all vector elements:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+   const double l2 = sqrNorm( a );
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) sqrNorm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( map( ~dv, SqrAbs() ), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm for the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The L2 norm of the given dense vector.
+//
+// This function computes the L2 norm (i.e. the Euclidean norm) of the given dense vector:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+   const double l2 = norm( a );
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) norm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sqrt( sqrNorm( ~dv ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L1 norm for the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The L1 norm of the given dense vector.
+//
+// This function computes the L1 norm of the given dense vector, i.e. the sum of the absolute
+// values of all vector elements:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+   const double l1 = l1Norm( a );
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) l1Norm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( abs( ~dv ), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm for the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The L2 norm of the given dense vector.
+//
+// This function computes the L2 norm of the given dense vector. It is equivalent to the
+// norm() function:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+   const double l2 = l2Norm( a );
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) l2Norm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return norm( ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the infinity norm for the given dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the norm computation.
+// \return The infinity norm of the given dense vector.
+//
+// This function computes the infinity norm (i.e. the maximum norm) of the given dense vector,
+// i.e. the largest absolute value of all vector elements:
+
+   \code
+   blaze::DynamicVector<double> a;
+   // ... Resizing and initialization
+   const double linf = linfNorm( a );
+   \endcode
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) linfNorm( const DenseVector<VT,TF>& dv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( abs( ~dv ), Max() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
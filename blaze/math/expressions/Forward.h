@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_EXPRESSIONS_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/ReductionFlag.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -44,13 +51,17 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, typename, bool > class BandDVecMultExpr;
 template< typename, bool > struct DenseMatrix;
+template< typename > struct DenseTensor;
 template< typename, bool > struct DenseVector;
 template< typename, bool > class DMatDeclDiagExpr;
 template< typename, bool > class DMatDeclHermExpr;
 template< typename, bool > class DMatDeclLowExpr;
 template< typename, bool > class DMatDeclSymExpr;
 template< typename, bool > class DMatDeclUppExpr;
+template< typename, typename, bool > class DMatBandMultExpr;
+template< typename, typename, bool > class DMatDiagMultExpr;
 template< typename, typename, bool > class DMatDMatAddExpr;
 template< typename, typename, typename, bool > class DMatDMatMapExpr;
 template< typename, typename, bool, bool, bool, bool > class DMatDMatMultExpr;
@@ -60,6 +71,7 @@ template< typename, typename > class DMatDVecMultExpr;
 template< typename, bool > class DMatEvalExpr;
 template< typename, typename, bool > class DMatMapExpr;
 template< typename, bool > class DMatInvExpr;
+template< typename, typename, ReductionFlag > class DMatReduceExpr;
 template< typename, typename, bool > class DMatScalarDivExpr;
 template< typename, typename, bool > class DMatScalarMultExpr;
 template< typename, bool > class DMatSerialExpr;
@@ -79,6 +91,9 @@ template< typename, typename > class DMatTSMatAddExpr;
 template< typename, typename, bool, bool, bool, bool > class DMatTSMatMultExpr;
 template< typename, typename > class DMatTSMatSchurExpr;
 template< typename, typename > class DMatTSMatSubExpr;
+template< typename, typename, typename > class DTensDTensMapExpr;
+template< typename, typename > class DTensMapExpr;
+template< typename, typename > class DTensScalarMultExpr;
 template< typename, typename, bool > class DVecDVecAddExpr;
 template< typename, typename, bool > class DVecDVecCrossExpr;
 template< typename, typename, bool > class DVecDVecDivExpr;
@@ -88,6 +103,7 @@ template< typename, typename > class DVecDVecOuterExpr;
 template< typename, typename, bool > class DVecDVecSubExpr;
 template< typename, bool > class DVecEvalExpr;
 template< typename, typename, bool > class DVecMapExpr;
+template< typename, typename, bool > class DVecReduceExpr;
 template< typename, typename, bool > class DVecScalarDivExpr;
 template< typename, typename, bool > class DVecScalarMultExpr;
 template< typename, bool > class DVecSerialExpr;
@@ -99,17 +115,20 @@ template< typename, typename, bool > class DVecSVecSubExpr;
 template< typename, bool > class DVecTransExpr;
 template< typename, bool > class DVecTransposer;
 template< typename, bool > struct Matrix;
+template< typename, typename, bool > class PMatDVecMultExpr;
 template< typename, bool > class SMatDeclDiagExpr;
 template< typename, bool > class SMatDeclHermExpr;
 template< typename, bool > class SMatDeclLowExpr;
 template< typename, bool > class SMatDeclSymExpr;
 template< typename, bool > class SMatDeclUppExpr;
+template< typename, typename, bool > class SMatDiagMultExpr;
 template< typename, typename, bool, bool, bool, bool > class SMatDMatMultExpr;
 template< typename, typename > class SMatDMatSchurExpr;
 template< typename, typename, bool > class SMatDMatSubExpr;
 template< typename, typename > class SMatDVecMultExpr;
 template< typename, bool > class SMatEvalExpr;
 template< typename, typename, bool > class SMatMapExpr;
+template< typename, typename, ReductionFlag > class SMatReduceExpr;
 template< typename, typename, bool > class SMatScalarDivExpr;
 template< typename, typename, bool > class SMatScalarMultExpr;
 template< typename, bool > class SMatSerialExpr;
@@ -523,6 +542,12 @@ decltype(auto) map( const DenseMatrix<MT,SO>&, OP );
 template< typename MT, bool SO, typename OP >
 decltype(auto) map( const SparseMatrix<MT,SO>&, OP );
 
+template< ReductionFlag RF, typename MT, bool SO, typename OP >
+decltype(auto) reduce( const DenseMatrix<MT,SO>&, OP );
+
+template< ReductionFlag RF, typename MT, bool SO, typename OP >
+decltype(auto) reduce( const SparseMatrix<MT,SO>&, OP );
+
 template< typename VT1, typename VT2, bool TF, typename OP >
 decltype(auto) map( const DenseVector<VT1,TF>&, const DenseVector<VT2,TF>&, OP );
 
@@ -0,0 +1,1130 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/SMatDiagMultExpr.h
+//  \brief Header file for the sparse matrix/compact diagonal matrix multiplication expression
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_SMATDIAGMULTEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_SMATDIAGMULTEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/MatMatMultExpr.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/constraints/StorageOrder.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/Columns.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsCompactDiagonalMatrix.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/typetraits/Rows.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SMATDIAGMULTEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for multiplications between sparse matrices and compact diagonal
+//        matrices.
+// \ingroup sparse_matrix_expression
+//
+// The SMatDiagMultExpr class represents the compile time expression for the multiplication of
+// a compact diagonal matrix and a sparse matrix (\f$ D*A \f$, i.e. the scaling of the rows of
+// \f$ A \f$) or of a sparse matrix and a compact diagonal matrix (\f$ A*D \f$, i.e. the scaling
+// of the columns of \f$ A \f$). The storage order \a SO of the expression corresponds to the
+// storage order of the sparse matrix operand. The sparsity pattern of the result is the pattern
+// of the sparse matrix operand, which is why the expression is evaluated in a single pass over
+// its non-zero elements.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO >     // Storage order of the sparse matrix operand
+class SMatDiagMultExpr
+   : public MatMatMultExpr< SparseMatrix< SMatDiagMultExpr<MT1,MT2,SO>, SO > >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using RT1 = ResultType_<MT1>;     //!< Result type of the left-hand side matrix expression.
+   using RT2 = ResultType_<MT2>;     //!< Result type of the right-hand side matrix expression.
+   using CT1 = CompositeType_<MT1>;  //!< Composite type of the left-hand side matrix expression.
+   using CT2 = CompositeType_<MT2>;  //!< Composite type of the right-hand side matrix expression.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the scaling mode of the expression.
+   /*! The \a columnScaling compile time constant is set to 1 in case the compact diagonal matrix
+       is the right-hand side operand (\f$ A*D \f$, scaling of the columns) and to 0 in case it
+       is the left-hand side operand (\f$ D*A \f$, scaling of the rows). */
+   enum : bool { columnScaling = IsCompactDiagonalMatrix<MT2>::value };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Type of the sparse matrix operand.
+   using SMT = If_< IsCompactDiagonalMatrix<MT2>, MT1, MT2 >;
+
+   //! Type of the compact diagonal matrix operand.
+   using DT = If_< IsCompactDiagonalMatrix<MT2>, MT2, MT1 >;
+
+   //! Type of the vector of diagonal elements.
+   using DVT = typename DT::DiagonalType;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Compilation switch for the composite type of the sparse matrix operand.
+   enum : bool { evaluateSparse = IsComputation<SMT>::value || RequiresEvaluation<SMT>::value };
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   /*! The UseSMPAssign struct is a helper struct for the selection of the parallel evaluation
+       strategy. In case the target matrix is SMP assignable, \a value is set to 1 and the
+       expression specific parallel evaluation strategy is selected. Otherwise \a value is set
+       to 0 and the default strategy is chosen. */
+   template< typename T1 >
+   struct UseSMPAssign {
+      enum : bool { value = T1::smpAssignable };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = SMatDiagMultExpr<MT1,MT2,SO>;  //!< Type of this SMatDiagMultExpr instance.
+
+   //! Result type for expression template evaluations.
+   using ResultType    = MultTrait_< RemoveAdaptor_<RT1>, RemoveAdaptor_<RT2> >;
+
+   using OppositeType  = OppositeType_<ResultType>;   //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_<ResultType>;  //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_<ResultType>;    //!< Resulting element type.
+   using ReturnType    = const ElementType;           //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;            //!< Data type for composite expression templates.
+
+   //! Composite type of the left-hand side matrix expression.
+   using LeftOperand = If_< IsExpression<MT1>, const MT1, const MT1& >;
+
+   //! Composite type of the right-hand side matrix expression.
+   using RightOperand = If_< IsExpression<MT2>, const MT2, const MT2& >;
+
+   //! Type for the assignment of the sparse matrix operand.
+   using SCT = IfTrue_< evaluateSparse, const ResultType_<SMT>, CompositeType_<SMT> >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMatDiagMultExpr class.
+   //
+   // \param lhs The left-hand side operand of the multiplication expression.
+   // \param rhs The right-hand side operand of the multiplication expression.
+   */
+   explicit inline SMatDiagMultExpr( const MT1& lhs, const MT2& rhs ) noexcept
+      : lhs_( lhs )  // Left-hand side operand of the multiplication expression
+      , rhs_( rhs )  // Right-hand side operand of the multiplication expression
+   {
+      BLAZE_INTERNAL_ASSERT( lhs.columns() == rhs.rows(), "Invalid matrix sizes" );
+   }
+   //**********************************************************************************************
+
+   //**Access operator*****************************************************************************
+   /*!\brief 2D-access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator()( size_t i, size_t j ) const {
+      BLAZE_INTERNAL_ASSERT( i < rows()   , "Invalid row access index"    );
+      BLAZE_INTERNAL_ASSERT( j < columns(), "Invalid column access index" );
+
+      if( columnScaling )
+         return sparseOperand()(i,j) * diagonalOperand().diagonal()[j];
+      else
+         return diagonalOperand().diagonal()[i] * sparseOperand()(i,j);
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the matrix elements.
+   //
+   // \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+   // \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid matrix access index.
+   */
+   inline ReturnType at( size_t i, size_t j ) const {
+      if( i >= rows() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+      }
+      if( j >= columns() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+      }
+      return (*this)(i,j);
+   }
+   //**********************************************************************************************
+
+   //**Rows function*******************************************************************************
+   /*!\brief Returns the current number of rows of the matrix.
+   //
+   // \return The number of rows of the matrix.
+   */
+   inline size_t rows() const noexcept {
+      return lhs_.rows();
+   }
+   //**********************************************************************************************
+
+   //**Columns function****************************************************************************
+   /*!\brief Returns the current number of columns of the matrix.
+   //
+   // \return The number of columns of the matrix.
+   */
+   inline size_t columns() const noexcept {
+      return rhs_.columns();
+   }
+   //**********************************************************************************************
+
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of non-zero elements in the sparse matrix.
+   //
+   // \return The number of non-zero elements in the sparse matrix.
+   */
+   inline size_t nonZeros() const {
+      return sparseOperand().nonZeros();
+   }
+   //**********************************************************************************************
+
+   //**NonZeros function***************************************************************************
+   /*!\brief Returns the number of non-zero elements in the specified row/column.
+   //
+   // \param i The index of the row/column.
+   // \return The number of non-zero elements of row/column \a i.
+   */
+   inline size_t nonZeros( size_t i ) const {
+      return sparseOperand().nonZeros(i);
+   }
+   //**********************************************************************************************
+
+   //**Left operand access*************************************************************************
+   /*!\brief Returns the left-hand side matrix operand.
+   //
+   // \return The left-hand side matrix operand.
+   */
+   inline LeftOperand leftOperand() const noexcept {
+      return lhs_;
+   }
+   //**********************************************************************************************
+
+   //**Right operand access************************************************************************
+   /*!\brief Returns the right-hand side matrix operand.
+   //
+   // \return The right-hand side matrix operand.
+   */
+   inline RightOperand rightOperand() const noexcept {
+      return rhs_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return ( lhs_.isAliased( alias ) || rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return ( rows() * columns() >= SMP_DMATSCALARMULT_THRESHOLD );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Operand selection***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Selection of the first of two operands.
+   */
+   template< typename T1, typename T2 >
+   static inline const T1& select( const T1& a, const T2& b, TrueType ) noexcept {
+      UNUSED_PARAMETER( b );
+      return a;
+   }
+
+   /*!\brief Selection of the second of two operands.
+   */
+   template< typename T1, typename T2 >
+   static inline const T2& select( const T1& a, const T2& b, FalseType ) noexcept {
+      UNUSED_PARAMETER( a );
+      return b;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Sparse operand access***********************************************************************
+   /*!\brief Returns the sparse matrix operand.
+   //
+   // \return The sparse matrix operand.
+   */
+   inline const SMT& sparseOperand() const noexcept {
+      return select( lhs_, rhs_, BoolConstant<columnScaling>() );
+   }
+   //**********************************************************************************************
+
+   //**Diagonal operand access*********************************************************************
+   /*!\brief Returns the compact diagonal matrix operand.
+   //
+   // \return The compact diagonal matrix operand.
+   */
+   inline const DT& diagonalOperand() const noexcept {
+      return select( rhs_, lhs_, BoolConstant<columnScaling>() );
+   }
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   LeftOperand  lhs_;  //!< Left-hand side operand of the multiplication expression.
+   RightOperand rhs_;  //!< Right-hand side operand of the multiplication expression.
+   //**********************************************************************************************
+
+   //**Assignment kernel***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix-diagonal matrix multiplication to a range of rows/
+   //        columns of a dense matrix (\f$ C=D*A \f$ or \f$ C=A*D \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The sparse matrix operand.
+   // \param d The vector of diagonal elements.
+   // \param kbegin The index of the first row (row-major) or column (column-major) to compute.
+   // \param kend The index one past the last row (row-major) or column (column-major) to compute.
+   // \return void
+   //
+   // This function resets the given rows/columns of the target matrix and scatters the scaled
+   // non-zero elements of the sparse matrix operand.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the sparse matrix operand
+   static inline void
+      selectAssignKernel( MT3& C, const MT4& A, const DVT& d, size_t kbegin, size_t kend )
+   {
+      const size_t L( SO ? A.rows() : A.columns() );
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         for( size_t l=0UL; l<L; ++l ) {
+            reset( C( SO ? l : k, SO ? k : l ) );
+         }
+
+         const auto end( A.end(k) );
+         for( auto element=A.begin(k); element!=end; ++element ) {
+            const size_t i( SO ? element->index() : k );
+            const size_t j( SO ? k : element->index() );
+            C(i,j) = ( columnScaling )?( element->value() * d[j] ):( d[i] * element->value() );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment kernel******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a sparse matrix-diagonal matrix multiplication to a range of
+   //        rows/columns of a dense matrix (\f$ C+=D*A \f$ or \f$ C+=A*D \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The sparse matrix operand.
+   // \param d The vector of diagonal elements.
+   // \param kbegin The index of the first row (row-major) or column (column-major) to compute.
+   // \param kend The index one past the last row (row-major) or column (column-major) to compute.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the sparse matrix operand
+   static inline void
+      selectAddAssignKernel( MT3& C, const MT4& A, const DVT& d, size_t kbegin, size_t kend )
+   {
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         const auto end( A.end(k) );
+         for( auto element=A.begin(k); element!=end; ++element ) {
+            const size_t i( SO ? element->index() : k );
+            const size_t j( SO ? k : element->index() );
+            C(i,j) += ( columnScaling )?( element->value() * d[j] ):( d[i] * element->value() );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sparse matrix-diagonal matrix multiplication to a range
+   //        of rows/columns of a dense matrix (\f$ C-=D*A \f$ or \f$ C-=A*D \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The sparse matrix operand.
+   // \param d The vector of diagonal elements.
+   // \param kbegin The index of the first row (row-major) or column (column-major) to compute.
+   // \param kend The index one past the last row (row-major) or column (column-major) to compute.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4 >  // Type of the sparse matrix operand
+   static inline void
+      selectSubAssignKernel( MT3& C, const MT4& A, const DVT& d, size_t kbegin, size_t kend )
+   {
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         const auto end( A.end(k) );
+         for( auto element=A.begin(k); element!=end; ++element ) {
+            const size_t i( SO ? element->index() : k );
+            const size_t j( SO ? k : element->index() );
+            C(i,j) -= ( columnScaling )?( element->value() * d[j] ):( d[i] * element->value() );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to dense matrices****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix-diagonal matrix multiplication to a dense matrix
+   //        (\f$ C=D*A \f$ or \f$ C=A*D \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sparse matrix-diagonal
+   // matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void assign( DenseMatrix<MT3,SO2>& lhs, const SMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      SCT A( serial( rhs.sparseOperand() ) );  // Evaluation of the sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      selectAssignKernel( ~lhs, A, rhs.diagonalOperand().diagonal(), 0UL, ( SO ? A.columns() : A.rows() ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix-diagonal matrix multiplication to a sparse matrix
+   //        with the same storage order (\f$ C=D*A \f$ or \f$ C=A*D \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sparse matrix-diagonal
+   // matrix multiplication expression to a sparse matrix with the same storage order. The
+   // sparse matrix operand is assigned to the target matrix, whose non-zero elements are
+   // subsequently scaled in place.
+   */
+   template< typename MT3 >  // Type of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT3,SO>& lhs, const SMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      assign( ~lhs, rhs.sparseOperand() );
+
+      const DVT& d( rhs.diagonalOperand().diagonal() );
+      const size_t K( SO ? (~lhs).columns() : (~lhs).rows() );
+
+      for( size_t k=0UL; k<K; ++k )
+      {
+         const auto end( (~lhs).end(k) );
+         for( auto element=(~lhs).begin(k); element!=end; ++element ) {
+            const size_t i( SO ? element->index() : k );
+            const size_t j( SO ? k : element->index() );
+            element->value() = ( columnScaling )?( element->value() * d[j] ):( d[i] * element->value() );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse matrices***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix-diagonal matrix multiplication to a sparse matrix
+   //        with opposite storage order (\f$ C=D*A \f$ or \f$ C=A*D \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side sparse matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the assignment of a sparse matrix-diagonal matrix multiplication
+   // expression to a sparse matrix with opposite storage order.
+   */
+   template< typename MT3 >  // Type of the target sparse matrix
+   friend inline void assign( SparseMatrix<MT3,!SO>& lhs, const SMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense matrices*******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a sparse matrix-diagonal matrix multiplication to a dense
+   //        matrix (\f$ C+=D*A \f$ or \f$ C+=A*D \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a sparse
+   // matrix-diagonal matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void addAssign( DenseMatrix<MT3,SO2>& lhs, const SMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      SCT A( serial( rhs.sparseOperand() ) );  // Evaluation of the sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      selectAddAssignKernel( ~lhs, A, rhs.diagonalOperand().diagonal(), 0UL, ( SO ? A.columns() : A.rows() ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse matrices******************************************************
+   // No special implementation for the addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense matrices****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sparse matrix-diagonal matrix multiplication to a dense
+   //        matrix (\f$ C-=D*A \f$ or \f$ C-=A*D \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a sparse
+   // matrix-diagonal matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void subAssign( DenseMatrix<MT3,SO2>& lhs, const SMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      SCT A( serial( rhs.sparseOperand() ) );  // Evaluation of the sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      selectSubAssignKernel( ~lhs, A, rhs.diagonalOperand().diagonal(), 0UL, ( SO ? A.columns() : A.rows() ) );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse matrices***************************************************
+   // No special implementation for the subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Schur product assignment to dense matrices**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Schur product assignment of a sparse matrix-diagonal matrix multiplication to a
+   //        dense matrix (\f$ C\circ=D*A \f$ or \f$ C\circ=A*D \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression for the Schur product.
+   // \return void
+   //
+   // This function implements the performance optimized Schur product assignment of a sparse
+   // matrix-diagonal matrix multiplication expression to a dense matrix.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline void schurAssign( DenseMatrix<MT3,SO2>& lhs, const SMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      const ResultType tmp( serial( rhs ) );
+      schurAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Schur product assignment to sparse matrices*************************************************
+   // No special implementation for the Schur product assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense matrices*************************************************
+   // No special implementation for the multiplication assignment to dense matrices.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse matrices************************************************
+   // No special implementation for the multiplication assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-diagonal matrix multiplication to a dense matrix
+   //        (\f$ C=D*A \f$ or \f$ C=A*D \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse matrix-
+   // diagonal matrix multiplication expression to a dense matrix. The rows (row-major) or
+   // columns (column-major) of the sparse matrix operand are distributed among the available
+   // threads. Due to the explicit application of the SFINAE principle this function can only
+   // be selected by the compiler in case the target matrix is SMP assignable.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSMPAssign<MT3> >
+      smpAssign( DenseMatrix<MT3,SO2>& lhs, const SMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      SCT A( rhs.sparseOperand() );  // Evaluation of the sparse matrix operand
+      const DVT& d( rhs.diagonalOperand().diagonal() );
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      MT3& C( ~lhs );
+      const size_t lines( SO ? A.columns() : A.rows() );
+
+      if( rhs.canSMPAssign() ) {
+         smpFor( 0UL, lines, [&]( size_t first, size_t last ) {
+            selectAssignKernel( C, A, d, first, last );
+         } );
+      }
+      else {
+         selectAssignKernel( C, A, d, 0UL, lines );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse matrices***********************************************************
+   // No special implementation for the SMP assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense matrices***************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a sparse matrix-diagonal matrix multiplication to a dense
+   //        matrix (\f$ C+=D*A \f$ or \f$ C+=A*D \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a sparse
+   // matrix-diagonal matrix multiplication expression to a dense matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case the target matrix is SMP assignable.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSMPAssign<MT3> >
+      smpAddAssign( DenseMatrix<MT3,SO2>& lhs, const SMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      SCT A( rhs.sparseOperand() );  // Evaluation of the sparse matrix operand
+      const DVT& d( rhs.diagonalOperand().diagonal() );
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      MT3& C( ~lhs );
+      const size_t lines( SO ? A.columns() : A.rows() );
+
+      if( rhs.canSMPAssign() ) {
+         smpFor( 0UL, lines, [&]( size_t first, size_t last ) {
+            selectAddAssignKernel( C, A, d, first, last );
+         } );
+      }
+      else {
+         selectAddAssignKernel( C, A, d, 0UL, lines );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse matrices**************************************************
+   // No special implementation for the SMP addition assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense matrices************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a sparse matrix-diagonal matrix multiplication to a
+   //        dense matrix (\f$ C-=D*A \f$ or \f$ C-=A*D \f$).
+   // \ingroup sparse_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a sparse
+   // matrix-diagonal matrix multiplication expression to a dense matrix. Due to the explicit
+   // application of the SFINAE principle this function can only be selected by the compiler
+   // in case the target matrix is SMP assignable.
+   */
+   template< typename MT3  // Type of the target dense matrix
+           , bool SO2 >    // Storage order of the target dense matrix
+   friend inline EnableIf_< UseSMPAssign<MT3> >
+      smpSubAssign( DenseMatrix<MT3,SO2>& lhs, const SMatDiagMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      SCT A( rhs.sparseOperand() );  // Evaluation of the sparse matrix operand
+      const DVT& d( rhs.diagonalOperand().diagonal() );
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      MT3& C( ~lhs );
+      const size_t lines( SO ? A.columns() : A.rows() );
+
+      if( rhs.canSMPAssign() ) {
+         smpFor( 0UL, lines, [&]( size_t first, size_t last ) {
+            selectSubAssignKernel( C, A, d, first, last );
+         } );
+      }
+      else {
+         selectSubAssignKernel( C, A, d, 0UL, lines );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to sparse matrices***********************************************
+   // No special implementation for the SMP subtraction assignment to sparse matrices.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( SMT );
+   BLAZE_CONSTRAINT_MUST_FORM_VALID_MATMATMULTEXPR( MT1, MT2 );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a
+//        sparse matrix (\f$ A=D*B \f$).
+// \ingroup sparse_matrix
+//
+// \param lhs The left-hand side compact diagonal matrix for the multiplication.
+// \param rhs The right-hand side sparse matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication of a compact diagonal matrix and a sparse matrix,
+// i.e. the scaling of the rows of the sparse matrix:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompactDiagonalMatrix<double,rowMajor> D;
+   blaze::CompressedMatrix<double,rowMajor> B, C;
+   // ... Resizing and initialization
+   C = D * B;
+   \endcode
+
+// The operator returns an expression representing a sparse matrix of the higher-order element
+// type of the two involved matrix element types \a T and \a MT::ElementType. The storage order
+// and the sparsity pattern of the resulting matrix correspond to the sparse matrix operand. In
+// case the current number of columns of \a lhs and the current number of rows of \a rhs don't
+// match, a \a std::invalid_argument is thrown.
+*/
+template< typename T   // Data type of the left-hand side compact diagonal matrix
+        , bool SO1     // Storage order of the left-hand side compact diagonal matrix
+        , typename MT  // Type of the right-hand side sparse matrix
+        , bool SO2 >   // Storage order of the right-hand side sparse matrix
+inline decltype(auto)
+   operator*( const CompactDiagonalMatrix<T,SO1>& lhs, const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using ReturnType = const SMatDiagMultExpr< CompactDiagonalMatrix<T,SO1>, MT, SO2 >;
+   return ReturnType( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a sparse matrix and a compact
+//        diagonal matrix (\f$ A=B*D \f$).
+// \ingroup sparse_matrix
+//
+// \param lhs The left-hand side sparse matrix for the multiplication.
+// \param rhs The right-hand side compact diagonal matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication of a sparse matrix and a compact diagonal matrix,
+// i.e. the scaling of the columns of the sparse matrix:
+
+   \code
+   using blaze::rowMajor;
+
+   blaze::CompressedMatrix<double,rowMajor> B, C;
+   blaze::CompactDiagonalMatrix<double,rowMajor> D;
+   // ... Resizing and initialization
+   C = B * D;
+   \endcode
+
+// The operator returns an expression representing a sparse matrix of the higher-order element
+// type of the two involved matrix element types \a MT::ElementType and \a T. The storage order
+// and the sparsity pattern of the resulting matrix correspond to the sparse matrix operand. In
+// case the current number of columns of \a lhs and the current number of rows of \a rhs don't
+// match, a \a std::invalid_argument is thrown.
+*/
+template< typename MT  // Type of the left-hand side sparse matrix
+        , bool SO1     // Storage order of the left-hand side sparse matrix
+        , typename T   // Data type of the right-hand side compact diagonal matrix
+        , bool SO2 >   // Storage order of the right-hand side compact diagonal matrix
+inline decltype(auto)
+   operator*( const SparseMatrix<MT,SO1>& lhs, const CompactDiagonalMatrix<T,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using ReturnType = const SMatDiagMultExpr< MT, CompactDiagonalMatrix<T,SO2>, SO1 >;
+   return ReturnType( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a
+//        sparse matrix-scalar multiplication expression (\f$ A=D*(B*s1) \f$).
+// \ingroup sparse_matrix
+//
+// \param lhs The left-hand side compact diagonal matrix.
+// \param rhs The right-hand side sparse matrix-scalar multiplication.
+// \return The scaled result matrix.
+//
+// This operator implements the performance optimized treatment of the multiplication of a
+// compact diagonal matrix and a sparse matrix-scalar multiplication. It restructures the
+// expression \f$ A=D*(B*s1) \f$ to the expression \f$ A=(D*B)*s1 \f$.
+*/
+template< typename T     // Data type of the left-hand side compact diagonal matrix
+        , bool SO1       // Storage order of the left-hand side compact diagonal matrix
+        , typename MT    // Type of the sparse matrix of the right-hand side expression
+        , typename ST    // Type of the scalar of the right-hand side expression
+        , bool SO2 >     // Storage order of the right-hand side expression
+inline decltype(auto)
+   operator*( const CompactDiagonalMatrix<T,SO1>& lhs, const SMatScalarMultExpr<MT,ST,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( (~lhs) * rhs.leftOperand() ) * rhs.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a sparse matrix-scalar
+//        multiplication expression and a compact diagonal matrix (\f$ A=(B*s1)*D \f$).
+// \ingroup sparse_matrix
+//
+// \param lhs The left-hand side sparse matrix-scalar multiplication.
+// \param rhs The right-hand side compact diagonal matrix.
+// \return The scaled result matrix.
+//
+// This operator implements the performance optimized treatment of the multiplication of a
+// sparse matrix-scalar multiplication and a compact diagonal matrix. It restructures the
+// expression \f$ A=(B*s1)*D \f$ to the expression \f$ A=(B*D)*s1 \f$.
+*/
+template< typename MT    // Type of the sparse matrix of the left-hand side expression
+        , typename ST    // Type of the scalar of the left-hand side expression
+        , bool SO1       // Storage order of the left-hand side expression
+        , typename T     // Data type of the right-hand side compact diagonal matrix
+        , bool SO2 >     // Storage order of the right-hand side compact diagonal matrix
+inline decltype(auto)
+   operator*( const SMatScalarMultExpr<MT,ST,SO1>& lhs, const CompactDiagonalMatrix<T,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( lhs.leftOperand() * (~rhs) ) * lhs.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct Rows< SMatDiagMultExpr<MT1,MT2,SO> >
+   : public Rows<MT1>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct Columns< SMatDiagMultExpr<MT1,MT2,SO> >
+   : public Columns<MT2>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsLower< SMatDiagMultExpr<MT1,MT2,SO> >
+   : public BoolConstant< And< IsLower<MT1>, IsLower<MT2> >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSTRICTLYLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsStrictlyLower< SMatDiagMultExpr<MT1,MT2,SO> >
+   : public BoolConstant< Or< And< IsStrictlyLower<MT1>, IsLower<MT2> >
+                            , And< IsStrictlyLower<MT2>, IsLower<MT1> > >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsUpper< SMatDiagMultExpr<MT1,MT2,SO> >
+   : public BoolConstant< And< IsUpper<MT1>, IsUpper<MT2> >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSTRICTLYUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT1, typename MT2, bool SO >
+struct IsStrictlyUpper< SMatDiagMultExpr<MT1,MT2,SO> >
+   : public BoolConstant< Or< And< IsStrictlyUpper<MT1>, IsUpper<MT2> >
+                            , And< IsStrictlyUpper<MT2>, IsUpper<MT1> > >::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,890 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/SMatReduceExpr.h
+//  \brief Header file for the sparse matrix reduction expression
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_SMATREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_SMATREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Computation.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/MatReduceExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SMatMapExpr.h>
+#include <blaze/math/expressions/SVecReduceExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/SqrAbs.h>
+#include <blaze/math/ReductionFlag.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/views/Forward.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE MATRIX REDUCTION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the row-wise reduction of a row-major sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The given row-major sparse matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename OP >  // Type of the reduction operation
+inline void smatreduce( DenseVector<VT,columnVector>& lhs, const SparseMatrix<MT,rowMajor>& A, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~A).rows(), "Invalid vector size" );
+
+   for( size_t i=0UL; i<(~A).rows(); ++i ) {
+      (~lhs)[i] = reduce( row( ~A, i ), op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the column-wise reduction of a column-major sparse
+//        matrix.
+// \ingroup sparse_matrix
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The given column-major sparse matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+*/
+template< typename VT    // Type of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , typename OP >  // Type of the reduction operation
+inline void smatreduce( DenseVector<VT,rowVector>& lhs, const SparseMatrix<MT,columnMajor>& A, OP op )
+{
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~A).columns(), "Invalid vector size" );
+
+   for( size_t j=0UL; j<(~A).columns(); ++j ) {
+      (~lhs)[j] = reduce( column( ~A, j ), op );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the row-wise reduction of a column-major sparse
+//        matrix and the column-wise reduction of a row-major sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param lhs The target left-hand side dense vector.
+// \param A The given sparse matrix for the reduction computation.
+// \param op The reduction operation.
+// \return void
+//
+// This function traverses the given sparse matrix exactly once and combines each non-zero
+// element with the according element of the target vector. Afterwards, each element of the
+// target vector whose row or column contains implicit zero elements is combined with zero.
+*/
+template< typename VT    // Type of the target dense vector
+        , bool TF        // Transpose flag of the target dense vector
+        , typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order of the sparse matrix
+        , typename OP >  // Type of the reduction operation
+inline void smatreduce( DenseVector<VT,TF>& lhs, const SparseMatrix<MT,SO>& A, OP op )
+{
+   using ConstIterator = ConstIterator_<MT>;
+
+   BLAZE_INTERNAL_ASSERT( TF != SO, "Invalid reduction kernel selected" );
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == ( SO ? (~A).rows() : (~A).columns() ), "Invalid vector size" );
+
+   using ET = ElementType_<MT>;
+
+   reset( ~lhs );
+
+   std::vector<size_t> nonzeros( (~lhs).size(), 0UL );
+
+   const size_t N( SO ? (~A).columns() : (~A).rows() );
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      const ConstIterator end( (~A).end(j) );
+      for( ConstIterator element=(~A).begin(j); element!=end; ++element )
+      {
+         const size_t i( element->index() );
+
+         if( nonzeros[i] > 0UL ) {
+            (~lhs)[i] = op( (~lhs)[i], element->value() );
+         }
+         else {
+            (~lhs)[i] = element->value();
+         }
+
+         ++nonzeros[i];
+      }
+   }
+
+   for( size_t i=0UL; i<(~lhs).size(); ++i ) {
+      if( nonzeros[i] > 0UL && nonzeros[i] < N ) {
+         (~lhs)[i] = op( (~lhs)[i], ET() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SMATREDUCEEXPR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Expression object for the partial reduction of a sparse matrix.
+// \ingroup dense_vector_expression
+//
+// The SMatReduceExpr class represents the compile time expression for the row-wise or
+// column-wise reduction of a sparse matrix. Rows or columns containing implicit zero elements
+// additionally combine their non-zero elements with a single zero element. Rows or columns
+// without any non-zero element result in the default value of the element type.
+*/
+template< typename MT       // Type of the sparse matrix
+        , typename OP       // Type of the reduction operation
+        , ReductionFlag RF >  // Reduction flag
+class SMatReduceExpr
+   : public MatReduceExpr< DenseVector< SMatReduceExpr<MT,OP,RF>, RF == columnwise >, RF >
+   , private Computation
+{
+ private:
+   //**Type definitions****************************************************************************
+   using ET = ElementType_<MT>;    //!< Element type of the sparse matrix expression.
+   using CT = CompositeType_<MT>;  //!< Composite type of the sparse matrix expression.
+   //**********************************************************************************************
+
+   //**Transpose flag******************************************************************************
+   //! Transpose flag of the resulting dense vector.
+   enum : bool { TF = ( RF == columnwise ) };
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = SMatReduceExpr<MT,OP,RF>;     //!< Type of this SMatReduceExpr instance.
+   using ResultType    = DynamicVector<ET,TF>;         //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_<ResultType>;   //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_<ResultType>;     //!< Resulting element type.
+   using ReturnType    = const ElementType;            //!< Return type for expression template evaluations.
+   using CompositeType = const ResultType;             //!< Data type for composite expression templates.
+
+   //! Composite type of the sparse matrix expression.
+   using Operand = If_< IsExpression<MT>, const MT, const MT& >;
+
+   //! Data type of the reduction operation.
+   using Operation = OP;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the SMatReduceExpr class.
+   //
+   // \param sm The sparse matrix operand of the reduction expression.
+   // \param op The reduction operation.
+   */
+   explicit inline SMatReduceExpr( const MT& sm, OP op ) noexcept
+      : sm_( sm )  // Sparse matrix of the reduction expression
+      , op_( op )  // The reduction operation
+   {}
+   //**********************************************************************************************
+
+   //**Subscript operator**************************************************************************
+   /*!\brief Subscript operator for the direct access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   */
+   inline ReturnType operator[]( size_t index ) const {
+      BLAZE_INTERNAL_ASSERT( index < size(), "Invalid vector access index" );
+      if( RF == rowwise )
+         return reduce( row( sm_, index ), op_ );
+      else
+         return reduce( column( sm_, index ), op_ );
+   }
+   //**********************************************************************************************
+
+   //**At function*********************************************************************************
+   /*!\brief Checked access to the vector elements.
+   //
+   // \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+   // \return The resulting value.
+   // \exception std::out_of_range Invalid vector access index.
+   */
+   inline ReturnType at( size_t index ) const {
+      if( index >= size() ) {
+         BLAZE_THROW_OUT_OF_RANGE( "Invalid vector access index" );
+      }
+      return (*this)[index];
+   }
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the current size/dimension of the vector.
+   //
+   // \return The size of the vector.
+   */
+   inline size_t size() const noexcept {
+      return ( RF == rowwise )?( sm_.rows() ):( sm_.columns() );
+   }
+   //**********************************************************************************************
+
+   //**Operand access******************************************************************************
+   /*!\brief Returns the sparse matrix operand.
+   //
+   // \return The sparse matrix operand.
+   */
+   inline Operand operand() const noexcept {
+      return sm_;
+   }
+   //**********************************************************************************************
+
+   //**Operation access****************************************************************************
+   /*!\brief Returns a copy of the reduction operation.
+   //
+   // \return A copy of the reduction operation.
+   */
+   inline Operation operation() const {
+      return op_;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can alias with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the expression can alias, \a false otherwise.
+   */
+   template< typename T >
+   inline bool canAlias( const T* alias ) const noexcept {
+      return sm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression is aliased with the given address \a alias.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case an alias effect is detected, \a false otherwise.
+   */
+   template< typename T >
+   inline bool isAliased( const T* alias ) const noexcept {
+      return sm_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the operands of the expression are properly aligned in memory.
+   //
+   // \return \a true in case the operands are aligned, \a false if not.
+   */
+   inline bool isAligned() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Returns whether the expression can be used in SMP assignments.
+   //
+   // \return \a true in case the expression can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand   sm_;  //!< Sparse matrix of the reduction expression.
+   Operation op_;  //!< The reduction operation.
+   //**********************************************************************************************
+
+   //**Assignment to dense vectors*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sparse matrix
+   // reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void assign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      CT A( serial( rhs.sm_ ) );  // Evaluation of the sparse matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.sm_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.sm_.columns(), "Invalid number of columns" );
+
+      smatreduce( ~lhs, A, rhs.op_ );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Assignment to sparse vectors****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sparse matrix reduction to a sparse vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized assignment of a sparse matrix
+   // reduction expression to a sparse vector.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline void assign( SparseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      assign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a sparse matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized addition assignment of a sparse
+   // matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void addAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      addAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Addition assignment to sparse vectors*******************************************************
+   // No special implementation for the addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Subtraction assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sparse matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized subtraction assignment of a sparse
+   // matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void subAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      subAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Subtraction assignment to sparse vectors****************************************************
+   // No special implementation for the subtraction assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Multiplication assignment to dense vectors**************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Multiplication assignment of a sparse matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized multiplication assignment of a
+   // sparse matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void multAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      multAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Multiplication assignment to sparse vectors*************************************************
+   // No special implementation for the multiplication assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Division assignment to dense vectors********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Division assignment of a sparse matrix reduction to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized division assignment of a sparse
+   // matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline void divAssign( DenseVector<VT1,TF>& lhs, const SMatReduceExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( ResultType, TF );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( serial( rhs ) );
+      divAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Division assignment to sparse vectors*******************************************************
+   // No special implementation for the division assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT );
+   BLAZE_STATIC_ASSERT_MSG( RF == rowwise || RF == columnwise, "Invalid reduction flag" );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the non-zero elements of the given sparse matrix \a sm by means of
+// the given reduction operation \a op:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( A, blaze::Add() );
+   const double totalsum2 = reduce( A, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// The operation is applied to all non-zero elements of the matrix. In case the matrix contains
+// implicit zero elements, the result is additionally combined with a single zero element. For
+// that reason the given operation must be associative and commutative and combining a value
+// with zero repeatedly must be equivalent to combining it once (as for instance for addition,
+// multiplication, minimum and maximum). In case the matrix does not contain any non-zero
+// elements, the function returns the default value of the element type.
+*/
+template< typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order
+        , typename OP >  // Type of the reduction operation
+inline decltype(auto) reduce( const SparseMatrix<MT,SO>& sm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_<MT>;
+   using ET = ElementType_<MT>;
+   using ConstIterator = ConstIterator_< RemoveReference_<CT> >;
+
+   CT tmp( ~sm );  // Evaluation of the sparse matrix operand
+
+   const size_t N( SO ? tmp.columns() : tmp.rows() );
+
+   ET redux{};
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<N; ++j )
+   {
+      const ConstIterator end( tmp.end(j) );
+      ConstIterator element( tmp.begin(j) );
+
+      if( element == end ) continue;
+
+      if( nonzeros == 0UL ) {
+         redux = element->value();
+         ++nonzeros;
+         ++element;
+      }
+
+      for( ; element!=end; ++element, ++nonzeros ) {
+         redux = op( redux, element->value() );
+      }
+   }
+
+   if( nonzeros > 0UL && nonzeros < tmp.rows() * tmp.columns() ) {
+      redux = op( redux, ET() );
+   }
+
+   return redux;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the non-zero elements of the rows (\a RF == \a blaze::rowwise) or
+// columns (\a RF == \a blaze::columnwise) of the given sparse matrix \a sm by means of the
+// given reduction operation \a op:
+
+   \code
+   using blaze::columnwise;
+   using blaze::rowwise;
+
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double,rowVector> colsum;
+   blaze::DynamicVector<double,columnVector> rowsum;
+   // ... Resizing and initialization
+
+   colsum = reduce<columnwise>( A, blaze::Add() );
+   rowsum = reduce<rowwise>( A, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// Rows or columns containing implicit zero elements additionally combine their non-zero elements
+// with a single zero element. Rows or columns without non-zero elements result in the default
+// value of the element type.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the sparse matrix
+        , bool SO           // Storage order
+        , typename OP >     // Type of the reduction operation
+inline decltype(auto) reduce( const SparseMatrix<MT,SO>& sm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( RF == rowwise || RF == columnwise, "Invalid reduction flag" );
+
+   using ReturnType = const SMatReduceExpr<MT,OP,RF>;
+   return ReturnType( ~sm, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given sparse matrix by means of addition.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the non-zero elements of the given sparse matrix \a sm by means of
+// addition. In case the matrix does not contain any non-zero elements, the function returns 0.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) sum( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~sm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the rows or columns of the given sparse matrix by means of addition.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the rows (\a RF == \a blaze::rowwise) or columns (\a RF ==
+// \a blaze::columnwise) of the given sparse matrix \a sm by means of addition.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the sparse matrix
+        , bool SO >         // Storage order
+inline decltype(auto) sum( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~sm, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given sparse matrix by means of multiplication.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the elements of the given sparse matrix \a sm by means of
+// multiplication. In case the matrix contains any implicit zero element, the function returns
+// 0. In case the matrix has either 0 rows or 0 columns, the function returns 1 (the empty
+// product).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) prod( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~sm).rows() == 0UL || (~sm).columns() == 0UL ) return ElementType_<MT>( 1 );
+
+   return reduce( ~sm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the rows or columns of the given sparse matrix by means of multiplication.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the rows (\a RF == \a blaze::rowwise) or columns (\a RF ==
+// \a blaze::columnwise) of the given sparse matrix \a sm by means of multiplication. Rows or
+// columns containing any implicit zero element result in 0.
+*/
+template< ReductionFlag RF  // Reduction flag
+        , typename MT       // Type of the sparse matrix
+        , bool SO >         // Storage order
+inline decltype(auto) prod( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce<RF>( ~sm, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the squared Frobenius norm for the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The squared Frobenius norm of the given sparse matrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) sqrNorm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( map( ~sm, SqrAbs() ), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the Frobenius norm for the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The Frobenius norm of the given sparse matrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) norm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sqrt( sqrNorm( ~sm ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the elementwise L1 norm for the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The elementwise L1 norm of the given sparse matrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) l1Norm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( abs( ~sm ), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the elementwise L2 norm for the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The elementwise L2 norm of the given sparse matrix.
+//
+// This function is equivalent to the norm() function.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) l2Norm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return norm( ~sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the elementwise infinity norm for the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix for the norm computation.
+// \return The elementwise infinity norm of the given sparse matrix.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline decltype(auto) linfNorm( const SparseMatrix<MT,SO>& sm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( abs( ~sm ), Max() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
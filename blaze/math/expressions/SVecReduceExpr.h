@@ -0,0 +1,281 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/expressions/SVecReduceExpr.h
+//  \brief Header file for the sparse vector reduction functionality
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_EXPRESSIONS_SVECREDUCEEXPR_H_
+#define _BLAZE_MATH_EXPRESSIONS_SVECREDUCEEXPR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/expressions/SVecMapExpr.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/functors/SqrAbs.h>
+#include <blaze/math/shims/Sqrt.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the non-zero elements of the given sparse vector \a sv by means of
+// the given reduction operation \a op:
+
+   \code
+   blaze::CompressedVector<double> a;
+   // ... Resizing and initialization
+
+   const double totalsum1 = reduce( a, blaze::Add() );
+   const double totalsum2 = reduce( a, []( double a, double b ){ return a + b; } );
+   \endcode
+
+// The operation is applied to all non-zero elements of the vector. In case the vector contains
+// implicit zero elements, the result is additionally combined with a single zero element. For
+// that reason the given operation must be associative and commutative and combining a value
+// with zero repeatedly must be equivalent to combining it once (as for instance for addition,
+// multiplication, minimum and maximum). In case the vector does not contain any non-zero
+// elements, the function returns the default value of the element type.
+*/
+template< typename VT    // Type of the sparse vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline decltype(auto) reduce( const SparseVector<VT,TF>& sv, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_<VT>;
+   using ET = ElementType_<VT>;
+   using ConstIterator = ConstIterator_< RemoveReference_<CT> >;
+
+   CT tmp( ~sv );  // Evaluation of the sparse vector operand
+
+   const ConstIterator end( tmp.end() );
+   ConstIterator element( tmp.begin() );
+
+   if( element == end ) return ET();
+
+   ET redux( element->value() );
+   size_t nonzeros( 1UL );
+   ++element;
+
+   for( ; element!=end; ++element, ++nonzeros ) {
+      redux = op( redux, element->value() );
+   }
+
+   if( nonzeros < tmp.size() ) {
+      redux = op( redux, ET() );
+   }
+
+   return redux;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given sparse vector by means of addition.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the non-zero elements of the given sparse vector \a sv by means of
+// addition:
+
+   \code
+   blaze::CompressedVector<int> a( 4UL );
+   a[0] = 1; a[1] = 2; a[2] = 3; a[3] = 4;
+
+   const int totalsum = sum( a );  // Results in 10
+   \endcode
+
+// In case the vector does not contain any non-zero elements, the function returns 0.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) sum( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( ~sv, Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reduces the given sparse vector by means of multiplication.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the elements of the given sparse vector \a sv by means of
+// multiplication:
+
+   \code
+   blaze::CompressedVector<int> a( 4UL );
+   a[0] = 1; a[1] = 2; a[2] = 3; a[3] = 4;
+
+   const int totalprod = prod( a );  // Results in 24
+   \endcode
+
+// In case the vector contains any implicit zero element, the function returns 0. In case the
+// size of the vector is 0, the function returns 1 (the empty product).
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) prod( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~sv).size() == 0UL ) return ElementType_<VT>( 1 );
+
+   return reduce( ~sv, Mult() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the squared L2 norm for the given sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The squared L2 norm of the given sparse vector.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) sqrNorm( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( map( ~sv, SqrAbs() ), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm for the given sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The L2 norm of the given sparse vector.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) norm( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return sqrt( sqrNorm( ~sv ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L1 norm for the given sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The L1 norm of the given sparse vector.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) l1Norm( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( abs( ~sv ), Add() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the L2 norm for the given sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The L2 norm of the given sparse vector.
+//
+// This function is equivalent to the norm() function.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) l2Norm( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return norm( ~sv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the infinity norm for the given sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \return The infinity norm of the given sparse vector.
+*/
+template< typename VT  // Type of the sparse vector
+        , bool TF >    // Transpose flag
+inline decltype(auto) linfNorm( const SparseVector<VT,TF>& sv )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return reduce( abs( ~sv ), Max() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -47,6 +47,7 @@ namespace blaze {
 struct Abs;
 struct Acos;
 struct Acosh;
+struct Add;
 struct Asin;
 struct Asinh;
 struct Atan;
@@ -80,6 +81,7 @@ struct Log2;
 struct Log10;
 struct Max;
 struct Min;
+struct Mult;
 struct Noop;
 template< typename > struct Pow;
 struct Real;
@@ -87,7 +89,9 @@ struct Round;
 struct Serial;
 struct Sin;
 struct Sinh;
+struct SqrAbs;
 struct Sqrt;
+struct Sub;
 struct Tan;
 struct Tanh;
 struct Trans;
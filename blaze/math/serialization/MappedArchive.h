@@ -0,0 +1,1086 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MappedArchive.h
+//  \brief Memory mapped, zero-copy archive for dense and sparse vectors and matrices
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MAPPEDARCHIVE_H_
+#define _BLAZE_MATH_SERIALIZATION_MAPPEDARCHIVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/AlignmentFlag.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/sparse/CustomCompressedMatrix.h>
+#include <blaze/system/SparseIndex.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/MemoryMap.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  FILE LAYOUT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary class for the on-disk layout of a mapped archive.
+// \ingroup math_serialization
+//
+// A mapped archive starts with a 64-byte file header, followed by a sequence of records. Each
+// record consists of a 64-byte record header and the payload of the vector or matrix. All
+// headers and payloads start at 64-byte boundaries, which guarantees the proper alignment for
+// all SIMD instruction sets as soon as the file is mapped to memory (memory mappings start at
+// page boundaries). The file header contains the following fields:
+//
+//  - bytes  0- 7: the magic number "BLAZEMAP"
+//  - bytes  8-11: the version of the file format (32-bit unsigned integer)
+//  - bytes 12-15: the byte order tag 0x01020304 (32-bit unsigned integer)
+//  - bytes 16-23: the number of records (64-bit unsigned integer)
+//  - bytes 24-31: the alignment of records and payloads in bytes (64-bit unsigned integer)
+//
+// The record header contains the following fields:
+//
+//  - bytes  0- 3: the kind of the record (1: dense vector, 2: dense matrix, 3: sparse matrix)
+//  - bytes  4- 7: the transpose flag of a vector or the storage order of a matrix
+//  - bytes  8-11: the type code of the elements (see TypeValueMapping)
+//  - bytes 12-15: the size of a single element in bytes
+//  - bytes 16-23: the number of rows (the size of a vector)
+//  - bytes 24-31: the number of columns (1 for a vector)
+//  - bytes 32-39: the spacing of a dense row/column or the number of non-zero elements
+//  - bytes 40-43: the size of a sparse index in bytes
+//  - bytes 44-47: the size of a sparse offset in bytes
+//  - bytes 48-55: the size of the payload in bytes (a multiple of 64)
+//
+// All remaining bytes are reserved and set to zero. The payload of a dense vector consists of
+// the elements padded with zeros to a multiple of 64 bytes. The payload of a dense matrix
+// consists of the rows (row-major) or columns (column-major), each padded with zeros to a
+// multiple of 64 bytes. The payload of a sparse matrix consists of the offsets, the indices
+// and the values of the compressed row (row-major) or compressed column (column-major) format,
+// each section padded to a multiple of 64 bytes. All data is stored in the native byte order
+// of the writing machine, which is detected by the byte order tag.
+*/
+struct MappedArchiveLayout
+{
+   //**Constants***********************************************************************************
+   static constexpr size_t   alignment  = 64UL;          //!< Alignment of headers and payloads.
+   static constexpr size_t   headerSize = 64UL;          //!< Size of the file and record headers.
+   static constexpr uint32_t version    = 1U;            //!< The version of the file format.
+   static constexpr uint32_t byteOrder  = 0x01020304U;   //!< The byte order tag.
+
+   static constexpr uint32_t denseVector  = 1U;  //!< Record kind of a dense vector.
+   static constexpr uint32_t denseMatrix  = 2U;  //!< Record kind of a dense matrix.
+   static constexpr uint32_t sparseMatrix = 3U;  //!< Record kind of a sparse matrix.
+   //**********************************************************************************************
+
+   //**Record struct definition********************************************************************
+   /*!\brief The decoded header of a single record.
+   */
+   struct Record {
+      uint32_t kind;         //!< The kind of the record.
+      uint32_t order;        //!< The transpose flag or storage order.
+      uint32_t type;         //!< The type code of the elements.
+      uint32_t elementSize;  //!< The size of a single element in bytes.
+      uint64_t rows;         //!< The number of rows.
+      uint64_t columns;      //!< The number of columns.
+      uint64_t extent;       //!< The spacing or the number of non-zero elements.
+      uint32_t indexSize;    //!< The size of a sparse index in bytes.
+      uint32_t offsetSize;   //!< The size of a sparse offset in bytes.
+      uint64_t payload;      //!< The size of the payload in bytes.
+      uint64_t position;     //!< The position of the payload within the file.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\brief Rounds the given number of bytes up to the next multiple of the alignment.
+   //
+   // \param bytes The number of bytes.
+   // \return The next multiple of the alignment.
+   */
+   static inline size_t align( size_t bytes ) noexcept {
+      return ( bytes + alignment - 1UL ) & ~( alignment - 1UL );
+   }
+
+   /*!\brief Returns the spacing of a dense row/column of the given length.
+   //
+   // \param n The number of elements of the row/column.
+   // \param size The size of a single element in bytes.
+   // \return The number of elements including the padding.
+   */
+   static inline size_t spacing( size_t n, size_t size ) noexcept {
+      return align( n*size ) / size;
+   }
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MAPPEDARCHIVEWRITER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writer for memory mapped archives.
+// \ingroup math_serialization
+//
+// The MappedArchiveWriter class writes dense vectors, dense matrices and sparse matrices in a
+// binary format that can be read without copying by means of the MappedArchive class. In
+// contrast to the portable format of the Archive class, all elements are written in the native
+// byte order, and all dense rows/columns as well as all sparse arrays are padded and aligned to
+// 64-byte boundaries:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::CompressedMatrix<double> S;
+   blaze::DynamicVector<double> x;
+   // ... Resizing and initialization
+
+   blaze::MappedArchiveWriter writer( "data.blaze" );
+   writer << A << S << x;
+   writer.close();
+   \endcode
+
+// The records are numbered in the order in which they are written. In case the file could not
+// be written, a \a std::runtime_error exception is thrown. The number of records in the file
+// header is updated by the close() function, which is also called by the destructor.
+*/
+class MappedArchiveWriter : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedArchiveWriter( const std::string& file );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MappedArchiveWriter();
+   //@}
+   //**********************************************************************************************
+
+   //**Output operators****************************************************************************
+   /*!\name Output operators */
+   //@{
+   template< typename VT, bool TF >
+   inline MappedArchiveWriter& operator<<( const DenseVector<VT,TF>& dv );
+
+   template< typename MT, bool SO >
+   inline MappedArchiveWriter& operator<<( const DenseMatrix<MT,SO>& dm );
+
+   template< typename MT, bool SO >
+   inline MappedArchiveWriter& operator<<( const SparseMatrix<MT,SO>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline void   close();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void writeRecord( const MappedArchiveLayout::Record& record );
+   inline void writePadding( size_t bytes );
+
+   template< typename Type >
+   inline void writeArray( const Type* array, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::ofstream stream_;  //!< The output stream of the archive.
+   size_t        count_;   //!< The number of records written so far.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDARCHIVEWRITER CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a new mapped archive.
+//
+// \param file The name of the file to be written.
+// \exception std::runtime_error File could not be opened.
+//
+// An existing file of the same name is overwritten.
+*/
+inline MappedArchiveWriter::MappedArchiveWriter( const std::string& file )
+   : stream_( file.c_str(), std::ofstream::binary | std::ofstream::trunc )  // The output stream of the archive
+   , count_ ( 0UL )                                                         // The number of records written so far
+{
+   if( !stream_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   char header[MappedArchiveLayout::headerSize] = {};
+   const uint32_t version  ( MappedArchiveLayout::version   );
+   const uint32_t byteOrder( MappedArchiveLayout::byteOrder );
+   const uint64_t alignment( MappedArchiveLayout::alignment );
+
+   std::memcpy( header     , "BLAZEMAP", 8UL );
+   std::memcpy( header+ 8UL, &version  , 4UL );
+   std::memcpy( header+12UL, &byteOrder, 4UL );
+   std::memcpy( header+24UL, &alignment, 8UL );
+   stream_.write( header, sizeof( header ) );
+
+   if( !stream_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDARCHIVEWRITER DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the MappedArchiveWriter class.
+//
+// The destructor finalizes the file header. Errors during the finalization are ignored; in
+// order to detect them, the close() function has to be called explicitly.
+*/
+inline MappedArchiveWriter::~MappedArchiveWriter()
+{
+   try {
+      close();
+   }
+   catch( ... ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDARCHIVEWRITER OUTPUT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Writes the given dense vector to the archive.
+//
+// \param dv The dense vector to be written.
+// \return Reference to the archive writer.
+// \exception std::runtime_error Dense vector could not be serialized.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline MappedArchiveWriter& MappedArchiveWriter::operator<<( const DenseVector<VT,TF>& dv )
+{
+   using ET = ElementType_<VT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CompositeType_<VT> tmp( ~dv );
+
+   const size_t n ( tmp.size() );
+   const size_t nn( MappedArchiveLayout::spacing( n, sizeof( ET ) ) );
+
+   MappedArchiveLayout::Record record = {};
+   record.kind        = MappedArchiveLayout::denseVector;
+   record.order       = TF;
+   record.type        = TypeValueMapping<ET>::value;
+   record.elementSize = sizeof( ET );
+   record.rows        = n;
+   record.columns     = 1UL;
+   record.extent      = nn;
+   record.payload     = nn * sizeof( ET );
+   writeRecord( record );
+
+   std::vector<ET> buffer( nn );
+   for( size_t i=0UL; i<n; ++i ) {
+      buffer[i] = tmp[i];
+   }
+   writeArray( buffer.data(), nn );
+
+   if( !stream_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be serialized" );
+   }
+
+   ++count_;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given dense matrix to the archive.
+//
+// \param dm The dense matrix to be written.
+// \return Reference to the archive writer.
+// \exception std::runtime_error Dense matrix could not be serialized.
+//
+// The matrix is written in its own storage order. Each row (row-major) or column (column-major)
+// is padded with zeros to a multiple of 64 bytes.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline MappedArchiveWriter& MappedArchiveWriter::operator<<( const DenseMatrix<MT,SO>& dm )
+{
+   using ET = ElementType_<MT>;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CompositeType_<MT> tmp( ~dm );
+
+   const size_t m ( tmp.rows() );
+   const size_t n ( tmp.columns() );
+   const size_t major( SO ? n : m );
+   const size_t minor( SO ? m : n );
+   const size_t nn( MappedArchiveLayout::spacing( minor, sizeof( ET ) ) );
+
+   MappedArchiveLayout::Record record = {};
+   record.kind        = MappedArchiveLayout::denseMatrix;
+   record.order       = SO;
+   record.type        = TypeValueMapping<ET>::value;
+   record.elementSize = sizeof( ET );
+   record.rows        = m;
+   record.columns     = n;
+   record.extent      = nn;
+   record.payload     = major * nn * sizeof( ET );
+   writeRecord( record );
+
+   std::vector<ET> buffer( nn );
+   for( size_t i=0UL; i<major; ++i ) {
+      for( size_t j=0UL; j<minor; ++j ) {
+         buffer[j] = ( SO ? tmp(j,i) : tmp(i,j) );
+      }
+      writeArray( buffer.data(), nn );
+   }
+
+   if( !stream_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be serialized" );
+   }
+
+   ++count_;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given sparse matrix to the archive.
+//
+// \param sm The sparse matrix to be written.
+// \return Reference to the archive writer.
+// \exception std::invalid_argument Invalid matrix size for the sparse index type.
+// \exception std::runtime_error Sparse matrix could not be serialized.
+//
+// The matrix is written in the compressed row storage (row-major) or compressed column storage
+// (column-major) format. The indices are written with the configured sparse index type (see
+// BLAZE_SPARSE_INDEX_TYPE), the offsets as \c size_t.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order
+inline MappedArchiveWriter& MappedArchiveWriter::operator<<( const SparseMatrix<MT,SO>& sm )
+{
+   using ET = ElementType_<MT>;
+   using CT = CompositeType_<MT>;
+   using ConstIterator = ConstIterator_< RemoveReference_<CT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( ET );
+
+   CT tmp( ~sm );
+
+   const size_t m( tmp.rows() );
+   const size_t n( tmp.columns() );
+   const size_t major( SO ? n : m );
+   const size_t minor( SO ? m : n );
+
+   if( minor > std::numeric_limits<SparseIndex>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix size for the sparse index type" );
+   }
+
+   std::vector<size_t> offsets( major+1UL, 0UL );
+   for( size_t i=0UL; i<major; ++i ) {
+      offsets[i+1UL] = offsets[i];
+      for( ConstIterator element=tmp.begin(i); element!=tmp.end(i); ++element ) {
+         ++offsets[i+1UL];
+      }
+   }
+
+   const size_t nonzeros( offsets[major] );
+   const size_t offsetBytes( MappedArchiveLayout::align( ( major+1UL ) * sizeof( size_t ) ) );
+   const size_t indexBytes ( MappedArchiveLayout::align( nonzeros * sizeof( SparseIndex ) ) );
+   const size_t valueBytes ( MappedArchiveLayout::align( nonzeros * sizeof( ET ) ) );
+
+   MappedArchiveLayout::Record record = {};
+   record.kind        = MappedArchiveLayout::sparseMatrix;
+   record.order       = SO;
+   record.type        = TypeValueMapping<ET>::value;
+   record.elementSize = sizeof( ET );
+   record.rows        = m;
+   record.columns     = n;
+   record.extent      = nonzeros;
+   record.indexSize   = sizeof( SparseIndex );
+   record.offsetSize  = sizeof( size_t );
+   record.payload     = offsetBytes + indexBytes + valueBytes;
+   writeRecord( record );
+
+   writeArray( offsets.data(), major+1UL );
+   writePadding( offsetBytes - ( major+1UL ) * sizeof( size_t ) );
+
+   std::vector<SparseIndex> indices;
+   indices.reserve( nonzeros );
+   for( size_t i=0UL; i<major; ++i ) {
+      for( ConstIterator element=tmp.begin(i); element!=tmp.end(i); ++element ) {
+         indices.push_back( static_cast<SparseIndex>( element->index() ) );
+      }
+   }
+   writeArray( indices.data(), nonzeros );
+   writePadding( indexBytes - nonzeros * sizeof( SparseIndex ) );
+
+   std::vector<ET> values;
+   values.reserve( nonzeros );
+   for( size_t i=0UL; i<major; ++i ) {
+      for( ConstIterator element=tmp.begin(i); element!=tmp.end(i); ++element ) {
+         values.push_back( element->value() );
+      }
+   }
+   writeArray( values.data(), nonzeros );
+   writePadding( valueBytes - nonzeros * sizeof( ET ) );
+
+   if( !stream_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be serialized" );
+   }
+
+   ++count_;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDARCHIVEWRITER UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of records written to the archive.
+//
+// \return The number of records written to the archive.
+*/
+inline size_t MappedArchiveWriter::size() const noexcept
+{
+   return count_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizes the file header and closes the archive.
+//
+// \return void
+// \exception std::runtime_error File header could not be serialized.
+//
+// After calling close(), no further records can be written. Calling close() on an already
+// closed archive has no effect.
+*/
+inline void MappedArchiveWriter::close()
+{
+   if( !stream_.is_open() )
+      return;
+
+   const uint64_t count( count_ );
+
+   stream_.seekp( 16L, std::ofstream::beg );
+   stream_.write( reinterpret_cast<const char*>( &count ), sizeof( count ) );
+   stream_.close();
+
+   if( !stream_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the header of a single record.
+//
+// \param record The decoded record header.
+// \return void
+*/
+inline void MappedArchiveWriter::writeRecord( const MappedArchiveLayout::Record& record )
+{
+   if( !stream_.is_open() ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Faulty archive detected" );
+   }
+
+   char header[MappedArchiveLayout::headerSize] = {};
+
+   std::memcpy( header     , &record.kind       , 4UL );
+   std::memcpy( header+ 4UL, &record.order      , 4UL );
+   std::memcpy( header+ 8UL, &record.type       , 4UL );
+   std::memcpy( header+12UL, &record.elementSize, 4UL );
+   std::memcpy( header+16UL, &record.rows       , 8UL );
+   std::memcpy( header+24UL, &record.columns    , 8UL );
+   std::memcpy( header+32UL, &record.extent     , 8UL );
+   std::memcpy( header+40UL, &record.indexSize  , 4UL );
+   std::memcpy( header+44UL, &record.offsetSize , 4UL );
+   std::memcpy( header+48UL, &record.payload    , 8UL );
+   stream_.write( header, sizeof( header ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given number of zero bytes.
+//
+// \param bytes The number of zero bytes (less than the alignment).
+// \return void
+*/
+inline void MappedArchiveWriter::writePadding( size_t bytes )
+{
+   BLAZE_INTERNAL_ASSERT( bytes < MappedArchiveLayout::alignment, "Invalid number of padding bytes" );
+
+   const char padding[MappedArchiveLayout::alignment] = {};
+   stream_.write( padding, static_cast<std::streamsize>( bytes ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the given array in native byte order.
+//
+// \param array The array to be written.
+// \param n The number of elements of the array.
+// \return void
+*/
+template< typename Type >  // Data type of the array elements
+inline void MappedArchiveWriter::writeArray( const Type* array, size_t n )
+{
+   if( n > 0UL ) {
+      stream_.write( reinterpret_cast<const char*>( array ),
+                     static_cast<std::streamsize>( n * sizeof( Type ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS MAPPEDARCHIVE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Zero-copy reader for memory mapped archives.
+// \ingroup math_serialization
+//
+// The MappedArchive class maps a file written by the MappedArchiveWriter class into memory and
+// provides direct access to the stored vectors and matrices without copying any element. Dense
+// vectors and matrices are returned as aligned CustomVector and CustomMatrix, sparse matrices
+// as read-only CustomCompressedMatrix:
+
+   \code
+   blaze::MappedArchive archive( "data.blaze" );
+
+   const auto A( archive.denseMatrix<double,blaze::rowMajor>( 0UL ) );
+   const auto S( archive.sparseMatrix<double,blaze::rowMajor>( 1UL ) );
+   const auto x( archive.denseVector<double,blaze::columnVector>( 2UL ) );
+
+   blaze::DynamicVector<double> y( A * x + S * x );
+   \endcode
+
+// The returned vectors and matrices refer to the mapped memory and must not be used after the
+// archive has been destroyed. The file is mapped privately (see MemoryMap), i.e. the elements
+// of dense vectors and matrices can be modified, but the modifications are never written back
+// to the file. Since the padded variants of CustomVector and CustomMatrix initialize their
+// padding elements (and thereby copy every mapped page), the unpadded variants are used. Due to
+// the padding in the file, all rows (or columns) of dense matrices are nevertheless aligned. The element type, the element size, the storage order of matrices
+// and the size of sparse indices and offsets have to match the stored record. The transpose flag
+// of vectors can be chosen freely. In case the file is not a valid mapped archive, a
+// \a std::runtime_error exception is thrown.
+*/
+class MappedArchive : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MappedArchive( const std::string& file );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Access functions****************************************************************************
+   /*!\name Access functions */
+   //@{
+   template< typename Type, bool TF = defaultTransposeFlag >
+   inline CustomVector<Type,aligned,unpadded,TF> denseVector( size_t index );
+
+   template< typename Type, bool SO = defaultStorageOrder >
+   inline CustomMatrix<Type,aligned,unpadded,SO> denseMatrix( size_t index );
+
+   template< typename Type, bool SO = defaultStorageOrder >
+   inline CustomCompressedMatrix<Type,SO> sparseMatrix( size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline size_t rows   ( size_t index ) const;
+   inline size_t columns( size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline const MappedArchiveLayout::Record& record( size_t index ) const;
+
+   template< typename Type >
+   inline const MappedArchiveLayout::Record& record( size_t index, uint32_t kind ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MemoryMap map_;                                 //!< The memory mapping of the file.
+   std::vector<MappedArchiveLayout::Record> records_;  //!< The decoded record headers.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDARCHIVE CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Maps the given archive file into memory.
+//
+// \param file The name of the file to be mapped.
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be mapped.
+// \exception std::runtime_error Corrupt archive detected.
+// \exception std::runtime_error Invalid version detected.
+// \exception std::runtime_error Invalid byte order detected.
+//
+// The constructor maps the file and validates the file header and all record headers.
+*/
+inline MappedArchive::MappedArchive( const std::string& file )
+   : map_    ( file )  // The memory mapping of the file
+   , records_()        // The decoded record headers
+{
+   using Layout = MappedArchiveLayout;
+
+   const char* const data( map_.data() );
+   const size_t bytes( map_.size() );
+
+   if( bytes < Layout::headerSize || std::memcmp( data, "BLAZEMAP", 8UL ) != 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   uint32_t version, byteOrder;
+   uint64_t count, alignment;
+
+   std::memcpy( &version  , data+ 8UL, 4UL );
+   std::memcpy( &byteOrder, data+12UL, 4UL );
+   std::memcpy( &count    , data+16UL, 8UL );
+   std::memcpy( &alignment, data+24UL, 8UL );
+
+   if( byteOrder != Layout::byteOrder ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid byte order detected" );
+   }
+
+   if( version != Layout::version ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+
+   if( alignment != Layout::alignment || count > bytes / Layout::headerSize ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   records_.reserve( count );
+
+   size_t position( Layout::headerSize );
+
+   for( size_t i=0UL; i<count; ++i )
+   {
+      if( bytes - position < Layout::headerSize ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+
+      const char* const header( data + position );
+      Layout::Record record;
+
+      std::memcpy( &record.kind       , header     , 4UL );
+      std::memcpy( &record.order      , header+ 4UL, 4UL );
+      std::memcpy( &record.type       , header+ 8UL, 4UL );
+      std::memcpy( &record.elementSize, header+12UL, 4UL );
+      std::memcpy( &record.rows       , header+16UL, 8UL );
+      std::memcpy( &record.columns    , header+24UL, 8UL );
+      std::memcpy( &record.extent     , header+32UL, 8UL );
+      std::memcpy( &record.indexSize  , header+40UL, 4UL );
+      std::memcpy( &record.offsetSize , header+44UL, 4UL );
+      std::memcpy( &record.payload    , header+48UL, 8UL );
+
+      position += Layout::headerSize;
+      record.position = position;
+
+      if( record.payload > bytes - position || record.payload % Layout::alignment != 0UL ||
+          record.elementSize == 0U || record.order > 1U ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+
+      const size_t major( record.order ? record.columns : record.rows );
+      const size_t minor( record.order ? record.rows : record.columns );
+
+      bool valid( false );
+
+      if( record.kind == Layout::denseVector ) {
+         valid = ( record.columns == 1UL && record.extent >= record.rows &&
+                   record.extent <= record.payload / record.elementSize &&
+                   record.payload == record.extent * record.elementSize );
+      }
+      else if( record.kind == Layout::denseMatrix ) {
+         if( major == 0UL || record.extent == 0UL ) {
+            valid = ( record.extent >= minor && record.payload == 0UL );
+         }
+         else {
+            valid = ( record.extent >= minor &&
+                      record.extent <= record.payload / record.elementSize &&
+                      record.payload / ( record.extent * record.elementSize ) == major &&
+                      record.payload == major * record.extent * record.elementSize );
+         }
+      }
+      else if( record.kind == Layout::sparseMatrix && record.indexSize != 0U && record.offsetSize != 0U ) {
+         valid = ( major < record.payload / record.offsetSize &&
+                   record.extent <= record.payload / record.elementSize &&
+                   record.payload == Layout::align( ( major+1UL ) * record.offsetSize ) +
+                                     Layout::align( record.extent * record.indexSize ) +
+                                     Layout::align( record.extent * record.elementSize ) );
+      }
+
+      if( !valid ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+
+      position += record.payload;
+      records_.push_back( record );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDARCHIVE ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a dense vector referring to the given record.
+//
+// \param index The index of the record. The index has to be in the range \f$[0..size()-1]\f$.
+// \return The dense vector referring to the mapped memory.
+// \exception std::out_of_range Invalid record access index.
+// \exception std::runtime_error Invalid vector type detected.
+// \exception std::runtime_error Invalid element type detected.
+*/
+template< typename Type  // Data type of the vector elements
+        , bool TF >      // Transpose flag
+inline CustomVector<Type,aligned,unpadded,TF> MappedArchive::denseVector( size_t index )
+{
+   const MappedArchiveLayout::Record& r( record<Type>( index, MappedArchiveLayout::denseVector ) );
+
+   return CustomVector<Type,aligned,unpadded,TF>(
+      reinterpret_cast<Type*>( map_.data() + r.position ), r.rows );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a dense matrix referring to the given record.
+//
+// \param index The index of the record. The index has to be in the range \f$[0..size()-1]\f$.
+// \return The dense matrix referring to the mapped memory.
+// \exception std::out_of_range Invalid record access index.
+// \exception std::runtime_error Invalid matrix type detected.
+// \exception std::runtime_error Invalid element type detected.
+// \exception std::runtime_error Invalid storage order detected.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+inline CustomMatrix<Type,aligned,unpadded,SO> MappedArchive::denseMatrix( size_t index )
+{
+   const MappedArchiveLayout::Record& r( record<Type>( index, MappedArchiveLayout::denseMatrix ) );
+
+   if( r.order != SO ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid storage order detected" );
+   }
+
+   return CustomMatrix<Type,aligned,unpadded,SO>(
+      reinterpret_cast<Type*>( map_.data() + r.position ), r.rows, r.columns, r.extent );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a sparse matrix referring to the given record.
+//
+// \param index The index of the record. The index has to be in the range \f$[0..size()-1]\f$.
+// \return The sparse matrix referring to the mapped memory.
+// \exception std::out_of_range Invalid record access index.
+// \exception std::runtime_error Invalid matrix type detected.
+// \exception std::runtime_error Invalid element type detected.
+// \exception std::runtime_error Invalid storage order detected.
+// \exception std::runtime_error Invalid index type detected.
+// \exception std::runtime_error Corrupt archive detected.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+inline CustomCompressedMatrix<Type,SO> MappedArchive::sparseMatrix( size_t index ) const
+{
+   using Layout = MappedArchiveLayout;
+
+   const Layout::Record& r( record<Type>( index, Layout::sparseMatrix ) );
+
+   if( r.order != SO ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid storage order detected" );
+   }
+
+   if( r.indexSize != sizeof( SparseIndex ) || r.offsetSize != sizeof( size_t ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid index type detected" );
+   }
+
+   const size_t major( SO ? r.columns : r.rows );
+   const size_t minor( SO ? r.rows : r.columns );
+
+   const char* const data( map_.data() + r.position );
+   const size_t* const offsets( reinterpret_cast<const size_t*>( data ) );
+   const SparseIndex* const indices( reinterpret_cast<const SparseIndex*>(
+      data + Layout::align( ( major+1UL ) * sizeof( size_t ) ) ) );
+   const Type* const values( reinterpret_cast<const Type*>(
+      data + Layout::align( ( major+1UL ) * sizeof( size_t ) )
+           + Layout::align( r.extent * sizeof( SparseIndex ) ) ) );
+
+   if( offsets[0] != 0UL || offsets[major] != r.extent ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   for( size_t i=0UL; i<major; ++i ) {
+      if( offsets[i+1UL] < offsets[i] ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      for( size_t k=offsets[i]; k<offsets[i+1UL]; ++k ) {
+         if( static_cast<size_t>( indices[k] ) >= minor ||
+             ( k > offsets[i] && indices[k] <= indices[k-1UL] ) ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+         }
+      }
+   }
+
+   return CustomCompressedMatrix<Type,SO>( values, indices, offsets, r.rows, r.columns );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAPPEDARCHIVE UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of records in the archive.
+//
+// \return The number of records in the archive.
+*/
+inline size_t MappedArchive::size() const noexcept
+{
+   return records_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the given record.
+//
+// \param index The index of the record. The index has to be in the range \f$[0..size()-1]\f$.
+// \return The number of rows (the size of a vector).
+// \exception std::out_of_range Invalid record access index.
+*/
+inline size_t MappedArchive::rows( size_t index ) const
+{
+   return record( index ).rows;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of columns of the given record.
+//
+// \param index The index of the record. The index has to be in the range \f$[0..size()-1]\f$.
+// \return The number of columns (1 for a vector).
+// \exception std::out_of_range Invalid record access index.
+*/
+inline size_t MappedArchive::columns( size_t index ) const
+{
+   return record( index ).columns;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the header of the given record.
+//
+// \param index The index of the record.
+// \return The decoded record header.
+// \exception std::out_of_range Invalid record access index.
+*/
+inline const MappedArchiveLayout::Record& MappedArchive::record( size_t index ) const
+{
+   if( index >= records_.size() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid record access index" );
+   }
+
+   return records_[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the header of the given record after checking its kind and element type.
+//
+// \param index The index of the record.
+// \param kind The expected kind of the record.
+// \return The decoded record header.
+// \exception std::out_of_range Invalid record access index.
+// \exception std::runtime_error Invalid record type detected.
+// \exception std::runtime_error Invalid element type detected.
+// \exception std::runtime_error Invalid element size detected.
+*/
+template< typename Type >  // Data type of the elements
+inline const MappedArchiveLayout::Record& MappedArchive::record( size_t index, uint32_t kind ) const
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+
+   const MappedArchiveLayout::Record& r( record( index ) );
+
+   if( r.kind != kind ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid record type detected" );
+   }
+
+   if( r.type != uint32_t( TypeValueMapping<Type>::value ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+
+   if( r.elementSize != sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element size detected" );
+   }
+
+   return r;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
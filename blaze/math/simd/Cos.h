@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/NativeMath.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
 
@@ -60,7 +61,8 @@ namespace blaze {
 // \param a The vector of single precision floating point values.
 // \return The resulting vector.
 //
-// This operation is only available via the SVML for SSE, AVX, MIC, and AVX-512.
+// This operation is available via the SVML for SSE, AVX, MIC, and AVX-512 and via the native
+// implementation for SSE2, AVX, AVX2, and AVX-512 (see blaze/math/simd/NativeMath.h).
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDfloat cos( const SIMDf32<T>& a ) noexcept
@@ -76,6 +78,10 @@ BLAZE_ALWAYS_INLINE const SIMDfloat cos( const SIMDf32<T>& a ) noexcept
 {
    return _mm_cos_ps( (~a).eval().value );
 }
+#elif BLAZE_NATIVE_SIMD_MATH_MODE
+{
+   return nativeCos( (~a).eval() );
+}
 #else
 = delete;
 #endif
@@ -97,7 +103,8 @@ BLAZE_ALWAYS_INLINE const SIMDfloat cos( const SIMDf32<T>& a ) noexcept
 // \param a The vector of double precision floating point values.
 // \return The resulting vector.
 //
-// This operation is only available via the SVML for SSE, AVX, MIC, and AVX-512.
+// This operation is available via the SVML for SSE, AVX, MIC, and AVX-512 and via the native
+// implementation for SSE2, AVX, AVX2, and AVX-512 (see blaze/math/simd/NativeMath.h).
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDdouble cos( const SIMDf64<T>& a ) noexcept
@@ -113,6 +120,10 @@ BLAZE_ALWAYS_INLINE const SIMDdouble cos( const SIMDf64<T>& a ) noexcept
 {
    return _mm_cos_pd( (~a).eval().value );
 }
+#elif BLAZE_NATIVE_SIMD_MATH_MODE
+{
+   return nativeCos( (~a).eval() );
+}
 #else
 = delete;
 #endif
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/NativeMath.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
 
@@ -61,7 +62,8 @@ namespace blaze {
 // \param a The vector of single precision floating point values.
 // \return The resulting vector.
 //
-// This operation is only available via the SVML for SSE, AVX, MIC, and AVX-512.
+// This operation is available via the SVML for SSE, AVX, MIC, and AVX-512 and via the native
+// implementation for SSE2, AVX, AVX2, and AVX-512 (see blaze/math/simd/NativeMath.h).
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDfloat erfc( const SIMDf32<T>& a ) noexcept
@@ -77,6 +79,10 @@ BLAZE_ALWAYS_INLINE const SIMDfloat erfc( const SIMDf32<T>& a ) noexcept
 {
    return _mm_erfc_ps( (~a).eval().value );
 }
+#elif BLAZE_NATIVE_SIMD_MATH_MODE
+{
+   return nativeErfc( (~a).eval() );
+}
 #else
 = delete;
 #endif
@@ -99,7 +105,8 @@ BLAZE_ALWAYS_INLINE const SIMDfloat erfc( const SIMDf32<T>& a ) noexcept
 // \param a The vector of double precision floating point values.
 // \return The resulting vector.
 //
-// This operation is only available via the SVML for SSE, AVX, MIC, and AVX-512.
+// This operation is available via the SVML for SSE, AVX, MIC, and AVX-512 and via the native
+// implementation for SSE2, AVX, AVX2, and AVX-512 (see blaze/math/simd/NativeMath.h).
 */
 template< typename T >  // Type of the operand
 BLAZE_ALWAYS_INLINE const SIMDdouble erfc( const SIMDf64<T>& a ) noexcept
@@ -115,6 +122,10 @@ BLAZE_ALWAYS_INLINE const SIMDdouble erfc( const SIMDf64<T>& a ) noexcept
 {
    return _mm_erfc_pd( (~a).eval().value );
 }
+#elif BLAZE_NATIVE_SIMD_MATH_MODE
+{
+   return nativeErfc( (~a).eval() );
+}
 #else
 = delete;
 #endif
@@ -41,12 +41,15 @@
 //*************************************************************************************************
 
 #include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Loadu.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
 #include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/StaticAssert.h>
@@ -406,6 +409,58 @@ BLAZE_ALWAYS_INLINE const SIMDcfloat loada( const complex<float>* address ) noex
 
 
 
+//=================================================================================================
+//
+//  16-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'float16' values.
+// \ingroup simd
+//
+// \param address The first 'float16' value to be loaded.
+// \return The loaded vector of 'float16' values, converted to single precision.
+//
+// This function loads a vector of 'float16' values and widens them to single precision. The
+// given address must be aligned according to the enabled instruction set (8-byte alignment in
+// case of SSE, 16-byte alignment in case of AVX, and 32-byte alignment in case of AVX-512).
+// Since the conversion dominates the cost of the load, the aligned load is implemented in
+// terms of the unaligned load.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat loada( const float16* address ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+   return loadu( address );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads a vector of 'bfloat16' values.
+// \ingroup simd
+//
+// \param address The first 'bfloat16' value to be loaded.
+// \return The loaded vector of 'bfloat16' values, converted to single precision.
+//
+// This function loads a vector of 'bfloat16' values and widens them to single precision. The
+// given address must be aligned according to the enabled instruction set (8-byte alignment in
+// case of SSE, 16-byte alignment in case of AVX, and 32-byte alignment in case of AVX-512).
+// Since the conversion dominates the cost of the load, the aligned load is implemented in
+// terms of the unaligned load.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat loada( const bfloat16* address ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+   return loadu( address );
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  64-BIT FLOATING POINT SIMD TYPES
@@ -0,0 +1,1658 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/NativeMath.h
+//  \brief Header file for the native SIMD implementations of the transcendental functions
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_NATIVEMATH_H_
+#define _BLAZE_MATH_SIMD_NATIVEMATH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <blaze/math/simd/Addition.h>
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Division.h>
+#include <blaze/math/simd/FMA.h>
+#include <blaze/math/simd/Loadu.h>
+#include <blaze/math/simd/Multiplication.h>
+#include <blaze/math/simd/Round.h>
+#include <blaze/math/simd/Set.h>
+#include <blaze/math/simd/Storeu.h>
+#include <blaze/math/simd/Subtraction.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Types.h>
+
+
+
+#if BLAZE_NATIVE_SIMD_MATH_MODE
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise AND of two vectors of single precision floating point values.
+// \ingroup simd
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the bitwise AND.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeAnd( const SIMDfloat& a, const SIMDfloat& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_ps( _mm512_and_si512( _mm512_castps_si512( a.value ), _mm512_castps_si512( b.value ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_and_ps( a.value, b.value );
+#else
+   return _mm_and_ps( a.value, b.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise AND of the complement of \a a and \a b for single precision values.
+// \ingroup simd
+//
+// \param a The left-hand side operand (to be complemented).
+// \param b The right-hand side operand.
+// \return The result of the bitwise AND NOT.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeAndNot( const SIMDfloat& a, const SIMDfloat& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_ps( _mm512_andnot_si512( _mm512_castps_si512( a.value ), _mm512_castps_si512( b.value ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_andnot_ps( a.value, b.value );
+#else
+   return _mm_andnot_ps( a.value, b.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise OR of two vectors of single precision floating point values.
+// \ingroup simd
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the bitwise OR.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeOr( const SIMDfloat& a, const SIMDfloat& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_ps( _mm512_or_si512( _mm512_castps_si512( a.value ), _mm512_castps_si512( b.value ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_or_ps( a.value, b.value );
+#else
+   return _mm_or_ps( a.value, b.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise XOR of two vectors of single precision floating point values.
+// \ingroup simd
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the bitwise XOR.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeXor( const SIMDfloat& a, const SIMDfloat& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_ps( _mm512_xor_si512( _mm512_castps_si512( a.value ), _mm512_castps_si512( b.value ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_xor_ps( a.value, b.value );
+#else
+   return _mm_xor_ps( a.value, b.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise selection based on a less-than comparison (\f$ a < b ? x : y \f$).
+// \ingroup simd
+//
+// \param a The left-hand side operand of the comparison.
+// \param b The right-hand side operand of the comparison.
+// \param x The values selected in case the comparison holds.
+// \param y The values selected in case the comparison fails.
+// \return The selected values.
+//
+// The comparison is ordered, i.e. in case \a a or \a b is NaN the according element of \a y
+// is selected.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat
+   nativeSelectLess( const SIMDfloat& a, const SIMDfloat& b, const SIMDfloat& x, const SIMDfloat& y ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_blend_ps( _mm512_cmp_ps_mask( a.value, b.value, _CMP_LT_OQ ), y.value, x.value );
+#elif BLAZE_AVX_MODE
+   return _mm256_blendv_ps( y.value, x.value, _mm256_cmp_ps( a.value, b.value, _CMP_LT_OQ ) );
+#elif BLAZE_SSE4_MODE
+   return _mm_blendv_ps( y.value, x.value, _mm_cmplt_ps( a.value, b.value ) );
+#else
+   const __m128 mask( _mm_cmplt_ps( a.value, b.value ) );
+   return _mm_or_ps( _mm_and_ps( mask, x.value ), _mm_andnot_ps( mask, y.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise selection based on an equality comparison (\f$ a == b ? x : y \f$).
+// \ingroup simd
+//
+// \param a The left-hand side operand of the comparison.
+// \param b The right-hand side operand of the comparison.
+// \param x The values selected in case the comparison holds.
+// \param y The values selected in case the comparison fails.
+// \return The selected values.
+//
+// The comparison is ordered, i.e. in case \a a or \a b is NaN the according element of \a y
+// is selected.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat
+   nativeSelectEqual( const SIMDfloat& a, const SIMDfloat& b, const SIMDfloat& x, const SIMDfloat& y ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_blend_ps( _mm512_cmp_ps_mask( a.value, b.value, _CMP_EQ_OQ ), y.value, x.value );
+#elif BLAZE_AVX_MODE
+   return _mm256_blendv_ps( y.value, x.value, _mm256_cmp_ps( a.value, b.value, _CMP_EQ_OQ ) );
+#elif BLAZE_SSE4_MODE
+   return _mm_blendv_ps( y.value, x.value, _mm_cmpeq_ps( a.value, b.value ) );
+#else
+   const __m128 mask( _mm_cmpeq_ps( a.value, b.value ) );
+   return _mm_or_ps( _mm_and_ps( mask, x.value ), _mm_andnot_ps( mask, y.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether any element of \a a is greater than the according element of \a b.
+// \ingroup simd
+//
+// \param a The left-hand side operand of the comparison.
+// \param b The right-hand side operand of the comparison.
+// \return \a true in case at least one element of \a a is greater, \a false if not.
+*/
+BLAZE_ALWAYS_INLINE bool nativeAnyGreater( const SIMDfloat& a, const SIMDfloat& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cmp_ps_mask( a.value, b.value, _CMP_GT_OQ ) != 0;
+#elif BLAZE_AVX_MODE
+   return _mm256_movemask_ps( _mm256_cmp_ps( a.value, b.value, _CMP_GT_OQ ) ) != 0;
+#else
+   return _mm_movemask_ps( _mm_cmpgt_ps( a.value, b.value ) ) != 0;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounds a vector of single precision floating point values to the nearest integer.
+// \ingroup simd
+//
+// \param a The vector of single precision floating point values.
+// \return The rounded values.
+//
+// In contrast to the \c round() function, this function is also available for SSE2. In this
+// case the rounding is only performed for values \f$ |a| < 2^{31} \f$, all other values are
+// returned unmodified (they don't have a fractional part anyway).
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeRound( const SIMDfloat& a ) noexcept
+{
+#if BLAZE_SSE4_MODE
+   return round( a );
+#else
+   const SIMDfloat r( _mm_cvtepi32_ps( _mm_cvtps_epi32( a.value ) ) );
+   return nativeSelectLess( nativeAndNot( set( -0.0F ), a ), set( 2147483648.0F ), r, a );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ 2^n \f$ for a vector of integral single precision values.
+// \ingroup simd
+//
+// \param n The vector of integral exponents in the range \f$ [-126..127] \f$.
+// \return The resulting powers of two.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativePow2( const SIMDfloat& n ) noexcept
+{
+   // The addition places the biased exponent in the lowest mantissa bits
+   const SIMDfloat t( n + set( 8388735.0F ) );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_ps( _mm512_slli_epi32( _mm512_castps_si512( t.value ), 23 ) );
+#elif BLAZE_AVX2_MODE
+   return _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_castps_si256( t.value ), 23 ) );
+#elif BLAZE_AVX_MODE
+   const __m256i v ( _mm256_castps_si256( t.value ) );
+   const __m128i lo( _mm_slli_epi32( _mm256_castsi256_si128( v ), 23 ) );
+   const __m128i hi( _mm_slli_epi32( _mm256_extractf128_si256( v, 1 ), 23 ) );
+   return _mm256_castsi256_ps( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+#else
+   return _mm_castsi128_ps( _mm_slli_epi32( _mm_castps_si128( t.value ), 23 ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extracts the binary exponent of a vector of single precision floating point values.
+// \ingroup simd
+//
+// \param a The vector of positive, normalized single precision floating point values.
+// \return The exponents \f$ e \f$ such that \f$ a = m \cdot 2^e \f$ with \f$ m \in [0.5..1) \f$.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeExponent( const SIMDfloat& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const SIMDfloat t( _mm512_castsi512_ps( _mm512_srli_epi32( _mm512_castps_si512( a.value ), 23 ) ) );
+#elif BLAZE_AVX2_MODE
+   const SIMDfloat t( _mm256_castsi256_ps( _mm256_srli_epi32( _mm256_castps_si256( a.value ), 23 ) ) );
+#elif BLAZE_AVX_MODE
+   const __m256i v ( _mm256_castps_si256( a.value ) );
+   const __m128i lo( _mm_srli_epi32( _mm256_castsi256_si128( v ), 23 ) );
+   const __m128i hi( _mm_srli_epi32( _mm256_extractf128_si256( v, 1 ), 23 ) );
+   const SIMDfloat t( _mm256_castsi256_ps( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) ) );
+#else
+   const SIMDfloat t( _mm_castsi128_ps( _mm_srli_epi32( _mm_castps_si128( a.value ), 23 ) ) );
+#endif
+
+   // Converting the biased exponent via the bit pattern of 2^23
+   return nativeOr( t, set( 8388608.0F ) ) - set( 8388734.0F );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise AND of two vectors of double precision floating point values.
+// \ingroup simd
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the bitwise AND.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeAnd( const SIMDdouble& a, const SIMDdouble& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_pd( _mm512_and_si512( _mm512_castpd_si512( a.value ), _mm512_castpd_si512( b.value ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_and_pd( a.value, b.value );
+#else
+   return _mm_and_pd( a.value, b.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise AND of the complement of \a a and \a b for double precision values.
+// \ingroup simd
+//
+// \param a The left-hand side operand (to be complemented).
+// \param b The right-hand side operand.
+// \return The result of the bitwise AND NOT.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeAndNot( const SIMDdouble& a, const SIMDdouble& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_pd( _mm512_andnot_si512( _mm512_castpd_si512( a.value ), _mm512_castpd_si512( b.value ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_andnot_pd( a.value, b.value );
+#else
+   return _mm_andnot_pd( a.value, b.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise OR of two vectors of double precision floating point values.
+// \ingroup simd
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the bitwise OR.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeOr( const SIMDdouble& a, const SIMDdouble& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_pd( _mm512_or_si512( _mm512_castpd_si512( a.value ), _mm512_castpd_si512( b.value ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_or_pd( a.value, b.value );
+#else
+   return _mm_or_pd( a.value, b.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Bitwise XOR of two vectors of double precision floating point values.
+// \ingroup simd
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \return The result of the bitwise XOR.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeXor( const SIMDdouble& a, const SIMDdouble& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_pd( _mm512_xor_si512( _mm512_castpd_si512( a.value ), _mm512_castpd_si512( b.value ) ) );
+#elif BLAZE_AVX_MODE
+   return _mm256_xor_pd( a.value, b.value );
+#else
+   return _mm_xor_pd( a.value, b.value );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise selection based on a less-than comparison (\f$ a < b ? x : y \f$).
+// \ingroup simd
+//
+// \param a The left-hand side operand of the comparison.
+// \param b The right-hand side operand of the comparison.
+// \param x The values selected in case the comparison holds.
+// \param y The values selected in case the comparison fails.
+// \return The selected values.
+//
+// The comparison is ordered, i.e. in case \a a or \a b is NaN the according element of \a y
+// is selected.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble
+   nativeSelectLess( const SIMDdouble& a, const SIMDdouble& b, const SIMDdouble& x, const SIMDdouble& y ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_blend_pd( _mm512_cmp_pd_mask( a.value, b.value, _CMP_LT_OQ ), y.value, x.value );
+#elif BLAZE_AVX_MODE
+   return _mm256_blendv_pd( y.value, x.value, _mm256_cmp_pd( a.value, b.value, _CMP_LT_OQ ) );
+#elif BLAZE_SSE4_MODE
+   return _mm_blendv_pd( y.value, x.value, _mm_cmplt_pd( a.value, b.value ) );
+#else
+   const __m128d mask( _mm_cmplt_pd( a.value, b.value ) );
+   return _mm_or_pd( _mm_and_pd( mask, x.value ), _mm_andnot_pd( mask, y.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise selection based on an equality comparison (\f$ a == b ? x : y \f$).
+// \ingroup simd
+//
+// \param a The left-hand side operand of the comparison.
+// \param b The right-hand side operand of the comparison.
+// \param x The values selected in case the comparison holds.
+// \param y The values selected in case the comparison fails.
+// \return The selected values.
+//
+// The comparison is ordered, i.e. in case \a a or \a b is NaN the according element of \a y
+// is selected.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble
+   nativeSelectEqual( const SIMDdouble& a, const SIMDdouble& b, const SIMDdouble& x, const SIMDdouble& y ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_mask_blend_pd( _mm512_cmp_pd_mask( a.value, b.value, _CMP_EQ_OQ ), y.value, x.value );
+#elif BLAZE_AVX_MODE
+   return _mm256_blendv_pd( y.value, x.value, _mm256_cmp_pd( a.value, b.value, _CMP_EQ_OQ ) );
+#elif BLAZE_SSE4_MODE
+   return _mm_blendv_pd( y.value, x.value, _mm_cmpeq_pd( a.value, b.value ) );
+#else
+   const __m128d mask( _mm_cmpeq_pd( a.value, b.value ) );
+   return _mm_or_pd( _mm_and_pd( mask, x.value ), _mm_andnot_pd( mask, y.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether any element of \a a is greater than the according element of \a b.
+// \ingroup simd
+//
+// \param a The left-hand side operand of the comparison.
+// \param b The right-hand side operand of the comparison.
+// \return \a true in case at least one element of \a a is greater, \a false if not.
+*/
+BLAZE_ALWAYS_INLINE bool nativeAnyGreater( const SIMDdouble& a, const SIMDdouble& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_cmp_pd_mask( a.value, b.value, _CMP_GT_OQ ) != 0;
+#elif BLAZE_AVX_MODE
+   return _mm256_movemask_pd( _mm256_cmp_pd( a.value, b.value, _CMP_GT_OQ ) ) != 0;
+#else
+   return _mm_movemask_pd( _mm_cmpgt_pd( a.value, b.value ) ) != 0;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Rounds a vector of double precision floating point values to the nearest integer.
+// \ingroup simd
+//
+// \param a The vector of double precision floating point values.
+// \return The rounded values.
+//
+// In contrast to the \c round() function, this function is also available for SSE2. In this
+// case the rounding is only performed for values \f$ |a| < 2^{31} \f$, all other values are
+// returned unmodified.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeRound( const SIMDdouble& a ) noexcept
+{
+#if BLAZE_SSE4_MODE
+   return round( a );
+#else
+   const SIMDdouble r( _mm_cvtepi32_pd( _mm_cvtpd_epi32( a.value ) ) );
+   return nativeSelectLess( nativeAndNot( set( -0.0 ), a ), set( 2147483648.0 ), r, a );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ 2^n \f$ for a vector of integral double precision values.
+// \ingroup simd
+//
+// \param n The vector of integral exponents in the range \f$ [-1022..1023] \f$.
+// \return The resulting powers of two.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativePow2( const SIMDdouble& n ) noexcept
+{
+   // The addition places the biased exponent in the lowest mantissa bits
+   const SIMDdouble t( n + set( 4503599627371519.0 ) );
+
+#if BLAZE_AVX512F_MODE
+   return _mm512_castsi512_pd( _mm512_slli_epi64( _mm512_castpd_si512( t.value ), 52 ) );
+#elif BLAZE_AVX2_MODE
+   return _mm256_castsi256_pd( _mm256_slli_epi64( _mm256_castpd_si256( t.value ), 52 ) );
+#elif BLAZE_AVX_MODE
+   const __m256i v ( _mm256_castpd_si256( t.value ) );
+   const __m128i lo( _mm_slli_epi64( _mm256_castsi256_si128( v ), 52 ) );
+   const __m128i hi( _mm_slli_epi64( _mm256_extractf128_si256( v, 1 ), 52 ) );
+   return _mm256_castsi256_pd( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) );
+#else
+   return _mm_castsi128_pd( _mm_slli_epi64( _mm_castpd_si128( t.value ), 52 ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extracts the binary exponent of a vector of double precision floating point values.
+// \ingroup simd
+//
+// \param a The vector of positive, normalized double precision floating point values.
+// \return The exponents \f$ e \f$ such that \f$ a = m \cdot 2^e \f$ with \f$ m \in [0.5..1) \f$.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeExponent( const SIMDdouble& a ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const SIMDdouble t( _mm512_castsi512_pd( _mm512_srli_epi64( _mm512_castpd_si512( a.value ), 52 ) ) );
+#elif BLAZE_AVX2_MODE
+   const SIMDdouble t( _mm256_castsi256_pd( _mm256_srli_epi64( _mm256_castpd_si256( a.value ), 52 ) ) );
+#elif BLAZE_AVX_MODE
+   const __m256i v ( _mm256_castpd_si256( a.value ) );
+   const __m128i lo( _mm_srli_epi64( _mm256_castsi256_si128( v ), 52 ) );
+   const __m128i hi( _mm_srli_epi64( _mm256_extractf128_si256( v, 1 ), 52 ) );
+   const SIMDdouble t( _mm256_castsi256_pd( _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 ) ) );
+#else
+   const SIMDdouble t( _mm_castsi128_pd( _mm_srli_epi64( _mm_castpd_si128( a.value ), 52 ) ) );
+#endif
+
+   // Converting the biased exponent via the bit pattern of 2^52
+   return nativeOr( t, set( 4503599627370496.0 ) ) - set( 4503599627371518.0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GENERIC UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a polynomial via Horner's scheme.
+// \ingroup simd
+//
+// \param x The vector of arguments.
+// \param c The \a N coefficients of the polynomial in descending order.
+// \return The value \f$ c_0 x^{N-1} + c_1 x^{N-2} + ... + c_{N-1} \f$.
+*/
+template< typename T       // Type of the SIMD vector
+        , typename VT      // Type of the coefficients
+        , size_t N >       // Number of coefficients
+BLAZE_ALWAYS_INLINE const T nativePolynomial( const T& x, const VT (&c)[N] ) noexcept
+{
+   T y( set( c[0] ) );
+   for( size_t i=1UL; i<N; ++i ) {
+      y = y * x + set( c[i] );
+   }
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a monic polynomial via Horner's scheme.
+// \ingroup simd
+//
+// \param x The vector of arguments.
+// \param c The \a N non-leading coefficients of the polynomial in descending order.
+// \return The value \f$ x^N + c_0 x^{N-1} + ... + c_{N-1} \f$.
+*/
+template< typename T       // Type of the SIMD vector
+        , typename VT      // Type of the coefficients
+        , size_t N >       // Number of coefficients
+BLAZE_ALWAYS_INLINE const T nativeMonicPolynomial( const T& x, const VT (&c)[N] ) noexcept
+{
+   T y( x + set( c[0] ) );
+   for( size_t i=1UL; i<N; ++i ) {
+      y = y * x + set( c[i] );
+   }
+   return y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Element-wise application of a scalar function to a SIMD vector.
+// \ingroup simd
+//
+// \param a The vector of arguments.
+// \param op The scalar function to be applied.
+// \return The resulting vector.
+//
+// This function represents the slow path of the native kernels for arguments that are out of
+// the range of the vectorized algorithms (e.g. huge arguments of the trigonometric functions).
+*/
+template< typename T     // Type of the SIMD vector
+        , typename OP >  // Type of the scalar operation
+inline const T nativeScalar( const T& a, OP op )
+{
+   typename T::ValueType tmp[T::size];
+   storeu( tmp, a );
+   for( size_t i=0UL; i<T::size; ++i ) {
+      tmp[i] = op( tmp[i] );
+   }
+   return loadu( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ p \cdot 2^n \f$ for integral exponents \a n.
+// \ingroup simd
+//
+// \param p The vector of values to be scaled.
+// \param n The vector of integral exponents.
+// \return The scaled values.
+//
+// The scaling is performed in two steps, which allows exponents up to twice the exponent range
+// of the floating point type and results in correctly rounded denormalized results.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeScale( const T& p, const T& n ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   const T n1( nativeRound( n * set( VT(0.5) ) ) );
+   const T n2( n - n1 );
+   return ( p * nativePow2( n1 ) ) * nativePow2( n2 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the parity of integral values.
+// \ingroup simd
+//
+// \param n The vector of integral values.
+// \return A vector of \f$ n \bmod 2 \f$ (0 for even, 1 for odd values).
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeParity( const T& n ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   const T h( nativeRound( n * set( VT(0.5) ) - set( VT(0.25) ) ) );
+   return n - ( h + h );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPONENTIAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ e^r \f$ for a vector of single precision values \f$ |r| \le ln(2)/2 \f$.
+// \ingroup simd
+//
+// \param r The vector of reduced arguments.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeExpKernel( const SIMDfloat& r ) noexcept
+{
+   static constexpr float P[] = { 1.9875691500E-4F, 1.3981999507E-3F, 8.3334519073E-3F,
+                                  4.1665795894E-2F, 1.6666665459E-1F, 5.0000001201E-1F };
+
+   const SIMDfloat z( r * r );
+   return nativePolynomial( r, P ) * z + r + set( 1.0F );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ e^r \f$ for a vector of double precision values \f$ |r| \le ln(2)/2 \f$.
+// \ingroup simd
+//
+// \param r The vector of reduced arguments.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeExpKernel( const SIMDdouble& r ) noexcept
+{
+   static constexpr double P[] = { 1.26177193074810590878E-4, 3.02994407707441961300E-2,
+                                   9.99999999999999999910E-1 };
+   static constexpr double Q[] = { 3.00198505138664455042E-6, 2.52448340349684104192E-3,
+                                   2.27265548208155028766E-1, 2.00000000000000000009E0 };
+
+   const SIMDdouble z ( r * r );
+   const SIMDdouble px( r * nativePolynomial( z, P ) );
+   const SIMDdouble y ( px / ( nativePolynomial( z, Q ) - px ) );
+   return y + y + set( 1.0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Handling of overflow and underflow of the exponential functions.
+// \ingroup simd
+//
+// \param x The vector of (unreduced) arguments.
+// \param res The vector of results of the vectorized algorithm.
+// \param lo The lower bound for the arguments (below the result is 0).
+// \param hi The upper bound for the arguments (above the result is infinity).
+// \return The resulting vector.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeExpLimits( const T& x, const T& res, const T& lo, const T& hi ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   const T tmp( nativeSelectLess( hi, x, set( std::numeric_limits<VT>::infinity() ), res ) );
+   return nativeSelectLess( x, lo, set( VT(0) ), tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ e^x \f$ for a vector of single precision values.
+// \ingroup simd
+//
+// \param x The vector of single precision floating point values.
+// \return The resulting vector.
+//
+// The argument is reduced to \f$ |r| \le ln(2)/2 \f$ via Cody-Waite reduction and \f$ e^r \f$
+// is approximated by a polynomial of degree 7. The maximum observed error is 1 ulp.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeExp( const SIMDfloat& x ) noexcept
+{
+   const SIMDfloat n( nativeRound( x * set( 1.44269504088896341F ) ) );
+   const SIMDfloat r( x - n * set( 0.693359375F ) + n * set( 2.12194440E-4F ) );
+   const SIMDfloat res( nativeScale( nativeExpKernel( r ), n ) );
+   return nativeExpLimits( x, res, set( -103.972077F ), set( 88.7228391F ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ e^x \f$ for a vector of double precision values.
+// \ingroup simd
+//
+// \param x The vector of double precision floating point values.
+// \return The resulting vector.
+//
+// The argument is reduced to \f$ |r| \le ln(2)/2 \f$ via Cody-Waite reduction and \f$ e^r \f$
+// is approximated by a rational function of degree (5,6). The maximum observed error is 2 ulp.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeExp( const SIMDdouble& x ) noexcept
+{
+   const SIMDdouble n( nativeRound( x * set( 1.4426950408889634073599 ) ) );
+   const SIMDdouble r( x - n * set( 6.93145751953125E-1 ) - n * set( 1.42860682030941723212E-6 ) );
+   const SIMDdouble res( nativeScale( nativeExpKernel( r ), n ) );
+   return nativeExpLimits( x, res, set( -745.13321910194122 ), set( 709.78271289338397 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ 2^x \f$ for a vector of floating point values.
+// \ingroup simd
+//
+// \param x The vector of floating point values.
+// \return The resulting vector.
+//
+// The maximum observed error is 1 ulp (single precision) and 2 ulp (double precision).
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeExp2( const T& x ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   const T n( nativeRound( x ) );
+   const T r( ( x - n ) * set( VT(0.693147180559945309417232121458) ) );
+   const T res( nativeScale( nativeExpKernel( r ), n ) );
+   return nativeExpLimits( x, res, set( VT( std::numeric_limits<VT>::min_exponent - std::numeric_limits<VT>::digits ) ),
+                                   set( VT( std::numeric_limits<VT>::max_exponent ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ 10^x \f$ for a vector of floating point values.
+// \ingroup simd
+//
+// \param x The vector of floating point values.
+// \return The resulting vector.
+//
+// The maximum observed error is 2 ulp.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeExp10( const T& x ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   const T n( nativeRound( x * set( VT(3.32192809488736234787) ) ) );
+   const T d( x - n * set( VT(3.01025390625E-1) ) - n * set( VT(4.60503898119521373889E-6) ) );
+   const T res( nativeScale( nativeExpKernel( d * set( VT(2.30258509299404568402) ) ), n ) );
+   return nativeExpLimits( x, res, set( VT( std::numeric_limits<VT>::min_exponent10 - std::numeric_limits<VT>::digits10 - 2 ) ),
+                                   set( VT( std::numeric_limits<VT>::max_exponent10 + 1 ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOGARITHMIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction of the argument of the logarithmic functions.
+// \ingroup simd
+//
+// \param a The vector of (positive) arguments.
+// \param x The resulting reduced arguments \f$ x \in [\sqrt{0.5}-1..\sqrt{2}-1) \f$.
+// \param e The resulting exponents \f$ e \f$ such that \f$ a = (1+x) \cdot 2^e \f$.
+// \return void
+//
+// Denormalized arguments are scaled into the normalized range before the reduction.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE void nativeLogReduce( const T& a, T& x, T& e ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   const VT scaling( VT(1) / std::numeric_limits<VT>::epsilon() );
+   const VT offset ( VT( std::numeric_limits<VT>::digits - 1 ) );
+   const T  zero   ( set( VT(0) ) );
+   const T  minimum( set( std::numeric_limits<VT>::min() ) );
+
+   const T s( nativeSelectLess( a, minimum, a * set( scaling ), a ) );
+   const T m( nativeOr( nativeAndNot( set( std::numeric_limits<VT>::infinity() ), s ), set( VT(0.5) ) ) );
+   const T k( nativeExponent( s ) - nativeSelectLess( a, minimum, set( offset ), zero ) );
+
+   const T sqrth( set( VT(0.70710678118654752440) ) );
+   x = nativeSelectLess( m, sqrth, m + m, m ) - set( VT(1) );
+   e = nativeSelectLess( m, sqrth, k - set( VT(1) ), k );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the correction \f$ log(1+x) - x \f$ for single precision reduced arguments.
+// \ingroup simd
+//
+// \param x The vector of reduced arguments.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativeLogKernel( const SIMDfloat& x ) noexcept
+{
+   static constexpr float P[] = {  7.0376836292E-2F, -1.1514610310E-1F,  1.1676998740E-1F,
+                                  -1.2420140846E-1F,  1.4249322787E-1F, -1.6668057665E-1F,
+                                   2.0000714765E-1F, -2.4999993993E-1F,  3.3333331174E-1F };
+
+   const SIMDfloat z( x * x );
+   return nativePolynomial( x, P ) * x * z - z * set( 0.5F );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the higher-order terms \f$ log(1+x) - x + x^2/2 \f$ for double precision
+//        reduced arguments.
+// \ingroup simd
+//
+// \param x The vector of reduced arguments.
+// \param z The vector of squared reduced arguments.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeLogCubic( const SIMDdouble& x, const SIMDdouble& z ) noexcept
+{
+   static constexpr double P[] = { 1.01875663804580931796E-4, 4.97494994976747001425E-1,
+                                   4.70579119878881725854E0 , 1.44989225341610930846E1 ,
+                                   1.79368678507819816313E1 , 7.70838733755885391666E0  };
+   static constexpr double Q[] = { 1.12873587189167450590E1 , 4.52279145837532221105E1 ,
+                                   8.29875266912776603211E1 , 7.11544750618563894466E1 ,
+                                   2.31251620126765340583E1  };
+
+   return x * ( z * nativePolynomial( x, P ) / nativeMonicPolynomial( x, Q ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the correction \f$ log(1+x) - x \f$ for double precision reduced arguments.
+// \ingroup simd
+//
+// \param x The vector of reduced arguments.
+// \return The resulting vector.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativeLogKernel( const SIMDdouble& x ) noexcept
+{
+   const SIMDdouble z( x * x );
+   return nativeLogCubic( x, z ) - z * set( 0.5 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Handling of the special arguments of the logarithmic functions.
+// \ingroup simd
+//
+// \param a The vector of arguments.
+// \param res The vector of results of the vectorized algorithm.
+// \return The resulting vector.
+//
+// Negative arguments result in NaN, zero results in negative infinity, positive infinity and
+// NaN are returned unmodified.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeLogLimits( const T& a, const T& res ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   const T zero( set( VT(0) ) );
+   const T inf ( set( std::numeric_limits<VT>::infinity() ) );
+
+   T tmp( nativeSelectEqual( a, a, res, a ) );
+   tmp = nativeSelectEqual( a, inf, inf, tmp );
+   tmp = nativeSelectEqual( a, zero, set( -std::numeric_limits<VT>::infinity() ), tmp );
+   return nativeSelectLess( a, zero, set( std::numeric_limits<VT>::quiet_NaN() ), tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the natural logarithm for a vector of floating point values.
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \return The resulting vector.
+//
+// The argument is reduced to \f$ 1+x \in [\sqrt{0.5}..\sqrt{2}) \f$ and \f$ log(1+x) \f$ is
+// approximated by a polynomial of degree 12 (single precision) or a rational function of degree
+// (8,5) (double precision). The maximum observed error is 1 ulp.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeLog( const T& a ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   T x, e;
+   nativeLogReduce( a, x, e );
+   const T y( nativeLogKernel( x ) - e * set( VT(2.121944400546905827679E-4) ) );
+   const T res( x + y + e * set( VT(0.693359375) ) );
+   return nativeLogLimits( a, res );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the binary logarithm for a vector of floating point values.
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \return The resulting vector.
+//
+// The maximum observed error is 2 ulp. Powers of two result in exact results.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeLog2( const T& a ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   T x, e;
+   nativeLogReduce( a, x, e );
+   const T y( nativeLogKernel( x ) );
+   const T log2ea( set( VT(0.44269504088896340735992) ) );
+   const T res( y * log2ea + x * log2ea + y + x + e );
+   return nativeLogLimits( a, res );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the common logarithm for a vector of floating point values.
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \return The resulting vector.
+//
+// The maximum observed error is 2 ulp.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeLog10( const T& a ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   T x, e;
+   nativeLogReduce( a, x, e );
+   const T y( nativeLogKernel( x ) );
+   const T l10ea( set( VT(4.3359375E-1) ) );
+   const T l10eb( set( VT(7.00731903251827651129E-4) ) );
+   const T res( y * l10eb + y * l10ea + x * l10eb + x * l10ea +
+                e * set( VT(2.48745663981195213739E-4) ) + e * set( VT(3.0078125E-1) ) );
+   return nativeLogLimits( a, res );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIGONOMETRIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sine and cosine of single precision arguments \f$ |r| \le \pi/4 \f$.
+// \ingroup simd
+//
+// \param r The vector of reduced arguments.
+// \param s The resulting sine values.
+// \param c The resulting cosine values.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void nativeSinCosKernel( const SIMDfloat& r, SIMDfloat& s, SIMDfloat& c ) noexcept
+{
+   static constexpr float S[] = { -1.9515295891E-4F,  8.3321608736E-3F, -1.6666654611E-1F };
+   static constexpr float C[] = {  2.443315711809948E-5F, -1.388731625493765E-3F, 4.166664568298827E-2F };
+
+   const SIMDfloat z( r * r );
+   s = nativePolynomial( z, S ) * z * r + r;
+   c = nativePolynomial( z, C ) * z * z - z * set( 0.5F ) + set( 1.0F );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sine and cosine of double precision arguments \f$ |r| \le \pi/4 \f$.
+// \ingroup simd
+//
+// \param r The vector of reduced arguments.
+// \param s The resulting sine values.
+// \param c The resulting cosine values.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void nativeSinCosKernel( const SIMDdouble& r, SIMDdouble& s, SIMDdouble& c ) noexcept
+{
+   static constexpr double S[] = {  1.58962301576546568060E-10, -2.50507477628578072866E-8,
+                                    2.75573136213857245213E-6 , -1.98412698295895385996E-4,
+                                    8.33333333332211858878E-3 , -1.66666666666666307295E-1 };
+   static constexpr double C[] = { -1.13585365213876817300E-11,  2.08757008419747316778E-9,
+                                   -2.75573141792967388112E-7 ,  2.48015872888517045348E-5,
+                                   -1.38888888888730564116E-3 ,  4.16666666666665929218E-2 };
+
+   const SIMDdouble z( r * r );
+   s = nativePolynomial( z, S ) * z * r + r;
+   c = nativePolynomial( z, C ) * z * z - z * set( 0.5 ) + set( 1.0 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction of the argument of the trigonometric functions.
+// \ingroup simd
+//
+// \param x The vector of absolute arguments.
+// \param r The resulting reduced arguments \f$ |r| \le \pi/4 \f$.
+// \param q The resulting quadrants \f$ q \in [0..3] \f$.
+// \param odd The resulting quadrant parities (0 for even, 1 for odd quadrants).
+// \return void
+//
+// The reduction is performed via a three-part Cody-Waite reduction by \f$ \pi/2 \f$.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE void nativeTrigReduce( const T& x, T& r, T& q, T& odd ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   const bool sp( sizeof( VT ) == 4UL );
+   const T dp1( set( VT( sp ? 1.5703125                : 1.570796251296997070312E0  ) ) );
+   const T dp2( set( VT( sp ? 4.837512969970703125E-4  : 7.549789415861596353E-8   ) ) );
+   const T dp3( set( VT( sp ? 7.54978995489188216E-8   : 5.390302858158119053E-15  ) ) );
+
+   const T n( nativeRound( x * set( VT(0.636619772367581343076) ) ) );
+   r = ( ( x - n * dp1 ) - n * dp2 ) - n * dp3;
+
+   const T h( nativeRound( n * set( VT(0.25) ) - set( VT(0.375) ) ) );
+   q   = n - h * set( VT(4) );
+   odd = nativeParity( n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the largest argument of the vectorized trigonometric functions.
+// \ingroup simd
+//
+// \return The largest absolute argument handled by the vectorized algorithm.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeTrigLimit() noexcept
+{
+   using VT = typename T::ValueType;
+
+   return set( VT( sizeof( VT ) == 4UL ? 8192.0 : 268435456.0 ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the sine for a vector of floating point values.
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \return The resulting vector.
+//
+// The argument is reduced to \f$ |r| \le \pi/4 \f$ via three-part Cody-Waite reduction. For
+// double precision the maximum observed error is 1 ulp. For single precision the maximum
+// observed error is 1 ulp for \f$ |a| \le 8 \f$, beyond the relative error close to the roots
+// grows with the magnitude of the argument (up to 70 ulp for \f$ |a| \le 8192 \f$). Arguments
+// larger than 8192 (single precision) or \f$ 2^{28} \f$ (double precision) are handled by the
+// scalar \c std::sin() function.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeSin( const T& a ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   const T sign( set( VT(-0.0) ) );
+   const T x( nativeAndNot( sign, a ) );
+
+   if( nativeAnyGreater( x, nativeTrigLimit<T>() ) ) {
+      return nativeScalar( a, []( VT v ){ return std::sin( v ); } );
+   }
+
+   T r, q, odd, s, c;
+   nativeTrigReduce( x, r, q, odd );
+   nativeSinCosKernel( r, s, c );
+
+   const T y( nativeSelectLess( set( VT(0.5) ), odd, c, s ) );
+   const T flip( nativeXor( nativeAnd( sign, a ), nativeSelectLess( q, set( VT(1.5) ), set( VT(0) ), sign ) ) );
+   return nativeXor( y, flip );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the cosine for a vector of floating point values.
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \return The resulting vector.
+//
+// The argument is reduced to \f$ |r| \le \pi/4 \f$ via three-part Cody-Waite reduction. For
+// double precision the maximum observed error is 1 ulp. For single precision the maximum
+// observed error is 1 ulp for \f$ |a| \le 8 \f$, beyond the relative error close to the roots
+// grows with the magnitude of the argument (up to 70 ulp for \f$ |a| \le 8192 \f$). Arguments
+// larger than 8192 (single precision) or \f$ 2^{28} \f$ (double precision) are handled by the
+// scalar \c std::cos() function.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeCos( const T& a ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   const T sign( set( VT(-0.0) ) );
+   const T x( nativeAndNot( sign, a ) );
+
+   if( nativeAnyGreater( x, nativeTrigLimit<T>() ) ) {
+      return nativeScalar( a, []( VT v ){ return std::cos( v ); } );
+   }
+
+   T r, q, odd, s, c;
+   nativeTrigReduce( x, r, q, odd );
+   nativeSinCosKernel( r, s, c );
+
+   const T y( nativeSelectLess( set( VT(0.5) ), odd, s, c ) );
+   const T d( nativeAndNot( sign, q - set( VT(1.5) ) ) );
+   return nativeXor( y, nativeSelectLess( d, set( VT(1) ), sign, set( VT(0) ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  POWER FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Exact product of two vectors of double precision values.
+// \ingroup simd
+//
+// \param a The left-hand side operand.
+// \param b The right-hand side operand.
+// \param hi The resulting rounded product.
+// \param lo The resulting rounding error of the product (\f$ a \cdot b = hi + lo \f$).
+// \return void
+//
+// In case FMA is available, the rounding error is computed exactly by a fused multiply-subtract.
+// Otherwise the product is computed via Dekker's algorithm. Since the Dekker path is only used
+// in case FMA is not available, its intermediate products cannot be contracted into fused
+// operations, which would destroy the exactness of the rounding error. In case the product
+// overflows, the rounding error is set to 0.
+*/
+BLAZE_ALWAYS_INLINE void nativeTwoProduct( const SIMDdouble& a, const SIMDdouble& b,
+                                           SIMDdouble& hi, SIMDdouble& lo ) noexcept
+{
+#if BLAZE_FMA_MODE
+   hi = a * b;
+   const SIMDdouble err( a * b - hi );
+   lo = nativeSelectEqual( err, err, err, set( 0.0 ) );
+#else
+   const SIMDdouble split( set( 134217729.0 ) );
+
+   const SIMDdouble ca( a * split );
+   const SIMDdouble ah( ca - ( ca - a ) );
+   const SIMDdouble al( a - ah );
+   const SIMDdouble cb( b * split );
+   const SIMDdouble bh( cb - ( cb - b ) );
+   const SIMDdouble bl( b - bh );
+
+   hi = a * b;
+   const SIMDdouble err( ( ( ah * bh - hi ) + ah * bl + al * bh ) + al * bl );
+   lo = nativeSelectEqual( err, err, err, set( 0.0 ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ a^b \f$ for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of base values.
+// \param b The vector of exponents.
+// \return The resulting vector.
+//
+// The power is computed as \f$ e^{b \cdot log(a)} \f$, where both the logarithm and the product
+// \f$ b \cdot log(a) \f$ are computed in double-double precision. For the logarithm the leading
+// terms \f$ x - x^2/2 \f$ of the reduced argument are evaluated exactly and only the remaining
+// higher-order terms are evaluated in double precision. The special cases (zero, infinite, and
+// negative bases with integral exponents) are handled according to the C standard. The maximum
+// observed error is 2 ulp for \f$ |b \cdot log(a)| \le 16 \f$ and grows to 20 ulp for results
+// close to the overflow and underflow thresholds.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble nativePow( const SIMDdouble& a, const SIMDdouble& b ) noexcept
+{
+   const SIMDdouble zero( set( 0.0 ) );
+   const SIMDdouble one ( set( 1.0 ) );
+   const SIMDdouble sign( set( -0.0 ) );
+   const SIMDdouble inf ( set( std::numeric_limits<double>::infinity() ) );
+   const SIMDdouble nan ( set( std::numeric_limits<double>::quiet_NaN() ) );
+
+   const SIMDdouble x( nativeAndNot( sign, a ) );
+
+   // Computation of log(|a|) = lhi + llo
+   SIMDdouble m, e;
+   nativeLogReduce( x, m, e );
+   SIMDdouble zh, zl;
+   nativeTwoProduct( m, m, zh, zl );
+   const SIMDdouble t  ( nativeLogCubic( m, zh ) );
+   const SIMDdouble yh ( t - zh * set( 0.5 ) );
+   const SIMDdouble yl ( t - ( yh + zh * set( 0.5 ) ) );
+   const SIMDdouble ec ( e * set( 0.693359375 ) );
+   const SIMDdouble s  ( ec + m );
+   const SIMDdouble lhi( s + yh );
+   const SIMDdouble llo( ( ( yh - ( lhi - s ) ) + ( m - ( s - ec ) ) ) +
+                         ( ( yl - zl * set( 0.5 ) ) - e * set( 2.121944400546905827679E-4 ) ) );
+   const SIMDdouble log( nativeLogLimits( x, lhi ) );
+
+   // Computation of b * log(|a|) = phi + plo (special logarithms are used directly)
+   SIMDdouble phi, plo;
+   nativeTwoProduct( b, lhi, phi, plo );
+   plo = nativeSelectEqual( log, lhi, plo + b * llo, zero );
+   phi = nativeSelectEqual( log, lhi, phi, b * log );
+
+   // Computation of e^(phi+plo)
+   const SIMDdouble n( nativeRound( phi * set( 1.4426950408889634073599 ) ) );
+   const SIMDdouble r( phi - n * set( 6.93145751953125E-1 ) - n * set( 1.42860682030941723212E-6 ) + plo );
+   SIMDdouble res( nativeScale( nativeExpKernel( r ), n ) );
+   res = nativeExpLimits( phi, res, set( -745.13321910194122 ), set( 709.78271289338397 ) );
+   res = nativeSelectEqual( x, one, one, res );
+
+   // Treatment of negative bases (including -0 and -inf, which are detected via the sign bit).
+   // Odd integral exponents flip the sign of the result. Non-integral exponents result in NaN
+   // for finite bases and in the result for the absolute value in case of -0 and -inf.
+   const SIMDdouble integral( nativeSelectEqual( nativeRound( b ), b, one, zero ) );
+   const SIMDdouble odd( nativeSelectLess( set( 0.5 ), nativeParity( b ), sign, zero ) );
+   const SIMDdouble limit( nativeSelectEqual( x, zero, one, nativeSelectEqual( x, inf, one, zero ) ) );
+   const SIMDdouble fraction( nativeSelectLess( zero, limit, res, nan ) );
+   const SIMDdouble neg( nativeSelectLess( zero, integral, nativeXor( res, odd ), fraction ) );
+   res = nativeSelectLess( nativeOr( nativeAnd( sign, a ), one ), zero, neg, res );
+
+   // Treatment of the special cases pow(1,b) and pow(a,0)
+   res = nativeSelectEqual( a, one, one, res );
+   return nativeSelectEqual( b, zero, one, res );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of \f$ a^b \f$ for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of base values.
+// \param b The vector of exponents.
+// \return The resulting vector.
+//
+// The computation is performed in double precision, which results in a maximum observed error
+// of 1 ulp.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat nativePow( const SIMDfloat& a, const SIMDfloat& b ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const __m256 alo( _mm512_castps512_ps256( a.value ) );
+   const __m256 ahi( _mm256_castpd_ps( _mm512_extractf64x4_pd( _mm512_castps_pd( a.value ), 1 ) ) );
+   const __m256 blo( _mm512_castps512_ps256( b.value ) );
+   const __m256 bhi( _mm256_castpd_ps( _mm512_extractf64x4_pd( _mm512_castps_pd( b.value ), 1 ) ) );
+   const SIMDdouble lo( nativePow( SIMDdouble( _mm512_cvtps_pd( alo ) ), SIMDdouble( _mm512_cvtps_pd( blo ) ) ) );
+   const SIMDdouble hi( nativePow( SIMDdouble( _mm512_cvtps_pd( ahi ) ), SIMDdouble( _mm512_cvtps_pd( bhi ) ) ) );
+   return _mm512_castpd_ps( _mm512_insertf64x4( _mm512_castps_pd( _mm512_castps256_ps512( _mm512_cvtpd_ps( lo.value ) ) ),
+                                                _mm256_castps_pd( _mm512_cvtpd_ps( hi.value ) ), 1 ) );
+#elif BLAZE_AVX_MODE
+   const SIMDdouble lo( nativePow( SIMDdouble( _mm256_cvtps_pd( _mm256_castps256_ps128( a.value ) ) ),
+                                   SIMDdouble( _mm256_cvtps_pd( _mm256_castps256_ps128( b.value ) ) ) ) );
+   const SIMDdouble hi( nativePow( SIMDdouble( _mm256_cvtps_pd( _mm256_extractf128_ps( a.value, 1 ) ) ),
+                                   SIMDdouble( _mm256_cvtps_pd( _mm256_extractf128_ps( b.value, 1 ) ) ) ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm256_cvtpd_ps( lo.value ) ), _mm256_cvtpd_ps( hi.value ), 1 );
+#else
+   const SIMDdouble lo( nativePow( SIMDdouble( _mm_cvtps_pd( a.value ) ),
+                                   SIMDdouble( _mm_cvtps_pd( b.value ) ) ) );
+   const SIMDdouble hi( nativePow( SIMDdouble( _mm_cvtps_pd( _mm_movehl_ps( a.value, a.value ) ) ),
+                                   SIMDdouble( _mm_cvtps_pd( _mm_movehl_ps( b.value, b.value ) ) ) ) );
+   return _mm_movelh_ps( _mm_cvtpd_ps( lo.value ), _mm_cvtpd_ps( hi.value ) );
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HYPERBOLIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the hyperbolic tangent for a vector of floating point values.
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \return The resulting vector.
+//
+// For \f$ |a| < 0.625 \f$ the hyperbolic tangent is approximated by a rational function of
+// degree (9,6), for larger arguments it is computed as \f$ 1 - 2/(e^{2|a|}+1) \f$. The maximum
+// observed error is 2 ulp.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeTanh( const T& a ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   static constexpr VT P[] = { -9.64399179425052238628E-1, -9.92877231001918586564E1,
+                               -1.61468768441708447952E3 };
+   static constexpr VT Q[] = {  1.12811678491632931402E2 ,  2.23548839060100448583E3,
+                                4.84406305325125486048E3 };
+
+   const T sign( set( VT(-0.0) ) );
+   const T x( nativeAndNot( sign, a ) );
+
+   const T z( x * x );
+   const T small( nativeOr( x * z * nativePolynomial( z, P ) / nativeMonicPolynomial( z, Q ) + x, nativeAnd( sign, a ) ) );
+
+   const T e( nativeExp( x + x ) );
+   const T large( nativeOr( set( VT(1) ) - set( VT(2) ) / ( e + set( VT(1) ) ), nativeAnd( sign, a ) ) );
+
+   return nativeSelectLess( x, set( VT(0.625) ), small, large );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the error function for arguments \f$ |x| < 1 \f$.
+// \ingroup simd
+//
+// \param x The vector of arguments.
+// \return The resulting vector.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeErfKernel( const T& x ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   static constexpr VT P[] = { 9.60497373987051638749E0, 9.00260197203842689217E1,
+                               2.23200534594684319226E3, 7.00332514112805075473E3,
+                               5.55923013010394962768E4 };
+   static constexpr VT Q[] = { 3.35617141647503099647E1, 5.21357949780152679795E2,
+                               4.59432382970980127987E3, 2.26290000613890934246E4,
+                               4.92673942608635921086E4 };
+
+   const T z( x * x );
+   return x * nativePolynomial( z, P ) / nativeMonicPolynomial( z, Q );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the complementary error function for arguments \f$ x \ge 1 \f$.
+// \ingroup simd
+//
+// \param x The vector of (positive) arguments.
+// \return The resulting vector.
+//
+// The factor \f$ e^{-x^2} \f$ is computed with extra precision by splitting \a x into a part
+// with an exactly representable square and a small remainder.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeErfcKernel( const T& x ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   static constexpr VT P[] = { 2.46196981473530512524E-10, 5.64189564831068821977E-1,
+                               7.46321056442269912687E0  , 4.86371970985681366614E1 ,
+                               1.96520832956077098242E2  , 5.26445194995477358631E2 ,
+                               9.34528527171957607540E2  , 1.02755188689515710272E3 ,
+                               5.57535335369399327526E2   };
+   static constexpr VT Q[] = { 1.32281951154744992508E1  , 8.67072140885989742329E1 ,
+                               3.54937778887819891062E2  , 9.75708501743205489753E2 ,
+                               1.82390916687909736289E3  , 2.24633760818710981792E3 ,
+                               1.65666309194161350182E3  , 5.57535340817727675546E2  };
+   static constexpr VT R[] = { 5.64189583547755073984E-1 , 1.27536670759978104416E0 ,
+                               5.01905042251180477414E0  , 6.16021097993053585195E0 ,
+                               7.40974269950448939160E0  , 2.97886665372100240670E0  };
+   static constexpr VT S[] = { 2.26052863220117276590E0  , 9.39603524938001434673E0 ,
+                               1.20489539808096656605E1  , 1.70814450747565897222E1 ,
+                               9.60896809063285878198E0  , 3.36907645100081516050E0  };
+
+   const T limit( set( VT(32) ) );
+   const T y( nativeSelectLess( limit, x, limit, x ) );
+
+   const T xh( nativeRound( y * set( VT(128) ) ) * set( VT(0.0078125) ) );
+   const T xl( y - xh );
+   const T e( nativeExp( set( VT(0) ) - xh * xh ) * nativeExp( set( VT(0) ) - ( xh + xh + xl ) * xl ) );
+
+   const T pq( nativePolynomial( y, P ) / nativeMonicPolynomial( y, Q ) );
+   const T rs( nativePolynomial( y, R ) / nativeMonicPolynomial( y, S ) );
+   return e * nativeSelectLess( y, set( VT(8) ), pq, rs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the error function for a vector of floating point values.
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \return The resulting vector.
+//
+// For \f$ |a| < 1 \f$ the error function is approximated by a rational function of degree
+// (9,10), for larger arguments it is computed as \f$ 1 - erfc(|a|) \f$. The maximum observed
+// error is 3 ulp.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeErf( const T& a ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   const T sign( set( VT(-0.0) ) );
+   const T x( nativeAndNot( sign, a ) );
+
+   const T large( nativeOr( set( VT(1) ) - nativeErfcKernel( x ), nativeAnd( sign, a ) ) );
+   return nativeSelectLess( x, set( VT(1) ), nativeErfKernel( a ), large );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Native computation of the complementary error function for a vector of floating point
+//        values.
+// \ingroup simd
+//
+// \param a The vector of floating point values.
+// \return The resulting vector.
+//
+// For \f$ |a| < 1 \f$ the complementary error function is computed as \f$ 1 - erf(a) \f$, for
+// larger arguments it is approximated by \f$ e^{-a^2} \f$ times a rational function of degree
+// (8,8) or (5,6). The maximum observed error is 11 ulp.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T nativeErfc( const T& a ) noexcept
+{
+   using VT = typename T::ValueType;
+
+   const T zero( set( VT(0) ) );
+   const T x( nativeAndNot( set( VT(-0.0) ), a ) );
+
+   const T y( nativeErfcKernel( x ) );
+   const T large( nativeSelectLess( a, zero, set( VT(2) ) - y, y ) );
+   return nativeSelectLess( x, set( VT(1) ), set( VT(1) ) - nativeErfKernel( a ), large );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
+
+#endif
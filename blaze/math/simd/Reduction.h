@@ -41,7 +41,9 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/functors/Forward.h>
 #include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/SIMDPack.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
 
@@ -446,6 +448,53 @@ BLAZE_ALWAYS_INLINE const complex<double> sum( const SIMDcdouble& a ) noexcept
 }
 //*************************************************************************************************
 
+
+//=================================================================================================
+//
+//  GENERIC REDUCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reduces the elements in the given SIMD vector by means of the given binary operation.
+// \ingroup simd
+//
+// \param a The vector to be reduced.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function reduces the elements of the given SIMD vector by successively applying the
+// given binary operation \a op to the individual vector elements.
+*/
+template< typename T     // Type of the SIMD element
+        , typename OP >  // Type of the reduction operation
+BLAZE_ALWAYS_INLINE ValueType_<T> reduce( const SIMDPack<T>& a, OP op )
+{
+   ValueType_<T> value( (~a)[0UL] );
+   for( size_t k=1UL; k<T::size; ++k ) {
+      value = op( value, (~a)[k] );
+   }
+   return value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduces the elements in the given SIMD vector by means of addition.
+// \ingroup simd
+//
+// \param a The vector to be reduced.
+// \return The sum of all vector elements.
+*/
+template< typename T >  // Type of the SIMD element
+BLAZE_ALWAYS_INLINE ValueType_<T> reduce( const SIMDPack<T>& a, const Add& /*op*/ )
+{
+   return sum( ~a );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -42,8 +42,10 @@
 
 #include <blaze/math/simd/BasicTypes.h>
 #include <blaze/system/Vectorization.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/StaticAssert.h>
@@ -222,6 +224,42 @@ struct SIMDTraitBase<float>
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDTraitBase class template for 'float16'.
+// \ingroup simd
+//
+// Vectors of 'float16' values are widened to single precision in registers. Therefore the SIMD
+// type is SIMDfloat and the number of packed values is the same as for 'float'.
+*/
+template<>
+struct SIMDTraitBase<float16>
+{
+   using Type = SIMDfloat;
+   enum : size_t { size = Type::size };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SIMDTraitBase class template for 'bfloat16'.
+// \ingroup simd
+//
+// Vectors of 'bfloat16' values are widened to single precision in registers. Therefore the SIMD
+// type is SIMDfloat and the number of packed values is the same as for 'float'.
+*/
+template<>
+struct SIMDTraitBase<bfloat16>
+{
+   using Type = SIMDfloat;
+   enum : size_t { size = Type::size };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Specialization of the SIMDTraitBase class template for 'complex<float>'.
@@ -44,8 +44,10 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/constraints/Integral.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/StaticAssert.h>
@@ -381,6 +383,42 @@ BLAZE_ALWAYS_INLINE const SIMDcfloat set( const complex<float>& value ) noexcept
 
 
 
+//=================================================================================================
+//
+//  16-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sets all values in the vector to the given 'float16' value.
+// \ingroup simd
+//
+// \param value The given 'float16' value.
+// \return The set vector of 'float' values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat set( float16 value ) noexcept
+{
+   return set( static_cast<float>( value ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets all values in the vector to the given 'bfloat16' value.
+// \ingroup simd
+//
+// \param value The given 'bfloat16' value.
+// \return The set vector of 'float' values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat set( bfloat16 value ) noexcept
+{
+   return set( static_cast<float>( value ) );
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  64-BIT FLOATING POINT SIMD TYPES
@@ -41,12 +41,15 @@
 //*************************************************************************************************
 
 #include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Storeu.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
 #include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/typetraits/HasSize.h>
@@ -415,6 +418,62 @@ BLAZE_ALWAYS_INLINE void storea( complex<float>* address, const SIMDcfloat& valu
 
 
 
+//=================================================================================================
+//
+//  16-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Aligned store of a vector of 'float16' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'float' vector to be stored.
+// \return void
+//
+// This function rounds the given single precision vector to half precision and stores the
+// resulting vector of 'float16' values. The given address must be aligned according to the
+// enabled instruction set (8-byte alignment in case of SSE, 16-byte alignment in case of AVX,
+// and 32-byte alignment in case of AVX-512). Since the conversion dominates the cost of the
+// store, the aligned store is implemented in terms of the unaligned store.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void storea( float16* address, const SIMDf32<T>& value ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+   storeu( address, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned store of a vector of 'bfloat16' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'float' vector to be stored.
+// \return void
+//
+// This function rounds the given single precision vector to 'bfloat16' and stores the resulting
+// vector of 'bfloat16' values. The given address must be aligned according to the enabled
+// instruction set (8-byte alignment in case of SSE, 16-byte alignment in case of AVX, and
+// 32-byte alignment in case of AVX-512). Since the conversion dominates the cost of the store,
+// the aligned store is implemented in terms of the unaligned store.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void storea( bfloat16* address, const SIMDf32<T>& value ) noexcept
+{
+   BLAZE_INTERNAL_ASSERT( checkAlignment( address ), "Invalid alignment detected" );
+
+   storeu( address, value );
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  64-BIT FLOATING POINT SIMD TYPES
@@ -43,8 +43,10 @@
 #include <blaze/math/simd/BasicTypes.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/typetraits/HasSize.h>
@@ -407,6 +409,120 @@ BLAZE_ALWAYS_INLINE void storeu( complex<float>* address, const SIMDcfloat& valu
 
 
 
+//=================================================================================================
+//
+//  16-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Unaligned store of a vector of 'float16' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'float' vector to be stored.
+// \return void
+//
+// This function rounds the given single precision vector to half precision (round-to-nearest-
+// even) and stores the resulting vector of 'float16' values. In contrast to the according
+// \c storea() function, the given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void storeu( float16* address, const SIMDf32<T>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ),
+                        _mm512_cvtps_ph( (~value).eval().value, _MM_FROUND_TO_NEAREST_INT ) );
+#elif BLAZE_F16C_MODE && BLAZE_AVX_MODE
+   _mm_storeu_si128( reinterpret_cast<__m128i*>( address ),
+                     _mm256_cvtps_ph( (~value).eval().value, _MM_FROUND_TO_NEAREST_INT ) );
+#elif BLAZE_F16C_MODE && BLAZE_SSE2_MODE
+   _mm_storel_epi64( reinterpret_cast<__m128i*>( address ),
+                     _mm_cvtps_ph( (~value).eval().value, _MM_FROUND_TO_NEAREST_INT ) );
+#else
+   const SIMDfloat tmp( (~value).eval() );
+   for( size_t i=0UL; i<SIMDfloat::size; ++i ) {
+      address[i] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_SSE2_MODE
+/*!\brief Rounds a vector of four 'float' values to 'bfloat16'.
+// \ingroup simd
+//
+// \param value The vector of 'float' values to be rounded.
+// \return The 'bfloat16' values, sign-extended to 32-bit integers.
+//
+// This auxiliary function rounds the given single precision values to 'bfloat16' (round-to-
+// nearest-even, NaN values are kept quiet). The results are sign-extended to 32 bits such that
+// they can be narrowed without saturation by \c _mm_packs_epi32().
+*/
+BLAZE_ALWAYS_INLINE __m128i roundToBFloat16( __m128 value ) noexcept
+{
+   const __m128i x      ( _mm_castps_si128( value ) );
+   const __m128i lsb    ( _mm_and_si128( _mm_srli_epi32( x, 16 ), _mm_set1_epi32( 1 ) ) );
+   const __m128i bias   ( _mm_add_epi32( _mm_set1_epi32( 0x7FFF ), lsb ) );
+   const __m128i rounded( _mm_srai_epi32( _mm_add_epi32( x, bias ), 16 ) );
+   const __m128i quiet  ( _mm_or_si128( _mm_srai_epi32( x, 16 ), _mm_set1_epi32( 0x0040 ) ) );
+   const __m128i nan    ( _mm_castps_si128( _mm_cmpunord_ps( value, value ) ) );
+
+   return _mm_or_si128( _mm_and_si128( nan, quiet ), _mm_andnot_si128( nan, rounded ) );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unaligned store of a vector of 'bfloat16' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'float' vector to be stored.
+// \return void
+//
+// This function rounds the given single precision vector to 'bfloat16' (round-to-nearest-even)
+// and stores the resulting vector of 'bfloat16' values. In contrast to the according \c storea()
+// function, the given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void storeu( bfloat16* address, const SIMDf32<T>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const __m512    v      ( (~value).eval().value );
+   const __m512i   x      ( _mm512_castps_si512( v ) );
+   const __m512i   lsb    ( _mm512_and_si512( _mm512_srli_epi32( x, 16 ), _mm512_set1_epi32( 1 ) ) );
+   const __m512i   bias   ( _mm512_add_epi32( _mm512_set1_epi32( 0x7FFF ), lsb ) );
+   const __m512i   rounded( _mm512_srli_epi32( _mm512_add_epi32( x, bias ), 16 ) );
+   const __m512i   quiet  ( _mm512_or_si512( _mm512_srli_epi32( x, 16 ), _mm512_set1_epi32( 0x0040 ) ) );
+   const __mmask16 nan    ( _mm512_cmp_ps_mask( v, v, _CMP_UNORD_Q ) );
+   _mm256_storeu_si256( reinterpret_cast<__m256i*>( address ),
+                        _mm512_cvtepi32_epi16( _mm512_mask_blend_epi32( nan, rounded, quiet ) ) );
+#elif BLAZE_AVX_MODE
+   const __m256  v ( (~value).eval().value );
+   const __m128i lo( roundToBFloat16( _mm256_castps256_ps128( v ) ) );
+   const __m128i hi( roundToBFloat16( _mm256_extractf128_ps( v, 1 ) ) );
+   _mm_storeu_si128( reinterpret_cast<__m128i*>( address ), _mm_packs_epi32( lo, hi ) );
+#elif BLAZE_SSE2_MODE
+   const __m128i tmp( roundToBFloat16( (~value).eval().value ) );
+   _mm_storel_epi64( reinterpret_cast<__m128i*>( address ), _mm_packs_epi32( tmp, tmp ) );
+#else
+   const SIMDfloat tmp( (~value).eval() );
+   for( size_t i=0UL; i<SIMDfloat::size; ++i ) {
+      address[i] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  64-BIT FLOATING POINT SIMD TYPES
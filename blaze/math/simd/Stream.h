@@ -41,12 +41,15 @@
 //*************************************************************************************************
 
 #include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Storea.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/Vectorization.h>
 #include <blaze/util/AlignmentCheck.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/mpl/And.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/typetraits/HasSize.h>
@@ -387,6 +390,58 @@ BLAZE_ALWAYS_INLINE void stream( complex<float>* address, const SIMDcfloat& valu
 
 
 
+//=================================================================================================
+//
+//  16-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Aligned, non-temporal store of a vector of 'float16' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'float' vector to be stored.
+// \return void
+//
+// This function rounds the given single precision vector to half precision and stores the
+// resulting vector of 'float16' values. The given address must be aligned according to the
+// enabled instruction set (8-byte alignment in case of SSE, 16-byte alignment in case of AVX,
+// and 32-byte alignment in case of AVX-512). In contrast to the other data types, the values
+// are stored by a regular aligned store, i.e. without non-temporal hint.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void stream( float16* address, const SIMDf32<T>& value ) noexcept
+{
+   storea( address, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aligned, non-temporal store of a vector of 'bfloat16' values.
+// \ingroup simd
+//
+// \param address The target address.
+// \param value The 'float' vector to be stored.
+// \return void
+//
+// This function rounds the given single precision vector to 'bfloat16' and stores the resulting
+// vector of 'bfloat16' values. The given address must be aligned according to the enabled
+// instruction set (8-byte alignment in case of SSE, 16-byte alignment in case of AVX, and
+// 32-byte alignment in case of AVX-512). In contrast to the other data types, the values are
+// stored by a regular aligned store, i.e. without non-temporal hint.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void stream( bfloat16* address, const SIMDf32<T>& value ) noexcept
+{
+   storea( address, value );
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  64-BIT FLOATING POINT SIMD TYPES
@@ -0,0 +1,243 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/SparseLines.h
+//  \brief Header file for the row/column traversal of matrix operands in SMP sparse assignments
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_SPARSELINES_H_
+#define _BLAZE_MATH_SMP_SPARSELINES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LINE TRAVERSAL FUNCTIONALITY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Visits the elements of a single row/column of a sparse matrix operand.
+// \ingroup smp
+//
+// \param rhs The sparse matrix operand.
+// \param k The index of the row (row-major) or column (column-major) to be visited.
+// \param visit The visitor, called with the index and value of each element.
+// \return void
+//
+// This function passes all elements of the given row/column of the sparse matrix \a rhs to
+// the \a visit function, including explicitly stored default values. It is used by the SMP
+// backends to count the non-zero elements of the target rows/columns in a first pass and to
+// append them to the exactly reserved target matrix in a second pass.
+*/
+template< bool SO             // Storage order of the target and the sparse matrix
+        , typename Type       // Element type of the target matrix
+        , typename MT         // Type of the sparse matrix
+        , typename Visitor >  // Type of the visitor
+inline void smpVisitLine( const SparseMatrix<MT,SO>& rhs, size_t k, Visitor&& visit )
+{
+   const auto end( (~rhs).end(k) );
+   for( auto element=(~rhs).begin(k); element!=end; ++element ) {
+      visit( element->index(), element->value() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Visits the non-default elements of a single row/column of a dense matrix operand.
+// \ingroup smp
+//
+// \param rhs The dense matrix operand.
+// \param k The index of the row (if \a SO is \a false) or column (if \a SO is \a true).
+// \param visit The visitor, called with the index and value of each non-default element.
+// \return void
+//
+// This function passes all elements of the given row/column of the dense matrix \a rhs that
+// are not default values after the conversion to \a Type to the \a visit function. In case
+// \a rhs is a lower or upper matrix, the known zero elements are skipped.
+*/
+template< bool SO             // Storage order of the target matrix
+        , typename Type       // Element type of the target matrix
+        , typename MT         // Type of the dense matrix
+        , bool SO2            // Storage order of the dense matrix
+        , typename Visitor >  // Type of the visitor
+inline void smpVisitLine( const DenseMatrix<MT,SO2>& rhs, size_t k, Visitor&& visit )
+{
+   constexpr bool lower( SO ? IsLower<MT>::value : IsUpper<MT>::value );
+   constexpr bool upper( SO ? IsUpper<MT>::value : IsLower<MT>::value );
+   constexpr bool strictlyLower( SO ? IsStrictlyLower<MT>::value : IsStrictlyUpper<MT>::value );
+   constexpr bool strictlyUpper( SO ? IsStrictlyUpper<MT>::value : IsStrictlyLower<MT>::value );
+
+   const size_t ibegin( lower ? ( strictlyLower ? k+1UL : k ) : 0UL );
+   const size_t iend  ( upper ? ( strictlyUpper ? k : k+1UL )
+                              : ( SO ? (~rhs).rows() : (~rhs).columns() ) );
+
+   for( size_t i=ibegin; i<iend; ++i ) {
+      const Type value( SO ? (~rhs)(i,k) : (~rhs)(k,i) );
+      if( !isDefault<strict>( value ) )
+         visit( i, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Visits the elements of the combination of a single row/column of two sparse matrices.
+// \ingroup smp
+//
+// \param lhs The left-hand side sparse matrix operand.
+// \param rhs The right-hand side sparse matrix operand.
+// \param k The index of the row (row-major) or column (column-major) to be visited.
+// \param op The binary operation for the combination of the two operands (addition/subtraction).
+// \param visit The visitor, called with the index and value of each resulting element.
+// \return void
+//
+// This function merges the given row/column of the two sparse matrices \a lhs and \a rhs and
+// passes the union of their elements to the \a visit function. Elements that are only contained
+// in one of the operands are combined with a default value. In accordance with the serial
+// addition and subtraction of sparse matrices, the resulting elements are never dropped, even
+// if their value is zero.
+*/
+template< typename Type       // Element type of the target matrix
+        , typename MT1        // Type of the left-hand side sparse matrix
+        , typename MT2        // Type of the right-hand side sparse matrix
+        , bool SO             // Storage order of both sparse matrices
+        , typename OP         // Type of the binary operation
+        , typename Visitor >  // Type of the visitor
+inline void smpVisitMergedLine( const SparseMatrix<MT1,SO>& lhs, const SparseMatrix<MT2,SO>& rhs,
+                                size_t k, OP op, Visitor&& visit )
+{
+   const auto lend( (~lhs).end(k) );
+   const auto rend( (~rhs).end(k) );
+
+   auto l( (~lhs).begin(k) );
+   auto r( (~rhs).begin(k) );
+
+   while( l != lend && r != rend )
+   {
+      if( l->index() < r->index() ) {
+         visit( l->index(), l->value() );
+         ++l;
+      }
+      else if( l->index() > r->index() ) {
+         visit( r->index(), op( ElementType_<MT2>(), r->value() ) );
+         ++r;
+      }
+      else {
+         visit( l->index(), op( l->value(), r->value() ) );
+         ++l;
+         ++r;
+      }
+   }
+
+   for( ; l!=lend; ++l ) {
+      visit( l->index(), l->value() );
+   }
+
+   for( ; r!=rend; ++r ) {
+      visit( r->index(), op( ElementType_<MT2>(), r->value() ) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Visits the non-default elements of the combination of a single row/column of a sparse
+//        and a dense matrix.
+// \ingroup smp
+//
+// \param lhs The left-hand side sparse matrix operand.
+// \param rhs The right-hand side dense matrix operand.
+// \param k The index of the row (row-major) or column (column-major) to be visited.
+// \param op The binary operation for the combination of the two operands (addition/subtraction).
+// \param visit The visitor, called with the index and value of each non-default element.
+// \return void
+//
+// This function combines the given row/column of the sparse matrix \a lhs with the according
+// row/column of the dense matrix \a rhs and passes all resulting elements to the \a visit
+// function that are not default values after the conversion to \a Type.
+*/
+template< typename Type       // Element type of the target matrix
+        , typename MT1        // Type of the left-hand side sparse matrix
+        , bool SO             // Storage order of the left-hand side sparse matrix
+        , typename MT2        // Type of the right-hand side dense matrix
+        , bool SO2            // Storage order of the right-hand side dense matrix
+        , typename OP         // Type of the binary operation
+        , typename Visitor >  // Type of the visitor
+inline void smpVisitMergedLine( const SparseMatrix<MT1,SO>& lhs, const DenseMatrix<MT2,SO2>& rhs,
+                                size_t k, OP op, Visitor&& visit )
+{
+   const size_t n( SO ? (~rhs).rows() : (~rhs).columns() );
+
+   const auto lend( (~lhs).end(k) );
+   auto l( (~lhs).begin(k) );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const bool stored( l != lend && l->index() == i );
+      const Type value( op( stored ? Type( l->value() ) : Type()
+                          , SO ? (~rhs)(i,k) : (~rhs)(k,i) ) );
+
+      if( stored )
+         ++l;
+
+      if( !isDefault<strict>( value ) )
+         visit( i, value );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
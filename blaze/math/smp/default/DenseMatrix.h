@@ -40,14 +40,17 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/StorageOrder.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -76,6 +79,9 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline EnableIf_< IsDenseMatrix<MT1> >
    smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT, bool SO >
+inline void smpFill( DenseMatrix<MT,SO>& lhs, const ElementType_<MT>& value );
 //@}
 //*************************************************************************************************
 
@@ -205,6 +211,40 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP initialization of a dense matrix.
+// \ingroup smp
+//
+// \param lhs The dense matrix to be initialized.
+// \param value The initial value of all elements of the matrix.
+// \return void
+//
+// This function implements the default SMP initialization of a dense matrix, which sets all
+// elements of the given matrix to the given value.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void smpFill( DenseMatrix<MT,SO>& lhs, const ElementType_<MT>& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( SO == rowMajor ) {
+      for( size_t i=0UL; i<(~lhs).rows(); ++i )
+         for( size_t j=0UL; j<(~lhs).columns(); ++j )
+            (~lhs)(i,j) = value;
+   }
+   else {
+      for( size_t j=0UL; j<(~lhs).columns(); ++j )
+         for( size_t i=0UL; i<(~lhs).rows(); ++i )
+            (~lhs)(i,j) = value;
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
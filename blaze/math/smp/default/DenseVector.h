@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Vector.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
@@ -48,6 +49,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -80,6 +82,9 @@ inline EnableIf_< IsDenseVector<VT1> >
 template< typename VT1, bool TF1, typename VT2, bool TF2 >
 inline EnableIf_< IsDenseVector<VT1> >
    smpDivAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename VT, bool TF >
+inline void smpFill( DenseVector<VT,TF>& lhs, const ElementType_<VT>& value );
 //@}
 //*************************************************************************************************
 
@@ -229,6 +234,32 @@ inline EnableIf_< IsDenseVector<VT1> >
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Default implementation of the SMP initialization of a dense vector.
+// \ingroup smp
+//
+// \param lhs The dense vector to be initialized.
+// \param value The initial value of all elements of the vector.
+// \return void
+//
+// This function implements the default SMP initialization of a dense vector, which sets all
+// elements of the given vector to the given value.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+inline void smpFill( DenseVector<VT,TF>& lhs, const ElementType_<VT>& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   for( size_t i=0UL; i<(~lhs).size(); ++i )
+      (~lhs)[i] = value;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -46,6 +46,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -74,6 +75,10 @@ inline EnableIf_< IsSparseMatrix<MT1> >
 template< typename MT1, bool SO1, typename MT2, bool SO2 >
 inline EnableIf_< IsSparseMatrix<MT1> >
    smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+inline EnableIf_< IsSparseMatrix<MT1>, bool >
+   smpAssembles( const Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
 //@}
 //*************************************************************************************************
 
@@ -202,6 +207,33 @@ inline EnableIf_< IsSparseMatrix<MT1> >
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Returns whether the default SMP assignment of the given matrix assembles the target
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return \a false.
+//
+// This function returns whether the SMP assignment of \a rhs to \a lhs allocates the storage
+// of \a lhs itself. Since the default SMP assignment is performed serially via the assign()
+// function, the storage of \a lhs always has to be reserved beforehand.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< IsSparseMatrix<MT1>, bool >
+   smpAssembles( const Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   UNUSED_PARAMETER( lhs, rhs );
+
+   return false;
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -123,7 +123,7 @@ void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& r
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -192,7 +192,7 @@ void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>&
    const size_t addon2       ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~rhs).columns() / threadmap.second + addon2 );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( size_t i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -354,7 +354,7 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -423,7 +423,7 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2
    const size_t addon2       ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~rhs).columns() / threadmap.second + addon2 );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( size_t i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -585,7 +585,7 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -655,7 +655,7 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2
    const size_t addon2       ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~rhs).columns() / threadmap.second + addon2 );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( size_t i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -818,7 +818,7 @@ void smpSchurAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -888,7 +888,7 @@ void smpSchurAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,S
    const size_t addon2       ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~rhs).columns() / threadmap.second + addon2 );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( size_t i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -1038,6 +1038,121 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 
 
 
+//=================================================================================================
+//
+//  INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP initialization of a dense matrix.
+// \ingroup math
+//
+// \param lhs The dense matrix to be initialized.
+// \param value The initial value of all elements of the matrix.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP initialization
+// of a dense matrix. The matrix is partitioned in the same way as for the SMP assignment and each
+// part is initialized by the thread that processes the part during the SMP assignments. Thus on
+// NUMA systems the memory pages of each part are placed in the memory of this thread (first
+// touch) in case the OpenMP threads are bound to processors (see \c OMP_PROC_BIND).\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void smpFill_backend( DenseMatrix<MT,SO>& lhs, const ElementType_<MT>& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   constexpr bool simdEnabled( MT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_<MT> >::size );
+
+   const int threads( omp_get_num_threads() );
+   const ThreadMapping threadmap( createThreadMapping( threads, ~lhs ) );
+
+   const size_t addon1     ( ( ( (~lhs).rows() % threadmap.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~lhs).rows() / threadmap.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( (~lhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~lhs).columns() / threadmap.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+#pragma omp for schedule(static) nowait
+   for( int i=0; i<threads; ++i )
+   {
+      const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
+      const size_t column( ( i % threadmap.second ) * colsPerThread );
+
+      if( row >= (~lhs).rows() || column >= (~lhs).columns() )
+         continue;
+
+      const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+
+      auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+      target = value;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP initialization of a dense matrix.
+// \ingroup math
+//
+// \param lhs The dense matrix to be initialized.
+// \param value The initial value of all elements of the matrix.
+// \return void
+//
+// This function implements the OpenMP-based SMP initialization of a dense matrix,
+// which sets all elements of the given matrix to the given value. In case the matrix is not
+// SMP-assignable, is too small for a parallel execution, or the function is called from within
+// a parallel section or an OpenMP parallel region, the matrix is initialized serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void smpFill( DenseMatrix<MT,SO>& lhs, const ElementType_<MT>& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   auto full( submatrix<unaligned>( ~lhs, 0UL, 0UL, (~lhs).rows(), (~lhs).columns() ) );
+
+   if( !IsSMPAssignable<MT>::value || isParallelSectionActive() || omp_in_parallel() ) {
+      full = value;
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~lhs).canSMPAssign() ) {
+         full = value;
+      }
+      else {
+#pragma omp parallel shared( lhs, value )
+         smpFill_backend( ~lhs, value );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -113,7 +113,7 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -175,7 +175,7 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -325,7 +325,7 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -387,7 +387,7 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -537,7 +537,7 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -599,7 +599,7 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -750,7 +750,7 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -813,7 +813,7 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -963,7 +963,7 @@ void smpDivAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -1081,6 +1081,112 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
 
 
+//=================================================================================================
+//
+//  INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP initialization of a dense vector.
+// \ingroup math
+//
+// \param lhs The dense vector to be initialized.
+// \param value The initial value of all elements of the vector.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP initialization
+// of a dense vector. The vector is partitioned in the same way as for the SMP assignment and each
+// part is initialized by the thread that processes the part during the SMP assignments. Thus on
+// NUMA systems the memory pages of each part are placed in the memory of this thread (first
+// touch) in case the OpenMP threads are bound to processors (see \c OMP_PROC_BIND).\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+void smpFill_backend( DenseVector<VT,TF>& lhs, const ElementType_<VT>& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   constexpr bool simdEnabled( VT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_<VT> >::size );
+
+   const int    threads      ( omp_get_num_threads() );
+   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~lhs).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+#pragma omp for schedule(static) nowait
+   for( int i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~lhs).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+
+      auto target( subvector<unaligned>( ~lhs, index, size ) );
+      target = value;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP initialization of a dense vector.
+// \ingroup math
+//
+// \param lhs The dense vector to be initialized.
+// \param value The initial value of all elements of the vector.
+// \return void
+//
+// This function implements the OpenMP-based SMP initialization of a dense vector,
+// which sets all elements of the given vector to the given value. In case the vector is not
+// SMP-assignable, is too small for a parallel execution, or the function is called from within
+// a parallel section or an OpenMP parallel region, the vector is initialized serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+inline void smpFill( DenseVector<VT,TF>& lhs, const ElementType_<VT>& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   auto full( subvector<unaligned>( ~lhs, 0UL, (~lhs).size() ) );
+
+   if( !IsSMPAssignable<VT>::value || isParallelSectionActive() || omp_in_parallel() ) {
+      full = value;
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~lhs).canSMPAssign() ) {
+         full = value;
+      }
+      else {
+#pragma omp parallel shared( lhs, value )
+         smpFill_backend( ~lhs, value );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -0,0 +1,985 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/SparseMatrix.h
+//  \brief Header file for the OpenMP-based sparse matrix SMP implementation
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_SPARSEMATRIX_H_
+#define _BLAZE_MATH_SMP_OPENMP_SPARSEMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/SMPAssignable.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Sub.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/SparseLines.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsMatMatAddExpr.h>
+#include <blaze/math/typetraits/IsMatMatSubExpr.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/mpl/Or.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PLAIN ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a matrix to a sparse matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment
+// of a matrix to a general sparse matrix. Since a general sparse matrix does not provide the
+// means to assemble its rows/columns independently, the assignment is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void smpAssign_backend( SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Concurrent execution of the given kernel for all rows/columns of a compressed matrix.
+// \ingroup math
+//
+// \param size The total number of rows (row-major) or columns (column-major).
+// \param kernel The kernel to be executed for the ranges of rows/columns.
+// \return void
+//
+// This function splits the range \f$[0..size)\f$ into chunks and executes the given \a kernel
+// concurrently for all chunks. The threads are oversubscribed in order to balance rows/columns
+// with irregular numbers of non-zero elements.
+*/
+template< typename Kernel >  // Type of the range kernel
+void smpForLines_backend( size_t size, const Kernel& kernel )
+{
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   if( size == 0UL )
+      return;
+
+   const size_t chunks( min( 4UL*size_t( omp_get_max_threads() ), size ) );
+   const size_t addon ( ( ( size % chunks ) != 0UL )? 1UL : 0UL );
+   const size_t sizePerChunk( size / chunks + addon );
+   const int    numChunks( static_cast<int>( ( size + sizePerChunk - 1UL ) / sizePerChunk ) );
+
+#pragma omp parallel for schedule(dynamic,1)
+   for( int c=0; c<numChunks; ++c )
+   {
+      const size_t first( c*sizePerChunk );
+      const size_t last ( min( first+sizePerChunk, size ) );
+
+      kernel( first, last );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Concurrent assembly of a compressed matrix from the given row/column visitor.
+// \ingroup math
+//
+// \param lhs The target compressed matrix, which is replaced by the assembled matrix.
+// \param m The number of rows of the assembled matrix.
+// \param n The number of columns of the assembled matrix.
+// \param visitLine The visitor for the elements of a single row/column of the result.
+// \param inplace \a true if the elements can be appended directly to \a lhs, \a false if not.
+// \return void
+//
+// This function assembles the compressed matrix \a lhs in two concurrent passes over all rows
+// (in case of a row-major matrix) or columns (in case of a column-major matrix). The first
+// pass counts the elements of each row/column, which allows to reserve the exact storage for
+// the result in a single allocation. The second pass appends the elements directly into the
+// reserved storage via the low-level append() function. In case \a visitLine depends on the
+// current state of \a lhs (\a inplace is \a false), the elements are appended to a new matrix,
+// which subsequently replaces \a lhs.
+*/
+template< typename Type       // Data type of the compressed matrix
+        , bool SO             // Storage order of the compressed matrix
+        , typename Visitor >  // Type of the row/column visitor
+void smpAssemble_backend( CompressedMatrix<Type,SO>& lhs, size_t m, size_t n,
+                          const Visitor& visitLine, bool inplace )
+{
+   const size_t size( SO ? n : m );
+
+   // Concurrent counting of the elements per row/column
+   std::vector<size_t> nonzeros( size, 0UL );
+
+   smpForLines_backend( size, [&nonzeros,&visitLine]( size_t first, size_t last ) {
+      for( size_t k=first; k<last; ++k ) {
+         size_t count( 0UL );
+         visitLine( k, [&count]( size_t, const auto& ) { ++count; } );
+         nonzeros[k] = count;
+      }
+   } );
+
+   // Reserving the exact storage for all rows/columns of the target matrix
+   CompressedMatrix<Type,SO> tmp( m, n, nonzeros );
+
+   if( inplace )
+      swap( lhs, tmp );
+
+   CompressedMatrix<Type,SO>& target( inplace ? lhs : tmp );
+
+   // Concurrent filling of the reserved storage
+   smpForLines_backend( size, [&target,&visitLine]( size_t first, size_t last ) {
+      for( size_t k=first; k<last; ++k ) {
+         visitLine( k, [&target,k]( size_t index, const auto& value ) {
+            if( SO ) target.append( index, k, value );
+            else     target.append( k, index, value );
+         } );
+      }
+   } );
+
+   if( !inplace )
+      swap( lhs, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a matrix to a compressed
+//        matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment
+// of a dense matrix or a sparse matrix with the same storage order to a compressed matrix.
+// Since the rows/columns of the right-hand side operand can be traversed without evaluation,
+// the non-zero elements per row/column are counted concurrently, the exact storage is reserved
+// in a single allocation and the elements are concurrently appended to the target matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO1       // Storage order of the left-hand side compressed matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+EnableIf_< And< Not< RequiresEvaluation<MT2> >
+              , Or< IsDenseMatrix<MT2>, BoolConstant< SO1 == SO2 > > > >
+   smpAssign_backend( CompressedMatrix<Type,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const auto visitLine = [&rhs]( size_t k, const auto& visit ) {
+      smpVisitLine<SO1,Type>( ~rhs, k, visit );
+   };
+
+   smpAssemble_backend( lhs, (~rhs).rows(), (~rhs).columns(), visitLine, true );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP assignment of a sparse matrix addition or
+//        subtraction to a compressed matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side addition or subtraction to be assigned.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP assignment
+// of a sparse matrix addition or subtraction to a compressed matrix. The operands are only
+// evaluated in case they are computations themselves or differ in storage order from the
+// target matrix. Afterwards the rows/columns of both operands are concurrently merged into
+// the exactly reserved storage of the target matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO1       // Storage order of the left-hand side compressed matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+EnableIf_< And< RequiresEvaluation<MT2>, IsSparseMatrix<MT2>
+              , Or< IsMatMatAddExpr<MT2>, IsMatMatSubExpr<MT2> > > >
+   smpAssign_backend( CompressedMatrix<Type,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   using LT = RemoveCV_< RemoveReference_< typename MT2::LeftOperand  > >;
+   using RT = RemoveCV_< RemoveReference_< typename MT2::RightOperand > >;
+
+   using LC = If_< BoolConstant< IsColumnMajorMatrix<LT>::value == SO1 >
+                 , CompositeType_<LT>, const CompressedMatrix<ElementType_<LT>,SO1> >;
+   using RC = If_< BoolConstant< IsColumnMajorMatrix<RT>::value == SO1 >
+                 , CompositeType_<RT>, const CompressedMatrix<ElementType_<RT>,SO1> >;
+
+   using OP = If_< IsMatMatAddExpr<MT2>, Add, Sub >;
+
+   LC A( (~rhs).leftOperand()  );  // Evaluation of the left-hand side sparse matrix operand
+   RC B( (~rhs).rightOperand() );  // Evaluation of the right-hand side sparse matrix operand
+
+   const auto visitLine = [&A,&B]( size_t k, const auto& visit ) {
+      smpVisitMergedLine<Type>( A, B, k, OP(), visit );
+   };
+
+   smpAssemble_backend( lhs, (~rhs).rows(), (~rhs).columns(), visitLine, true );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the OpenMP-based SMP assignment of the given matrix assembles
+//        the target compressed matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return \a true in case the assignment allocates the storage of \a lhs itself, \a false if not.
+//
+// This function returns whether the SMP assignment of \a rhs to \a lhs is performed via the
+// concurrent assembly of the target matrix, which allocates the exact storage of the result
+// and discards the storage previously reserved for \a lhs. It is used by the conversion
+// constructor of the compressed matrix to avoid a redundant reservation of its storage.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO1       // Storage order of the left-hand side compressed matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSMPAssignable<MT2>
+                     , Or< And< Not< RequiresEvaluation<MT2> >
+                              , Or< IsDenseMatrix<MT2>, BoolConstant< SO1 == SO2 > > >
+                         , And< RequiresEvaluation<MT2>, IsSparseMatrix<MT2>
+                              , Or< IsMatMatAddExpr<MT2>, IsMatMatSubExpr<MT2> > > > >, bool >
+   smpAssembles( const CompressedMatrix<Type,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   UNUSED_PARAMETER( lhs );
+
+   return IsSMPAssignable< CompressedMatrix<Type,SO1> >::value &&
+          !isParallelSectionActive() && !isSerialSectionActive() && (~rhs).canSMPAssign();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the OpenMP-based SMP assignment of the given matrix assembles
+//        the target compressed matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return \a false.
+//
+// This function handles all operands that are never assigned via the concurrent assembly of
+// the target matrix and therefore require the storage of \a lhs to be reserved beforehand.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO1       // Storage order of the left-hand side compressed matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline DisableIf_< And< IsSMPAssignable<MT2>
+                      , Or< And< Not< RequiresEvaluation<MT2> >
+                               , Or< IsDenseMatrix<MT2>, BoolConstant< SO1 == SO2 > > >
+                          , And< RequiresEvaluation<MT2>, IsSparseMatrix<MT2>
+                               , Or< IsMatMatAddExpr<MT2>, IsMatMatSubExpr<MT2> > > > >, bool >
+   smpAssembles( const CompressedMatrix<Type,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   UNUSED_PARAMETER( lhs, rhs );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the default OpenMP-based SMP assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the element types of
+// both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>
+                     , Or< Not< IsSMPAssignable<MT1> >
+                         , Not< IsSMPAssignable<MT2> > > > >
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   assign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function implements the OpenMP-based SMP assignment to a sparse matrix. Due
+// to the explicit application of the SFINAE principle, this function can only be selected by
+// the compiler in case both operands are SMP-assignable and the element types of both operands
+// are not SMP-assignable. Since sparse temporaries are frequently created within the kernels
+// of other SMP assignments, the assignment is performed serially in case a parallel section
+// is already active.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable<MT2> > >
+   smpAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT2> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isParallelSectionActive() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      assign( ~lhs, ~rhs );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpAssign_backend( ~lhs, ~rhs );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDITION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a matrix to a sparse
+//        matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition
+// assignment of a matrix to a general sparse matrix, which is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void smpAddAssign_backend( SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition or subtraction assignment of a
+//        matrix to a compressed matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be added or subtracted.
+// \param op The operation to be performed (addition or subtraction).
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition
+// and subtraction assignment of a dense matrix or a sparse matrix with the same storage order
+// to a compressed matrix. The rows/columns of the target matrix and the right-hand side operand
+// are concurrently merged into a new, exactly reserved compressed matrix, which subsequently
+// replaces the target matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO1       // Storage order of the left-hand side compressed matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2       // Storage order of the right-hand side matrix
+        , typename OP >  // Type of the operation
+EnableIf_< And< Not< RequiresEvaluation<MT2> >
+              , Or< IsDenseMatrix<MT2>, BoolConstant< SO1 == SO2 > > > >
+   smpMergeAssign_backend( CompressedMatrix<Type,SO1>& lhs, const Matrix<MT2,SO2>& rhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const auto visitLine = [&lhs,&rhs,op]( size_t k, const auto& visit ) {
+      smpVisitMergedLine<Type>( lhs, ~rhs, k, op, visit );
+   };
+
+   smpAssemble_backend( lhs, lhs.rows(), lhs.columns(), visitLine, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition or subtraction assignment of a
+//        matrix computation to a compressed matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix computation to be added or subtracted.
+// \param op The operation to be performed (addition or subtraction).
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition
+// and subtraction assignment of a matrix computation to a compressed matrix. The computation
+// is evaluated first, before the result is concurrently merged with the target matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO1       // Storage order of the left-hand side compressed matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2       // Storage order of the right-hand side matrix
+        , typename OP >  // Type of the operation
+EnableIf_< RequiresEvaluation<MT2> >
+   smpMergeAssign_backend( CompressedMatrix<Type,SO1>& lhs, const Matrix<MT2,SO2>& rhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   const ResultType_<MT2> tmp( ~rhs );
+   smpMergeAssign_backend( lhs, tmp, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition or subtraction assignment of a
+//        sparse matrix with opposite storage order to a compressed matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side sparse matrix to be added or subtracted.
+// \param op The operation to be performed (addition or subtraction).
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition
+// and subtraction assignment of a sparse matrix with opposite storage order to a compressed
+// matrix. Since the rows/columns of the target matrix cannot be merged independently with the
+// right-hand side operand, the operation is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO1       // Storage order of the left-hand side compressed matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2       // Storage order of the right-hand side matrix
+        , typename OP >  // Type of the operation
+EnableIf_< And< Not< RequiresEvaluation<MT2> >, IsSparseMatrix<MT2>, BoolConstant< SO1 != SO2 > > >
+   smpMergeAssign_backend( CompressedMatrix<Type,SO1>& lhs, const Matrix<MT2,SO2>& rhs, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   if( IsSame<OP,Add>::value ) addAssign( lhs, ~rhs );
+   else                        subAssign( lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP addition assignment of a matrix to a
+//        compressed matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP addition
+// assignment of a matrix to a compressed matrix. The rows/columns of both operands are merged
+// concurrently into a new, exactly reserved compressed matrix, which replaces the target matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO1       // Storage order of the left-hand side compressed matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void smpAddAssign_backend( CompressedMatrix<Type,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   smpMergeAssign_backend( lhs, ~rhs, Add() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP addition assignment to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the default OpenMP-based SMP addition assignment to a
+// sparse matrix. Due to the explicit application of the SFINAE principle, this function can
+// only be selected by the compiler in case both operands are SMP-assignable and the element
+// types of both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>
+                     , Or< Not< IsSMPAssignable<MT1> >
+                         , Not< IsSMPAssignable<MT2> > > > >
+   smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   addAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP addition assignment to a sparse
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function implements the OpenMP-based SMP addition assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the element types of
+// both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable<MT2> > >
+   smpAddAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT2> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isParallelSectionActive() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      addAssign( ~lhs, ~rhs );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpAddAssign_backend( ~lhs, ~rhs );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRACTION ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a matrix to a
+//        sparse matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP subtraction
+// assignment of a matrix to a general sparse matrix, which is performed serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+void smpSubAssign_backend( SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the OpenMP-based SMP subtraction assignment of a matrix to a
+//        compressed matrix.
+// \ingroup math
+//
+// \param lhs The target left-hand side compressed matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function is the backend implementation of the OpenMP-based SMP subtraction
+// assignment of a matrix to a compressed matrix. The rows/columns of both operands are merged
+// concurrently into a new, exactly reserved compressed matrix, which replaces the target matrix.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the left-hand side compressed matrix
+        , bool SO1       // Storage order of the left-hand side compressed matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+void smpSubAssign_backend( CompressedMatrix<Type,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   smpMergeAssign_backend( lhs, ~rhs, Sub() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the OpenMP-based SMP subtraction assignment to a
+//        sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the default OpenMP-based SMP subtraction assignment to
+// a sparse matrix. Due to the explicit application of the SFINAE principle, this function can
+// only be selected by the compiler in case both operands are SMP-assignable and the element
+// types of both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>
+                     , Or< Not< IsSMPAssignable<MT1> >
+                         , Not< IsSMPAssignable<MT2> > > > >
+   smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   subAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP subtraction assignment to a sparse
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function implements the OpenMP-based SMP subtraction assignment to a sparse
+// matrix. Due to the explicit application of the SFINAE principle, this function can only be
+// selected by the compiler in case both operands are SMP-assignable and the element types of
+// both operands are not SMP-assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< And< IsSparseMatrix<MT1>, IsSMPAssignable<MT1>, IsSMPAssignable<MT2> > >
+   smpSubAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT1> );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SMP_ASSIGNABLE( ElementType_<MT2> );
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( isParallelSectionActive() || isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      subAssign( ~lhs, ~rhs );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      smpSubAssign_backend( ~lhs, ~rhs );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHUR PRODUCT ASSIGNMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP Schur product assignment to a sparse
+//        matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix for the Schur product.
+// \return void
+//
+// This function implements the OpenMP-based SMP Schur product assignment to a
+// sparse matrix. Since the Schur product can only reduce the number of non-zero elements of
+// the target matrix, it is performed serially in-place.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline EnableIf_< IsSparseMatrix<MT1> >
+   smpSchurAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   schurAssign( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -140,19 +140,19 @@ void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& r
 
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto target( submatrix<aligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( i*threads.second+j, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
          }
          else if( simdEnabled && lhsAligned ) {
             auto target( submatrix<aligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( i*threads.second+j, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
          }
          else if( simdEnabled && rhsAligned ) {
             auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( i*threads.second+j, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
          }
          else {
             auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAssign( i*threads.second+j, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
          }
       }
    }
@@ -216,7 +216,7 @@ void smpAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>&
          const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
 
          auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
-         TheThreadBackend::scheduleAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAssign( i*threads.second+j, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 
@@ -386,19 +386,19 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>
 
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto target( submatrix<aligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( i*threads.second+j, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
          }
          else if( simdEnabled && lhsAligned ) {
             auto target( submatrix<aligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( i*threads.second+j, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
          }
          else if( simdEnabled && rhsAligned ) {
             auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleAddAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( i*threads.second+j, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
          }
          else {
             auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleAddAssign( i*threads.second+j, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
          }
       }
    }
@@ -462,7 +462,7 @@ void smpAddAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2
          const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
 
          auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
-         TheThreadBackend::scheduleAddAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         TheThreadBackend::scheduleAddAssign( i*threads.second+j, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 
@@ -633,19 +633,19 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>
 
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto target( submatrix<aligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( i*threads.second+j, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
          }
          else if( simdEnabled && lhsAligned ) {
             auto target( submatrix<aligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( i*threads.second+j, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
          }
          else if( simdEnabled && rhsAligned ) {
             auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleSubAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( i*threads.second+j, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
          }
          else {
             auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSubAssign( i*threads.second+j, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
          }
       }
    }
@@ -709,7 +709,7 @@ void smpSubAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2
          const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
 
          auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
-         TheThreadBackend::scheduleSubAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         TheThreadBackend::scheduleSubAssign( i*threads.second+j, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 
@@ -881,19 +881,19 @@ void smpSchurAssign_backend( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO
 
          if( simdEnabled && lhsAligned && rhsAligned ) {
             auto target( submatrix<aligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleSchurAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSchurAssign( i*threads.second+j, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
          }
          else if( simdEnabled && lhsAligned ) {
             auto target( submatrix<aligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleSchurAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSchurAssign( i*threads.second+j, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
          }
          else if( simdEnabled && rhsAligned ) {
             auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleSchurAssign( target, submatrix<aligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSchurAssign( i*threads.second+j, target, submatrix<aligned>( ~rhs, row, column, m, n ) );
          }
          else {
             auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
-            TheThreadBackend::scheduleSchurAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+            TheThreadBackend::scheduleSchurAssign( i*threads.second+j, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
          }
       }
    }
@@ -957,7 +957,7 @@ void smpSchurAssign_backend( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,S
          const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
 
          auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
-         TheThreadBackend::scheduleSchurAssign( target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
+         TheThreadBackend::scheduleSchurAssign( i*threads.second+j, target, submatrix<unaligned>( ~rhs, row, column, m, n ) );
       }
    }
 
@@ -1099,6 +1099,127 @@ inline EnableIf_< IsDenseMatrix<MT1> >
 
 
 
+//=================================================================================================
+//
+//  INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP initialization of a dense matrix.
+// \ingroup math
+//
+// \param lhs The dense matrix to be initialized.
+// \param value The initial value of all elements of the matrix.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP initialization
+// of a dense matrix. The matrix is partitioned in the same way as for the SMP assignment and each
+// part is initialized by the thread that processes the part during the SMP assignments. Thus on
+// NUMA systems the memory pages of each part are placed in the memory of this thread (first
+// touch) in case the thread affinity is enabled.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void smpFill_backend( DenseMatrix<MT,SO>& lhs, const ElementType_<MT>& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   constexpr bool simdEnabled( MT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_<MT> >::size );
+
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~lhs ) );
+
+   const size_t addon1     ( ( ( (~lhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( (~lhs).rows() / threads.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( simdEnabled && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( (~lhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( (~lhs).columns() / threads.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   for( size_t i=0UL; i<threads.first; ++i )
+   {
+      const size_t row( i*rowsPerThread );
+
+      if( row >= (~lhs).rows() )
+         continue;
+
+      for( size_t j=0UL; j<threads.second; ++j )
+      {
+         const size_t column( j*colsPerThread );
+
+         if( column >= (~lhs).columns() )
+            continue;
+
+         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
+         const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
+
+         auto target( submatrix<unaligned>( ~lhs, row, column, m, n ) );
+         TheThreadBackend::scheduleFill( i*threads.second+j, target, value );
+      }
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP initialization of a dense matrix.
+// \ingroup math
+//
+// \param lhs The dense matrix to be initialized.
+// \param value The initial value of all elements of the matrix.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP initialization of a dense matrix,
+// which sets all elements of the given matrix to the given value. In case the matrix is not
+// SMP-assignable, is too small for a parallel execution, or the function is called from within
+// a parallel section or a task of the thread backend, the matrix is initialized serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense matrices. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+inline void smpFill( DenseMatrix<MT,SO>& lhs, const ElementType_<MT>& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   auto full( submatrix<unaligned>( ~lhs, 0UL, 0UL, (~lhs).rows(), (~lhs).columns() ) );
+
+   if( !IsSMPAssignable<MT>::value || isParallelSectionActive() || TheThreadBackend::isParticipating() ) {
+      full = value;
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~lhs).canSMPAssign() ) {
+         full = value;
+      }
+      else {
+         smpFill_backend( ~lhs, value );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINT
@@ -124,19 +124,19 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& r
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAssign( i, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else if( simdEnabled && lhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
       }
       else if( simdEnabled && rhsAligned ) {
          auto target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAssign( i, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else {
          auto target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
       }
    }
 
@@ -186,7 +186,7 @@ void smpAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>&
 
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       auto target( subvector<unaligned>( ~lhs, index, size ) );
-      TheThreadBackend::scheduleAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      TheThreadBackend::scheduleAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
    }
 
    TheThreadBackend::wait();
@@ -339,19 +339,19 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAddAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAddAssign( i, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else if( simdEnabled && lhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAddAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
       }
       else if( simdEnabled && rhsAligned ) {
          auto target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAddAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAddAssign( i, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else {
          auto target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleAddAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
       }
    }
 
@@ -401,7 +401,7 @@ void smpAddAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       auto target( subvector<unaligned>( ~lhs, index, size ) );
-      TheThreadBackend::scheduleAddAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      TheThreadBackend::scheduleAddAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
    }
 
    TheThreadBackend::wait();
@@ -555,19 +555,19 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleSubAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleSubAssign( i, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else if( simdEnabled && lhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleSubAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
       }
       else if( simdEnabled && rhsAligned ) {
          auto target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleSubAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleSubAssign( i, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else {
          auto target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleSubAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
       }
    }
 
@@ -617,7 +617,7 @@ void smpSubAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2
 
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       auto target( subvector<unaligned>( ~lhs, index, size ) );
-      TheThreadBackend::scheduleSubAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      TheThreadBackend::scheduleSubAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
    }
 
    TheThreadBackend::wait();
@@ -772,19 +772,19 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleMultAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleMultAssign( i, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else if( simdEnabled && lhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleMultAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
       }
       else if( simdEnabled && rhsAligned ) {
          auto target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleMultAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleMultAssign( i, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else {
          auto target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleMultAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
       }
    }
 
@@ -834,7 +834,7 @@ void smpMultAssign_backend( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF
 
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       auto target( subvector<unaligned>( ~lhs, index, size ) );
-      TheThreadBackend::scheduleMultAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+      TheThreadBackend::scheduleMultAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
    }
 
    TheThreadBackend::wait();
@@ -989,19 +989,19 @@ void smpDivAssign_backend( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleDivAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleDivAssign( i, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else if( simdEnabled && lhsAligned ) {
          auto target( subvector<aligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleDivAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleDivAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
       }
       else if( simdEnabled && rhsAligned ) {
          auto target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleDivAssign( target, subvector<aligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleDivAssign( i, target, subvector<aligned>( ~rhs, index, size ) );
       }
       else {
          auto target( subvector<unaligned>( ~lhs, index, size ) );
-         TheThreadBackend::scheduleDivAssign( target, subvector<unaligned>( ~rhs, index, size ) );
+         TheThreadBackend::scheduleDivAssign( i, target, subvector<unaligned>( ~rhs, index, size ) );
       }
    }
 
@@ -1097,6 +1097,112 @@ inline EnableIf_< And< IsDenseVector<VT1>, IsSMPAssignable<VT1>, IsSMPAssignable
 
 
 
+//=================================================================================================
+//
+//  INITIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the C++11/Boost thread-based SMP initialization of a dense vector.
+// \ingroup math
+//
+// \param lhs The dense vector to be initialized.
+// \param value The initial value of all elements of the vector.
+// \return void
+//
+// This function is the backend implementation of the C++11/Boost thread-based SMP initialization
+// of a dense vector. The vector is partitioned in the same way as for the SMP assignment and each
+// part is initialized by the thread that processes the part during the SMP assignments. Thus on
+// NUMA systems the memory pages of each part are placed in the memory of this thread (first
+// touch) in case the thread affinity is enabled.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+void smpFill_backend( DenseVector<VT,TF>& lhs, const ElementType_<VT>& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
+
+   constexpr bool simdEnabled( VT::simdEnabled );
+   constexpr size_t SIMDSIZE( SIMDTrait< ElementType_<VT> >::size );
+
+   const size_t threads      ( TheThreadBackend::size() );
+   const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( (~lhs).size() / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+   for( size_t i=0UL; i<threads; ++i )
+   {
+      const size_t index( i*sizePerThread );
+
+      if( index >= (~lhs).size() )
+         continue;
+
+      const size_t size( min( sizePerThread, (~lhs).size() - index ) );
+
+      auto target( subvector<unaligned>( ~lhs, index, size ) );
+      TheThreadBackend::scheduleFill( i, target, value );
+   }
+
+   TheThreadBackend::wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based SMP initialization of a dense vector.
+// \ingroup math
+//
+// \param lhs The dense vector to be initialized.
+// \param value The initial value of all elements of the vector.
+// \return void
+//
+// This function implements the C++11/Boost thread-based SMP initialization of a dense vector,
+// which sets all elements of the given vector to the given value. In case the vector is not
+// SMP-assignable, is too small for a parallel execution, or the function is called from within
+// a parallel section or a task of the thread backend, the vector is initialized serially.\n
+// This function must \b NOT be called explicitly! It is used internally for the first-touch
+// initialization of dense vectors. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag of the dense vector
+inline void smpFill( DenseVector<VT,TF>& lhs, const ElementType_<VT>& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   auto full( subvector<unaligned>( ~lhs, 0UL, (~lhs).size() ) );
+
+   if( !IsSMPAssignable<VT>::value || isParallelSectionActive() || TheThreadBackend::isParticipating() ) {
+      full = value;
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      if( isSerialSectionActive() || !(~lhs).canSMPAssign() ) {
+         full = value;
+      }
+      else {
+         smpFill_backend( ~lhs, value );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -0,0 +1,137 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/ParallelFor.h
+//  \brief Header file for the C++11/Boost thread-based parallel for-loop SMP implementation
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_THREADS_PARALLELFOR_H_
+#define _BLAZE_MATH_SMP_THREADS_PARALLELFOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARALLEL FOR-LOOP
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based implementation of the SMP for-loop.
+// \ingroup smp
+//
+// \param begin The first index of the iteration range.
+// \param end The index one past the last index of the iteration range.
+// \param kernel The kernel to be executed for the chunks of the range \f$[begin..end)\f$.
+// \return void
+//
+// This function recursively splits the index range \f$[begin..end)\f$ into contiguous chunks
+// and executes the given \a kernel concurrently for all chunks. The kernel is expected to accept
+// the first and the one-past-the-last index of a chunk and must be safe to be called concurrently
+// for disjoint chunks. In case the function is called from within a task that is executed by the
+// thread backend (e.g. from within the kernel of another SMP for-loop), the chunks are nested into
+// the enclosing parallel region. In case a serial section or a parallel section without active
+// threads is active, the kernel is called once for the entire range.
+*/
+template< typename Kernel >  // Type of the loop kernel
+inline void smpFor( size_t begin, size_t end, const Kernel& kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( begin >= end )
+      return;
+
+   if( isSerialSectionActive() ) {
+      kernel( begin, end );
+      return;
+   }
+
+   // Oversubscribing the threads to balance chunks with irregular amounts of work
+   const size_t size  ( end - begin );
+   const size_t chunks( min( 4UL*TheThreadBackend::size(), size ) );
+   const size_t addon ( ( ( size % chunks ) != 0UL )? 1UL : 0UL );
+   const size_t grain ( size / chunks + addon );
+
+   if( TheThreadBackend::isParticipating() ) {
+      TheThreadBackend::parallelFor( begin, end, grain, kernel );
+      return;
+   }
+
+   if( isParallelSectionActive() ) {
+      kernel( begin, end );
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      TheThreadBackend::parallelFor( begin, end, grain, kernel );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
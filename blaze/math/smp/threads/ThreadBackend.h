@@ -92,6 +92,7 @@ class ThreadBackend
    static inline size_t size  ();
    static inline void   resize( size_t n, bool block=false );
    static inline void   wait  ();
+   static inline bool   isParticipating();
    //@}
    //**********************************************************************************************
 
@@ -99,22 +100,31 @@ class ThreadBackend
    /*!\name Thread execution functions */
    //@{
    template< typename Target, typename Source >
-   static inline void scheduleAssign( Target& target, const Source& source );
+   static inline void scheduleAssign( size_t index, Target& target, const Source& source );
 
    template< typename Target, typename Source >
-   static inline void scheduleAddAssign( Target& target, const Source& source );
+   static inline void scheduleAddAssign( size_t index, Target& target, const Source& source );
 
    template< typename Target, typename Source >
-   static inline void scheduleSubAssign( Target& target, const Source& source );
+   static inline void scheduleSubAssign( size_t index, Target& target, const Source& source );
 
    template< typename Target, typename Source >
-   static inline void scheduleSchurAssign( Target& target, const Source& source );
+   static inline void scheduleSchurAssign( size_t index, Target& target, const Source& source );
 
    template< typename Target, typename Source >
-   static inline void scheduleMultAssign( Target& target, const Source& source );
+   static inline void scheduleMultAssign( size_t index, Target& target, const Source& source );
 
    template< typename Target, typename Source >
-   static inline void scheduleDivAssign( Target& target, const Source& source );
+   static inline void scheduleDivAssign( size_t index, Target& target, const Source& source );
+
+   template< typename Target, typename Type >
+   static inline void scheduleFill( size_t index, Target& target, const Type& value );
+
+   template< typename Task >
+   static inline void schedule( const Task& task );
+
+   template< typename Kernel >
+   static inline void parallelFor( size_t begin, size_t end, size_t grain, const Kernel& kernel );
    //@}
    //**********************************************************************************************
 
@@ -365,6 +375,54 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class Filler************************************************************************
+   /*!\brief Auxiliary functor for the threaded initialization of a dense vector or matrix.
+   */
+   template< typename Target  // Type of the target operand
+           , typename Type >  // Type of the initialization value
+   struct Filler
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Filler class template.
+      //
+      // \param target The target operand to be initialized.
+      // \param value The initial value of all elements of the target.
+      */
+      explicit inline Filler( Target& target, const Type& value )
+         : target_( target )  // The target operand
+         , value_ ( value  )  // The initialization value
+      {}
+      //*******************************************************************************************
+
+      //**Function call operator*******************************************************************
+      /*!\brief Initializes all elements of the target with the given value.
+      //
+      // \return void
+      */
+      inline void operator()() {
+         target_ = value_;
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target     target_;  //!< The target operand.
+      const Type value_;   //!< The initialization value.
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      BLAZE_CONSTRAINT_MUST_BE_EXPRESSION_TYPE( Target );
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Task >
+   static inline void fork( size_t index, const Task& task );
+   //@}
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
@@ -399,7 +457,7 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), BLAZE_THREAD_AFFINITY_MODE );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -460,11 +518,13 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Waiting for all scheduled tasks to be completed.
+/*!\brief Waiting for all tasks scheduled by the calling thread to be completed.
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all tasks scheduled by the calling thread have been completed.
+// While waiting, the calling thread participates in the execution of the scheduled tasks.
+// Tasks scheduled by other threads are not waited for.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -472,7 +532,29 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   threadpool_.join();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the calling thread currently executes scheduled tasks.
+//
+// \return \a true in case the calling thread executes scheduled tasks, \a false if not.
+//
+// This function returns whether the calling thread is a thread of the backend system or has
+// scheduled tasks that have not yet been waited for. In this case any further parallel work
+// is nested into the currently executed tasks.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool ThreadBackend<TT,MT,LT,CT>::isParticipating()
+{
+   return threadpool_.isParticipating();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -486,15 +568,70 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given task for execution.
+//
+// \param task The task to be executed.
+// \return void
+//
+// This function schedules the given task for execution. The task must be copyable and callable
+// without arguments. In contrast to the (compound) assignment functions, this function allows
+// to schedule arbitrary work packages, as for instance the evaluation of a range of rows of a
+// sparse matrix into an intermediate temporary.
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename Task >  // Type of the task
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( const Task& task )
+{
+   threadpool_.fork( task );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Parallel execution of the given kernel for the index range \f$[begin..end)\f$.
+//
+// \param begin The first index of the range.
+// \param end The index one past the last index of the range.
+// \param grain The maximum number of indices per kernel call.
+// \param kernel The kernel to be executed for the chunks of the range.
+// \return void
+//
+// This function recursively splits the index range \f$[begin..end)\f$ into chunks of at most
+// \a grain indices and executes the given \a kernel for all chunks. In contrast to schedule(),
+// the function only returns after the kernel has been executed for the entire range.
+*/
+template< typename TT       // Type of the encapsulated thread
+        , typename MT       // Type of the synchronization mutex
+        , typename LT       // Type of the mutex lock
+        , typename CT >     // Type of the condition variable
+template< typename Kernel > // Type of the range kernel
+inline void ThreadBackend<TT,MT,LT,CT>::parallelFor( size_t begin, size_t end, size_t grain, const Kernel& kernel )
+{
+   threadpool_.parallelFor( begin, end, grain, kernel );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Scheduling an assignment of the given operands for execution.
 //
+// \param index The index of the thread that should preferably execute the assignment.
 // \param target The target operand to be assigned to.
 // \param source The source operand to be assigned to the target.
 // \return void
 //
 // This function schedules a plain assignment of the two given operands for execution.
+// In case the thread affinity is enabled, the assignment is handed to the thread with the given
+// index, such that the same part of the data is always processed by the same thread.
 */
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
@@ -502,10 +639,10 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( size_t index, Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source>( target, source ) );
+   fork( index, Assigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -515,11 +652,14 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleAssign( Target& target, const So
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Scheduling an addition assignment of the given operands for execution.
 //
+// \param index The index of the thread that should preferably execute the assignment.
 // \param target The target operand to be assigned to.
 // \param source The source operand to be added to the target.
 // \return void
 //
 // This function schedules an addition assignment of the two given operands for execution.
+// In case the thread affinity is enabled, the assignment is handed to the thread with the given
+// index, such that the same part of the data is always processed by the same thread.
 */
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
@@ -527,10 +667,10 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( size_t index, Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( AddAssigner<Target,Source>( target, source ) );
+   fork( index, AddAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -540,11 +680,14 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleAddAssign( Target& target, const
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Scheduling a subtraction assignment of the given operands for execution.
 //
+// \param index The index of the thread that should preferably execute the assignment.
 // \param target The target operand to be assigned to.
 // \param source The source operand to be subtracted from the target.
 // \return void
 //
 // This function schedules a subtraction assignment of the two given operands for execution.
+// In case the thread affinity is enabled, the assignment is handed to the thread with the given
+// index, such that the same part of the data is always processed by the same thread.
 */
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
@@ -552,10 +695,10 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( size_t index, Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( SubAssigner<Target,Source>( target, source ) );
+   fork( index, SubAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -565,11 +708,14 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleSubAssign( Target& target, const
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Scheduling an Schur product assignment of the given operands for execution.
 //
+// \param index The index of the thread that should preferably execute the assignment.
 // \param target The target operand to be assigned to.
 // \param source The source operand for the Schur product.
 // \return void
 //
 // This function schedules a Schur product assignment of the two given operands for execution.
+// In case the thread affinity is enabled, the assignment is handed to the thread with the given
+// index, such that the same part of the data is always processed by the same thread.
 */
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
@@ -577,10 +723,10 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleSchurAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleSchurAssign( size_t index, Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( SchurAssigner<Target,Source>( target, source ) );
+   fork( index, SchurAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -590,11 +736,14 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleSchurAssign( Target& target, con
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Scheduling a multiplication assignment of the given operands for execution.
 //
+// \param index The index of the thread that should preferably execute the assignment.
 // \param target The target operand to be assigned to.
 // \param source The source operand to be multiplied with the target.
 // \return void
 //
 // This function schedules a multiplication assignment of the two given operands for execution.
+// In case the thread affinity is enabled, the assignment is handed to the thread with the given
+// index, such that the same part of the data is always processed by the same thread.
 */
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
@@ -602,10 +751,10 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( size_t index, Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( MultAssigner<Target,Source>( target, source ) );
+   fork( index, MultAssigner<Target,Source>( target, source ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -615,11 +764,14 @@ inline void ThreadBackend<TT,MT,LT,CT>::scheduleMultAssign( Target& target, cons
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Scheduling a division assignment of the given operands for execution.
 //
+// \param index The index of the thread that should preferably execute the assignment.
 // \param target The target operand to be assigned to.
 // \param source The source operand to be divided from the target.
 // \return void
 //
 // This function schedules a division assignment of the two given operands for execution.
+// In case the thread affinity is enabled, the assignment is handed to the thread with the given
+// index, such that the same part of the data is always processed by the same thread.
 */
 template< typename TT        // Type of the encapsulated thread
         , typename MT        // Type of the synchronization mutex
@@ -627,10 +779,68 @@ template< typename TT        // Type of the encapsulated thread
         , typename CT >      // Type of the condition variable
 template< typename Target    // Type of the target operand
         , typename Source >  // Type of the source operand
-inline void ThreadBackend<TT,MT,LT,CT>::scheduleDivAssign( Target& target, const Source& source )
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleDivAssign( size_t index, Target& target, const Source& source )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( DivAssigner<Target,Source>( target, source ) );
+   fork( index, DivAssigner<Target,Source>( target, source ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the initialization of the given target for execution.
+//
+// \param index The index of the thread that should preferably execute the initialization.
+// \param target The target operand to be initialized.
+// \param value The initial value of all elements of the target.
+// \return void
+//
+// This function schedules the initialization of all elements of the given target with the
+// given value. In case the thread affinity is enabled, the initialization is handed to the
+// thread with the given index, such that the according memory pages are placed in the memory
+// of the processor the thread is bound to (first touch).
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename Target  // Type of the target operand
+        , typename Type >  // Type of the initialization value
+inline void ThreadBackend<TT,MT,LT,CT>::scheduleFill( size_t index, Target& target, const Type& value )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
+   fork( index, Filler<Target,Type>( target, value ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Forking the given task for the thread with the given index.
+//
+// \param index The index of the thread that should preferably execute the task.
+// \param task The task to be executed.
+// \return void
+//
+// This function hands the given task to the thread with the given index in case the thread
+// affinity is enabled. Otherwise the task is forked to the work queue of the calling thread.
+*/
+template< typename TT      // Type of the encapsulated thread
+        , typename MT      // Type of the synchronization mutex
+        , typename LT      // Type of the mutex lock
+        , typename CT >    // Type of the condition variable
+template< typename Task >  // Type of the task
+inline void ThreadBackend<TT,MT,LT,CT>::fork( size_t index, const Task& task )
+{
+   if( threadpool_.hasAffinity() ) {
+      threadpool_.fork( index, task );
+   }
+   else {
+      threadpool_.fork( task );
+   }
 }
 /*! \endcond */
 //*************************************************************************************************
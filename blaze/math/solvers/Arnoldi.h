@@ -0,0 +1,406 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Arnoldi.h
+//  \brief Header file for the restarted Arnoldi eigenvalue solver
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_ARNOLDI_H_
+#define _BLAZE_MATH_SOLVERS_ARNOLDI_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/lapack/geev.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/solvers/EigenSpectrum.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/KrylovEigen.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/constraints/Complex.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ARNOLDI METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Arnoldi functions */
+//@{
+template< typename Op, typename VT, typename MT, bool SO >
+void arnoldi( const Op& A, DenseVector<VT,false>& w, DenseMatrix<MT,SO>& V, size_t nev,
+              SolverControl& control, EigenSpectrum spectrum = largestMagnitude, size_t ncv = 0UL );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Orthonormalizes the columns of the given matrix.
+// \ingroup eigensolvers
+//
+// \param Q The matrix to be orthonormalized.
+// \return void
+//
+// The columns of \a Q are orthonormalized by two passes of the modified Gram-Schmidt process.
+// Columns that are numerically dependent on the previous columns are removed.
+*/
+template< typename T >  // Element type of the matrix
+void arnoldiOrthonormalize( DynamicMatrix<T,columnMajor>& Q )
+{
+   using RT = KrylovReal<T>;
+
+   const size_t m( Q.rows() );
+   const RT tol( RT( m ) * std::numeric_limits<RT>::epsilon() );
+
+   size_t k( 0UL );
+
+   for( size_t j=0UL; j<Q.columns(); ++j )
+   {
+      if( k != j ) {
+         column( Q, k ) = column( Q, j );
+      }
+
+      const RT qnorm( norm( column( Q, k ) ) );
+
+      for( size_t pass=0UL; pass<2UL; ++pass ) {
+         for( size_t i=0UL; i<k; ++i ) {
+            T c( 0 );
+            for( size_t l=0UL; l<m; ++l )
+               c += conj( Q(l,i) ) * Q(l,k);
+            for( size_t l=0UL; l<m; ++l )
+               Q(l,k) -= c * Q(l,i);
+         }
+      }
+
+      const RT qk( norm( column( Q, k ) ) );
+
+      if( qk > tol * qnorm ) {
+         column( Q, k ) *= RT(1) / qk;
+         ++k;
+      }
+   }
+
+   Q.resize( m, k, true );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the orthonormal restart basis of a complex Arnoldi process.
+// \ingroup eigensolvers
+//
+// \param Q The resulting restart basis.
+// \param Y The eigenvectors of the projected matrix.
+// \param lambda The eigenvalues of the projected matrix.
+// \param order The indices of the eigenvalues in the order of the selection.
+// \param k The number of Ritz vectors to be retained.
+// \return void
+*/
+template< typename T     // Element type of the Krylov basis
+        , typename CT >  // Complex element type
+EnableIf_< IsComplex<T> >
+   arnoldiRestartBasis( DynamicMatrix<T,columnMajor>& Q, const DynamicMatrix<CT,columnMajor>& Y,
+                        const DynamicVector<CT,columnVector>& lambda,
+                        const std::vector<size_t>& order, size_t k )
+{
+   UNUSED_PARAMETER( lambda );
+
+   Q.resize( Y.rows(), k, false );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      column( Q, i ) = column( Y, order[i] );
+   }
+
+   arnoldiOrthonormalize( Q );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the orthonormal restart basis of a real Arnoldi process.
+// \ingroup eigensolvers
+//
+// \param Q The resulting restart basis.
+// \param Y The eigenvectors of the projected matrix.
+// \param lambda The eigenvalues of the projected matrix.
+// \param order The indices of the eigenvalues in the order of the selection.
+// \param k The number of Ritz vectors to be retained.
+// \return void
+//
+// In order to stay in real arithmetic, a pair of complex conjugate Ritz vectors is represented
+// by its real and imaginary part, which span the same (real) subspace. Therefore the restart
+// basis may contain one more vector than requested.
+*/
+template< typename T     // Element type of the Krylov basis
+        , typename CT >  // Complex element type
+DisableIf_< IsComplex<T> >
+   arnoldiRestartBasis( DynamicMatrix<T,columnMajor>& Q, const DynamicMatrix<CT,columnMajor>& Y,
+                        const DynamicVector<CT,columnVector>& lambda,
+                        const std::vector<size_t>& order, size_t k )
+{
+   const size_t m( Y.rows() );
+
+   std::vector<bool> used( m, false );
+
+   Q.resize( m, k+1UL, false );
+
+   size_t c( 0UL );
+
+   for( size_t p=0UL; p<m && c<k; ++p )
+   {
+      const size_t i( order[p] );
+
+      if( used[i] ) continue;
+      used[i] = true;
+
+      column( Q, c++ ) = real( column( Y, i ) );
+
+      if( imag( lambda[i] ) != T(0) ) {
+         const size_t j( ( imag( lambda[i] ) > T(0) )?( i+1UL ):( i-1UL ) );
+         used[j] = true;
+         column( Q, c++ ) = imag( column( Y, i ) );
+      }
+   }
+
+   Q.resize( m, c, true );
+
+   arnoldiOrthonormalize( Q );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the Ritz vectors of a complex Arnoldi process.
+// \ingroup eigensolvers
+*/
+template< typename T     // Element type of the Krylov basis
+        , typename CT    // Complex element type
+        , typename MT >  // Type of the eigenvector matrix
+EnableIf_< IsComplex<T> >
+   arnoldiRitzVectors( MT& V, const DynamicMatrix<T,columnMajor>& B, const DynamicMatrix<CT,columnMajor>& Y )
+{
+   V = submatrix( B, 0UL, 0UL, B.rows(), Y.rows() ) * Y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the Ritz vectors of a real Arnoldi process.
+// \ingroup eigensolvers
+//
+// The real and imaginary parts of the Ritz vectors are computed by two real dense matrix
+// multiplications.
+*/
+template< typename T     // Element type of the Krylov basis
+        , typename CT    // Complex element type
+        , typename MT >  // Type of the eigenvector matrix
+DisableIf_< IsComplex<T> >
+   arnoldiRitzVectors( MT& V, const DynamicMatrix<T,columnMajor>& B, const DynamicMatrix<CT,columnMajor>& Y )
+{
+   const auto Bm( submatrix( B, 0UL, 0UL, B.rows(), Y.rows() ) );
+
+   const DynamicMatrix<T,columnMajor> Xr( Bm * real( Y ) );
+   const DynamicMatrix<T,columnMajor> Xi( Bm * imag( Y ) );
+
+   for( size_t j=0UL; j<Y.columns(); ++j ) {
+      for( size_t i=0UL; i<B.rows(); ++i ) {
+         V(i,j) = CT( Xr(i,j), Xi(i,j) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a few eigenvalues and eigenvectors of a general square matrix by means of the
+//        restarted Arnoldi method.
+// \ingroup eigensolvers
+//
+// \param A The general square matrix or operator.
+// \param w The resulting vector of complex eigenvalues.
+// \param V The starting vector (first column) on entry, the matrix of complex eigenvectors on exit.
+// \param nev The number of requested eigenvalues.
+// \param control The convergence control.
+// \param spectrum The selected part of the spectrum (default: \a largestMagnitude).
+// \param ncv The dimension of the Krylov subspace (default: 0 for \f$ \min(n,\max(2nev+1,nev+20)) \f$).
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid starting vector provided.
+// \exception std::invalid_argument Invalid number of eigenvalues.
+// \exception std::invalid_argument Invalid subspace dimension.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes \a nev eigenvalues and the according eigenvectors of the general square
+// matrix \a A by means of the restarted Arnoldi method. \a A can be any dense or sparse matrix
+// (including adaptors, views, and matrix expressions), a shift-invert operator (see ShiftInvert),
+// or a matrix-free operator, i.e. any callable that can be called as \c A(y,x) with two dense
+// column vectors and that computes \f$ y = A*x \f$. Since the eigenvalues of a general matrix
+// are complex, both \a w and \a V must have a complex element type:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector< blaze::complex<double> > w;
+   blaze::DynamicMatrix< blaze::complex<double>, blaze::columnMajor > V;
+   // ... Resizing and initialization
+
+   blaze::SolverControl control( 100UL, 1E-10 );
+
+   // Computing the 4 eigenvalues of A with largest real part
+   arnoldi( A, w, V, 4UL, control, blaze::largestReal );
+   \endcode
+
+// In case \a A is a real matrix or a shift-invert operator with real shift, the Arnoldi process
+// is performed in real arithmetic. For matrix-free operators, the process is performed with the
+// element type of \a V and the size of the problem is given by the number of rows of \a V.
+//
+// On exit, \a w contains the \a nev selected eigenvalues and the columns of \a V contain the
+// according normalized eigenvectors. Both are ordered according to the selected \a spectrum,
+// i.e. by descending magnitude, descending real part, or ascending real part. Complex conjugate
+// eigenvalues with equal key are ordered by descending imaginary part. In case of a shift-invert
+// operator, the eigenvalues of \f$ (A - \sigma I)^{-1} \f$ are transformed back to eigenvalues
+// of \a A. The handling of the starting vector and of the SolverControl is identical to the
+// lanczos() function.
+//
+// Every cycle extends the Krylov basis to \a ncv vectors by means of the Arnoldi process with
+// full reorthogonalization and computes the eigenpairs of the projected Hessenberg matrix by
+// means of LAPACK. The process is restarted with an orthonormal basis of the wanted and the
+// best half of the unwanted Ritz vectors. Since the restart with exact Ritz vectors retains the
+// same subspace as an implicit restart with the unwanted Ritz values as exact shifts, the method
+// is mathematically equivalent to the implicitly restarted Arnoldi method. Orthogonalization
+// and restart are performed by the dense matrix/vector and matrix/matrix multiplication kernels.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename Op    // Type of the operator
+        , typename VT    // Type of the eigenvalue vector
+        , typename MT    // Type of the eigenvector matrix
+        , bool SO >      // Storage order of the eigenvector matrix
+void arnoldi( const Op& A, DenseVector<VT,false>& w, DenseMatrix<MT,SO>& V, size_t nev,
+              SolverControl& control, EigenSpectrum spectrum, size_t ncv )
+{
+   BLAZE_CONSTRAINT_MUST_BE_COMPLEX_TYPE( ElementType_<VT> );
+   BLAZE_CONSTRAINT_MUST_BE_COMPLEX_TYPE( ElementType_<MT> );
+
+   using ET = typename KrylovEigenElement< Op, ElementType_<MT> >::Type;
+   using RT = KrylovReal<ET>;
+   using CT = complex<RT>;
+
+   const size_t n( krylovEigenSize( A, ~V ) );
+   const size_t m( krylovEigenSubspace( n, nev, ncv ) );
+
+   DynamicMatrix<ET,columnMajor> B( n, m+1UL );
+   DynamicMatrix<ET,columnMajor> H( m+1UL, m, ET(0) );
+   DynamicMatrix<ET,columnMajor> T, Q, S;
+   DynamicMatrix<CT,columnMajor> Y;
+   DynamicVector<CT,columnVector> lambda;
+   std::vector<size_t> order;
+
+   krylovEigenStart( B, ~V );
+
+   control.start( 1.0, std::numeric_limits<double>::infinity() );
+
+   for( size_t cycle=0UL; ; )
+   {
+      krylovEigenExpand( A, B, H, Q.columns(), m );
+
+      T = submatrix( H, 0UL, 0UL, m, m );
+      lambda.resize( m, false );
+      Y.resize( m, m, false );
+      geev( T, lambda, Y );
+      order = krylovEigenOrder( lambda, spectrum );
+
+      const RT residual( krylovEigenResidual( RT( std::abs( H(m,m-1UL) ) ), Y, lambda, order, nev ) );
+
+      if( control.check( ++cycle, residual ) || control.exhausted( cycle ) ) {
+         break;
+      }
+
+      arnoldiRestartBasis( Q, Y, lambda, order, krylovEigenRestartSize( m, nev ) );
+
+      S = ctrans( Q ) * submatrix( H, 0UL, 0UL, m, m ) * Q;
+      krylovEigenRestart( B, H, Q );
+      submatrix( H, 0UL, 0UL, Q.columns(), Q.columns() ) = S;
+   }
+
+   DynamicMatrix<CT,columnMajor> X( m, nev );
+
+   resize( ~w, nev, false );
+
+   for( size_t i=0UL; i<nev; ++i ) {
+      (~w)[i] = krylovEigenTransform( A, lambda[order[i]] );
+      column( X, i ) = column( Y, order[i] );
+   }
+
+   resize( ~V, n, nev, false );
+   arnoldiRitzVectors( ~V, B, X );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
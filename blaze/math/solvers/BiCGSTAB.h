@@ -0,0 +1,255 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BiCGSTAB.h
+//  \brief Header file for the biconjugate gradient stabilized method
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+#define _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/Operator.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BICONJUGATE GRADIENT STABILIZED METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BiCGSTAB functions */
+//@{
+template< typename Op, typename VT1, typename VT2 >
+void bicgstab( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+               SolverControl& control );
+
+template< typename Op, typename VT1, typename VT2, typename PC >
+void bicgstab( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+               SolverControl& control, const PC& M );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a general linear system by means of the BiCGSTAB method.
+// \ingroup krylov
+//
+// \param A The system matrix or system operator.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \param control The convergence control.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function approximates the solution of the general, non-symmetric linear system
+// \f$ A*x=b \f$ by means of the biconjugate gradient stabilized (BiCGSTAB) method. \a A can be
+// any dense or sparse matrix (including adaptors, views, and matrix expressions) or a matrix-free
+// operator, i.e. any callable that can be called as \c A(y,x) with two dense column vectors and
+// that computes \f$ y = A*x \f$:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverControl control( 1000UL, 1E-10 );
+
+   bicgstab( A, x, b, control );
+   \endcode
+
+// In case the size of \a x does not match the size of \a b, \a x is resized and reset to zero.
+// Otherwise the given values are used as initial guess. The iteration stops as soon as the norm
+// of the residual satisfies the stopping criterion of the given SolverControl, the maximum
+// number of iterations has been performed, or the method breaks down. On exit the SolverControl
+// object contains the number of performed iterations, the final residual norm, and whether or
+// not the iteration converged. Note that the function does not throw an exception in case of a
+// failed convergence.
+//
+// Every iteration performs two applications of the system operator and four passes over the
+// vectors besides the products with the system operator: the update of the search direction, the
+// computation of the intermediate residual including its norm, the fused computation of the two
+// inner products of the stabilization step, and the combined update of the solution and the
+// residual including the residual norm and the inner product with the shadow residual. In case
+// the size of the system exceeds the \a BLAZE_SMP_SOLVER_THRESHOLD and SMP is enabled, all
+// vector kernels are executed in parallel.
+*/
+template< typename Op    // Type of the system operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2 > // Type of the right-hand side vector
+void bicgstab( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+               SolverControl& control )
+{
+   bicgstab( A, x, b, control, IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a general linear system by means of the right-preconditioned BiCGSTAB method.
+// \ingroup krylov
+//
+// \param A The system matrix or system operator.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \param control The convergence control.
+// \param M The preconditioner.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function approximates the solution of the general, non-symmetric linear system
+// \f$ A*x=b \f$ by means of the right-preconditioned BiCGSTAB method. \a A can be any dense or
+// sparse matrix or a matrix-free operator (see the documentation of the unpreconditioned
+// bicgstab() function). The preconditioner \a M can be any callable that can be called as
+// \c M(z,r) with two dense column vectors and that computes \f$ z = M^{-1} r \f$ (see
+// IdentityPreconditioner). Due to the right preconditioning the residual norm that is checked
+// against the stopping criterion is the norm of the unpreconditioned residual \f$ r = b - A x \f$.
+*/
+template< typename Op    // Type of the system operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , typename PC >  // Type of the preconditioner
+void bicgstab( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+               SolverControl& control, const PC& M )
+{
+   using ET = ElementType_<VT1>;
+   using RT = KrylovReal<ET>;
+
+   const size_t n( (~b).size() );
+   const size_t m( IsSame<PC,IdentityPreconditioner>::value ? 0UL : n );
+
+   checkKrylovOperator( A, n );
+   initKrylovSolution( ~x, n );
+
+   DynamicVector<ET,columnVector> xk( ~x );
+   DynamicVector<ET,columnVector> r ( n );
+   DynamicVector<ET,columnVector> rh( n );
+   DynamicVector<ET,columnVector> p ( n );
+   DynamicVector<ET,columnVector> v ( n );
+   DynamicVector<ET,columnVector> s ( n );
+   DynamicVector<ET,columnVector> t ( n );
+   DynamicVector<ET,columnVector> ph( m );
+   DynamicVector<ET,columnVector> sh( m );
+
+   applyKrylovOperator( A, t, xk );
+   r  = (~b) - t;
+   rh = r;
+
+   RT rr( sqrNorm( r ) );
+
+   if( control.start( norm( ~b ), std::sqrt( rr ) ) ) {
+      return;
+   }
+
+   ET rho    ( rr );
+   ET rhoPrev( 1 );
+   ET alpha  ( 1 );
+   ET omega  ( 1 );
+
+   for( size_t k=0UL; !control.exhausted( k ); )
+   {
+      if( rho == ET() ) {
+         break;
+      }
+
+      if( k == 0UL ) {
+         p = r;
+      }
+      else {
+         krylovDirection( p, r, v, ( rho / rhoPrev ) * ( alpha / omega ), omega );
+      }
+
+      const DynamicVector<ET,columnVector>& pk( applyKrylovPreconditioner( M, ph, p ) );
+      applyKrylovOperator( A, v, pk );
+
+      const ET rv( krylovDot( rh, v ) );
+
+      if( rv == ET() ) {
+         break;
+      }
+
+      alpha = rho / rv;
+
+      const RT ss( krylovSubNorm( s, r, v, alpha ) );
+
+      if( control.check( k+1UL, std::sqrt( ss ) ) ) {
+         xk += alpha * pk;
+         break;
+      }
+
+      const DynamicVector<ET,columnVector>& sk( applyKrylovPreconditioner( M, sh, s ) );
+      applyKrylovOperator( A, t, sk );
+
+      const std::pair<ET,RT> ts( krylovDotNorm( t, s ) );
+
+      if( ts.second == RT() ) {
+         break;
+      }
+
+      omega   = ts.first / ET( ts.second );
+      rhoPrev = rho;
+
+      const std::pair<ET,RT> rs( krylovBiCGUpdate( xk, r, pk, sk, s, t, rh, alpha, omega ) );
+      rho = rs.first;
+
+      if( control.check( ++k, std::sqrt( rs.second ) ) || omega == ET() ) {
+         break;
+      }
+   }
+
+   ~x = xk;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,276 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BlockJacobiPreconditioner.h
+//  \brief Header file for the block-Jacobi preconditioner
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BLOCKJACOBIPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_BLOCKJACOBIPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/BlockedDecomposition.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Block-Jacobi preconditioner of the iterative solvers.
+// \ingroup preconditioners
+//
+// The BlockJacobiPreconditioner class splits the system matrix into square diagonal blocks of
+// the given block size (the last block may be smaller) and applies the inverse of the resulting
+// block diagonal matrix. The blocks are LU decomposed with partial pivoting during setup; every
+// application performs one forward and one backward substitution per block. In contrast to the
+// JacobiPreconditioner the coupling between the unknowns within a block is taken into account,
+// which is especially beneficial for systems with several unknowns per node:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverControl control;
+   blaze::BlockJacobiPreconditioner<double> M( A, 3UL );  // 3 unknowns per node
+   gmres( A, x, b, control, M );
+   \endcode
+
+// In case the size of the system exceeds the \a BLAZE_SMP_SOLVER_THRESHOLD and SMP is enabled,
+// the blocks are processed in parallel. Note that the preconditioner can only be used with
+// float, double, complex<float>, and complex<double> elements.
+*/
+template< typename Type >  // Data type of the preconditioner
+class BlockJacobiPreconditioner
+{
+ public:
+   //**Constructor*********************************************************************************
+   template< typename MT, bool SO >
+   explicit inline BlockJacobiPreconditioner( const Matrix<MT,SO>& A, size_t blocksize );
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   inline size_t blockSize() const noexcept;
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   template< typename VT1, typename VT2 >
+   inline void operator()( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   size_t size_;       //!< The size of the system matrix.
+   size_t blocksize_;  //!< The size of the diagonal blocks.
+
+   std::vector< DynamicMatrix<Type,columnMajor> > blocks_;  //!< The LU decomposed diagonal blocks.
+   std::vector<int> ipiv_;                                  //!< The pivot indices of the blocks.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the block-Jacobi preconditioner of the given system matrix.
+//
+// \param A The square system matrix.
+// \param blocksize The size of the diagonal blocks.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid block size.
+// \exception std::runtime_error Inversion of singular matrix failed.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline BlockJacobiPreconditioner<Type>::BlockJacobiPreconditioner( const Matrix<MT,SO>& A, size_t blocksize )
+   : size_     ( (~A).rows() )  // The size of the system matrix
+   , blocksize_( blocksize )    // The size of the diagonal blocks
+   , blocks_   ()               // The LU decomposed diagonal blocks
+   , ipiv_     ( (~A).rows() )  // The pivot indices of the blocks
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( blocksize == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid block size" );
+   }
+
+   blocks_.reserve( ( size_ + blocksize_ - 1UL ) / blocksize_ );
+
+   for( size_t i=0UL; i<size_; i+=blocksize_ )
+   {
+      const size_t m( min( blocksize_, size_-i ) );
+
+      blocks_.emplace_back( submatrix( ~A, i, i, m, m ) );
+
+      DynamicMatrix<Type,columnMajor>& B( blocks_.back() );
+      blockedGetrf( B, ipiv_.data()+i );
+
+      for( size_t j=0UL; j<m; ++j ) {
+         if( isDefault( B(j,j) ) ) {
+            BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of the diagonal blocks.
+//
+// \return The size of the diagonal blocks.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline size_t BlockJacobiPreconditioner<Type>::blockSize() const noexcept
+{
+   return blocksize_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the block-Jacobi preconditioner to the given vector.
+//
+// \param z The result vector.
+// \param r The vector to be preconditioned.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the result vector
+        , typename VT2 >   // Type of the vector to be preconditioned
+inline void BlockJacobiPreconditioner<Type>::operator()( DenseVector<VT1,false>& z,
+                                                         const DenseVector<VT2,false>& r ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~r).size() == size_, "Invalid vector size detected" );
+
+   ~z = ~r;
+
+   VT1& y( ~z );
+
+   const auto solve = [this,&y]( size_t first, size_t last )
+   {
+      for( size_t k=first; k<last; ++k )
+      {
+         const DynamicMatrix<Type,columnMajor>& B( blocks_[k] );
+         const size_t offset( k*blocksize_ );
+         const size_t m( B.rows() );
+
+         for( size_t j=0UL; j<m; ++j ) {
+            const size_t p( ipiv_[offset+j] - 1 );
+            if( p != j ) {
+               std::swap( y[offset+j], y[offset+p] );
+            }
+         }
+
+         for( size_t j=0UL; j<m; ++j ) {
+            const Type tmp( y[offset+j] );
+            for( size_t i=j+1UL; i<m; ++i ) {
+               y[offset+i] -= B(i,j) * tmp;
+            }
+         }
+
+         for( size_t j=m; j-->0UL; ) {
+            y[offset+j] /= B(j,j);
+            const Type tmp( y[offset+j] );
+            for( size_t i=0UL; i<j; ++i ) {
+               y[offset+i] -= B(i,j) * tmp;
+            }
+         }
+      }
+   };
+
+   if( isKrylovParallel( size_ ) ) {
+      smpFor( 0UL, blocks_.size(), solve );
+   }
+   else {
+      solve( 0UL, blocks_.size() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
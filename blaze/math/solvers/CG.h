@@ -0,0 +1,223 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/CG.h
+//  \brief Header file for the conjugate gradient method
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_CG_H_
+#define _BLAZE_MATH_SOLVERS_CG_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/Operator.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONJUGATE GRADIENT METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Conjugate gradient functions */
+//@{
+template< typename Op, typename VT1, typename VT2 >
+void cg( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+         SolverControl& control );
+
+template< typename Op, typename VT1, typename VT2, typename PC >
+void cg( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+         SolverControl& control, const PC& M );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a symmetric positive definite linear system by means of the conjugate gradient method.
+// \ingroup krylov
+//
+// \param A The symmetric (Hermitian) positive definite system matrix or system operator.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \param control The convergence control.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function approximates the solution of the linear system \f$ A*x=b \f$ by means of the
+// conjugate gradient (CG) method. The system matrix \a A must be symmetric (or Hermitian) and
+// positive definite. \a A can be any dense or sparse matrix (including adaptors, views, and
+// matrix expressions) or a matrix-free operator, i.e. any callable that can be called as
+// \c A(y,x) with two dense column vectors and that computes \f$ y = A*x \f$:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverControl control( 1000UL, 1E-10 );
+
+   cg( A, x, b, control );  // Solving the system with the explicit system matrix
+
+   auto op = [&A]( auto& y, const auto& v ) { y = A * v; };
+   cg( op, x, b, control );  // Solving the system with a matrix-free system operator
+   \endcode
+
+// In case the size of \a x does not match the size of \a b, \a x is resized and reset to zero.
+// Otherwise the given values are used as initial guess. The iteration stops as soon as the norm
+// of the residual satisfies the stopping criterion of the given SolverControl or the maximum
+// number of iterations has been performed. On exit the SolverControl object contains the number
+// of performed iterations, the final residual norm, and whether or not the iteration converged.
+// Note that the function does not throw an exception in case of a failed convergence.
+//
+// Every iteration performs a single application of the system operator and three passes over
+// the vectors: the product of the search direction with the system operator, the combined update
+// of the solution and the residual including the computation of the residual norm, and the update
+// of the search direction. In case the size of the system exceeds the \a BLAZE_SMP_SOLVER_THRESHOLD
+// and SMP is enabled, all vector kernels are executed in parallel.
+*/
+template< typename Op    // Type of the system operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2 > // Type of the right-hand side vector
+void cg( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+         SolverControl& control )
+{
+   cg( A, x, b, control, IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a symmetric positive definite linear system by means of the preconditioned
+//        conjugate gradient method.
+// \ingroup krylov
+//
+// \param A The symmetric (Hermitian) positive definite system matrix or system operator.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \param control The convergence control.
+// \param M The symmetric (Hermitian) positive definite preconditioner.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function approximates the solution of the linear system \f$ A*x=b \f$ by means of the
+// preconditioned conjugate gradient (PCG) method. The system matrix \a A must be symmetric (or
+// Hermitian) and positive definite. \a A can be any dense or sparse matrix or a matrix-free
+// operator (see the documentation of the unpreconditioned cg() function). The preconditioner
+// \a M must be symmetric (or Hermitian) and positive definite. It can be any callable that
+// can be called as \c M(z,r) with two dense column vectors and that computes \f$ z = M^{-1} r
+// \f$ (see IdentityPreconditioner).
+//
+// Note that the residual norm that is checked against the stopping criterion is the norm of the
+// unpreconditioned residual \f$ r = b - A x \f$.
+*/
+template< typename Op    // Type of the system operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , typename PC >  // Type of the preconditioner
+void cg( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+         SolverControl& control, const PC& M )
+{
+   using ET = ElementType_<VT1>;
+   using RT = KrylovReal<ET>;
+
+   const size_t n( (~b).size() );
+
+   checkKrylovOperator( A, n );
+   initKrylovSolution( ~x, n );
+
+   DynamicVector<ET,columnVector> xk( ~x );
+   DynamicVector<ET,columnVector> r ( n );
+   DynamicVector<ET,columnVector> p ( n );
+   DynamicVector<ET,columnVector> q ( n );
+   DynamicVector<ET,columnVector> z ( IsSame<PC,IdentityPreconditioner>::value ? 0UL : n );
+
+   applyKrylovOperator( A, q, xk );
+   r = (~b) - q;
+
+   RT rr( sqrNorm( r ) );
+
+   if( control.start( norm( ~b ), std::sqrt( rr ) ) ) {
+      return;
+   }
+
+   const DynamicVector<ET,columnVector>& z0( applyKrylovPreconditioner( M, z, r ) );
+   ET rz( ( &z0 == &r )?( ET( rr ) ):( krylovDot( r, z0 ) ) );
+   p = z0;
+
+   for( size_t k=0UL; !control.exhausted( k ); )
+   {
+      applyKrylovOperator( A, q, p );
+
+      const ET pq( krylovDot( p, q ) );
+
+      if( pq == ET() ) {
+         break;
+      }
+
+      rr = krylovCGUpdate( xk, r, p, q, rz / pq );
+
+      if( control.check( ++k, std::sqrt( rr ) ) ) {
+         break;
+      }
+
+      const DynamicVector<ET,columnVector>& zk( applyKrylovPreconditioner( M, z, r ) );
+      const ET rzk( ( &zk == &r )?( ET( rr ) ):( krylovDot( r, zk ) ) );
+
+      krylovDirection( p, zk, rzk / rz );
+      rz = rzk;
+   }
+
+   ~x = xk;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
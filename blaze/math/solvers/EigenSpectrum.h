@@ -0,0 +1,76 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/EigenSpectrum.h
+//  \brief Header file for the spectrum selection of the eigenvalue solvers
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_EIGENSPECTRUM_H_
+#define _BLAZE_MATH_SOLVERS_EIGENSPECTRUM_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  EIGENSPECTRUM FLAG TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Selection of the computed part of the spectrum.
+// \ingroup eigensolvers
+//
+// The EigenSpectrum type enumeration specifies which eigenvalues are computed by the iterative
+// eigenvalue solvers (see the lanczos() and arnoldi() functions). The following flags are
+// available:
+//
+//  - \c largestMagnitude: The eigenvalues of largest magnitude. In combination with a shift-invert
+//          operator (see the ShiftInvert class template) these are the eigenvalues closest to
+//          the shift.
+//  - \c largestReal: The eigenvalues with largest real part (i.e. the largest eigenvalues of a
+//          symmetric or Hermitian matrix).
+//  - \c smallestReal: The eigenvalues with smallest real part (i.e. the smallest eigenvalues of a
+//          symmetric or Hermitian matrix).
+//
+// The eigenvalues are returned in the order given by the selection, i.e. the eigenvalue of
+// largest magnitude, largest real part, or smallest real part is returned first.
+*/
+enum EigenSpectrum
+{
+   largestMagnitude = 0,  //!< Flag for the eigenvalues of largest magnitude.
+   largestReal      = 1,  //!< Flag for the eigenvalues with largest real part.
+   smallestReal     = 2   //!< Flag for the eigenvalues with smallest real part.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,337 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/GMRES.h
+//  \brief Header file for the generalized minimal residual method
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_GMRES_H_
+#define _BLAZE_MATH_SOLVERS_GMRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/Operator.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GENERALIZED MINIMAL RESIDUAL METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name GMRES functions */
+//@{
+template< typename Op, typename VT1, typename VT2 >
+void gmres( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+            SolverControl& control );
+
+template< typename Op, typename VT1, typename VT2, typename PC >
+void gmres( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+            SolverControl& control, const PC& M, size_t restart=30UL );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the Givens rotation that eliminates the subdiagonal element of a Hessenberg column.
+// \ingroup krylov
+//
+// \param a The diagonal element; on exit the rotated diagonal element.
+// \param b The subdiagonal element.
+// \param c On exit the (real) cosine of the rotation.
+// \param s On exit the sine of the rotation.
+// \return void
+//
+// This function computes the rotation \f$ [c, s; -\bar{s}, c] \f$ that maps \f$ (a, b) \f$ to
+// \f$ (\rho, 0) \f$ for both real and complex values.
+*/
+template< typename ET    // Element type
+        , typename RT >  // Real type
+inline void gmresRotation( ET& a, const ET& b, RT& c, ET& s )
+{
+   using std::abs;
+   using std::sqrt;
+
+   const RT absa( abs( a ) );
+   const RT absb( abs( b ) );
+
+   if( absa == RT() ) {
+      c = RT();
+      s = ET( 1 );
+      a = b;
+      return;
+   }
+
+   const RT rho( sqrt( absa*absa + absb*absb ) );
+   const ET phase( a / absa );
+
+   c = absa / rho;
+   s = phase * conj( b ) / rho;
+   a = phase * rho;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a general linear system by means of the restarted GMRES method.
+// \ingroup krylov
+//
+// \param A The system matrix or system operator.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \param control The convergence control.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function approximates the solution of the general linear system \f$ A*x=b \f$ by means
+// of the generalized minimal residual method with a restart length of 30 (GMRES(30)). \a A can
+// be any dense or sparse matrix (including adaptors, views, and matrix expressions) or a
+// matrix-free operator, i.e. any callable that can be called as \c A(y,x) with two dense column
+// vectors and that computes \f$ y = A*x \f$:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverControl control( 1000UL, 1E-10 );
+
+   gmres( A, x, b, control );                                          // GMRES(30)
+   gmres( A, x, b, control, blaze::IdentityPreconditioner(), 50UL );  // GMRES(50)
+   \endcode
+
+// In case the size of \a x does not match the size of \a b, \a x is resized and reset to zero.
+// Otherwise the given values are used as initial guess. Within a restart cycle the iteration
+// is controlled by the residual norm estimate of the least squares problem. At the end of every
+// cycle the true residual is computed and checked against the stopping criterion. On exit the
+// SolverControl object contains the number of performed iterations, the final (true) residual
+// norm, and whether or not the iteration converged. Note that the function does not throw an
+// exception in case of a failed convergence.
+//
+// The Krylov basis is stored in a column-major dense matrix and orthogonalized by means of the
+// classical Gram-Schmidt method with reorthogonalization (CGS2). Thus the orthogonalization of
+// every iteration consists of four (vectorized and parallelized) matrix/vector multiplications
+// instead of the \f$ 2j \f$ vector operations of the modified Gram-Schmidt method.
+*/
+template< typename Op    // Type of the system operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2 > // Type of the right-hand side vector
+void gmres( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+            SolverControl& control )
+{
+   gmres( A, x, b, control, IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a general linear system by means of the right-preconditioned, restarted GMRES method.
+// \ingroup krylov
+//
+// \param A The system matrix or system operator.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \param control The convergence control.
+// \param M The preconditioner.
+// \param restart The restart length, i.e. the maximum dimension of the Krylov subspace.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Invalid restart length.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function approximates the solution of the general linear system \f$ A*x=b \f$ by means
+// of the right-preconditioned GMRES(\a restart) method. \a A can be any dense or sparse matrix or
+// a matrix-free operator (see the documentation of the unpreconditioned gmres() function). The
+// preconditioner \a M can be any callable that can be called as \c M(z,r) with two dense column
+// vectors and that computes \f$ z = M^{-1} r \f$ (see IdentityPreconditioner). Due to the right
+// preconditioning the residual norm that is checked against the stopping criterion is the norm
+// of the unpreconditioned residual \f$ r = b - A x \f$. In case \a restart is 0, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Op    // Type of the system operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , typename PC >  // Type of the preconditioner
+void gmres( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+            SolverControl& control, const PC& M, size_t restart )
+{
+   using std::abs;
+   using std::sqrt;
+
+   using ET = ElementType_<VT1>;
+   using RT = KrylovReal<ET>;
+
+   if( restart == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid restart length" );
+   }
+
+   const size_t n( (~b).size() );
+
+   checkKrylovOperator( A, n );
+   initKrylovSolution( ~x, n );
+
+   const size_t m( ( restart < n )?( restart ):( n ) );
+
+   DynamicVector<ET,columnVector> xk( ~x );
+   DynamicVector<ET,columnVector> r ( n );
+   DynamicVector<ET,columnVector> w ( n );
+   DynamicVector<ET,columnVector> v ( n );
+   DynamicVector<ET,columnVector> z ( IsSame<PC,IdentityPreconditioner>::value ? 0UL : n );
+
+   DynamicMatrix<ET,columnMajor> V( n, m+1UL );
+   DynamicMatrix<ET,columnMajor> H( m+1UL, m );
+   DynamicVector<ET,columnVector> g( m+1UL );
+   DynamicVector<ET,columnVector> h( m+1UL );
+   DynamicVector<ET,columnVector> sn( m );
+   DynamicVector<RT,columnVector> cs( m );
+
+   applyKrylovOperator( A, w, xk );
+   r = (~b) - w;
+
+   RT beta( norm( r ) );
+
+   if( control.start( norm( ~b ), beta ) ) {
+      return;
+   }
+
+   size_t k( 0UL );
+
+   while( !control.exhausted( k ) && beta != RT() )
+   {
+      column( V, 0UL ) = r / ET( beta );
+      reset( g );
+      g[0UL] = beta;
+
+      size_t j( 0UL );
+
+      while( j < m && !control.exhausted( k ) )
+      {
+         // Expansion of the Krylov subspace
+         v = column( V, j );
+         applyKrylovOperator( A, w, applyKrylovPreconditioner( M, z, v ) );
+
+         // Classical Gram-Schmidt orthogonalization with reorthogonalization
+         auto Vj( submatrix( V, 0UL, 0UL, n, j+1UL ) );
+         auto hj( subvector( h, 0UL, j+1UL ) );
+
+         hj = ctrans( ctrans( w ) * Vj );
+         w -= Vj * hj;
+
+         const DynamicVector<ET,columnVector> dh( ctrans( ctrans( w ) * Vj ) );
+         w  -= Vj * dh;
+         hj += dh;
+
+         const RT hn( norm( w ) );
+
+         if( hn != RT() ) {
+            column( V, j+1UL ) = w / ET( hn );
+         }
+
+         // Application of the previous Givens rotations
+         for( size_t i=0UL; i<j; ++i ) {
+            const ET tmp( cs[i] * h[i] + sn[i] * h[i+1UL] );
+            h[i+1UL] = cs[i] * h[i+1UL] - conj( sn[i] ) * h[i];
+            h[i] = tmp;
+         }
+
+         // Elimination of the subdiagonal element
+         gmresRotation( h[j], ET( hn ), cs[j], sn[j] );
+
+         g[j+1UL] = -conj( sn[j] ) * g[j];
+         g[j]     = cs[j] * g[j];
+
+         subvector( column( H, j ), 0UL, j+1UL ) = hj;
+
+         ++j;
+         ++k;
+
+         if( control.check( k, abs( g[j] ) ) || hn == RT() ) {
+            break;
+         }
+      }
+
+      // Solution of the upper triangular least squares system
+      for( size_t i=j; i-- > 0UL; ) {
+         ET sum( g[i] );
+         for( size_t l=i+1UL; l<j; ++l ) {
+            sum -= H(i,l) * g[l];
+         }
+         g[i] = sum / H(i,i);
+      }
+
+      // Update of the solution
+      v = submatrix( V, 0UL, 0UL, n, j ) * subvector( g, 0UL, j );
+      xk += applyKrylovPreconditioner( M, z, v );
+
+      // Computation of the true residual
+      applyKrylovOperator( A, w, xk );
+      r = (~b) - w;
+      beta = norm( r );
+
+      if( control.check( k, beta ) ) {
+         break;
+      }
+   }
+
+   ~x = xk;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
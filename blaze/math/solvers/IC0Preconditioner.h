@@ -0,0 +1,358 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IC0Preconditioner.h
+//  \brief Header file for the IC(0) preconditioner
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_IC0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_IC0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SMatMapExpr.h>
+#include <blaze/math/expressions/SMatTransExpr.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/solvers/SparseTriangular.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INCOMPLETE CHOLESKY DECOMPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place incomplete Cholesky decomposition without fill-in of the given sparse matrix.
+// \ingroup preconditioners
+//
+// \param A The square row-major sparse matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with missing diagonal element.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function computes the IC(0) decomposition \f$ A \approx L L^H \f$ of the given symmetric
+// (Hermitian) positive definite sparse matrix, where the lower triangular matrix \a L has the
+// same sparsity pattern as the lower part of \a A. Only the lower part of \a A is accessed. The
+// decomposition works in place on the existing non-zero elements: On exit the lower part of \a A
+// contains \a L, the strictly upper part of \a A is left unchanged. No element is inserted or
+// removed, i.e. all fill-in is discarded. Every row of \a A must contain an explicit diagonal
+// element.
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   // ... Resizing and initialization
+
+   blaze::ic0( A );  // The lower part of A now contains the IC(0) factor
+   \endcode
+
+// The rows are processed in order of the level schedule of the lower part of \a A. In case the
+// number of non-zero elements within a level exceeds the \a BLAZE_SMP_SMATTRSV_THRESHOLD and SMP
+// is enabled, the rows of the level are decomposed in parallel. The result is identical to the
+// sequential decomposition. Note that the incomplete decomposition may break down even for
+// positive definite matrices (e.g. for matrices that are not diagonally dominant). In this case
+// a \a std::runtime_error exception is thrown and \a A is left in a partially decomposed state.
+*/
+template< typename Type >  // Data type of the matrix
+void ic0( CompressedMatrix<Type,rowMajor>& A )
+{
+   using RT = UnderlyingBuiltin_<Type>;
+
+   const std::vector<size_t> diag( sparseDiagonal( A ) );
+   const LevelSchedule schedule( A, true );
+
+   const auto kernel = [&A,&diag]( size_t i )
+   {
+      const auto ibegin( A.begin(i) );
+      const auto dpos( ibegin + diag[i] );
+
+      for( auto lij=ibegin; lij!=dpos; ++lij )
+      {
+         const size_t j( lij->index() );
+         const auto jend( A.begin(j) + diag[j] );
+
+         Type tmp( lij->value() );
+         auto lik( ibegin );
+         auto ljk( A.begin(j) );
+
+         while( lik != lij && ljk != jend ) {
+            if( lik->index() < ljk->index() ) {
+               ++lik;
+            }
+            else if( ljk->index() < lik->index() ) {
+               ++ljk;
+            }
+            else {
+               tmp -= lik->value() * conj( ljk->value() );
+               ++lik;
+               ++ljk;
+            }
+         }
+
+         lij->value() = tmp / jend->value();
+      }
+
+      RT d( real( dpos->value() ) );
+      for( auto lik=ibegin; lik!=dpos; ++lik ) {
+         d -= real( lik->value() * conj( lik->value() ) );
+      }
+
+      dpos->value() = ( d > RT(0) )?( std::sqrt( d ) ):( d );
+   };
+
+   for( size_t l=0UL; l<schedule.levels(); ++l )
+   {
+      schedule.run( l, kernel );
+
+      for( auto row=schedule.begin(l); row!=schedule.end(l); ++row ) {
+         if( !( real( A.begin(*row)[diag[*row]].value() ) > RT(0) ) ) {
+            BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete Cholesky preconditioner of the iterative solvers.
+// \ingroup preconditioners
+//
+// The IC0Preconditioner class computes the IC(0) decomposition \f$ A \approx L L^H \f$ of the
+// symmetric (Hermitian) positive definite system matrix (see the ic0() function) and applies it
+// by means of a forward substitution with \a L and a backward substitution with \f$ L^H \f$, i.e.
+// \f$ z = L^{-H} L^{-1} r \f$. Only the lower part of the system matrix is accessed; every row
+// must contain an explicit diagonal element. Since the preconditioner is symmetric (Hermitian)
+// positive definite it is suited for the CG and the MINRES method:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverControl control;
+   blaze::IC0Preconditioner<double> M( A );
+   cg( A, x, b, control, M );
+   \endcode
+
+// In order to perform both substitutions row by row, the preconditioner stores \a L and
+// \f$ L^H \f$ as separate row-major compressed matrices. Both substitutions are level scheduled:
+// In case the number of non-zero elements within a level exceeds the \a BLAZE_SMP_SMATTRSV_THRESHOLD
+// and SMP is enabled, all rows of a level are processed in parallel.
+*/
+template< typename Type >  // Data type of the preconditioner
+class IC0Preconditioner
+{
+ public:
+   //**Constructor*********************************************************************************
+   template< typename MT, bool SO >
+   explicit inline IC0Preconditioner( const Matrix<MT,SO>& A );
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   inline const CompressedMatrix<Type,rowMajor>& factor() const noexcept;
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   template< typename VT1, typename VT2 >
+   inline void operator()( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   template< typename MT, bool SO >
+   static CompressedMatrix<Type,rowMajor> decompose( const Matrix<MT,SO>& A );
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   CompressedMatrix<Type,rowMajor> L_;  //!< The IC(0) factor of the system matrix.
+   CompressedMatrix<Type,rowMajor> U_;  //!< The conjugate transpose of the IC(0) factor.
+   std::vector<size_t> ldiag_;          //!< The positions of the diagonal elements of L.
+   std::vector<size_t> udiag_;          //!< The positions of the diagonal elements of U.
+   std::vector<Type> linv_;             //!< The inverse diagonal elements of L.
+   std::vector<Type> uinv_;             //!< The inverse diagonal elements of U.
+   LevelSchedule lower_;                //!< The level schedule of L.
+   LevelSchedule upper_;                //!< The level schedule of U.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the IC(0) preconditioner of the given system matrix.
+//
+// \param A The square symmetric (Hermitian) positive definite system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with missing diagonal element.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline IC0Preconditioner<Type>::IC0Preconditioner( const Matrix<MT,SO>& A )
+   : L_    ( decompose( ~A ) )        // The IC(0) factor of the system matrix
+   , U_    ( ctrans( L_ ) )           // The conjugate transpose of the IC(0) factor
+   , ldiag_( sparseDiagonal( L_ ) )   // The positions of the diagonal elements of L
+   , udiag_( sparseDiagonal( U_ ) )   // The positions of the diagonal elements of U
+   , linv_ ( L_.rows() )              // The inverse diagonal elements of L
+   , uinv_ ( L_.rows() )              // The inverse diagonal elements of U
+   , lower_( L_, true  )              // The level schedule of L
+   , upper_( U_, false )              // The level schedule of U
+{
+   for( size_t i=0UL; i<L_.rows(); ++i ) {
+      linv_[i] = Type(1) / L_.begin(i)[ldiag_[i]].value();
+      uinv_[i] = conj( linv_[i] );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the IC(0) factor of the system matrix.
+//
+// \return The lower triangular IC(0) factor \a L.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const CompressedMatrix<Type,rowMajor>& IC0Preconditioner<Type>::factor() const noexcept
+{
+   return L_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the IC(0) factor of the given system matrix.
+//
+// \param A The square symmetric (Hermitian) positive definite system matrix.
+// \return The lower triangular IC(0) factor \a L.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+CompressedMatrix<Type,rowMajor> IC0Preconditioner<Type>::decompose( const Matrix<MT,SO>& A )
+{
+   CompressedMatrix<Type,rowMajor> tmp( ~A );
+   ic0( tmp );
+
+   const size_t n( tmp.rows() );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      nonzeros += tmp.lowerBound( i, i ) - tmp.begin(i) + 1UL;
+   }
+
+   CompressedMatrix<Type,rowMajor> L( n, n, nonzeros );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const auto last( tmp.lowerBound( i, i ) + 1UL );
+      for( auto element=tmp.begin(i); element!=last; ++element ) {
+         L.append( i, element->index(), element->value() );
+      }
+      L.finalize( i );
+   }
+
+   return L;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the IC(0) preconditioner to the given vector.
+//
+// \param z The result vector.
+// \param r The vector to be preconditioned.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the result vector
+        , typename VT2 >   // Type of the vector to be preconditioned
+inline void IC0Preconditioner<Type>::operator()( DenseVector<VT1,false>& z,
+                                                 const DenseVector<VT2,false>& r ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~r).size() == L_.rows(), "Invalid vector size detected" );
+
+   ~z = ~r;
+   sparseLowerSolve( L_, ldiag_, linv_, lower_, ~z );
+   sparseUpperSolve( U_, udiag_, uinv_, upper_, ~z );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
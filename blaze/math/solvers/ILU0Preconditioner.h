@@ -0,0 +1,296 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ILU0Preconditioner.h
+//  \brief Header file for the ILU(0) preconditioner
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_ILU0PRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/solvers/SparseTriangular.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INCOMPLETE LU DECOMPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place incomplete LU decomposition without fill-in of the given sparse matrix.
+// \ingroup preconditioners
+//
+// \param A The square row-major sparse matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with missing diagonal element.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function computes the ILU(0) decomposition \f$ A \approx L U \f$ of the given sparse
+// matrix, where \a L is unit lower triangular and \a U is upper triangular and both factors have
+// the same sparsity pattern as the according triangular part of \a A. The decomposition works
+// in place on the existing non-zero elements of \a A: On exit the strictly lower part of \a A
+// contains \a L (without the unit diagonal) and the upper part of \a A contains \a U. No element
+// is inserted or removed, i.e. all fill-in is discarded. Every row of \a A must contain an
+// explicit diagonal element.
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A;
+   // ... Resizing and initialization
+
+   blaze::ilu0( A );  // A now contains the ILU(0) factors
+   \endcode
+
+// The rows are processed in order of the level schedule of the lower triangular part of \a A.
+// In case the number of non-zero elements within a level exceeds the \a BLAZE_SMP_SMATTRSV_THRESHOLD
+// and SMP is enabled, the rows of the level are decomposed in parallel. The result is identical
+// to the sequential decomposition. In case a zero pivot is encountered, a \a std::runtime_error
+// exception is thrown and \a A is left in a partially decomposed state.
+*/
+template< typename Type >  // Data type of the matrix
+void ilu0( CompressedMatrix<Type,rowMajor>& A )
+{
+   const std::vector<size_t> diag( sparseDiagonal( A ) );
+   const LevelSchedule schedule( A, true );
+
+   const auto kernel = [&A,&diag]( size_t i )
+   {
+      const auto dpos( A.begin(i) + diag[i] );
+      const auto iend( A.end(i) );
+
+      for( auto lik=A.begin(i); lik!=dpos; ++lik )
+      {
+         const size_t k( lik->index() );
+         const auto kend( A.end(k) );
+
+         lik->value() /= A.begin(k)[diag[k]].value();
+
+         auto ukj( A.begin(k) + diag[k] + 1UL );
+         auto aij( lik + 1 );
+
+         while( ukj != kend && aij != iend ) {
+            if( ukj->index() < aij->index() ) {
+               ++ukj;
+            }
+            else if( aij->index() < ukj->index() ) {
+               ++aij;
+            }
+            else {
+               aij->value() -= lik->value() * ukj->value();
+               ++ukj;
+               ++aij;
+            }
+         }
+      }
+   };
+
+   for( size_t l=0UL; l<schedule.levels(); ++l )
+   {
+      schedule.run( l, kernel );
+
+      for( auto row=schedule.begin(l); row!=schedule.end(l); ++row ) {
+         if( isDefault( A.begin(*row)[diag[*row]].value() ) ) {
+            BLAZE_THROW_LAPACK_ERROR( "Decomposition of singular matrix failed" );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete LU preconditioner of the iterative solvers.
+// \ingroup preconditioners
+//
+// The ILU0Preconditioner class computes the ILU(0) decomposition \f$ A \approx L U \f$ of the
+// system matrix (see the ilu0() function) and applies it by means of a forward substitution with
+// \a L and a backward substitution with \a U, i.e. \f$ z = U^{-1} L^{-1} r \f$. The system matrix
+// is copied into a row-major compressed matrix; every row must contain an explicit diagonal
+// element. Since the preconditioner is not symmetric it is usually combined with the GMRES or
+// the BiCGSTAB method:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverControl control;
+   blaze::ILU0Preconditioner<double> M( A );
+   bicgstab( A, x, b, control, M );
+   \endcode
+
+// Both triangular substitutions are level scheduled: In case the number of non-zero elements
+// within a level exceeds the \a BLAZE_SMP_SMATTRSV_THRESHOLD and SMP is enabled, all rows of a
+// level are processed in parallel. Note that the number of levels, and thus the available
+// parallelism, depends on the ordering of the unknowns.
+*/
+template< typename Type >  // Data type of the preconditioner
+class ILU0Preconditioner
+{
+ public:
+   //**Constructor*********************************************************************************
+   template< typename MT, bool SO >
+   explicit inline ILU0Preconditioner( const Matrix<MT,SO>& A );
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   inline const CompressedMatrix<Type,rowMajor>& factors() const noexcept;
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   template< typename VT1, typename VT2 >
+   inline void operator()( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   CompressedMatrix<Type,rowMajor> lu_;  //!< The ILU(0) factors of the system matrix.
+   std::vector<size_t> diag_;            //!< The positions of the diagonal elements.
+   std::vector<Type> inv_;               //!< The inverse diagonal elements of the U factor.
+   LevelSchedule lower_;                 //!< The level schedule of the L factor.
+   LevelSchedule upper_;                 //!< The level schedule of the U factor.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the ILU(0) preconditioner of the given system matrix.
+//
+// \param A The square system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with missing diagonal element.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline ILU0Preconditioner<Type>::ILU0Preconditioner( const Matrix<MT,SO>& A )
+   : lu_   ( ~A )                    // The ILU(0) factors of the system matrix
+   , diag_ ( sparseDiagonal( lu_ ) ) // The positions of the diagonal elements
+   , inv_  ( lu_.rows() )            // The inverse diagonal elements of the U factor
+   , lower_( lu_, true  )            // The level schedule of the L factor
+   , upper_( lu_, false )            // The level schedule of the U factor
+{
+   ilu0( lu_ );
+
+   for( size_t i=0UL; i<lu_.rows(); ++i ) {
+      inv_[i] = Type(1) / lu_.begin(i)[diag_[i]].value();
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the ILU(0) factors of the system matrix.
+//
+// \return The ILU(0) factors in the format of the ilu0() function.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const CompressedMatrix<Type,rowMajor>& ILU0Preconditioner<Type>::factors() const noexcept
+{
+   return lu_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the ILU(0) preconditioner to the given vector.
+//
+// \param z The result vector.
+// \param r The vector to be preconditioned.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the result vector
+        , typename VT2 >   // Type of the vector to be preconditioned
+inline void ILU0Preconditioner<Type>::operator()( DenseVector<VT1,false>& z,
+                                                  const DenseVector<VT2,false>& r ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~r).size() == lu_.rows(), "Invalid vector size detected" );
+
+   ~z = ~r;
+   sparseLowerSolve( lu_, diag_, std::vector<Type>(), lower_, ~z );
+   sparseUpperSolve( lu_, diag_, inv_, upper_, ~z );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,96 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/IdentityPreconditioner.h
+//  \brief Header file for the IdentityPreconditioner class
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_IDENTITYPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_IDENTITYPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseVector.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The identity preconditioner of the iterative solvers.
+// \ingroup preconditioners
+//
+// The IdentityPreconditioner class represents the absence of a preconditioner. It is the default
+// preconditioner of all iterative solvers. A preconditioner of the iterative solvers is any
+// callable that can be called as \c M(z,r) with two dense column vectors and that computes the
+// application of the inverse of the preconditioning matrix to \a r, i.e. \f$ z = M^{-1} r \f$.
+// The vector \a z has the same size as \a r. Consequently the Jacobi preconditioner for a matrix
+// \a A can for instance be passed as a lambda:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b, d;
+   // ... Resizing and initialization of A and b, d contains the inverse diagonal of A
+
+   blaze::SolverControl control;
+   cg( A, x, b, control, [&d]( auto& z, const auto& r ) { z = d * r; } );
+   \endcode
+
+// The iterative solvers detect the identity preconditioner at compile time and skip the
+// application of the preconditioner (including the according copy operations) entirely.
+*/
+struct IdentityPreconditioner
+{
+   //**Function call operator**********************************************************************
+   /*!\brief Applies the identity preconditioner to the given vector.
+   //
+   // \param z The result vector.
+   // \param r The vector to be preconditioned.
+   // \return void
+   */
+   template< typename VT1, typename VT2 >
+   inline void operator()( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const {
+      ~z = ~r;
+   }
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1123 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Kernels.h
+//  \brief Fused vector kernels of the iterative solvers
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_KERNELS_H_
+#define _BLAZE_MATH_SOLVERS_KERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the selection of the vectorized solver kernels.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+struct KrylovSIMD
+{
+   enum : bool { value = BLAZE_USE_VECTORIZATION && IsBuiltin<T>::value &&
+                         HasSIMDAdd<T,T>::value && HasSIMDSub<T,T>::value &&
+                         HasSIMDMult<T,T>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Real type of the squared norms computed for vectors of element type \a T.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+using KrylovReal = UnderlyingBuiltin_<T>;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PARALLEL EXECUTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combines two partial results of a solver kernel.
+// \ingroup solvers
+//
+// \param lhs The accumulated result.
+// \param rhs The partial result to be added.
+// \return void
+*/
+template< typename T >  // Type of the partial result
+inline void krylovCombine( T& lhs, const T& rhs )
+{
+   lhs += rhs;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Combines two partial results of a solver kernel with two reductions.
+// \ingroup solvers
+//
+// \param lhs The accumulated result.
+// \param rhs The partial result to be added.
+// \return void
+*/
+template< typename T1    // Type of the first partial result
+        , typename T2 >  // Type of the second partial result
+inline void krylovCombine( std::pair<T1,T2>& lhs, const std::pair<T1,T2>& rhs )
+{
+   lhs.first  += rhs.first;
+   lhs.second += rhs.second;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether a solver kernel for vectors of the given size is executed in parallel.
+// \ingroup solvers
+//
+// \param n The size of the vectors.
+// \return \a true in case the kernel is executed in parallel, \a false if not.
+*/
+inline bool isKrylovParallel( size_t n )
+{
+   return n >= SMP_SOLVER_THRESHOLD && getNumThreads() > 1UL &&
+          !isSerialSectionActive() && !isParallelSectionActive();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the block size for the parallel execution of a solver kernel.
+// \ingroup solvers
+//
+// \param n The size of the vectors.
+// \return The number of elements per block.
+//
+// The block size is a multiple of 64 elements. Therefore the first index of every block preserves
+// the alignment of the vectors.
+*/
+inline size_t krylovBlockSize( size_t n )
+{
+   const size_t parts( getNumThreads() * 2UL );
+   return ( ( n - 1UL ) / parts + 64UL ) & size_t(-64);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given solver kernel for the index range \f$[0..n)\f$.
+// \ingroup solvers
+//
+// \param n The size of the vectors.
+// \param kernel The solver kernel, called as \c kernel(begin,end).
+// \return void
+//
+// In case \a n is larger or equal to the \c SMP_SOLVER_THRESHOLD and more than one thread is
+// available, the index range is split into blocks that are processed concurrently.
+*/
+template< typename Kernel >  // Type of the solver kernel
+inline void krylovFor( size_t n, const Kernel& kernel )
+{
+   if( !isKrylovParallel( n ) ) {
+      kernel( 0UL, n );
+      return;
+   }
+
+   const size_t blocksize( krylovBlockSize( n ) );
+   const size_t blocks   ( ( n - 1UL ) / blocksize + 1UL );
+
+   smpFor( 0UL, blocks, [&]( size_t first, size_t last ) {
+      for( size_t k=first; k<last; ++k ) {
+         const size_t begin( k*blocksize );
+         const size_t end  ( ( begin + blocksize < n )?( begin + blocksize ):( n ) );
+         kernel( begin, end );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given reducing solver kernel for the index range \f$[0..n)\f$.
+// \ingroup solvers
+//
+// \param n The size of the vectors.
+// \param kernel The solver kernel, called as \c kernel(begin,end).
+// \return The combined result of the kernel.
+//
+// In case \a n is larger or equal to the \c SMP_SOLVER_THRESHOLD and more than one thread is
+// available, the index range is split into blocks that are processed concurrently. The partial
+// results of the blocks are combined in order of the blocks, i.e. for a given number of threads
+// the result is deterministic.
+*/
+template< typename R         // Result type of the kernel
+        , typename Kernel >  // Type of the solver kernel
+inline R krylovReduce( size_t n, const Kernel& kernel )
+{
+   if( !isKrylovParallel( n ) ) {
+      return kernel( 0UL, n );
+   }
+
+   const size_t blocksize( krylovBlockSize( n ) );
+   const size_t blocks   ( ( n - 1UL ) / blocksize + 1UL );
+
+   std::vector<R> partial( blocks );
+
+   smpFor( 0UL, blocks, [&]( size_t first, size_t last ) {
+      for( size_t k=first; k<last; ++k ) {
+         const size_t begin( k*blocksize );
+         const size_t end  ( ( begin + blocksize < n )?( begin + blocksize ):( n ) );
+         partial[k] = kernel( begin, end );
+      }
+   } );
+
+   R result( partial[0UL] );
+   for( size_t k=1UL; k<blocks; ++k ) {
+      krylovCombine( result, partial[k] );
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DOT PRODUCT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the inner product \f$ x^H y \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline T krylovDotKernel( const T* x, const T* y, size_t begin, size_t end )
+{
+   T sum{};
+
+   for( size_t i=begin; i<end; ++i ) {
+      sum += conj( x[i] ) * y[i];
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the inner product \f$ x^H y \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline EnableIf_< KrylovSIMD<T>, T >
+   krylovDotKernel( const T* x, const T* y, size_t begin, size_t end, int )
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<T>::size;
+
+   const size_t ipos( begin + ( ( end - begin ) & size_t(-SIMDSIZE) ) );
+
+   SIMDTrait_<T> xmm1, xmm2;
+   size_t i( begin );
+
+   for( ; (i+SIMDSIZE) < ipos; i+=2UL*SIMDSIZE ) {
+      xmm1 += loada( x+i          ) * loada( y+i          );
+      xmm2 += loada( x+i+SIMDSIZE ) * loada( y+i+SIMDSIZE );
+   }
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      xmm1 += loada( x+i ) * loada( y+i );
+   }
+
+   return sum( xmm1 + xmm2 ) + krylovDotKernel( x, y, ipos, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the vectorized inner product kernel.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline DisableIf_< KrylovSIMD<T>, T >
+   krylovDotKernel( const T* x, const T* y, size_t begin, size_t end, int )
+{
+   return krylovDotKernel( x, y, begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the inner product \f$ x^H y \f$ of two solver vectors.
+// \ingroup solvers
+//
+// \param x The left-hand side vector.
+// \param y The right-hand side vector.
+// \return The inner product \f$ x^H y \f$.
+*/
+template< typename T >  // Element type of the vectors
+inline T krylovDot( const DynamicVector<T,columnVector>& x, const DynamicVector<T,columnVector>& y )
+{
+   BLAZE_INTERNAL_ASSERT( x.size() == y.size(), "Invalid vector sizes" );
+
+   const T* px( x.data() );
+   const T* py( y.data() );
+
+   return krylovReduce<T>( x.size(), [px,py]( size_t begin, size_t end ) {
+      return krylovDotKernel( px, py, begin, end, 0 );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the fused computation of \f$ (x^H y, x^H x) \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline std::pair< T, KrylovReal<T> >
+   krylovDotNormKernel( const T* x, const T* y, size_t begin, size_t end )
+{
+   std::pair< T, KrylovReal<T> > sums{};
+
+   for( size_t i=begin; i<end; ++i ) {
+      const T cx( conj( x[i] ) );
+      sums.first  += cx * y[i];
+      sums.second += real( cx * x[i] );
+   }
+
+   return sums;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the fused computation of \f$ (x^H y, x^H x) \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline EnableIf_< KrylovSIMD<T>, std::pair< T, KrylovReal<T> > >
+   krylovDotNormKernel( const T* x, const T* y, size_t begin, size_t end, int )
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<T>::size;
+
+   const size_t ipos( begin + ( ( end - begin ) & size_t(-SIMDSIZE) ) );
+
+   SIMDTrait_<T> xmm1, xmm2;
+
+   for( size_t i=begin; i<ipos; i+=SIMDSIZE ) {
+      const SIMDTrait_<T> xmm3( loada( x+i ) );
+      xmm1 += xmm3 * loada( y+i );
+      xmm2 += xmm3 * xmm3;
+   }
+
+   std::pair< T, KrylovReal<T> > sums( krylovDotNormKernel( x, y, ipos, end ) );
+   sums.first  += sum( xmm1 );
+   sums.second += sum( xmm2 );
+
+   return sums;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the vectorized kernel for the fused computation of \f$ (x^H y, x^H x) \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline DisableIf_< KrylovSIMD<T>, std::pair< T, KrylovReal<T> > >
+   krylovDotNormKernel( const T* x, const T* y, size_t begin, size_t end, int )
+{
+   return krylovDotNormKernel( x, y, begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the inner product \f$ x^H y \f$ and the squared norm \f$ x^H x \f$ in a single pass.
+// \ingroup solvers
+//
+// \param x The left-hand side vector.
+// \param y The right-hand side vector.
+// \return The pair \f$ (x^H y, x^H x) \f$.
+*/
+template< typename T >  // Element type of the vectors
+inline std::pair< T, KrylovReal<T> >
+   krylovDotNorm( const DynamicVector<T,columnVector>& x, const DynamicVector<T,columnVector>& y )
+{
+   BLAZE_INTERNAL_ASSERT( x.size() == y.size(), "Invalid vector sizes" );
+
+   const T* px( x.data() );
+   const T* py( y.data() );
+
+   return krylovReduce< std::pair< T, KrylovReal<T> > >( x.size(), [px,py]( size_t begin, size_t end ) {
+      return krylovDotNormKernel( px, py, begin, end, 0 );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UPDATE KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the search direction update \f$ p = z + \beta (p - \omega v) \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline void krylovDirectionKernel( T* p, const T* z, const T* v, T beta, T omega, size_t begin, size_t end )
+{
+   if( v == nullptr ) {
+      for( size_t i=begin; i<end; ++i ) {
+         p[i] = z[i] + beta * p[i];
+      }
+   }
+   else {
+      for( size_t i=begin; i<end; ++i ) {
+         p[i] = z[i] + beta * ( p[i] - omega * v[i] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the search direction update \f$ p = z + \beta (p - \omega v) \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline EnableIf_< KrylovSIMD<T> >
+   krylovDirectionKernel( T* p, const T* z, const T* v, T beta, T omega, size_t begin, size_t end, int )
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<T>::size;
+
+   const size_t ipos( begin + ( ( end - begin ) & size_t(-SIMDSIZE) ) );
+
+   const SIMDTrait_<T> b( set( beta ) );
+
+   if( v == nullptr ) {
+      for( size_t i=begin; i<ipos; i+=SIMDSIZE ) {
+         storea( p+i, loada( z+i ) + b * loada( p+i ) );
+      }
+   }
+   else {
+      const SIMDTrait_<T> w( set( omega ) );
+      for( size_t i=begin; i<ipos; i+=SIMDSIZE ) {
+         storea( p+i, loada( z+i ) + b * ( loada( p+i ) - w * loada( v+i ) ) );
+      }
+   }
+
+   krylovDirectionKernel( p, z, v, beta, omega, ipos, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the vectorized kernel for the search direction update.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline DisableIf_< KrylovSIMD<T> >
+   krylovDirectionKernel( T* p, const T* z, const T* v, T beta, T omega, size_t begin, size_t end, int )
+{
+   krylovDirectionKernel( p, z, v, beta, omega, begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Updates the search direction of the conjugate gradient method (\f$ p = z + \beta p \f$).
+// \ingroup solvers
+//
+// \param p The search direction.
+// \param z The (preconditioned) residual.
+// \param beta The scaling factor of the previous search direction.
+// \return void
+//
+// In contrast to the according expression \c p=z+beta*p the update is performed in-place without
+// the creation of a temporary vector.
+*/
+template< typename T >  // Element type of the vectors
+inline void krylovDirection( DynamicVector<T,columnVector>& p, const DynamicVector<T,columnVector>& z, T beta )
+{
+   BLAZE_INTERNAL_ASSERT( p.size() == z.size(), "Invalid vector sizes" );
+
+   T* pp( p.data() );
+   const T* pz( z.data() );
+
+   krylovFor( p.size(), [=]( size_t begin, size_t end ) {
+      krylovDirectionKernel( pp, pz, static_cast<const T*>( nullptr ), beta, T(), begin, end, 0 );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Updates the search direction of the BiCGSTAB method (\f$ p = r + \beta (p - \omega v) \f$).
+// \ingroup solvers
+//
+// \param p The search direction.
+// \param r The residual.
+// \param v The product of the system matrix and the preconditioned search direction.
+// \param beta The scaling factor of the previous search direction.
+// \param omega The second step length of the previous iteration.
+// \return void
+*/
+template< typename T >  // Element type of the vectors
+inline void krylovDirection( DynamicVector<T,columnVector>& p, const DynamicVector<T,columnVector>& r,
+                             const DynamicVector<T,columnVector>& v, T beta, T omega )
+{
+   BLAZE_INTERNAL_ASSERT( p.size() == r.size() && p.size() == v.size(), "Invalid vector sizes" );
+
+   T* pp( p.data() );
+   const T* pr( r.data() );
+   const T* pv( v.data() );
+
+   krylovFor( p.size(), [=]( size_t begin, size_t end ) {
+      krylovDirectionKernel( pp, pr, pv, beta, omega, begin, end, 0 );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the fused update \f$ y = a - \alpha b \f$ with computation of \f$ c^H y \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline T krylovSubDotKernel( T* y, const T* a, const T* b, const T* c, T alpha, size_t begin, size_t end )
+{
+   T sum{};
+
+   for( size_t i=begin; i<end; ++i ) {
+      y[i] = a[i] - alpha * b[i];
+      sum += conj( c[i] ) * y[i];
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the fused update \f$ y = a - \alpha b \f$ with computation of \f$ c^H y \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline EnableIf_< KrylovSIMD<T>, T >
+   krylovSubDotKernel( T* y, const T* a, const T* b, const T* c, T alpha, size_t begin, size_t end, int )
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<T>::size;
+
+   const size_t ipos( begin + ( ( end - begin ) & size_t(-SIMDSIZE) ) );
+
+   const SIMDTrait_<T> factor( set( alpha ) );
+   SIMDTrait_<T> xmm1;
+
+   for( size_t i=begin; i<ipos; i+=SIMDSIZE ) {
+      const SIMDTrait_<T> xmm2( loada( a+i ) - factor * loada( b+i ) );
+      storea( y+i, xmm2 );
+      xmm1 += loada( c+i ) * xmm2;
+   }
+
+   return sum( xmm1 ) + krylovSubDotKernel( y, a, b, c, alpha, ipos, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the vectorized kernel for the fused update \f$ y = a - \alpha b \f$ with
+//        computation of \f$ c^H y \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline DisableIf_< KrylovSIMD<T>, T >
+   krylovSubDotKernel( T* y, const T* a, const T* b, const T* c, T alpha, size_t begin, size_t end, int )
+{
+   return krylovSubDotKernel( y, a, b, c, alpha, begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ y = a - \alpha b \f$ and the inner product \f$ c^H y \f$ in a single pass.
+// \ingroup solvers
+//
+// \param y The target vector.
+// \param a The first operand of the update (may be \a y itself).
+// \param b The second operand of the update.
+// \param c The left-hand side vector of the inner product.
+// \param alpha The scaling factor of \a b.
+// \return The inner product \f$ c^H y \f$ of the updated vector.
+*/
+template< typename T >  // Element type of the vectors
+inline T krylovSubDot( DynamicVector<T,columnVector>& y, const DynamicVector<T,columnVector>& a,
+                       const DynamicVector<T,columnVector>& b, const DynamicVector<T,columnVector>& c,
+                       T alpha )
+{
+   BLAZE_INTERNAL_ASSERT( y.size() == a.size() && y.size() == b.size() && y.size() == c.size(),
+                          "Invalid vector sizes" );
+
+   T* py( y.data() );
+   const T* pa( a.data() );
+   const T* pb( b.data() );
+   const T* pc( c.data() );
+
+   return krylovReduce<T>( y.size(), [=]( size_t begin, size_t end ) {
+      return krylovSubDotKernel( py, pa, pb, pc, alpha, begin, end, 0 );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the fused update \f$ y = a - \alpha b \f$ with computation of \f$ y^H y \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline KrylovReal<T> krylovSubNormKernel( T* y, const T* a, const T* b, T alpha, size_t begin, size_t end )
+{
+   KrylovReal<T> sum{};
+
+   for( size_t i=begin; i<end; ++i ) {
+      y[i] = a[i] - alpha * b[i];
+      sum += real( conj( y[i] ) * y[i] );
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the fused update \f$ y = a - \alpha b \f$ with computation of \f$ y^H y \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline EnableIf_< KrylovSIMD<T>, KrylovReal<T> >
+   krylovSubNormKernel( T* y, const T* a, const T* b, T alpha, size_t begin, size_t end, int )
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<T>::size;
+
+   const size_t ipos( begin + ( ( end - begin ) & size_t(-SIMDSIZE) ) );
+
+   const SIMDTrait_<T> factor( set( alpha ) );
+   SIMDTrait_<T> xmm1;
+
+   for( size_t i=begin; i<ipos; i+=SIMDSIZE ) {
+      const SIMDTrait_<T> xmm2( loada( a+i ) - factor * loada( b+i ) );
+      storea( y+i, xmm2 );
+      xmm1 += xmm2 * xmm2;
+   }
+
+   return sum( xmm1 ) + krylovSubNormKernel( y, a, b, alpha, ipos, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the vectorized kernel for the fused update \f$ y = a - \alpha b \f$ with
+//        computation of \f$ y^H y \f$.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline DisableIf_< KrylovSIMD<T>, KrylovReal<T> >
+   krylovSubNormKernel( T* y, const T* a, const T* b, T alpha, size_t begin, size_t end, int )
+{
+   return krylovSubNormKernel( y, a, b, alpha, begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ y = a - \alpha b \f$ and the squared norm \f$ y^H y \f$ in a single pass.
+// \ingroup solvers
+//
+// \param y The target vector.
+// \param a The first operand of the update (may be \a y itself).
+// \param b The second operand of the update.
+// \param alpha The scaling factor of \a b.
+// \return The squared norm of the updated vector.
+*/
+template< typename T >  // Element type of the vectors
+inline KrylovReal<T>
+   krylovSubNorm( DynamicVector<T,columnVector>& y, const DynamicVector<T,columnVector>& a,
+                  const DynamicVector<T,columnVector>& b, T alpha )
+{
+   BLAZE_INTERNAL_ASSERT( y.size() == a.size() && y.size() == b.size(), "Invalid vector sizes" );
+
+   T* py( y.data() );
+   const T* pa( a.data() );
+   const T* pb( b.data() );
+
+   return krylovReduce< KrylovReal<T> >( y.size(), [=]( size_t begin, size_t end ) {
+      return krylovSubNormKernel( py, pa, pb, alpha, begin, end, 0 );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the fused conjugate gradient update.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline KrylovReal<T> krylovCGKernel( T* x, T* r, const T* p, const T* q, T alpha, size_t begin, size_t end )
+{
+   KrylovReal<T> sum{};
+
+   for( size_t i=begin; i<end; ++i ) {
+      x[i] += alpha * p[i];
+      r[i] -= alpha * q[i];
+      sum  += real( conj( r[i] ) * r[i] );
+   }
+
+   return sum;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the fused conjugate gradient update.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline EnableIf_< KrylovSIMD<T>, KrylovReal<T> >
+   krylovCGKernel( T* x, T* r, const T* p, const T* q, T alpha, size_t begin, size_t end, int )
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<T>::size;
+
+   const size_t ipos( begin + ( ( end - begin ) & size_t(-SIMDSIZE) ) );
+
+   const SIMDTrait_<T> factor( set( alpha ) );
+   SIMDTrait_<T> xmm1;
+
+   for( size_t i=begin; i<ipos; i+=SIMDSIZE ) {
+      storea( x+i, loada( x+i ) + factor * loada( p+i ) );
+      const SIMDTrait_<T> xmm2( loada( r+i ) - factor * loada( q+i ) );
+      storea( r+i, xmm2 );
+      xmm1 += xmm2 * xmm2;
+   }
+
+   return sum( xmm1 ) + krylovCGKernel( x, r, p, q, alpha, ipos, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the vectorized kernel for the fused conjugate gradient update.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline DisableIf_< KrylovSIMD<T>, KrylovReal<T> >
+   krylovCGKernel( T* x, T* r, const T* p, const T* q, T alpha, size_t begin, size_t end, int )
+{
+   return krylovCGKernel( x, r, p, q, alpha, begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Performs the conjugate gradient update in a single pass.
+// \ingroup solvers
+//
+// \param x The current approximation of the solution.
+// \param r The current residual.
+// \param p The search direction.
+// \param q The product of the system matrix and the search direction.
+// \param alpha The step length.
+// \return The squared norm of the updated residual.
+//
+// This function computes \f$ x = x + \alpha p \f$ and \f$ r = r - \alpha q \f$ and returns the
+// squared norm of the updated residual \a r.
+*/
+template< typename T >  // Element type of the vectors
+inline KrylovReal<T>
+   krylovCGUpdate( DynamicVector<T,columnVector>& x, DynamicVector<T,columnVector>& r,
+                   const DynamicVector<T,columnVector>& p, const DynamicVector<T,columnVector>& q,
+                   T alpha )
+{
+   BLAZE_INTERNAL_ASSERT( x.size() == r.size() && x.size() == p.size() && x.size() == q.size(),
+                          "Invalid vector sizes" );
+
+   T* px( x.data() );
+   T* pr( r.data() );
+   const T* pp( p.data() );
+   const T* pq( q.data() );
+
+   return krylovReduce< KrylovReal<T> >( x.size(), [=]( size_t begin, size_t end ) {
+      return krylovCGKernel( px, pr, pp, pq, alpha, begin, end, 0 );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the fused BiCGSTAB update.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline std::pair< T, KrylovReal<T> >
+   krylovBiCGKernel( T* x, T* r, const T* ph, const T* sh, const T* s, const T* t, const T* rh,
+                     T alpha, T omega, size_t begin, size_t end )
+{
+   std::pair< T, KrylovReal<T> > sums{};
+
+   for( size_t i=begin; i<end; ++i ) {
+      x[i] += alpha * ph[i] + omega * sh[i];
+      r[i]  = s[i] - omega * t[i];
+      sums.first  += conj( rh[i] ) * r[i];
+      sums.second += real( conj( r[i] ) * r[i] );
+   }
+
+   return sums;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the fused BiCGSTAB update.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline EnableIf_< KrylovSIMD<T>, std::pair< T, KrylovReal<T> > >
+   krylovBiCGKernel( T* x, T* r, const T* ph, const T* sh, const T* s, const T* t, const T* rh,
+                     T alpha, T omega, size_t begin, size_t end, int )
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<T>::size;
+
+   const size_t ipos( begin + ( ( end - begin ) & size_t(-SIMDSIZE) ) );
+
+   const SIMDTrait_<T> a( set( alpha ) );
+   const SIMDTrait_<T> w( set( omega ) );
+   SIMDTrait_<T> xmm1, xmm2;
+
+   for( size_t i=begin; i<ipos; i+=SIMDSIZE ) {
+      storea( x+i, loada( x+i ) + a * loada( ph+i ) + w * loada( sh+i ) );
+      const SIMDTrait_<T> xmm3( loada( s+i ) - w * loada( t+i ) );
+      storea( r+i, xmm3 );
+      xmm1 += loada( rh+i ) * xmm3;
+      xmm2 += xmm3 * xmm3;
+   }
+
+   std::pair< T, KrylovReal<T> > sums( krylovBiCGKernel( x, r, ph, sh, s, t, rh, alpha, omega, ipos, end ) );
+   sums.first  += sum( xmm1 );
+   sums.second += sum( xmm2 );
+
+   return sums;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the vectorized kernel for the fused BiCGSTAB update.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline DisableIf_< KrylovSIMD<T>, std::pair< T, KrylovReal<T> > >
+   krylovBiCGKernel( T* x, T* r, const T* ph, const T* sh, const T* s, const T* t, const T* rh,
+                     T alpha, T omega, size_t begin, size_t end, int )
+{
+   return krylovBiCGKernel( x, r, ph, sh, s, t, rh, alpha, omega, begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Performs the final BiCGSTAB update of an iteration in a single pass.
+// \ingroup solvers
+//
+// \param x The current approximation of the solution.
+// \param r The residual to be updated.
+// \param ph The preconditioned search direction \f$ \hat{p} \f$.
+// \param sh The preconditioned intermediate residual \f$ \hat{s} \f$.
+// \param s The intermediate residual.
+// \param t The product of the system matrix and \f$ \hat{s} \f$.
+// \param rh The shadow residual \f$ \hat{r} \f$.
+// \param alpha The first step length.
+// \param omega The second step length.
+// \return The pair \f$ (\hat{r}^H r, r^H r) \f$ of the updated residual.
+//
+// This function computes \f$ x = x + \alpha \hat{p} + \omega \hat{s} \f$ and \f$ r = s - \omega
+// t \f$ and returns the inner product with the shadow residual and the squared norm of \a r.
+*/
+template< typename T >  // Element type of the vectors
+inline std::pair< T, KrylovReal<T> >
+   krylovBiCGUpdate( DynamicVector<T,columnVector>& x, DynamicVector<T,columnVector>& r,
+                     const DynamicVector<T,columnVector>& ph, const DynamicVector<T,columnVector>& sh,
+                     const DynamicVector<T,columnVector>& s, const DynamicVector<T,columnVector>& t,
+                     const DynamicVector<T,columnVector>& rh, T alpha, T omega )
+{
+   BLAZE_INTERNAL_ASSERT( x.size() == r.size() && x.size() == ph.size() && x.size() == sh.size() &&
+                          x.size() == s.size() && x.size() == t.size() && x.size() == rh.size(),
+                          "Invalid vector sizes" );
+
+   T* px( x.data() );
+   T* pr( r.data() );
+   const T* pph( ph.data() );
+   const T* psh( sh.data() );
+   const T* ps ( s.data()  );
+   const T* pt ( t.data()  );
+   const T* prh( rh.data() );
+
+   return krylovReduce< std::pair< T, KrylovReal<T> > >( x.size(), [=]( size_t begin, size_t end ) {
+      return krylovBiCGKernel( px, pr, pph, psh, ps, pt, prh, alpha, omega, begin, end, 0 );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default kernel for the fused MINRES update.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline void krylovMinresKernel( T* w, T* x, const T* v, const T* w1, const T* w2, T a, T b,
+                                T c, T phi, size_t begin, size_t end )
+{
+   for( size_t i=begin; i<end; ++i ) {
+      w[i]  = c * ( v[i] - a * w1[i] - b * w2[i] );
+      x[i] += phi * w[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized kernel for the fused MINRES update.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline EnableIf_< KrylovSIMD<T> >
+   krylovMinresKernel( T* w, T* x, const T* v, const T* w1, const T* w2, T a, T b,
+                       T c, T phi, size_t begin, size_t end, int )
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<T>::size;
+
+   const size_t ipos( begin + ( ( end - begin ) & size_t(-SIMDSIZE) ) );
+
+   const SIMDTrait_<T> xmm1( set( a ) );
+   const SIMDTrait_<T> xmm2( set( b ) );
+   const SIMDTrait_<T> xmm3( set( c ) );
+   const SIMDTrait_<T> xmm4( set( phi ) );
+
+   for( size_t i=begin; i<ipos; i+=SIMDSIZE ) {
+      const SIMDTrait_<T> xmm5( xmm3 * ( loada( v+i ) - xmm1 * loada( w1+i ) - xmm2 * loada( w2+i ) ) );
+      storea( w+i, xmm5 );
+      storea( x+i, loada( x+i ) + xmm4 * xmm5 );
+   }
+
+   krylovMinresKernel( w, x, v, w1, w2, a, b, c, phi, ipos, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the vectorized kernel for the fused MINRES update.
+// \ingroup solvers
+*/
+template< typename T >  // Element type of the vectors
+inline DisableIf_< KrylovSIMD<T> >
+   krylovMinresKernel( T* w, T* x, const T* v, const T* w1, const T* w2, T a, T b,
+                       T c, T phi, size_t begin, size_t end, int )
+{
+   krylovMinresKernel( w, x, v, w1, w2, a, b, c, phi, begin, end );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Performs the update of the solution of the MINRES method in a single pass.
+// \ingroup solvers
+//
+// \param w The new (scaled) search direction.
+// \param x The current approximation of the solution.
+// \param v The current Lanczos vector.
+// \param w1 The previous but one search direction.
+// \param w2 The previous search direction.
+// \param a The scaling factor of the previous but one search direction.
+// \param b The scaling factor of the previous search direction.
+// \param c The scaling factor of the new search direction.
+// \param phi The step length.
+// \return void
+//
+// This function computes \f$ w = c (v - a w_1 - b w_2) \f$ and \f$ x = x + \phi w \f$.
+*/
+template< typename T >  // Element type of the vectors
+inline void krylovMinresUpdate( DynamicVector<T,columnVector>& w, DynamicVector<T,columnVector>& x,
+                                const DynamicVector<T,columnVector>& v,
+                                const DynamicVector<T,columnVector>& w1,
+                                const DynamicVector<T,columnVector>& w2, T a, T b, T c, T phi )
+{
+   BLAZE_INTERNAL_ASSERT( w.size() == x.size() && w.size() == v.size() &&
+                          w.size() == w1.size() && w.size() == w2.size(), "Invalid vector sizes" );
+
+   T* pw( w.data() );
+   T* px( x.data() );
+   const T* pv ( v.data()  );
+   const T* pw1( w1.data() );
+   const T* pw2( w2.data() );
+
+   krylovFor( w.size(), [=]( size_t begin, size_t end ) {
+      krylovMinresKernel( pw, px, pv, pw1, pw2, a, b, c, phi, begin, end, 0 );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,646 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/KrylovEigen.h
+//  \brief Header file for the common kernels of the Krylov subspace eigenvalue solvers
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_KRYLOVEIGEN_H_
+#define _BLAZE_MATH_SOLVERS_KRYLOVEIGEN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/lapack/heevd.h>
+#include <blaze/math/lapack/syevd.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Imaginary.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/solvers/EigenSpectrum.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/Operator.h>
+#include <blaze/math/solvers/ShiftInvert.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Not.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the element type of the Krylov basis of an eigenvalue solver.
+// \ingroup eigensolvers
+//
+// The Krylov basis of an eigenvalue solver uses the element type of the given matrix or the
+// type of the shift of a shift-invert operator. For any other matrix-free operator the given
+// default type is used.
+*/
+template< typename Op         // Type of the operator
+        , typename Default    // Default element type
+        , typename = void >   // Restricting condition
+struct KrylovEigenElement
+{
+   using Type = Default;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the KrylovEigenElement class template for matrices.
+// \ingroup eigensolvers
+*/
+template< typename Op         // Type of the operator
+        , typename Default >  // Default element type
+struct KrylovEigenElement< Op, Default, EnableIf_< IsMatrix<Op> > >
+{
+   using Type = ElementType_<Op>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the KrylovEigenElement class template for shift-invert operators.
+// \ingroup eigensolvers
+*/
+template< typename T          // Type of the shift
+        , typename ST         // Type of the solver
+        , typename Default >  // Default element type
+struct KrylovEigenElement< ShiftInvert<T,ST>, Default, void >
+{
+   using Type = T;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SETUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of the matrix of an eigenvalue solver.
+// \ingroup eigensolvers
+*/
+template< typename Op    // Type of the matrix
+        , typename MT    // Type of the eigenvector matrix
+        , bool SO >      // Storage order of the eigenvector matrix
+inline EnableIf_< IsMatrix<Op>, size_t >
+   krylovEigenSize( const Op& A, const DenseMatrix<MT,SO>& V )
+{
+   UNUSED_PARAMETER( V );
+
+   if( !isSquare( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   return A.rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of the shift-invert operator of an eigenvalue solver.
+// \ingroup eigensolvers
+*/
+template< typename T     // Type of the shift
+        , typename ST    // Type of the solver
+        , typename MT    // Type of the eigenvector matrix
+        , bool SO >      // Storage order of the eigenvector matrix
+inline size_t krylovEigenSize( const ShiftInvert<T,ST>& A, const DenseMatrix<MT,SO>& V )
+{
+   UNUSED_PARAMETER( V );
+
+   return A.rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the size of the matrix-free operator of an eigenvalue solver.
+// \ingroup eigensolvers
+//
+// The size of a matrix-free operator is given by the number of rows of the starting vectors.
+*/
+template< typename Op    // Type of the operator
+        , typename MT    // Type of the eigenvector matrix
+        , bool SO >      // Storage order of the eigenvector matrix
+inline DisableIf_< IsMatrix<Op>, size_t >
+   krylovEigenSize( const Op& A, const DenseMatrix<MT,SO>& V )
+{
+   UNUSED_PARAMETER( A );
+
+   if( (~V).rows() == 0UL || (~V).columns() == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid starting vector provided" );
+   }
+
+   return (~V).rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the dimension of the Krylov subspace of an eigenvalue solver.
+// \ingroup eigensolvers
+//
+// \param n The size of the matrix.
+// \param nev The number of requested eigenvalues.
+// \param ncv The requested dimension of the Krylov subspace (0 for the default dimension).
+// \return The dimension of the Krylov subspace.
+// \exception std::invalid_argument Invalid number of eigenvalues.
+// \exception std::invalid_argument Invalid subspace dimension.
+*/
+inline size_t krylovEigenSubspace( size_t n, size_t nev, size_t ncv )
+{
+   if( nev == 0UL || nev > n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of eigenvalues" );
+   }
+
+   if( ncv == 0UL ) {
+      return min( n, max( 2UL*nev+1UL, nev+20UL ) );
+   }
+
+   if( ncv > n || ( ncv <= nev+1UL && ncv < n ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid subspace dimension" );
+   }
+
+   return ncv;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts an element of the starting vector to the element type of the Krylov basis.
+// \ingroup eigensolvers
+*/
+template< typename T    // Element type of the Krylov basis
+        , typename S >  // Element type of the starting vector
+inline EnableIf_< And< IsComplex<S>, Not< IsComplex<T> > >, T > krylovEigenCast( const S& value )
+{
+   return T( real( value ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts an element of the starting vector to the element type of the Krylov basis.
+// \ingroup eigensolvers
+*/
+template< typename T    // Element type of the Krylov basis
+        , typename S >  // Element type of the starting vector
+inline DisableIf_< And< IsComplex<S>, Not< IsComplex<T> > >, T > krylovEigenCast( const S& value )
+{
+   return T( value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fills a column of the Krylov basis with a deterministic pseudo-random vector.
+// \ingroup eigensolvers
+//
+// \param V The Krylov basis.
+// \param j The index of the column.
+// \return void
+*/
+template< typename T >  // Element type of the Krylov basis
+void krylovEigenRandom( DynamicMatrix<T,columnMajor>& V, size_t j )
+{
+   std::uint64_t state( 0x9E3779B97F4A7C15ULL * ( j + 1UL ) );
+
+   for( size_t i=0UL; i<V.rows(); ++i ) {
+      state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+      V(i,j) = T( double( state >> 11 ) * ( 1.0 / 9007199254740992.0 ) - 0.5 );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initializes the first column of the Krylov basis of an eigenvalue solver.
+// \ingroup eigensolvers
+//
+// \param B The Krylov basis.
+// \param V The given eigenvector matrix.
+// \return void
+//
+// In case the first column of \a V is a non-zero vector of the right size, it is used as starting
+// vector. Otherwise a pseudo-random starting vector is used.
+*/
+template< typename T     // Element type of the Krylov basis
+        , typename MT    // Type of the eigenvector matrix
+        , bool SO >      // Storage order of the eigenvector matrix
+void krylovEigenStart( DynamicMatrix<T,columnMajor>& B, const DenseMatrix<MT,SO>& V )
+{
+   using RT = KrylovReal<T>;
+
+   const size_t n( B.rows() );
+
+   if( (~V).rows() == n && (~V).columns() > 0UL ) {
+      for( size_t i=0UL; i<n; ++i ) {
+         B(i,0UL) = krylovEigenCast<T>( (~V)(i,0UL) );
+      }
+   }
+
+   if( (~V).rows() != n || (~V).columns() == 0UL || norm( column( B, 0UL ) ) == RT(0) ) {
+      krylovEigenRandom( B, 0UL );
+   }
+
+   column( B, 0UL ) *= RT(1) / norm( column( B, 0UL ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ARNOLDI PROCESS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Orthogonalizes a vector against the leading columns of the Krylov basis.
+// \ingroup eigensolvers
+//
+// \param V The orthonormal Krylov basis.
+// \param k The number of leading columns of the basis.
+// \param f The vector to be orthogonalized.
+// \param h The resulting projection coefficients \f$ V_k^H f \f$.
+// \return The norm of the orthogonalized vector.
+//
+// The vector is orthogonalized by two passes of the classical Gram-Schmidt process, which
+// guarantees orthogonality to working precision. Both passes are performed by the dense matrix/
+// dense vector multiplication kernels.
+*/
+template< typename T >  // Element type of the Krylov basis
+KrylovReal<T> krylovEigenOrthogonalize( const DynamicMatrix<T,columnMajor>& V, size_t k,
+                                        DynamicVector<T,columnVector>& f,
+                                        DynamicVector<T,columnVector>& h )
+{
+   const auto Vk( submatrix( V, 0UL, 0UL, V.rows(), k ) );
+
+   h = ctrans( Vk ) * f;
+   f -= Vk * h;
+
+   const DynamicVector<T,columnVector> c( ctrans( Vk ) * f );
+   f -= Vk * c;
+   h += c;
+
+   return norm( f );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Expands the Krylov basis by means of the Arnoldi process.
+// \ingroup eigensolvers
+//
+// \param A The operator.
+// \param V The Krylov basis with \a m+1 columns.
+// \param H The \f$ (m+1) \times m \f$ projected matrix.
+// \param k The current number of columns of the Krylov basis.
+// \param m The dimension of the Krylov subspace.
+// \return void
+//
+// This function extends the Arnoldi relation \f$ A V_k = V_{k+1} H_k \f$ to \f$ A V_m =
+// V_{m+1} H_m \f$. In case the Krylov subspace becomes invariant, the basis is continued with
+// an orthogonalized pseudo-random vector and the according subdiagonal element is set to zero.
+*/
+template< typename Op  // Type of the operator
+        , typename T > // Element type of the Krylov basis
+void krylovEigenExpand( const Op& A, DynamicMatrix<T,columnMajor>& V,
+                        DynamicMatrix<T,columnMajor>& H, size_t k, size_t m )
+{
+   using RT = KrylovReal<T>;
+
+   const size_t n( V.rows() );
+
+   DynamicVector<T,columnVector> x( n ), f( n ), h;
+
+   for( size_t j=k; j<m; ++j )
+   {
+      x = column( V, j );
+      applyKrylovOperator( A, f, x );
+
+      const RT fnorm( norm( f ) );
+      RT beta( krylovEigenOrthogonalize( V, j+1UL, f, h ) );
+
+      for( size_t i=0UL; i<=j; ++i ) {
+         H(i,j) = h[i];
+      }
+
+      if( beta > RT(8) * std::numeric_limits<RT>::epsilon() * fnorm ) {
+         H(j+1UL,j) = beta;
+         column( V, j+1UL ) = f * ( RT(1) / beta );
+         continue;
+      }
+
+      H(j+1UL,j) = T(0);
+
+      if( j+1UL < n ) {
+         krylovEigenRandom( V, j+1UL );
+         x = column( V, j+1UL );
+         beta = krylovEigenOrthogonalize( V, j+1UL, x, h );
+         column( V, j+1UL ) = x * ( RT(1) / beta );
+      }
+      else {
+         reset( column( V, j+1UL ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Restarts the Arnoldi relation with the given orthonormal subspace.
+// \ingroup eigensolvers
+//
+// \param V The Krylov basis with \a m+1 columns.
+// \param H The \f$ (m+1) \times m \f$ projected matrix.
+// \param Q The orthonormal \f$ m \times k \f$ basis of the retained subspace.
+// \return void
+//
+// This function compresses the Arnoldi relation \f$ A V_m = V_m H_m + \beta v_{m+1} e_m^T \f$
+// to \f$ A (V_m Q) = (V_m Q) (Q^H H_m Q) + v_{m+1} \beta e_m^T Q \f$. The new basis
+// \f$ V_m Q \f$ is computed by the dense matrix multiplication kernels. The leading
+// \f$ k \times k \f$ block of the new projected matrix is reset and has to be set by the caller.
+*/
+template< typename T >  // Element type of the Krylov basis
+void krylovEigenRestart( DynamicMatrix<T,columnMajor>& V, DynamicMatrix<T,columnMajor>& H,
+                         const DynamicMatrix<T,columnMajor>& Q )
+{
+   const size_t n( V.rows()    );
+   const size_t m( Q.rows()    );
+   const size_t k( Q.columns() );
+
+   const T beta( H(m,m-1UL) );
+
+   const DynamicMatrix<T,columnMajor> W( submatrix( V, 0UL, 0UL, n, m ) * Q );
+   submatrix( V, 0UL, 0UL, n, k ) = W;
+   column( V, k ) = column( V, m );
+
+   reset( H );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      H(k,i) = beta * Q(m-1UL,i);
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PROJECTED EIGENVALUE PROBLEM
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the eigenvalues and eigenvectors of a projected complex Hermitian matrix.
+// \ingroup eigensolvers
+*/
+template< typename T >  // Element type of the matrix
+inline EnableIf_< IsComplex<T> >
+   krylovEigenHermitian( DynamicMatrix<T,columnMajor>& A, DynamicVector<KrylovReal<T>,columnVector>& w )
+{
+   heevd( A, w, 'V', 'L' );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the eigenvalues and eigenvectors of a projected real symmetric matrix.
+// \ingroup eigensolvers
+*/
+template< typename T >  // Element type of the matrix
+inline DisableIf_< IsComplex<T> >
+   krylovEigenHermitian( DynamicMatrix<T,columnMajor>& A, DynamicVector<KrylovReal<T>,columnVector>& w )
+{
+   syevd( A, w, 'V', 'L' );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sorts the eigenvalues of the projected matrix according to the selected spectrum.
+// \ingroup eigensolvers
+//
+// \param theta The eigenvalues of the projected matrix.
+// \param spectrum The selected part of the spectrum.
+// \return The indices of the eigenvalues in the order of the selection.
+//
+// Complex conjugate eigenvalues are ordered by descending imaginary part.
+*/
+template< typename T >  // Type of the eigenvalues
+std::vector<size_t> krylovEigenOrder( const DynamicVector<T,columnVector>& theta, EigenSpectrum spectrum )
+{
+   std::vector<size_t> order( theta.size() );
+
+   for( size_t i=0UL; i<theta.size(); ++i ) {
+      order[i] = i;
+   }
+
+   std::stable_sort( order.begin(), order.end(), [&theta,spectrum]( size_t i, size_t j )
+   {
+      const auto ki( ( spectrum == largestMagnitude )?( std::abs( theta[i] ) ):( real( theta[i] ) ) );
+      const auto kj( ( spectrum == largestMagnitude )?( std::abs( theta[j] ) ):( real( theta[j] ) ) );
+
+      if( ki != kj ) {
+         return ( spectrum == smallestReal )?( ki < kj ):( ki > kj );
+      }
+
+      return imag( theta[i] ) > imag( theta[j] );
+   } );
+
+   return order;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the largest relative residual of the wanted Ritz pairs.
+// \ingroup eigensolvers
+//
+// \param beta The norm of the residual vector of the Arnoldi relation.
+// \param Y The eigenvectors of the projected matrix.
+// \param theta The eigenvalues of the projected matrix.
+// \param order The indices of the eigenvalues in the order of the selection.
+// \param nev The number of wanted eigenvalues.
+// \return The largest relative residual \f$ \beta |e_m^T y_i| / |\theta_i| \f$.
+//
+// The norm of the residual \f$ A x_i - \theta_i x_i \f$ of the Ritz pair \f$ (\theta_i, x_i =
+// V_m y_i) \f$ is given by \f$ \beta |e_m^T y_i| \f$. In order to avoid a division by zero, the
+// magnitude of the Ritz value is bounded from below by \f$ \epsilon^{2/3} \f$.
+*/
+template< typename RT    // Real type of the residual
+        , typename MT    // Type of the eigenvectors
+        , typename VT >  // Type of the eigenvalues
+RT krylovEigenResidual( RT beta, const MT& Y, const VT& theta, const std::vector<size_t>& order, size_t nev )
+{
+   const RT eps23( std::pow( std::numeric_limits<RT>::epsilon(), RT(2)/RT(3) ) );
+   const size_t m( Y.rows() );
+
+   RT residual( 0 );
+
+   for( size_t i=0UL; i<nev; ++i ) {
+      const size_t j( order[i] );
+      residual = max( residual, RT( beta * std::abs( Y(m-1UL,j) ) / max( eps23, RT( std::abs( theta[j] ) ) ) ) );
+   }
+
+   return residual;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of Ritz vectors retained by a thick restart.
+// \ingroup eigensolvers
+//
+// \param m The dimension of the Krylov subspace.
+// \param nev The number of wanted eigenvalues.
+// \return The number of retained Ritz vectors.
+*/
+inline size_t krylovEigenRestartSize( size_t m, size_t nev )
+{
+   return min( nev + ( m - min( m, nev ) ) / 2UL, m-1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transforms an eigenvalue of an operator to an eigenvalue of the matrix.
+// \ingroup eigensolvers
+*/
+template< typename Op  // Type of the operator
+        , typename T > // Type of the eigenvalue
+inline T krylovEigenTransform( const Op& A, T theta )
+{
+   UNUSED_PARAMETER( A );
+
+   return theta;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transforms an eigenvalue of a shift-invert operator to an eigenvalue of the matrix.
+// \ingroup eigensolvers
+//
+// The eigenvalue \f$ \theta \f$ of \f$ (A - \sigma I)^{-1} \f$ is transformed to the eigenvalue
+// \f$ \lambda = \sigma + 1/\theta \f$ of \a A.
+*/
+template< typename S   // Type of the shift
+        , typename ST  // Type of the solver
+        , typename T > // Type of the eigenvalue
+inline T krylovEigenTransform( const ShiftInvert<S,ST>& A, T theta )
+{
+   return T( A.shift() ) + T(1) / theta;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
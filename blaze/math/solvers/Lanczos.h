@@ -0,0 +1,215 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Lanczos.h
+//  \brief Header file for the thick-restart Lanczos eigenvalue solver
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_LANCZOS_H_
+#define _BLAZE_MATH_SOLVERS_LANCZOS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/solvers/EigenSpectrum.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/KrylovEigen.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  LANCZOS METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Lanczos functions */
+//@{
+template< typename Op, typename VT, typename MT, bool SO >
+void lanczos( const Op& A, DenseVector<VT,false>& w, DenseMatrix<MT,SO>& V, size_t nev,
+              SolverControl& control, EigenSpectrum spectrum = largestMagnitude, size_t ncv = 0UL );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a few eigenvalues and eigenvectors of a symmetric matrix by means of the
+//        thick-restart Lanczos method.
+// \ingroup eigensolvers
+//
+// \param A The symmetric (Hermitian) matrix or operator.
+// \param w The resulting vector of eigenvalues.
+// \param V The starting vector (first column) on entry, the matrix of eigenvectors on exit.
+// \param nev The number of requested eigenvalues.
+// \param control The convergence control.
+// \param spectrum The selected part of the spectrum (default: \a largestMagnitude).
+// \param ncv The dimension of the Krylov subspace (default: 0 for \f$ \min(n,\max(2nev+1,nev+20)) \f$).
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid starting vector provided.
+// \exception std::invalid_argument Invalid number of eigenvalues.
+// \exception std::invalid_argument Invalid subspace dimension.
+// \exception std::invalid_argument Vector cannot be resized.
+// \exception std::invalid_argument Matrix cannot be resized.
+//
+// This function computes \a nev eigenvalues and the according eigenvectors of the symmetric
+// (or Hermitian) matrix \a A by means of the thick-restart Lanczos method. \a A can be any
+// dense or sparse matrix (including adaptors, views, and matrix expressions), a shift-invert
+// operator (see ShiftInvert), or a matrix-free operator, i.e. any callable that can be called as
+// \c A(y,x) with two dense column vectors and that computes \f$ y = A*x \f$. In case of a
+// matrix-free operator, the size of the problem is given by the number of rows of \a V:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> w;
+   blaze::DynamicMatrix<double,blaze::columnMajor> V;
+   // ... Resizing and initialization
+
+   blaze::SolverControl control( 100UL, 1E-10 );
+
+   // Computing the 5 largest eigenvalues of A
+   lanczos( A, w, V, 5UL, control, blaze::largestReal );
+
+   // Computing the 5 smallest eigenvalues of the matrix-free operator
+   auto op = [&A]( auto& y, const auto& x ) { y = A * x; };
+   V.resize( A.rows(), 1UL );
+   V = 1.0;
+   lanczos( op, w, V, 5UL, control, blaze::smallestReal );
+   \endcode
+
+// On exit, \a w contains the \a nev selected eigenvalues and the columns of \a V contain the
+// according orthonormal eigenvectors. Both are ordered according to the selected \a spectrum,
+// i.e. by descending magnitude, descending value, or ascending value. In case of a shift-invert
+// operator, the eigenvalues of \f$ (A - \sigma I)^{-1} \f$ are transformed back to eigenvalues
+// of \a A, i.e. the largest magnitudes select the eigenvalues of \a A closest to the shift.
+//
+// In case the first column of \a V is a non-zero vector of the right size, it is used as
+// starting vector. Otherwise a deterministic pseudo-random starting vector is used. The
+// iteration stops as soon as the largest relative residual \f$ \|A x_i - \lambda_i x_i\| /
+// |\lambda_i| \f$ of the wanted eigenpairs satisfies the stopping criterion of the given
+// SolverControl or the maximum number of restarts has been performed. On exit the SolverControl
+// object contains the number of performed restart cycles, the final residual, and whether or not
+// the iteration converged. Note that the function does not throw an exception in case of a
+// failed convergence.
+//
+// Every cycle extends the Krylov basis to \a ncv vectors, computes the eigenpairs of the
+// projected tridiagonal matrix by means of LAPACK, and restarts with the best half of the
+// unwanted and all wanted Ritz vectors (thick restart). The basis is fully reorthogonalized in
+// every step by two passes of the classical Gram-Schmidt process, which is performed by the
+// dense matrix/dense vector multiplication kernels, and the restart basis is computed by a dense
+// matrix multiplication. Thus the function requires \f$ n \cdot (ncv+1) \f$ elements of memory.
+//
+// \note This function can only be used if a fitting LAPACK library is available and linked to
+// the executable. Otherwise a linker error will be created.
+*/
+template< typename Op    // Type of the operator
+        , typename VT    // Type of the eigenvalue vector
+        , typename MT    // Type of the eigenvector matrix
+        , bool SO >      // Storage order of the eigenvector matrix
+void lanczos( const Op& A, DenseVector<VT,false>& w, DenseMatrix<MT,SO>& V, size_t nev,
+              SolverControl& control, EigenSpectrum spectrum, size_t ncv )
+{
+   using ET = ElementType_<MT>;
+   using RT = KrylovReal<ET>;
+
+   const size_t n( krylovEigenSize( A, ~V ) );
+   const size_t m( krylovEigenSubspace( n, nev, ncv ) );
+
+   DynamicMatrix<ET,columnMajor> B( n, m+1UL );
+   DynamicMatrix<ET,columnMajor> H( m+1UL, m, ET(0) );
+   DynamicMatrix<ET,columnMajor> Y, Q;
+   DynamicVector<RT,columnVector> theta;
+   std::vector<size_t> order;
+
+   krylovEigenStart( B, ~V );
+
+   control.start( 1.0, std::numeric_limits<double>::infinity() );
+
+   for( size_t k=0UL, cycle=0UL; ; )
+   {
+      krylovEigenExpand( A, B, H, k, m );
+
+      Y = submatrix( H, 0UL, 0UL, m, m );
+      theta.resize( m, false );
+      krylovEigenHermitian( Y, theta );
+      order = krylovEigenOrder( theta, spectrum );
+
+      const RT residual( krylovEigenResidual( RT( std::abs( H(m,m-1UL) ) ), Y, theta, order, nev ) );
+
+      if( control.check( ++cycle, residual ) || control.exhausted( cycle ) ) {
+         break;
+      }
+
+      k = krylovEigenRestartSize( m, nev );
+
+      Q.resize( m, k, false );
+      for( size_t i=0UL; i<k; ++i ) {
+         column( Q, i ) = column( Y, order[i] );
+      }
+
+      krylovEigenRestart( B, H, Q );
+
+      for( size_t i=0UL; i<k; ++i ) {
+         H(i,i) = theta[order[i]];
+      }
+   }
+
+   resize( ~w, nev, false );
+   Q.resize( m, nev, false );
+
+   for( size_t i=0UL; i<nev; ++i ) {
+      (~w)[i] = krylovEigenTransform( A, theta[order[i]] );
+      column( Q, i ) = column( Y, order[i] );
+   }
+
+   resize( ~V, n, nev, false );
+   (~V) = submatrix( B, 0UL, 0UL, n, m ) * Q;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,274 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/MINRES.h
+//  \brief Header file for the minimal residual method
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_MINRES_H_
+#define _BLAZE_MATH_SOLVERS_MINRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/Operator.h>
+#include <blaze/math/solvers/SolverControl.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MINIMAL RESIDUAL METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name MINRES functions */
+//@{
+template< typename Op, typename VT1, typename VT2 >
+void minres( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+             SolverControl& control );
+
+template< typename Op, typename VT1, typename VT2, typename PC >
+void minres( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+             SolverControl& control, const PC& M );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a symmetric (possibly indefinite) linear system by means of the MINRES method.
+// \ingroup krylov
+//
+// \param A The symmetric (Hermitian) system matrix or system operator.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \param control The convergence control.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function approximates the solution of the linear system \f$ A*x=b \f$ by means of the
+// minimal residual (MINRES) method of Paige and Saunders. The system matrix \a A must be
+// symmetric (or Hermitian), but in contrast to the cg() function it may be indefinite. \a A can
+// be any dense or sparse matrix (including adaptors, views, and matrix expressions) or a
+// matrix-free operator, i.e. any callable that can be called as \c A(y,x) with two dense column
+// vectors and that computes \f$ y = A*x \f$:
+
+   \code
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double> > A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverControl control( 1000UL, 1E-10 );
+
+   minres( A, x, b, control );
+   \endcode
+
+// In case the size of \a x does not match the size of \a b, \a x is resized and reset to zero.
+// Otherwise the given values are used as initial guess. The iteration stops as soon as the
+// residual norm estimate of the method satisfies the stopping criterion of the given SolverControl
+// or the maximum number of iterations has been performed. On exit the SolverControl object
+// contains the number of performed iterations, the final residual norm estimate, and whether
+// or not the iteration converged. Note that the function does not throw an exception in case
+// of a failed convergence.
+//
+// Every iteration performs a single application of the system operator and three passes over
+// the vectors besides the product with the system operator: the normalization of the Lanczos
+// vector, the combined three-term recurrence including the computation of the Lanczos
+// coefficient and the norm of the new Lanczos vector, and the combined update of the search
+// direction and the solution. In case the size of the system exceeds the
+// \a BLAZE_SMP_SOLVER_THRESHOLD and SMP is enabled, all vector kernels are executed in parallel.
+*/
+template< typename Op    // Type of the system operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2 > // Type of the right-hand side vector
+void minres( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+             SolverControl& control )
+{
+   minres( A, x, b, control, IdentityPreconditioner() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves a symmetric (possibly indefinite) linear system by means of the preconditioned
+//        MINRES method.
+// \ingroup krylov
+//
+// \param A The symmetric (Hermitian) system matrix or system operator.
+// \param x The initial guess on entry, the approximate solution on exit.
+// \param b The right-hand side vector.
+// \param control The convergence control.
+// \param M The symmetric (Hermitian) positive definite preconditioner.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// This function approximates the solution of the linear system \f$ A*x=b \f$ by means of the
+// preconditioned MINRES method. The system matrix \a A must be symmetric (or Hermitian) and can
+// be any dense or sparse matrix or a matrix-free operator (see the documentation of the
+// unpreconditioned minres() function). The preconditioner \a M must be symmetric (or Hermitian)
+// and positive definite. It can be any callable that can be called as \c M(z,r) with two dense
+// column vectors and that computes \f$ z = M^{-1} r \f$ (see IdentityPreconditioner).
+//
+// Note that the preconditioned MINRES method minimizes the residual in the norm induced by
+// \f$ M^{-1} \f$. Therefore both the residual norm estimate and the reference norm of the
+// stopping criterion are computed in this norm, i.e. the stopping criterion reads
+// \f$ \|r_k\|_{M^{-1}} \leq \max(tol \cdot \|b\|_{M^{-1}}, atol) \f$. In case the preconditioner
+// turns out to be indefinite, the iteration stops without convergence.
+*/
+template< typename Op    // Type of the system operator
+        , typename VT1   // Type of the solution vector
+        , typename VT2   // Type of the right-hand side vector
+        , typename PC >  // Type of the preconditioner
+void minres( const Op& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+             SolverControl& control, const PC& M )
+{
+   using std::sqrt;
+   using std::swap;
+
+   using ET = ElementType_<VT1>;
+   using RT = KrylovReal<ET>;
+
+   const size_t n( (~b).size() );
+
+   checkKrylovOperator( A, n );
+   initKrylovSolution( ~x, n );
+
+   DynamicVector<ET,columnVector> xk( ~x );
+   DynamicVector<ET,columnVector> r1( n );
+   DynamicVector<ET,columnVector> r2( n );
+   DynamicVector<ET,columnVector> y ( n );
+   DynamicVector<ET,columnVector> v ( n );
+   DynamicVector<ET,columnVector> w ( n, ET() );
+   DynamicVector<ET,columnVector> w1( n, ET() );
+   DynamicVector<ET,columnVector> w2( n, ET() );
+   DynamicVector<ET,columnVector> z ( IsSame<PC,IdentityPreconditioner>::value ? 0UL : n );
+
+   // Computation of the reference norm in the norm induced by the preconditioner
+   y = ~b;
+   const DynamicVector<ET,columnVector>* zp( &applyKrylovPreconditioner( M, z, y ) );
+   const RT bb( ( zp == &y )?( sqrNorm( y ) ):( real( krylovDot( y, *zp ) ) ) );
+
+   // Computation of the initial residual
+   applyKrylovOperator( A, y, xk );
+   r1 = (~b) - y;
+   r2 = r1;
+
+   zp = &applyKrylovPreconditioner( M, z, r2 );
+   const RT beta1( ( zp == &r2 )?( sqrNorm( r2 ) ):( real( krylovDot( r2, *zp ) ) ) );
+
+   if( control.start( sqrt( bb ), sqrt( beta1 ) ) || !( beta1 > RT() ) ) {
+      return;
+   }
+
+   const RT eps( std::numeric_limits<RT>::epsilon() );
+
+   RT beta  ( sqrt( beta1 ) );
+   RT oldb  ( 0 );
+   RT dbar  ( 0 );
+   RT epsln ( 0 );
+   RT phibar( beta );
+   RT cs    ( -1 );
+   RT sn    ( 0 );
+
+   for( size_t k=0UL; !control.exhausted( k ); )
+   {
+      // Lanczos step
+      v = ( RT(1) / beta ) * (*zp);
+      applyKrylovOperator( A, y, v );
+
+      const RT alpha( real( krylovSubDot( y, y, r1, v, ET( ( k == 0UL )?( RT() ):( beta / oldb ) ) ) ) );
+      const RT yy( krylovSubNorm( y, y, r2, ET( alpha / beta ) ) );
+
+      swap( r1, r2 );
+      swap( r2, y  );
+
+      zp = &applyKrylovPreconditioner( M, z, r2 );
+      const RT beta2( ( zp == &r2 )?( yy ):( real( krylovDot( r2, *zp ) ) ) );
+
+      if( beta2 < RT() ) {
+         break;
+      }
+
+      oldb = beta;
+      beta = sqrt( beta2 );
+
+      // Application of the previous rotation and computation of the new rotation
+      const RT oldeps( epsln );
+      const RT delta ( cs * dbar + sn * alpha );
+      const RT gbar  ( sn * dbar - cs * alpha );
+
+      epsln = sn * beta;
+      dbar  = -cs * beta;
+
+      RT gamma( sqrt( gbar*gbar + beta*beta ) );
+      gamma = ( gamma > eps )?( gamma ):( eps );
+
+      cs = gbar / gamma;
+      sn = beta / gamma;
+
+      const RT phi( cs * phibar );
+      phibar *= sn;
+
+      // Update of the search direction and the solution
+      swap( w1, w2 );
+      swap( w2, w  );
+      krylovMinresUpdate( w, xk, v, w1, w2, ET( oldeps ), ET( delta ), ET( RT(1) / gamma ), ET( phi ) );
+
+      if( control.check( ++k, phibar ) || beta == RT() ) {
+         break;
+      }
+   }
+
+   ~x = xk;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,243 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Operator.h
+//  \brief Header file for the system operator and preconditioner functions of the iterative solvers
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_OPERATOR_H_
+#define _BLAZE_MATH_SOLVERS_OPERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/solvers/IdentityPreconditioner.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SYSTEM OPERATOR FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the system matrix of an iterative solver.
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param n The size of the right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+*/
+template< typename Op >  // Type of the system operator
+inline EnableIf_< IsMatrix<Op> > checkKrylovOperator( const Op& A, size_t n )
+{
+   if( !isSquare( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( A.rows() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the matrix-free system operator of an iterative solver.
+// \ingroup solvers
+//
+// \param A The system operator.
+// \param n The size of the right-hand side vector.
+// \return void
+//
+// Since the size of a matrix-free system operator is unknown, the operator is assumed to match
+// the size of the right-hand side vector.
+*/
+template< typename Op >  // Type of the system operator
+inline DisableIf_< IsMatrix<Op> > checkKrylovOperator( const Op& A, size_t n )
+{
+   UNUSED_PARAMETER( A, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the system matrix of an iterative solver (\f$ y = A x \f$).
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param y The result vector.
+// \param x The vector to be multiplied.
+// \return void
+*/
+template< typename Op    // Type of the system operator
+        , typename T >   // Element type of the vectors
+inline EnableIf_< IsMatrix<Op> >
+   applyKrylovOperator( const Op& A, DynamicVector<T,columnVector>& y,
+                        const DynamicVector<T,columnVector>& x )
+{
+   y = A * x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the matrix-free system operator of an iterative solver (\f$ y = A x \f$).
+// \ingroup solvers
+//
+// \param A The system operator.
+// \param y The result vector.
+// \param x The vector to be multiplied.
+// \return void
+*/
+template< typename Op    // Type of the system operator
+        , typename T >   // Element type of the vectors
+inline DisableIf_< IsMatrix<Op> >
+   applyKrylovOperator( const Op& A, DynamicVector<T,columnVector>& y,
+                        const DynamicVector<T,columnVector>& x )
+{
+   A( y, x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PRECONDITIONER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the preconditioner of an iterative solver (\f$ z = M^{-1} r \f$).
+// \ingroup solvers
+//
+// \param M The preconditioner.
+// \param z The result vector.
+// \param r The vector to be preconditioned.
+// \return Reference to the preconditioned vector \a z.
+*/
+template< typename PC    // Type of the preconditioner
+        , typename T >   // Element type of the vectors
+inline const DynamicVector<T,columnVector>&
+   applyKrylovPreconditioner( const PC& M, DynamicVector<T,columnVector>& z,
+                              const DynamicVector<T,columnVector>& r )
+{
+   M( z, r );
+   return z;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the identity preconditioner of an iterative solver.
+// \ingroup solvers
+//
+// \param M The identity preconditioner.
+// \param z The result vector.
+// \param r The vector to be preconditioned.
+// \return Reference to the unmodified vector \a r.
+*/
+template< typename T >  // Element type of the vectors
+inline const DynamicVector<T,columnVector>&
+   applyKrylovPreconditioner( const IdentityPreconditioner& M, DynamicVector<T,columnVector>& z,
+                              const DynamicVector<T,columnVector>& r )
+{
+   UNUSED_PARAMETER( M, z );
+   return r;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLUTION VECTOR FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initializes the solution vector of an iterative solver.
+// \ingroup solvers
+//
+// \param x The solution vector.
+// \param n The size of the linear system.
+// \return void
+// \exception std::invalid_argument Vector cannot be resized.
+//
+// In case the size of the given solution vector does not match the size of the linear system,
+// the vector is resized and reset to zero. Otherwise the current values of the vector are used
+// as initial guess.
+*/
+template< typename VT >  // Type of the solution vector
+inline void initKrylovSolution( DenseVector<VT,false>& x, size_t n )
+{
+   if( (~x).size() != n ) {
+      resize( ~x, n, false );
+      reset( ~x );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,237 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SSORPreconditioner.h
+//  \brief Header file for the SSOR preconditioner
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SSORPRECONDITIONER_H_
+#define _BLAZE_MATH_SOLVERS_SSORPRECONDITIONER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/solvers/SparseTriangular.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symmetric successive over-relaxation (SSOR) preconditioner of the iterative solvers.
+// \ingroup preconditioners
+//
+// The SSORPreconditioner class represents the SSOR preconditioner
+
+      \f[ M = \frac{\omega}{2-\omega} \left( \frac{D}{\omega} + L \right)
+              \left( \frac{D}{\omega} \right)^{-1} \left( \frac{D}{\omega} + U \right), \f]
+
+// where \a D, \a L, and \a U denote the diagonal, the strictly lower, and the strictly upper part
+// of the system matrix and \f$ \omega \in (0,2) \f$ is the relaxation parameter. In contrast to
+// the incomplete factorizations the SSOR preconditioner requires no setup besides a copy of the
+// system matrix and cannot break down for matrices with non-zero diagonal elements. For
+// symmetric (Hermitian) positive definite matrices the preconditioner is symmetric (Hermitian)
+// positive definite as well:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverControl control;
+   blaze::SSORPreconditioner<double> M( A, 1.2 );
+   cg( A, x, b, control, M );
+   \endcode
+
+// Both triangular substitutions are level scheduled: In case the number of non-zero elements
+// within a level exceeds the \a BLAZE_SMP_SMATTRSV_THRESHOLD and SMP is enabled, all rows of a
+// level are processed in parallel.
+*/
+template< typename Type >  // Data type of the preconditioner
+class SSORPreconditioner
+{
+ public:
+   //**Type definitions****************************************************************************
+   using RelaxationType = UnderlyingBuiltin_<Type>;  //!< Type of the relaxation parameter.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   template< typename MT, bool SO >
+   explicit inline SSORPreconditioner( const Matrix<MT,SO>& A, RelaxationType omega = RelaxationType(1) );
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   inline RelaxationType relaxation() const noexcept;
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   template< typename VT1, typename VT2 >
+   inline void operator()( DenseVector<VT1,false>& z, const DenseVector<VT2,false>& r ) const;
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   RelaxationType omega_;              //!< The relaxation parameter.
+   CompressedMatrix<Type,rowMajor> A_;  //!< The system matrix.
+   std::vector<size_t> diag_;          //!< The positions of the diagonal elements.
+   std::vector<Type> inv_;             //!< The scaled inverse diagonal elements \f$ \omega/d_i \f$.
+   std::vector<Type> scale_;           //!< The scaled diagonal elements \f$ (2-\omega) d_i/\omega^2 \f$.
+   LevelSchedule lower_;               //!< The level schedule of the lower part.
+   LevelSchedule upper_;               //!< The level schedule of the upper part.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the SSOR preconditioner of the given system matrix.
+//
+// \param A The square system matrix.
+// \param omega The relaxation parameter \f$ \omega \in (0,2) \f$.
+// \exception std::invalid_argument Invalid relaxation parameter.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with missing diagonal element.
+// \exception std::invalid_argument Invalid matrix with zero diagonal element.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline SSORPreconditioner<Type>::SSORPreconditioner( const Matrix<MT,SO>& A, RelaxationType omega )
+   : omega_( omega )                 // The relaxation parameter
+   , A_    ( ~A )                    // The system matrix
+   , diag_ ( sparseDiagonal( A_ ) )  // The positions of the diagonal elements
+   , inv_  ( A_.rows() )             // The scaled inverse diagonal elements
+   , scale_( A_.rows() )             // The scaled diagonal elements
+   , lower_( A_, true  )             // The level schedule of the lower part
+   , upper_( A_, false )             // The level schedule of the upper part
+{
+   if( !( omega > RelaxationType(0) ) || !( omega < RelaxationType(2) ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid relaxation parameter" );
+   }
+
+   for( size_t i=0UL; i<A_.rows(); ++i )
+   {
+      const Type d( A_.begin(i)[diag_[i]].value() );
+
+      if( isDefault( d ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix with zero diagonal element" );
+      }
+
+      inv_[i]   = omega / d;
+      scale_[i] = ( ( RelaxationType(2) - omega ) / ( omega * omega ) ) * d;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the relaxation parameter of the preconditioner.
+//
+// \return The relaxation parameter \f$ \omega \f$.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline typename SSORPreconditioner<Type>::RelaxationType
+   SSORPreconditioner<Type>::relaxation() const noexcept
+{
+   return omega_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the SSOR preconditioner to the given vector.
+//
+// \param z The result vector.
+// \param r The vector to be preconditioned.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename VT1     // Type of the result vector
+        , typename VT2 >   // Type of the vector to be preconditioned
+inline void SSORPreconditioner<Type>::operator()( DenseVector<VT1,false>& z,
+                                                  const DenseVector<VT2,false>& r ) const
+{
+   BLAZE_INTERNAL_ASSERT( (~r).size() == A_.rows(), "Invalid vector size detected" );
+
+   ~z = ~r;
+   sparseLowerSolve( A_, diag_, inv_, lower_, ~z );
+
+   for( size_t i=0UL; i<A_.rows(); ++i ) {
+      (~z)[i] *= scale_[i];
+   }
+
+   sparseUpperSolve( A_, diag_, inv_, upper_, ~z );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
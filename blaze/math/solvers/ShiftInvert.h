@@ -0,0 +1,232 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/ShiftInvert.h
+//  \brief Header file for the shift-invert operator of the eigenvalue solvers
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SHIFTINVERT_H_
+#define _BLAZE_MATH_SOLVERS_SHIFTINVERT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Shift-invert operator of the iterative eigenvalue solvers.
+// \ingroup eigensolvers
+//
+// The ShiftInvert class template represents the operator \f$ (A - \sigma I)^{-1} \f$ for a given
+// shift \f$ \sigma \f$. The operator is applied by means of a solver for the shifted system,
+// which is supplied by the user. The solver can be any object that provides a \c rows() and a
+// \c solve(x,b) member function, as for instance the sparse direct solvers (SparseLLH and
+// SparseLDLH):
+
+   \code
+   blaze::CompressedMatrix<double> A, S;
+   blaze::DynamicVector<double> w;
+   blaze::DynamicMatrix<double,blaze::columnMajor> V;
+   // ... Resizing and initialization
+
+   const double sigma( 0.5 );
+   S = A - sigma * blaze::IdentityMatrix<double>( A.rows() );
+
+   const blaze::SparseLDLH<double> solver( S );
+   blaze::SolverControl control( 100UL, 1E-10 );
+
+   // Computing the 10 eigenvalues of A closest to 0.5
+   lanczos( shiftInvert( solver, sigma ), w, V, 10UL, control );
+   \endcode
+
+// The eigenvalue solvers compute the eigenvalues \f$ \theta \f$ of the shift-invert operator
+// and return the according eigenvalues \f$ \lambda = \sigma + 1/\theta \f$ of \a A. Since the
+// eigenvalues of \a A closest to the shift are the eigenvalues of largest magnitude of the
+// shift-invert operator, these eigenvalues are computed with the \a largestMagnitude selection
+// (see the EigenSpectrum flags) and typically converge within very few restarts. The shift-invert
+// operator only stores a reference to the solver, i.e. the solver must outlive the operator.
+*/
+template< typename Type  // Type of the shift
+        , typename ST >  // Type of the solver
+class ShiftInvert
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Type of the shift.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   explicit inline ShiftInvert( const ST& solver, Type shift );
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   inline size_t rows () const;
+   inline Type   shift() const noexcept;
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   template< typename VT1, typename VT2 >
+   inline void operator()( DenseVector<VT1,false>& y, const DenseVector<VT2,false>& x ) const;
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const ST& solver_;  //!< The solver for the shifted system.
+   Type shift_;        //!< The shift of the operator.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for ShiftInvert.
+//
+// \param solver The solver for the shifted system \f$ (A - \sigma I) y = x \f$.
+// \param shift The shift \f$ \sigma \f$.
+*/
+template< typename Type  // Type of the shift
+        , typename ST >  // Type of the solver
+inline ShiftInvert<Type,ST>::ShiftInvert( const ST& solver, Type shift )
+   : solver_( solver )  // The solver for the shifted system
+   , shift_ ( shift  )  // The shift of the operator
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the operator.
+//
+// \return The number of rows/columns of the shifted system.
+*/
+template< typename Type  // Type of the shift
+        , typename ST >  // Type of the solver
+inline size_t ShiftInvert<Type,ST>::rows() const
+{
+   return solver_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the shift of the operator.
+//
+// \return The shift \f$ \sigma \f$.
+*/
+template< typename Type  // Type of the shift
+        , typename ST >  // Type of the solver
+inline Type ShiftInvert<Type,ST>::shift() const noexcept
+{
+   return shift_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUNCTION CALL OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Applies the shift-invert operator (\f$ y = (A - \sigma I)^{-1} x \f$).
+//
+// \param y The resulting vector.
+// \param x The vector the operator is applied to.
+// \return void
+*/
+template< typename Type  // Type of the shift
+        , typename ST >  // Type of the solver
+template< typename VT1   // Type of the resulting vector
+        , typename VT2 > // Type of the input vector
+inline void ShiftInvert<Type,ST>::operator()( DenseVector<VT1,false>& y,
+                                              const DenseVector<VT2,false>& x ) const
+{
+   solver_.solve( ~y, ~x );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a shift-invert operator for the given solver and shift.
+// \ingroup eigensolvers
+//
+// \param solver The solver for the shifted system \f$ (A - \sigma I) y = x \f$.
+// \param shift The shift \f$ \sigma \f$.
+// \return The shift-invert operator \f$ (A - \sigma I)^{-1} \f$.
+*/
+template< typename ST      // Type of the solver
+        , typename Type >  // Type of the shift
+inline ShiftInvert<Type,ST> shiftInvert( const ST& solver, Type shift )
+{
+   return ShiftInvert<Type,ST>( solver, shift );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
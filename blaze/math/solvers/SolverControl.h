@@ -0,0 +1,385 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SolverControl.h
+//  \brief Header file for the SolverControl class
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SOLVERCONTROL_H_
+#define _BLAZE_MATH_SOLVERS_SOLVERCONTROL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Exception.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Convergence control for the iterative solvers.
+// \ingroup solvers
+//
+// The SolverControl class specifies the stopping criterion of all iterative solvers of the
+// Blaze library and records the outcome of a solve. An iterative solver stops as soon as the
+// norm of the residual satisfies
+
+                          \f[ \|r_k\| \leq \max(tol \cdot \|b\|, atol), \f]
+
+// where \f$ tol \f$ is the relative tolerance, \f$ atol \f$ the absolute tolerance, and
+// \f$ b \f$ the right-hand side of the linear system, or in case the maximum number of
+// iterations has been performed:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SolverControl control( 500UL, 1E-10 );  // At most 500 iterations, relative tolerance 1E-10
+
+   cg( A, x, b, control );
+
+   if( !control.converged() ) {
+      std::cerr << " Not converged after " << control.iterations() << " iterations,"
+                << " residual norm " << control.residual() << "\n";
+   }
+   \endcode
+
+// Note that a SolverControl object can be reused for several solves. At the beginning of every
+// solve the results of the previous solve are reset.
+*/
+class SolverControl
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SolverControl( size_t maxIterations = 1000UL,
+                                  double tolerance = 1E-8, double absTolerance = 0.0 );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t maxIterations() const noexcept;
+   inline double tolerance    () const noexcept;
+   inline double absTolerance () const noexcept;
+   inline size_t iterations   () const noexcept;
+   inline double residual     () const noexcept;
+   inline double reference    () const noexcept;
+   inline bool   converged    () const noexcept;
+
+   inline void setMaxIterations( size_t maxIterations ) noexcept;
+   inline void setTolerance    ( double tolerance );
+   inline void setAbsTolerance ( double absTolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Solver interface****************************************************************************
+   /*!\name Solver interface */
+   //@{
+   inline bool start( double reference, double residual ) noexcept;
+   inline bool check( size_t iteration, double residual ) noexcept;
+   inline bool exhausted( size_t iteration ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t maxIterations_;  //!< The maximum number of iterations.
+   double tolerance_;      //!< The relative tolerance of the residual norm.
+   double absTolerance_;   //!< The absolute tolerance of the residual norm.
+   size_t iterations_;     //!< The number of iterations of the last solve.
+   double residual_;       //!< The residual norm at the end of the last solve.
+   double reference_;      //!< The reference norm of the relative stopping criterion.
+   bool   converged_;      //!< Convergence flag of the last solve.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The constructor for SolverControl.
+//
+// \param maxIterations The maximum number of iterations.
+// \param tolerance The relative tolerance of the residual norm.
+// \param absTolerance The absolute tolerance of the residual norm.
+// \exception std::invalid_argument Invalid tolerance.
+*/
+inline SolverControl::SolverControl( size_t maxIterations, double tolerance, double absTolerance )
+   : maxIterations_( maxIterations )  // The maximum number of iterations
+   , tolerance_    ( 0.0 )            // The relative tolerance of the residual norm
+   , absTolerance_ ( 0.0 )            // The absolute tolerance of the residual norm
+   , iterations_   ( 0UL )            // The number of iterations of the last solve
+   , residual_     ( 0.0 )            // The residual norm at the end of the last solve
+   , reference_    ( 0.0 )            // The reference norm of the relative stopping criterion
+   , converged_    ( false )          // Convergence flag of the last solve
+{
+   setTolerance( tolerance );
+   setAbsTolerance( absTolerance );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of iterations.
+//
+// \return The maximum number of iterations.
+*/
+inline size_t SolverControl::maxIterations() const noexcept
+{
+   return maxIterations_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the relative tolerance of the residual norm.
+//
+// \return The relative tolerance.
+*/
+inline double SolverControl::tolerance() const noexcept
+{
+   return tolerance_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the absolute tolerance of the residual norm.
+//
+// \return The absolute tolerance.
+*/
+inline double SolverControl::absTolerance() const noexcept
+{
+   return absTolerance_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of iterations performed by the last solve.
+//
+// \return The number of iterations.
+*/
+inline size_t SolverControl::iterations() const noexcept
+{
+   return iterations_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the residual norm at the end of the last solve.
+//
+// \return The final residual norm.
+//
+// Note that depending on the solver this is either the norm of the recursively updated residual
+// or an estimate of the residual norm as provided by the solver (see the documentation of the
+// individual solvers).
+*/
+inline double SolverControl::residual() const noexcept
+{
+   return residual_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the reference norm of the relative stopping criterion of the last solve.
+//
+// \return The reference norm (usually the norm of the right-hand side).
+*/
+inline double SolverControl::reference() const noexcept
+{
+   return reference_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the last solve has converged.
+//
+// \return \a true in case the stopping criterion was satisfied, \a false if not.
+*/
+inline bool SolverControl::converged() const noexcept
+{
+   return converged_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the maximum number of iterations.
+//
+// \param maxIterations The new maximum number of iterations.
+// \return void
+*/
+inline void SolverControl::setMaxIterations( size_t maxIterations ) noexcept
+{
+   maxIterations_ = maxIterations;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the relative tolerance of the residual norm.
+//
+// \param tolerance The new relative tolerance.
+// \return void
+// \exception std::invalid_argument Invalid tolerance.
+//
+// In case the given tolerance is negative, a \a std::invalid_argument exception is thrown.
+*/
+inline void SolverControl::setTolerance( double tolerance )
+{
+   if( !( tolerance >= 0.0 ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid tolerance" );
+   }
+
+   tolerance_ = tolerance;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the absolute tolerance of the residual norm.
+//
+// \param absTolerance The new absolute tolerance.
+// \return void
+// \exception std::invalid_argument Invalid tolerance.
+//
+// In case the given tolerance is negative, a \a std::invalid_argument exception is thrown.
+*/
+inline void SolverControl::setAbsTolerance( double absTolerance )
+{
+   if( !( absTolerance >= 0.0 ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid tolerance" );
+   }
+
+   absTolerance_ = absTolerance;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOLVER INTERFACE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Starts a new solve.
+//
+// \param reference The reference norm of the relative stopping criterion.
+// \param residual The initial residual norm.
+// \return \a true in case the initial residual already satisfies the stopping criterion.
+//
+// This function is called by the iterative solvers at the beginning of every solve. It resets
+// the results of the previous solve and checks the initial residual.
+*/
+inline bool SolverControl::start( double reference, double residual ) noexcept
+{
+   reference_ = reference;
+   return check( 0UL, residual );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the residual norm of the given iteration and checks the stopping criterion.
+//
+// \param iteration The number of performed iterations.
+// \param residual The current residual norm.
+// \return \a true in case the stopping criterion is satisfied, \a false if not.
+*/
+inline bool SolverControl::check( size_t iteration, double residual ) noexcept
+{
+   iterations_ = iteration;
+   residual_   = residual;
+   converged_  = ( residual <= max( tolerance_ * reference_, absTolerance_ ) );
+
+   return converged_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given number of iterations exhausts the iteration budget.
+//
+// \param iteration The number of performed iterations.
+// \return \a true in case no further iteration may be performed, \a false if not.
+*/
+inline bool SolverControl::exhausted( size_t iteration ) const noexcept
+{
+   return iteration >= maxIterations_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,399 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SparseTriangular.h
+//  \brief Header file for the level-scheduled sparse triangular solves
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SPARSETRIANGULAR_H_
+#define _BLAZE_MATH_SOLVERS_SPARSETRIANGULAR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Level schedule of a sparse triangular matrix.
+// \ingroup preconditioners
+//
+// The LevelSchedule class partitions the rows of the lower or upper triangular part of a
+// row-major sparse matrix into levels. Every row of a level only depends on rows of previous
+// levels, i.e. the rows of a single level can be processed concurrently during a triangular
+// solve or an incomplete factorization. In case the number of non-zero elements within a level
+// is larger or equal to the \a BLAZE_SMP_SMATTRSV_THRESHOLD and SMP is enabled, the rows of the
+// level are processed in parallel. Since every row is processed exactly as in the sequential
+// algorithm, the result is independent of the number of threads.
+*/
+class LevelSchedule
+{
+ public:
+   //**Constructor*********************************************************************************
+   template< typename Type >
+   explicit inline LevelSchedule( const CompressedMatrix<Type,rowMajor>& A, bool lower );
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   inline size_t        levels() const noexcept;
+   inline const size_t* begin ( size_t level ) const noexcept;
+   inline const size_t* end   ( size_t level ) const noexcept;
+
+   template< typename Kernel > inline void run( size_t level, const Kernel& kernel ) const;
+   template< typename Kernel > inline void run( const Kernel& kernel ) const;
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   std::vector<size_t> rows_;      //!< The rows of the matrix in order of the levels.
+   std::vector<size_t> offsets_;   //!< The offsets of the levels within the rows.
+   std::vector<size_t> nonzeros_;  //!< The number of non-zero elements per level.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates the level schedule of the lower or upper triangular part of the given matrix.
+//
+// \param A The square row-major sparse matrix.
+// \param lower \a true for the lower triangular part, \a false for the upper triangular part.
+//
+// The level of a row is one larger than the maximum level of all rows it depends on, i.e. of all
+// rows \a j with a non-zero element \f$ a_{ij} \f$ in the strictly lower (upper) part of row \a i.
+// Within a level the rows are stored in ascending order.
+*/
+template< typename Type >  // Data type of the matrix
+inline LevelSchedule::LevelSchedule( const CompressedMatrix<Type,rowMajor>& A, bool lower )
+   : rows_    ( A.rows() )  // The rows of the matrix in order of the levels
+   , offsets_ ()            // The offsets of the levels within the rows
+   , nonzeros_()            // The number of non-zero elements per level
+{
+   BLAZE_INTERNAL_ASSERT( A.rows() == A.columns(), "Non-square matrix detected" );
+
+   const size_t n( A.rows() );
+
+   std::vector<size_t> level( n );
+   size_t maxlevel( 0UL );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t i( lower ? k : n-k-1UL );
+      size_t l( 0UL );
+
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( ( lower && j < i ) || ( !lower && j > i ) ) {
+            l = ( level[j] + 1UL > l )?( level[j] + 1UL ):( l );
+         }
+      }
+
+      level[i] = l;
+      maxlevel = ( l > maxlevel )?( l ):( maxlevel );
+   }
+
+   offsets_.resize( maxlevel+2UL, 0UL );
+   nonzeros_.resize( maxlevel+1UL, 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      ++offsets_[level[i]+1UL];
+      nonzeros_[level[i]] += A.nonZeros( i );
+   }
+
+   for( size_t l=1UL; l<offsets_.size(); ++l ) {
+      offsets_[l] += offsets_[l-1UL];
+   }
+
+   std::vector<size_t> pos( offsets_.begin(), offsets_.end()-1L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      rows_[pos[level[i]]++] = i;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of levels.
+//
+// \return The number of levels.
+*/
+inline size_t LevelSchedule::levels() const noexcept
+{
+   return nonzeros_.size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer to the first row of the given level.
+//
+// \param level The index of the level.
+// \return Pointer to the first row of the level.
+*/
+inline const size_t* LevelSchedule::begin( size_t level ) const noexcept
+{
+   BLAZE_USER_ASSERT( level < levels(), "Invalid level access index" );
+   return rows_.data() + offsets_[level];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer one past the last row of the given level.
+//
+// \param level The index of the level.
+// \return Pointer one past the last row of the level.
+*/
+inline const size_t* LevelSchedule::end( size_t level ) const noexcept
+{
+   BLAZE_USER_ASSERT( level < levels(), "Invalid level access index" );
+   return rows_.data() + offsets_[level+1UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Processes all rows of the given level.
+//
+// \param level The index of the level.
+// \param kernel The row kernel, called as \c kernel(i) for every row \a i of the level.
+// \return void
+*/
+template< typename Kernel >  // Type of the row kernel
+inline void LevelSchedule::run( size_t level, const Kernel& kernel ) const
+{
+   const size_t* rows( begin( level ) );
+   const size_t  size( end( level ) - rows );
+
+   if( size > 1UL && nonzeros_[level] >= SMP_SMATTRSV_THRESHOLD && getNumThreads() > 1UL &&
+       !isSerialSectionActive() && !isParallelSectionActive() )
+   {
+      smpFor( 0UL, size, [rows,&kernel]( size_t first, size_t last ) {
+         for( size_t k=first; k<last; ++k ) {
+            kernel( rows[k] );
+         }
+      } );
+   }
+   else
+   {
+      for( size_t k=0UL; k<size; ++k ) {
+         kernel( rows[k] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Processes all rows level by level.
+//
+// \param kernel The row kernel, called as \c kernel(i) for every row \a i of the matrix.
+// \return void
+*/
+template< typename Kernel >  // Type of the row kernel
+inline void LevelSchedule::run( const Kernel& kernel ) const
+{
+   for( size_t l=0UL; l<levels(); ++l ) {
+      run( l, kernel );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE TRIANGULAR FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the positions of the diagonal elements within the rows of the given matrix.
+// \ingroup preconditioners
+//
+// \param A The square row-major sparse matrix.
+// \return The offsets of the diagonal elements relative to the beginning of the rows.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid matrix with missing diagonal element.
+*/
+template< typename Type >  // Data type of the matrix
+std::vector<size_t> sparseDiagonal( const CompressedMatrix<Type,rowMajor>& A )
+{
+   if( A.rows() != A.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   std::vector<size_t> diag( A.rows() );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      const auto element( A.find( i, i ) );
+      if( element == A.end(i) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid matrix with missing diagonal element" );
+      }
+      diag[i] = element - A.begin(i);
+   }
+
+   return diag;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place forward substitution with the lower triangular part of a sparse matrix.
+// \ingroup preconditioners
+//
+// \param A The row-major sparse matrix.
+// \param diag The positions of the diagonal elements of \a A.
+// \param scale The scaling factors of the rows (empty for a unit diagonal).
+// \param schedule The lower level schedule of \a A.
+// \param z The right-hand side on entry, the solution on exit.
+// \return void
+//
+// This function computes \f$ z_i = s_i (z_i - \sum_{j<i} a_{ij} z_j) \f$ for all rows \a i,
+// where \f$ s_i \f$ is the scaling factor of row \a i (usually the inverse of the diagonal
+// element). The diagonal elements of \a A are not accessed.
+*/
+template< typename Type  // Data type of the matrix
+        , typename VT >  // Type of the vector
+void sparseLowerSolve( const CompressedMatrix<Type,rowMajor>& A, const std::vector<size_t>& diag,
+                       const std::vector<Type>& scale, const LevelSchedule& schedule, DenseVector<VT,false>& z )
+{
+   VT& y( ~z );
+   const bool unit( scale.empty() );
+
+   schedule.run( [&]( size_t i )
+   {
+      const auto last( A.begin(i) + diag[i] );
+      auto tmp( y[i] );
+      for( auto element=A.begin(i); element!=last; ++element ) {
+         tmp -= element->value() * y[element->index()];
+      }
+      y[i] = ( unit )?( tmp ):( tmp * scale[i] );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place backward substitution with the upper triangular part of a sparse matrix.
+// \ingroup preconditioners
+//
+// \param A The row-major sparse matrix.
+// \param diag The positions of the diagonal elements of \a A.
+// \param scale The scaling factors of the rows (empty for a unit diagonal).
+// \param schedule The upper level schedule of \a A.
+// \param z The right-hand side on entry, the solution on exit.
+// \return void
+//
+// This function computes \f$ z_i = s_i (z_i - \sum_{j>i} a_{ij} z_j) \f$ for all rows \a i,
+// where \f$ s_i \f$ is the scaling factor of row \a i (usually the inverse of the diagonal
+// element). The diagonal elements of \a A are not accessed.
+*/
+template< typename Type  // Data type of the matrix
+        , typename VT >  // Type of the vector
+void sparseUpperSolve( const CompressedMatrix<Type,rowMajor>& A, const std::vector<size_t>& diag,
+                       const std::vector<Type>& scale, const LevelSchedule& schedule, DenseVector<VT,false>& z )
+{
+   VT& y( ~z );
+   const bool unit( scale.empty() );
+
+   schedule.run( [&]( size_t i )
+   {
+      auto tmp( y[i] );
+      for( auto element=A.begin(i)+diag[i]+1UL; element!=A.end(i); ++element ) {
+         tmp -= element->value() * y[element->index()];
+      }
+      y[i] = ( unit )?( tmp ):( tmp * scale[i] );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,434 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/AMD.h
+//  \brief Header file for the approximate minimum degree ordering
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_AMD_H_
+#define _BLAZE_MATH_SPARSE_AMD_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  APPROXIMATE MINIMUM DEGREE ORDERING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the adjacency structure of the lower part of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The square sparse matrix.
+// \return The sorted lists of neighbours of all rows/columns (without the diagonal).
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// The adjacency structure represents the graph of the symmetric matrix that is defined by the
+// strictly lower part of \a A. The strictly upper part of \a A is not accessed.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector< std::vector<size_t> > lowerAdjacency( const SparseMatrix<MT,SO>& A )
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   std::vector< std::vector<size_t> > adj( n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( auto element=(~A).begin(k); element!=(~A).end(k); ++element ) {
+         const size_t i( SO ? element->index() : k );
+         const size_t j( SO ? k : element->index() );
+         if( i > j ) {
+            adj[i].push_back( j );
+            adj[j].push_back( i );
+         }
+      }
+   }
+
+   for( std::vector<size_t>& list : adj ) {
+      std::sort( list.begin(), list.end() );
+      list.erase( std::unique( list.begin(), list.end() ), list.end() );
+   }
+
+   return adj;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Approximate minimum degree ordering of the given graph.
+// \ingroup sparse_matrix
+//
+// \param adj The sorted adjacency lists of the graph (destroyed on exit).
+// \return The elimination order, i.e. the \a k-th pivot is the vertex \c order[k].
+//
+// This function implements the approximate minimum degree (AMD) algorithm by Amestoy, Davis,
+// and Duff on the quotient graph of the elimination. Eliminated vertices are represented by
+// elements, whose neighbourhood replaces the fill edges; the degrees of the variables are
+// approximated by the upper bound of the AMD algorithm. The implementation includes element
+// absorption, aggressive absorption, mass elimination, and the detection of indistinguishable
+// variables (supervariables) via hashing. Vertices with a degree larger than \f$ 10 \sqrt{n} \f$
+// are considered to be dense; they are removed from the graph and ordered last.
+*/
+inline std::vector<size_t> amdOrder( std::vector< std::vector<size_t> >& adj )
+{
+   enum : char { variable = 0, element = 1, absorbed = 2, merged = 3, dense = 4 };
+
+   const size_t n( adj.size() );
+   const size_t none( n );
+
+   std::vector<size_t> order;
+   order.reserve( n );
+
+   if( n == 0UL ) return order;
+
+   std::vector< std::vector<size_t> >& vars( adj );  // Adjacent variables/members of the elements
+   std::vector< std::vector<size_t> > elems( n );     // Adjacent elements of the variables
+
+   std::vector<char>   status( n, variable );
+   std::vector<size_t> nv    ( n, 1UL );   // Weight of the supervariables
+   std::vector<size_t> degree( n, 0UL );   // Approximate degree of variables, weight of elements
+   std::vector<size_t> head  ( n, none );  // Heads of the degree lists
+   std::vector<size_t> next  ( n, none );  // Successors within the degree lists
+   std::vector<size_t> prev  ( n, none );  // Predecessors within the degree lists
+   std::vector<size_t> w     ( n, 0UL );   // Time stamps for the computation of |Le\Lp|
+   std::vector<size_t> inlp  ( n, 0UL );   // Time stamps for the membership in Lp
+   std::vector<size_t> mark  ( n, 0UL );   // Time stamps for the supervariable detection
+   std::vector<size_t> hhead ( n, none );  // Heads of the hash buckets
+   std::vector<size_t> hnext ( n, none );  // Successors within the hash buckets
+   std::vector<size_t> hash  ( n, 0UL );   // Hash keys of the variables
+   std::vector<size_t> member( n, none );  // Successors within the chains of merged variables
+   std::vector<size_t> tail  ( n );        // Last variable of the chains of merged variables
+
+   const auto insert = [&]( size_t i, size_t d ) {
+      degree[i] = d;
+      prev[i] = none;
+      next[i] = head[d];
+      if( head[d] != none ) prev[head[d]] = i;
+      head[d] = i;
+   };
+
+   const auto remove = [&]( size_t i ) {
+      if( prev[i] != none ) next[prev[i]] = next[i];
+      else head[degree[i]] = next[i];
+      if( next[i] != none ) prev[next[i]] = prev[i];
+   };
+
+   const auto append = [&]( size_t i, size_t j ) {
+      member[tail[i]] = j;
+      tail[i] = tail[j];
+   };
+
+   const auto release = []( std::vector<size_t>& list ) {
+      std::vector<size_t>().swap( list );
+   };
+
+   // Removing the dense variables
+   const size_t limit( std::max( 16UL, size_t( 10.0 * std::sqrt( double( n ) ) ) ) );
+   size_t ndense( 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      tail[i] = i;
+      if( vars[i].size() > limit ) {
+         status[i] = dense;
+         ++ndense;
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( status[i] == dense ) continue;
+      if( ndense > 0UL ) {
+         vars[i].erase( std::remove_if( vars[i].begin(), vars[i].end(),
+                                        [&status]( size_t j ) { return status[j] == dense; } ),
+                        vars[i].end() );
+      }
+      insert( i, vars[i].size() );
+   }
+
+   // Elimination of the variables
+   size_t nel    ( 0UL );
+   size_t mindeg ( 0UL );
+   size_t wflg   ( 1UL );
+   size_t step   ( 0UL );
+   size_t stamp  ( 0UL );
+
+   std::vector<size_t> Lp;
+
+   while( nel < n - ndense )
+   {
+      // Selecting the pivot of minimum approximate degree
+      while( head[mindeg] == none ) ++mindeg;
+
+      const size_t p( head[mindeg] );
+      remove( p );
+      nel += nv[p];
+      ++step;
+
+      // Constructing the new element Lp as union of the adjacent variables and elements of p
+      Lp.clear();
+      size_t degme( 0UL );
+      inlp[p] = step;
+
+      const auto add = [&]( size_t i ) {
+         if( status[i] == variable && inlp[i] != step ) {
+            inlp[i] = step;
+            Lp.push_back( i );
+            degme += nv[i];
+            remove( i );
+         }
+      };
+
+      for( size_t i : vars[p] ) {
+         add( i );
+      }
+
+      for( size_t e : elems[p] ) {
+         if( status[e] != element ) continue;
+         for( size_t i : vars[e] ) {
+            add( i );
+         }
+         status[e] = absorbed;
+         release( vars[e] );
+      }
+
+      release( vars[p] );
+      release( elems[p] );
+      status[p] = element;
+
+      // Computing |Le\Lp| for all elements adjacent to the variables in Lp
+      for( size_t i : Lp ) {
+         for( size_t e : elems[i] ) {
+            if( status[e] != element ) continue;
+            if( w[e] >= wflg ) w[e] -= nv[i];
+            else w[e] = degree[e] + wflg - nv[i];
+         }
+      }
+
+      // Updating the degrees and the adjacency lists of the variables in Lp
+      for( size_t i : Lp )
+      {
+         size_t deg( 0UL );
+         size_t key( p );
+
+         std::vector<size_t>& E( elems[i] );
+         size_t k( 1UL );
+         E.push_back( p );
+         std::swap( E.front(), E.back() );
+
+         for( size_t l=1UL; l<E.size(); ++l ) {
+            const size_t e( E[l] );
+            if( status[e] != element || e == p ) continue;
+            const size_t dext( w[e] - wflg );
+            if( dext > 0UL ) {
+               deg += dext;
+               key += e;
+               E[k++] = e;
+            }
+            else {
+               status[e] = absorbed;  // Aggressive absorption: Le is a subset of Lp
+               release( vars[e] );
+            }
+         }
+         E.resize( k );
+
+         std::vector<size_t>& V( vars[i] );
+         k = 0UL;
+
+         for( size_t j : V ) {
+            if( status[j] != variable || inlp[j] == step ) continue;
+            deg += nv[j];
+            key += j;
+            V[k++] = j;
+         }
+         V.resize( k );
+
+         if( E.size() == 1UL && V.empty() ) {
+            // Mass elimination: i is indistinguishable from p
+            degme -= nv[i];
+            nel += nv[i];
+            nv[p] += nv[i];
+            nv[i] = 0UL;
+            status[i] = merged;
+            append( p, i );
+            release( elems[i] );
+            release( vars[i] );
+         }
+         else {
+            degree[i] = std::min( degree[i], deg );
+            hash[i] = key % n;
+            hnext[i] = hhead[hash[i]];
+            hhead[hash[i]] = i;
+         }
+      }
+
+      // Detecting indistinguishable variables
+      for( size_t i : Lp )
+      {
+         if( status[i] != variable || hhead[hash[i]] == none ) continue;
+
+         size_t first( hhead[hash[i]] );
+         hhead[hash[i]] = none;
+
+         for( size_t a=first; a!=none; a=hnext[a] )
+         {
+            if( status[a] != variable ) continue;
+
+            ++stamp;
+            for( size_t e : elems[a] ) mark[e] = stamp;
+            for( size_t j : vars[a] ) mark[j] = stamp;
+
+            size_t last( a );
+            for( size_t b=hnext[a]; b!=none; b=hnext[b] )
+            {
+               bool equal( status[b] == variable &&
+                           elems[b].size() == elems[a].size() && vars[b].size() == vars[a].size() );
+
+               for( size_t l=0UL; equal && l<elems[b].size(); ++l ) {
+                  equal = ( mark[elems[b][l]] == stamp );
+               }
+               for( size_t l=0UL; equal && l<vars[b].size(); ++l ) {
+                  equal = ( mark[vars[b][l]] == stamp );
+               }
+
+               if( equal ) {
+                  nv[a] += nv[b];
+                  nv[b] = 0UL;
+                  status[b] = merged;
+                  append( a, b );
+                  release( elems[b] );
+                  release( vars[b] );
+                  hnext[last] = hnext[b];
+               }
+               else {
+                  last = b;
+               }
+            }
+         }
+      }
+
+      // Finalizing the degrees and storing the new element
+      size_t k( 0UL );
+
+      for( size_t i : Lp ) {
+         if( status[i] != variable ) continue;
+         const size_t remaining( n - ndense - nel - nv[i] );
+         const size_t d( std::min( degree[i] + degme - nv[i], remaining ) );
+         insert( i, d );
+         mindeg = std::min( mindeg, d );
+         Lp[k++] = i;
+      }
+      Lp.resize( k );
+
+      degree[p] = degme;
+      if( Lp.empty() ) {
+         status[p] = absorbed;
+      }
+      else {
+         vars[p] = Lp;
+      }
+
+      for( size_t i=p; i!=none; i=member[i] ) {
+         order.push_back( i );
+      }
+
+      wflg += n + 1UL;
+   }
+
+   // Ordering the dense variables last
+   for( size_t i=0UL; i<n; ++i ) {
+      if( status[i] == dense ) order.push_back( i );
+   }
+
+   BLAZE_INTERNAL_ASSERT( order.size() == n, "Invalid elimination order detected" );
+
+   return order;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a fill-reducing ordering of the given symmetric sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The square symmetric (Hermitian) sparse matrix.
+// \return The permutation vector, i.e. the \a k-th pivot is the row/column \c p[k] of \a A.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes an approximate minimum degree (AMD) ordering of the given symmetric
+// (Hermitian) sparse matrix, i.e. a permutation \a P for which the Cholesky factor of the
+// permuted matrix \f$ P A P^T \f$ has considerably fewer non-zero elements than the Cholesky
+// factor of \a A. Only the strictly lower part of \a A is accessed:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> p( blaze::amd( A ) );  // Row/column p[k] is eliminated k-th
+   \endcode
+
+// Note that the ordering only depends on the sparsity pattern of \a A, i.e. on the positions of
+// the non-zero elements, and that it is usually computed implicitly by the sparse Cholesky and
+// LDLH decompositions (see the SparseLLH and SparseLDLH classes).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> amd( const SparseMatrix<MT,SO>& A )
+{
+   std::vector< std::vector<size_t> > adj( lowerAdjacency( ~A ) );
+   return amdOrder( adj );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
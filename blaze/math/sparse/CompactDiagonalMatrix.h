@@ -0,0 +1,3375 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompactDiagonalMatrix.h
+//  \brief Implementation of a compact diagonal matrix
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COMPACTDIAGONALMATRIX_H_
+#define _BLAZE_MATH_SPARSE_COMPACTDIAGONALMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <initializer_list>
+#include <iterator>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/DeclDiagTrait.h>
+#include <blaze/math/traits/DeclHermTrait.h>
+#include <blaze/math/traits/DeclLowTrait.h>
+#include <blaze/math/traits/DeclSymTrait.h>
+#include <blaze/math/traits/DeclUppTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SchurTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/traits/UnaryMapTrait.h>
+#include <blaze/math/typetraits/HighType.h>
+#include <blaze/math/typetraits/IsColumnMajorMatrix.h>
+#include <blaze/math/typetraits/IsCompactDiagonalMatrix.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsDiagonal.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/LowType.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compact_diagonal_matrix CompactDiagonalMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of an \f$ N \times N \f$ diagonal matrix with \f$ O(N) \f$
+//        storage.
+// \ingroup compact_diagonal_matrix
+//
+// The CompactDiagonalMatrix class template is the representation of an arbitrary sized diagonal
+// matrix, which stores only its \f$ N \f$ diagonal elements in a single dense vector. In contrast
+// to the DiagonalMatrix adaptor, which keeps the complete storage of the adapted matrix (i.e.
+// \f$ N \cdot N \f$ elements for a DynamicMatrix), the memory requirement of a compact diagonal
+// matrix is independent of the kind of matrix it is combined with. The type of the elements and
+// the storage order of the matrix can be specified via the two template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class CompactDiagonalMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompactDiagonalMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer, numeric element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//
+// The diagonal elements are always stored, i.e. every row and column contains exactly one
+// element. They can be accessed via the function call operator, and they can be modified via
+// the set() and insert() functions, via iterators, or directly via the underlying vector that
+// is returned by the diagonal() function. Any attempt to modify a non-diagonal element results
+// in a \a std::invalid_argument exception:
+
+   \code
+   using blaze::CompactDiagonalMatrix;
+   using blaze::DynamicVector;
+
+   DynamicVector<double> d{ 2.0, 4.0, 8.0 };
+
+   CompactDiagonalMatrix<double> D( d );  // 3x3 diagonal matrix with the diagonal d
+
+   double x = D(1,1);  // Access to the diagonal element (1,1)
+   double y = D(1,2);  // Access to the non-diagonal element (1,2); results in 0
+
+   D.set( 2, 2, 3.0 );        // Setting the diagonal element (2,2)
+   D.diagonal()[0] = 1.0;     // Direct access to the diagonal vector
+   D.set( 0, 1, 1.0 );        // Throws an exception; invalid access to non-diagonal element
+   \endcode
+
+// The multiplication of a compact diagonal matrix with a dense or sparse matrix is evaluated
+// by a dedicated row scaling (\f$ D*A \f$) or column scaling (\f$ A*D \f$) kernel, which
+// requires a single pass over the matrix operand. For dense matrices and built-in element types
+// the scaling kernels are vectorized, and in case the size of the matrix exceeds the
+// \c SMP_DMATSCALARMULT_THRESHOLD the computation is parallelized. Multiplications with vectors
+// are evaluated as componentwise vector multiplications. All other operations treat a compact
+// diagonal matrix like any other sparse matrix:
+
+   \code
+   using blaze::CompactDiagonalMatrix;
+   using blaze::DynamicMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+
+   CompactDiagonalMatrix<double> D( 1000000UL );
+   DynamicMatrix<double,rowMajor> A( 1000000UL, 64UL ), B;
+   DynamicVector<double> x( 1000000UL ), y;
+   // ... Initialization
+
+   B = D * A;      // Scaling of the rows of A
+   B = A * D(64);  // Scaling of the columns of A (with a 64x64 diagonal matrix)
+   y = D * x;      // Componentwise scaling of x
+   \endcode
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class CompactDiagonalMatrix
+   : public SparseMatrix< CompactDiagonalMatrix<Type,SO>, SO >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = CompactDiagonalMatrix<Type,SO>;   //!< Type of this CompactDiagonalMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;            //!< Base type of this CompactDiagonalMatrix instance.
+   using ResultType     = This;                             //!< Result type for expression template evaluations.
+   using OppositeType   = CompactDiagonalMatrix<Type,!SO>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompactDiagonalMatrix<Type,!SO>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                             //!< Type of the matrix elements.
+   using ReturnType     = const Type;                       //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                      //!< Data type for composite expression templates.
+   using Reference      = const Type;                       //!< Reference to a matrix element.
+   using ConstReference = const Type;                       //!< Reference to a constant matrix element.
+   using DiagonalType   = DynamicVector<Type,columnVector>; //!< Type of the vector of diagonal elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompactDiagonalMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = CompactDiagonalMatrix<NewType,SO>;  //!< The type of the other CompactDiagonalMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a CompactDiagonalMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = CompactDiagonalMatrix<Type,SO>;  //!< The type of the other CompactDiagonalMatrix.
+   };
+   //**********************************************************************************************
+
+   //**DiagonalIterator class definition***********************************************************
+   /*!\brief Iterator over the diagonal element of a row/column of the compact diagonal matrix.
+   */
+   template< typename ET >  // Type of the diagonal elements (possibly const-qualified)
+   class DiagonalIterator
+      : private SparseElement
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using IteratorCategory = std::forward_iterator_tag;  //!< The iterator category.
+      using ValueType        = DiagonalIterator;           //!< Type of the underlying elements.
+      using PointerType      = const ValueType*;           //!< Pointer return type.
+      using ReferenceType    = const ValueType&;           //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                  //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the DiagonalIterator class.
+      */
+      inline DiagonalIterator() noexcept
+         : values_( nullptr )  // Pointer to the diagonal elements
+         , index_ ( 0UL )      // Index of the current diagonal element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the DiagonalIterator class.
+      //
+      // \param values Pointer to the diagonal elements.
+      // \param index Index of the initial diagonal element.
+      */
+      inline DiagonalIterator( ET* values, size_t index ) noexcept
+         : values_( values )  // Pointer to the diagonal elements
+         , index_ ( index  )  // Index of the current diagonal element
+      {}
+      //*******************************************************************************************
+
+      //**Conversion constructor*******************************************************************
+      /*!\brief Conversion constructor from different DiagonalIterator instances.
+      //
+      // \param it The iterator to be copied.
+      */
+      template< typename ET2 >
+      inline DiagonalIterator( const DiagonalIterator<ET2>& it ) noexcept
+         : values_( it.values() )  // Pointer to the diagonal elements
+         , index_ ( it.index()  )  // Index of the current diagonal element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline DiagonalIterator& operator++() noexcept {
+         ++index_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const DiagonalIterator operator++( int ) noexcept {
+         const DiagonalIterator tmp( *this );
+         ++index_;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const DiagonalIterator& operator*() const noexcept {
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const DiagonalIterator* operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return Reference to the current value of the sparse element.
+      */
+      inline ET& value() const noexcept {
+         return values_[index_];
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return index_;
+      }
+      //*******************************************************************************************
+
+      //**Values function**************************************************************************
+      /*!\brief Access to the underlying array of diagonal elements.
+      //
+      // \return Pointer to the diagonal elements.
+      */
+      inline ET* values() const noexcept {
+         return values_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two DiagonalIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename ET2 >
+      inline bool operator==( const DiagonalIterator<ET2>& rhs ) const noexcept {
+         return index_ == rhs.index();
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two DiagonalIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename ET2 >
+      inline bool operator!=( const DiagonalIterator<ET2>& rhs ) const noexcept {
+         return index_ != rhs.index();
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two DiagonalIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      template< typename ET2 >
+      inline DifferenceType operator-( const DiagonalIterator<ET2>& rhs ) const noexcept {
+         return index_ - rhs.index();
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      ET*    values_;  //!< Pointer to the diagonal elements.
+      size_t index_;   //!< Index of the current diagonal element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator      = DiagonalIterator<Type>;        //!< Iterator over non-constant elements.
+   using ConstIterator = DiagonalIterator<const Type>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompactDiagonalMatrix() noexcept;
+   explicit inline CompactDiagonalMatrix( size_t n );
+   explicit inline CompactDiagonalMatrix( size_t n, const Type& init );
+   explicit inline CompactDiagonalMatrix( std::initializer_list<Type> list );
+
+   template< typename VT >
+   explicit inline CompactDiagonalMatrix( const Vector<VT,columnVector>& v );
+
+   template< typename MT, bool SO2 >
+   inline CompactDiagonalMatrix( const Matrix<MT,SO2>& m );
+
+   // No explicitly declared copy constructor.
+   // No explicitly declared move constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference      operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference      at( size_t i, size_t j ) const;
+   inline Iterator            begin ( size_t i ) noexcept;
+   inline ConstIterator       begin ( size_t i ) const noexcept;
+   inline ConstIterator       cbegin( size_t i ) const noexcept;
+   inline Iterator            end   ( size_t i ) noexcept;
+   inline ConstIterator       end   ( size_t i ) const noexcept;
+   inline ConstIterator       cend  ( size_t i ) const noexcept;
+   inline DiagonalType&       diagonal() noexcept;
+   inline const DiagonalType& diagonal() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename MT, bool SO2 >
+   inline CompactDiagonalMatrix& operator=( const Matrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 >
+   inline CompactDiagonalMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 >
+   inline CompactDiagonalMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 >
+   inline CompactDiagonalMatrix& operator%=( const Matrix<MT,SO2>& rhs );
+
+   template< typename MT, bool SO2 >
+   inline CompactDiagonalMatrix& operator*=( const Matrix<MT,SO2>& rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, CompactDiagonalMatrix >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, CompactDiagonalMatrix >& operator/=( Other rhs );
+
+   // No explicitly declared copy assignment operator.
+   // No explicitly declared move assignment operator.
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+          void   resize( size_t n, bool preserve=true );
+   inline void   shrinkToFit();
+   inline void   swap( CompactDiagonalMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set   ( size_t i, size_t j, const Type& value );
+   inline Iterator insert( size_t i, size_t j, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void     erase( size_t i, size_t j );
+   inline Iterator erase( size_t i, Iterator pos );
+   inline Iterator erase( size_t i, Iterator first, Iterator last );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline CompactDiagonalMatrix& transpose();
+   inline CompactDiagonalMatrix& ctranspose();
+
+   template< typename Other > inline CompactDiagonalMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Type for the evaluation of a matrix operand.
+   /*! Computations are evaluated into a temporary sparse matrix, which stores only the non-zero
+       (i.e. for diagonal results only the diagonal) elements. All other matrices are accessed
+       directly. */
+   template< typename MT >
+   using Operand_ = If_< IsComputation<MT>
+                       , const CompressedMatrix< ElementType_<MT>, IsColumnMajorMatrix<MT>::value >
+                       , const MT& >;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DiagonalType diag_;  //!< The diagonal elements of the matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompactDiagonalMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix() noexcept
+   : diag_()  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a diagonal matrix of size \f$ N \times N \f$.
+//
+// \param n The number of rows and columns of the matrix.
+//
+// All diagonal elements are initialized to their default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( size_t n )
+   : diag_( n, Type() )  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a diagonal matrix of size \f$ N \times N \f$ with initialized diagonal.
+//
+// \param n The number of rows and columns of the matrix.
+// \param init The initial value of the diagonal elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( size_t n, const Type& init )
+   : diag_( n, init )  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of the diagonal elements.
+//
+// \param list The initializer list for the diagonal elements.
+//
+// This constructor provides the option to explicitly initialize the diagonal elements of the
+// matrix by means of an initializer list:
+
+   \code
+   blaze::CompactDiagonalMatrix<int> D{ 1, 2, 3 };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( std::initializer_list<Type> list )
+   : diag_( list )  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Construction of a diagonal matrix from the vector of its diagonal elements.
+//
+// \param v The vector of diagonal elements.
+//
+// The matrix is sized according to the size of the given dense or sparse column vector.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename VT >  // Type of the diagonal vector
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( const Vector<VT,columnVector>& v )
+   : diag_( ~v )  // The diagonal elements of the matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Diagonal matrix to be copied.
+// \exception std::invalid_argument Invalid setup of diagonal matrix.
+//
+// The matrix is sized according to the given \f$ N \times N \f$ matrix and initialized with
+// its diagonal. In case the given matrix is not a diagonal matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the foreign matrix
+        , bool SO2 >     // Storage order of the foreign matrix
+inline CompactDiagonalMatrix<Type,SO>::CompactDiagonalMatrix( const Matrix<MT,SO2>& m )
+   : diag_()  // The diagonal elements of the matrix
+{
+   Operand_<MT> A( ~m );
+
+   if( !IsDiagonal<MT>::value && !isDiagonal( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of diagonal matrix" );
+   }
+
+   const size_t n( A.rows() );
+   diag_.resize( n, false );
+   for( size_t i=0UL; i<n; ++i ) {
+      diag_[i] = A(i,i);
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the diagonal matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstReference
+   CompactDiagonalMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid diagonal matrix row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid diagonal matrix column access index" );
+
+   if( i == j )
+      return diag_[i];
+   else
+      return Type();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstReference
+   CompactDiagonalMatrix<Type,SO>::at( size_t i, size_t j ) const
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the diagonal element of row/column \a i,
+// which is the only element stored in each row/column of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return Iterator( diag_.data(), i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the diagonal element of row/column \a i,
+// which is the only element stored in each row/column of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return ConstIterator( diag_.data(), i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the diagonal element of row/column \a i,
+// which is the only element stored in each row/column of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return ConstIterator( diag_.data(), i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return Iterator( diag_.data(), i+1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return ConstIterator( diag_.data(), i+1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return ConstIterator( diag_.data(), i+1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the vector of diagonal elements.
+//
+// \return Reference to the vector of diagonal elements.
+//
+// Since the size of the matrix is defined by the size of the diagonal vector, resizing the
+// returned vector also resizes the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::DiagonalType&
+   CompactDiagonalMatrix<Type,SO>::diagonal() noexcept
+{
+   return diag_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the vector of diagonal elements.
+//
+// \return Reference to the vector of diagonal elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline const typename CompactDiagonalMatrix<Type,SO>::DiagonalType&
+   CompactDiagonalMatrix<Type,SO>::diagonal() const noexcept
+{
+   return diag_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Diagonal matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized with
+// its diagonal. In case the given matrix is not a diagonal matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator=( const Matrix<MT,SO2>& rhs )
+{
+   Operand_<MT> A( ~rhs );
+
+   if( !IsDiagonal<MT>::value && !isDiagonal( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix" );
+   }
+
+   const size_t n( A.rows() );
+   DiagonalType tmp( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      tmp[i] = A(i,i);
+   }
+
+   diag_.swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the diagonal matrix.
+// \return Reference to the diagonal matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the matrix sizes do not match or the given matrix is not a diagonal matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   Operand_<MT> A( ~rhs );
+
+   if( !IsDiagonal<MT>::value && !isDiagonal( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix" );
+   }
+
+   const size_t n( rows() );
+   for( size_t i=0UL; i<n; ++i ) {
+      diag_[i] += A(i,i);
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the diagonal matrix.
+// \return Reference to the diagonal matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the matrix sizes do not match or the given matrix is not a diagonal matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   Operand_<MT> A( ~rhs );
+
+   if( !IsDiagonal<MT>::value && !isDiagonal( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix" );
+   }
+
+   const size_t n( rows() );
+   for( size_t i=0UL; i<n; ++i ) {
+      diag_[i] -= A(i,i);
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a matrix (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side matrix for the Schur product.
+// \return Reference to the diagonal matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// Since the Schur product with a diagonal matrix is again a diagonal matrix, the given matrix
+// is not required to be diagonal. In case the matrix sizes do not match, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator%=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != rows() || (~rhs).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   Operand_<MT> A( ~rhs );
+
+   const size_t n( rows() );
+   for( size_t i=0UL; i<n; ++i ) {
+      diag_[i] *= A(i,i);
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a matrix (\f$ A*=B \f$).
+//
+// \param rhs The right-hand side matrix for the multiplication.
+// \return Reference to the diagonal matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix.
+//
+// In case the matrix sizes do not match or the given matrix is not a diagonal matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompactDiagonalMatrix<Type,SO>&
+   CompactDiagonalMatrix<Type,SO>::operator*=( const Matrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != columns() || (~rhs).columns() != columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   Operand_<MT> A( ~rhs );
+
+   if( !IsDiagonal<MT>::value && !isDiagonal( A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix" );
+   }
+
+   const size_t n( rows() );
+   for( size_t i=0UL; i<n; ++i ) {
+      diag_[i] *= A(i,i);
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, CompactDiagonalMatrix<Type,SO> >&
+   CompactDiagonalMatrix<Type,SO>::operator*=( Other rhs )
+{
+   diag_ *= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, CompactDiagonalMatrix<Type,SO> >&
+   CompactDiagonalMatrix<Type,SO>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   diag_ /= rhs;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the diagonal matrix.
+//
+// \return The number of rows of the diagonal matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::rows() const noexcept
+{
+   return diag_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the diagonal matrix.
+//
+// \return The number of columns of the diagonal matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::columns() const noexcept
+{
+   return diag_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the diagonal matrix.
+//
+// \return The capacity of the diagonal matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::capacity() const noexcept
+{
+   return diag_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::capacity( size_t i ) const noexcept
+{
+   UNUSED_PARAMETER( i );
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of elements stored in the diagonal matrix.
+//
+// \return The number of stored elements in the diagonal matrix.
+//
+// Since all diagonal elements are stored, the function returns \f$ N \f$ for an
+// \f$ N \times N \f$ diagonal matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::nonZeros() const noexcept
+{
+   return diag_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of elements stored in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of stored elements of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompactDiagonalMatrix<Type,SO>::nonZeros( size_t i ) const noexcept
+{
+   UNUSED_PARAMETER( i );
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   return 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function resets all diagonal elements to their default value. The size of the matrix
+// is not changed.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::reset()
+{
+   using blaze::reset;
+
+   reset( diag_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the diagonal element of the specified row/column to its default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::reset( size_t i )
+{
+   using blaze::reset;
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   reset( diag_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the diagonal matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the diagonal matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::clear()
+{
+   diag_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the diagonal matrix.
+//
+// \param n The new number of rows and columns of the diagonal matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix using the given size to \f$ n \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true. New diagonal elements are initialized to their
+// default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void CompactDiagonalMatrix<Type,SO>::resize( size_t n, bool preserve )
+{
+   using blaze::reset;
+
+   const size_t first( preserve ? min( n, rows() ) : 0UL );
+
+   diag_.resize( n, preserve );
+
+   for( size_t i=first; i<n; ++i ) {
+      reset( diag_[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the matrix by removing unused capacity. Please note
+// that due to padding the capacity might not be reduced exactly to rows() times columns().
+// Please also note that in case a reallocation occurs, all iterators (including end()
+// iterators), all pointers and references to elements of the matrix are invalidated.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::shrinkToFit()
+{
+   diag_.shrinkToFit();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two diagonal matrices.
+//
+// \param m The diagonal matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::swap( CompactDiagonalMatrix& m ) noexcept
+{
+   diag_.swap( m.diag_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting elements of the diagonal matrix.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+// \exception std::invalid_argument Invalid access to non-diagonal matrix element.
+//
+// This function sets the value of the diagonal element at position \f$ (i,i) \f$. In case
+// \a i and \a j refer to a non-diagonal element, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   if( i != j ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid access to non-diagonal matrix element" );
+   }
+
+   diag_[i] = value;
+
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting elements into the diagonal matrix.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the inserted element.
+// \exception std::invalid_argument Invalid access to non-diagonal matrix element.
+//
+// Since all diagonal elements are permanently stored, inserting the diagonal element at
+// position \f$ (i,i) \f$ is equivalent to setting its value. In case \a i and \a j refer to
+// a non-diagonal element, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+{
+   return set( i, j, value );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the diagonal matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// Since all diagonal elements are permanently stored, erasing the diagonal element at position
+// \f$ (i,i) \f$ resets it to its default value. Erasing a non-diagonal element has no effect.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompactDiagonalMatrix<Type,SO>::erase( size_t i, size_t j )
+{
+   using blaze::reset;
+
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   if( i == j ) {
+      reset( diag_[i] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the diagonal matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// Since all diagonal elements are permanently stored, erasing the diagonal element resets it
+// to its default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::erase( size_t i, Iterator pos )
+{
+   using blaze::reset;
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   if( pos != end( i ) ) {
+      reset( pos->value() );
+   }
+
+   return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the diagonal matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// Since all diagonal elements are permanently stored, erasing the diagonal element resets it
+// to its default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last )
+{
+   using blaze::reset;
+
+   UNUSED_PARAMETER( i );
+
+   BLAZE_USER_ASSERT( i < rows(), "Invalid diagonal matrix row/column access index" );
+
+   if( first != last ) {
+      reset( first->value() );
+   }
+
+   return last;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. In case the element is a diagonal element, the function returns a row/column iterator
+// to the element. Otherwise an iterator just past the last non-zero element of row \a i or
+// column \a j (the end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::find( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid diagonal matrix row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid diagonal matrix column access index" );
+
+   if( i == j )
+      return begin( i );
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. In case the element is a diagonal element, the function returns a row/column iterator
+// to the element. Otherwise an iterator just past the last non-zero element of row \a i or
+// column \a j (the end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::find( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid diagonal matrix row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid diagonal matrix column access index" );
+
+   if( i == j )
+      return begin( i );
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid diagonal matrix row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid diagonal matrix column access index" );
+
+   if( ( !SO && j <= i ) || ( SO && i <= j ) )
+      return begin( SO ? j : i );
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid diagonal matrix row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid diagonal matrix column access index" );
+
+   if( ( !SO && j <= i ) || ( SO && i <= j ) )
+      return begin( SO ? j : i );
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::Iterator
+   CompactDiagonalMatrix<Type,SO>::upperBound( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid diagonal matrix row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid diagonal matrix column access index" );
+
+   if( ( !SO && j < i ) || ( SO && i < j ) )
+      return begin( SO ? j : i );
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline typename CompactDiagonalMatrix<Type,SO>::ConstIterator
+   CompactDiagonalMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( SO  || i < rows()   , "Invalid diagonal matrix row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid diagonal matrix column access index" );
+
+   if( ( !SO && j < i ) || ( SO && i < j ) )
+      return begin( SO ? j : i );
+   else
+      return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>& CompactDiagonalMatrix<Type,SO>::transpose()
+{
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompactDiagonalMatrix<Type,SO>& CompactDiagonalMatrix<Type,SO>::ctranspose()
+{
+   const size_t n( rows() );
+   for( size_t i=0UL; i<n; ++i ) {
+      conjugate( diag_[i] );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the diagonal matrix by the scalar value \a scalar (\f$ A*=s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the diagonal matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the scalar value
+inline CompactDiagonalMatrix<Type,SO>& CompactDiagonalMatrix<Type,SO>::scale( const Other& scalar )
+{
+   diag_.scale( scalar );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactDiagonalMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO >         // Storage order
+template< typename Other >  // Data type of the foreign expression
+inline bool CompactDiagonalMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool CompactDiagonalMatrix<Type,SO>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPACTDIAGONALMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompactDiagonalMatrix operators */
+//@{
+template< typename Type, bool SO >
+inline void reset( CompactDiagonalMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void reset( CompactDiagonalMatrix<Type,SO>& m, size_t i );
+
+template< typename Type, bool SO >
+inline void clear( CompactDiagonalMatrix<Type,SO>& m );
+
+template< bool RF, typename Type, bool SO >
+inline bool isDefault( const CompactDiagonalMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline bool isIntact( const CompactDiagonalMatrix<Type,SO>& m );
+
+template< typename Type, bool SO >
+inline void swap( CompactDiagonalMatrix<Type,SO>& a, CompactDiagonalMatrix<Type,SO>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compact diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( CompactDiagonalMatrix<Type,SO>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given compact diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the diagonal element in the specified row/column of the given compact
+// diagonal matrix to its default value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void reset( CompactDiagonalMatrix<Type,SO>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compact diagonal matrix.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void clear( CompactDiagonalMatrix<Type,SO>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compact diagonal matrix is in default state.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix is component-wise zero, \a false otherwise.
+//
+// This function checks whether the compact diagonal matrix is in default state, i.e. if all
+// of its diagonal elements are in default state. In case it is in default state, the function
+// returns \a true, else it will return \a false. The following example demonstrates the use
+// of the \a isDefault() function:
+
+   \code
+   blaze::CompactDiagonalMatrix<int> D;
+   // ... Resizing and initialization
+   if( isDefault( D ) ) { ... }
+   \endcode
+
+// Optionally, it is possible to switch between strict semantics (blaze::strict) and relaxed
+// semantics (blaze::relaxed):
+
+   \code
+   if( isDefault<relaxed>( D ) ) { ... }
+   \endcode
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isDefault( const CompactDiagonalMatrix<Type,SO>& m )
+{
+   return isDefault<RF>( m.diagonal() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given compact diagonal matrix are intact.
+// \ingroup compact_diagonal_matrix
+//
+// \param m The compact diagonal matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the compact diagonal matrix are intact, i.e.
+// if its state is valid. In case the invariants are intact, the function returns \a true, else
+// it will return \a false. The following example demonstrates the use of the \a isIntact()
+// function:
+
+   \code
+   blaze::CompactDiagonalMatrix<int> D;
+   // ... Resizing and initialization
+   if( isIntact( D ) ) { ... }
+   \endcode
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline bool isIntact( const CompactDiagonalMatrix<Type,SO>& m )
+{
+   return isIntact( m.diagonal() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compact diagonal matrices.
+// \ingroup compact_diagonal_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void swap( CompactDiagonalMatrix<Type,SO>& a, CompactDiagonalMatrix<Type,SO>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL BINARY ARITHMETIC OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a dense
+//        vector (\f$ \vec{y}=D*\vec{x} \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param mat The left-hand side compact diagonal matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator represents the multiplication between a compact diagonal matrix and a dense
+// vector:
+
+   \code
+   using blaze::columnVector;
+
+   blaze::CompactDiagonalMatrix<double> D;
+   blaze::DynamicVector<double,columnVector> x, y;
+   // ... Resizing and initialization
+   y = D * x;
+   \endcode
+
+// The operator returns the componentwise multiplication of the diagonal of \a mat and the
+// given dense vector. In case the current size of the vector \a vec doesn't match the current
+// number of columns of the matrix \a mat, a \a std::invalid_argument is thrown.
+*/
+template< typename T    // Data type of the left-hand side compact diagonal matrix
+        , bool SO       // Storage order of the left-hand side compact diagonal matrix
+        , typename VT >  // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const CompactDiagonalMatrix<T,SO>& mat, const DenseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~mat).columns() != (~vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   return (~mat).diagonal() * (~vec);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a transpose dense vector and a
+//        compact diagonal matrix (\f$ \vec{y}^T=\vec{x}^T*D \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param vec The left-hand side transpose dense vector for the multiplication.
+// \param mat The right-hand side compact diagonal matrix for the multiplication.
+// \return The resulting transpose vector.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+//
+// This operator represents the multiplication between a transpose dense vector and a compact
+// diagonal matrix:
+
+   \code
+   using blaze::rowVector;
+
+   blaze::CompactDiagonalMatrix<double> D;
+   blaze::DynamicVector<double,rowVector> x, y;
+   // ... Resizing and initialization
+   y = x * D;
+   \endcode
+
+// The operator returns the componentwise multiplication of the given dense vector and the
+// diagonal of \a mat. In case the current size of the vector \a vec doesn't match the current
+// number of rows of the matrix \a mat, a \a std::invalid_argument is thrown.
+*/
+template< typename VT  // Type of the left-hand side dense vector
+        , typename T   // Data type of the right-hand side compact diagonal matrix
+        , bool SO >    // Storage order of the right-hand side compact diagonal matrix
+inline decltype(auto)
+   operator*( const DenseVector<VT,true>& vec, const CompactDiagonalMatrix<T,SO>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~vec).size() != (~mat).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector and matrix sizes do not match" );
+   }
+
+   return (~vec) * trans( (~mat).diagonal() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a
+//        sparse vector (\f$ \vec{y}=D*\vec{x} \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param mat The left-hand side compact diagonal matrix for the multiplication.
+// \param vec The right-hand side sparse vector for the multiplication.
+// \return The resulting vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator represents the multiplication between a compact diagonal matrix and a sparse
+// vector:
+
+   \code
+   using blaze::columnVector;
+
+   blaze::CompactDiagonalMatrix<double> D;
+   blaze::CompressedVector<double,columnVector> x, y;
+   // ... Resizing and initialization
+   y = D * x;
+   \endcode
+
+// The operator returns the componentwise multiplication of the diagonal of \a mat and the
+// given sparse vector. In case the current size of the vector \a vec doesn't match the
+// current number of columns of the matrix \a mat, a \a std::invalid_argument is thrown.
+*/
+template< typename T    // Data type of the left-hand side compact diagonal matrix
+        , bool SO       // Storage order of the left-hand side compact diagonal matrix
+        , typename VT >  // Type of the right-hand side sparse vector
+inline decltype(auto)
+   operator*( const CompactDiagonalMatrix<T,SO>& mat, const SparseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~mat).columns() != (~vec).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   return (~mat).diagonal() * (~vec);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a transpose sparse vector and a
+//        compact diagonal matrix (\f$ \vec{y}^T=\vec{x}^T*D \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param vec The left-hand side transpose sparse vector for the multiplication.
+// \param mat The right-hand side compact diagonal matrix for the multiplication.
+// \return The resulting transpose vector.
+// \exception std::invalid_argument Vector and matrix sizes do not match.
+//
+// This operator represents the multiplication between a transpose sparse vector and a compact
+// diagonal matrix:
+
+   \code
+   using blaze::rowVector;
+
+   blaze::CompactDiagonalMatrix<double> D;
+   blaze::CompressedVector<double,rowVector> x, y;
+   // ... Resizing and initialization
+   y = x * D;
+   \endcode
+
+// The operator returns the componentwise multiplication of the given sparse vector and the
+// diagonal of \a mat. In case the current size of the vector \a vec doesn't match the current
+// number of rows of the matrix \a mat, a \a std::invalid_argument is thrown.
+*/
+template< typename VT  // Type of the left-hand side sparse vector
+        , typename T   // Data type of the right-hand side compact diagonal matrix
+        , bool SO >    // Storage order of the right-hand side compact diagonal matrix
+inline decltype(auto)
+   operator*( const SparseVector<VT,true>& vec, const CompactDiagonalMatrix<T,SO>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~vec).size() != (~mat).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector and matrix sizes do not match" );
+   }
+
+   return (~vec) * trans( (~mat).diagonal() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a
+//        dense vector-scalar multiplication expression (\f$ \vec{y}=D*(\vec{x}*s1) \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param mat The left-hand side compact diagonal matrix.
+// \param vec The right-hand side dense vector-scalar multiplication.
+// \return The scaled result vector.
+//
+// This operator restructures the expression \f$ \vec{y}=D*(\vec{x}*s1) \f$ to the expression
+// \f$ \vec{y}=(D*\vec{x})*s1 \f$.
+*/
+template< typename T     // Data type of the left-hand side compact diagonal matrix
+        , bool SO        // Storage order of the left-hand side compact diagonal matrix
+        , typename VT    // Type of the dense vector of the right-hand side expression
+        , typename ST >  // Type of the scalar of the right-hand side expression
+inline decltype(auto)
+   operator*( const CompactDiagonalMatrix<T,SO>& mat, const DVecScalarMultExpr<VT,ST,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( (~mat) * vec.leftOperand() ) * vec.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a transpose dense vector-scalar
+//        multiplication expression and a compact diagonal matrix (\f$ \vec{y}^T=(\vec{x}^T*s1)*D \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param vec The left-hand side transpose dense vector-scalar multiplication.
+// \param mat The right-hand side compact diagonal matrix.
+// \return The scaled result vector.
+//
+// This operator restructures the expression \f$ \vec{y}^T=(\vec{x}^T*s1)*D \f$ to the expression
+// \f$ \vec{y}^T=(\vec{x}^T*D)*s1 \f$.
+*/
+template< typename VT  // Type of the dense vector of the left-hand side expression
+        , typename ST  // Type of the scalar of the left-hand side expression
+        , typename T   // Data type of the right-hand side compact diagonal matrix
+        , bool SO >    // Storage order of the right-hand side compact diagonal matrix
+inline decltype(auto)
+   operator*( const DVecScalarMultExpr<VT,ST,true>& vec, const CompactDiagonalMatrix<T,SO>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( vec.leftOperand() * (~mat) ) * vec.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and a
+//        sparse vector-scalar multiplication expression (\f$ \vec{y}=D*(\vec{x}*s1) \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param mat The left-hand side compact diagonal matrix.
+// \param vec The right-hand side sparse vector-scalar multiplication.
+// \return The scaled result vector.
+//
+// This operator restructures the expression \f$ \vec{y}=D*(\vec{x}*s1) \f$ to the expression
+// \f$ \vec{y}=(D*\vec{x})*s1 \f$.
+*/
+template< typename T     // Data type of the left-hand side compact diagonal matrix
+        , bool SO        // Storage order of the left-hand side compact diagonal matrix
+        , typename VT    // Type of the sparse vector of the right-hand side expression
+        , typename ST >  // Type of the scalar of the right-hand side expression
+inline decltype(auto)
+   operator*( const CompactDiagonalMatrix<T,SO>& mat, const SVecScalarMultExpr<VT,ST,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( (~mat) * vec.leftOperand() ) * vec.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a transpose sparse vector-scalar
+//        multiplication expression and a compact diagonal matrix (\f$ \vec{y}^T=(\vec{x}^T*s1)*D \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param vec The left-hand side transpose sparse vector-scalar multiplication.
+// \param mat The right-hand side compact diagonal matrix.
+// \return The scaled result vector.
+//
+// This operator restructures the expression \f$ \vec{y}^T=(\vec{x}^T*s1)*D \f$ to the expression
+// \f$ \vec{y}^T=(\vec{x}^T*D)*s1 \f$.
+*/
+template< typename VT  // Type of the sparse vector of the left-hand side expression
+        , typename ST  // Type of the scalar of the left-hand side expression
+        , typename T   // Data type of the right-hand side compact diagonal matrix
+        , bool SO >    // Storage order of the right-hand side compact diagonal matrix
+inline decltype(auto)
+   operator*( const SVecScalarMultExpr<VT,ST,true>& vec, const CompactDiagonalMatrix<T,SO>& mat )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ( vec.leftOperand() * (~mat) ) * vec.rightOperand();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of a compact diagonal matrix and an
+//        identity matrix (\f$ A=D*I \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side compact diagonal matrix for the multiplication.
+// \param rhs The right-hand side identity matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The operator returns a reference to the given compact diagonal matrix. In case the current
+// sizes of the two given matrices don't match, a \a std::invalid_argument is thrown.
+*/
+template< typename T1  // Data type of the left-hand side compact diagonal matrix
+        , bool SO1     // Storage order of the left-hand side compact diagonal matrix
+        , typename T2  // Data type of the right-hand side identity matrix
+        , bool SO2 >   // Storage order of the right-hand side identity matrix
+inline decltype(auto)
+   operator*( const CompactDiagonalMatrix<T1,SO1>& lhs, const IdentityMatrix<T2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return (~lhs);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of an identity matrix and a compact
+//        diagonal matrix (\f$ A=I*D \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side identity matrix for the multiplication.
+// \param rhs The right-hand side compact diagonal matrix for the multiplication.
+// \return The resulting matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// The operator returns a reference to the given compact diagonal matrix. In case the current
+// sizes of the two given matrices don't match, a \a std::invalid_argument is thrown.
+*/
+template< typename T1  // Data type of the left-hand side identity matrix
+        , bool SO1     // Storage order of the left-hand side identity matrix
+        , typename T2  // Data type of the right-hand side compact diagonal matrix
+        , bool SO2 >   // Storage order of the right-hand side compact diagonal matrix
+inline decltype(auto)
+   operator*( const IdentityMatrix<T1,SO1>& lhs, const CompactDiagonalMatrix<T2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return (~rhs);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication operator for the multiplication of two compact diagonal matrices
+//        (\f$ A=B*C \f$).
+// \ingroup compact_diagonal_matrix
+//
+// \param lhs The left-hand side compact diagonal matrix for the multiplication.
+// \param rhs The right-hand side compact diagonal matrix for the multiplication.
+// \return The resulting compact diagonal matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This operator represents the multiplication of two compact diagonal matrices:
+
+   \code
+   blaze::CompactDiagonalMatrix<double> A, B, C;
+   // ... Resizing and initialization
+   C = A * B;
+   \endcode
+
+// The product is computed immediately as the componentwise product of the two diagonals and
+// returned as a compact diagonal matrix. In case the current sizes of the two given matrices
+// don't match, a \a std::invalid_argument is thrown.
+*/
+template< typename T1  // Data type of the left-hand side compact diagonal matrix
+        , bool SO1     // Storage order of the left-hand side compact diagonal matrix
+        , typename T2  // Data type of the right-hand side compact diagonal matrix
+        , bool SO2 >   // Storage order of the right-hand side compact diagonal matrix
+inline const CompactDiagonalMatrix< MultTrait_<T1,T2>, SO1 >
+   operator*( const CompactDiagonalMatrix<T1,SO1>& lhs, const CompactDiagonalMatrix<T2,SO2>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~lhs).columns() != (~rhs).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   return CompactDiagonalMatrix< MultTrait_<T1,T2>, SO1 >( (~lhs).diagonal() * (~rhs).diagonal() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISCOMPACTDIAGONALMATRIX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsCompactDiagonalMatrix< CompactDiagonalMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSQUARE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsSquare< CompactDiagonalMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSYMMETRIC SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsSymmetric< CompactDiagonalMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISHERMITIAN SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsHermitian< CompactDiagonalMatrix<T,SO> >
+   : public BoolConstant< IsBuiltin<T>::value >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISLOWER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsLower< CompactDiagonalMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISUPPER SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsUpper< CompactDiagonalMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct IsResizable< CompactDiagonalMatrix<T,SO> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, size_t M, size_t N >
+struct AddTrait< CompactDiagonalMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct AddTrait< StaticMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = StaticMatrix< AddTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, size_t M, size_t N >
+struct AddTrait< CompactDiagonalMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct AddTrait< HybridMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = HybridMatrix< AddTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< DynamicMatrix<T1,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< DynamicMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, bool AF, bool PF >
+struct AddTrait< CompactDiagonalMatrix<T1,SO>, CustomMatrix<T2,AF,PF,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO, typename T2 >
+struct AddTrait< CustomMatrix<T1,AF,PF,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CustomMatrix<T1,AF,PF,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< AddTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct AddTrait< CompressedMatrix<T1,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompressedMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< AddTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, IdentityMatrix<T2,SO2> >
+{
+   using Type = CompactDiagonalMatrix< AddTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< IdentityMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompactDiagonalMatrix< AddTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct AddTrait< CompactDiagonalMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompactDiagonalMatrix< AddTrait_<T1,T2>, SO1 >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2, size_t M, size_t N >
+struct SubTrait< CompactDiagonalMatrix<T1,SO>, StaticMatrix<T2,M,N,SO> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct SubTrait< StaticMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = StaticMatrix< SubTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, size_t M, size_t N >
+struct SubTrait< CompactDiagonalMatrix<T1,SO>, HybridMatrix<T2,M,N,SO> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO, typename T2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct SubTrait< HybridMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = HybridMatrix< SubTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO>, DynamicMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< DynamicMatrix<T1,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< DynamicMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2, bool AF, bool PF >
+struct SubTrait< CompactDiagonalMatrix<T1,SO>, CustomMatrix<T2,AF,PF,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO, typename T2 >
+struct SubTrait< CustomMatrix<T1,AF,PF,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CustomMatrix<T1,AF,PF,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< SubTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SubTrait< CompressedMatrix<T1,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompressedMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< SubTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, IdentityMatrix<T2,SO2> >
+{
+   using Type = CompactDiagonalMatrix< SubTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< IdentityMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompactDiagonalMatrix< SubTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SubTrait< CompactDiagonalMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompactDiagonalMatrix< SubTrait_<T1,T2>, SO1 >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SCHURTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SchurTrait< CompactDiagonalMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct SchurTrait< StaticMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct SchurTrait< CompactDiagonalMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct SchurTrait< HybridMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SchurTrait< CompactDiagonalMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SchurTrait< DynamicMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2 >
+struct SchurTrait< CompactDiagonalMatrix<T1,SO1>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2 >
+struct SchurTrait< CustomMatrix<T1,AF,PF,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SchurTrait< CompactDiagonalMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SchurTrait< CompactDiagonalMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct SchurTrait< CompressedMatrix<T1,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SchurTrait< CompressedMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SchurTrait< CompactDiagonalMatrix<T1,SO1>, IdentityMatrix<T2,SO2> >
+{
+   using Type = CompactDiagonalMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SchurTrait< IdentityMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompactDiagonalMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct SchurTrait< CompactDiagonalMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompactDiagonalMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, T2, EnableIf_< IsNumeric<T2> > >
+{
+   using Type = CompactDiagonalMatrix< MultTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< T1, CompactDiagonalMatrix<T2,SO>, EnableIf_< IsNumeric<T1> > >
+{
+   using Type = CompactDiagonalMatrix< MultTrait_<T1,T2>, SO >;
+};
+
+template< typename T1, bool SO, typename T2, size_t N >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, StaticVector<T2,N,false> >
+{
+   using Type = StaticVector< MultTrait_<T1,T2>, N, false >;
+};
+
+template< typename T1, size_t N, typename T2, bool SO >
+struct MultTrait< StaticVector<T1,N,true>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = StaticVector< MultTrait_<T1,T2>, N, true >;
+};
+
+template< typename T1, bool SO, typename T2, size_t N >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, HybridVector<T2,N,false> >
+{
+   using Type = HybridVector< MultTrait_<T1,T2>, N, false >;
+};
+
+template< typename T1, size_t N, typename T2, bool SO >
+struct MultTrait< HybridVector<T1,N,true>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = HybridVector< MultTrait_<T1,T2>, N, true >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, DynamicVector<T2,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< DynamicVector<T1,true>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2, bool AF, bool PF >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, CustomVector<T2,AF,PF,false> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, bool AF, bool PF, typename T2, bool SO >
+struct MultTrait< CustomVector<T1,AF,PF,true>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = DynamicVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO, typename T2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO>, CompressedVector<T2,false> >
+{
+   using Type = CompressedVector< MultTrait_<T1,T2>, false >;
+};
+
+template< typename T1, typename T2, bool SO >
+struct MultTrait< CompressedVector<T1,true>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = CompressedVector< MultTrait_<T1,T2>, true >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, StaticMatrix<T2,M,N,SO2> >
+{
+   using Type = StaticMatrix< MultTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct MultTrait< StaticMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = StaticMatrix< MultTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, size_t M, size_t N, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, HybridMatrix<T2,M,N,SO2> >
+{
+   using Type = HybridMatrix< MultTrait_<T1,T2>, M, N, SO2 >;
+};
+
+template< typename T1, size_t M, size_t N, bool SO1, typename T2, bool SO2 >
+struct MultTrait< HybridMatrix<T1,M,N,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = HybridMatrix< MultTrait_<T1,T2>, M, N, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, DynamicMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< DynamicMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool AF, bool PF, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, CustomMatrix<T2,AF,PF,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool AF, bool PF, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CustomMatrix<T1,AF,PF,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = DynamicMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, CompressedMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompressedMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompressedMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, IdentityMatrix<T2,SO2> >
+{
+   using Type = CompactDiagonalMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< IdentityMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompactDiagonalMatrix< MultTrait_<T1,T2>, SO2 >;
+};
+
+template< typename T1, bool SO1, typename T2, bool SO2 >
+struct MultTrait< CompactDiagonalMatrix<T1,SO1>, CompactDiagonalMatrix<T2,SO2> >
+{
+   using Type = CompactDiagonalMatrix< MultTrait_<T1,T2>, SO1 >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct DivTrait< CompactDiagonalMatrix<T1,SO>, T2, EnableIf_< IsNumeric<T2> > >
+{
+   using Type = CompactDiagonalMatrix< DivTrait_<T1,T2>, SO >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UNARYMAPTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename OP >
+struct UnaryMapTrait< CompactDiagonalMatrix<T,SO>, OP >
+{
+   using Type = CompressedMatrix< UnaryMapTrait_<T,OP>, SO >;
+};
+
+template< typename T, bool SO >
+struct UnaryMapTrait< CompactDiagonalMatrix<T,SO>, Abs >
+{
+   using Type = CompactDiagonalMatrix< UnaryMapTrait_<T,Abs>, SO >;
+};
+
+template< typename T, bool SO >
+struct UnaryMapTrait< CompactDiagonalMatrix<T,SO>, Floor >
+{
+   using Type = CompactDiagonalMatrix< UnaryMapTrait_<T,Floor>, SO >;
+};
+
+template< typename T, bool SO >
+struct UnaryMapTrait< CompactDiagonalMatrix<T,SO>, Ceil >
+{
+   using Type = CompactDiagonalMatrix< UnaryMapTrait_<T,Ceil>, SO >;
+};
+
+template< typename T, bool SO >
+struct UnaryMapTrait< CompactDiagonalMatrix<T,SO>, Trunc >
+{
+   using Type = CompactDiagonalMatrix< UnaryMapTrait_<T,Trunc>, SO >;
+};
+
+template< typename T, bool SO >
+struct UnaryMapTrait< CompactDiagonalMatrix<T,SO>, Round >
+{
+   using Type = CompactDiagonalMatrix< UnaryMapTrait_<T,Round>, SO >;
+};
+
+template< typename T, bool SO >
+struct UnaryMapTrait< CompactDiagonalMatrix<T,SO>, Conj >
+{
+   using Type = CompactDiagonalMatrix< UnaryMapTrait_<T,Conj>, SO >;
+};
+
+template< typename T, bool SO >
+struct UnaryMapTrait< CompactDiagonalMatrix<T,SO>, Real >
+{
+   using Type = CompactDiagonalMatrix< UnaryMapTrait_<T,Real>, SO >;
+};
+
+template< typename T, bool SO >
+struct UnaryMapTrait< CompactDiagonalMatrix<T,SO>, Sqrt >
+{
+   using Type = CompactDiagonalMatrix< UnaryMapTrait_<T,Sqrt>, SO >;
+};
+
+template< typename T, bool SO >
+struct UnaryMapTrait< CompactDiagonalMatrix<T,SO>, Cbrt >
+{
+   using Type = CompactDiagonalMatrix< UnaryMapTrait_<T,Cbrt>, SO >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLSYMTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct DeclSymTrait< CompactDiagonalMatrix<T,SO> >
+{
+   using Type = CompactDiagonalMatrix<T,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLHERMTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct DeclHermTrait< CompactDiagonalMatrix<T,SO> >
+{
+   using Type = CompactDiagonalMatrix<T,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLLOWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct DeclLowTrait< CompactDiagonalMatrix<T,SO> >
+{
+   using Type = CompactDiagonalMatrix<T,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLUPPTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct DeclUppTrait< CompactDiagonalMatrix<T,SO> >
+{
+   using Type = CompactDiagonalMatrix<T,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECLDIAGTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO >
+struct DeclDiagTrait< CompactDiagonalMatrix<T,SO> >
+{
+   using Type = CompactDiagonalMatrix<T,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HIGHTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct HighType< CompactDiagonalMatrix<T1,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = CompactDiagonalMatrix< typename HighType<T1,T2>::Type, SO >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOWTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename T2 >
+struct LowType< CompactDiagonalMatrix<T1,SO>, CompactDiagonalMatrix<T2,SO> >
+{
+   using Type = CompactDiagonalMatrix< typename LowType<T1,T2>::Type, SO >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct SubmatrixTrait< CompactDiagonalMatrix<T1,SO> >
+{
+   using Type = CompressedMatrix<T1,SO>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct RowTrait< CompactDiagonalMatrix<T1,SO> >
+{
+   using Type = CompressedVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO >
+struct ColumnTrait< CompactDiagonalMatrix<T1,SO> >
+{
+   using Type = CompressedVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 #include <vector>
 #include <blaze/math/Aliases.h>
@@ -72,6 +73,7 @@
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/LowType.h>
+#include <blaze/system/SparseIndex.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Max.h>
@@ -101,6 +103,8 @@ namespace blaze {
 //
 //=================================================================================================
 
+inline namespace BLAZE_SPARSE_INDEX_NAMESPACE {
+
 //*************************************************************************************************
 /*!\defgroup compressed_matrix CompressedMatrix
 // \ingroup sparse_matrix
@@ -218,8 +222,8 @@ class CompressedMatrix
 {
  private:
    //**Type definitions****************************************************************************
-   using ElementBase  = ValueIndexPair<Type>;  //!< Base class for the compressed matrix element.
-   using IteratorBase = ElementBase*;          //!< Iterator over non-constant base elements.
+   using ElementBase  = ValueIndexPair<Type,SparseIndex>;  //!< Base class for the compressed matrix element.
+   using IteratorBase = ElementBase*;                      //!< Iterator over non-constant base elements.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -493,6 +497,8 @@ class CompressedMatrix
 
    inline Iterator     castDown( IteratorBase it ) const noexcept;
    inline IteratorBase castUp  ( Iterator     it ) const noexcept;
+
+   static inline size_t checkColumns( size_t n );
    //@}
    //**********************************************************************************************
 
@@ -528,6 +534,8 @@ class CompressedMatrix
 };
 //*************************************************************************************************
 
+} // namespace BLAZE_SPARSE_INDEX_NAMESPACE
+
 
 
 
@@ -576,7 +584,7 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
    : m_       ( m )                     // The current number of rows of the compressed matrix
-   , n_       ( n )                     // The current number of columns of the compressed matrix
+   , n_       ( checkColumns( n ) )     // The current number of columns of the compressed matrix
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
@@ -600,7 +608,7 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
    : m_       ( m )                     // The current number of rows of the compressed matrix
-   , n_       ( n )                     // The current number of columns of the compressed matrix
+   , n_       ( checkColumns( n ) )     // The current number of columns of the compressed matrix
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
@@ -628,7 +636,7 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
    : m_       ( m )                      // The current number of rows of the compressed matrix
-   , n_       ( n )                      // The current number of columns of the compressed matrix
+   , n_       ( checkColumns( n ) )      // The current number of columns of the compressed matrix
    , capacity_( m )                      // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
@@ -706,18 +714,16 @@ template< typename Type  // Data type of the matrix
 template< typename MT    // Type of the foreign dense matrix
         , bool SO2 >     // Storage order of the foreign dense matrix
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the compressed matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the compressed matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
+   : m_       ( (~dm).rows() )                     // The current number of rows of the compressed matrix
+   , n_       ( checkColumns( (~dm).columns() ) )  // The current number of columns of the compressed matrix
+   , capacity_( m_ )                               // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*m_+2UL] )         // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                  // Pointers one past the last non-zero element of each row
 {
-   using blaze::assign;
-
    for( size_t i=0UL; i<2UL*m_+2UL; ++i )
       begin_[i] = nullptr;
 
-   assign( *this, ~dm );
+   smpAssign( *this, ~dm );
 }
 //*************************************************************************************************
 
@@ -732,22 +738,29 @@ template< typename Type  // Data type of the matrix
 template< typename MT    // Type of the foreign compressed matrix
         , bool SO2 >     // Storage order of the foreign compressed matrix
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the compressed matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the compressed matrix
-   , capacity_( m_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*m_+2UL] )  // Pointers to the first non-zero element of each row
-   , end_     ( begin_+(m_+1UL) )           // Pointers one past the last non-zero element of each row
-{
-   using blaze::assign;
-
-   const size_t nonzeros( (~sm).nonZeros() );
+   : m_       ( (~sm).rows() )                     // The current number of rows of the compressed matrix
+   , n_       ( checkColumns( (~sm).columns() ) )  // The current number of columns of the compressed matrix
+   , capacity_( m_ )                               // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*m_+2UL] )         // Pointers to the first non-zero element of each row
+   , end_     ( begin_+(m_+1UL) )                  // Pointers one past the last non-zero element of each row
+{
+   // Reserving the storage only in case the SMP assignment does not allocate it itself
+   if( smpAssembles( *this, ~sm ) )
+   {
+      for( size_t i=0UL; i<2UL*m_+2UL; ++i )
+         begin_[i] = nullptr;
+   }
+   else
+   {
+      const size_t nonzeros( (~sm).nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
-   for( size_t i=0UL; i<m_; ++i )
-      begin_[i+1UL] = end_[i] = begin_[0UL];
-   end_[m_] = begin_[0UL]+nonzeros;
+      begin_[0UL] = allocate<Element>( nonzeros );
+      for( size_t i=0UL; i<m_; ++i )
+         begin_[i+1UL] = end_[i] = begin_[0UL];
+      end_[m_] = begin_[0UL]+nonzeros;
+   }
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 //*************************************************************************************************
 
@@ -1136,15 +1149,13 @@ template< typename MT    // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1168,8 +1179,6 @@ template< typename MT    // Type of the right-hand side compressed matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).rows()     > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -1179,7 +1188,7 @@ inline CompressedMatrix<Type,SO>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1204,13 +1213,11 @@ template< typename MT    // Type of the right-hand side matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   addAssign( *this, ~rhs );
+   smpAddAssign( *this, ~rhs );
    return *this;
 }
 //*************************************************************************************************
@@ -1232,13 +1239,11 @@ template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
 inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   subAssign( *this, ~rhs );
+   smpSubAssign( *this, ~rhs );
    return *this;
 }
 //*************************************************************************************************
@@ -1592,6 +1597,8 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 {
+   checkColumns( n );
+
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
@@ -1942,6 +1949,31 @@ inline typename CompressedMatrix<Type,SO>::IteratorBase
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checks the given number of columns against the range of the sparse index type.
+//
+// \param n The number of columns of the matrix.
+// \return The given number of columns.
+// \exception std::invalid_argument Invalid number of columns.
+//
+// This function checks whether all column indices of a row-major matrix with \a n columns can
+// be represented by the configured sparse index type (see the BLAZE_SPARSE_INDEX_TYPE setting
+// in <tt>./blaze/config/SparseIndex.h</tt>). In case the number of columns exceeds the range
+// of the index type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompressedMatrix<Type,SO>::checkColumns( size_t n )
+{
+   if( n > std::numeric_limits<SparseIndex>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of columns for the sparse index type" );
+   }
+
+   return n;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2996,8 +3028,8 @@ class CompressedMatrix<Type,true>
 {
  private:
    //**Type definitions****************************************************************************
-   using ElementBase  = ValueIndexPair<Type>;  //!< Base class for the compressed matrix element.
-   using IteratorBase = ElementBase*;          //!< Iterator over non-constant base elements.
+   using ElementBase  = ValueIndexPair<Type,SparseIndex>;  //!< Base class for the compressed matrix element.
+   using IteratorBase = ElementBase*;                      //!< Iterator over non-constant base elements.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -3271,6 +3303,8 @@ class CompressedMatrix<Type,true>
 
    inline Iterator     castDown( IteratorBase it ) const noexcept;
    inline IteratorBase castUp  ( Iterator     it ) const noexcept;
+
+   static inline size_t checkRows( size_t m );
    //@}
    //**********************************************************************************************
 
@@ -3355,7 +3389,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix()
 */
 template< typename Type >  // Data type of the matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
-   : m_       ( m )                     // The current number of rows of the compressed matrix
+   : m_       ( checkRows( m ) )        // The current number of rows of the compressed matrix
    , n_       ( n )                     // The current number of columns of the compressed matrix
    , capacity_( n )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
@@ -3380,7 +3414,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
 */
 template< typename Type >  // Data type of the matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
-   : m_       ( m )                     // The current number of rows of the compressed matrix
+   : m_       ( checkRows( m ) )        // The current number of rows of the compressed matrix
    , n_       ( n )                     // The current number of columns of the compressed matrix
    , capacity_( n )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
@@ -3408,7 +3442,7 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t
 */
 template< typename Type >  // Data type of the matrix
 CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
-   : m_       ( m )                      // The current number of rows of the compressed matrix
+   : m_       ( checkRows( m ) )         // The current number of rows of the compressed matrix
    , n_       ( n )                      // The current number of columns of the compressed matrix
    , capacity_( n )                      // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
@@ -3490,18 +3524,16 @@ template< typename Type >  // Data type of the matrix
 template< typename MT      // Type of the foreign dense matrix
         , bool SO >        // Storage order of the foreign dense matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
-   : m_       ( (~dm).rows() )              // The current number of rows of the compressed matrix
-   , n_       ( (~dm).columns() )           // The current number of columns of the compressed matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
+   : m_       ( checkRows( (~dm).rows() ) )  // The current number of rows of the compressed matrix
+   , n_       ( (~dm).columns() )            // The current number of columns of the compressed matrix
+   , capacity_( n_ )                         // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*n_+2UL] )   // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )            // Pointers one past the last non-zero element of each column
 {
-   using blaze::assign;
-
    for( size_t j=0UL; j<2UL*n_+2UL; ++j )
       begin_[j] = nullptr;
 
-   assign( *this, ~dm );
+   smpAssign( *this, ~dm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3517,22 +3549,29 @@ template< typename Type >  // Data type of the matrix
 template< typename MT      // Type of the foreign compressed matrix
         , bool SO >        // Storage order of the foreign compressed matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
-   : m_       ( (~sm).rows() )              // The current number of rows of the compressed matrix
-   , n_       ( (~sm).columns() )           // The current number of columns of the compressed matrix
-   , capacity_( n_ )                        // The current capacity of the pointer array
-   , begin_   ( new Iterator[2UL*n_+2UL] )  // Pointers to the first non-zero element of each column
-   , end_     ( begin_+(n_+1UL) )           // Pointers one past the last non-zero element of each column
-{
-   using blaze::assign;
-
-   const size_t nonzeros( (~sm).nonZeros() );
+   : m_       ( checkRows( (~sm).rows() ) )  // The current number of rows of the compressed matrix
+   , n_       ( (~sm).columns() )            // The current number of columns of the compressed matrix
+   , capacity_( n_ )                         // The current capacity of the pointer array
+   , begin_   ( new Iterator[2UL*n_+2UL] )   // Pointers to the first non-zero element of each column
+   , end_     ( begin_+(n_+1UL) )            // Pointers one past the last non-zero element of each column
+{
+   // Reserving the storage only in case the SMP assignment does not allocate it itself
+   if( smpAssembles( *this, ~sm ) )
+   {
+      for( size_t j=0UL; j<2UL*n_+2UL; ++j )
+         begin_[j] = nullptr;
+   }
+   else
+   {
+      const size_t nonzeros( (~sm).nonZeros() );
 
-   begin_[0UL] = allocate<Element>( nonzeros );
-   for( size_t j=0UL; j<n_; ++j )
-      begin_[j+1UL] = end_[j] = begin_[0UL];
-   end_[n_] = begin_[0UL]+nonzeros;
+      begin_[0UL] = allocate<Element>( nonzeros );
+      for( size_t j=0UL; j<n_; ++j )
+         begin_[j+1UL] = end_[j] = begin_[0UL];
+      end_[n_] = begin_[0UL]+nonzeros;
+   }
 
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3905,15 +3944,13 @@ template< typename MT      // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const DenseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3938,8 +3975,6 @@ template< typename MT      // Type of the right-hand side compressed matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).columns()  > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -3949,7 +3984,7 @@ inline CompressedMatrix<Type,true>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -3974,13 +4009,11 @@ template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
 inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   addAssign( *this, ~rhs );
+   smpAddAssign( *this, ~rhs );
    return *this;
 }
 /*! \endcond */
@@ -4003,13 +4036,11 @@ template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
 inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   subAssign( *this, ~rhs );
+   smpSubAssign( *this, ~rhs );
    return *this;
 }
 /*! \endcond */
@@ -4366,6 +4397,8 @@ inline void CompressedMatrix<Type,true>::clear()
 template< typename Type >  // Data type of the matrix
 void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 {
+   checkRows( m );
+
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
 
@@ -4758,6 +4791,32 @@ inline typename CompressedMatrix<Type,true>::Iterator
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the given number of rows against the range of the sparse index type.
+//
+// \param m The number of rows of the matrix.
+// \return The given number of rows.
+// \exception std::invalid_argument Invalid number of rows.
+//
+// This function checks whether all row indices of a column-major matrix with \a m rows can be
+// represented by the configured sparse index type (see the BLAZE_SPARSE_INDEX_TYPE setting in
+// <tt>./blaze/config/SparseIndex.h</tt>). In case the number of rows exceeds the range of the
+// index type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t CompressedMatrix<Type,true>::checkRows( size_t m )
+{
+   if( m > std::numeric_limits<SparseIndex>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of rows for the sparse index type" );
+   }
+
+   return m;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Inserting an element into the compressed matrix.
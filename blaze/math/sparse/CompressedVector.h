@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/DenseVector.h>
@@ -67,6 +68,7 @@
 #include <blaze/math/typetraits/IsShrinkable.h>
 #include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/LowType.h>
+#include <blaze/system/SparseIndex.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
 #include <blaze/util/algorithms/Max.h>
@@ -98,6 +100,8 @@ namespace blaze {
 //
 //=================================================================================================
 
+inline namespace BLAZE_SPARSE_INDEX_NAMESPACE {
+
 //*************************************************************************************************
 /*!\defgroup compressed_vector CompressedVector
 // \ingroup sparse_vector
@@ -199,8 +203,8 @@ class CompressedVector
 {
  private:
    //**Type definitions****************************************************************************
-   using ElementBase  = ValueIndexPair<Type>;  //!< Base class for the compressed vector element.
-   using IteratorBase = ElementBase*;          //!< Iterator over non-constant base elements.
+   using ElementBase  = ValueIndexPair<Type,SparseIndex>;  //!< Base class for the compressed vector element.
+   using IteratorBase = ElementBase*;                      //!< Iterator over non-constant base elements.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -319,7 +323,7 @@ class CompressedVector
    /*!\name Constructors */
    //@{
                            explicit inline CompressedVector() noexcept;
-                           explicit inline CompressedVector( size_t size ) noexcept;
+                           explicit inline CompressedVector( size_t size );
                            explicit inline CompressedVector( size_t size, size_t nonzeros );
                                     inline CompressedVector( const CompressedVector& sv );
                                     inline CompressedVector( CompressedVector&& sv ) noexcept;
@@ -458,6 +462,8 @@ class CompressedVector
    inline size_t       extendCapacity() const noexcept;
    inline Iterator     castDown( IteratorBase it ) const noexcept;
    inline IteratorBase castUp  ( Iterator     it ) const noexcept;
+
+   static inline size_t checkSize( size_t n );
    //@}
    //**********************************************************************************************
 
@@ -492,6 +498,8 @@ class CompressedVector
 };
 //*************************************************************************************************
 
+} // namespace BLAZE_SPARSE_INDEX_NAMESPACE
+
 
 
 
@@ -532,14 +540,15 @@ inline CompressedVector<Type,TF>::CompressedVector() noexcept
 /*!\brief Constructor for a compressed vector of size \a n.
 //
 // \param n The size of the vector.
+// \exception std::invalid_argument Invalid size for the sparse index type.
 */
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( size_t n ) noexcept
-   : size_    ( n   )      // The current size/dimension of the compressed vector
-   , capacity_( 0UL )      // The maximum capacity of the compressed vector
-   , begin_   ( nullptr )  // Pointer to the first non-zero element of the compressed vector
-   , end_     ( nullptr )  // Pointer to the last non-zero element of the compressed vector
+inline CompressedVector<Type,TF>::CompressedVector( size_t n )
+   : size_    ( checkSize( n ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL )             // The maximum capacity of the compressed vector
+   , begin_   ( nullptr )         // Pointer to the first non-zero element of the compressed vector
+   , end_     ( nullptr )         // Pointer to the last non-zero element of the compressed vector
 {}
 //*************************************************************************************************
 
@@ -553,7 +562,7 @@ inline CompressedVector<Type,TF>::CompressedVector( size_t n ) noexcept
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline CompressedVector<Type,TF>::CompressedVector( size_t n, size_t nonzeros )
-   : size_    ( n )                               // The current size/dimension of the compressed vector
+   : size_    ( checkSize( n ) )                  // The current size/dimension of the compressed vector
    , capacity_( nonzeros )                        // The maximum capacity of the compressed vector
    , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
    , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
@@ -612,10 +621,10 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the foreign dense vector
 inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv )
-   : size_    ( (~dv).size() )  // The current size/dimension of the compressed vector
-   , capacity_( 0UL )           // The maximum capacity of the compressed vector
-   , begin_   ( nullptr )       // Pointer to the first non-zero element of the compressed vector
-   , end_     ( nullptr )       // Pointer to the last non-zero element of the compressed vector
+   : size_    ( checkSize( (~dv).size() ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL )                        // The maximum capacity of the compressed vector
+   , begin_   ( nullptr )                    // Pointer to the first non-zero element of the compressed vector
+   , end_     ( nullptr )                    // Pointer to the last non-zero element of the compressed vector
 {
    using blaze::assign;
    assign( *this, ~dv );
@@ -632,7 +641,7 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 template< typename VT >  // Type of the foreign sparse vector
 inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& sv )
-   : size_    ( (~sv).size() )                    // The current size/dimension of the compressed vector
+   : size_    ( checkSize( (~sv).size() ) )       // The current size/dimension of the compressed vector
    , capacity_( (~sv).nonZeros() )                // The maximum capacity of the compressed vector
    , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
    , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
@@ -1352,6 +1361,8 @@ template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline void CompressedVector<Type,TF>::resize( size_t n, bool preserve )
 {
+   checkSize( n );
+
    if( preserve ) {
       end_ = lowerBound( n );
    }
@@ -1493,6 +1504,31 @@ inline typename CompressedVector<Type,TF>::IteratorBase
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checks the given size against the range of the sparse index type.
+//
+// \param n The size of the vector.
+// \return The given size.
+// \exception std::invalid_argument Invalid size for the sparse index type.
+//
+// This function checks whether all indices of a vector of size \a n can be represented by the
+// configured sparse index type (see the BLAZE_SPARSE_INDEX_TYPE setting in the configuration
+// file <tt>./blaze/config/SparseIndex.h</tt>). In case the size exceeds the range of the index
+// type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline size_t CompressedVector<Type,TF>::checkSize( size_t n )
+{
+   if( n > std::numeric_limits<SparseIndex>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid size for the sparse index type" );
+   }
+
+   return n;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
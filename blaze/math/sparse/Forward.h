@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_SPARSE_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SparseIndex.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -44,9 +51,16 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, bool > class CompactDiagonalMatrix;
+
+inline namespace BLAZE_SPARSE_INDEX_NAMESPACE {
 template< typename, bool > class CompressedMatrix;
 template< typename, bool > class CompressedVector;
+template< typename, bool > class CustomCompressedMatrix;
+}
+
 template< typename, bool > class IdentityMatrix;
+template< typename > class SellMatrix;
 
 } // namespace blaze
 
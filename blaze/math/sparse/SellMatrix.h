@@ -0,0 +1,1729 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SellMatrix.h
+//  \brief Implementation of a sparse matrix in SELL-C-sigma format
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SELLMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SELLMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedVector.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/traits/ColumnTrait.h>
+#include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/traits/SubmatrixTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/IsSellMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsView.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/AlignedAllocator.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check for the availability of the gather-based SELL-C-sigma kernels.
+// \ingroup sell_matrix
+//
+// This type trait tests whether the multiplication of a SellMatrix with element type \a T and
+// a dense vector can be computed by means of SIMD gather instructions (i.e. whether AVX2 or
+// AVX-512 is available and \a T is either \c float or \c double).
+*/
+template< typename T >
+struct HasSellGather
+   : public BoolConstant< ( BLAZE_AVX2_MODE || BLAZE_AVX512F_MODE ) &&
+                          ( IsSame<T,float>::value || IsSame<T,double>::value ) >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\defgroup sell_matrix SellMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a row-major sparse matrix in SELL-C-sigma format.
+// \ingroup sell_matrix
+//
+// The SellMatrix class template is the representation of a row-major sparse matrix in the
+// SELL-C-sigma (sliced ELLPACK) storage format, which is tailored for fast sparse matrix/dense
+// vector multiplications. The type of the elements can be specified via the single template
+// parameter:
+
+   \code
+   template< typename Type >
+   class SellMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SellMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer, numeric element type.
+//
+// The rows of the matrix are grouped into chunks of \a C consecutive rows, where \a C is the
+// number of elements in a SIMD vector of the element type. Within each chunk the elements are
+// stored column by column, i.e. the k-th non-zero element of all rows of a chunk is stored
+// contiguously, and all rows of a chunk are padded to the length of the longest row of the
+// chunk. In order to minimize the padding, the rows are sorted by their number of non-zero
+// elements within windows of \a sigma consecutive rows before the chunks are formed. Due to
+// this layout the multiplication with a dense vector processes \a C rows at once with a single
+// SIMD gather per column of the chunk (in case AVX2 or AVX-512 is available and the element
+// type is \c float or \c double). Additionally, the chunks are distributed among the available
+// threads in case the number of rows exceeds the \c SMP_SMATDVECMULT_THRESHOLD.
+//
+// A SellMatrix is read-only: It is set up from any other matrix (typically a row-major
+// CompressedMatrix) and afterwards only provides read access to its elements. The following
+// example demonstrates the intended use of the SellMatrix class template:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SellMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 100000UL, 100000UL );
+   // ... Initialization of A
+
+   const SellMatrix<double> S( A );  // Conversion into SELL-C-sigma format
+
+   DynamicVector<double> x( 100000UL ), y;
+   // ... Initialization of x
+
+   y  = S * x;  // Vectorized and parallelized sparse matrix/dense vector multiplication
+   y += S * x;  // Vectorized and parallelized addition assignment
+   \endcode
+
+// Note that the column indices of a SellMatrix are stored as 32-bit integers. Therefore the
+// number of columns of a SellMatrix is restricted to the range of \c int32_t.
+*/
+template< typename Type >  // Data type of the matrix
+class SellMatrix
+   : public SparseMatrix< SellMatrix<Type>, false >
+{
+ private:
+   //**Type definitions****************************************************************************
+   using SIMDType = SIMDTrait_<Type>;  //!< SIMD type of the matrix elements.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = SellMatrix<Type>;               //!< Type of this SellMatrix instance.
+   using BaseType       = SparseMatrix<This,false>;       //!< Base type of this SellMatrix instance.
+   using ResultType     = CompressedMatrix<Type,false>;   //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,true>;    //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,true>;    //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                           //!< Type of the sparse matrix elements.
+   using ReturnType     = const Type;                     //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                    //!< Data type for composite expression templates.
+   using Reference      = const Type;                     //!< Reference to a sparse matrix element.
+   using ConstReference = const Type;                     //!< Reference to a constant sparse matrix element.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SellMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = SellMatrix<NewType>;  //!< The type of the other SellMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a SellMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = SellMatrix<Type>;  //!< The type of the other SellMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! The number of rows per chunk (i.e. the number of elements in a SIMD vector).
+   enum : size_t { SIMDSIZE = SIMDTrait<Type>::size };
+
+   //! The default sorting scope of the rows.
+   enum : size_t { defaultSigma = 32UL*SIMDSIZE };
+
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   enum : bool { smpAssignable = !IsSMPAssignable<Type>::value };
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of a row of the SELL-C-sigma matrix.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Element type of the SELL-C-sigma matrix.
+      using Element = ValueIndexPair<Type>;
+
+      using IteratorCategory = std::forward_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                    //!< Type of the underlying pointers.
+      using PointerType      = ValueType*;                 //!< Pointer return type.
+      using ReferenceType    = ValueType&;                 //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                  //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying pointers.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Default constructor**********************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator()
+         : values_ ( nullptr )  // Pointer to the values of the SELL-C-sigma matrix
+         , indices_( nullptr )  // Pointer to the column indices of the SELL-C-sigma matrix
+         , pos_    ( 0UL )      // Position of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param values Pointer to the values of the SELL-C-sigma matrix.
+      // \param indices Pointer to the column indices of the SELL-C-sigma matrix.
+      // \param pos The position of the initial element.
+      */
+      inline ConstIterator( const Type* values, const int32_t* indices, size_t pos )
+         : values_ ( values  )  // Pointer to the values of the SELL-C-sigma matrix
+         , indices_( indices )  // Pointer to the column indices of the SELL-C-sigma matrix
+         , pos_    ( pos     )  // Position of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() {
+         pos_ += SIMDSIZE;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline ConstIterator operator++( int ) {
+         ConstIterator tmp( *this );
+         pos_ += SIMDSIZE;
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Element operator*() const {
+         return Element( values_[pos_], indices_[pos_] );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the sparse matrix element at the current iterator position.
+      //
+      // \return Reference to the sparse matrix element at the current iterator position.
+      */
+      inline const ConstIterator* operator->() const {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return The current value of the sparse element.
+      */
+      inline const Type& value() const {
+         return values_[pos_];
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const {
+         return static_cast<size_t>( indices_[pos_] );
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const {
+         return pos_ == rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const {
+         return pos_ != rhs.pos_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side ConstIterator object.
+      // \return The number of elements between the two ConstIterator objects.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const {
+         return ( static_cast<DifferenceType>( pos_ ) - static_cast<DifferenceType>( rhs.pos_ ) )
+                / static_cast<DifferenceType>( SIMDSIZE );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type*    values_;   //!< Pointer to the values of the SELL-C-sigma matrix.
+      const int32_t* indices_;  //!< Pointer to the column indices of the SELL-C-sigma matrix.
+      size_t         pos_;      //!< Position of the current element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Iterator = ConstIterator;  //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SellMatrix() noexcept;
+   explicit inline SellMatrix( size_t m, size_t n, size_t sigma = defaultSigma );
+
+   template< typename MT, bool SO >
+   explicit inline SellMatrix( const Matrix<MT,SO>& m, size_t sigma = defaultSigma );
+
+   // No explicitly declared copy constructor.
+   // No explicitly declared move constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   template< typename MT, bool SO >
+   inline SellMatrix& operator=( const Matrix<MT,SO>& rhs );
+
+   // No explicitly declared copy assignment operator.
+   // No explicitly declared move assignment operator.
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t sigma() const noexcept;
+   inline size_t chunks() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   reset();
+   inline void   clear();
+   inline void   swap( SellMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the explicit application of the SFINAE principle.
+   template< typename VT >
+   struct VectorizedMult {
+      enum : bool { value = HasSellGather<Type>::value &&
+                            IsSame< ElementType_<VT>, Type >::value &&
+                            HasConstDataAccess<VT>::value && !IsView<VT>::value };
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< size_t OP, typename VT1, typename VT2 >
+   inline DisableIf_< VectorizedMult<VT2> >
+      mult( VT1& y, const VT2& x, size_t begin, size_t end ) const;
+
+   template< size_t OP, typename VT1, typename VT2 >
+   inline EnableIf_< VectorizedMult<VT2> >
+      mult( VT1& y, const VT2& x, size_t begin, size_t end ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT >
+   void setup( const SparseMatrix<MT,false>& rhs );
+
+   template< typename MT, bool SO >
+   inline void setup( const Matrix<MT,SO>& m );
+
+   template< size_t OP, typename VT, typename T >
+   static BLAZE_ALWAYS_INLINE void store( VT& y, size_t i, const T& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using Values  = std::vector< Type, AlignedAllocator<Type> >;        //!< Type of the value array.
+   using Indices = std::vector< int32_t, AlignedAllocator<int32_t> >;  //!< Type of the index arrays.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;                      //!< The current number of rows of the sparse matrix.
+   size_t n_;                      //!< The current number of columns of the sparse matrix.
+   size_t sigma_;                  //!< The sorting scope of the rows.
+   size_t nonZeros_;               //!< The total number of non-zero elements.
+   std::vector<size_t> perm_;      //!< The row index of each slot.
+   std::vector<size_t> slot_;      //!< The slot of each row.
+   std::vector<size_t> offset_;    //!< The offsets of the chunks within the value and index arrays.
+   std::vector<size_t> minWidth_;  //!< The length of the shortest row of each chunk.
+   Indices lengths_;               //!< The number of non-zero elements of each slot.
+   Values  values_;                //!< The values of the sparse matrix (chunk-wise, column by column).
+   Indices indices_;               //!< The column indices of the sparse matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SellMatrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline SellMatrix<Type>::SellMatrix() noexcept
+   : m_       ( 0UL )           // The current number of rows of the sparse matrix
+   , n_       ( 0UL )           // The current number of columns of the sparse matrix
+   , sigma_   ( defaultSigma )  // The sorting scope of the rows
+   , nonZeros_( 0UL )           // The total number of non-zero elements
+   , perm_    ()                // The row index of each slot
+   , slot_    ()                // The slot of each row
+   , offset_  ( 1UL, 0UL )      // The offsets of the chunks
+   , minWidth_()                // The length of the shortest row of each chunk
+   , lengths_ ()                // The number of non-zero elements of each slot
+   , values_  ()                // The values of the sparse matrix
+   , indices_ ()                // The column indices of the sparse matrix
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for an empty \f$ M \times N \f$ SellMatrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param sigma The sorting scope of the rows \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid sorting scope.
+// \exception std::invalid_argument Invalid number of columns.
+*/
+template< typename Type >  // Data type of the matrix
+inline SellMatrix<Type>::SellMatrix( size_t m, size_t n, size_t sigma )
+   : SellMatrix()
+{
+   sigma_ = sigma;
+   setup( CompressedMatrix<Type,false>( m, n ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be converted into SELL-C-sigma format.
+// \param sigma The sorting scope of the rows \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid sorting scope.
+// \exception std::invalid_argument Invalid number of columns.
+//
+// The rows of the given matrix are sorted by their number of non-zero elements within windows
+// of \a sigma rows before they are grouped into chunks. A larger sorting scope reduces the
+// amount of padding, a \a sigma of 1 preserves the original order of the rows. In case the
+// sorting scope is 0 or the number of columns exceeds the range of \c int32_t, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the foreign matrix
+        , bool SO >        // Storage order of the foreign matrix
+inline SellMatrix<Type>::SellMatrix( const Matrix<MT,SO>& m, size_t sigma )
+   : SellMatrix()
+{
+   sigma_ = sigma;
+   setup( ~m );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstReference
+   SellMatrix<Type>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid SELL matrix row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid SELL matrix column access index" );
+
+   const ConstIterator pos( find( i, j ) );
+
+   if( pos != end( i ) )
+      return pos->value();
+   else
+      return Type();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstReference
+   SellMatrix<Type>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid SELL matrix row access index" );
+
+   const size_t s( slot_[i] );
+   return ConstIterator( values_.data(), indices_.data(), offset_[s/SIMDSIZE] + s%SIMDSIZE );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid SELL matrix row access index" );
+
+   const size_t s( slot_[i] );
+   return ConstIterator( values_.data(), indices_.data(),
+                         offset_[s/SIMDSIZE] + s%SIMDSIZE + lengths_[s]*SIMDSIZE );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different matrices.
+//
+// \param rhs Matrix to be converted into SELL-C-sigma format.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid number of columns.
+//
+// The matrix is set up with the current sorting scope. In case the number of columns of the
+// given matrix exceeds the range of \c int32_t, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the right-hand side matrix
+        , bool SO >        // Storage order of the right-hand side matrix
+inline SellMatrix<Type>& SellMatrix<Type>::operator=( const Matrix<MT,SO>& rhs )
+{
+   SellMatrix tmp( ~rhs, sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the sorting scope of the rows.
+//
+// \return The number of consecutive rows that are sorted by their number of non-zero elements.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::sigma() const noexcept
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the sparse matrix.
+//
+// \return The number of chunks of \a SIMDSIZE rows.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::chunks() const noexcept
+{
+   return minWidth_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the sparse matrix.
+//
+// \return The capacity of the sparse matrix including the padding of all chunks.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::capacity() const noexcept
+{
+   return values_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The capacity of row \a i, i.e. the length of the longest row of its chunk.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t c( slot_[i] / SIMDSIZE );
+   return ( offset_[c+1UL] - offset_[c] ) / SIMDSIZE;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::nonZeros() const noexcept
+{
+   return nonZeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type >  // Data type of the matrix
+inline size_t SellMatrix<Type>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   return static_cast<size_t>( lengths_[slot_[i]] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+//
+// This function removes all non-zero elements from the matrix. The size of the matrix and the
+// sorting scope are preserved.
+*/
+template< typename Type >  // Data type of the matrix
+inline void SellMatrix<Type>::reset()
+{
+   SellMatrix tmp( m_, n_, sigma_ );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0. The sorting scope is
+// preserved.
+*/
+template< typename Type >  // Data type of the matrix
+inline void SellMatrix<Type>::clear()
+{
+   SellMatrix tmp;
+   tmp.sigma_ = sigma_;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two SELL-C-sigma matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void SellMatrix<Type>::swap( SellMatrix& m ) noexcept
+{
+   using std::swap;
+
+   swap( m_       , m.m_        );
+   swap( n_       , m.n_        );
+   swap( sigma_   , m.sigma_    );
+   swap( nonZeros_, m.nonZeros_ );
+   perm_.swap    ( m.perm_     );
+   slot_.swap    ( m.slot_     );
+   offset_.swap  ( m.offset_   );
+   minWidth_.swap( m.minWidth_ );
+   lengths_.swap ( m.lengths_  );
+   values_.swap  ( m.values_   );
+   indices_.swap ( m.indices_  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the SELL-C-sigma matrix from a row-major sparse matrix.
+//
+// \param rhs The row-major sparse matrix.
+// \return void
+// \exception std::invalid_argument Invalid sorting scope.
+// \exception std::invalid_argument Invalid number of columns.
+//
+// This function determines the number of non-zero elements of all rows, sorts the rows within
+// windows of \a sigma rows by their number of non-zero elements (in descending order) and fills
+// the chunks. The padding elements are set to zero and refer to column 0. Note that the function
+// assumes the matrix to be in default state.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >    // Type of the row-major sparse matrix
+void SellMatrix<Type>::setup( const SparseMatrix<MT,false>& rhs )
+{
+   using ConstIterator_t = ConstIterator_< RemoveReference_< CompositeType_<MT> > >;
+
+   if( sigma_ == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid sorting scope" );
+   }
+
+   if( (~rhs).columns() > static_cast<size_t>( std::numeric_limits<int32_t>::max() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of columns" );
+   }
+
+   CompositeType_<MT> A( ~rhs );  // Evaluation of the sparse matrix
+
+   const size_t m( A.rows() );
+   const size_t chunks( ( m + SIMDSIZE - 1UL ) / SIMDSIZE );
+
+   std::vector<size_t> length( m );
+   std::vector<size_t> perm( m );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( ConstIterator_t element=A.begin(i); element!=A.end(i); ++element ) {
+         ++length[i];
+      }
+      perm[i] = i;
+   }
+
+   for( size_t i=0UL; i<m; i+=sigma_ ) {
+      std::stable_sort( perm.begin()+i, perm.begin()+std::min( i+sigma_, m ),
+                        [&length]( size_t r1, size_t r2 ) { return length[r1] > length[r2]; } );
+   }
+
+   std::vector<size_t> slot( m );
+   std::vector<size_t> offset( chunks+1UL, 0UL );
+   std::vector<size_t> minWidth( chunks, 0UL );
+   Indices lengths( chunks*SIMDSIZE, 0 );
+
+   size_t nonZeros( 0UL );
+
+   for( size_t c=0UL; c<chunks; ++c )
+   {
+      size_t minw( length[perm[c*SIMDSIZE]] );
+      size_t maxw( 0UL );
+
+      for( size_t k=0UL; k<SIMDSIZE; ++k ) {
+         const size_t s( c*SIMDSIZE+k );
+         const size_t len( ( s < m )?( length[perm[s]] ):( 0UL ) );
+         if( s < m ) {
+            slot[perm[s]] = s;
+         }
+         lengths[s] = static_cast<int32_t>( len );
+         minw = std::min( minw, len );
+         maxw = std::max( maxw, len );
+         nonZeros += len;
+      }
+
+      minWidth[c] = minw;
+      offset[c+1UL] = offset[c] + maxw*SIMDSIZE;
+   }
+
+   Values  values ( offset[chunks], Type() );
+   Indices indices( offset[chunks], 0 );
+
+   for( size_t s=0UL; s<m; ++s )
+   {
+      size_t pos( offset[s/SIMDSIZE] + s%SIMDSIZE );
+
+      for( ConstIterator_t element=A.begin(perm[s]); element!=A.end(perm[s]); ++element ) {
+         values [pos] = element->value();
+         indices[pos] = static_cast<int32_t>( element->index() );
+         pos += SIMDSIZE;
+      }
+   }
+
+   m_        = m;
+   n_        = A.columns();
+   nonZeros_ = nonZeros;
+   perm_.swap    ( perm     );
+   slot_.swap    ( slot     );
+   offset_.swap  ( offset   );
+   minWidth_.swap( minWidth );
+   lengths_.swap ( lengths  );
+   values_.swap  ( values   );
+   indices_.swap ( indices  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the SELL-C-sigma matrix from a dense or column-major matrix.
+//
+// \param m The dense or column-major matrix.
+// \return void
+// \exception std::invalid_argument Invalid sorting scope.
+// \exception std::invalid_argument Invalid number of columns.
+//
+// The given matrix is converted into a row-major compressed matrix, which is used for the setup
+// of the chunks.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT      // Type of the matrix
+        , bool SO >        // Storage order of the matrix
+inline void SellMatrix<Type>::setup( const Matrix<MT,SO>& m )
+{
+   setup( CompressedMatrix<Type,false>( ~m ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Storing a single result of the matrix/vector multiplication.
+//
+// \param y The target dense vector.
+// \param i The index of the target element.
+// \param value The result to be stored.
+// \return void
+//
+// Depending on \a OP the value is assigned to (0), added to (1) or subtracted from (2) the
+// target element.
+*/
+template< typename Type >  // Data type of the matrix
+template< size_t OP        // Type of the operation
+        , typename VT      // Type of the target dense vector
+        , typename T >     // Type of the result
+BLAZE_ALWAYS_INLINE void SellMatrix<Type>::store( VT& y, size_t i, const T& value )
+{
+   if( OP == 0UL )
+      y[i] = value;
+   else if( OP == 1UL )
+      y[i] += value;
+   else
+      y[i] -= value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else
+      return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t s( slot_[i] );
+   const size_t first( offset_[s/SIMDSIZE] + s%SIMDSIZE );
+
+   size_t lo( 0UL );
+   size_t hi( lengths_[s] );
+
+   while( lo < hi ) {
+      const size_t mid( ( lo + hi ) / 2UL );
+      if( static_cast<size_t>( indices_[first+mid*SIMDSIZE] ) < j )
+         lo = mid + 1UL;
+      else
+         hi = mid;
+   }
+
+   return ConstIterator( values_.data(), indices_.data(), first+lo*SIMDSIZE );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type >  // Data type of the matrix
+inline typename SellMatrix<Type>::ConstIterator
+   SellMatrix<Type>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t s( slot_[i] );
+   const size_t first( offset_[s/SIMDSIZE] + s%SIMDSIZE );
+
+   size_t lo( 0UL );
+   size_t hi( lengths_[s] );
+
+   while( lo < hi ) {
+      const size_t mid( ( lo + hi ) / 2UL );
+      if( static_cast<size_t>( indices_[first+mid*SIMDSIZE] ) <= j )
+         lo = mid + 1UL;
+      else
+         hi = mid;
+   }
+
+   return ConstIterator( values_.data(), indices_.data(), first+lo*SIMDSIZE );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type >   // Data type of the matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool SellMatrix<Type>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type >   // Data type of the matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool SellMatrix<Type>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows of the matrix).
+*/
+template< typename Type >  // Data type of the matrix
+inline bool SellMatrix<Type>::canSMPAssign() const noexcept
+{
+   return ( rows() > SMP_SMATDVECMULT_THRESHOLD );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default multiplication of a range of chunks with a dense vector.
+//
+// \param y The target dense vector.
+// \param x The right-hand side dense vector.
+// \param begin The index of the first chunk.
+// \param end The index one past the last chunk.
+// \return void
+//
+// This function implements the default (scalar) multiplication of the chunks \a begin to
+// \a end with the dense vector \a x. Depending on \a OP the results are assigned to (0), added
+// to (1) or subtracted from (2) the according elements of \a y.
+*/
+template< typename Type >  // Data type of the matrix
+template< size_t OP        // Type of the operation
+        , typename VT1     // Type of the target dense vector
+        , typename VT2 >   // Type of the right-hand side dense vector
+inline DisableIf_< typename SellMatrix<Type>::template VectorizedMult<VT2> >
+   SellMatrix<Type>::mult( VT1& y, const VT2& x, size_t begin, size_t end ) const
+{
+   using ET = ElementType_<VT1>;
+
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= chunks(), "Invalid chunk range" );
+
+   for( size_t s=begin*SIMDSIZE; s<std::min( end*SIMDSIZE, m_ ); ++s )
+   {
+      const size_t first( offset_[s/SIMDSIZE] + s%SIMDSIZE );
+      const size_t last ( first + lengths_[s]*SIMDSIZE );
+
+      ET sum = ET();
+      for( size_t pos=first; pos<last; pos+=SIMDSIZE ) {
+         sum += values_[pos] * x[indices_[pos]];
+      }
+
+      store<OP>( y, perm_[s], sum );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Gather of the elements of a dense vector referenced by a column of a chunk.
+// \ingroup sell_matrix
+//
+// The unmasked sellGather() functions gather the elements of \a x referenced by the \a SIMDSIZE
+// column indices \a idx. The masked variants additionally take the row lengths \a len of the
+// chunk and the current column \a j of the chunk and only gather the elements for rows with
+// more than \a j non-zero elements, the remaining elements are set to 0.
+*/
+#if BLAZE_AVX512F_MODE
+BLAZE_ALWAYS_INLINE SIMDdouble sellGather( const double* x, const int32_t* idx ) noexcept
+{
+   const __m256i index( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( idx ) ) );
+   return _mm512_i32gather_pd( index, x, 8 );
+}
+
+BLAZE_ALWAYS_INLINE SIMDfloat sellGather( const float* x, const int32_t* idx ) noexcept
+{
+   return _mm512_i32gather_ps( _mm512_loadu_si512( idx ), x, 4 );
+}
+
+BLAZE_ALWAYS_INLINE SIMDdouble
+   sellGather( const double* x, const int32_t* idx, const int32_t* len, int32_t j ) noexcept
+{
+   const __m256i length( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( len ) ) );
+   const __m256i index ( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( idx ) ) );
+   const __mmask8 mask( static_cast<__mmask8>(
+      _mm512_cmpgt_epi32_mask( _mm512_castsi256_si512( length ), _mm512_set1_epi32( j ) ) ) );
+   return _mm512_mask_i32gather_pd( _mm512_setzero_pd(), mask, index, x, 8 );
+}
+
+BLAZE_ALWAYS_INLINE SIMDfloat
+   sellGather( const float* x, const int32_t* idx, const int32_t* len, int32_t j ) noexcept
+{
+   const __m512i length( _mm512_loadu_si512( len ) );
+   const __m512i index ( _mm512_loadu_si512( idx ) );
+   const __mmask16 mask( _mm512_cmpgt_epi32_mask( length, _mm512_set1_epi32( j ) ) );
+   return _mm512_mask_i32gather_ps( _mm512_setzero_ps(), mask, index, x, 4 );
+}
+#elif BLAZE_AVX2_MODE
+BLAZE_ALWAYS_INLINE SIMDdouble sellGather( const double* x, const int32_t* idx ) noexcept
+{
+   const __m128i index( _mm_loadu_si128( reinterpret_cast<const __m128i*>( idx ) ) );
+   const __m256d mask ( _mm256_castsi256_pd( _mm256_set1_epi64x( -1 ) ) );
+   return _mm256_mask_i32gather_pd( _mm256_setzero_pd(), x, index, mask, 8 );
+}
+
+BLAZE_ALWAYS_INLINE SIMDfloat sellGather( const float* x, const int32_t* idx ) noexcept
+{
+   const __m256i index( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( idx ) ) );
+   const __m256  mask ( _mm256_castsi256_ps( _mm256_set1_epi32( -1 ) ) );
+   return _mm256_mask_i32gather_ps( _mm256_setzero_ps(), x, index, mask, 4 );
+}
+
+BLAZE_ALWAYS_INLINE SIMDdouble
+   sellGather( const double* x, const int32_t* idx, const int32_t* len, int32_t j ) noexcept
+{
+   const __m128i length( _mm_loadu_si128( reinterpret_cast<const __m128i*>( len ) ) );
+   const __m128i index ( _mm_loadu_si128( reinterpret_cast<const __m128i*>( idx ) ) );
+   const __m128i active( _mm_cmpgt_epi32( length, _mm_set1_epi32( j ) ) );
+   return _mm256_mask_i32gather_pd( _mm256_setzero_pd(), x, index,
+                                    _mm256_castsi256_pd( _mm256_cvtepi32_epi64( active ) ), 8 );
+}
+
+BLAZE_ALWAYS_INLINE SIMDfloat
+   sellGather( const float* x, const int32_t* idx, const int32_t* len, int32_t j ) noexcept
+{
+   const __m256i length( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( len ) ) );
+   const __m256i index ( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( idx ) ) );
+   const __m256i active( _mm256_cmpgt_epi32( length, _mm256_set1_epi32( j ) ) );
+   return _mm256_mask_i32gather_ps( _mm256_setzero_ps(), x, index,
+                                    _mm256_castsi256_ps( active ), 4 );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Vectorized multiplication of a range of chunks with a dense vector.
+//
+// \param y The target dense vector.
+// \param x The right-hand side dense vector.
+// \param begin The index of the first chunk.
+// \param end The index one past the last chunk.
+// \return void
+//
+// This function implements the gather-based multiplication of the chunks \a begin to \a end
+// with the dense vector \a x. All rows of a chunk are processed at once: Up to the length of
+// the shortest row of the chunk the elements of \a x are gathered without mask, beyond that
+// length the padding elements are masked out such that non-finite elements of \a x do not
+// affect the result. Depending on \a OP the results are assigned to (0), added to (1) or
+// subtracted from (2) the according elements of \a y.
+*/
+template< typename Type >  // Data type of the matrix
+template< size_t OP        // Type of the operation
+        , typename VT1     // Type of the target dense vector
+        , typename VT2 >   // Type of the right-hand side dense vector
+inline EnableIf_< typename SellMatrix<Type>::template VectorizedMult<VT2> >
+   SellMatrix<Type>::mult( VT1& y, const VT2& x, size_t begin, size_t end ) const
+{
+   BLAZE_INTERNAL_ASSERT( begin <= end && end <= chunks(), "Invalid chunk range" );
+
+   const Type* const px( x.data() );
+
+   for( size_t c=begin; c<end; ++c )
+   {
+      const size_t width( ( offset_[c+1UL] - offset_[c] ) / SIMDSIZE );
+      const size_t minw ( minWidth_[c] );
+
+      const Type*    v  ( values_.data()  + offset_[c] );
+      const int32_t* idx( indices_.data() + offset_[c] );
+
+      SIMDType xmm1, xmm2;
+      size_t j( 0UL );
+
+      for( ; (j+2UL) <= minw; j+=2UL ) {
+         xmm1 += loada( v          ) * sellGather( px, idx          );
+         xmm2 += loada( v+SIMDSIZE ) * sellGather( px, idx+SIMDSIZE );
+         v   += 2UL*SIMDSIZE;
+         idx += 2UL*SIMDSIZE;
+      }
+
+      if( j < minw ) {
+         xmm1 += loada( v ) * sellGather( px, idx );
+         v   += SIMDSIZE;
+         idx += SIMDSIZE;
+         ++j;
+      }
+
+      const int32_t* len( lengths_.data() + c*SIMDSIZE );
+
+      for( ; j<width; ++j ) {
+         xmm2 += loada( v ) * sellGather( px, idx, len, static_cast<int32_t>( j ) );
+         v   += SIMDSIZE;
+         idx += SIMDSIZE;
+      }
+
+      xmm1 += xmm2;
+
+      const size_t kend( std::min<size_t>( SIMDSIZE, m_ - c*SIMDSIZE ) );
+      for( size_t k=0UL; k<kend; ++k ) {
+         store<OP>( y, perm_[c*SIMDSIZE+k], xmm1[k] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SELLMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SellMatrix operators */
+//@{
+template< typename Type >
+inline void reset( SellMatrix<Type>& m );
+
+template< typename Type >
+inline void clear( SellMatrix<Type>& m );
+
+template< bool RF, typename Type >
+inline bool isDefault( const SellMatrix<Type>& m );
+
+template< typename Type >
+inline bool isIntact( const SellMatrix<Type>& m );
+
+template< typename Type >
+inline void swap( SellMatrix<Type>& a, SellMatrix<Type>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given SELL-C-sigma matrix.
+// \ingroup sell_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void reset( SellMatrix<Type>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given SELL-C-sigma matrix.
+// \ingroup sell_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type >  // Data type of the matrix
+inline void clear( SellMatrix<Type>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given SELL-C-sigma matrix is in default state.
+// \ingroup sell_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the SELL-C-sigma matrix is in default (constructed) state, i.e.
+// if it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false. The following example demonstrates the use of the
+// \a isDefault() function:
+
+   \code
+   blaze::SellMatrix<double> A;
+   // ... Initialization
+   if( isDefault( A ) ) { ... }
+   \endcode
+*/
+template< bool RF          // Relaxation flag
+        , typename Type >  // Data type of the matrix
+inline bool isDefault( const SellMatrix<Type>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given SELL-C-sigma matrix are intact.
+// \ingroup sell_matrix
+//
+// \param m The SELL-C-sigma matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type >  // Data type of the matrix
+inline bool isIntact( const SellMatrix<Type>& m )
+{
+   return ( m.nonZeros() <= m.capacity() &&
+            m.chunks() * SellMatrix<Type>::SIMDSIZE >= m.rows() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two SELL-C-sigma matrices.
+// \ingroup sell_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type >  // Data type of the matrices
+inline void swap( SellMatrix<Type>& a, SellMatrix<Type>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Serial multiplication of a SELL-C-sigma matrix with a dense vector.
+// \ingroup sell_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side SELL-C-sigma matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function computes the product \f$ A*\vec{x} \f$ and, depending on \a OP, assigns it to
+// (0), adds it to (1) or subtracts it from (2) the dense vector \a y. In case the gather-based
+// kernel is available for the element type but \a x does not provide contiguous storage, \a x
+// is copied into a temporary vector first.
+*/
+template< size_t OP        // Type of the operation
+        , typename VT1     // Type of the target dense vector
+        , typename Type    // Data type of the matrix
+        , typename VT2 >   // Type of the right-hand side dense vector
+inline void sellmv( DenseVector<VT1,false>& y, const SellMatrix<Type>& A, const DenseVector<VT2,false>& x )
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == A.columns(), "Invalid vector size" );
+
+   using XT = IfTrue_< HasSellGather<Type>::value &&
+                       ( !HasConstDataAccess<VT2>::value || IsView<VT2>::value ||
+                         !IsSame< ElementType_<VT2>, Type >::value )
+                     , const DynamicVector<Type,false>
+                     , const VT2& >;
+
+   XT px( ~x );  // Contiguous storage of the right-hand side dense vector
+
+   A.template mult<OP>( ~y, px, 0UL, A.chunks() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SMP multiplication of a SELL-C-sigma matrix with a dense vector.
+// \ingroup sell_matrix
+//
+// \param y The target dense vector.
+// \param A The left-hand side SELL-C-sigma matrix.
+// \param x The right-hand side dense vector.
+// \return void
+//
+// This function computes the product \f$ A*\vec{x} \f$ and, depending on \a OP, assigns it to
+// (0), adds it to (1) or subtracts it from (2) the dense vector \a y. In case the number of rows
+// exceeds the \c SMP_SMATDVECMULT_THRESHOLD, the chunks are distributed among the available
+// threads.
+*/
+template< size_t OP        // Type of the operation
+        , typename VT1     // Type of the target dense vector
+        , typename Type    // Data type of the matrix
+        , typename VT2 >   // Type of the right-hand side dense vector
+inline void smpSellmv( DenseVector<VT1,false>& y, const SellMatrix<Type>& A, const DenseVector<VT2,false>& x )
+{
+   BLAZE_INTERNAL_ASSERT( (~y).size() == A.rows()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~x).size() == A.columns(), "Invalid vector size" );
+
+   if( !A.canSMPAssign() ) {
+      sellmv<OP>( ~y, A, ~x );
+      return;
+   }
+
+   using XT = IfTrue_< HasSellGather<Type>::value &&
+                       ( !HasConstDataAccess<VT2>::value || IsView<VT2>::value ||
+                         !IsSame< ElementType_<VT2>, Type >::value )
+                     , const DynamicVector<Type,false>
+                     , const VT2& >;
+
+   XT px( ~x );  // Contiguous storage of the right-hand side dense vector
+
+   smpFor( 0UL, A.chunks(), [&]( size_t begin, size_t end ) {
+      A.template mult<OP>( ~y, px, begin, end );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSELLMATRIX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+struct IsSellMatrix< SellMatrix<T> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBMATRIXTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct SubmatrixTrait< SellMatrix<T1> >
+{
+   using Type = CompressedMatrix<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ROWTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct RowTrait< SellMatrix<T1> >
+{
+   using Type = CompressedVector<T1,true>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1 >
+struct ColumnTrait< SellMatrix<T1> >
+{
+   using Type = CompressedVector<T1,false>;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
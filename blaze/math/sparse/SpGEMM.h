@@ -0,0 +1,472 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SpGEMM.h
+//  \brief Header file for the sparse matrix/sparse matrix multiplication kernels
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SPGEMM_H_
+#define _BLAZE_MATH_SPARSE_SPGEMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given SpGEMM kernel for all rows/columns of the target matrix.
+// \ingroup sparse_matrix
+//
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the target matrix.
+// \param kernel The kernel to be executed for a range of rows/columns.
+// \return void
+//
+// This function executes the given \a kernel for all rows (in case \a SO is set to \a rowMajor)
+// or all columns (in case \a SO is set to \a columnMajor) of an \f$ m \times n \f$ target
+// matrix. In case the size of the target matrix exceeds the according SMP threshold, the
+// rows/columns are processed in parallel.
+*/
+template< bool SO              // Storage order of the target matrix
+        , typename Kernel >    // Type of the row/column kernel
+inline void spgemmFor( size_t m, size_t n, const Kernel& kernel )
+{
+   const size_t lines( SO ? n : m );
+
+   if( m*n < ( SO ? SMP_TSMATTSMATMULT_THRESHOLD : SMP_SMATSMATMULT_THRESHOLD ) ) {
+      kernel( 0UL, lines );
+   }
+   else {
+      smpFor( 0UL, lines, kernel );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of two elements of the outer and inner row-major operands.
+// \ingroup sparse_matrix
+//
+// \param x The element of the outer operand \a A.
+// \param y The element of the inner operand \a B.
+// \return The product \f$ x*y \f$.
+*/
+template< typename T1    // Type of the outer element
+        , typename T2 >  // Type of the inner element
+inline auto spgemmMult( const T1& x, const T2& y, FalseType )
+{
+   return x * y;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication of two elements of the outer and inner column-major operands.
+// \ingroup sparse_matrix
+//
+// \param x The element of the outer operand \a B.
+// \param y The element of the inner operand \a A.
+// \return The product \f$ y*x \f$.
+*/
+template< typename T1    // Type of the outer element
+        , typename T2 >  // Type of the inner element
+inline auto spgemmMult( const T1& x, const T2& y, TrueType )
+{
+   return y * x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Symbolic phase of a sparse matrix/sparse matrix multiplication (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target compressed matrix.
+// \param m The number of rows of the target matrix.
+// \param n The number of columns of the target matrix.
+// \param X The outer sparse matrix operand (\a A in case of row-major, \a B in case of column-major).
+// \param Y The inner sparse matrix operand (\a B in case of row-major, \a A in case of column-major).
+// \return void
+//
+// This function computes the sparsity pattern of the product of two row-major (\a SO is set
+// to \a rowMajor) or two column-major (\a SO is set to \a columnMajor) sparse matrices. In a
+// first pass the exact number of non-zero elements of each row/column is counted, in a second
+// pass the sorted indices are filled into the exactly preallocated matrix. All elements of
+// the resulting pattern are default initialized. Both passes are executed row-/column-parallel.
+*/
+template< typename Type    // Data type of the target matrix
+        , bool SO          // Storage order of all matrices
+        , typename MT1     // Type of the outer operand
+        , typename MT2 >   // Type of the inner operand
+void spgemmSymbolic_backend( CompressedMatrix<Type,SO>& C, size_t m, size_t n, const MT1& X, const MT2& Y )
+{
+   using OuterIterator = ConstIterator_<MT1>;
+   using InnerIterator = ConstIterator_<MT2>;
+
+   const size_t lines( SO ? n : m );
+   const size_t size ( SO ? m : n );
+
+   // Counting the exact number of non-zero elements per row/column
+   std::vector<size_t> nonzeros( lines, 0UL );
+
+   spgemmFor<SO>( m, n, [&X,&Y,&nonzeros,lines,size]( size_t first, size_t last )
+   {
+      std::vector<size_t> marker( size, lines );
+
+      for( size_t i=first; i<last; ++i )
+      {
+         size_t count( 0UL );
+
+         const OuterIterator xend( X.end(i) );
+         for( OuterIterator x=X.begin(i); x!=xend; ++x ) {
+            const InnerIterator yend( Y.end( x->index() ) );
+            for( InnerIterator y=Y.begin( x->index() ); y!=yend; ++y ) {
+               if( marker[y->index()] != i ) {
+                  marker[y->index()] = i;
+                  ++count;
+               }
+            }
+         }
+
+         nonzeros[i] = count;
+      }
+   } );
+
+   CompressedMatrix<Type,SO> tmp( m, n, nonzeros );
+
+   // Filling the sorted indices of all rows/columns
+   spgemmFor<SO>( m, n, [&X,&Y,&tmp,lines,size]( size_t first, size_t last )
+   {
+      std::vector<size_t> marker( size, lines );
+      std::vector<size_t> indices;
+
+      for( size_t i=first; i<last; ++i )
+      {
+         indices.clear();
+
+         const OuterIterator xend( X.end(i) );
+         for( OuterIterator x=X.begin(i); x!=xend; ++x ) {
+            const InnerIterator yend( Y.end( x->index() ) );
+            for( InnerIterator y=Y.begin( x->index() ); y!=yend; ++y ) {
+               if( marker[y->index()] != i ) {
+                  marker[y->index()] = i;
+                  indices.push_back( y->index() );
+               }
+            }
+         }
+
+         std::sort( indices.begin(), indices.end() );
+
+         for( size_t j : indices ) {
+            if( SO ) tmp.append( j, i, Type(), false );
+            else     tmp.append( i, j, Type(), false );
+         }
+      }
+   } );
+
+   swap( C, tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric phase of a sparse matrix/sparse matrix multiplication (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target compressed matrix holding the sparsity pattern of the product.
+// \param X The outer sparse matrix operand (\a A in case of row-major, \a B in case of column-major).
+// \param Y The inner sparse matrix operand (\a B in case of row-major, \a A in case of column-major).
+// \return The number of elements of the sparsity pattern that evaluated to default values.
+//
+// This function recomputes the values of all elements in the given sparsity pattern of \a C.
+// For each row/column the positions of the stored elements are scattered into a dense lookup
+// table, which is used to accumulate the contributions of the operands directly into \a C.
+// Contributions outside the given pattern are ignored. The rows/columns are processed in
+// parallel.
+*/
+template< typename Type    // Data type of the target matrix
+        , bool SO          // Storage order of all matrices
+        , typename MT1     // Type of the outer operand
+        , typename MT2 >   // Type of the inner operand
+size_t spgemmNumeric_backend( CompressedMatrix<Type,SO>& C, const MT1& X, const MT2& Y )
+{
+   using Iterator      = Iterator_< CompressedMatrix<Type,SO> >;
+   using OuterIterator = ConstIterator_<MT1>;
+   using InnerIterator = ConstIterator_<MT2>;
+
+   const size_t size( SO ? C.rows() : C.columns() );
+
+   std::atomic<size_t> zeros( 0UL );
+
+   spgemmFor<SO>( C.rows(), C.columns(), [&C,&X,&Y,&zeros,size]( size_t first, size_t last )
+   {
+      std::vector<Type*> positions( size, nullptr );
+      size_t count( 0UL );
+
+      for( size_t i=first; i<last; ++i )
+      {
+         const Iterator cend( C.end(i) );
+
+         for( Iterator c=C.begin(i); c!=cend; ++c ) {
+            reset( c->value() );
+            positions[c->index()] = &c->value();
+         }
+
+         const OuterIterator xend( X.end(i) );
+         for( OuterIterator x=X.begin(i); x!=xend; ++x )
+         {
+            const InnerIterator yend( Y.end( x->index() ) );
+            for( InnerIterator y=Y.begin( x->index() ); y!=yend; ++y )
+            {
+               Type* const value( positions[y->index()] );
+
+               BLAZE_USER_ASSERT( value != nullptr, "Invalid sparsity pattern detected" );
+
+               if( value == nullptr )
+                  continue;
+
+               if( IsResizable<Type>::value && isDefault( *value ) ) {
+                  *value = spgemmMult( x->value(), y->value(), BoolConstant<SO>() );
+               }
+               else {
+                  *value += spgemmMult( x->value(), y->value(), BoolConstant<SO>() );
+               }
+            }
+         }
+
+         for( Iterator c=C.begin(i); c!=cend; ++c ) {
+            positions[c->index()] = nullptr;
+            if( isDefault( c->value() ) )
+               ++count;
+         }
+      }
+
+      zeros += count;
+   } );
+
+   return zeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the sparsity pattern of a sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// \param C The target compressed matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function performs the symbolic phase of the multiplication \f$ C=A*B \f$: \a C is
+// resized to \f$ A.rows() \times B.columns() \f$ and receives the exact sparsity pattern of the
+// product, without any spare capacity. All elements of the pattern are default initialized.
+// In combination with spgemmNumeric() the pattern can be reused for repeated products of
+// matrices that keep their sparsity pattern but change their values:
+
+   \code
+   blaze::CompressedMatrix<double,blaze::rowMajor> A, B, C;
+   // ... Resizing and initialization
+
+   spgemmSymbolic( C, A, B );  // Computing the sparsity pattern of A*B once
+
+   for( ... ) {
+      // ... Updating the values of A and B without changing their sparsity patterns
+      spgemmNumeric( C, A, B );  // Recomputing the values of C within the existing pattern
+   }
+   \endcode
+
+// Both the row-major and the column-major variant are supported, but all three matrices must
+// have the same storage order. In case the size of \a C exceeds the SMP threshold of the
+// according multiplication, the rows/columns are processed in parallel. In case the number of
+// columns of \a A doesn't match the number of rows of \a B, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type    // Data type of the target matrix
+        , bool SO          // Storage order of all matrices
+        , typename MT1     // Type of the left-hand side sparse matrix
+        , typename MT2 >   // Type of the right-hand side sparse matrix
+void spgemmSymbolic( CompressedMatrix<Type,SO>& C, const SparseMatrix<MT1,SO>& A, const SparseMatrix<MT2,SO>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~A).columns() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_<MT1> a( ~A );  // Evaluation of the left-hand side sparse matrix operand
+   CompositeType_<MT2> b( ~B );  // Evaluation of the right-hand side sparse matrix operand
+
+   if( SO )
+      spgemmSymbolic_backend( C, a.rows(), b.columns(), b, a );
+   else
+      spgemmSymbolic_backend( C, a.rows(), b.columns(), a, b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recomputes the values of a sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// \param C The target compressed matrix holding the sparsity pattern of the product.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function performs the numeric phase of the multiplication \f$ C=A*B \f$: the values of
+// all elements stored in \a C are recomputed, while the sparsity pattern of \a C is left
+// unchanged. Elements that evaluate to zero remain stored explicitly, which keeps the pattern
+// stable for subsequent calls. The sparsity pattern of \a C is expected to contain the pattern
+// of \f$ A*B \f$, as computed by spgemmSymbolic() (see its documentation for an example).
+// Contributions outside the pattern of \a C are ignored. In case the size of \a C exceeds the
+// SMP threshold of the according multiplication, the rows/columns are processed in parallel.
+// In case the sizes of the three matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+//
+// \note \a C must not be aliased with either \a A or \a B.
+*/
+template< typename Type    // Data type of the target matrix
+        , bool SO          // Storage order of all matrices
+        , typename MT1     // Type of the left-hand side sparse matrix
+        , typename MT2 >   // Type of the right-hand side sparse matrix
+void spgemmNumeric( CompressedMatrix<Type,SO>& C, const SparseMatrix<MT1,SO>& A, const SparseMatrix<MT2,SO>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~A).columns() != (~B).rows() || C.rows() != (~A).rows() || C.columns() != (~B).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_<MT1> a( ~A );  // Evaluation of the left-hand side sparse matrix operand
+   CompositeType_<MT2> b( ~B );  // Evaluation of the right-hand side sparse matrix operand
+
+   if( SO )
+      spgemmNumeric_backend( C, b, a );
+   else
+      spgemmNumeric_backend( C, a, b );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a sparse matrix/sparse matrix multiplication (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target compressed matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the multiplication \f$ C=A*B \f$ by means of a symbolic and a numeric
+// phase (see spgemmSymbolic() and spgemmNumeric()). In contrast to the two separate phases,
+// elements that evaluate to zero are removed from \a C. In case the size of \a C exceeds the
+// SMP threshold of the according multiplication, the rows/columns are processed in parallel.
+// In case the number of columns of \a A doesn't match the number of rows of \a B, a
+// \a std::invalid_argument exception is thrown.
+//
+// \note \a C must not be aliased with either \a A or \a B.
+*/
+template< typename Type    // Data type of the target matrix
+        , bool SO          // Storage order of all matrices
+        , typename MT1     // Type of the left-hand side sparse matrix
+        , typename MT2 >   // Type of the right-hand side sparse matrix
+void spgemm( CompressedMatrix<Type,SO>& C, const SparseMatrix<MT1,SO>& A, const SparseMatrix<MT2,SO>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~A).columns() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_<MT1> a( ~A );  // Evaluation of the left-hand side sparse matrix operand
+   CompositeType_<MT2> b( ~B );  // Evaluation of the right-hand side sparse matrix operand
+
+   size_t zeros( 0UL );
+
+   if( SO ) {
+      spgemmSymbolic_backend( C, a.rows(), b.columns(), b, a );
+      zeros = spgemmNumeric_backend( C, b, a );
+   }
+   else {
+      spgemmSymbolic_backend( C, a.rows(), b.columns(), a, b );
+      zeros = spgemmNumeric_backend( C, a, b );
+   }
+
+   if( zeros > 0UL ) {
+      C.erase( []( const Type& value ){ return isDefault( value ); } );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
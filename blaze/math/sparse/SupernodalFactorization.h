@@ -0,0 +1,788 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SupernodalFactorization.h
+//  \brief Header file for the supernodal sparse Cholesky and LDLH decompositions
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SUPERNODALFACTORIZATION_H_
+#define _BLAZE_MATH_SPARSE_SUPERNODALFACTORIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/BlockedDecomposition.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DMatMapExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Real.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/sparse/SymbolicFactorization.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Supernodal sparse Cholesky and LDLH decomposition.
+// \ingroup sparse_matrix
+//
+// The SupernodalFactorization class template represents a direct solver for sparse symmetric
+// (Hermitian) systems of linear equations. In case the \a LDL flag is set to \a false, the
+// class computes the Cholesky decomposition \f$ P A P^T = L L^H \f$ of a positive definite
+// matrix, in case the flag is set to \a true, the class computes the decomposition
+// \f$ P A P^T = L D L^H \f$ (with unit lower triangular \a L and diagonal \a D) of a (possibly
+// indefinite) matrix that is strongly factorizable without pivoting, as for instance a
+// quasi-definite matrix. For convenience the two variants are available via the SparseLLH and
+// SparseLDLH alias templates:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SparseLLH<double> chol( A );  // Analysis and factorization of A
+   chol.solve( x, b );                  // Solution of A*x = b
+   \endcode
+
+// The permutation \a P is a fill-reducing approximate minimum degree ordering of the matrix.
+// The decomposition is split into a symbolic analysis (see the SymbolicFactorization class),
+// which depends only on the sparsity pattern of the matrix, and a numeric factorization. Since
+// the symbolic analysis can be reused for all matrices with the same sparsity pattern, a sequence
+// of matrices can be decomposed by a single analysis followed by repeated calls to factorize():
+
+   \code
+   blaze::SparseLDLH<double> ldl;
+   ldl.analyze( A );
+
+   for( ... ) {
+      // ... Update of the values of A
+      ldl.factorize( A );
+      ldl.solve( x, b );
+   }
+   \endcode
+
+// The numeric factorization follows the multifrontal method: The columns of the factor are
+// grouped into supernodes, i.e. sets of consecutive columns with identical sparsity pattern,
+// which are stored and factorized as dense column-major panels. The bulk of the computation is
+// therefore performed by the dense matrix multiplication kernels. All supernodes of a level of
+// the supernodal elimination tree are independent of each other. In case the size of the panels
+// of a level is larger or equal to the \a BLAZE_SMP_SUPERNODAL_THRESHOLD and SMP is enabled,
+// the supernodes of the level are factorized in parallel. Otherwise the level is factorized
+// single-threaded and the parallelism is exploited within the dense kernels.
+//
+// The decomposition only accesses the lower part of the given matrix, i.e. it is not necessary
+// to store the upper part. This especially enables the decomposition of a SymmetricMatrix or
+// HermitianMatrix adaptor of a sparse matrix without converting it into a general matrix. The
+// given element type \a Type must be a BLAS compatible type (i.e. \c float, \c double,
+// \c complex<float>, or \c complex<double>).
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+class SupernodalFactorization
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SupernodalFactorization();
+
+   template< typename MT, bool SO >
+   explicit inline SupernodalFactorization( const SparseMatrix<MT,SO>& A );
+
+   explicit inline SupernodalFactorization( const SymbolicFactorization& symbolic );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t                       rows        () const noexcept;
+   inline size_t                       nonZeros    () const noexcept;
+   inline size_t                       supernodes  () const noexcept;
+   inline bool                         isFactorized() const noexcept;
+   inline const SymbolicFactorization& symbolic    () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO >
+   inline void analyze( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   void factorize( const SparseMatrix<MT,SO>& A );
+
+   template< typename VT1, typename VT2 >
+   void solve( DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   bool factorizeSupernode( size_t s );
+
+   static DynamicMatrix<Type,columnMajor>
+      adjointBlock( const DynamicMatrix<Type,columnMajor>& P,
+                    size_t kbegin, size_t kend, size_t ibegin, size_t iend );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SymbolicFactorization symbolic_;  //!< The symbolic analysis of the matrix.
+   bool factorized_;                 //!< Flag for a successful numeric factorization.
+
+   std::vector< DynamicMatrix<Type,columnMajor> > panels_;   //!< The dense panels of the supernodes.
+   std::vector< DynamicMatrix<Type,columnMajor> > updates_;  //!< The update matrices of the supernodes.
+   std::vector<Type> diag_;                                  //!< The diagonal of the LDLH decomposition.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ALIAS DECLARATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Supernodal sparse Cholesky decomposition \f$ P A P^T = L L^H \f$.
+// \ingroup sparse_matrix
+*/
+template< typename Type >
+using SparseLLH = SupernodalFactorization<Type,false>;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Supernodal sparse LDLH decomposition \f$ P A P^T = L D L^H \f$.
+// \ingroup sparse_matrix
+*/
+template< typename Type >
+using SparseLDLH = SupernodalFactorization<Type,true>;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SupernodalFactorization.
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+inline SupernodalFactorization<Type,LDL>::SupernodalFactorization()
+   : symbolic_  ()         // The symbolic analysis of the matrix
+   , factorized_( false )  // Flag for a successful numeric factorization
+   , panels_    ()         // The dense panels of the supernodes
+   , updates_   ()         // The update matrices of the supernodes
+   , diag_      ()         // The diagonal of the LDLH decomposition
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Analyzes and factorizes the given symmetric (Hermitian) sparse matrix.
+//
+// \param A The square symmetric (Hermitian) sparse matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+inline SupernodalFactorization<Type,LDL>::SupernodalFactorization( const SparseMatrix<MT,SO>& A )
+   : SupernodalFactorization()
+{
+   analyze( ~A );
+   factorize( ~A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates an unfactorized decomposition based on the given symbolic analysis.
+//
+// \param symbolic The symbolic analysis of the matrix.
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+inline SupernodalFactorization<Type,LDL>::SupernodalFactorization( const SymbolicFactorization& symbolic )
+   : SupernodalFactorization()
+{
+   symbolic_ = symbolic;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the decomposed matrix.
+//
+// \return The number of rows/columns of the decomposed matrix.
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+inline size_t SupernodalFactorization<Type,LDL>::rows() const noexcept
+{
+   return symbolic_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the factor.
+//
+// \return The number of non-zero elements of the lower triangular factor (including the diagonal).
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+inline size_t SupernodalFactorization<Type,LDL>::nonZeros() const noexcept
+{
+   return symbolic_.nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of supernodes of the factor.
+//
+// \return The number of supernodes.
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+inline size_t SupernodalFactorization<Type,LDL>::supernodes() const noexcept
+{
+   return symbolic_.supernodes();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the numeric factorization has been successfully computed.
+//
+// \return \a true in case the matrix has been factorized, \a false if not.
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+inline bool SupernodalFactorization<Type,LDL>::isFactorized() const noexcept
+{
+   return factorized_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the symbolic analysis of the decomposition.
+//
+// \return Reference to the symbolic analysis.
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+inline const SymbolicFactorization& SupernodalFactorization<Type,LDL>::symbolic() const noexcept
+{
+   return symbolic_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the symbolic analysis of the given symmetric (Hermitian) sparse matrix.
+//
+// \param A The square symmetric (Hermitian) sparse matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the fill-reducing ordering and the supernodal structure of the factor
+// of the given matrix (see the SymbolicFactorization class). Any previous numeric factorization
+// is discarded.
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+inline void SupernodalFactorization<Type,LDL>::analyze( const SparseMatrix<MT,SO>& A )
+{
+   symbolic_ = SymbolicFactorization( ~A );
+   factorized_ = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the numeric factorization of the given symmetric (Hermitian) sparse matrix.
+//
+// \param A The square symmetric (Hermitian) sparse matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid sparsity pattern of the matrix.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+// \exception std::runtime_error Decomposition of singular matrix failed.
+//
+// This function computes the numeric factorization of the given matrix based on the current
+// symbolic analysis. In case no symbolic analysis of a matrix of the same size is available,
+// the matrix is analyzed first. The lower part of the matrix must not contain any non-zero
+// element outside the sparsity pattern of the analyzed matrix. In this case a
+// \a std::invalid_argument exception is thrown. In case the matrix is not positive definite
+// (Cholesky decomposition) or a zero pivot is encountered (LDLH decomposition), a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+template< typename MT    // Type of the sparse matrix
+        , bool SO >      // Storage order of the sparse matrix
+void SupernodalFactorization<Type,LDL>::factorize( const SparseMatrix<MT,SO>& A )
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( symbolic_.rows() != (~A).rows() ) {
+      analyze( ~A );
+   }
+
+   factorized_ = false;
+
+   const size_t n ( symbolic_.rows() );
+   const size_t ns( symbolic_.supernodes() );
+
+   panels_.resize( ns );
+   updates_.resize( ns );
+
+   for( size_t s=0UL; s<ns; ++s ) {
+      panels_[s].resize( symbolic_.size(s), symbolic_.columns(s), false );
+      reset( panels_[s] );
+   }
+
+   if( LDL ) {
+      diag_.resize( n );
+   }
+
+   // Assembling the lower part of the permuted matrix into the supernode panels
+   for( size_t k=0UL; k<n; ++k )
+   {
+      for( auto element=(~A).begin(k); element!=(~A).end(k); ++element )
+      {
+         const size_t i( SO ? element->index() : k );
+         const size_t j( SO ? k : element->index() );
+
+         if( i < j ) continue;
+
+         const size_t pi( symbolic_.position(i) );
+         const size_t pj( symbolic_.position(j) );
+         const size_t row( max( pi, pj ) );
+         const size_t col( min( pi, pj ) );
+         const size_t s( symbolic_.supernode( col ) );
+         const size_t* pos( std::lower_bound( symbolic_.rowsBegin(s), symbolic_.rowsEnd(s), row ) );
+
+         if( pos == symbolic_.rowsEnd(s) || *pos != row ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid sparsity pattern of the matrix" );
+         }
+
+         panels_[s]( pos - symbolic_.rowsBegin(s), col - symbolic_.first(s) ) =
+            ( pi >= pj )?( Type( element->value() ) ):( Type( conj( element->value() ) ) );
+      }
+   }
+
+   // Factorizing the supernodes level by level
+   std::vector<unsigned char> success( ns, 1U );
+
+   for( size_t l=0UL; l<symbolic_.levels(); ++l )
+   {
+      const size_t* nodes( symbolic_.levelBegin(l) );
+      const size_t size( symbolic_.levelEnd(l) - nodes );
+
+      auto kernel = [this,nodes,&success]( size_t first, size_t last ) {
+         for( size_t k=first; k<last; ++k ) {
+            success[nodes[k]] = factorizeSupernode( nodes[k] );
+         }
+      };
+
+      if( size > 1UL && symbolic_.levelWork(l) >= SMP_SUPERNODAL_THRESHOLD && getNumThreads() > 1UL &&
+          !isSerialSectionActive() && !isParallelSectionActive() ) {
+         smpFor( 0UL, size, kernel );
+      }
+      else {
+         kernel( 0UL, size );
+      }
+
+      for( size_t k=0UL; k<size; ++k ) {
+         if( !success[nodes[k]] ) {
+            if( LDL ) {
+               BLAZE_THROW_LAPACK_ERROR( "Decomposition of singular matrix failed" );
+            }
+            else {
+               BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+            }
+         }
+      }
+   }
+
+   factorized_ = true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Factorizes a single supernode.
+//
+// \param s The index of the supernode.
+// \return \a true in case the supernode has been factorized, \a false in case of a failure.
+//
+// This function adds the update matrices of all children to the panel of the supernode, performs
+// a blocked partial factorization of the panel and computes the update matrix of the supernode.
+// Only the lower parts of the diagonal block of the panel and of the update matrices are used.
+// The function does not throw in case of a failure since it is executed in parallel.
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+bool SupernodalFactorization<Type,LDL>::factorizeSupernode( size_t s )
+{
+   using RT = UnderlyingBuiltin_<Type>;
+
+   const size_t f ( symbolic_.first(s) );
+   const size_t w ( symbolic_.columns(s) );
+   const size_t m ( symbolic_.size(s) );
+   const size_t mu( m - w );
+   const size_t* rows( symbolic_.rowsBegin(s) );
+
+   DynamicMatrix<Type,columnMajor>& P( panels_[s] );
+   DynamicMatrix<Type,columnMajor>& U( updates_[s] );
+
+   U.resize( mu, mu, false );
+   reset( U );
+
+   // Extend-add of the update matrices of the children
+   std::vector<size_t> map;
+
+   for( const size_t* child=symbolic_.childBegin(s); child!=symbolic_.childEnd(s); ++child )
+   {
+      DynamicMatrix<Type,columnMajor>& C( updates_[*child] );
+      const size_t* crows( symbolic_.rowsBegin(*child) + symbolic_.columns(*child) );
+      const size_t mc( C.rows() );
+
+      map.resize( mc );
+      for( size_t i=0UL, k=0UL; i<mc; ++i ) {
+         while( rows[k] != crows[i] ) ++k;
+         map[i] = k;
+      }
+
+      for( size_t j=0UL; j<mc; ++j ) {
+         const size_t cj( map[j] );
+         if( cj < w ) {
+            for( size_t i=j; i<mc; ++i )
+               P(map[i],cj) += C(i,j);
+         }
+         else {
+            for( size_t i=j; i<mc; ++i )
+               U(map[i]-w,cj-w) += C(i,j);
+         }
+      }
+
+      DynamicMatrix<Type,columnMajor>().swap( C );
+   }
+
+   // Blocked partial factorization of the panel
+   for( size_t kb=0UL; kb<w; kb+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t kend( min( kb+DECOMPOSITION_BLOCK_SIZE, w ) );
+
+      for( size_t j=kb; j<kend; ++j )
+      {
+         for( size_t k=kb; k<j; ++k ) {
+            const Type tmp( LDL ? P(k,k) * conj( P(j,k) ) : conj( P(j,k) ) );
+            for( size_t i=j; i<m; ++i ) {
+               P(i,j) -= P(i,k) * tmp;
+            }
+         }
+
+         if( LDL ) {
+            const Type d( P(j,j) );
+            if( isDefault( d ) ) return false;
+            for( size_t i=j+1UL; i<m; ++i ) {
+               P(i,j) /= d;
+            }
+            diag_[f+j] = d;
+         }
+         else {
+            const RT d( real( P(j,j) ) );
+            if( !( d > RT(0) ) ) return false;
+            const RT l( std::sqrt( d ) );
+            P(j,j) = l;
+            for( size_t i=j+1UL; i<m; ++i ) {
+               P(i,j) /= l;
+            }
+         }
+      }
+
+      if( kend == w )
+         continue;
+
+      // Updating the remaining columns of the panel
+      const DynamicMatrix<Type,columnMajor> W( adjointBlock( P, kb, kend, kend, w ) );
+      const auto L21( submatrix<unaligned>( P, kend, kb, m-kend, kend-kb ) );
+
+      decompositionFor( m-kend, w-kend, [&P,&L21,&W,kend,m]( size_t first, size_t last )
+      {
+         auto P2( submatrix<unaligned>( P, kend, kend+first, m-kend, last-first ) );
+         decompositionMult( P2, L21, submatrix<unaligned>( W, 0UL, first, W.rows(), last-first ), Type(-1), Type(1) );
+      } );
+   }
+
+   // Updating the lower part of the update matrix
+   if( mu > 0UL )
+   {
+      const DynamicMatrix<Type,columnMajor> W( adjointBlock( P, 0UL, w, w, m ) );
+      const auto L21( submatrix<unaligned>( P, w, 0UL, mu, w ) );
+
+      decompositionFor( mu, mu, [&U,&L21,&W,w]( size_t first, size_t last )
+      {
+         const auto L1( submatrix<unaligned>( L21, first, 0UL, last-first, w ) );
+
+         if( first > 0UL ) {
+            auto U1( submatrix<unaligned>( U, first, 0UL, last-first, first ) );
+            decompositionMult( U1, L1, submatrix<unaligned>( W, 0UL, 0UL, w, first ), Type(-1), Type(1) );
+         }
+
+         auto U2( submatrix<unaligned>( U, first, first, last-first, last-first ) );
+         decompositionLowerMult( U2, L1, submatrix<unaligned>( W, 0UL, first, w, last-first ), Type(-1) );
+      } );
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the (scaled) adjoint of a block of a factorized supernode panel.
+//
+// \param P The supernode panel.
+// \param kbegin The first factorized column of the block.
+// \param kend The index one past the last factorized column of the block.
+// \param ibegin The first row of the block.
+// \param iend The index one past the last row of the block.
+// \return The \f$ (kend-kbegin) \times (iend-ibegin) \f$ adjoint of the block.
+//
+// This function returns \f$ L^H \f$ (Cholesky decomposition) or \f$ D L^H \f$ (LDLH
+// decomposition) of the given block of the panel, i.e. the right-hand side operand of the
+// trailing matrix updates. Since the function is executed in parallel, the block is copied
+// element-wise instead of via a (parallel) assignment.
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+DynamicMatrix<Type,columnMajor>
+   SupernodalFactorization<Type,LDL>::adjointBlock( const DynamicMatrix<Type,columnMajor>& P,
+                                                    size_t kbegin, size_t kend, size_t ibegin, size_t iend )
+{
+   DynamicMatrix<Type,columnMajor> W( kend-kbegin, iend-ibegin );
+
+   for( size_t i=ibegin; i<iend; ++i ) {
+      for( size_t k=kbegin; k<kend; ++k ) {
+         W(k-kbegin,i-ibegin) = LDL ? P(k,k) * conj( P(i,k) ) : conj( P(i,k) );
+      }
+   }
+
+   return W;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the system of linear equations \f$ A x = b \f$.
+//
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::logic_error Solve with unfactorized matrix.
+// \exception std::invalid_argument Invalid right-hand side vector provided.
+//
+// This function solves the system of linear equations by means of a forward and a backward
+// substitution with the supernodal factor. The solution vector \a x is resized to the size of
+// the matrix (if possible). \a x and \a b may refer to the same vector.
+*/
+template< typename Type  // Data type of the elements
+        , bool LDL >     // Flag for the LDLH decomposition
+template< typename VT1   // Type of the solution vector
+        , typename VT2 > // Type of the right-hand side vector
+void SupernodalFactorization<Type,LDL>::solve( DenseVector<VT1,false>& x,
+                                               const DenseVector<VT2,false>& b ) const
+{
+   if( !factorized_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Solve with unfactorized matrix" );
+   }
+
+   const size_t n ( symbolic_.rows() );
+   const size_t ns( symbolic_.supernodes() );
+   const std::vector<size_t>& perm( symbolic_.permutation() );
+
+   if( (~b).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid right-hand side vector provided" );
+   }
+
+   DynamicVector<Type> y( n ), tmp;
+
+   for( size_t k=0UL; k<n; ++k ) {
+      y[k] = (~b)[perm[k]];
+   }
+
+   // Forward substitution with L
+   for( size_t s=0UL; s<ns; ++s )
+   {
+      const DynamicMatrix<Type,columnMajor>& P( panels_[s] );
+      const size_t f ( symbolic_.first(s) );
+      const size_t w ( symbolic_.columns(s) );
+      const size_t mu( symbolic_.size(s) - w );
+      const size_t* rows( symbolic_.rowsBegin(s) + w );
+
+      for( size_t j=0UL; j<w; ++j ) {
+         if( !LDL ) y[f+j] /= P(j,j);
+         const Type yj( y[f+j] );
+         for( size_t i=j+1UL; i<w; ++i )
+            y[f+i] -= P(i,j) * yj;
+      }
+
+      if( mu > 0UL ) {
+         tmp = submatrix( P, w, 0UL, mu, w ) * subvector( y, f, w );
+         for( size_t i=0UL; i<mu; ++i )
+            y[rows[i]] -= tmp[i];
+      }
+   }
+
+   // Scaling with the inverse of D
+   if( LDL ) {
+      for( size_t k=0UL; k<n; ++k )
+         y[k] /= diag_[k];
+   }
+
+   // Backward substitution with L^H
+   for( size_t s=ns; s-->0UL; )
+   {
+      const DynamicMatrix<Type,columnMajor>& P( panels_[s] );
+      const size_t f ( symbolic_.first(s) );
+      const size_t w ( symbolic_.columns(s) );
+      const size_t mu( symbolic_.size(s) - w );
+      const size_t* rows( symbolic_.rowsBegin(s) + w );
+
+      if( mu > 0UL ) {
+         tmp.resize( mu, false );
+         for( size_t i=0UL; i<mu; ++i )
+            tmp[i] = y[rows[i]];
+         subvector( y, f, w ) -= ctrans( submatrix( P, w, 0UL, mu, w ) ) * tmp;
+      }
+
+      for( size_t j=w; j-->0UL; ) {
+         for( size_t i=j+1UL; i<w; ++i )
+            y[f+j] -= conj( P(i,j) ) * y[f+i];
+         if( !LDL ) y[f+j] /= conj( P(j,j) );
+      }
+   }
+
+   resize( ~x, n, false );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      (~x)[perm[k]] = y[k];
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
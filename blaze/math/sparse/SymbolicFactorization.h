@@ -0,0 +1,754 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SymbolicFactorization.h
+//  \brief Header file for the symbolic analysis of the sparse Cholesky decomposition
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SYMBOLICFACTORIZATION_H_
+#define _BLAZE_MATH_SPARSE_SYMBOLICFACTORIZATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/sparse/AMD.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the supernodal sparse Cholesky and LDLH decompositions.
+// \ingroup sparse_matrix
+//
+// The SymbolicFactorization class represents the symbolic analysis of a symmetric (Hermitian)
+// sparse matrix, i.e. all information about the decomposition that depends only on the sparsity
+// pattern of the matrix. The analysis consists of the following steps:
+//
+//  -# A fill-reducing approximate minimum degree ordering (see the amd() function)
+//  -# The elimination tree of the permuted matrix and its postordering
+//  -# The column counts of the Cholesky factor via the row subtrees of the elimination tree
+//  -# The partitioning of the columns of the factor into fundamental supernodes, i.e. groups of
+//     consecutive columns with identical sparsity pattern below the diagonal block, and the row
+//     structure of every supernode
+//  -# The level schedule of the supernodal elimination tree, i.e. the partitioning of the
+//     supernodes into sets of independent supernodes
+//
+// Only the strictly lower part of the given matrix is accessed. The analysis can be reused for
+// the decomposition of any matrix with the same sparsity pattern (or a subset of it):
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   const blaze::SymbolicFactorization symbolic( A );
+
+   blaze::SparseLLH<double> chol( symbolic );
+   chol.factorize( A );
+   \endcode
+*/
+class SymbolicFactorization
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SymbolicFactorization();
+
+   template< typename MT, bool SO >
+   explicit inline SymbolicFactorization( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t                     rows       () const noexcept;
+   inline size_t                     nonZeros   () const noexcept;
+   inline size_t                     supernodes () const noexcept;
+   inline const std::vector<size_t>& permutation() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Supernode access functions******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   inline size_t        position  ( size_t i ) const noexcept;
+   inline size_t        supernode ( size_t j ) const noexcept;
+   inline size_t        first     ( size_t s ) const noexcept;
+   inline size_t        columns   ( size_t s ) const noexcept;
+   inline size_t        size      ( size_t s ) const noexcept;
+   inline const size_t* rowsBegin ( size_t s ) const noexcept;
+   inline const size_t* rowsEnd   ( size_t s ) const noexcept;
+   inline const size_t* childBegin( size_t s ) const noexcept;
+   inline const size_t* childEnd  ( size_t s ) const noexcept;
+   inline size_t        levels    () const noexcept;
+   inline const size_t* levelBegin( size_t l ) const noexcept;
+   inline const size_t* levelEnd  ( size_t l ) const noexcept;
+   inline size_t        levelWork ( size_t l ) const noexcept;
+   /*! \endcond */
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void eliminationTree( const std::vector< std::vector<size_t> >& adj, std::vector<size_t>& parent );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                         //!< The number of rows and columns of the matrix.
+   size_t nonzeros_;                  //!< The number of non-zero elements of the factor.
+   std::vector<size_t> perm_;         //!< The fill-reducing permutation.
+   std::vector<size_t> iperm_;        //!< The inverse fill-reducing permutation.
+   std::vector<size_t> rowptr_;       //!< The lower row structure of the permuted matrix.
+   std::vector<size_t> colidx_;       //!< The column indices of the lower row structure.
+   std::vector<size_t> snode_;        //!< The supernode of every column.
+   std::vector<size_t> first_;        //!< The first column of every supernode.
+   std::vector<size_t> srowptr_;      //!< The offsets of the row structures of the supernodes.
+   std::vector<size_t> srows_;        //!< The row structures of the supernodes.
+   std::vector<size_t> childptr_;     //!< The offsets of the children of the supernodes.
+   std::vector<size_t> children_;     //!< The children of the supernodes.
+   std::vector<size_t> levelptr_;     //!< The offsets of the levels.
+   std::vector<size_t> levelnodes_;   //!< The supernodes in order of the levels.
+   std::vector<size_t> levelwork_;    //!< The number of factor elements per level.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SymbolicFactorization.
+//
+// The default constructor creates the symbolic analysis of a \f$ 0 \times 0 \f$ matrix.
+*/
+inline SymbolicFactorization::SymbolicFactorization()
+   : n_         ( 0UL )   // The number of rows and columns of the matrix
+   , nonzeros_  ( 0UL )   // The number of non-zero elements of the factor
+   , perm_      ()        // The fill-reducing permutation
+   , iperm_     ()        // The inverse fill-reducing permutation
+   , rowptr_    ( 1UL )   // The lower row structure of the permuted matrix
+   , colidx_    ()        // The column indices of the lower row structure
+   , snode_     ()        // The supernode of every column
+   , first_     ( 1UL )   // The first column of every supernode
+   , srowptr_   ( 1UL )   // The offsets of the row structures of the supernodes
+   , srows_     ()        // The row structures of the supernodes
+   , childptr_  ( 1UL )   // The offsets of the children of the supernodes
+   , children_  ()        // The children of the supernodes
+   , levelptr_  ( 1UL )   // The offsets of the levels
+   , levelnodes_()        // The supernodes in order of the levels
+   , levelwork_ ()        // The number of factor elements per level
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the symbolic analysis of the given symmetric (Hermitian) sparse matrix.
+//
+// \param A The square symmetric (Hermitian) sparse matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// Only the strictly lower part of \a A is accessed.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline SymbolicFactorization::SymbolicFactorization( const SparseMatrix<MT,SO>& A )
+   : SymbolicFactorization()
+{
+   const std::vector< std::vector<size_t> > adj( lowerAdjacency( ~A ) );
+   const size_t none( adj.size() );
+
+   n_ = adj.size();
+
+   // Computing the fill-reducing ordering
+   {
+      std::vector< std::vector<size_t> > graph( adj );
+      perm_ = amdOrder( graph );
+   }
+
+   // Postordering the elimination tree of the permuted matrix
+   std::vector<size_t> parent;
+   eliminationTree( adj, parent );
+
+   {
+      std::vector<size_t> head( n_, none ), next( n_, none ), stack;
+      std::vector<size_t> post;
+      post.reserve( n_ );
+
+      for( size_t j=n_; j-->0UL; ) {
+         if( parent[j] != none ) {
+            next[j] = head[parent[j]];
+            head[parent[j]] = j;
+         }
+      }
+
+      for( size_t j=0UL; j<n_; ++j )
+      {
+         if( parent[j] != none ) continue;
+
+         stack.push_back( j );
+         while( !stack.empty() ) {
+            const size_t top( stack.back() );
+            const size_t child( head[top] );
+            if( child == none ) {
+               stack.pop_back();
+               post.push_back( top );
+            }
+            else {
+               head[top] = next[child];
+               stack.push_back( child );
+            }
+         }
+      }
+
+      std::vector<size_t> tmp( n_ );
+      for( size_t k=0UL; k<n_; ++k ) {
+         tmp[k] = perm_[post[k]];
+      }
+      perm_.swap( tmp );
+   }
+
+   eliminationTree( adj, parent );
+
+   // Computing the column counts of the factor via the row subtrees
+   std::vector<size_t> count( n_, 1UL );
+   {
+      std::vector<size_t> mark( n_, none );
+
+      for( size_t i=0UL; i<n_; ++i ) {
+         mark[i] = i;
+         for( size_t l=rowptr_[i]; l<rowptr_[i+1UL]; ++l ) {
+            for( size_t k=colidx_[l]; mark[k] != i; k=parent[k] ) {
+               ++count[k];
+               mark[k] = i;
+            }
+         }
+      }
+
+      for( size_t j=0UL; j<n_; ++j ) {
+         nonzeros_ += count[j];
+      }
+   }
+
+   // Partitioning the columns into fundamental supernodes
+   snode_.resize( n_ );
+   first_.clear();
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      if( j == 0UL || parent[j-1UL] != j || count[j-1UL] != count[j] + 1UL ) {
+         first_.push_back( j );
+      }
+      snode_[j] = first_.size() - 1UL;
+   }
+   first_.push_back( n_ );
+
+   const size_t ns( first_.size() - 1UL );
+
+   // Computing the supernodal elimination tree
+   std::vector<size_t> sparent( ns, ns );
+   childptr_.assign( ns+1UL, 0UL );
+
+   for( size_t s=0UL; s<ns; ++s ) {
+      const size_t p( parent[first_[s+1UL]-1UL] );
+      if( p != none ) {
+         sparent[s] = snode_[p];
+         ++childptr_[sparent[s]+1UL];
+      }
+   }
+
+   for( size_t s=0UL; s<ns; ++s ) {
+      childptr_[s+1UL] += childptr_[s];
+   }
+
+   children_.resize( childptr_[ns] );
+   {
+      std::vector<size_t> pos( childptr_.begin(), childptr_.end()-1L );
+      for( size_t s=0UL; s<ns; ++s ) {
+         if( sparent[s] != ns ) children_[pos[sparent[s]]++] = s;
+      }
+   }
+
+   // Computing the row structures of the supernodes
+   {
+      std::vector<size_t> colptr( n_+1UL, 0UL ), rowidx( colidx_.size() );
+
+      for( size_t k : colidx_ ) ++colptr[k+1UL];
+      for( size_t j=0UL; j<n_; ++j ) colptr[j+1UL] += colptr[j];
+      for( size_t i=0UL; i<n_; ++i ) {
+         for( size_t l=rowptr_[i]; l<rowptr_[i+1UL]; ++l ) {
+            rowidx[colptr[colidx_[l]]++] = i;
+         }
+      }
+      for( size_t j=n_; j>0UL; --j ) colptr[j] = colptr[j-1UL];
+      colptr[0UL] = 0UL;
+
+      std::vector<size_t> mark( n_, ns );
+      srowptr_.assign( 1UL, 0UL );
+      srows_.reserve( nonzeros_ );
+
+      for( size_t s=0UL; s<ns; ++s )
+      {
+         const size_t f( first_[s] );
+         const size_t l( first_[s+1UL] );
+         const size_t begin( srows_.size() );
+
+         for( size_t j=f; j<l; ++j ) {
+            srows_.push_back( j );
+            mark[j] = s;
+         }
+
+         for( size_t j=f; j<l; ++j ) {
+            for( size_t k=colptr[j]; k<colptr[j+1UL]; ++k ) {
+               if( mark[rowidx[k]] != s ) {
+                  mark[rowidx[k]] = s;
+                  srows_.push_back( rowidx[k] );
+               }
+            }
+         }
+
+         for( size_t c=childptr_[s]; c<childptr_[s+1UL]; ++c ) {
+            const size_t child( children_[c] );
+            for( size_t k=srowptr_[child]; k<srowptr_[child+1UL]; ++k ) {
+               const size_t i( srows_[k] );
+               if( i >= l && mark[i] != s ) {
+                  mark[i] = s;
+                  srows_.push_back( i );
+               }
+            }
+         }
+
+         std::sort( srows_.begin()+begin+(l-f), srows_.end() );
+         srowptr_.push_back( srows_.size() );
+      }
+   }
+
+   // Computing the level schedule of the supernodal elimination tree
+   {
+      std::vector<size_t> level( ns, 0UL );
+      size_t maxlevel( 0UL );
+
+      for( size_t s=0UL; s<ns; ++s ) {
+         for( size_t c=childptr_[s]; c<childptr_[s+1UL]; ++c ) {
+            level[s] = std::max( level[s], level[children_[c]] + 1UL );
+         }
+         maxlevel = std::max( maxlevel, level[s] );
+      }
+
+      const size_t nl( ns > 0UL ? maxlevel+1UL : 0UL );
+
+      levelptr_.assign( nl+1UL, 0UL );
+      levelwork_.assign( nl, 0UL );
+      levelnodes_.resize( ns );
+
+      for( size_t s=0UL; s<ns; ++s ) {
+         ++levelptr_[level[s]+1UL];
+         levelwork_[level[s]] += size( s ) * columns( s );
+      }
+
+      for( size_t k=0UL; k<nl; ++k ) {
+         levelptr_[k+1UL] += levelptr_[k];
+      }
+
+      std::vector<size_t> pos( levelptr_.begin(), levelptr_.end()-1L );
+      for( size_t s=0UL; s<ns; ++s ) {
+         levelnodes_[pos[level[s]]++] = s;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows/columns of the analyzed matrix.
+//
+// \return The number of rows/columns of the analyzed matrix.
+*/
+inline size_t SymbolicFactorization::rows() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the factor.
+//
+// \return The number of non-zero elements of the lower triangular factor (including the diagonal).
+*/
+inline size_t SymbolicFactorization::nonZeros() const noexcept
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of supernodes.
+//
+// \return The number of supernodes.
+*/
+inline size_t SymbolicFactorization::supernodes() const noexcept
+{
+   return first_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fill-reducing permutation.
+//
+// \return The permutation vector, i.e. the \a k-th pivot is the row/column \c p[k] of the matrix.
+//
+// The permutation is the approximate minimum degree ordering of the matrix, postordered with
+// respect to the elimination tree of the permuted matrix.
+*/
+inline const std::vector<size_t>& SymbolicFactorization::permutation() const noexcept
+{
+   return perm_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the elimination tree of the matrix permuted by the current permutation.
+//
+// \param adj The adjacency structure of the matrix.
+// \param parent The parent of every column in the elimination tree (\a n for roots).
+// \return void
+//
+// This function additionally updates the inverse permutation and the lower row structure of the
+// permuted matrix.
+*/
+inline void SymbolicFactorization::eliminationTree( const std::vector< std::vector<size_t> >& adj,
+                                                    std::vector<size_t>& parent )
+{
+   const size_t none( n_ );
+
+   iperm_.resize( n_ );
+   for( size_t k=0UL; k<n_; ++k ) {
+      iperm_[perm_[k]] = k;
+   }
+
+   rowptr_.assign( n_+1UL, 0UL );
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( size_t j : adj[i] ) {
+         if( j < i ) ++rowptr_[std::max( iperm_[i], iperm_[j] )+1UL];
+      }
+   }
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      rowptr_[i+1UL] += rowptr_[i];
+   }
+
+   colidx_.resize( rowptr_[n_] );
+   {
+      std::vector<size_t> pos( rowptr_.begin(), rowptr_.end()-1L );
+      for( size_t i=0UL; i<n_; ++i ) {
+         for( size_t j : adj[i] ) {
+            if( j < i ) {
+               const size_t pi( iperm_[i] ), pj( iperm_[j] );
+               colidx_[pos[std::max( pi, pj )]++] = std::min( pi, pj );
+            }
+         }
+      }
+   }
+
+   parent.assign( n_, none );
+   std::vector<size_t> ancestor( n_, none );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      for( size_t l=rowptr_[i]; l<rowptr_[i+1UL]; ++l ) {
+         size_t k( colidx_[l] );
+         while( k != none && k < i ) {
+            const size_t next( ancestor[k] );
+            ancestor[k] = i;
+            if( next == none ) parent[k] = i;
+            k = next;
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUPERNODE ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the position of the given row/column within the permuted matrix.
+//
+// \param i The index of the row/column of the matrix.
+// \return The index of the row/column within the permuted matrix.
+*/
+inline size_t SymbolicFactorization::position( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < n_, "Invalid row access index" );
+   return iperm_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the supernode of the given column of the permuted matrix.
+//
+// \param j The index of the column of the permuted matrix.
+// \return The index of the supernode containing the column.
+*/
+inline size_t SymbolicFactorization::supernode( size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+   return snode_[j];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the first column of the given supernode.
+//
+// \param s The index of the supernode.
+// \return The index of the first column of the supernode.
+*/
+inline size_t SymbolicFactorization::first( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < supernodes(), "Invalid supernode access index" );
+   return first_[s];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of columns of the given supernode.
+//
+// \param s The index of the supernode.
+// \return The number of columns of the supernode.
+*/
+inline size_t SymbolicFactorization::columns( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < supernodes(), "Invalid supernode access index" );
+   return first_[s+1UL] - first_[s];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of the given supernode.
+//
+// \param s The index of the supernode.
+// \return The number of rows of the supernode (including the rows of the diagonal block).
+*/
+inline size_t SymbolicFactorization::size( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < supernodes(), "Invalid supernode access index" );
+   return srowptr_[s+1UL] - srowptr_[s];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer to the first row of the given supernode.
+//
+// \param s The index of the supernode.
+// \return Pointer to the first row of the supernode.
+//
+// The rows of a supernode are sorted in ascending order. The first rows correspond to the
+// columns of the supernode, i.e. to the rows of the dense diagonal block.
+*/
+inline const size_t* SymbolicFactorization::rowsBegin( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < supernodes(), "Invalid supernode access index" );
+   return srows_.data() + srowptr_[s];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer one past the last row of the given supernode.
+//
+// \param s The index of the supernode.
+// \return Pointer one past the last row of the supernode.
+*/
+inline const size_t* SymbolicFactorization::rowsEnd( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < supernodes(), "Invalid supernode access index" );
+   return srows_.data() + srowptr_[s+1UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer to the first child of the given supernode.
+//
+// \param s The index of the supernode.
+// \return Pointer to the first child of the supernode in the supernodal elimination tree.
+*/
+inline const size_t* SymbolicFactorization::childBegin( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < supernodes(), "Invalid supernode access index" );
+   return children_.data() + childptr_[s];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer one past the last child of the given supernode.
+//
+// \param s The index of the supernode.
+// \return Pointer one past the last child of the supernode in the supernodal elimination tree.
+*/
+inline const size_t* SymbolicFactorization::childEnd( size_t s ) const noexcept
+{
+   BLAZE_USER_ASSERT( s < supernodes(), "Invalid supernode access index" );
+   return children_.data() + childptr_[s+1UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of levels of the supernodal elimination tree.
+//
+// \return The number of levels.
+//
+// The level of a supernode is its height within the supernodal elimination tree. Consequently
+// all supernodes of a level are independent of each other and only depend on supernodes of
+// previous levels.
+*/
+inline size_t SymbolicFactorization::levels() const noexcept
+{
+   return levelwork_.size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer to the first supernode of the given level.
+//
+// \param l The index of the level.
+// \return Pointer to the first supernode of the level.
+*/
+inline const size_t* SymbolicFactorization::levelBegin( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return levelnodes_.data() + levelptr_[l];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a pointer one past the last supernode of the given level.
+//
+// \param l The index of the level.
+// \return Pointer one past the last supernode of the level.
+*/
+inline const size_t* SymbolicFactorization::levelEnd( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return levelnodes_.data() + levelptr_[l+1UL];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of factor elements of the supernodes of the given level.
+//
+// \param l The index of the level.
+// \return The number of elements of the dense supernode panels of the level.
+*/
+inline size_t SymbolicFactorization::levelWork( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return levelwork_[l];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -67,9 +67,11 @@ namespace blaze {
 // \ingroup math
 //
 // The ValueIndexPair class represents a single index-value-pair of a sparse vector or sparse
-// matrix.
+// matrix. The second template argument specifies the data type that is used to store the index.
+// Independent of this storage type the index is always returned as \c size_t.
 */
-template< typename Type >  // Type of the value element
+template< typename Type          // Type of the value element
+        , typename IT = size_t >  // Type of the stored index
 class ValueIndexPair
    : private SparseElement
 {
@@ -136,15 +138,15 @@ class ValueIndexPair
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   Type   value_;  //!< Value of the value-index-pair.
-   size_t index_;  //!< Index of the value-index-pair.
+   Type value_;  //!< Value of the value-index-pair.
+   IT   index_;  //!< Index of the value-index-pair.
    //@}
    //**********************************************************************************************
 
  private:
    //**Friend declarations*************************************************************************
    /*! \cond BLAZE_INTERNAL */
-   template< typename Other > friend class ValueIndexPair;
+   template< typename, typename > friend class ValueIndexPair;
    /*! \endcond */
    //**********************************************************************************************
 
@@ -171,8 +173,9 @@ class ValueIndexPair
 //*************************************************************************************************
 /*!\brief Default constructor for value-index-pairs.
 */
-template< typename Type >  // Type of the value element
-inline ValueIndexPair<Type>::ValueIndexPair()
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the stored index
+inline ValueIndexPair<Type,IT>::ValueIndexPair()
    : value_()  // Value of the value-index-pair
    , index_()  // Index of the value-index-pair
 {}
@@ -185,10 +188,11 @@ inline ValueIndexPair<Type>::ValueIndexPair()
 // \param v The value of the value-index-pair.
 // \param i The index of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline ValueIndexPair<Type>::ValueIndexPair( const Type& v, size_t i )
-   : value_( v )  // Value of the value-index-pair
-   , index_( i )  // Index of the value-index-pair
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the stored index
+inline ValueIndexPair<Type,IT>::ValueIndexPair( const Type& v, size_t i )
+   : value_( v )                     // Value of the value-index-pair
+   , index_( static_cast<IT>( i ) )  // Index of the value-index-pair
 {}
 //*************************************************************************************************
 
@@ -211,10 +215,11 @@ inline ValueIndexPair<Type>::ValueIndexPair( const Type& v, size_t i )
 // \a Other data type qualifies as value-index-pair type in case it provides a value() and an
 // index() member function.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value-index-pair
-inline EnableIf_< IsSparseElement<Other>, ValueIndexPair<Type>& >
-   ValueIndexPair<Type>::operator=( const Other& rhs )
+inline EnableIf_< IsSparseElement<Other>, ValueIndexPair<Type,IT>& >
+   ValueIndexPair<Type,IT>::operator=( const Other& rhs )
 {
    value_ = rhs.value();
    index_ = rhs.index();
@@ -233,11 +238,12 @@ inline EnableIf_< IsSparseElement<Other>, ValueIndexPair<Type>& >
 // \a Other data type qualifies as value-index-pair type in case it provides a value() and an
 // index() member function.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value-index-pair
 inline EnableIf_< And< IsSparseElement< RemoveReference_<Other> >
-                     , IsRValueReference<Other&&> >, ValueIndexPair<Type>& >
-   ValueIndexPair<Type>::operator=( Other&& rhs )
+                     , IsRValueReference<Other&&> >, ValueIndexPair<Type,IT>& >
+   ValueIndexPair<Type,IT>::operator=( Other&& rhs )
 {
    value_ = std::move( rhs.value() );
    index_ = rhs.index();
@@ -252,10 +258,11 @@ inline EnableIf_< And< IsSparseElement< RemoveReference_<Other> >
 // \param v The new value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline EnableIf_< Not< IsSparseElement<Other> >, ValueIndexPair<Type>& >
-   ValueIndexPair<Type>::operator=( const Other& v )
+inline EnableIf_< Not< IsSparseElement<Other> >, ValueIndexPair<Type,IT>& >
+   ValueIndexPair<Type,IT>::operator=( const Other& v )
 {
    value_ = v;
    return *this;
@@ -269,11 +276,12 @@ inline EnableIf_< Not< IsSparseElement<Other> >, ValueIndexPair<Type>& >
 // \param v The new value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
 inline EnableIf_< And< Not< IsSparseElement< RemoveReference_<Other> > >
-                     , IsRValueReference<Other&&> >, ValueIndexPair<Type>& >
-   ValueIndexPair<Type>::operator=( Other&& v )
+                     , IsRValueReference<Other&&> >, ValueIndexPair<Type,IT>& >
+   ValueIndexPair<Type,IT>::operator=( Other&& v )
 {
    value_ = std::move( v );
    return *this;
@@ -287,9 +295,10 @@ inline EnableIf_< And< Not< IsSparseElement< RemoveReference_<Other> > >
 // \param v The right-hand side value to be added to the value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator+=( const Other& v )
+inline ValueIndexPair<Type,IT>& ValueIndexPair<Type,IT>::operator+=( const Other& v )
 {
    value_ += v;
    return *this;
@@ -303,9 +312,10 @@ inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator+=( const Other& v )
 // \param v The right-hand side value to be subtracted from the value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator-=( const Other& v )
+inline ValueIndexPair<Type,IT>& ValueIndexPair<Type,IT>::operator-=( const Other& v )
 {
    value_ -= v;
    return *this;
@@ -319,9 +329,10 @@ inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator-=( const Other& v )
 // \param v The right-hand side value for the multiplication.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator*=( const Other& v )
+inline ValueIndexPair<Type,IT>& ValueIndexPair<Type,IT>::operator*=( const Other& v )
 {
    value_ *= v;
    return *this;
@@ -335,9 +346,10 @@ inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator*=( const Other& v )
 // \param v The right-hand side value for the division
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator/=( const Other& v )
+inline ValueIndexPair<Type,IT>& ValueIndexPair<Type,IT>::operator/=( const Other& v )
 {
    value_ /= v;
    return *this;
@@ -358,8 +370,9 @@ inline ValueIndexPair<Type>& ValueIndexPair<Type>::operator/=( const Other& v )
 //
 // \return The current value of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline typename ValueIndexPair<Type>::Reference ValueIndexPair<Type>::value()
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the stored index
+inline typename ValueIndexPair<Type,IT>::Reference ValueIndexPair<Type,IT>::value()
 {
    return value_;
 }
@@ -371,8 +384,9 @@ inline typename ValueIndexPair<Type>::Reference ValueIndexPair<Type>::value()
 //
 // \return The current value of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline typename ValueIndexPair<Type>::ConstReference ValueIndexPair<Type>::value() const
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the stored index
+inline typename ValueIndexPair<Type,IT>::ConstReference ValueIndexPair<Type,IT>::value() const
 {
    return value_;
 }
@@ -384,8 +398,9 @@ inline typename ValueIndexPair<Type>::ConstReference ValueIndexPair<Type>::value
 //
 // \return The current index of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline typename ValueIndexPair<Type>::IndexType ValueIndexPair<Type>::index() const
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the stored index
+inline typename ValueIndexPair<Type,IT>::IndexType ValueIndexPair<Type,IT>::index() const
 {
    return index_;
 }
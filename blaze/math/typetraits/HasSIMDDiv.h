@@ -45,10 +45,14 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsHalfPrecision.h>
 #include <blaze/util/typetraits/IsIntegral.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSigned.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
 
 
 namespace blaze {
@@ -95,6 +99,19 @@ struct HasSIMDDivHelper< complex<T>, T, EnableIf_< And< IsNumeric<T>, IsIntegral
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2 >
+struct HasSIMDDivHelper< T1, T2, EnableIf_< And< Or< IsHalfPrecision<T1>, IsHalfPrecision<T2> >
+                                               , Or< IsFloat<T1>, IsHalfPrecision<T1> >
+                                               , Or< IsFloat<T2>, IsHalfPrecision<T2> > > > >
+{
+   enum : bool { value = IsVectorizable<T1>::value && IsVectorizable<T2>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template<>
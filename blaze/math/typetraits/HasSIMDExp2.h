@@ -71,7 +71,7 @@ struct HasSIMDExp2Helper
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-#if BLAZE_SVML_MODE
+#if BLAZE_SVML_MODE || BLAZE_NATIVE_SIMD_MATH_MODE
 template< typename T >
 struct HasSIMDExp2Helper< T, EnableIf_< Or< IsFloat<T>, IsDouble<T> > > >
 {
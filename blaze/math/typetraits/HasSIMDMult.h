@@ -45,9 +45,13 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/mpl/And.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsHalfPrecision.h>
 #include <blaze/util/typetraits/IsIntegral.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
 
 
 namespace blaze {
@@ -101,6 +105,19 @@ struct HasSIMDMultHelper< complex<T>, complex<T>, EnableIf_< And< IsNumeric<T>,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, typename T2 >
+struct HasSIMDMultHelper< T1, T2, EnableIf_< And< Or< IsHalfPrecision<T1>, IsHalfPrecision<T2> >
+                                                , Or< IsFloat<T1>, IsHalfPrecision<T1> >
+                                                , Or< IsFloat<T2>, IsHalfPrecision<T2> > > > >
+{
+   enum : bool { value = IsVectorizable<T1>::value && IsVectorizable<T2>::value };
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template<>
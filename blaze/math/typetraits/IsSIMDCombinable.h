@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsHalfPrecision.h>
 #include <blaze/util/typetraits/IsIntegral.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 
@@ -88,9 +90,11 @@ struct IsSIMDCombinableHelper<T,T>
 template< typename T1, typename T2 >
 struct IsSIMDCombinableHelper<T1,T2>
 {
-   enum : bool { value = IsNumeric<T1>::value && IsIntegral<T1>::value &&
-                         IsNumeric<T2>::value && IsIntegral<T2>::value &&
-                         sizeof(T1) == sizeof(T2) };
+   enum : bool { value = ( IsNumeric<T1>::value && IsIntegral<T1>::value &&
+                           IsNumeric<T2>::value && IsIntegral<T2>::value &&
+                           sizeof(T1) == sizeof(T2) ) ||
+                         ( ( IsFloat<T1>::value || IsHalfPrecision<T1>::value ) &&
+                           ( IsFloat<T2>::value || IsHalfPrecision<T2>::value ) ) };
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -102,7 +106,8 @@ struct IsSIMDCombinableHelper<T1,T2>
 //
 // This type trait tests whether or not the given types can be combined in the context of SIMD
 // operations. By default, all numeric data types are considered combinable to themselves. Also,
-// different integral types of the same size can be combined. If the types are determined to be
+// different integral types of the same size can be combined, as well as \c float and the 16-bit
+// floating point types \c float16 and \c bfloat16, which are widened to \c float in registers. If the types are determined to be
 // SIMD combinable, the \a value member constant is set to \a true, the nested type definition
 // \a Type is \a TrueType, and the class derives from \a TrueType. Otherwise \a value is set to
 // \a false, \a Type is \a FalseType, and the class derives from \a FalseType.
@@ -111,6 +116,7 @@ struct IsSIMDCombinableHelper<T1,T2>
    blaze::IsSIMDCombinable< int, unsigned int >::value        // Evaluates to 1
    blaze::IsSIMDCombinable< double, double >::Type            // Results in TrueType
    blaze::IsSIMDCombinable< complex<float>, complex<float> >  // Is derived from TrueType
+   blaze::IsSIMDCombinable< float16, float >::value           // Evaluates to 1
    blaze::IsSIMDCombinable< int, float >::value               // Evaluates to 0
    blaze::IsSIMDCombinable< double, float >::Type             // Results in FalseType
    blaze::IsSIMDCombinable< complex<int>, complex<float> >    // Is derived from FalseType
@@ -41,8 +41,10 @@
 //*************************************************************************************************
 
 #include <blaze/util/mpl/If.h>
+#include <blaze/util/mpl/Or.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsHalfPrecision.h>
 
 
 namespace blaze {
@@ -103,7 +105,7 @@ struct UnderlyingElement
  public:
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
-   using Type = typename If_< IsBuiltin<T>
+   using Type = typename If_< Or< IsBuiltin<T>, IsHalfPrecision<T> >
                             , Builtin<T>
                             , If_< IsComplex<T>
                                  , Complex<T>
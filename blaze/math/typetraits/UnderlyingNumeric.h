@@ -44,6 +44,7 @@
 #include <blaze/util/mpl/Or.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsHalfPrecision.h>
 
 
 namespace blaze {
@@ -98,7 +99,7 @@ struct UnderlyingNumeric
  public:
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
-   using Type = typename If_< Or< IsBuiltin<T>, IsComplex<T> >
+   using Type = typename If_< Or< IsBuiltin<T>, IsHalfPrecision<T>, IsComplex<T> >
                             , BuiltinOrComplex<T>
                             , Other<T>
                             >::Type;
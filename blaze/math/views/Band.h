@@ -0,0 +1,502 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/Band.h
+//  \brief Header file for all restructuring band functions
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_VIEWS_BAND_H_
+#define _BLAZE_MATH_VIEWS_BAND_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/CrossTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/traits/SubvectorTrait.h>
+#include <blaze/math/views/band/BaseTemplate.h>
+#include <blaze/math/views/band/Dense.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a view on a specific band of the given dense matrix.
+// \ingroup views
+//
+// \param matrix The dense matrix containing the band.
+// \param index The index of the band (0 for the diagonal, positive for superdiagonals).
+// \return View on the specified band of the matrix.
+// \exception std::invalid_argument Invalid band access index.
+//
+// This function returns an expression representing the specified band (i.e. diagonal) of the
+// given dense matrix.
+
+   \code
+   using DenseMatrix = blaze::DynamicMatrix<double,rowMajor>;
+
+   DenseMatrix D;
+   // ... Resizing and initialization
+
+   // Creating a view on the diagonal of the dense matrix D
+   blaze::Band<DenseMatrix> diag = band( D, 0L );
+
+   // Creating a view on the 2nd subdiagonal of the dense matrix D
+   blaze::Band<DenseMatrix> sub2 = band( D, -2L );
+   \endcode
+
+// In case the band is not properly specified (i.e. if the specified band lies completely outside
+// of the given matrix) a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline Band<MT> band( DenseMatrix<MT,SO>& matrix, ptrdiff_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return Band<MT>( ~matrix, index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a specific band of the given constant dense matrix.
+// \ingroup views
+//
+// \param matrix The constant dense matrix containing the band.
+// \param index The index of the band (0 for the diagonal, positive for superdiagonals).
+// \return View on the specified band of the matrix.
+// \exception std::invalid_argument Invalid band access index.
+//
+// This function returns an expression representing the specified band of the given constant
+// dense matrix or dense matrix expression:
+
+   \code
+   using DenseMatrix = blaze::DynamicMatrix<double,rowMajor>;
+
+   const DenseMatrix A( ... ), B( ... );
+
+   // Creating a view on the 1st superdiagonal of the dense matrix A
+   blaze::Band<const DenseMatrix> super1 = band( A, 1L );
+
+   // Evaluating only the diagonal of the matrix product
+   blaze::DynamicVector<double> d = band( A * B, 0L );
+   \endcode
+
+// In case the band is not properly specified (i.e. if the specified band lies completely outside
+// of the given matrix) a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline const Band<const MT> band( const DenseMatrix<MT,SO>& matrix, ptrdiff_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return Band<const MT>( ~matrix, index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a specific band of the given temporary dense matrix.
+// \ingroup views
+//
+// \param matrix The temporary dense matrix containing the band.
+// \param index The index of the band (0 for the diagonal, positive for superdiagonals).
+// \return View on the specified band of the matrix.
+// \exception std::invalid_argument Invalid band access index.
+//
+// This function returns an expression representing the specified band of the given temporary
+// dense matrix. In case the band is not properly specified (i.e. if the specified band lies
+// completely outside of the given matrix) a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+inline Band<MT> band( DenseMatrix<MT,SO>&& matrix, ptrdiff_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return Band<MT>( ~matrix, index );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BAND OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Band operators */
+//@{
+template< typename MT, bool DF >
+inline void reset( Band<MT,DF>& band );
+
+template< typename MT, bool DF >
+inline void reset( Band<MT,DF>&& band );
+
+template< typename MT, bool DF >
+inline void clear( Band<MT,DF>& band );
+
+template< typename MT, bool DF >
+inline void clear( Band<MT,DF>&& band );
+
+template< bool RF, typename MT, bool DF >
+inline bool isDefault( const Band<MT,DF>& band );
+
+template< typename MT, bool DF >
+inline bool isIntact( const Band<MT,DF>& band ) noexcept;
+
+template< typename MT, bool DF >
+inline bool isSame( const Band<MT,DF>& a, const Band<MT,DF>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given band.
+// \ingroup band
+//
+// \param band The band to be resetted.
+// \return void
+*/
+template< typename MT  // Type of the matrix
+        , bool DF >    // Density flag
+inline void reset( Band<MT,DF>& band )
+{
+   band.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given temporary band.
+// \ingroup band
+//
+// \param band The temporary band to be resetted.
+// \return void
+*/
+template< typename MT  // Type of the matrix
+        , bool DF >    // Density flag
+inline void reset( Band<MT,DF>&& band )
+{
+   band.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given band.
+// \ingroup band
+//
+// \param band The band to be cleared.
+// \return void
+//
+// Clearing a band is equivalent to resetting it via the reset() function.
+*/
+template< typename MT  // Type of the matrix
+        , bool DF >    // Density flag
+inline void clear( Band<MT,DF>& band )
+{
+   band.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given temporary band.
+// \ingroup band
+//
+// \param band The temporary band to be cleared.
+// \return void
+//
+// Clearing a band is equivalent to resetting it via the reset() function.
+*/
+template< typename MT  // Type of the matrix
+        , bool DF >    // Density flag
+inline void clear( Band<MT,DF>&& band )
+{
+   band.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given band is in default state.
+// \ingroup band
+//
+// \param band The band to be tested for its default state.
+// \return \a true in case the given band is component-wise zero, \a false otherwise.
+//
+// This function checks whether the band is in default state. For instance, in case the band
+// is instantiated for a built-in integral or floating point data type, the function returns
+// \a true in case all band elements are 0 and \a false in case any band element is not 0.
+// The following example demonstrates the use of the \a isDefault function:
+
+   \code
+   blaze::DynamicMatrix<int,rowMajor> A;
+   // ... Resizing and initialization
+   if( isDefault( band( A, 1L ) ) ) { ... }
+   \endcode
+
+// Optionally, it is possible to switch between strict semantics (blaze::strict) and relaxed
+// semantics (blaze::relaxed):
+
+   \code
+   if( isDefault<relaxed>( band( A, 1L ) ) ) { ... }
+   \endcode
+*/
+template< bool RF      // Relaxation flag
+        , typename MT  // Type of the matrix
+        , bool DF >    // Density flag
+inline bool isDefault( const Band<MT,DF>& band )
+{
+   using blaze::isDefault;
+
+   for( size_t i=0UL; i<band.size(); ++i )
+      if( !isDefault<RF>( band[i] ) ) return false;
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given band are intact.
+// \ingroup band
+//
+// \param band The band to be tested.
+// \return \a true in case the given band's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the band are intact, i.e. if its state is
+// valid. In case the invariants are intact, the function returns \a true, else it will return
+// \a false. The following example demonstrates the use of the \a isIntact() function:
+
+   \code
+   blaze::DynamicMatrix<int,rowMajor> A;
+   // ... Resizing and initialization
+   if( isIntact( band( A, -1L ) ) ) { ... }
+   \endcode
+*/
+template< typename MT  // Type of the matrix
+        , bool DF >    // Density flag
+inline bool isIntact( const Band<MT,DF>& band ) noexcept
+{
+   return ( band.row() < band.operand().rows() &&
+            band.column() < band.operand().columns() &&
+            isIntact( band.operand() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the two given bands represent the same observable state.
+// \ingroup band
+//
+// \param a The first band to be tested for its state.
+// \param b The second band to be tested for its state.
+// \return \a true in case the two bands share a state, \a false otherwise.
+//
+// This overload of the isSame function tests if the two given bands refer to exactly the
+// same range of the same matrix. In case both bands represent the same observable state,
+// the function returns \a true, otherwise it returns \a false.
+*/
+template< typename MT  // Type of the matrix
+        , bool DF >    // Density flag
+inline bool isSame( const Band<MT,DF>& a, const Band<MT,DF>& b ) noexcept
+{
+   return ( isSame( a.operand(), b.operand() ) && ( a.band() == b.band() ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool DF, typename T >
+struct AddTrait< Band<MT,DF>, T >
+{
+   using Type = AddTrait_< ResultType_< Band<MT,DF> >, T >;
+};
+
+template< typename T, typename MT, bool DF >
+struct AddTrait< T, Band<MT,DF> >
+{
+   using Type = AddTrait_< T, ResultType_< Band<MT,DF> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool DF, typename T >
+struct SubTrait< Band<MT,DF>, T >
+{
+   using Type = SubTrait_< ResultType_< Band<MT,DF> >, T >;
+};
+
+template< typename T, typename MT, bool DF >
+struct SubTrait< T, Band<MT,DF> >
+{
+   using Type = SubTrait_< T, ResultType_< Band<MT,DF> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool DF, typename T >
+struct MultTrait< Band<MT,DF>, T >
+{
+   using Type = MultTrait_< ResultType_< Band<MT,DF> >, T >;
+};
+
+template< typename T, typename MT, bool DF >
+struct MultTrait< T, Band<MT,DF> >
+{
+   using Type = MultTrait_< T, ResultType_< Band<MT,DF> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool DF, typename T >
+struct DivTrait< Band<MT,DF>, T >
+{
+   using Type = DivTrait_< ResultType_< Band<MT,DF> >, T >;
+};
+
+template< typename T, typename MT, bool DF >
+struct DivTrait< T, Band<MT,DF> >
+{
+   using Type = DivTrait_< T, ResultType_< Band<MT,DF> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CROSSTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool DF, typename T >
+struct CrossTrait< Band<MT,DF>, T >
+{
+   using Type = CrossTrait_< ResultType_< Band<MT,DF> >, T >;
+};
+
+template< typename T, typename MT, bool DF >
+struct CrossTrait< T, Band<MT,DF> >
+{
+   using Type = CrossTrait_< T, ResultType_< Band<MT,DF> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBVECTORTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool DF >
+struct SubvectorTrait< Band<MT,DF> >
+{
+   using Type = SubvectorTrait_< ResultType_< Band<MT,DF> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
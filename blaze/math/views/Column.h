@@ -774,7 +774,7 @@ inline bool tryAssign( const Column<MT,SO,DF,SF>& lhs, const Vector<VT,false>& r
    BLAZE_INTERNAL_ASSERT( index <= lhs.size(), "Invalid vector access index" );
    BLAZE_INTERNAL_ASSERT( (~rhs).size() <= lhs.size() - index, "Invalid vector size" );
 
-   return tryAssign( lhs.operand(), ~rhs, index, lhs.column );
+   return tryAssign( lhs.operand(), ~rhs, index, lhs.column() );
 }
 /*! \endcond */
 //*************************************************************************************************
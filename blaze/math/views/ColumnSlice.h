@@ -0,0 +1,381 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/ColumnSlice.h
+//  \brief Header file for the implementation of the ColumnSlice view
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_VIEWS_COLUMNSLICE_H_
+#define _BLAZE_MATH_VIEWS_COLUMNSLICE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/DenseTensor.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/DivTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/views/columnslice/BaseTemplate.h>
+#include <blaze/math/views/columnslice/Dense.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a view on a specific column slice of the given dense tensor.
+// \ingroup views
+//
+// \param tensor The dense tensor containing the column slice.
+// \param index The index of the column.
+// \return View on the specified column slice of the tensor.
+// \exception std::invalid_argument Invalid columnslice access index.
+//
+// This function returns an expression representing the \a index-th column of all pages of the
+// given dense tensor as row-major \f$ O \times M \f$ dense matrix:
+
+   \code
+   using DenseTensor = blaze::DynamicTensor<double>;
+
+   DenseTensor T( 4UL, 10UL, 20UL );
+   // ... Initialization
+
+   // Creating a view on the column slice 3 of the tensor T
+   blaze::ColumnSlice<DenseTensor> cs = columnslice( T, 3UL );
+   \endcode
+
+// In case the column index is invalid, a \a std::invalid_argument exception is thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+inline ColumnSlice<TT> columnslice( DenseTensor<TT>& tensor, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ColumnSlice<TT>( ~tensor, index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a view on a specific column slice of the given constant dense tensor.
+// \ingroup views
+//
+// \param tensor The constant dense tensor containing the column slice.
+// \param index The index of the column.
+// \return View on the specified column slice of the tensor.
+// \exception std::invalid_argument Invalid columnslice access index.
+//
+// This function returns an expression representing the \a index-th column of all pages of the
+// given constant dense tensor. In case the column index is invalid, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+inline const ColumnSlice<const TT> columnslice( const DenseTensor<TT>& tensor, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   return ColumnSlice<const TT>( ~tensor, index );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COLUMNSLICE OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ColumnSlice operators */
+//@{
+template< typename TT >
+inline void reset( ColumnSlice<TT>& cs );
+
+template< typename TT >
+inline void reset( ColumnSlice<TT>&& cs );
+
+template< typename TT >
+inline void clear( ColumnSlice<TT>& cs );
+
+template< typename TT >
+inline void clear( ColumnSlice<TT>&& cs );
+
+template< bool RF, typename TT >
+inline bool isDefault( const ColumnSlice<TT>& cs );
+
+template< typename TT >
+inline bool isIntact( const ColumnSlice<TT>& cs ) noexcept;
+
+template< typename TT >
+inline bool isSame( const ColumnSlice<TT>& a, const ColumnSlice<TT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given column slice.
+// \ingroup columnslice
+//
+// \param cs The column slice to be resetted.
+// \return void
+*/
+template< typename TT >  // Type of the dense tensor
+inline void reset( ColumnSlice<TT>& cs )
+{
+   cs.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given temporary column slice.
+// \ingroup columnslice
+//
+// \param cs The temporary column slice to be resetted.
+// \return void
+*/
+template< typename TT >  // Type of the dense tensor
+inline void reset( ColumnSlice<TT>&& cs )
+{
+   cs.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given column slice.
+// \ingroup columnslice
+//
+// \param cs The column slice to be cleared.
+// \return void
+//
+// Clearing a column slice is equivalent to resetting it via the reset() function.
+*/
+template< typename TT >  // Type of the dense tensor
+inline void clear( ColumnSlice<TT>& cs )
+{
+   cs.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given temporary column slice.
+// \ingroup columnslice
+//
+// \param cs The temporary column slice to be cleared.
+// \return void
+//
+// Clearing a column slice is equivalent to resetting it via the reset() function.
+*/
+template< typename TT >  // Type of the dense tensor
+inline void clear( ColumnSlice<TT>&& cs )
+{
+   cs.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given column slice is in default state.
+// \ingroup columnslice
+//
+// \param cs The column slice to be tested for its default state.
+// \return \a true in case the given column slice is component-wise zero, \a false otherwise.
+//
+// This function checks whether the column slice is in default state. Optionally, it is possible
+// to switch between strict semantics (blaze::strict) and relaxed semantics (blaze::relaxed):
+
+   \code
+   blaze::DynamicTensor<double> T;
+   // ... Resizing and initialization
+   if( isDefault( columnslice( T, 0UL ) ) ) { ... }
+   if( isDefault<relaxed>( columnslice( T, 0UL ) ) ) { ... }
+   \endcode
+*/
+template< bool RF        // Relaxation flag
+        , typename TT >  // Type of the dense tensor
+inline bool isDefault( const ColumnSlice<TT>& cs )
+{
+   using blaze::isDefault;
+
+   for( size_t k=0UL; k<cs.rows(); ++k )
+      for( size_t i=0UL; i<cs.columns(); ++i )
+         if( !isDefault<RF>( cs(k,i) ) ) return false;
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given column slice are intact.
+// \ingroup columnslice
+//
+// \param cs The column slice to be tested.
+// \return \a true in case the given column slice's invariants are intact, \a false otherwise.
+*/
+template< typename TT >  // Type of the dense tensor
+inline bool isIntact( const ColumnSlice<TT>& cs ) noexcept
+{
+   return ( cs.column() < cs.operand().columns() && isIntact( cs.operand() ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the two given column slices represent the same observable state.
+// \ingroup columnslice
+//
+// \param a The first column slice to be tested for its state.
+// \param b The second column slice to be tested for its state.
+// \return \a true in case the two column slices share a state, \a false otherwise.
+*/
+template< typename TT >  // Type of the dense tensor
+inline bool isSame( const ColumnSlice<TT>& a, const ColumnSlice<TT>& b ) noexcept
+{
+   return ( &a.operand() == &b.operand() && a.column() == b.column() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ADDTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TT, typename T >
+struct AddTrait< ColumnSlice<TT>, T >
+{
+   using Type = AddTrait_< ResultType_< ColumnSlice<TT> >, T >;
+};
+
+template< typename T, typename TT >
+struct AddTrait< T, ColumnSlice<TT> >
+{
+   using Type = AddTrait_< T, ResultType_< ColumnSlice<TT> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SUBTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TT, typename T >
+struct SubTrait< ColumnSlice<TT>, T >
+{
+   using Type = SubTrait_< ResultType_< ColumnSlice<TT> >, T >;
+};
+
+template< typename T, typename TT >
+struct SubTrait< T, ColumnSlice<TT> >
+{
+   using Type = SubTrait_< T, ResultType_< ColumnSlice<TT> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MULTTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TT, typename T >
+struct MultTrait< ColumnSlice<TT>, T >
+{
+   using Type = MultTrait_< ResultType_< ColumnSlice<TT> >, T >;
+};
+
+template< typename T, typename TT >
+struct MultTrait< T, ColumnSlice<TT> >
+{
+   using Type = MultTrait_< T, ResultType_< ColumnSlice<TT> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DIVTRAIT SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TT, typename T >
+struct DivTrait< ColumnSlice<TT>, T >
+{
+   using Type = DivTrait_< ResultType_< ColumnSlice<TT> >, T >;
+};
+
+template< typename T, typename TT >
+struct DivTrait< T, ColumnSlice<TT> >
+{
+   using Type = DivTrait_< T, ResultType_< ColumnSlice<TT> > >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
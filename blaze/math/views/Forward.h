@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/expressions/Forward.h>
+#include <blaze/math/views/band/BaseTemplate.h>
 #include <blaze/math/views/column/BaseTemplate.h>
 #include <blaze/math/views/row/BaseTemplate.h>
 #include <blaze/math/views/submatrix/BaseTemplate.h>
@@ -92,6 +93,15 @@ const Column<const MT> column( const Matrix<MT,SO>& matrix, size_t index );
 template< typename MT, bool SO >
 Column<MT> column( Matrix<MT,SO>&& matrix, size_t index );
 
+template< typename MT, bool SO >
+Band<MT> band( DenseMatrix<MT,SO>& matrix, ptrdiff_t index );
+
+template< typename MT, bool SO >
+const Band<const MT> band( const DenseMatrix<MT,SO>& matrix, ptrdiff_t index );
+
+template< typename MT, bool SO >
+Band<MT> band( DenseMatrix<MT,SO>&& matrix, ptrdiff_t index );
+
 } // namespace blaze
 
 #endif
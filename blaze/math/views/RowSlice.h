@@ -0,0 +1,142 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/RowSlice.h
+//  \brief Header file for the row slices of dense tensors
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_VIEWS_ROWSLICE_H_
+#define _BLAZE_MATH_VIEWS_ROWSLICE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Expression.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseTensor.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creating a matrix view on a specific row slice of the given dense tensor.
+// \ingroup views
+//
+// \param tensor The dense tensor containing the row slice.
+// \param index The index of the row.
+// \return Row-major matrix view on the specified row slice of the tensor.
+// \exception std::invalid_argument Invalid rowslice access index.
+//
+// This function returns a row-major \f$ O \times N \f$ dense matrix referring to the \a index-th
+// row of all pages of the given dense tensor, i.e. the element \f$ (k,j) \f$ of the row slice is
+// the element \f$ (k,index,j) \f$ of the tensor. Since each row of the slice is a contiguous row
+// of the tensor, the row slice is a CustomMatrix whose spacing is the page spacing of the tensor:
+
+   \code
+   blaze::DynamicTensor<double> T( 4UL, 10UL, 20UL );
+   blaze::DynamicMatrix<double> A( 4UL, 20UL );
+   // ... Initialization
+
+   rowslice( T, 3UL ) = A;  // Setting row 3 of all four pages
+   \endcode
+
+// The row slice is aligned in case the tensor is aligned. Since the elements between the rows of
+// a row slice belong to other rows of the tensor, the row slice is never padded. Row slices are
+// only available for tensor types providing low-level data access (as for instance DynamicTensor
+// and CustomTensor). In case the row index is invalid, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+inline CustomMatrix< ElementType_<TT>, IsAligned<TT>::value, unpadded, rowMajor >
+   rowslice( DenseTensor<TT>& tensor, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_EXPRESSION_TYPE( TT );
+
+   using ReturnType = CustomMatrix< ElementType_<TT>, IsAligned<TT>::value, unpadded, rowMajor >;
+
+   if( index >= (~tensor).rows() || (~tensor).pages() == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid rowslice access index" );
+   }
+
+   return ReturnType( (~tensor).data( 0UL, index ), (~tensor).pages(), (~tensor).columns(), (~tensor).pageSpacing() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creating a matrix view on a specific row slice of the given constant dense tensor.
+// \ingroup views
+//
+// \param tensor The constant dense tensor containing the row slice.
+// \param index The index of the row.
+// \return Constant row-major matrix view on the specified row slice of the tensor.
+// \exception std::invalid_argument Invalid rowslice access index.
+//
+// This function returns a row-major \f$ O \times N \f$ dense matrix referring to the \a index-th
+// row of all pages of the given constant dense tensor. In case the row index is invalid, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+inline const CustomMatrix< ElementType_<TT>, IsAligned<TT>::value, unpadded, rowMajor >
+   rowslice( const DenseTensor<TT>& tensor, size_t index )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_EXPRESSION_TYPE( TT );
+
+   using ReturnType = CustomMatrix< ElementType_<TT>, IsAligned<TT>::value, unpadded, rowMajor >;
+
+   if( index >= (~tensor).rows() || (~tensor).pages() == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid rowslice access index" );
+   }
+
+   return ReturnType( const_cast<ElementType_<TT>*>( (~tensor).data( 0UL, index ) ), (~tensor).pages(), (~tensor).columns(), (~tensor).pageSpacing() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -51,6 +51,7 @@
 #include <blaze/math/expressions/MatMatMapExpr.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
 #include <blaze/math/expressions/MatMatSubExpr.h>
+#include <blaze/math/expressions/MatReduceExpr.h>
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/expressions/MatScalarDivExpr.h>
 #include <blaze/math/expressions/MatScalarMultExpr.h>
@@ -61,6 +62,7 @@
 #include <blaze/math/expressions/TVecMatMultExpr.h>
 #include <blaze/math/expressions/VecTVecMultExpr.h>
 #include <blaze/math/InversionFlag.h>
+#include <blaze/math/ReductionFlag.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/traits/AddTrait.h>
@@ -565,6 +567,62 @@ inline decltype(auto) subvector( const TVecMatMultExpr<VT>& vector, size_t index
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific subvector of the given column-wise matrix reduction.
+// \ingroup views
+//
+// \param vector The constant column-wise matrix reduction.
+// \param index The index of the first element of the subvector.
+// \param size The size of the subvector.
+// \return View on the specified subvector of the reduction.
+//
+// This function returns an expression representing the specified subvector of the given
+// column-wise matrix reduction.
+*/
+template< bool AF        // Alignment flag
+        , typename VT >  // Vector base type of the expression
+inline decltype(auto) subvector( const MatReduceExpr<VT,columnwise>& vector, size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   decltype(auto) operand( (~vector).operand() );
+
+   return reduce<columnwise>( submatrix<AF>( operand, 0UL, index, operand.rows(), size ),
+                              (~vector).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creating a view on a specific subvector of the given row-wise matrix reduction.
+// \ingroup views
+//
+// \param vector The constant row-wise matrix reduction.
+// \param index The index of the first element of the subvector.
+// \param size The size of the subvector.
+// \return View on the specified subvector of the reduction.
+//
+// This function returns an expression representing the specified subvector of the given
+// row-wise matrix reduction.
+*/
+template< bool AF        // Alignment flag
+        , typename VT >  // Vector base type of the expression
+inline decltype(auto) subvector( const MatReduceExpr<VT,rowwise>& vector, size_t index, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   decltype(auto) operand( (~vector).operand() );
+
+   return reduce<rowwise>( submatrix<AF>( operand, index, 0UL, size, operand.columns() ),
+                           (~vector).operation() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Creating a view on a specific submatrix of the given matrix/matrix addition.
@@ -0,0 +1,135 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/band/BaseTemplate.h
+//  \brief Header file for the implementation of the Band base template
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_VIEWS_BAND_BASETEMPLATE_H_
+#define _BLAZE_MATH_VIEWS_BAND_BASETEMPLATE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup band Band
+// \ingroup views
+*/
+/*!\brief Reference to a specific diagonal (band) of a dense matrix.
+// \ingroup band
+//
+// The Band template represents a reference to a specific diagonal of a dense matrix primitive
+// or expression. The type of the matrix is specified via the first template parameter:
+
+   \code
+   template< typename MT, bool DF >
+   class Band;
+   \endcode
+
+//  - MT: specifies the type of the dense matrix primitive or expression.
+//  - DF: specifies whether the given matrix type is a dense or sparse matrix type. This template
+//        parameter doesn't have to be defined explicitly, it is automatically derived from the
+//        first template parameter. Currently only dense matrices are supported.
+//
+//
+// \n \section band_setup Setup of Bands
+//
+// A reference to a diagonal of a dense matrix can be created very conveniently via the \c band()
+// function. The band index \a k selects the diagonal: \a k = 0 refers to the diagonal, \a k > 0
+// to the k-th superdiagonal and \a k < 0 to the k-th subdiagonal. The band can be treated as any
+// other column vector, i.e. it can be assigned to, it can be copied from, and it can be used in
+// arithmetic operations:
+
+   \code
+   using DenseVectorType = blaze::DynamicVector<double,columnVector>;
+   using DenseMatrixType = blaze::DynamicMatrix<double,rowMajor>;
+
+   DenseVectorType x;
+   DenseMatrixType A, B;
+   // ... Resizing and initialization
+
+   // Setting the diagonal of matrix A to x
+   blaze::Band<DenseMatrixType> diag = band( A, 0L );
+   diag = x;
+
+   // Setting the 1st subdiagonal of matrix A to the 1st superdiagonal of B
+   band( A, -1L ) = band( B, 1L );
+
+   // Extracting the 2nd superdiagonal of the result of a matrix multiplication
+   x = band( A * B, 2L );
+   \endcode
+
+// The \a i-th element of the band \a k of an \f$ M \times N \f$ matrix is the element
+// \f$ (i+\max(-k,0),i+\max(k,0)) \f$ of the matrix, the size of the band is the number of
+// matrix elements on the diagonal. In case the band index is outside of the matrix, a
+// \a std::invalid_argument exception is thrown. Note that in case of a BandMatrix write access
+// is only possible to bands within the stored bandwidths of the matrix.
+//
+//
+// \n \section band_common_operations Common Operations
+//
+// The current number of band elements can be obtained via the \c size() function, the number
+// of non-zero elements via the \c nonZeros() function. Just as rows and columns, bands are
+// references into a matrix and can therefore neither be resized nor swapped:
+
+   \code
+   blaze::DynamicMatrix<int,rowMajor> A( 42UL, 42UL );
+   // ... Initialization
+
+   auto b = band( A, 2L );
+
+   b.size();      // Returns the number of elements in the band (40)
+   b.nonZeros();  // Returns the number of non-zero elements contained in the band
+   b.band();      // Returns the band index (2)
+   b.row();       // Returns the row index of the first band element (0)
+   b.column();    // Returns the column index of the first band element (2)
+   \endcode
+*/
+template< typename MT                           // Type of the matrix
+        , bool DF = IsDenseMatrix<MT>::value >  // Density flag
+class Band;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
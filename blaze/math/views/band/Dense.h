@@ -0,0 +1,1662 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/band/Dense.h
+//  \brief Band specialization for dense matrices
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_VIEWS_BAND_DENSE_H_
+#define _BLAZE_MATH_VIEWS_BAND_DENSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/ColumnVector.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/View.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/traits/CrossTrait.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSparseVector.h>
+#include <blaze/math/views/band/BaseTemplate.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR DENSE MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of Band for dense matrices.
+// \ingroup views
+//
+// This specialization of Band adapts the class template to the requirements of dense matrices.
+// Since the elements of a diagonal are neither adjacent in row-major nor in column-major
+// matrices, all accesses are performed via the function call operator of the matrix. This
+// also applies to dense matrix expressions, for which only the elements of the band are
+// evaluated (e.g. \f$ N \f$ dot products for the diagonal of a matrix product).
+*/
+template< typename MT >  // Type of the dense matrix
+class Band<MT,true>
+   : public View< DenseVector< Band<MT,true>, false > >
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite data type of the dense matrix expression.
+   using Operand = If_< IsExpression<MT>, MT, MT& >;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper structure for the selection of the element access types of the dense matrix.
+   /*! In case the given matrix type \a T is a matrix expression, its elements are accessed by
+       value. Otherwise the elements are accessed via the (constant) reference types of \a T. */
+   template< typename T, bool = IsExpression<T>::value >
+   struct Access {
+      using ConstReference = ConstReference_<T>;
+      using Reference      = If_< IsConst<T>, ConstReference_<T>, Reference_<T> >;
+   };
+
+   template< typename T >
+   struct Access<T,true> {
+      using ConstReference = ReturnType_<T>;
+      using Reference      = ReturnType_<T>;
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This          = Band<MT,true>;                         //!< Type of this Band instance.
+   using BaseType      = DenseVector<This,false>;               //!< Base type of this Band instance.
+   using ResultType    = DynamicVector<ElementType_<MT>,false>;  //!< Result type for expression template evaluations.
+   using TransposeType = TransposeType_<ResultType>;            //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_<MT>;                      //!< Type of the band elements.
+   using ReturnType    = ReturnType_<MT>;                       //!< Return type for expression template evaluations
+   using CompositeType = const Band&;                           //!< Data type for composite expression templates.
+
+   //! Reference to a constant band value.
+   using ConstReference = typename Access<MT>::ConstReference;
+
+   //! Reference to a non-constant band value.
+   using Reference = typename Access<MT>::Reference;
+   //**********************************************************************************************
+
+   //**BandIterator class definition***************************************************************
+   /*!\brief Iterator over the elements of the dense band.
+   */
+   template< typename MatrixType >  // Type of the dense matrix
+   class BandIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      //! Return type for the access to the value of a dense element.
+      using Reference = typename Access<MatrixType>::Reference;
+
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = RemoveReference_<Reference>;      //!< Type of the underlying elements.
+      using PointerType      = ValueType*;                       //!< Pointer return type.
+      using ReferenceType    = Reference;                        //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the BandIterator class.
+      */
+      inline BandIterator() noexcept
+         : matrix_( nullptr )  // The dense matrix containing the band.
+         , row_   ( 0UL )      // The current row index.
+         , column_( 0UL )      // The current column index.
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor of the BandIterator class.
+      //
+      // \param matrix The matrix containing the band.
+      // \param row The row index.
+      // \param column The column index.
+      */
+      inline BandIterator( MatrixType& matrix, size_t row, size_t column ) noexcept
+         : matrix_( &matrix )  // The dense matrix containing the band.
+         , row_   ( row     )  // The current row index.
+         , column_( column  )  // The current column index.
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different BandIterator instances.
+      //
+      // \param it The band iterator to be copied.
+      */
+      template< typename MatrixType2 >
+      inline BandIterator( const BandIterator<MatrixType2>& it ) noexcept
+         : matrix_( it.matrix_ )  // The dense matrix containing the band.
+         , row_   ( it.row_    )  // The current row index.
+         , column_( it.column_ )  // The current column index.
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline BandIterator& operator+=( size_t inc ) noexcept {
+         row_    += inc;
+         column_ += inc;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline BandIterator& operator-=( size_t dec ) noexcept {
+         row_    -= dec;
+         column_ -= dec;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline BandIterator& operator++() noexcept {
+         ++row_;
+         ++column_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const BandIterator operator++( int ) noexcept {
+         const BandIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline BandIterator& operator--() noexcept {
+         --row_;
+         --column_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const BandIterator operator--( int ) noexcept {
+         const BandIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Subscript operator***********************************************************************
+      /*!\brief Direct access to the dense band elements.
+      //
+      // \param index Access index.
+      // \return Reference to the accessed value.
+      */
+      inline ReferenceType operator[]( size_t index ) const {
+         return (*matrix_)(row_+index,column_+index);
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the dense vector element at the current iterator position.
+      //
+      // \return The current value of the dense element.
+      */
+      inline ReferenceType operator*() const {
+         return (*matrix_)(row_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the dense vector element at the current iterator position.
+      //
+      // \return Reference to the dense vector element at the current iterator position.
+      */
+      inline PointerType operator->() const {
+         return &(*matrix_)(row_,column_);
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side band iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename MatrixType2 >
+      inline bool operator==( const BandIterator<MatrixType2>& rhs ) const noexcept {
+         return ( matrix_ == rhs.matrix_ ) && ( row_ == rhs.row_ ) && ( column_ == rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side band iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename MatrixType2 >
+      inline bool operator!=( const BandIterator<MatrixType2>& rhs ) const noexcept {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side band iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      template< typename MatrixType2 >
+      inline bool operator<( const BandIterator<MatrixType2>& rhs ) const noexcept {
+         return ( matrix_ == rhs.matrix_ ) && ( row_ < rhs.row_ ) && ( column_ < rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side band iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      template< typename MatrixType2 >
+      inline bool operator>( const BandIterator<MatrixType2>& rhs ) const noexcept {
+         return ( matrix_ == rhs.matrix_ ) && ( row_ > rhs.row_ ) && ( column_ > rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side band iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      template< typename MatrixType2 >
+      inline bool operator<=( const BandIterator<MatrixType2>& rhs ) const noexcept {
+         return ( matrix_ == rhs.matrix_ ) && ( row_ <= rhs.row_ ) && ( column_ <= rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two BandIterator objects.
+      //
+      // \param rhs The right-hand side band iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      template< typename MatrixType2 >
+      inline bool operator>=( const BandIterator<MatrixType2>& rhs ) const noexcept {
+         return ( matrix_ == rhs.matrix_ ) && ( row_ >= rhs.row_ ) && ( column_ >= rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two band iterators.
+      //
+      // \param rhs The right-hand side band iterator.
+      // \return The number of elements between the two band iterators.
+      */
+      inline DifferenceType operator-( const BandIterator& rhs ) const noexcept {
+         return row_ - rhs.row_;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a BandIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const BandIterator operator+( const BandIterator& it, size_t inc ) noexcept {
+         return BandIterator( *it.matrix_, it.row_+inc, it.column_+inc );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a BandIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const BandIterator operator+( size_t inc, const BandIterator& it ) noexcept {
+         return BandIterator( *it.matrix_, it.row_+inc, it.column_+inc );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a BandIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const BandIterator operator-( const BandIterator& it, size_t dec ) noexcept {
+         return BandIterator( *it.matrix_, it.row_-dec, it.column_-dec );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      MatrixType* matrix_;  //!< The dense matrix containing the band.
+      size_t      row_;     //!< The current row index.
+      size_t      column_;  //!< The current column index.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename MatrixType2 > friend class BandIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Iterator over constant elements.
+   using ConstIterator = BandIterator<const MT>;
+
+   //! Iterator over non-constant elements.
+   using Iterator = If_< IsConst<MT>, ConstIterator, BandIterator<MT> >;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline Band( Operand matrix, ptrdiff_t index );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator[]( size_t index );
+   inline ConstReference operator[]( size_t index ) const;
+   inline Reference      at( size_t index );
+   inline ConstReference at( size_t index ) const;
+   inline Iterator       begin ();
+   inline ConstIterator  begin () const;
+   inline ConstIterator  cbegin() const;
+   inline Iterator       end   ();
+   inline ConstIterator  end   () const;
+   inline ConstIterator  cend  () const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline Band& operator=( const ElementType& rhs );
+   inline Band& operator=( initializer_list<ElementType> list );
+   inline Band& operator=( const Band& rhs );
+
+   template< typename VT > inline Band& operator= ( const Vector<VT,false>& rhs );
+   template< typename VT > inline Band& operator+=( const Vector<VT,false>& rhs );
+   template< typename VT > inline Band& operator-=( const Vector<VT,false>& rhs );
+   template< typename VT > inline Band& operator*=( const Vector<VT,false>& rhs );
+   template< typename VT > inline Band& operator/=( const DenseVector<VT,false>& rhs );
+   template< typename VT > inline Band& operator%=( const Vector<VT,false>& rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, Band >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, Band >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Operand   operand() const noexcept;
+   inline ptrdiff_t band() const noexcept;
+   inline size_t    row() const noexcept;
+   inline size_t    column() const noexcept;
+   inline size_t    size() const noexcept;
+   inline size_t    spacing() const noexcept;
+   inline size_t    capacity() const noexcept;
+   inline size_t    nonZeros() const;
+   inline void      reset();
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   template< typename Other > inline Band& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other >
+   inline bool canAlias ( const Other* alias ) const noexcept;
+
+   template< typename MT2 >
+   inline bool canAlias ( const Band<MT2,true>* alias ) const noexcept;
+
+   template< typename Other >
+   inline bool isAliased( const Other* alias ) const noexcept;
+
+   template< typename MT2 >
+   inline bool isAliased( const Band<MT2,true>* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename VT > inline void assign    ( const DenseVector <VT,false>& rhs );
+   template< typename VT > inline void assign    ( const SparseVector<VT,false>& rhs );
+   template< typename VT > inline void addAssign ( const DenseVector <VT,false>& rhs );
+   template< typename VT > inline void addAssign ( const SparseVector<VT,false>& rhs );
+   template< typename VT > inline void subAssign ( const DenseVector <VT,false>& rhs );
+   template< typename VT > inline void subAssign ( const SparseVector<VT,false>& rhs );
+   template< typename VT > inline void multAssign( const DenseVector <VT,false>& rhs );
+   template< typename VT > inline void divAssign ( const DenseVector <VT,false>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Operand         matrix_;  //!< The dense matrix containing the band.
+   const ptrdiff_t band_;    //!< The index of the band in the matrix.
+   const size_t    row_;     //!< The row index of the first element of the band.
+   const size_t    column_;  //!< The column index of the first element of the band.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   template< typename MT2, bool DF2 > friend class Band;
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( MT );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The constructor for Band.
+//
+// \param matrix The matrix containing the band.
+// \param index The index of the band (0 for the diagonal, positive for superdiagonals).
+// \exception std::invalid_argument Invalid band access index.
+*/
+template< typename MT >  // Type of the dense matrix
+inline Band<MT,true>::Band( Operand matrix, ptrdiff_t index )
+   : matrix_( matrix )                           // The dense matrix containing the band
+   , band_  ( index  )                           // The index of the band in the matrix
+   , row_   ( index < 0L ? size_t( -index ) : 0UL )  // The row index of the first band element
+   , column_( index > 0L ? size_t(  index ) : 0UL )  // The column index of the first band element
+{
+   if( ( index > 0L && matrix_.columns() <= column_ ) ||
+       ( index < 0L && matrix_.rows()    <= row_    ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid band access index" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subscript operator for the direct access to the band elements.
+//
+// \param index Access index. The index must be smaller than the size of the band.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename Band<MT,true>::Reference Band<MT,true>::operator[]( size_t index )
+{
+   BLAZE_USER_ASSERT( index < size(), "Invalid band access index" );
+   return matrix_(row_+index,column_+index);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subscript operator for the direct access to the band elements.
+//
+// \param index Access index. The index must be smaller than the size of the band.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename Band<MT,true>::ConstReference Band<MT,true>::operator[]( size_t index ) const
+{
+   BLAZE_USER_ASSERT( index < size(), "Invalid band access index" );
+   return const_cast<const MT&>( matrix_ )(row_+index,column_+index);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checked access to the band elements.
+//
+// \param index Access index. The index must be smaller than the size of the band.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid band access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access index.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename Band<MT,true>::Reference Band<MT,true>::at( size_t index )
+{
+   if( index >= size() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid band access index" );
+   }
+   return (*this)[index];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checked access to the band elements.
+//
+// \param index Access index. The index must be smaller than the size of the band.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid band access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access index.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename Band<MT,true>::ConstReference Band<MT,true>::at( size_t index ) const
+{
+   if( index >= size() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid band access index" );
+   }
+   return (*this)[index];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of the band.
+//
+// \return Iterator to the first element of the band.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename Band<MT,true>::Iterator Band<MT,true>::begin()
+{
+   return Iterator( matrix_, row_, column_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of the band.
+//
+// \return Iterator to the first element of the band.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename Band<MT,true>::ConstIterator Band<MT,true>::begin() const
+{
+   return ConstIterator( matrix_, row_, column_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of the band.
+//
+// \return Iterator to the first element of the band.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename Band<MT,true>::ConstIterator Band<MT,true>::cbegin() const
+{
+   return ConstIterator( matrix_, row_, column_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of the band.
+//
+// \return Iterator just past the last element of the band.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename Band<MT,true>::Iterator Band<MT,true>::end()
+{
+   return Iterator( matrix_, row_+size(), column_+size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of the band.
+//
+// \return Iterator just past the last element of the band.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename Band<MT,true>::ConstIterator Band<MT,true>::end() const
+{
+   return ConstIterator( matrix_, row_+size(), column_+size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of the band.
+//
+// \return Iterator just past the last element of the band.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename Band<MT,true>::ConstIterator Band<MT,true>::cend() const
+{
+   return ConstIterator( matrix_, row_+size(), column_+size() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Homogenous assignment to all band elements.
+//
+// \param rhs Scalar value to be assigned to all band elements.
+// \return Reference to the assigned band.
+*/
+template< typename MT >  // Type of the dense matrix
+inline Band<MT,true>& Band<MT,true>::operator=( const ElementType& rhs )
+{
+   const size_t n( size() );
+
+   for( size_t i=0UL; i<n; ++i )
+      matrix_(row_+i,column_+i) = rhs;
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief List assignment to all band elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Invalid assignment to band.
+//
+// This assignment operator offers the option to directly assign to all elements of the dense
+// band by means of an initializer list. The band elements are assigned the values from the
+// given initializer list. Missing values are reset to their default state. Note that in case
+// the size of the initializer list exceeds the size of the band, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+inline Band<MT,true>& Band<MT,true>::operator=( initializer_list<ElementType> list )
+{
+   if( list.size() > size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to band" );
+   }
+
+   std::fill( std::copy( list.begin(), list.end(), begin() ), end(), ElementType() );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copy assignment operator for Band.
+//
+// \param rhs Dense band to be copied.
+// \return Reference to the assigned band.
+// \exception std::invalid_argument Band sizes do not match.
+//
+// In case the current sizes of the two bands don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+inline Band<MT,true>& Band<MT,true>::operator=( const Band& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   if( size() != rhs.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Band sizes do not match" );
+   }
+
+   if( rhs.canAlias( &matrix_ ) ) {
+      const ResultType tmp( rhs );
+      assign( tmp );
+   }
+   else {
+      assign( rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operator for different vectors.
+//
+// \param rhs Vector to be assigned.
+// \return Reference to the assigned band.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side vector
+inline Band<MT,true>& Band<MT,true>::operator=( const Vector<VT,false>& rhs )
+{
+   if( size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const ResultType tmp( ~rhs );
+      assign( tmp );
+   }
+   else {
+      if( IsSparseVector<VT>::value )
+         reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment operator for the addition of a vector (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be added to the dense band.
+// \return Reference to the assigned band.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side vector
+inline Band<MT,true>& Band<MT,true>::operator+=( const Vector<VT,false>& rhs )
+{
+   if( size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const ResultType tmp( ~rhs );
+      addAssign( tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment operator for the subtraction of a vector (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be subtracted from the dense band.
+// \return Reference to the assigned band.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side vector
+inline Band<MT,true>& Band<MT,true>::operator-=( const Vector<VT,false>& rhs )
+{
+   if( size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const ResultType tmp( ~rhs );
+      subAssign( tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be multiplied with the dense band.
+// \return Reference to the assigned band.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side vector
+inline Band<MT,true>& Band<MT,true>::operator*=( const Vector<VT,false>& rhs )
+{
+   if( size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const ResultType tmp( *this * (~rhs) );
+   assign( tmp );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Division assignment operator for the division of a dense vector (\f$ \vec{a}/=\vec{b} \f$).
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return Reference to the assigned band.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side dense vector
+inline Band<MT,true>& Band<MT,true>::operator/=( const DenseVector<VT,false>& rhs )
+{
+   if( size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &matrix_ ) ) {
+      const ResultType tmp( ~rhs );
+      divAssign( tmp );
+   }
+   else {
+      smpDivAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cross product assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}\times=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector for the cross product.
+// \return Reference to the assigned band.
+// \exception std::invalid_argument Invalid vector size for cross product.
+//
+// In case the current size of any of the two vectors is not equal to 3, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side vector
+inline Band<MT,true>& Band<MT,true>::operator%=( const Vector<VT,false>& rhs )
+{
+   using CrossType = CrossTrait_< ResultType, ResultType_<VT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE  ( CrossType );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE ( CrossType );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( CrossType );
+
+   if( size() != 3UL || (~rhs).size() != 3UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid vector size for cross product" );
+   }
+
+   const CrossType tmp( *this % (~rhs) );
+   assign( tmp );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication assignment operator for the multiplication between a dense band and
+//        a scalar value (\f$ \vec{a}*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the band.
+*/
+template< typename MT >     // Type of the dense matrix
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, Band<MT,true> >& Band<MT,true>::operator*=( Other rhs )
+{
+   return scale( rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Division assignment operator for the division of a dense band by a scalar value
+//        (\f$ \vec{a}/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the band.
+//
+// \note A division by zero is only checked by an user assert.
+*/
+template< typename MT >     // Type of the dense matrix
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, Band<MT,true> >& Band<MT,true>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   return operator=( (*this) / rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the matrix containing the band.
+//
+// \return The matrix containing the band.
+*/
+template< typename MT >  // Type of the dense matrix
+inline typename Band<MT,true>::Operand Band<MT,true>::operand() const noexcept
+{
+   return matrix_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the band of the underlying dense matrix.
+//
+// \return The index of the band (0 for the diagonal, positive for superdiagonals).
+*/
+template< typename MT >  // Type of the dense matrix
+inline ptrdiff_t Band<MT,true>::band() const noexcept
+{
+   return band_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the row index of the first element of the band.
+//
+// \return The row index of the first band element.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t Band<MT,true>::row() const noexcept
+{
+   return row_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the column index of the first element of the band.
+//
+// \return The column index of the first band element.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t Band<MT,true>::column() const noexcept
+{
+   return column_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current size/dimension of the band.
+//
+// \return The size of the band.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t Band<MT,true>::size() const noexcept
+{
+   return min( matrix_.rows() - row_, matrix_.columns() - column_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the minimum capacity of the band.
+//
+// \return The minimum capacity of the band.
+//
+// Since the elements of a band are not stored adjacently, the band has no padding and the
+// spacing corresponds to the size of the band.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t Band<MT,true>::spacing() const noexcept
+{
+   return size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum capacity of the dense band.
+//
+// \return The maximum capacity of the dense band.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t Band<MT,true>::capacity() const noexcept
+{
+   return size();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the band.
+//
+// \return The number of non-zero elements in the band.
+*/
+template< typename MT >  // Type of the dense matrix
+inline size_t Band<MT,true>::nonZeros() const
+{
+   const size_t n( size() );
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<n; ++i )
+      if( !isDefault( matrix_(row_+i,column_+i) ) )
+         ++nonzeros;
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+inline void Band<MT,true>::reset()
+{
+   using blaze::clear;
+
+   const size_t n( size() );
+
+   for( size_t i=0UL; i<n; ++i )
+      clear( matrix_(row_+i,column_+i) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of the band by the scalar value \a scalar (\f$ \vec{a}=\vec{b}*s \f$).
+//
+// \param scalar The scalar value for the band scaling.
+// \return Reference to the dense band.
+//
+// This function scales the band by applying the given scalar value \a scalar to each element
+// of the band. For built-in and \c complex data types it has the same effect as using the
+// multiplication assignment operator.
+*/
+template< typename MT >     // Type of the dense matrix
+template< typename Other >  // Data type of the scalar value
+inline Band<MT,true>& Band<MT,true>::scale( const Other& scalar )
+{
+   const size_t n( size() );
+
+   for( size_t i=0UL; i<n; ++i )
+      matrix_(row_+i,column_+i) *= scalar;
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the dense band can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this dense band, \a false if not.
+//
+// This function returns whether the given address can alias with the dense band. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions to
+// optimize the evaluation.
+*/
+template< typename MT >     // Type of the dense matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool Band<MT,true>::canAlias( const Other* alias ) const noexcept
+{
+   return matrix_.isAliased( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the dense band can alias with the given dense band \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this dense band, \a false if not.
+//
+// This function returns whether the given address can alias with the dense band. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions to
+// optimize the evaluation.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Data type of the foreign dense band
+inline bool Band<MT,true>::canAlias( const Band<MT2,true>* alias ) const noexcept
+{
+   return matrix_.isAliased( &alias->matrix_ ) && ( band_ == alias->band_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the dense band is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this dense band, \a false if not.
+//
+// This function returns whether the given address is aliased with the dense band. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions to
+// optimize the evaluation.
+*/
+template< typename MT >     // Type of the dense matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool Band<MT,true>::isAliased( const Other* alias ) const noexcept
+{
+   return matrix_.isAliased( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the dense band is aliased with the given dense band \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this dense band, \a false if not.
+//
+// This function returns whether the given address is aliased with the dense band. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions to
+// optimize the evaluation.
+*/
+template< typename MT >   // Type of the dense matrix
+template< typename MT2 >  // Data type of the foreign dense band
+inline bool Band<MT,true>::isAliased( const Band<MT2,true>* alias ) const noexcept
+{
+   return matrix_.isAliased( &alias->matrix_ ) && ( band_ == alias->band_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the dense band is properly aligned in memory.
+//
+// \return \a true in case the dense band is aligned, \a false if not.
+//
+// Since the elements of a band are strided in memory, the band is never considered aligned.
+*/
+template< typename MT >  // Type of the dense matrix
+inline bool Band<MT,true>::isAligned() const noexcept
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the dense band can be used in SMP assignments.
+//
+// \return \a true in case the dense band can be used in SMP assignments, \a false if not.
+//
+// The band of a matrix has at most \f$ \min(M,N) \f$ strided elements, which never justifies
+// the overhead of a parallel assignment. Therefore this function always returns \a false.
+*/
+template< typename MT >  // Type of the dense matrix
+inline bool Band<MT,true>::canSMPAssign() const noexcept
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side dense vector
+inline void Band<MT,true>::assign( const DenseVector<VT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( (~rhs).size() & size_t(-2) );
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      matrix_(row_+i    ,column_+i    ) = (~rhs)[i    ];
+      matrix_(row_+i+1UL,column_+i+1UL) = (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      matrix_(row_+ipos,column_+ipos) = (~rhs)[ipos];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void Band<MT,true>::assign( const SparseVector<VT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   for( ConstIterator_<VT> element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      matrix_(row_+element->index(),column_+element->index()) = element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side dense vector
+inline void Band<MT,true>::addAssign( const DenseVector<VT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( (~rhs).size() & size_t(-2) );
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      matrix_(row_+i    ,column_+i    ) += (~rhs)[i    ];
+      matrix_(row_+i+1UL,column_+i+1UL) += (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      matrix_(row_+ipos,column_+ipos) += (~rhs)[ipos];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void Band<MT,true>::addAssign( const SparseVector<VT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   for( ConstIterator_<VT> element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      matrix_(row_+element->index(),column_+element->index()) += element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side dense vector
+inline void Band<MT,true>::subAssign( const DenseVector<VT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( (~rhs).size() & size_t(-2) );
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      matrix_(row_+i    ,column_+i    ) -= (~rhs)[i    ];
+      matrix_(row_+i+1UL,column_+i+1UL) -= (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      matrix_(row_+ipos,column_+ipos) -= (~rhs)[ipos];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void Band<MT,true>::subAssign( const SparseVector<VT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   for( ConstIterator_<VT> element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      matrix_(row_+element->index(),column_+element->index()) -= element->value();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side dense vector
+inline void Band<MT,true>::multAssign( const DenseVector<VT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( (~rhs).size() & size_t(-2) );
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      matrix_(row_+i    ,column_+i    ) *= (~rhs)[i    ];
+      matrix_(row_+i+1UL,column_+i+1UL) *= (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      matrix_(row_+ipos,column_+ipos) *= (~rhs)[ipos];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the division assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT >  // Type of the dense matrix
+template< typename VT >  // Type of the right-hand side dense vector
+inline void Band<MT,true>::divAssign( const DenseVector<VT,false>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( (~rhs).size() & size_t(-2) );
+   for( size_t i=0UL; i<ipos; i+=2UL ) {
+      matrix_(row_+i    ,column_+i    ) /= (~rhs)[i    ];
+      matrix_(row_+i+1UL,column_+i+1UL) /= (~rhs)[i+1UL];
+   }
+   if( ipos < (~rhs).size() )
+      matrix_(row_+ipos,column_+ipos) /= (~rhs)[ipos];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,101 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/columnslice/BaseTemplate.h
+//  \brief Header file for the implementation of the ColumnSlice base template
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_VIEWS_COLUMNSLICE_BASETEMPLATE_H_
+#define _BLAZE_MATH_VIEWS_COLUMNSLICE_BASETEMPLATE_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup columnslice ColumnSlice
+// \ingroup views
+*/
+/*!\brief Reference to a specific column slice of a dense tensor.
+// \ingroup columnslice
+//
+// The ColumnSlice template represents a reference to the \a j-th column of all pages of a dense
+// tensor. The type of the tensor is specified via the only template parameter:
+
+   \code
+   template< typename TT >
+   class ColumnSlice;
+   \endcode
+
+//  - TT: specifies the type of the dense tensor. The tensor type must provide low-level data
+//        access (as for instance DynamicTensor and CustomTensor).
+//
+//
+// \n \section columnslice_setup Setup of Column Slices
+//
+// A reference to a column slice of a dense tensor can be created very conveniently via the
+// \c columnslice() function. The column slice of an \f$ O \times M \times N \f$ tensor is a
+// row-major \f$ O \times M \f$ dense matrix, whose element \f$ (k,i) \f$ refers to the element
+// \f$ (k,i,j) \f$ of the tensor. The column slice can be treated as any other dense matrix, i.e.
+// it can be assigned to, it can be copied from, and it can be used in arithmetic operations:
+
+   \code
+   using DenseTensorType = blaze::DynamicTensor<double>;
+   using DenseMatrixType = blaze::DynamicMatrix<double,rowMajor>;
+
+   DenseTensorType T( 4UL, 10UL, 20UL );
+   DenseMatrixType A( 4UL, 10UL ), B;
+   // ... Initialization
+
+   // Setting the 5th column of all pages of T to A
+   blaze::ColumnSlice<DenseTensorType> cs = columnslice( T, 5UL );
+   cs = A;
+
+   // Computing a matrix product with the 7th column slice of T
+   B = columnslice( T, 7UL ) * trans( A );
+   \endcode
+
+// In contrast to page and row slices, the elements of a column slice are not stored contiguously
+// (the distance between two elements of a row of the column slice is the spacing of the tensor).
+// Therefore the column slice is not a CustomMatrix but a strided view, which is neither
+// vectorized nor parallelized. In case the column index is invalid, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+class ColumnSlice;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1315 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/views/columnslice/Dense.h
+//  \brief Header file for the implementation of the ColumnSlice view on dense tensors
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+#ifndef _BLAZE_MATH_VIEWS_COLUMNSLICE_DENSE_H_
+#define _BLAZE_MATH_VIEWS_COLUMNSLICE_DENSE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Expression.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/View.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/views/columnslice/BaseTemplate.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief View on a specific column of all pages of a dense tensor.
+// \ingroup views
+//
+// The row \a k of the column slice consists of the elements \f$ (k,i,j) \f$ of the tensor for
+// all rows \a i, i.e. it is a strided sequence of elements with the spacing of the tensor as
+// stride. All accesses are performed directly on the data of the tensor.
+*/
+template< typename TT >  // Type of the dense tensor
+class ColumnSlice
+   : public View< DenseMatrix< ColumnSlice<TT>, rowMajor > >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This          = ColumnSlice<TT>;                                //!< Type of this ColumnSlice instance.
+   using BaseType      = DenseMatrix<This,rowMajor>;                     //!< Base type of this ColumnSlice instance.
+   using ResultType    = DynamicMatrix< RemoveConst_< ElementType_<TT> >, rowMajor >;  //!< Result type for expression template evaluations.
+   using OppositeType  = OppositeType_<ResultType>;                      //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType = TransposeType_<ResultType>;                     //!< Transpose type for expression template evaluations.
+   using ElementType   = ElementType_<TT>;                               //!< Type of the column slice elements.
+   using ReturnType    = ReturnType_<TT>;                                //!< Return type for expression template evaluations
+   using CompositeType = const ColumnSlice&;                             //!< Data type for composite expression templates.
+
+   //! Reference to a constant column slice value.
+   using ConstReference = ConstReference_<TT>;
+
+   //! Reference to a non-constant column slice value.
+   using Reference = If_< IsConst<TT>, ConstReference_<TT>, Reference_<TT> >;
+
+   //! Pointer to a constant column slice value.
+   using ConstPointer = ConstPointer_<TT>;
+
+   //! Pointer to a non-constant column slice value.
+   using Pointer = If_< IsConst<TT>, ConstPointer_<TT>, Pointer_<TT> >;
+   //**********************************************************************************************
+
+   //**StridedIterator class definition************************************************************
+   /*!\brief Iterator over the elements of a row of the column slice.
+   */
+   template< typename PointerType >  // Type of the pointer to the tensor elements
+   class StridedIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using IteratorCategory = std::random_access_iterator_tag;         //!< The iterator category.
+      using ValueType        = RemoveConst_< ElementType_<TT> >;        //!< Type of the underlying elements.
+      using ReferenceType    = decltype( *std::declval<PointerType>() );  //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                               //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Default constructor of the StridedIterator class.
+      */
+      inline StridedIterator() noexcept
+         : ptr_   ( nullptr )  // Pointer to the current element
+         , stride_( 0UL )      // Distance between two consecutive elements
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor of the StridedIterator class.
+      //
+      // \param ptr Pointer to the initial element.
+      // \param stride The distance between two consecutive elements.
+      */
+      inline StridedIterator( PointerType ptr, size_t stride ) noexcept
+         : ptr_   ( ptr    )  // Pointer to the current element
+         , stride_( stride )  // Distance between two consecutive elements
+      {}
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Conversion constructor from different StridedIterator instances.
+      //
+      // \param it The strided iterator to be copied.
+      */
+      template< typename PointerType2 >
+      inline StridedIterator( const StridedIterator<PointerType2>& it ) noexcept
+         : ptr_   ( it.ptr_    )  // Pointer to the current element
+         , stride_( it.stride_ )  // Distance between two consecutive elements
+      {}
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline StridedIterator& operator+=( size_t inc ) noexcept {
+         ptr_ += inc * stride_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline StridedIterator& operator-=( size_t dec ) noexcept {
+         ptr_ -= dec * stride_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline StridedIterator& operator++() noexcept {
+         ptr_ += stride_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const StridedIterator operator++( int ) noexcept {
+         const StridedIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline StridedIterator& operator--() noexcept {
+         ptr_ -= stride_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const StridedIterator operator--( int ) noexcept {
+         const StridedIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Subscript operator***********************************************************************
+      /*!\brief Direct access to the elements of the row.
+      //
+      // \param index Access index.
+      // \return Reference to the accessed value.
+      */
+      inline ReferenceType operator[]( size_t index ) const noexcept {
+         return ptr_[index*stride_];
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Reference to the current element.
+      */
+      inline ReferenceType operator*() const noexcept {
+         return *ptr_;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Pointer to the current element.
+      */
+      inline PointerType operator->() const noexcept {
+         return ptr_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two StridedIterator objects.
+      //
+      // \param rhs The right-hand side strided iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      template< typename PointerType2 >
+      inline bool operator==( const StridedIterator<PointerType2>& rhs ) const noexcept {
+         return ptr_ == rhs.ptr_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two StridedIterator objects.
+      //
+      // \param rhs The right-hand side strided iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      template< typename PointerType2 >
+      inline bool operator!=( const StridedIterator<PointerType2>& rhs ) const noexcept {
+         return ptr_ != rhs.ptr_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two StridedIterator objects.
+      //
+      // \param rhs The right-hand side strided iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      template< typename PointerType2 >
+      inline bool operator<( const StridedIterator<PointerType2>& rhs ) const noexcept {
+         return ptr_ < rhs.ptr_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two StridedIterator objects.
+      //
+      // \param rhs The right-hand side strided iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      template< typename PointerType2 >
+      inline bool operator>( const StridedIterator<PointerType2>& rhs ) const noexcept {
+         return ptr_ > rhs.ptr_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two StridedIterator objects.
+      //
+      // \param rhs The right-hand side strided iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      template< typename PointerType2 >
+      inline bool operator<=( const StridedIterator<PointerType2>& rhs ) const noexcept {
+         return ptr_ <= rhs.ptr_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two StridedIterator objects.
+      //
+      // \param rhs The right-hand side strided iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      template< typename PointerType2 >
+      inline bool operator>=( const StridedIterator<PointerType2>& rhs ) const noexcept {
+         return ptr_ >= rhs.ptr_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two strided iterators.
+      //
+      // \param rhs The right-hand side strided iterator.
+      // \return The number of elements between the two strided iterators.
+      */
+      inline DifferenceType operator-( const StridedIterator& rhs ) const noexcept {
+         return ( ptr_ - rhs.ptr_ ) / DifferenceType( stride_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a StridedIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const StridedIterator operator+( const StridedIterator& it, size_t inc ) noexcept {
+         return StridedIterator( it.ptr_ + inc*it.stride_, it.stride_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a StridedIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const StridedIterator operator+( size_t inc, const StridedIterator& it ) noexcept {
+         return StridedIterator( it.ptr_ + inc*it.stride_, it.stride_ );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a StridedIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const StridedIterator operator-( const StridedIterator& it, size_t dec ) noexcept {
+         return StridedIterator( it.ptr_ - dec*it.stride_, it.stride_ );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      PointerType ptr_;     //!< Pointer to the current element.
+      size_t      stride_;  //!< Distance between two consecutive elements.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename PointerType2 > friend class StridedIterator;
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   //! Iterator over constant elements.
+   using ConstIterator = StridedIterator<ConstPointer>;
+
+   //! Iterator over non-constant elements.
+   using Iterator = StridedIterator<Pointer>;
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   enum : bool { simdEnabled = false };
+
+   //! Compilation switch for the expression template assignment strategy.
+   enum : bool { smpAssignable = false };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline ColumnSlice( TT& tensor, size_t index );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t k, size_t i );
+   inline ConstReference operator()( size_t k, size_t i ) const;
+   inline Reference      at( size_t k, size_t i );
+   inline ConstReference at( size_t k, size_t i ) const;
+   inline Iterator       begin ( size_t k );
+   inline ConstIterator  begin ( size_t k ) const;
+   inline ConstIterator  cbegin( size_t k ) const;
+   inline Iterator       end   ( size_t k );
+   inline ConstIterator  end   ( size_t k ) const;
+   inline ConstIterator  cend  ( size_t k ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline ColumnSlice& operator=( const ElementType& rhs );
+   inline ColumnSlice& operator=( const ColumnSlice& rhs );
+
+   template< typename MT, bool SO > inline ColumnSlice& operator= ( const DenseMatrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline ColumnSlice& operator+=( const DenseMatrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline ColumnSlice& operator-=( const DenseMatrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline ColumnSlice& operator%=( const DenseMatrix<MT,SO>& rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, ColumnSlice >& operator*=( Other rhs );
+
+   template< typename Other >
+   inline EnableIf_< IsNumeric<Other>, ColumnSlice >& operator/=( Other rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline TT&    operand() const noexcept;
+   inline size_t column() const noexcept;
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t spacing() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const;
+   inline void   reset();
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other >
+   inline bool canAlias ( const Other* alias ) const noexcept;
+
+   template< typename Other >
+   inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO > inline void assign     ( const DenseMatrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline void addAssign  ( const DenseMatrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline void subAssign  ( const DenseMatrix<MT,SO>& rhs );
+   template< typename MT, bool SO > inline void schurAssign( const DenseMatrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   TT&          tensor_;  //!< The dense tensor containing the column slice.
+   const size_t column_;  //!< The index of the column in the tensor.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_NOT_BE_EXPRESSION_TYPE( TT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE   ( TT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE ( TT );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The constructor for ColumnSlice.
+//
+// \param tensor The dense tensor containing the column slice.
+// \param index The index of the column.
+// \exception std::invalid_argument Invalid columnslice access index.
+*/
+template< typename TT >  // Type of the dense tensor
+inline ColumnSlice<TT>::ColumnSlice( TT& tensor, size_t index )
+   : tensor_( tensor )  // The dense tensor containing the column slice
+   , column_( index  )  // The index of the column in the tensor
+{
+   if( column_ >= tensor_.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid columnslice access index" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the column slice elements.
+//
+// \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename TT >  // Type of the dense tensor
+inline typename ColumnSlice<TT>::Reference ColumnSlice<TT>::operator()( size_t k, size_t i )
+{
+   BLAZE_USER_ASSERT( k < rows()   , "Invalid page access index" );
+   BLAZE_USER_ASSERT( i < columns(), "Invalid row access index"  );
+
+   return tensor_(k,i,column_);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the column slice elements.
+//
+// \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename TT >  // Type of the dense tensor
+inline typename ColumnSlice<TT>::ConstReference ColumnSlice<TT>::operator()( size_t k, size_t i ) const
+{
+   BLAZE_USER_ASSERT( k < rows()   , "Invalid page access index" );
+   BLAZE_USER_ASSERT( i < columns(), "Invalid row access index"  );
+
+   return const_cast<const TT&>( tensor_ )(k,i,column_);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checked access to the column slice elements.
+//
+// \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid page or row access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename TT >  // Type of the dense tensor
+inline typename ColumnSlice<TT>::Reference ColumnSlice<TT>::at( size_t k, size_t i )
+{
+   if( k >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid page access index" );
+   }
+   if( i >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   return (*this)(k,i);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checked access to the column slice elements.
+//
+// \param k Access index for the page. The index has to be in the range \f$[0..O-1]\f$.
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid page or row access index.
+//
+// In contrast to the function call operator this function always performs a check of the
+// given access indices.
+*/
+template< typename TT >  // Type of the dense tensor
+inline typename ColumnSlice<TT>::ConstReference ColumnSlice<TT>::at( size_t k, size_t i ) const
+{
+   if( k >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid page access index" );
+   }
+   if( i >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   return (*this)(k,i);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row \a k of the column slice.
+//
+// \param k The row index (i.e. the page index of the tensor).
+// \return Iterator to the first element of row \a k.
+*/
+template< typename TT >  // Type of the dense tensor
+inline typename ColumnSlice<TT>::Iterator ColumnSlice<TT>::begin( size_t k )
+{
+   BLAZE_USER_ASSERT( k < rows(), "Invalid column slice row access index" );
+   return Iterator( tensor_.data( k, 0UL ) + column_, tensor_.spacing() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row \a k of the column slice.
+//
+// \param k The row index (i.e. the page index of the tensor).
+// \return Iterator to the first element of row \a k.
+*/
+template< typename TT >  // Type of the dense tensor
+inline typename ColumnSlice<TT>::ConstIterator ColumnSlice<TT>::begin( size_t k ) const
+{
+   BLAZE_USER_ASSERT( k < rows(), "Invalid column slice row access index" );
+   return ConstIterator( const_cast<const TT&>( tensor_ ).data( k, 0UL ) + column_, tensor_.spacing() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row \a k of the column slice.
+//
+// \param k The row index (i.e. the page index of the tensor).
+// \return Iterator to the first element of row \a k.
+*/
+template< typename TT >  // Type of the dense tensor
+inline typename ColumnSlice<TT>::ConstIterator ColumnSlice<TT>::cbegin( size_t k ) const
+{
+   return begin( k );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row \a k of the column slice.
+//
+// \param k The row index (i.e. the page index of the tensor).
+// \return Iterator just past the last element of row \a k.
+*/
+template< typename TT >  // Type of the dense tensor
+inline typename ColumnSlice<TT>::Iterator ColumnSlice<TT>::end( size_t k )
+{
+   return begin( k ) + columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row \a k of the column slice.
+//
+// \param k The row index (i.e. the page index of the tensor).
+// \return Iterator just past the last element of row \a k.
+*/
+template< typename TT >  // Type of the dense tensor
+inline typename ColumnSlice<TT>::ConstIterator ColumnSlice<TT>::end( size_t k ) const
+{
+   return begin( k ) + columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row \a k of the column slice.
+//
+// \param k The row index (i.e. the page index of the tensor).
+// \return Iterator just past the last element of row \a k.
+*/
+template< typename TT >  // Type of the dense tensor
+inline typename ColumnSlice<TT>::ConstIterator ColumnSlice<TT>::cend( size_t k ) const
+{
+   return end( k );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Homogenous assignment to all column slice elements.
+//
+// \param rhs Scalar value to be assigned to all column slice elements.
+// \return Reference to the assigned column slice.
+*/
+template< typename TT >  // Type of the dense tensor
+inline ColumnSlice<TT>& ColumnSlice<TT>::operator=( const ElementType& rhs )
+{
+   for( size_t k=0UL; k<rows(); ++k )
+      for( size_t i=0UL; i<columns(); ++i )
+         tensor_(k,i,column_) = rhs;
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copy assignment operator for ColumnSlice.
+//
+// \param rhs Dense column slice to be copied.
+// \return Reference to the assigned column slice.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two column slices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+inline ColumnSlice<TT>& ColumnSlice<TT>::operator=( const ColumnSlice& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   if( rows() != rhs.rows() || columns() != rhs.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( rhs.canAlias( &tensor_ ) ) {
+      const ResultType tmp( rhs );
+      assign( tmp );
+   }
+   else {
+      assign( rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be assigned.
+// \return Reference to the assigned column slice.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline ColumnSlice<TT>& ColumnSlice<TT>::operator=( const DenseMatrix<MT,SO>& rhs )
+{
+   if( rows() != (~rhs).rows() || columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &tensor_ ) ) {
+      const ResultType tmp( ~rhs );
+      smpAssign( *this, tmp );
+   }
+   else {
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment operator for the addition of a dense matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side dense matrix to be added to the column slice.
+// \return Reference to the column slice.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline ColumnSlice<TT>& ColumnSlice<TT>::operator+=( const DenseMatrix<MT,SO>& rhs )
+{
+   if( rows() != (~rhs).rows() || columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &tensor_ ) ) {
+      const ResultType tmp( ~rhs );
+      smpAddAssign( *this, tmp );
+   }
+   else {
+      smpAddAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment operator for the subtraction of a dense matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side dense matrix to be subtracted from the column slice.
+// \return Reference to the column slice.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline ColumnSlice<TT>& ColumnSlice<TT>::operator-=( const DenseMatrix<MT,SO>& rhs )
+{
+   if( rows() != (~rhs).rows() || columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &tensor_ ) ) {
+      const ResultType tmp( ~rhs );
+      smpSubAssign( *this, tmp );
+   }
+   else {
+      smpSubAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Schur product assignment operator for the multiplication of a dense matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return Reference to the column slice.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename TT >  // Type of the dense tensor
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline ColumnSlice<TT>& ColumnSlice<TT>::operator%=( const DenseMatrix<MT,SO>& rhs )
+{
+   if( rows() != (~rhs).rows() || columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( &tensor_ ) ) {
+      const ResultType tmp( ~rhs );
+      smpSchurAssign( *this, tmp );
+   }
+   else {
+      smpSchurAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication assignment operator for the multiplication between a column slice and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the column slice.
+*/
+template< typename TT >     // Type of the dense tensor
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, ColumnSlice<TT> >& ColumnSlice<TT>::operator*=( Other rhs )
+{
+   for( size_t k=0UL; k<rows(); ++k )
+      for( size_t i=0UL; i<columns(); ++i )
+         tensor_(k,i,column_) *= rhs;
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Division assignment operator for the division of a column slice by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the column slice.
+*/
+template< typename TT >     // Type of the dense tensor
+template< typename Other >  // Data type of the right-hand side scalar
+inline EnableIf_< IsNumeric<Other>, ColumnSlice<TT> >& ColumnSlice<TT>::operator/=( Other rhs )
+{
+   BLAZE_USER_ASSERT( rhs != Other(0), "Division by zero detected" );
+
+   for( size_t k=0UL; k<rows(); ++k )
+      for( size_t i=0UL; i<columns(); ++i )
+         tensor_(k,i,column_) /= rhs;
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the tensor containing the column slice.
+//
+// \return The tensor containing the column slice.
+*/
+template< typename TT >  // Type of the dense tensor
+inline TT& ColumnSlice<TT>::operand() const noexcept
+{
+   return tensor_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the index of the column of the underlying dense tensor.
+//
+// \return The index of the column.
+*/
+template< typename TT >  // Type of the dense tensor
+inline size_t ColumnSlice<TT>::column() const noexcept
+{
+   return column_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows of the column slice (i.e. the number of pages of the tensor).
+//
+// \return The number of rows of the column slice.
+*/
+template< typename TT >  // Type of the dense tensor
+inline size_t ColumnSlice<TT>::rows() const noexcept
+{
+   return tensor_.pages();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of columns of the column slice (i.e. the number of rows of the tensor).
+//
+// \return The number of columns of the column slice.
+*/
+template< typename TT >  // Type of the dense tensor
+inline size_t ColumnSlice<TT>::columns() const noexcept
+{
+   return tensor_.rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the spacing between the beginning of two rows.
+//
+// \return The spacing between the beginning of two rows.
+//
+// Since the elements of a column slice are not stored contiguously, this function returns the
+// number of columns of the column slice.
+*/
+template< typename TT >  // Type of the dense tensor
+inline size_t ColumnSlice<TT>::spacing() const noexcept
+{
+   return columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum capacity of the column slice.
+//
+// \return The capacity of the column slice.
+*/
+template< typename TT >  // Type of the dense tensor
+inline size_t ColumnSlice<TT>::capacity() const noexcept
+{
+   return rows() * columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the column slice.
+//
+// \return The number of non-zero elements in the column slice.
+*/
+template< typename TT >  // Type of the dense tensor
+inline size_t ColumnSlice<TT>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<rows(); ++k )
+      for( size_t i=0UL; i<columns(); ++i )
+         if( !isDefault( tensor_(k,i,column_) ) )
+            ++nonzeros;
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename TT >  // Type of the dense tensor
+inline void ColumnSlice<TT>::reset()
+{
+   using blaze::clear;
+
+   for( size_t k=0UL; k<rows(); ++k )
+      for( size_t i=0UL; i<columns(); ++i )
+         clear( tensor_(k,i,column_) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the column slice can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this column slice, \a false if not.
+*/
+template< typename TT >     // Type of the dense tensor
+template< typename Other >  // Data type of the foreign expression
+inline bool ColumnSlice<TT>::canAlias( const Other* alias ) const noexcept
+{
+   return tensor_.isAliased( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the column slice is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this column slice, \a false if not.
+*/
+template< typename TT >     // Type of the dense tensor
+template< typename Other >  // Data type of the foreign expression
+inline bool ColumnSlice<TT>::isAliased( const Other* alias ) const noexcept
+{
+   return tensor_.isAliased( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the column slice is properly aligned in memory.
+//
+// \return \a false since the elements of a column slice are not stored contiguously.
+*/
+template< typename TT >  // Type of the dense tensor
+inline bool ColumnSlice<TT>::isAligned() const noexcept
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the column slice can be used in SMP assignments.
+//
+// \return \a false since column slices are always assigned serially.
+*/
+template< typename TT >  // Type of the dense tensor
+inline bool ColumnSlice<TT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT >  // Type of the dense tensor
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline void ColumnSlice<TT>::assign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<rows(); ++k )
+      for( size_t i=0UL; i<columns(); ++i )
+         tensor_(k,i,column_) = (~rhs)(k,i);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT >  // Type of the dense tensor
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline void ColumnSlice<TT>::addAssign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<rows(); ++k )
+      for( size_t i=0UL; i<columns(); ++i )
+         tensor_(k,i,column_) += (~rhs)(k,i);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT >  // Type of the dense tensor
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline void ColumnSlice<TT>::subAssign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<rows(); ++k )
+      for( size_t i=0UL; i<columns(); ++i )
+         tensor_(k,i,column_) -= (~rhs)(k,i);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the Schur product assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename TT >  // Type of the dense tensor
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline void ColumnSlice<TT>::schurAssign( const DenseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t k=0UL; k<rows(); ++k )
+      for( size_t i=0UL; i<columns(); ++i )
+         tensor_(k,i,column_) *= (~rhs)(k,i);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -45,6 +45,51 @@
 #include <blaze/util/Types.h>
 
 
+
+
+//=================================================================================================
+//
+//  BLOCKING CONFIGURATION
+//
+//=================================================================================================
+
+#include <blaze/config/Tuning.h>
+
+
+//*************************************************************************************************
+/*!\brief Outer block size of the dense matrix multiplication.
+// \ingroup config
+//
+// This setting specifies the block size along the common dimension of the two operands of a
+// dense matrix multiplication, which is scaled by 16 divided by the size of the element type
+// in Byte. The default setting is 112. The setting must be a multiple of 16. Note that the
+// setting does not affect the packed kernels for single and double precision matrices, whose
+// blocking is derived from the cache sizes (see <tt>./blaze/config/CacheSize.h</tt>).
+*/
+#ifndef BLAZE_MMM_OUTER_BLOCK_SIZE
+#define BLAZE_MMM_OUTER_BLOCK_SIZE 112UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inner block size of the dense matrix multiplication.
+// \ingroup config
+//
+// This setting specifies the number of rows or columns of the target matrix that are computed
+// per block of a dense matrix multiplication. The default setting is 96. The setting must be a
+// multiple of 16. Note that the setting does not affect the packed kernels for single and double
+// precision matrices, whose blocking is derived from the cache sizes (see
+// <tt>./blaze/config/CacheSize.h</tt>).
+*/
+#ifndef BLAZE_MMM_INNER_BLOCK_SIZE
+#define BLAZE_MMM_INNER_BLOCK_SIZE 96UL
+#endif
+//*************************************************************************************************
+
+
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -57,8 +102,10 @@ namespace blaze {
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t DEFAULT_BLOCK_SIZE = 256UL;
 
-constexpr size_t MMM_DEFAULT_OUTER_BLOCK_SIZE = 112UL;
-constexpr size_t MMM_DEFAULT_INNER_BLOCK_SIZE =  96UL;
+constexpr size_t MMM_DEFAULT_OUTER_BLOCK_SIZE = BLAZE_MMM_OUTER_BLOCK_SIZE;
+constexpr size_t MMM_DEFAULT_INNER_BLOCK_SIZE = BLAZE_MMM_INNER_BLOCK_SIZE;
+
+constexpr size_t DECOMPOSITION_DEFAULT_BLOCK_SIZE = 64UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -69,6 +116,8 @@ constexpr size_t DEBUG_BLOCK_SIZE = 8UL;
 
 constexpr size_t MMM_DEBUG_OUTER_BLOCK_SIZE = 16UL;
 constexpr size_t MMM_DEBUG_INNER_BLOCK_SIZE = 16UL;
+
+constexpr size_t DECOMPOSITION_DEBUG_BLOCK_SIZE = 4UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -79,6 +128,8 @@ constexpr size_t BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DEBUG_BLOCK_SIZE : DEFAULT_BL
 
 constexpr size_t MMM_OUTER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_OUTER_BLOCK_SIZE : MMM_DEFAULT_OUTER_BLOCK_SIZE );
 constexpr size_t MMM_INNER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_INNER_BLOCK_SIZE : MMM_DEFAULT_INNER_BLOCK_SIZE );
+
+constexpr size_t DECOMPOSITION_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DECOMPOSITION_DEBUG_BLOCK_SIZE : DECOMPOSITION_DEFAULT_BLOCK_SIZE );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -102,6 +153,8 @@ BLAZE_STATIC_ASSERT( blaze::BLOCK_SIZE >= 4UL );
 BLAZE_STATIC_ASSERT( blaze::MMM_OUTER_BLOCK_SIZE >= 16UL && blaze::MMM_OUTER_BLOCK_SIZE % 16UL == 0UL );
 BLAZE_STATIC_ASSERT( blaze::MMM_INNER_BLOCK_SIZE >= 16UL && blaze::MMM_INNER_BLOCK_SIZE % 16UL == 0UL );
 
+BLAZE_STATIC_ASSERT( blaze::DECOMPOSITION_BLOCK_SIZE >= 1UL );
+
 }
 /*! \endcond */
 //*************************************************************************************************
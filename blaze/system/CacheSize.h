@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/config/Tuning.h>
 #include <blaze/config/CacheSize.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
@@ -56,6 +57,8 @@ namespace blaze {
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t cacheSize = BLAZE_CACHE_SIZE;
+constexpr size_t l1CacheSize = BLAZE_L1_CACHE_SIZE;
+constexpr size_t l2CacheSize = BLAZE_L2_CACHE_SIZE;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -75,6 +78,8 @@ constexpr size_t cacheSize = BLAZE_CACHE_SIZE;
 namespace {
 
 BLAZE_STATIC_ASSERT( blaze::cacheSize > 100000UL && blaze::cacheSize < 100000000UL );
+BLAZE_STATIC_ASSERT( blaze::l1CacheSize >= 4096UL && blaze::l1CacheSize <= blaze::l2CacheSize );
+BLAZE_STATIC_ASSERT( blaze::l2CacheSize >= 65536UL && blaze::l2CacheSize < 100000000UL );
 
 }
 /*! \endcond */
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/config/Optimizations.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -56,6 +57,8 @@ namespace blaze {
 constexpr bool usePadding          = BLAZE_USE_PADDING;
 constexpr bool useStreaming        = BLAZE_USE_STREAMING;
 constexpr bool useOptimizedKernels = BLAZE_USE_OPTIMIZED_KERNELS;
+constexpr bool useWorkspace        = BLAZE_USE_WORKSPACE;
+constexpr size_t workspaceLimit    = BLAZE_WORKSPACE_LIMIT;
 /*! \endcond */
 //*************************************************************************************************
 
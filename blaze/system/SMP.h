@@ -123,4 +123,29 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  THREAD AFFINITY CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the NUMA-aware thread affinity.
+// \ingroup system
+//
+// This compilation switch enables/disables the thread affinity and the parallel first-touch
+// initialization of dense vectors and matrices. It is only enabled in case the thread affinity
+// has been requested via the \c BLAZE_USE_THREAD_AFFINITY switch and any shared-memory
+// parallelization is active.
+*/
+#if BLAZE_USE_THREAD_AFFINITY && ( BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE )
+#define BLAZE_THREAD_AFFINITY_MODE 1
+#else
+#define BLAZE_THREAD_AFFINITY_MODE 0
+#endif
+//*************************************************************************************************
+
 #endif
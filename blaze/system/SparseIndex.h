@@ -0,0 +1,113 @@
+//=================================================================================================
+/*!
+//  \file blaze/system/SparseIndex.h
+//  \brief Header file for the index type of all compressed vectors and matrices
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_SYSTEM_SPARSEINDEX_H_
+#define _BLAZE_SYSTEM_SPARSEINDEX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/config/SparseIndex.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Suffix.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/IsUnsigned.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE INDEX TYPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+using SparseIndex = BLAZE_SPARSE_INDEX_TYPE;
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE INDEX NAMESPACE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Name of the inline namespace of all containers depending on the sparse index type.
+// \ingroup config
+//
+// The layout of the compressed vectors and matrices depends on the BLAZE_SPARSE_INDEX_TYPE.
+// In order to prevent translation units compiled with different sparse index types from
+// silently sharing these containers (which would violate the one definition rule), they are
+// declared in an inline namespace whose name contains the sparse index type. Thus any attempt
+// to pass a compressed vector or matrix between such translation units results in a link
+// error instead of undefined behavior.
+*/
+#define BLAZE_SPARSE_INDEX_NAMESPACE BLAZE_JOIN( sparseindex_, BLAZE_SPARSE_INDEX_TYPE )
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( blaze::IsIntegral<blaze::SparseIndex>::value );
+BLAZE_STATIC_ASSERT( blaze::IsUnsigned<blaze::SparseIndex>::value );
+BLAZE_STATIC_ASSERT( sizeof( blaze::SparseIndex ) <= sizeof( size_t ) );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
@@ -53,6 +53,7 @@
 //
 //=================================================================================================
 
+#include <blaze/config/Tuning.h>
 #include <blaze/config/Thresholds.h>
 
 
@@ -370,6 +371,20 @@ constexpr size_t SMP_DVECDVECOUTER_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_DVECREDUCE_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the total reduction of a dense vector can be executed
+// in parallel. In case the number of elements of the dense vector is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of elements is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/dense vector multiplication threshold.
 // \ingroup config
@@ -715,6 +730,20 @@ constexpr size_t SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense matrix reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_DMATREDUCE_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the total or the row-/columnwise reduction of a dense
+// matrix can be executed in parallel. In case the number of elements of the dense matrix is
+// larger or equal to this threshold, the operation is executed in parallel. If the number of
+// elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief SMP row-major dense matrix/row-major dense matrix multiplication threshold.
 // \ingroup config
@@ -939,6 +968,104 @@ constexpr size_t SMP_TSMATTSMATMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix addition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SMATSMATADD_USER_THRESHOLD while the Blaze debug
+// mode is active. It specifies when a addition between two sparse matrices with the same storage
+// order can be executed in parallel. In case the number of elements of the target matrix is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of elements is
+// below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATSMATADD_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix/sparse matrix subtraction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SMATSMATSUB_USER_THRESHOLD while the Blaze debug
+// mode is active. It specifies when a subtraction between two sparse matrices with the same storage
+// order can be executed in parallel. In case the number of elements of the target matrix is larger
+// or equal to this threshold, the operation is executed in parallel. If the number of elements is
+// below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATSMATSUB_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP matrix batch threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_BATCH_USER_THRESHOLD while the Blaze debug
+// mode is active. It specifies when a batched operation on a MatrixBatch can be executed in
+// parallel. In case the total number of multiply-add operations of all matrices of the batch is
+// larger or equal to this threshold, the operation is executed in parallel. Otherwise the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_BATCH_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP iterative solver threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SOLVER_USER_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the fused vector kernels of the iterative solvers can be
+// executed in parallel. In case the size of the linear system is larger or equal to this
+// threshold, the kernels are executed in parallel. Otherwise the kernels are executed
+// single-threaded.
+*/
+constexpr size_t SMP_SOLVER_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse triangular solve threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SMATTRSV_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a level of a level-scheduled sparse triangular solve
+// or incomplete factorization can be executed in parallel. In case the number of non-zero
+// elements within the level is larger or equal to this threshold, the level is processed in
+// parallel. Otherwise the level is processed single-threaded.
+*/
+constexpr size_t SMP_SMATTRSV_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP supernodal factorization threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_SUPERNODAL_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a level of the supernodal elimination tree of a sparse
+// Cholesky or LDLH decomposition can be factorized in parallel. In case the number of elements
+// of the supernode panels of the level is larger or equal to this threshold, the level is
+// factorized in parallel. Otherwise the level is factorized single-threaded.
+*/
+constexpr size_t SMP_SUPERNODAL_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP band matrix multiplication threshold.
+// \ingroup config
+//
+// This debug value is used instead of the blaze::SMP_BANDMULT_USER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a multiplication of a band matrix with a dense vector
+// or a dense matrix can be executed in parallel. In case the number of stored band elements
+// multiplied by the number of processed vectors is larger or equal to this threshold, the
+// operation is executed in parallel. Otherwise the operation is executed single-threaded.
+*/
+constexpr size_t SMP_BANDMULT_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
@@ -948,6 +1075,7 @@ constexpr size_t SMP_DVECDVECSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVE
 constexpr size_t SMP_DVECDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECMULT_THRESHOLD   );
 constexpr size_t SMP_DVECDVECDIV_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECDIV_THRESHOLD    );
 constexpr size_t SMP_DVECDVECOUTER_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD  : BLAZE_SMP_DVECDVECOUTER_THRESHOLD  );
+constexpr size_t SMP_DVECREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DVECREDUCE_THRESHOLD     );
 constexpr size_t SMP_DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDVECMULT_THRESHOLD   );
 constexpr size_t SMP_TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDVECMULT_THRESHOLD  );
 constexpr size_t SMP_TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECDMATMULT_THRESHOLD  );
@@ -972,6 +1100,7 @@ constexpr size_t SMP_DMATDMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMA
 constexpr size_t SMP_DMATTDMATSUB_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATSUB_THRESHOLD   );
 constexpr size_t SMP_DMATDMATSCHUR_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD  : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD  );
 constexpr size_t SMP_DMATTDMATSCHUR_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD );
+constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
 constexpr size_t SMP_DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDMATMULT_THRESHOLD   );
 constexpr size_t SMP_DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTDMATMULT_THRESHOLD  );
 constexpr size_t SMP_TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDMATMULT_THRESHOLD  );
@@ -988,6 +1117,13 @@ constexpr size_t SMP_SMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMA
 constexpr size_t SMP_SMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTSMATMULT_THRESHOLD  );
 constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSMATMULT_THRESHOLD  );
 constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
+constexpr size_t SMP_SMATSMATADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATADD_DEBUG_THRESHOLD    : BLAZE_SMP_SMATSMATADD_THRESHOLD    );
+constexpr size_t SMP_SMATSMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATSUB_DEBUG_THRESHOLD    : BLAZE_SMP_SMATSMATSUB_THRESHOLD    );
+constexpr size_t SMP_BATCH_THRESHOLD          = ( BLAZE_DEBUG_MODE ? SMP_BATCH_DEBUG_THRESHOLD          : BLAZE_SMP_BATCH_THRESHOLD          );
+constexpr size_t SMP_SOLVER_THRESHOLD         = ( BLAZE_DEBUG_MODE ? SMP_SOLVER_DEBUG_THRESHOLD         : BLAZE_SMP_SOLVER_THRESHOLD         );
+constexpr size_t SMP_SMATTRSV_THRESHOLD       = ( BLAZE_DEBUG_MODE ? SMP_SMATTRSV_DEBUG_THRESHOLD       : BLAZE_SMP_SMATTRSV_THRESHOLD       );
+constexpr size_t SMP_SUPERNODAL_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SUPERNODAL_DEBUG_THRESHOLD     : BLAZE_SMP_SUPERNODAL_THRESHOLD     );
+constexpr size_t SMP_BANDMULT_THRESHOLD       = ( BLAZE_DEBUG_MODE ? SMP_BANDMULT_DEBUG_THRESHOLD       : BLAZE_SMP_BANDMULT_THRESHOLD       );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -1022,6 +1158,7 @@ BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECDIV_THRESHOLD    >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECOUTER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECREDUCE_THRESHOLD     >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
@@ -1046,6 +1183,7 @@ BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSCHUR_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSCHUR_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD     >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_THRESHOLD  >= 0UL );
@@ -1062,6 +1200,13 @@ BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATADD_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATSUB_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_BATCH_THRESHOLD          >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SOLVER_THRESHOLD         >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SMATTRSV_THRESHOLD       >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SUPERNODAL_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_BANDMULT_THRESHOLD       >= 0UL );
 
 }
 /*! \endcond */
@@ -328,6 +328,33 @@
 
 
 
+//=================================================================================================
+//
+//  F16C MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the F16C mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the F16C mode. In case the F16C mode is enabled
+// (i.e. in case the half precision conversion instructions are available) the Blaze library
+// converts between \c float16 and \c float values by means of F16C intrinsics and vectorizes
+// the operations on \c float16 elements. In case the F16C mode is disabled, the conversion is
+// performed in software and the operations on \c float16 elements are not vectorized (unless
+// AVX-512 is available).
+*/
+#if BLAZE_USE_VECTORIZATION && defined(__F16C__)
+#  define BLAZE_F16C_MODE 1
+#else
+#  define BLAZE_F16C_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  SVML MODE CONFIGURATION
@@ -353,6 +380,60 @@
 
 
 
+//=================================================================================================
+//
+//  NATIVE SIMD MATH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the native SIMD math mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the native SIMD math mode. In case the native SIMD
+// math mode is enabled (i.e. in case at least SSE2 is available) the Blaze library vectorizes
+// the transcendental functions (as for instance \c exp(), \c log(), \c sin(), and \c pow())
+// by means of its own polynomial approximations in case the SVML is not available. In case the
+// native SIMD math mode is disabled, these functions are only vectorized via the SVML.
+*/
+#if BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+#  define BLAZE_NATIVE_SIMD_MATH_MODE 1
+#else
+#  define BLAZE_NATIVE_SIMD_MATH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME DISPATCH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the runtime dispatch mode. In case the runtime
+// dispatch mode is enabled (i.e. in case the runtime CPU dispatch is requested via the
+// BLAZE_USE_RUNTIME_DISPATCH switch and GCC or Clang is used on a x86-64 platform) the Blaze
+// library compiles selected kernels for several instruction sets and chooses the fastest
+// variant supported by the executing CPU at runtime. In case the runtime dispatch mode is
+// disabled, all kernels are exclusively compiled for the target architecture.
+*/
+#if BLAZE_USE_VECTORIZATION && BLAZE_USE_RUNTIME_DISPATCH && BLAZE_SSE2_MODE && !BLAZE_MIC_MODE && \
+    defined(__x86_64__) && ( defined(__GNUC__) || defined(__clang__) ) && !defined(__INTEL_COMPILER)
+#  define BLAZE_RUNTIME_DISPATCH_MODE 1
+#else
+#  define BLAZE_RUNTIME_DISPATCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -386,7 +467,7 @@ BLAZE_STATIC_ASSERT( !BLAZE_AVX512DQ_MODE || BLAZE_AVX512F_MODE );
 //
 //=================================================================================================
 
-#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE || BLAZE_AVX2_MODE || BLAZE_AVX_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE || BLAZE_AVX2_MODE || BLAZE_AVX_MODE || BLAZE_F16C_MODE
 #  include <immintrin.h>
 #elif BLAZE_SSE4_MODE
 #  include <smmintrin.h>
@@ -0,0 +1,362 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/BFloat16.h
+//  \brief Header file for the bfloat16 data type
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_BFLOAT16_H_
+#define _BLAZE_UTIL_BFLOAT16_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <blaze/system/Inline.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Brain floating point (bfloat16) data type.
+// \ingroup util
+//
+// The bfloat16 class represents a 16-bit brain floating point value (1 sign bit, 8 exponent
+// bits, and 7 mantissa bits), i.e. the upper half of an IEEE 754 single precision value. In
+// contrast to blaze::bfloat16 it covers the full exponent range of \c float at the cost of a
+// reduced precision. Analogously to bfloat16 it is a pure storage type: all arithmetic
+// operations are performed in single precision by means of the implicit conversion to \c float
+// and the result is rounded back to bfloat16 (round-to-nearest-even) only when it is stored:
+
+   \code
+   blaze::bfloat16 a( 1.5F ), b( 0.25F );
+
+   float c = a * b;            // Computation in single precision
+   blaze::bfloat16 d = a + b;  // Rounding of the single precision result to bfloat16
+   d += 2.0F;                  // Computation and rounding in a single step
+   \endcode
+
+// The resulting element type of any arithmetic operation involving bfloat16 elements is
+// \c float. In case SSE2 is available, loads and stores of bfloat16 elements are vectorized
+// by converting between bfloat16 and single precision in registers.
+*/
+class bfloat16
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   BLAZE_ALWAYS_INLINE bfloat16() noexcept;
+   BLAZE_ALWAYS_INLINE bfloat16( float value ) noexcept;
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   BLAZE_ALWAYS_INLINE bfloat16& operator+=( float rhs ) noexcept;
+   BLAZE_ALWAYS_INLINE bfloat16& operator-=( float rhs ) noexcept;
+   BLAZE_ALWAYS_INLINE bfloat16& operator*=( float rhs ) noexcept;
+   BLAZE_ALWAYS_INLINE bfloat16& operator/=( float rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   BLAZE_ALWAYS_INLINE operator float() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   BLAZE_ALWAYS_INLINE uint16_t bits() const noexcept;
+
+   static BLAZE_ALWAYS_INLINE bfloat16 fromBits( uint16_t bits ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   static inline uint16_t toBFloat16( float    value ) noexcept;
+   static inline float    toFloat   ( uint16_t bits  ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint16_t bits_;  //!< The bfloat16 representation of the value.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for bfloat16.
+//
+// The value is initialized to positive zero.
+*/
+BLAZE_ALWAYS_INLINE bfloat16::bfloat16() noexcept
+   : bits_( 0U )  // The bfloat16 representation of the value
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a single precision value.
+//
+// \param value The single precision value to be converted.
+//
+// The given value is rounded to the nearest representable bfloat16 value (ties to even). NaN
+// values stay NaN.
+*/
+BLAZE_ALWAYS_INLINE bfloat16::bfloat16( float value ) noexcept
+   : bits_( toBFloat16( value ) )  // The bfloat16 representation of the value
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment of a single precision value.
+//
+// \param rhs The right-hand side value to be added.
+// \return Reference to the bfloat16 value.
+*/
+BLAZE_ALWAYS_INLINE bfloat16& bfloat16::operator+=( float rhs ) noexcept
+{
+   bits_ = toBFloat16( toFloat( bits_ ) + rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment of a single precision value.
+//
+// \param rhs The right-hand side value to be subtracted.
+// \return Reference to the bfloat16 value.
+*/
+BLAZE_ALWAYS_INLINE bfloat16& bfloat16::operator-=( float rhs ) noexcept
+{
+   bits_ = toBFloat16( toFloat( bits_ ) - rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment of a single precision value.
+//
+// \param rhs The right-hand side value for the multiplication.
+// \return Reference to the bfloat16 value.
+*/
+BLAZE_ALWAYS_INLINE bfloat16& bfloat16::operator*=( float rhs ) noexcept
+{
+   bits_ = toBFloat16( toFloat( bits_ ) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment of a single precision value.
+//
+// \param rhs The right-hand side value for the division.
+// \return Reference to the bfloat16 value.
+*/
+BLAZE_ALWAYS_INLINE bfloat16& bfloat16::operator/=( float rhs ) noexcept
+{
+   bits_ = toBFloat16( toFloat( bits_ ) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to single precision.
+//
+// \return The exactly converted single precision value.
+*/
+BLAZE_ALWAYS_INLINE bfloat16::operator float() const noexcept
+{
+   return toFloat( bits_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the bfloat16 representation of the value.
+//
+// \return The bfloat16 representation of the value.
+*/
+BLAZE_ALWAYS_INLINE uint16_t bfloat16::bits() const noexcept
+{
+   return bits_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a bfloat16 value from the given bfloat16 representation.
+//
+// \param bits The bfloat16 representation of the value.
+// \return The according bfloat16 value.
+*/
+BLAZE_ALWAYS_INLINE bfloat16 bfloat16::fromBits( uint16_t bits ) noexcept
+{
+   bfloat16 tmp;
+   tmp.bits_ = bits;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Rounds the given single precision value to bfloat16.
+//
+// \param value The single precision value to be converted.
+// \return The bfloat16 representation of the rounded value.
+*/
+inline uint16_t bfloat16::toBFloat16( float value ) noexcept
+{
+   uint32_t x;
+   std::memcpy( &x, &value, sizeof( float ) );
+
+   // NaN values are truncated and kept quiet
+   if( ( x & 0x7FFFFFFFU ) > 0x7F800000U ) {
+      return static_cast<uint16_t>( ( x >> 16 ) | 0x0040U );
+   }
+
+   x += 0x7FFFU + ( ( x >> 16 ) & 1U );
+
+   return static_cast<uint16_t>( x >> 16 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the given bfloat16 value to single precision.
+//
+// \param bits The bfloat16 representation of the value.
+// \return The exactly converted single precision value.
+*/
+inline float bfloat16::toFloat( uint16_t bits ) noexcept
+{
+   const uint32_t x( uint32_t( bits ) << 16 );
+
+   float value;
+   std::memcpy( &value, &x, sizeof( float ) );
+   return value;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( sizeof( bfloat16 ) == 2UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
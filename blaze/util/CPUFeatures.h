@@ -0,0 +1,190 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/CPUFeatures.h
+//  \brief Header file for the runtime detection of the supported SIMD instruction sets
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_CPUFEATURES_H_
+#define _BLAZE_UTIL_CPUFEATURES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if ( defined(__x86_64__) || defined(__i386__) ) && ( defined(__GNUC__) || defined(__clang__) )
+#  include <cpuid.h>
+#  define BLAZE_CPUID_SUPPORT 1
+#else
+#  define BLAZE_CPUID_SUPPORT 0
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Runtime information about the SIMD instruction sets supported by the executing CPU.
+// \ingroup util
+//
+// The CPUFeatures class provides the information about which SIMD instruction sets are supported
+// by the CPU the program is currently executed on. In contrast to the BLAZE_SSE2_MODE, ...,
+// BLAZE_AVX512F_MODE compilation switches, which reflect the instruction sets selected at compile
+// time, the CPUFeatures class queries the CPU at runtime via the \c cpuid instruction. The
+// information is determined once during the first call to cpuFeatures():
+
+   \code
+   if( blaze::cpuFeatures().avx2 ) {
+      // Executing AVX2 instructions
+   }
+   \endcode
+
+// Note that an instruction set is only reported as supported in case both the CPU and the
+// operating system support it (i.e. in case the operating system saves the according register
+// state on context switches). On platforms without \c cpuid support all instruction sets are
+// reported as not supported.
+*/
+struct CPUFeatures
+{
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline CPUFeatures();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   bool sse2;     //!< \a true in case SSE2 is supported, \a false if not.
+   bool avx;      //!< \a true in case AVX is supported, \a false if not.
+   bool avx2;     //!< \a true in case AVX2 is supported, \a false if not.
+   bool fma;      //!< \a true in case FMA3 is supported, \a false if not.
+   bool avx512f;  //!< \a true in case AVX-512F is supported, \a false if not.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the CPUFeatures class.
+//
+// The constructor queries the executing CPU for the supported SIMD instruction sets.
+*/
+inline CPUFeatures::CPUFeatures()
+   : sse2   ( false )  // SSE2 support
+   , avx    ( false )  // AVX support
+   , avx2   ( false )  // AVX2 support
+   , fma    ( false )  // FMA3 support
+   , avx512f( false )  // AVX-512F support
+{
+#if BLAZE_CPUID_SUPPORT
+   unsigned int eax( 0U ), ebx( 0U ), ecx( 0U ), edx( 0U );
+
+   if( !__get_cpuid( 1U, &eax, &ebx, &ecx, &edx ) )
+      return;
+
+   sse2 = ( edx & ( 1U << 26 ) ) != 0U;
+
+   // Checking whether the operating system saves the XMM/YMM/ZMM register state
+   if( ( ecx & ( 1U << 27 ) ) == 0U )
+      return;
+
+   unsigned int xcr0( 0U ), xcr0high( 0U );
+   __asm__ __volatile__( "xgetbv" : "=a"(xcr0), "=d"(xcr0high) : "c"(0U) );
+
+   const bool ymm( ( xcr0 & 0x06U ) == 0x06U );
+   const bool zmm( ( xcr0 & 0xE6U ) == 0xE6U );
+
+   avx = ymm && ( ecx & ( 1U << 28 ) ) != 0U;
+   fma = ymm && ( ecx & ( 1U << 12 ) ) != 0U;
+
+   if( __get_cpuid_max( 0U, nullptr ) < 7U )
+      return;
+
+   __cpuid_count( 7U, 0U, eax, ebx, ecx, edx );
+
+   avx2    = avx && ( ebx & ( 1U <<  5 ) ) != 0U;
+   avx512f = zmm && ( ebx & ( 1U << 16 ) ) != 0U;
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CPUFeatures functions */
+//@{
+inline const CPUFeatures& cpuFeatures();
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the SIMD instruction sets supported by the executing CPU.
+// \ingroup util
+//
+// \return The SIMD instruction sets supported by the executing CPU.
+//
+// The executing CPU is queried during the first call to this function. All subsequent calls
+// return the same information.
+*/
+inline const CPUFeatures& cpuFeatures()
+{
+   static const CPUFeatures features;
+   return features;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
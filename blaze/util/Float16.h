@@ -0,0 +1,424 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Float16.h
+//  \brief Header file for the float16 half precision data type
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_FLOAT16_H_
+#define _BLAZE_UTIL_FLOAT16_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstring>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief IEEE 754 half precision floating point data type.
+// \ingroup util
+//
+// The float16 class represents a 16-bit IEEE 754 binary16 floating point value (1 sign bit,
+// 5 exponent bits, and 10 mantissa bits). It is a pure storage type: all arithmetic operations
+// are performed in single precision by means of the implicit conversion to \c float, and the
+// result is rounded back to half precision (round-to-nearest-even) only when it is stored in
+// a float16 value:
+
+   \code
+   blaze::float16 a( 1.5F ), b( 0.25F );
+
+   float c = a * b;           // Computation in single precision
+   blaze::float16 d = a + b;  // Rounding of the single precision result to half precision
+   d += 2.0F;                 // Computation and rounding in a single step
+   \endcode
+
+// Therefore float16 can be used as element type of all dense and sparse vectors and matrices
+// (e.g. blaze::DynamicVector<float16> or blaze::CustomMatrix<float16,...>) in order to halve
+// the memory footprint and bandwidth requirements compared to \c float. The resulting element
+// type of any arithmetic operation involving float16 elements is \c float. In case the F16C
+// instruction set or AVX-512 is available, loads and stores of float16 elements are vectorized
+// by converting between half and single precision in registers.
+*/
+class float16
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   BLAZE_ALWAYS_INLINE float16() noexcept;
+   BLAZE_ALWAYS_INLINE float16( float value ) noexcept;
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   // No explicitly declared copy assignment operator.
+   BLAZE_ALWAYS_INLINE float16& operator+=( float rhs ) noexcept;
+   BLAZE_ALWAYS_INLINE float16& operator-=( float rhs ) noexcept;
+   BLAZE_ALWAYS_INLINE float16& operator*=( float rhs ) noexcept;
+   BLAZE_ALWAYS_INLINE float16& operator/=( float rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   BLAZE_ALWAYS_INLINE operator float() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   BLAZE_ALWAYS_INLINE uint16_t bits() const noexcept;
+
+   static BLAZE_ALWAYS_INLINE float16 fromBits( uint16_t bits ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Conversion functions************************************************************************
+   /*!\name Conversion functions */
+   //@{
+   static inline uint16_t toHalf ( float    value ) noexcept;
+   static inline float    toFloat( uint16_t bits  ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   uint16_t bits_;  //!< The binary16 representation of the value.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for float16.
+//
+// The value is initialized to positive zero.
+*/
+BLAZE_ALWAYS_INLINE float16::float16() noexcept
+   : bits_( 0U )  // The binary16 representation of the value
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from a single precision value.
+//
+// \param value The single precision value to be converted.
+//
+// The given value is rounded to the nearest representable half precision value (ties to even).
+// Values beyond the half precision range are converted to infinity, NaN values stay NaN.
+*/
+BLAZE_ALWAYS_INLINE float16::float16( float value ) noexcept
+   : bits_( toHalf( value ) )  // The binary16 representation of the value
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment of a single precision value.
+//
+// \param rhs The right-hand side value to be added.
+// \return Reference to the float16 value.
+*/
+BLAZE_ALWAYS_INLINE float16& float16::operator+=( float rhs ) noexcept
+{
+   bits_ = toHalf( toFloat( bits_ ) + rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment of a single precision value.
+//
+// \param rhs The right-hand side value to be subtracted.
+// \return Reference to the float16 value.
+*/
+BLAZE_ALWAYS_INLINE float16& float16::operator-=( float rhs ) noexcept
+{
+   bits_ = toHalf( toFloat( bits_ ) - rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment of a single precision value.
+//
+// \param rhs The right-hand side value for the multiplication.
+// \return Reference to the float16 value.
+*/
+BLAZE_ALWAYS_INLINE float16& float16::operator*=( float rhs ) noexcept
+{
+   bits_ = toHalf( toFloat( bits_ ) * rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment of a single precision value.
+//
+// \param rhs The right-hand side value for the division.
+// \return Reference to the float16 value.
+*/
+BLAZE_ALWAYS_INLINE float16& float16::operator/=( float rhs ) noexcept
+{
+   bits_ = toHalf( toFloat( bits_ ) / rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to single precision.
+//
+// \return The exactly converted single precision value.
+*/
+BLAZE_ALWAYS_INLINE float16::operator float() const noexcept
+{
+   return toFloat( bits_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the binary16 representation of the value.
+//
+// \return The binary16 representation of the value.
+*/
+BLAZE_ALWAYS_INLINE uint16_t float16::bits() const noexcept
+{
+   return bits_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a float16 value from the given binary16 representation.
+//
+// \param bits The binary16 representation of the value.
+// \return The according float16 value.
+*/
+BLAZE_ALWAYS_INLINE float16 float16::fromBits( uint16_t bits ) noexcept
+{
+   float16 tmp;
+   tmp.bits_ = bits;
+   return tmp;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Rounds the given single precision value to half precision.
+//
+// \param value The single precision value to be converted.
+// \return The binary16 representation of the rounded value.
+*/
+inline uint16_t float16::toHalf( float value ) noexcept
+{
+#if BLAZE_F16C_MODE
+   return static_cast<uint16_t>( _cvtss_sh( value, 0 ) );
+#else
+   uint32_t x;
+   std::memcpy( &x, &value, sizeof( float ) );
+
+   const uint32_t sign( ( x >> 16 ) & 0x8000U );
+   const uint32_t absx( x & 0x7FFFFFFFU );
+
+   // Infinity and NaN (NaN payloads are preserved as far as possible and kept quiet)
+   if( absx >= 0x7F800000U ) {
+      return static_cast<uint16_t>( sign | 0x7C00U |
+         ( absx > 0x7F800000U ? ( 0x0200U | ( ( absx >> 13 ) & 0x03FFU ) ) : 0U ) );
+   }
+
+   // Overflow to infinity (all values greater or equal to 65520)
+   if( absx >= 0x477FF000U ) {
+      return static_cast<uint16_t>( sign | 0x7C00U );
+   }
+
+   // Subnormal half precision values and underflow to zero
+   if( absx < 0x38800000U )
+   {
+      if( absx <= 0x33000000U ) {
+         return static_cast<uint16_t>( sign );
+      }
+
+      const uint32_t mantissa( ( absx & 0x007FFFFFU ) | 0x00800000U );
+      const uint32_t shift   ( 126U - ( absx >> 23 ) );
+      const uint32_t halfway ( 1U << ( shift - 1U ) );
+      const uint32_t rest    ( mantissa & ( ( 1U << shift ) - 1U ) );
+
+      uint32_t result( mantissa >> shift );
+      if( rest > halfway || ( rest == halfway && ( result & 1U ) ) )
+         ++result;
+
+      return static_cast<uint16_t>( sign | result );
+   }
+
+   // Normal half precision values (rebiasing of the exponent and rounding of the mantissa)
+   uint32_t result( absx - 0x38000000U );
+   result += 0x0FFFU + ( ( result >> 13 ) & 1U );
+
+   return static_cast<uint16_t>( sign | ( result >> 13 ) );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the given half precision value to single precision.
+//
+// \param bits The binary16 representation of the value.
+// \return The exactly converted single precision value.
+*/
+inline float float16::toFloat( uint16_t bits ) noexcept
+{
+#if BLAZE_F16C_MODE
+   return _cvtsh_ss( bits );
+#else
+   const uint32_t sign    ( uint32_t( bits & 0x8000U ) << 16 );
+   const uint32_t exponent( ( bits >> 10 ) & 0x001FU );
+   uint32_t mantissa( bits & 0x03FFU );
+   uint32_t x;
+
+   if( exponent == 0x001FU ) {
+      x = sign | 0x7F800000U | ( mantissa << 13 );
+   }
+   else if( exponent != 0U ) {
+      x = sign | ( ( exponent + 112U ) << 23 ) | ( mantissa << 13 );
+   }
+   else if( mantissa == 0U ) {
+      x = sign;
+   }
+   else {
+      uint32_t e( 113U );
+      while( !( mantissa & 0x0400U ) ) {
+         mantissa <<= 1;
+         --e;
+      }
+      x = sign | ( e << 23 ) | ( ( mantissa & 0x03FFU ) << 13 );
+   }
+
+   float value;
+   std::memcpy( &value, &x, sizeof( float ) );
+   return value;
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( sizeof( float16 ) == 2UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
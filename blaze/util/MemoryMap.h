@@ -0,0 +1,395 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/MemoryMap.h
+//  \brief Header file for the MemoryMap class
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_MEMORYMAP_H_
+#define _BLAZE_UTIL_MEMORYMAP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+#include <string>
+#include <utility>
+#include <blaze/util/Exception.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Private memory mapping of a file.
+// \ingroup util
+//
+// The MemoryMap class maps the complete content of a file into the address space of the process
+// (via \c mmap() on POSIX systems and \c MapViewOfFile() on Windows). The pages of the file are
+// loaded lazily by the operating system on first access and are shared via the page cache
+// between all processes that map the same file. The mapping is private (copy-on-write): the
+// mapped memory can be modified, but modified pages are copied on first write and the changes
+// are never written back to the file. The mapping is released when the MemoryMap is destroyed:
+
+   \code
+   blaze::MemoryMap map( "matrix.bin" );
+
+   char* data( map.data() );         // Pointer to the first byte of the file
+   const size_t size( map.size() );  // Size of the file in bytes
+   \endcode
+
+// The first byte of the mapping is aligned to the page size of the system. MemoryMap objects
+// cannot be copied, but can be moved.
+*/
+class MemoryMap
+   : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline MemoryMap() noexcept;
+   explicit inline MemoryMap( const std::string& file );
+   inline MemoryMap( MemoryMap&& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MemoryMap();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline MemoryMap& operator=( MemoryMap&& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline char*       data() noexcept;
+   inline const char* data() const noexcept;
+   inline size_t      size() const noexcept;
+   inline bool        isOpen() const noexcept;
+   inline void        close() noexcept;
+   inline void        swap( MemoryMap& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   char*  data_;  //!< Pointer to the first byte of the mapping.
+   size_t size_;  //!< The size of the mapping in bytes.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for MemoryMap.
+*/
+inline MemoryMap::MemoryMap() noexcept
+   : data_( nullptr )  // Pointer to the first byte of the mapping
+   , size_( 0UL )      // The size of the mapping in bytes
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a private mapping of the given file.
+//
+// \param file The name of the file to be mapped.
+// \exception std::runtime_error File could not be opened.
+// \exception std::runtime_error File could not be mapped.
+//
+// In case the given file is empty, no mapping is created and the MemoryMap is empty.
+*/
+inline MemoryMap::MemoryMap( const std::string& file )
+   : data_( nullptr )  // Pointer to the first byte of the mapping
+   , size_( 0UL )      // The size of the mapping in bytes
+{
+#if defined(_MSC_VER)
+   const HANDLE handle( CreateFileA( file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                     OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr ) );
+
+   if( handle == INVALID_HANDLE_VALUE ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   LARGE_INTEGER size;
+
+   if( !GetFileSizeEx( handle, &size ) ) {
+      CloseHandle( handle );
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   if( size.QuadPart == 0 ) {
+      CloseHandle( handle );
+      return;
+   }
+
+   const HANDLE mapping( CreateFileMappingA( handle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr ) );
+   CloseHandle( handle );
+
+   if( mapping == nullptr ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   void* address( MapViewOfFile( mapping, FILE_MAP_COPY, 0, 0, 0 ) );
+   CloseHandle( mapping );
+
+   if( address == nullptr ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   data_ = static_cast<char*>( address );
+   size_ = static_cast<size_t>( size.QuadPart );
+#else
+   const int fd( ::open( file.c_str(), O_RDONLY ) );
+
+   if( fd < 0 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   struct stat status;
+
+   if( ::fstat( fd, &status ) != 0 ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be opened" );
+   }
+
+   if( status.st_size == 0 ) {
+      ::close( fd );
+      return;
+   }
+
+   void* address( ::mmap( nullptr, static_cast<size_t>( status.st_size ),
+                          PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 ) );
+   ::close( fd );
+
+   if( address == MAP_FAILED ) {
+      BLAZE_THROW_RUNTIME_ERROR( "File could not be mapped" );
+   }
+
+   data_ = static_cast<char*>( address );
+   size_ = static_cast<size_t>( status.st_size );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for MemoryMap.
+//
+// \param m The memory map to be moved into this instance.
+*/
+inline MemoryMap::MemoryMap( MemoryMap&& m ) noexcept
+   : data_( m.data_ )  // Pointer to the first byte of the mapping
+   , size_( m.size_ )  // The size of the mapping in bytes
+{
+   m.data_ = nullptr;
+   m.size_ = 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for MemoryMap.
+*/
+inline MemoryMap::~MemoryMap()
+{
+   close();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for MemoryMap.
+//
+// \param m The memory map to be moved into this instance.
+// \return Reference to the assigned memory map.
+*/
+inline MemoryMap& MemoryMap::operator=( MemoryMap&& m ) noexcept
+{
+   close();
+   swap( m );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapping.
+//
+// \return Pointer to the first byte of the mapping (\c nullptr for an empty mapping).
+//
+// Modifications via the returned pointer are private to the process and are not written back
+// to the file.
+*/
+inline char* MemoryMap::data() noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first byte of the mapping.
+//
+// \return Pointer to the first byte of the mapping (\c nullptr for an empty mapping).
+*/
+inline const char* MemoryMap::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the size of the mapping.
+//
+// \return The size of the mapping in bytes.
+*/
+inline size_t MemoryMap::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the mapping refers to the content of a file.
+//
+// \return \a true in case the mapping is non-empty, \a false if not.
+*/
+inline bool MemoryMap::isOpen() const noexcept
+{
+   return data_ != nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases the mapping.
+//
+// \return void
+//
+// All pointers into the mapping become invalid.
+*/
+inline void MemoryMap::close() noexcept
+{
+   if( data_ != nullptr ) {
+#if defined(_MSC_VER)
+      UnmapViewOfFile( data_ );
+#else
+      ::munmap( data_, size_ );
+#endif
+   }
+
+   data_ = nullptr;
+   size_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two memory maps.
+//
+// \param m The memory map to be swapped.
+// \return void
+*/
+inline void MemoryMap::swap( MemoryMap& m ) noexcept
+{
+   std::swap( data_, m.data_ );
+   std::swap( size_, m.size_ );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,142 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/ThreadAffinity.h
+//  \brief Header file for the thread affinity functionality
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADAFFINITY_H_
+#define _BLAZE_UTIL_THREADAFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(_MSC_VER)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#elif defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  THREAD AFFINITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Binds the calling thread to a single processor.
+// \ingroup threads
+//
+// \param index The index of the processor within the current affinity mask of the thread.
+// \return \a true in case the thread has been bound successfully, \a false if not.
+//
+// This function binds the calling thread to the processor with the given \a index among the
+// processors the thread is currently allowed to run on (which by default are all processors
+// available to the process, as for instance restricted by \c taskset or a batch system). In
+// case \a index exceeds the number of available processors, the processors are assigned in a
+// round-robin fashion. Thus binding the threads \f$ 0..N-1 \f$ of a thread pool to the indices
+// \f$ 0..N-1 \f$ distributes the threads evenly among the available processors. On platforms
+// without thread affinity support the function has no effect and returns \a false.
+*/
+inline bool pinThread( size_t index ) noexcept
+{
+#if defined(_MSC_VER)
+
+   DWORD_PTR processMask( 0 );
+   DWORD_PTR systemMask ( 0 );
+
+   if( !GetProcessAffinityMask( GetCurrentProcess(), &processMask, &systemMask ) || processMask == 0 )
+      return false;
+
+   size_t count( 0UL );
+   for( DWORD_PTR mask=processMask; mask != 0; mask &= mask-1 )
+      ++count;
+
+   index %= count;
+
+   for( DWORD_PTR mask=processMask; mask != 0; mask &= mask-1 ) {
+      if( index-- == 0UL ) {
+         const DWORD_PTR cpu( mask & ( ~mask + 1 ) );
+         return SetThreadAffinityMask( GetCurrentThread(), cpu ) != 0;
+      }
+   }
+
+   return false;
+
+#elif defined(__linux__)
+
+   cpu_set_t allowed;
+   CPU_ZERO( &allowed );
+
+   if( pthread_getaffinity_np( pthread_self(), sizeof( cpu_set_t ), &allowed ) != 0 )
+      return false;
+
+   const size_t count( static_cast<size_t>( CPU_COUNT( &allowed ) ) );
+   if( count == 0UL )
+      return false;
+
+   index %= count;
+
+   for( int cpu=0; cpu<CPU_SETSIZE; ++cpu )
+   {
+      if( !CPU_ISSET( cpu, &allowed ) || index-- != 0UL )
+         continue;
+
+      cpu_set_t target;
+      CPU_ZERO( &target );
+      CPU_SET( cpu, &target );
+      return pthread_setaffinity_np( pthread_self(), sizeof( cpu_set_t ), &target ) == 0;
+   }
+
+   return false;
+
+#else
+
+   UNUSED_PARAMETER( index );
+   return false;
+
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,16 +40,21 @@
 // Includes
 //*************************************************************************************************
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <thread>
 #include <vector>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Exception.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
+#include <blaze/util/ThreadAffinity.h>
+#include <blaze/util/threadpool/Job.h>
 #include <blaze/util/threadpool/Task.h>
 #include <blaze/util/threadpool/TaskQueue.h>
+#include <blaze/util/threadpool/WorkQueue.h>
 #include <blaze/util/Types.h>
 
 
@@ -193,6 +198,63 @@ namespace blaze {
 // for the given functions/functors.
 //
 //
+// \section threadpool_forkjoin Fork/join parallelism
+//
+// Tasks scheduled via the schedule() function are stored in a single FIFO queue, which is
+// shared by all threads of the pool, and the wait() function blocks until all scheduled tasks
+// have been completed. For fine-grained, nested parallelism the ThreadPool class additionally
+// provides a work-stealing fork/join scheduler: Every thread owns a lock-free work queue (see
+// the threadpool::WorkQueue class). The fork() function adds a task to the work queue of the
+// calling thread, from which idle threads steal work. The join() function waits for all tasks
+// forked by the calling thread, executing pending work while waiting. The parallelFor() function
+// recursively splits an index range in halves and forks one half at each level, such that idle
+// threads steal large chunks of work and load imbalances are compensated automatically:
+
+   \code
+   StdThreadPool threadpool( 4 );
+
+   // Forking two tasks and waiting for their completion
+   threadpool.fork( function0 );
+   threadpool.fork( [](){ function0(); } );
+   threadpool.join();
+
+   // Executing the given kernel for chunks of at most 100 indices of the range [0..10000)
+   threadpool.parallelFor( 0UL, 10000UL, 100UL, []( size_t begin, size_t end ) {
+      ...
+   } );
+   \endcode
+
+// Since a waiting thread participates in the execution of pending tasks, fork/join regions can
+// be nested arbitrarily: A task executed by any thread of the pool may again fork tasks or call
+// parallelFor(). Note however that in contrast to the tasks scheduled via schedule(), the tasks
+// and kernels executed by the fork/join scheduler must not throw exceptions.
+//
+//
+// \section threadpool_affinity Thread affinity
+//
+// On NUMA systems it is important that a thread repeatedly works on the same part of the data,
+// since memory pages are placed on the NUMA node of the thread that touches them first. For this
+// purpose the threads of a pool can be bound to the available processors (see the pinThread()
+// function): In case the \a affinity flag of the constructor is set, the i-th thread of the pool
+// is bound to the i-th available processor. Additionally, a task can be forked with the index
+// of the thread that should preferably execute it. The task is handed directly to this thread
+// and is only executed by another thread in case the preferred thread is busy for a longer
+// period of time:
+
+   \code
+   StdThreadPool threadpool( 4, true );  // Four threads bound to the first four processors
+
+   // Forking one task per thread
+   for( size_t i=0UL; i<4UL; ++i ) {
+      threadpool.fork( i, [i](){ function1( i ); } );
+   }
+   threadpool.join();
+   \endcode
+
+// Thus forking the tasks for the same partition of the data with the same indices guarantees
+// that each part of the data is (in general) accessed by the same thread.
+//
+//
 // \section threadpool_exception Throwing exceptions in a thread parallel environment
 //
 // It can happen that during the execution of a given task a thread encounters an erroneous
@@ -319,17 +381,134 @@ class ThreadPool
    //! Type of the thread container.
    using Threads = std::vector< std::unique_ptr<ManagedThread> >;
 
+   using Job       = threadpool::Job;        //!< Type of a fork/join job.
    using TaskQueue = threadpool::TaskQueue;  //!< Type of the task queue.
+   using WorkQueue = threadpool::WorkQueue;  //!< Type of the work-stealing queue.
    using Mutex     = MT;                     //!< Type of the mutex.
    using Lock      = LT;                     //!< Type of a locking object.
    using Condition = CT;                     //!< Condition variable type.
    //**********************************************************************************************
 
+   //**Private class Context***********************************************************************
+   /*!\brief Scheduling context of a single thread participating in the fork/join scheduling.
+   */
+   struct Context
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Context class.
+      //
+      // \param pool The thread pool the context belongs to.
+      // \param index The index of the context.
+      */
+      explicit inline Context( ThreadPool* pool, size_t index )
+         : pool_    ( pool    )  // The thread pool the context belongs to
+         , index_   ( index   )  // The index of the context
+         , queue_   ()           // The work-stealing queue of the context
+         , affine_  ( nullptr )  // The job handed directly to the context
+         , pending_ ()           // The forked, not yet joined jobs
+         , next_    ( nullptr )  // The next context of the thread pool
+         , previous_( nullptr )  // The previous context of the calling thread
+         , depth_   ( 0UL     )  // The nesting depth of active fork/join regions
+         , used_    ( false   )  // Usage flag of the context
+      {}
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      ThreadPool* pool_;                             //!< The thread pool the context belongs to.
+      const size_t index_;                           //!< The index of the context.
+      WorkQueue queue_;                              //!< The work-stealing queue of the context.
+      std::atomic<Job*> affine_;                     //!< The job handed directly to the context.
+      std::vector< std::unique_ptr<Job> > pending_;  //!< The forked, not yet joined jobs.
+      Context* next_;                                //!< The next context of the thread pool.
+      Context* previous_;                            //!< The previous context of the calling thread.
+      size_t depth_;                                 //!< The nesting depth of active fork/join regions.
+      bool used_;                                    //!< Usage flag of the context.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class CallableJob*******************************************************************
+   /*!\brief Fork/join job for the execution of a single function/functor.
+   */
+   template< typename Callable >  // Type of the function/functor
+   struct CallableJob : public Job
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the CallableJob class.
+      //
+      // \param func The function/functor to be executed.
+      */
+      explicit inline CallableJob( const Callable& func )
+         : func_( func )  // The function/functor to be executed
+      {}
+      //*******************************************************************************************
+
+      //**Execution function***********************************************************************
+      /*!\brief Executes the function/functor.
+      //
+      // \return void
+      */
+      void execute() override {
+         func_();
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Callable func_;  //!< The function/functor to be executed.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Private class RangeJob**********************************************************************
+   /*!\brief Fork/join job for the recursive execution of an index range.
+   */
+   template< typename Kernel >  // Type of the range kernel
+   struct RangeJob : public Job
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the RangeJob class.
+      //
+      // \param pool The executing thread pool.
+      // \param begin The first index of the range.
+      // \param end The index one past the last index of the range.
+      // \param grain The maximum number of indices per kernel call.
+      // \param kernel The kernel to be executed for the range.
+      */
+      explicit inline RangeJob( ThreadPool* pool, size_t begin, size_t end, size_t grain,
+                                const Kernel& kernel )
+         : pool_  ( pool   )  // The executing thread pool
+         , begin_ ( begin  )  // The first index of the range
+         , end_   ( end    )  // The index one past the last index of the range
+         , grain_ ( grain  )  // The maximum number of indices per kernel call
+         , kernel_( kernel )  // The kernel to be executed for the range
+      {}
+      //*******************************************************************************************
+
+      //**Execution function***********************************************************************
+      /*!\brief Executes the kernel for the range on the calling thread.
+      //
+      // \return void
+      */
+      void execute() override {
+         pool_->split( *current(), begin_, end_, grain_, kernel_ );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      ThreadPool* pool_;      //!< The executing thread pool.
+      size_t begin_;          //!< The first index of the range.
+      size_t end_;            //!< The index one past the last index of the range.
+      size_t grain_;          //!< The maximum number of indices per kernel call.
+      const Kernel& kernel_;  //!< The kernel to be executed for the range.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
  public:
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, bool affinity=false );
    //@}
    //**********************************************************************************************
 
@@ -347,6 +526,8 @@ class ThreadPool
    inline size_t size()    const;
    inline size_t active()  const;
    inline size_t ready()   const;
+   inline bool   isParticipating() const;
+   inline bool   hasAffinity() const noexcept;
    //@}
    //**********************************************************************************************
 
@@ -358,6 +539,22 @@ class ThreadPool
    //@}
    //**********************************************************************************************
 
+   //**Fork/join scheduling************************************************************************
+   /*!\name Fork/join scheduling */
+   //@{
+   template< typename Callable >
+   void fork( const Callable& func );
+
+   template< typename Callable >
+   void fork( size_t index, const Callable& func );
+
+   void join();
+
+   template< typename Kernel >
+   void parallelFor( size_t begin, size_t end, size_t grain, const Kernel& kernel );
+   //@}
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
@@ -376,19 +573,56 @@ class ThreadPool
    //@}
    //**********************************************************************************************
 
+   //**Fork/join functions*************************************************************************
+   /*!\name Fork/join functions */
+   //@{
+   static inline Context*& current() noexcept;
+
+   Context& acquireContext();
+   void     releaseContext( Context& context );
+   Context& registerThread();
+   Job*     steal( const Context& context );
+   Job*     stealAffine( const Context& context );
+   Context* findContext( size_t index ) const;
+   bool     hasJobs( const Context& context ) const;
+   void     notify();
+   void     runJob( Job* job );
+   void     suspend( const Context& context, const Job& job );
+
+   template< typename Kernel >
+   void split( Context& context, size_t begin, size_t end, size_t grain, const Kernel& kernel );
+   //@}
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   //! Number of unsuccessful steal attempts before an idle thread is suspended.
+   enum : size_t { spins = 1024UL };
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   volatile size_t total_;     //!< Total number of threads in the thread pool.
-   volatile size_t expected_;  //!< Expected number of threads in the thread pool.
-                               /*!< This number may differ from the total number of threads
-                                    during a resize of the thread pool. */
-   volatile size_t active_;    //!< Number of currently active/busy threads.
-   Threads threads_;           //!< The threads contained in the thread pool.
-   TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
-   mutable Mutex mutex_;       //!< Synchronization mutex.
-   Condition waitForTask_;     //!< Wait condition for idle threads.
-   Condition waitForThread_;   //!< Wait condition for the thread management.
+   volatile size_t total_;                          //!< Total number of threads in the thread pool.
+   volatile size_t expected_;                       //!< Expected number of threads in the thread pool.
+                                                    /*!< This number may differ from the total number
+                                                         of threads during a resize of the thread
+                                                         pool. */
+   volatile size_t active_;                         //!< Number of currently active/busy threads.
+   size_t running_;                                 //!< Number of currently executed scheduled tasks.
+   Threads threads_;                                //!< The threads contained in the thread pool.
+   TaskQueue taskqueue_;                            //!< Task queue for the scheduled tasks.
+   std::atomic<size_t> queued_;                     //!< Number of tasks in the task queue.
+   std::atomic<size_t> sleeping_;                   //!< Number of suspended threads.
+   std::atomic<size_t> joining_;                    //!< Number of suspended joining threads.
+   std::atomic<Context*> contexts_;                 //!< List of all scheduling contexts.
+   std::vector< std::unique_ptr<Context> > owned_;  //!< The scheduling contexts of the threads.
+   Context external_;                               //!< Scheduling context for threads outside the pool.
+   Mutex externalMutex_;                            //!< Synchronization mutex for the external context.
+   mutable Mutex mutex_;                            //!< Synchronization mutex.
+   Condition waitForTask_;                          //!< Wait condition for idle threads.
+   Condition waitForThread_;                        //!< Wait condition for the thread management.
+   Condition waitForJob_;                           //!< Wait condition for joining threads.
+   const bool affinity_;                            //!< Flag for the binding of the threads to processors.
    //@}
    //**********************************************************************************************
 
@@ -413,24 +647,37 @@ class ThreadPool
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param affinity \a true if the threads shall be bound to processors, \a false if not.
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
-// initially idle until a task is scheduled.
+// initially idle until a task is scheduled. In case \a affinity is \a true, the i-th thread
+// of the pool is bound to the i-th available processor (see the pinThread() function).
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
-   : total_   ( 0UL )  // Total number of threads in the thread pool
-   , expected_( 0UL )  // Expected number of threads in the thread pool
-   , active_  ( 0UL )  // Number of currently active/busy threads
-   , threads_      ()  // The threads contained in the thread pool
-   , taskqueue_    ()  // Task queue for the scheduled tasks
-   , mutex_        ()  // Synchronization mutex
-   , waitForTask_  ()  // Wait condition for idle threads
-   , waitForThread_()  // Wait condition for the thread management
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, bool affinity )
+   : total_   ( 0UL )      // Total number of threads in the thread pool
+   , expected_( 0UL )      // Expected number of threads in the thread pool
+   , active_  ( 0UL )      // Number of currently active/busy threads
+   , running_ ( 0UL )      // Number of currently executed scheduled tasks
+   , threads_      ()      // The threads contained in the thread pool
+   , taskqueue_    ()      // Task queue for the scheduled tasks
+   , queued_  ( 0UL )      // Number of tasks in the task queue
+   , sleeping_( 0UL )      // Number of suspended threads
+   , joining_ ( 0UL )      // Number of suspended joining threads
+   , contexts_( nullptr )  // List of all scheduling contexts
+   , owned_        ()      // The scheduling contexts of the threads
+   , external_( this, ~size_t(0) )  // Scheduling context for threads outside the pool
+   , externalMutex_()      // Synchronization mutex for the external context
+   , mutex_        ()      // Synchronization mutex
+   , waitForTask_  ()      // Wait condition for idle threads
+   , waitForThread_()      // Wait condition for the thread management
+   , waitForJob_   ()      // Wait condition for joining threads
+   , affinity_( affinity ) // Flag for the binding of the threads to processors
 {
+   contexts_.store( &external_, std::memory_order_release );
    resize( n );
 }
 //*************************************************************************************************
@@ -460,6 +707,7 @@ ThreadPool<TT,MT,LT,CT>::~ThreadPool()
 
    // Removing all currently queued tasks
    taskqueue_.clear();
+   queued_ = 0UL;
 
    // Setting the expected number of threads
    expected_ = 0UL;
@@ -559,6 +807,44 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Returns whether the calling thread participates in the fork/join scheduling.
+//
+// \return \a true in case the calling thread participates in the scheduling, \a false if not.
+//
+// This function returns whether the calling thread is either a thread of the thread pool or
+// currently executes a fork/join region of the thread pool (i.e. it has forked tasks that have
+// not yet been joined or currently executes a parallelFor()). In this case any further call to
+// fork() or parallelFor() is nested into the current fork/join region.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool ThreadPool<TT,MT,LT,CT>::isParticipating() const
+{
+   const Context* context( current() );
+   return context != nullptr && context->pool_ == this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the threads of the thread pool are bound to processors.
+//
+// \return \a true in case the threads are bound to processors, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool ThreadPool<TT,MT,LT,CT>::hasAffinity() const noexcept
+{
+   return affinity_;
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -588,6 +874,7 @@ void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 {
    Lock lock( mutex_ );
    taskqueue_.push( std::bind<void>( func, std::forward<Args>( args )... ) );
+   ++queued_;
    waitForTask_.notify_one();
 }
 //*************************************************************************************************
@@ -595,6 +882,202 @@ void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 
 
 
+//=================================================================================================
+//
+//  FORK/JOIN SCHEDULING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Forking the given function/functor for execution.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function adds the given function/functor to the work queue of the calling thread, from
+// which it is either executed by the calling thread itself during the next call to join() or
+// stolen by an idle thread of the pool. The given function/functor must be copyable, must be
+// callable without arguments, must return \c void, and must not throw an exception. Note that
+// every call to fork() must be followed by a call to join() on the same thread.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable > // Type of the function/functor
+void ThreadPool<TT,MT,LT,CT>::fork( const Callable& func )
+{
+   Context& context( acquireContext() );
+
+   context.pending_.emplace_back( new CallableJob<Callable>( func ) );
+   context.queue_.push( context.pending_.back().get() );
+
+   notify();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Forking the given function/functor for execution by a specific thread.
+//
+// \param index The index of the thread that should execute the function/functor.
+// \param func The given function/functor.
+// \return void
+//
+// This function hands the given function/functor directly to the thread with the given index
+// \f$[0..size())\f$, which executes it as soon as it has finished its current work. Only in
+// case the thread has not picked up the function/functor within a reasonable amount of time
+// (for instance because it is busy with a long-running task), it is executed by the thread
+// calling join(). In case the thread with the given index does not exist or already holds
+// another function/functor, the function/functor is forked as via fork(). Thus forking the
+// tasks working on the same part of the data with the same index results in the data being
+// accessed by the same thread, which in combination with thread affinity guarantees that the
+// data remains in the memory and cache of the processor the thread is bound to. For all other
+// aspects the same restrictions as for fork() apply.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable > // Type of the function/functor
+void ThreadPool<TT,MT,LT,CT>::fork( size_t index, const Callable& func )
+{
+   Context& context( acquireContext() );
+   Context* target ( findContext( index ) );
+
+   context.pending_.emplace_back( new CallableJob<Callable>( func ) );
+   Job* job( context.pending_.back().get() );
+   Job* empty( nullptr );
+
+   if( target == nullptr || target == &context ||
+       !target->affine_.compare_exchange_strong( empty, job ) ) {
+      context.queue_.push( job );
+      notify();
+      return;
+   }
+
+   // Since the job is not visible to all threads, all suspended threads have to be woken up
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+
+   if( sleeping_.load( std::memory_order_relaxed ) > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_all();
+   }
+
+   if( joining_.load( std::memory_order_relaxed ) > 0UL ) {
+      Lock lock( mutex_ );
+      waitForJob_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all tasks forked by the calling thread to be completed.
+//
+// \return void
+//
+// This function blocks until all tasks forked by the calling thread have been completed. While
+// waiting, the calling thread executes its own forked tasks and steals tasks from the other
+// threads of the pool. Tasks handed to a specific thread (see fork()) are only executed by the
+// calling thread in case they are not picked up by their thread within a reasonable time. In
+// case no work can be found for a while, the calling thread is suspended until another job has
+// been completed or new work has been forked. In contrast to wait(), this function only waits
+// for the tasks forked by the calling thread and thus does not represent a global barrier.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::join()
+{
+   Context* context( current() );
+
+   if( context == nullptr || context->pool_ != this )
+      return;
+
+   std::vector< std::unique_ptr<Job> > pending;
+   pending.swap( context->pending_ );
+
+   ++context->depth_;
+
+   Job* job( nullptr );
+   size_t idle( 0UL );
+
+   for( size_t i=pending.size(); i>0UL; )
+   {
+      if( pending[i-1UL]->isDone() ) {
+         --i;
+      }
+      else if( ( job = context->affine_.exchange( nullptr ) ) != nullptr ) {
+         runJob( job );
+      }
+      else if( ( job = context->queue_.pop() ) != nullptr ) {
+         runJob( job );
+      }
+      else if( ( job = steal( *context ) ) != nullptr ) {
+         runJob( job );
+      }
+      else if( ++idle < spins ) {
+         std::this_thread::yield();
+      }
+      else if( ( job = stealAffine( *context ) ) != nullptr ) {
+         runJob( job );
+      }
+      else {
+         suspend( *context, *pending[i-1UL] );
+         idle = 0UL;
+      }
+   }
+
+   --context->depth_;
+
+   releaseContext( *context );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Parallel execution of the given kernel for the index range \f$[begin..end)\f$.
+//
+// \param begin The first index of the range.
+// \param end The index one past the last index of the range.
+// \param grain The maximum number of indices per kernel call.
+// \param kernel The kernel to be executed.
+// \return void
+//
+// This function executes the given \a kernel for disjoint chunks of the index range
+// \f$[begin..end)\f$ of at most \a grain indices. The kernel is expected to accept the first
+// and the one-past-the-last index of a chunk, must be safe to be called concurrently for
+// disjoint chunks, and must not throw an exception. The range is recursively split in halves,
+// where at each level the upper half is forked and the lower half is processed by the calling
+// thread. Thus idle threads steal the largest available chunks of work. The function returns
+// as soon as the kernel has been executed for the entire range.
+*/
+template< typename TT       // Type of the encapsulated thread
+        , typename MT       // Type of the synchronization mutex
+        , typename LT       // Type of the mutex lock
+        , typename CT >     // Type of the condition variable
+template< typename Kernel > // Type of the range kernel
+void ThreadPool<TT,MT,LT,CT>::parallelFor( size_t begin, size_t end, size_t grain,
+                                           const Kernel& kernel )
+{
+   if( begin >= end )
+      return;
+
+   Context& context( acquireContext() );
+
+   ++context.depth_;
+   split( context, begin, end, ( grain > 0UL ? grain : 1UL ), kernel );
+   --context.depth_;
+
+   releaseContext( context );
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  UTILITY FUNCTIONS
@@ -702,7 +1185,7 @@ void ThreadPool<TT,MT,LT,CT>::wait()
 {
    Lock lock( mutex_ );
 
-   while( !taskqueue_.isEmpty() || active_ > 0UL ) {
+   while( !taskqueue_.isEmpty() || running_ > 0UL ) {
       waitForThread_.wait( lock );
    }
 }
@@ -725,6 +1208,7 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 {
    Lock lock( mutex_ );
    taskqueue_.clear();
+   queued_ = 0UL;
 }
 //*************************************************************************************************
 
@@ -761,8 +1245,9 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 //
 // \return \a true in case a task was successfully finished, \a false if not.
 //
-// This function is repeatedly called by every thread to execute one of the scheduled tasks.
-// In case there is no task available, the thread blocks and waits for a new task to be
+// This function is repeatedly called by every thread to execute either a fork/join job handed
+// to the thread, a fork/join job stolen from another thread, or one of the scheduled tasks. In
+// case there is no work available, the thread blocks and waits for new work to be forked or
 // scheduled.
 */
 template< typename TT    // Type of the encapsulated thread
@@ -771,37 +1256,477 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 bool ThreadPool<TT,MT,LT,CT>::executeTask()
 {
+   Context*& context( current() );
+
+   if( context == nullptr ) {
+      context = &registerThread();
+      if( affinity_ ) {
+         pinThread( context->index_ );
+      }
+   }
+
+   // Executing fork/join jobs handed to this thread or stealing jobs from the other threads
+   for( size_t i=0UL; i<spins && queued_ == 0UL; ++i )
+   {
+      if( Job* job = context->affine_.exchange( nullptr ) ) {
+         runJob( job );
+         return true;
+      }
+
+      if( Job* job = steal( *context ) ) {
+         runJob( job );
+         return true;
+      }
+
+      std::this_thread::yield();
+   }
+
    threadpool::Task task;
 
    // Acquiring a scheduled task
    {
       Lock lock( mutex_ );
 
-      while( taskqueue_.isEmpty() )
+      if( taskqueue_.isEmpty() )
       {
-         --active_;
-         waitForThread_.notify_all();
-
          if( total_ > expected_ ) {
             --total_;
+            --active_;
+            context->used_ = false;
+            context = nullptr;
+            waitForThread_.notify_all();
             return false;
          }
 
-         waitForTask_.wait( lock );
-         ++active_;
+         ++sleeping_;
+         std::atomic_thread_fence( std::memory_order_seq_cst );
+
+         if( !hasJobs( *context ) ) {
+            --active_;
+            waitForThread_.notify_all();
+            waitForTask_.wait( lock );
+            ++active_;
+         }
+
+         --sleeping_;
+         return true;
       }
 
       BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
       task = taskqueue_.pop();
+      --queued_;
+      ++running_;
    }
 
    // Executing the task
    task();
 
+   {
+      Lock lock( mutex_ );
+      --running_;
+      waitForThread_.notify_all();
+   }
+
    return true;
 }
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  FORK/JOIN FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the scheduling context of the calling thread.
+//
+// \return Reference to the context pointer of the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadPool<TT,MT,LT,CT>::Context*& ThreadPool<TT,MT,LT,CT>::current() noexcept
+{
+   static thread_local Context* context( nullptr );
+   return context;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquiring the scheduling context for the calling thread.
+//
+// \return The scheduling context of the calling thread.
+//
+// This function returns the scheduling context of the calling thread. In case the calling
+// thread is not a thread of the pool and does not yet participate in the scheduling, the
+// thread acquires the external context of the pool. Since the external context can only be
+// used by a single thread at a time, concurrent fork/join regions of several external threads
+// are serialized.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+typename ThreadPool<TT,MT,LT,CT>::Context& ThreadPool<TT,MT,LT,CT>::acquireContext()
+{
+   Context*& context( current() );
+
+   if( context != nullptr && context->pool_ == this )
+      return *context;
+
+   externalMutex_.lock();
+
+   external_.previous_ = context;
+   context = &external_;
+
+   return external_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releasing the scheduling context of the calling thread.
+//
+// \param context The scheduling context of the calling thread.
+// \return void
+//
+// This function releases the external context of the pool as soon as the calling thread has
+// left the outermost fork/join region. The contexts of the threads of the pool are never
+// released.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::releaseContext( Context& context )
+{
+   if( &context != &external_ || context.depth_ > 0UL || !context.pending_.empty() )
+      return;
+
+   current() = external_.previous_;
+   external_.previous_ = nullptr;
+
+   externalMutex_.unlock();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Registering the calling thread of the pool for the fork/join scheduling.
+//
+// \return The scheduling context of the calling thread.
+//
+// This function assigns an unused scheduling context to the calling thread. In case no unused
+// context is available, a new context is created and added to the list of contexts. The index
+// of a new context corresponds to the number of previously created contexts.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+typename ThreadPool<TT,MT,LT,CT>::Context& ThreadPool<TT,MT,LT,CT>::registerThread()
+{
+   Lock lock( mutex_ );
+
+   for( auto const& context : owned_ ) {
+      if( !context->used_ ) {
+         context->used_ = true;
+         return *context;
+      }
+   }
+
+   owned_.push_back( std::unique_ptr<Context>( new Context( this, owned_.size() ) ) );
+
+   Context* context( owned_.back().get() );
+   context->used_ = true;
+   context->next_ = contexts_.load( std::memory_order_relaxed );
+   contexts_.store( context, std::memory_order_release );
+
+   return *context;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stealing a job from any other thread participating in the scheduling.
+//
+// \param context The scheduling context of the calling thread.
+// \return The stolen job, or \c nullptr in case no job could be stolen.
+//
+// This function tries to steal a job from the work queues of all other contexts, starting with
+// the context following the context of the calling thread in order to spread the thieves.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+threadpool::Job* ThreadPool<TT,MT,LT,CT>::steal( const Context& context )
+{
+   Context* const head( contexts_.load( std::memory_order_acquire ) );
+   Context* const start( context.next_ != nullptr ? context.next_ : head );
+
+   Context* victim( start );
+
+   do {
+      if( victim != &context ) {
+         if( Job* job = victim->queue_.steal() )
+            return job;
+      }
+
+      victim = ( victim->next_ != nullptr ? victim->next_ : head );
+   }
+   while( victim != start );
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stealing a job handed to any other thread participating in the scheduling.
+//
+// \param context The scheduling context of the calling thread.
+// \return The stolen job, or \c nullptr in case no job could be stolen.
+//
+// This function tries to take over a job that has been handed to a specific thread via fork()
+// but has not yet been picked up by this thread. It is used by waiting threads to guarantee
+// progress in case the designated thread is busy.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+threadpool::Job* ThreadPool<TT,MT,LT,CT>::stealAffine( const Context& context )
+{
+   for( Context* victim=contexts_.load( std::memory_order_acquire );
+        victim != nullptr; victim=victim->next_ )
+   {
+      if( victim != &context && victim->affine_.load( std::memory_order_relaxed ) != nullptr ) {
+         if( Job* job = victim->affine_.exchange( nullptr ) )
+            return job;
+      }
+   }
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the scheduling context of the thread with the given index.
+//
+// \param index The index of the thread.
+// \return The scheduling context of the thread, or \c nullptr in case no such context exists.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+typename ThreadPool<TT,MT,LT,CT>::Context*
+   ThreadPool<TT,MT,LT,CT>::findContext( size_t index ) const
+{
+   for( Context* context=contexts_.load( std::memory_order_acquire );
+        context != nullptr; context=context->next_ )
+   {
+      if( context->index_ == index )
+         return context;
+   }
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether any work queue or the given context contains jobs.
+//
+// \param context The scheduling context of the calling thread.
+// \return \a true in case any work queue or the given context contains jobs, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+bool ThreadPool<TT,MT,LT,CT>::hasJobs( const Context& context ) const
+{
+   if( context.affine_.load( std::memory_order_relaxed ) != nullptr )
+      return true;
+
+   for( const Context* ctx=contexts_.load( std::memory_order_acquire );
+        ctx != nullptr; ctx=ctx->next_ )
+   {
+      if( !ctx->queue_.isEmpty() )
+         return true;
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waking up a suspended thread after forking a job.
+//
+// \return void
+//
+// This function wakes up a single suspended thread, in case any thread is suspended. The memory
+// fence guarantees that either the forked job is visible to a thread about to be suspended or
+// that this thread is visible as suspended.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::notify()
+{
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+
+   if( sleeping_.load( std::memory_order_relaxed ) > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
+
+   if( joining_.load( std::memory_order_relaxed ) > 0UL ) {
+      Lock lock( mutex_ );
+      waitForJob_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executing the given fork/join job.
+//
+// \param job The job to be executed.
+// \return void
+//
+// This function executes the given job and afterwards wakes up all suspended joining threads,
+// which might wait for the completion of the job (see the suspend() function).
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::runJob( Job* job )
+{
+   job->run();
+
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+
+   if( joining_.load( std::memory_order_relaxed ) > 0UL ) {
+      Lock lock( mutex_ );
+      waitForJob_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Suspending a joining thread until the given job is completed or new work is available.
+//
+// \param context The scheduling context of the calling thread.
+// \param job The job the calling thread is waiting for.
+// \return void
+//
+// This function is called by joining threads that did not find any work to steal within the
+// given number of spins. Instead of spinning indefinitely, the calling thread is suspended until
+// either another thread completes a job (see the runJob() function) or new work is forked (see
+// the notify() function). The memory fences guarantee that either the completion of the job or
+// the availability of new work is visible to the calling thread or that the calling thread is
+// visible as suspended.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::suspend( const Context& context, const Job& job )
+{
+   Lock lock( mutex_ );
+
+   ++joining_;
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+
+   if( !job.isDone() && !hasJobs( context ) ) {
+      waitForJob_.wait( lock );
+   }
+
+   --joining_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recursive execution of the given kernel for the index range \f$[begin..end)\f$.
+//
+// \param context The scheduling context of the calling thread.
+// \param begin The first index of the range.
+// \param end The index one past the last index of the range.
+// \param grain The maximum number of indices per kernel call.
+// \param kernel The kernel to be executed.
+// \return void
+//
+// This function splits the given range in halves until the size of the range does not exceed
+// the given grain size. At each level the upper half is pushed to the work queue of the calling
+// thread and the lower half is processed recursively. Afterwards, the upper half is either
+// popped from the work queue and executed directly or, in case it has been stolen, the calling
+// thread steals other jobs until the upper half has been completed.
+*/
+template< typename TT       // Type of the encapsulated thread
+        , typename MT       // Type of the synchronization mutex
+        , typename LT       // Type of the mutex lock
+        , typename CT >     // Type of the condition variable
+template< typename Kernel > // Type of the range kernel
+void ThreadPool<TT,MT,LT,CT>::split( Context& context, size_t begin, size_t end, size_t grain,
+                                     const Kernel& kernel )
+{
+   if( end - begin <= grain ) {
+      kernel( begin, end );
+      return;
+   }
+
+   const size_t middle( begin + ( end - begin ) / 2UL );
+
+   RangeJob<Kernel> upper( this, middle, end, grain, kernel );
+   context.queue_.push( &upper );
+   notify();
+
+   split( context, begin, middle, grain, kernel );
+
+   if( context.queue_.pop() == &upper ) {
+      upper.run();
+      return;
+   }
+
+   Job* job( nullptr );
+   size_t idle( 0UL );
+
+   while( !upper.isDone() )
+   {
+      if( ( job = context.affine_.exchange( nullptr ) ) != nullptr ) {
+         runJob( job );
+      }
+      else if( ( job = steal( context ) ) != nullptr ) {
+         runJob( job );
+      }
+      else if( ++idle < spins ) {
+         std::this_thread::yield();
+      }
+      else if( ( job = stealAffine( context ) ) != nullptr ) {
+         runJob( job );
+      }
+      else {
+         suspend( context, upper );
+         idle = 0UL;
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,795 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/Workspace.h
+//  \brief Header file for the Workspace class
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_WORKSPACE_H_
+#define _BLAZE_UTIL_WORKSPACE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <new>
+#include <vector>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS WORKSPACE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup workspace Workspace
+// \ingroup util
+*/
+/*!\brief Thread-local arena for temporary arrays.
+// \ingroup workspace
+//
+// The Workspace class implements a stack-like arena (also known as bump allocator) for the
+// temporary arrays of expression evaluations, as for instance the evaluated operands of a dense
+// matrix multiplication, the packing buffers of the matrix multiplication kernels or the
+// temporaries of an aliased assignment. Every thread owns exactly one workspace, which can be
+// accessed via the workspace() function:
+
+   \code
+   blaze::Workspace& ws( blaze::workspace() );
+   \endcode
+
+// Memory is handed out in 64-byte aligned blocks from a small number of large chunks and is
+// released in reverse order of allocation (see the WorkspaceScope and WorkspaceArray classes).
+// Once the workspace has grown to the high-water mark of the computation, the repeated
+// evaluation of the same expressions does not cause any heap allocation anymore: in case the
+// workspace is completely released while it consists of several chunks, the chunks are merged
+// into a single chunk of sufficient size on the next allocation.
+//
+// The statistics of the workspace can be queried via the size(), capacity(), highWaterMark()
+// and allocations() functions:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+
+   for( size_t i=0UL; i<100UL; ++i ) {
+      C = ( A + B ) * ( A - B );
+   }
+
+   const size_t peak( blaze::workspace().highWaterMark() );  // Peak usage in bytes
+   const size_t heap( blaze::workspace().allocations() );    // Number of heap allocations
+   \endcode
+
+// The memory of the workspace is kept until the thread terminates or until the shrink()
+// function is called. Therefore temporaries exceeding the BLAZE_WORKSPACE_LIMIT are not drawn
+// from the workspace but allocated on the heap. The use of the workspace by the expression
+// evaluation can be disabled via the BLAZE_USE_WORKSPACE configuration switch.
+*/
+class Workspace
+   : private NonCopyable
+{
+ public:
+   //**Mark struct definition**********************************************************************
+   /*!\brief Position within the workspace.
+   */
+   struct Mark {
+      size_t chunk;   //!< Index of the current chunk.
+      size_t offset;  //!< Offset within the current chunk.
+   };
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   static constexpr size_t alignment = 64UL;          //!< Alignment of all allocations.
+   static constexpr size_t chunkSize = 65536UL;       //!< Minimum size of a chunk in bytes.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline Workspace() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~Workspace();
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   inline byte_t* allocate( size_t bytes );
+   inline Mark    mark() const noexcept;
+   inline void    release( const Mark& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size         () const noexcept;
+   inline size_t capacity     () const noexcept;
+   inline size_t highWaterMark() const noexcept;
+   inline size_t allocations  () const noexcept;
+   inline void   reserve( size_t bytes );
+   inline void   shrink() noexcept;
+   inline void   resetHighWaterMark() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Chunk struct definition*********************************************************************
+   /*!\brief A single chunk of the workspace.
+   */
+   struct Chunk {
+      byte_t* data;      //!< The memory of the chunk.
+      size_t  capacity;  //!< The capacity of the chunk in bytes.
+      size_t  used;      //!< The number of used bytes.
+   };
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void addChunk( size_t bytes );
+   inline void merge();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<Chunk> chunks_;  //!< The chunks of the workspace.
+   size_t current_;             //!< Index of the current chunk.
+   size_t size_;                //!< The number of used bytes.
+   size_t capacity_;            //!< The total capacity of all chunks in bytes.
+   size_t highWaterMark_;       //!< The maximum number of used bytes.
+   size_t allocations_;         //!< The number of heap allocations.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WORKSPACE CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for Workspace.
+//
+// The default constructor does not allocate any memory.
+*/
+inline Workspace::Workspace() noexcept
+   : chunks_       ()      // The chunks of the workspace
+   , current_      ( 0UL )  // Index of the current chunk
+   , size_         ( 0UL )  // The number of used bytes
+   , capacity_     ( 0UL )  // The total capacity of all chunks in bytes
+   , highWaterMark_( 0UL )  // The maximum number of used bytes
+   , allocations_  ( 0UL )  // The number of heap allocations
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WORKSPACE DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for Workspace.
+*/
+inline Workspace::~Workspace()
+{
+   BLAZE_INTERNAL_ASSERT( size_ == 0UL, "Workspace destroyed while in use" );
+
+   for( const Chunk& chunk : chunks_ ) {
+      deallocate_backend( chunk.data );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WORKSPACE ALLOCATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocates the given number of bytes from the workspace.
+//
+// \param bytes The number of bytes to be allocated.
+// \return Pointer to the first byte of the 64-byte aligned memory block.
+// \exception std::bad_alloc Allocation failed.
+//
+// The memory block is valid until the workspace is released to a mark that has been taken
+// before the allocation. Note that the memory is not initialized.
+*/
+inline byte_t* Workspace::allocate( size_t bytes )
+{
+   bytes = ( bytes + alignment - 1UL ) & ~( alignment - 1UL );
+
+   if( size_ == 0UL && chunks_.size() > 1UL ) {
+      merge();
+   }
+
+   if( chunks_.empty() ) {
+      addChunk( bytes );
+   }
+
+   while( chunks_[current_].capacity - chunks_[current_].used < bytes ) {
+      if( current_+1UL == chunks_.size() )
+         addChunk( ( bytes > capacity_ )?( bytes ):( capacity_ ) );
+      ++current_;
+   }
+
+   Chunk& chunk( chunks_[current_] );
+   byte_t* const address( chunk.data + chunk.used );
+
+   chunk.used += bytes;
+   size_      += bytes;
+
+   if( size_ > highWaterMark_ )
+      highWaterMark_ = size_;
+
+   return address;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current position of the workspace.
+//
+// \return The current position of the workspace.
+*/
+inline Workspace::Mark Workspace::mark() const noexcept
+{
+   Mark m;
+   m.chunk  = current_;
+   m.offset = ( current_ < chunks_.size() )?( chunks_[current_].used ):( 0UL );
+   return m;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases all memory allocated after the given mark.
+//
+// \param m The mark to return to.
+// \return void
+//
+// All memory blocks allocated after the given mark has been taken are released. Marks have to
+// be released in reverse order.
+*/
+inline void Workspace::release( const Mark& m ) noexcept
+{
+   if( chunks_.empty() )
+      return;
+
+   BLAZE_INTERNAL_ASSERT( m.chunk <= current_, "Invalid workspace mark" );
+   BLAZE_INTERNAL_ASSERT( m.chunk < current_ || m.offset <= chunks_[current_].used, "Invalid workspace mark" );
+
+   while( current_ > m.chunk ) {
+      size_ -= chunks_[current_].used;
+      chunks_[current_].used = 0UL;
+      --current_;
+   }
+
+   size_ -= chunks_[current_].used - m.offset;
+   chunks_[current_].used = m.offset;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WORKSPACE UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes currently in use.
+//
+// \return The number of used bytes.
+*/
+inline size_t Workspace::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes reserved by the workspace.
+//
+// \return The total capacity of the workspace in bytes.
+*/
+inline size_t Workspace::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum number of bytes that have been in use at the same time.
+//
+// \return The high-water mark of the workspace in bytes.
+*/
+inline size_t Workspace::highWaterMark() const noexcept
+{
+   return highWaterMark_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of heap allocations performed by the workspace.
+//
+// \return The number of heap allocations.
+//
+// This function can be used to verify that the steady state of a computation does not cause
+// any heap traffic.
+*/
+inline size_t Workspace::allocations() const noexcept
+{
+   return allocations_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the workspace.
+//
+// \param bytes The minimum capacity of the workspace in bytes.
+// \return void
+// \exception std::bad_alloc Allocation failed.
+//
+// This function ensures that the workspace can provide at least \a bytes bytes without any
+// further heap allocation. It can for instance be used to avoid the warm-up of the workspace.
+*/
+inline void Workspace::reserve( size_t bytes )
+{
+   if( capacity_ - size_ < bytes ) {
+      addChunk( bytes );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Releases all memory of the workspace in case it is not in use.
+//
+// \return void
+*/
+inline void Workspace::shrink() noexcept
+{
+   if( size_ != 0UL )
+      return;
+
+   for( const Chunk& chunk : chunks_ ) {
+      deallocate_backend( chunk.data );
+   }
+
+   chunks_.clear();
+   chunks_.shrink_to_fit();
+
+   current_  = 0UL;
+   capacity_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the high-water mark to the number of bytes currently in use.
+//
+// \return void
+*/
+inline void Workspace::resetHighWaterMark() noexcept
+{
+   highWaterMark_ = size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appends a new chunk of at least the given size to the workspace.
+//
+// \param bytes The minimum size of the new chunk in bytes.
+// \return void
+// \exception std::bad_alloc Allocation failed.
+*/
+inline void Workspace::addChunk( size_t bytes )
+{
+   bytes = ( bytes < chunkSize )?( chunkSize ):( ( bytes + alignment - 1UL ) & ~( alignment - 1UL ) );
+
+   chunks_.reserve( chunks_.size()+1UL );
+
+   Chunk chunk;
+   chunk.data     = allocate_backend( bytes, alignment );
+   chunk.capacity = bytes;
+   chunk.used     = 0UL;
+
+   chunks_.push_back( chunk );
+   capacity_ += bytes;
+   ++allocations_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Merges all chunks of an unused workspace into a single chunk.
+//
+// \return void
+// \exception std::bad_alloc Allocation failed.
+*/
+inline void Workspace::merge()
+{
+   BLAZE_INTERNAL_ASSERT( size_ == 0UL, "Workspace still in use" );
+
+   const size_t bytes( capacity_ );
+
+   shrink();
+   addChunk( bytes );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  WORKSPACE ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the workspace of the calling thread.
+// \ingroup workspace
+//
+// \return Reference to the workspace of the calling thread.
+*/
+inline Workspace& workspace() noexcept
+{
+   static thread_local Workspace ws;
+   return ws;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS WORKSPACESCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief RAII scope for allocations from the workspace of the calling thread.
+// \ingroup workspace
+//
+// A WorkspaceScope remembers the current position of the workspace of the calling thread on
+// construction and releases all memory that has been allocated within the scope on destruction.
+// Scopes can be nested, but have to be destroyed in reverse order of construction (which is
+// guaranteed for local variables):
+
+   \code
+   void compute( size_t n )
+   {
+      blaze::WorkspaceScope scope;
+
+      double* const tmp1( scope.allocate<double>( n ) );  // Uninitialized, 64-byte aligned
+      double* const tmp2( scope.allocate<double>( n ) );
+
+      // ... Use the two temporary arrays
+   }  // Both arrays are released
+   \endcode
+
+// Note that the memory of the arrays is not initialized and that only numeric element types
+// (i.e. built-in and complex data types) are supported.
+*/
+class WorkspaceScope
+   : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline WorkspaceScope() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~WorkspaceScope();
+   //@}
+   //**********************************************************************************************
+
+   //**Allocation functions************************************************************************
+   /*!\name Allocation functions */
+   //@{
+   template< typename T >
+   inline T* allocate( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Workspace&      workspace_;  //!< The workspace of the calling thread.
+   Workspace::Mark mark_;       //!< The position of the workspace at construction.
+   size_t          size_;       //!< The number of bytes in use at construction.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The default constructor for WorkspaceScope.
+*/
+inline WorkspaceScope::WorkspaceScope() noexcept
+   : workspace_( workspace() )         // The workspace of the calling thread
+   , mark_     ( workspace_.mark() )   // The position of the workspace at construction
+   , size_     ( workspace_.size() )   // The number of bytes in use at construction
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for WorkspaceScope.
+//
+// The destructor releases all memory allocated within the scope.
+*/
+inline WorkspaceScope::~WorkspaceScope()
+{
+   workspace_.release( mark_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Allocates an uninitialized array from the workspace.
+//
+// \param n The number of elements of the array.
+// \return Pointer to the first element of the 64-byte aligned array.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename T >  // Data type of the array elements
+inline T* WorkspaceScope::allocate( size_t n )
+{
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T );
+
+   return reinterpret_cast<T*>( workspace_.allocate( n*sizeof(T) ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of bytes allocated within the scope.
+//
+// \return The number of bytes allocated within the scope.
+*/
+inline size_t WorkspaceScope::size() const noexcept
+{
+   return workspace_.size() - size_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS WORKSPACEARRAY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Temporary array drawn from the workspace of the calling thread.
+// \ingroup workspace
+//
+// The WorkspaceArray class template represents a temporary, 64-byte aligned array of numeric
+// elements, which is allocated from the workspace of the calling thread and released on
+// destruction. In case the use of the workspace is disabled (see BLAZE_USE_WORKSPACE) or the
+// array exceeds the size limit of the workspace (see BLAZE_WORKSPACE_LIMIT), the array is
+// allocated on the heap. Built-in elements are not initialized, complex elements are
+// default constructed. WorkspaceArray objects have to be destroyed in reverse order of
+// construction (which is guaranteed for local variables).
+*/
+template< typename T >  // Data type of the array elements
+class WorkspaceArray
+   : private NonCopyable
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline WorkspaceArray( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~WorkspaceArray();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline T*       data() noexcept;
+   inline const T* data() const noexcept;
+   inline size_t   size() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Workspace::Mark mark_;    //!< The position of the workspace at construction.
+   T*              data_;    //!< The elements of the array.
+   size_t          size_;    //!< The number of elements of the array.
+   bool            pooled_;  //!< Flag for arrays drawn from the workspace.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( T );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a temporary array of size \a n.
+//
+// \param n The number of elements of the array.
+// \exception std::bad_alloc Allocation failed.
+*/
+template< typename T >  // Data type of the array elements
+inline WorkspaceArray<T>::WorkspaceArray( size_t n )
+   : mark_()            // The position of the workspace at construction
+   , data_( nullptr )   // The elements of the array
+   , size_( n )         // The number of elements of the array
+   , pooled_( useWorkspace && n*sizeof(T) <= workspaceLimit )  // Workspace flag
+{
+   if( pooled_ ) {
+      mark_ = workspace().mark();
+      data_ = reinterpret_cast<T*>( workspace().allocate( n*sizeof(T) ) );
+   }
+   else {
+      data_ = reinterpret_cast<T*>( allocate_backend( n*sizeof(T), Workspace::alignment ) );
+   }
+
+   if( !IsBuiltin<T>::value ) {
+      for( size_t i=0UL; i<n; ++i )
+         ::new( data_+i ) T();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The destructor for WorkspaceArray.
+*/
+template< typename T >  // Data type of the array elements
+inline WorkspaceArray<T>::~WorkspaceArray()
+{
+   if( pooled_ ) {
+      workspace().release( mark_ );
+   }
+   else {
+      deallocate_backend( data_ );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the array elements.
+//
+// \return Pointer to the first element of the array.
+*/
+template< typename T >  // Data type of the array elements
+inline T* WorkspaceArray<T>::data() noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the array elements.
+//
+// \return Pointer to the first element of the array.
+*/
+template< typename T >  // Data type of the array elements
+inline const T* WorkspaceArray<T>::data() const noexcept
+{
+   return data_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of elements of the array.
+//
+// \return The number of elements of the array.
+*/
+template< typename T >  // Data type of the array elements
+inline size_t WorkspaceArray<T>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
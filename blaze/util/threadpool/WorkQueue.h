@@ -0,0 +1,383 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/WorkQueue.h
+//  \brief Header file for the WorkQueue class
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKQUEUE_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKQUEUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Job.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lock-free work-stealing queue for the jobs of a single thread.
+// \ingroup threads
+//
+// The WorkQueue class represents the job container of a single thread of a thread pool. It is
+// a lock-free double-ended queue following the algorithm of Chase and Lev (in the formulation
+// for weak memory models by Le, Pop, Cohen, and Zappa Nardelli): The owning thread adds and
+// removes jobs at the bottom end of the queue (LIFO), whereas any other thread may concurrently
+// steal jobs from the top end of the queue (FIFO). Thus the owner works on the most recently
+// forked (and therefore smallest) jobs, whereas thieves take the oldest (and therefore largest)
+// jobs. Note that the push() and pop() functions must only be called by the owning thread. The
+// capacity of the queue grows on demand; the replaced buffers are kept alive until the queue
+// is destroyed since thieves may still be reading from them.
+*/
+class WorkQueue
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Index = std::ptrdiff_t;  //!< Signed index type of the queue.
+   //**********************************************************************************************
+
+   //**Private class Buffer************************************************************************
+   /*!\brief Circular buffer for the jobs of the queue.
+   */
+   class Buffer
+   {
+    public:
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Buffer class.
+      //
+      // \param capacity The capacity of the buffer (must be a power of two).
+      */
+      explicit inline Buffer( Index capacity )
+         : capacity_( capacity )                                     // The capacity of the buffer
+         , jobs_    ( new std::atomic<Job*>[ size_t( capacity ) ] )  // The buffered jobs
+      {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Returns the capacity of the buffer.
+      //
+      // \return The capacity of the buffer.
+      */
+      inline Index capacity() const noexcept {
+         return capacity_;
+      }
+
+      /*!\brief Returns the job at the given position.
+      //
+      // \param i The position of the job.
+      // \return The job at the given position.
+      */
+      inline Job* get( Index i ) const noexcept {
+         return jobs_[ i & ( capacity_ - 1 ) ].load( std::memory_order_relaxed );
+      }
+
+      /*!\brief Stores the given job at the given position.
+      //
+      // \param i The position of the job.
+      // \param job The job to be stored.
+      // \return void
+      */
+      inline void put( Index i, Job* job ) noexcept {
+         jobs_[ i & ( capacity_ - 1 ) ].store( job, std::memory_order_relaxed );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      Index capacity_;                             //!< The capacity of the buffer.
+      std::unique_ptr<std::atomic<Job*>[]> jobs_;  //!< The buffered jobs.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline WorkQueue( size_t capacity = 64UL );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool isEmpty() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void push ( Job* job );
+   inline Job* pop  ();
+   inline Job* steal();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   Buffer* grow( Buffer* buffer, Index bottom, Index top );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<Index> top_;                          //!< Index of the oldest job (the steal end).
+   std::atomic<Index> bottom_;                       //!< Index one past the newest job.
+   std::atomic<Buffer*> buffer_;                     //!< The current buffer of the queue.
+   std::vector< std::unique_ptr<Buffer> > buffers_;  //!< All buffers allocated by the queue.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for WorkQueue.
+//
+// \param capacity The initial capacity of the queue (must be a power of two).
+*/
+inline WorkQueue::WorkQueue( size_t capacity )
+   : top_    ( 0 )        // Index of the oldest job
+   , bottom_ ( 0 )        // Index one past the newest job
+   , buffer_ ( nullptr )  // The current buffer of the queue
+   , buffers_()           // All buffers allocated by the queue
+{
+   BLAZE_INTERNAL_ASSERT( capacity > 0UL && ( capacity & ( capacity - 1UL ) ) == 0UL
+                        , "Invalid capacity detected" );
+
+   buffers_.emplace_back( new Buffer( Index( capacity ) ) );
+   buffer_.store( buffers_.back().get(), std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the work queue is empty.
+//
+// \return \a true if the work queue is empty, \a false if it is not.
+//
+// This function may be called by any thread. Note however that the result is only a snapshot
+// in case the queue is concurrently modified.
+*/
+inline bool WorkQueue::isEmpty() const
+{
+   const Index bottom( bottom_.load( std::memory_order_relaxed ) );
+   const Index top   ( top_.load( std::memory_order_relaxed ) );
+   return bottom <= top;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a job to the bottom end of the work queue.
+//
+// \param job The job to be added.
+// \return void
+//
+// This function adds the given job to the bottom end of the work queue. It must only be called
+// by the owning thread.
+*/
+inline void WorkQueue::push( Job* job )
+{
+   const Index bottom( bottom_.load( std::memory_order_relaxed ) );
+   const Index top   ( top_.load( std::memory_order_acquire ) );
+
+   Buffer* buffer( buffer_.load( std::memory_order_relaxed ) );
+
+   if( bottom - top > buffer->capacity() - 1 ) {
+      buffer = grow( buffer, bottom, top );
+   }
+
+   buffer->put( bottom, job );
+   std::atomic_thread_fence( std::memory_order_release );
+   bottom_.store( bottom+1, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing the newest job from the bottom end of the work queue.
+//
+// \return The removed job, or \c nullptr in case the queue is empty.
+//
+// This function removes the most recently added job from the work queue. It must only be called
+// by the owning thread.
+*/
+inline Job* WorkQueue::pop()
+{
+   const Index bottom( bottom_.load( std::memory_order_relaxed ) - 1 );
+   Buffer* buffer( buffer_.load( std::memory_order_relaxed ) );
+
+   bottom_.store( bottom, std::memory_order_relaxed );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+
+   Index top( top_.load( std::memory_order_relaxed ) );
+
+   if( top > bottom ) {
+      bottom_.store( bottom+1, std::memory_order_relaxed );
+      return nullptr;
+   }
+
+   Job* job( buffer->get( bottom ) );
+
+   if( top == bottom )
+   {
+      // Competing with the thieves for the last job of the queue
+      if( !top_.compare_exchange_strong( top, top+1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed ) ) {
+         job = nullptr;
+      }
+      bottom_.store( bottom+1, std::memory_order_relaxed );
+   }
+
+   return job;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Stealing the oldest job from the top end of the work queue.
+//
+// \return The stolen job, or \c nullptr in case the queue is empty or the steal failed.
+//
+// This function removes the oldest job from the work queue. It may be called by any thread.
+// Note that the function may fail spuriously in case of a concurrent pop() or steal().
+*/
+inline Job* WorkQueue::steal()
+{
+   Index top( top_.load( std::memory_order_acquire ) );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   const Index bottom( bottom_.load( std::memory_order_acquire ) );
+
+   if( top >= bottom )
+      return nullptr;
+
+   Buffer* buffer( buffer_.load( std::memory_order_acquire ) );
+   Job* job( buffer->get( top ) );
+
+   if( !top_.compare_exchange_strong( top, top+1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed ) )
+      return nullptr;
+
+   return job;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Doubling the capacity of the work queue.
+//
+// \param buffer The current buffer of the queue.
+// \param bottom The current bottom index of the queue.
+// \param top The current top index of the queue.
+// \return The new buffer of the queue.
+//
+// This function replaces the current buffer of the queue by a buffer of twice the capacity. The
+// old buffer is kept alive since concurrent thieves might still read from it.
+*/
+inline WorkQueue::Buffer* WorkQueue::grow( Buffer* buffer, Index bottom, Index top )
+{
+   buffers_.emplace_back( new Buffer( 2*buffer->capacity() ) );
+   Buffer* newBuffer( buffers_.back().get() );
+
+   for( Index i=top; i<bottom; ++i ) {
+      newBuffer->put( i, buffer->get( i ) );
+   }
+
+   buffer_.store( newBuffer, std::memory_order_release );
+
+   return newBuffer;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -42,7 +42,9 @@
 
 #include <type_traits>
 #include <blaze/system/Vectorization.h>
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Complex.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 
 
@@ -142,6 +144,66 @@ struct AlignmentOfHelper<double>
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of \c AlignmentOfHelper for 'float16'.
+// \ingroup type_traits
+//
+// Since 'float16' values are converted to single precision in registers, a SIMD vector of 'float16'
+// values occupies half a register and the required alignment is halved accordingly.
+*/
+template<>
+struct AlignmentOfHelper<float16>
+{
+ public:
+   //**********************************************************************************************
+   enum : size_t {
+#if BLAZE_AVX512F_MODE
+      value = ( IsVectorizable<float16>::value )?( 32UL ):( std::alignment_of<float16>::value )
+#elif BLAZE_AVX_MODE
+      value = ( IsVectorizable<float16>::value )?( 16UL ):( std::alignment_of<float16>::value )
+#elif BLAZE_SSE2_MODE
+      value = ( IsVectorizable<float16>::value )?(  8UL ):( std::alignment_of<float16>::value )
+#else
+      value = std::alignment_of<float16>::value
+#endif
+   };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of \c AlignmentOfHelper for 'bfloat16'.
+// \ingroup type_traits
+//
+// Since 'bfloat16' values are converted to single precision in registers, a SIMD vector of 'bfloat16'
+// values occupies half a register and the required alignment is halved accordingly.
+*/
+template<>
+struct AlignmentOfHelper<bfloat16>
+{
+ public:
+   //**********************************************************************************************
+   enum : size_t {
+#if BLAZE_AVX512F_MODE
+      value = ( IsVectorizable<bfloat16>::value )?( 32UL ):( std::alignment_of<bfloat16>::value )
+#elif BLAZE_AVX_MODE
+      value = ( IsVectorizable<bfloat16>::value )?( 16UL ):( std::alignment_of<bfloat16>::value )
+#elif BLAZE_SSE2_MODE
+      value = ( IsVectorizable<bfloat16>::value )?(  8UL ):( std::alignment_of<bfloat16>::value )
+#else
+      value = std::alignment_of<bfloat16>::value
+#endif
+   };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Specialization of \c AlignmentOfHelper for 'complex<float>'.
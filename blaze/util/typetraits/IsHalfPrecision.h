@@ -0,0 +1,122 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/typetraits/IsHalfPrecision.h
+//  \brief Header file for the IsHalfPrecision type trait
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TYPETRAITS_ISHALFPRECISION_H_
+#define _BLAZE_UTIL_TYPETRAITS_ISHALFPRECISION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/BFloat16.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/Float16.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the IsHalfPrecision type trait.
+// \ingroup type_traits
+*/
+template< typename T >
+struct IsHalfPrecisionHelper
+   : public FalseType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsHalfPrecisionHelper class template for 'float16'.
+template<>
+struct IsHalfPrecisionHelper<float16>
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsHalfPrecisionHelper class template for 'bfloat16'.
+template<>
+struct IsHalfPrecisionHelper<bfloat16>
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compile time check for 16-bit floating point types.
+// \ingroup type_traits
+//
+// This type trait tests whether or not the given template parameter is one of the 16-bit
+// floating point storage types blaze::float16 or blaze::bfloat16. In case the type is a 16-bit
+// floating point type (ignoring the cv-qualifiers), the \a value member constant is set to
+// \a true, the nested type definition \a Type is \a TrueType, and the class derives from
+// \a TrueType. Otherwise \a value is set to \a false, \a Type is \a FalseType, and the class
+// derives from \a FalseType.
+
+   \code
+   blaze::IsHalfPrecision<float16>::value            // Evaluates to 'true'
+   blaze::IsHalfPrecision<const bfloat16>::Type      // Results in TrueType
+   blaze::IsHalfPrecision<const volatile float16>    // Is derived from TrueType
+   blaze::IsHalfPrecision<float>::value              // Evaluates to 'false'
+   blaze::IsHalfPrecision<const short>::Type         // Results in FalseType
+   blaze::IsHalfPrecision<volatile complex<float> >  // Is derived from FalseType
+   \endcode
+*/
+template< typename T >
+struct IsHalfPrecision
+   : public BoolConstant< IsHalfPrecisionHelper< RemoveCV_<T> >::value >
+{};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
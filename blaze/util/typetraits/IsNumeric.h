@@ -40,8 +40,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <blaze/util/BFloat16.h>
 #include <blaze/util/Complex.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/TrueType.h>
 #include <blaze/util/typetraits/IsBoolean.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsVoid.h>
@@ -60,8 +63,8 @@ namespace blaze {
 // \ingroup type_traits
 //
 // This type trait tests whether or not the given template parameter is a numeric data type.
-// Blaze considers all integral (except \a bool), floating point, and complex data types as
-// numeric data types. In case the type is a numeric type, the \a value member constant is
+// Blaze considers all integral (except \a bool), floating point, and complex data types as well
+// as the 16-bit floating point types \a float16 and \a bfloat16 as numeric data types. In case the type is a numeric type, the \a value member constant is
 // set to \a true, the nested type definition \a Type is \a TrueType, and the class derives
 // from \a TrueType. Otherwise \a value is set to \a false, \a Type is \a FalseType, and the
 // class derives from \a FalseType.
@@ -125,6 +128,94 @@ struct IsNumeric< const volatile complex<T> >
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsNumeric type trait for the plain 'float16' type.
+template<>
+struct IsNumeric< float16 >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsNumeric type trait for 'const float16'.
+template<>
+struct IsNumeric< const float16 >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsNumeric type trait for 'volatile float16'.
+template<>
+struct IsNumeric< volatile float16 >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsNumeric type trait for 'const volatile float16'.
+template<>
+struct IsNumeric< const volatile float16 >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsNumeric type trait for the plain 'bfloat16' type.
+template<>
+struct IsNumeric< bfloat16 >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsNumeric type trait for 'const bfloat16'.
+template<>
+struct IsNumeric< const bfloat16 >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsNumeric type trait for 'volatile bfloat16'.
+template<>
+struct IsNumeric< volatile bfloat16 >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+//! Specialization of the IsNumeric type trait for 'const volatile bfloat16'.
+template<>
+struct IsNumeric< const volatile bfloat16 >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -41,6 +41,9 @@
 //*************************************************************************************************
 
 #include <blaze/system/Vectorization.h>
+#include <blaze/util/BFloat16.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Float16.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/typetraits/IsComplex.h>
 #include <blaze/util/typetraits/IsFloat.h>
@@ -109,6 +112,82 @@ struct IsVectorizableHelper<void>
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsVectorizableHelper class template for 'float16'.
+// \ingroup type_traits
+//
+// Vectors of 'float16' values are converted to single precision in registers, which requires
+// either the F16C instruction set or AVX-512.
+*/
+template<>
+struct IsVectorizableHelper<float16>
+{
+ public:
+   //**********************************************************************************************
+   enum : bool { value = !bool( BLAZE_MIC_MODE ) &&
+                         ( bool( BLAZE_AVX512F_MODE ) ||
+                           ( bool( BLAZE_F16C_MODE ) && bool( BLAZE_SSE2_MODE ) ) ) };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsVectorizableHelper class template for 'bfloat16'.
+// \ingroup type_traits
+//
+// Vectors of 'bfloat16' values are converted to single precision in registers by means of
+// integer shifts, which requires SSE2.
+*/
+template<>
+struct IsVectorizableHelper<bfloat16>
+{
+ public:
+   //**********************************************************************************************
+   enum : bool { value = !bool( BLAZE_MIC_MODE ) && bool( BLAZE_SSE2_MODE ) };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsVectorizableHelper class template for 'complex<float16>'.
+// \ingroup type_traits
+*/
+template<>
+struct IsVectorizableHelper< complex<float16> >
+{
+ public:
+   //**********************************************************************************************
+   enum : bool { value = false };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsVectorizableHelper class template for 'complex<bfloat16>'.
+// \ingroup type_traits
+*/
+template<>
+struct IsVectorizableHelper< complex<bfloat16> >
+{
+ public:
+   //**********************************************************************************************
+   enum : bool { value = false };
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Compile time check for vectorizable types.
 // \ingroup type_traits
@@ -117,10 +196,12 @@ struct IsVectorizableHelper<void>
 // this type trait tests whether or not the given template parameter is a vectorizable type,
 // i.e. a type for which intrinsic vector operations and optimizations can be used. Currently,
 // all built-in data types except \c bool and the according complex numbers are considered to
-// be vectorizable types. In case the type is vectorizable, the \a value member constant is
-// set to \a true, the nested type definition \a Type is \a TrueType, and the class derives
-// from \a TrueType. Otherwise \a value is set to \a false, \a Type is \a FalseType, and the
-// class derives from \a FalseType.
+// be vectorizable types. Additionally, the 16-bit floating point types \c float16 (in case
+// F16C or AVX-512 is available) and \c bfloat16 are vectorizable, but not the according
+// complex numbers. In case the type is vectorizable, the \a value member constant is set to
+// \a true, the nested type definition \a Type is \a TrueType, and the class derives from
+// \a TrueType. Otherwise \a value is set to \a false, \a Type is \a FalseType, and the class
+// derives from \a FalseType.
 
    \code
    blaze::IsVectorizable< int >::value         // Evaluates to 'true'
@@ -0,0 +1,730 @@
+//=================================================================================================
+/*!
+//  \file src/main/Tune.cpp
+//  \brief Source file for the Blaze tuning program
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Tuning configuration
+//*************************************************************************************************
+
+// Compilation switch for the tuning of the SMP thresholds. The switch is deactivated for the
+// compilation of the cache size candidates in order to reduce the compilation time.
+#ifndef BLAZEMARK_TUNE_SMP
+#define BLAZEMARK_TUNE_SMP 1
+#endif
+
+
+//*************************************************************************************************
+// SMP thresholds
+//*************************************************************************************************
+
+// All tuned operations are unconditionally executed in parallel unless explicitly requested
+// otherwise via a serial section. This allows to measure both the serial and the parallel
+// performance of all operations within a single binary.
+#define BLAZE_SMP_DVECASSIGN_THRESHOLD         0UL
+#define BLAZE_SMP_DVECSCALARMULT_THRESHOLD     0UL
+#define BLAZE_SMP_DVECDVECADD_THRESHOLD        0UL
+#define BLAZE_SMP_DVECDVECSUB_THRESHOLD        0UL
+#define BLAZE_SMP_DVECDVECMULT_THRESHOLD       0UL
+#define BLAZE_SMP_DVECDVECDIV_THRESHOLD        0UL
+#define BLAZE_SMP_DVECDVECOUTER_THRESHOLD      0UL
+#define BLAZE_SMP_DVECREDUCE_THRESHOLD         0UL
+#define BLAZE_SMP_DMATDVECMULT_THRESHOLD       0UL
+#define BLAZE_SMP_TDMATDVECMULT_THRESHOLD      0UL
+#define BLAZE_SMP_TDVECDMATMULT_THRESHOLD      0UL
+#define BLAZE_SMP_TDVECTDMATMULT_THRESHOLD     0UL
+#define BLAZE_SMP_DMATASSIGN_THRESHOLD         0UL
+#define BLAZE_SMP_DMATSCALARMULT_THRESHOLD     0UL
+#define BLAZE_SMP_DMATDMATADD_THRESHOLD        0UL
+#define BLAZE_SMP_DMATTDMATADD_THRESHOLD       0UL
+#define BLAZE_SMP_DMATDMATSUB_THRESHOLD        0UL
+#define BLAZE_SMP_DMATTDMATSUB_THRESHOLD       0UL
+#define BLAZE_SMP_DMATDMATSCHUR_THRESHOLD      0UL
+#define BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD     0UL
+#define BLAZE_SMP_DMATREDUCE_THRESHOLD         0UL
+#define BLAZE_SMP_DMATDMATMULT_THRESHOLD       0UL
+#define BLAZE_SMP_DMATTDMATMULT_THRESHOLD      0UL
+#define BLAZE_SMP_TDMATDMATMULT_THRESHOLD      0UL
+#define BLAZE_SMP_TDMATTDMATMULT_THRESHOLD     0UL
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Timing.h>
+#include <blazemark/blaze/init/DynamicMatrix.h>
+#include <blazemark/blaze/init/DynamicVector.h>
+#include <blazemark/system/Config.h>
+#include <blazemark/system/Types.h>
+#include <blazemark/util/DynamicDenseRun.h>
+
+
+//*************************************************************************************************
+// Using declarations
+//*************************************************************************************************
+
+using blazemark::DynamicDenseRun;
+using blazemark::element_t;
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Type of a single tuning run.
+//
+// This type definition specifies the type of a single measurement of the tuning process. The
+// Blaze result of a run holds the runtime of the measured variant of the operation.
+*/
+typedef DynamicDenseRun  Run;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Type of a row-major dense matrix. */
+typedef blaze::DynamicMatrix<element_t,blaze::rowMajor>  RowMajorMatrix;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Type of a column-major dense matrix. */
+typedef blaze::DynamicMatrix<element_t,blaze::columnMajor>  ColumnMajorMatrix;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Type of a dense column vector. */
+typedef blaze::DynamicVector<element_t,blaze::columnVector>  ColumnVector;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Type of a dense row vector. */
+typedef blaze::DynamicVector<element_t,blaze::rowVector>  RowVector;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TUNING CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+const double mintime( 0.02 );  //!< Minimum runtime of a single tuning measurement [s]
+const double speedup( 1.05 );  //!< Minimum speedup of the parallel variant of an operation
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a geometric sequence of problem sizes.
+//
+// \param first The first problem size of the sequence.
+// \param last The upper bound for the problem sizes of the sequence.
+// \return The geometric sequence of problem sizes.
+//
+// This function creates a geometric sequence of problem sizes with a ratio of approximately
+// \f$ \sqrt{2} \f$, starting at \a first and ending at or below \a last.
+*/
+std::vector<size_t> sweep( size_t first, size_t last )
+{
+   std::vector<size_t> sizes;
+
+   for( double size=first; size<=last; size*=1.41421356 ) {
+      sizes.push_back( static_cast<size_t>( size ) );
+   }
+
+   return sizes;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Single execution of the serial or parallel variant of an operation.
+//
+// \param kernel The operation to be executed.
+// \param parallel \a true to execute the parallel variant, \a false for the serial variant.
+// \return void
+//
+// The serial variant of the operation is executed within a serial section, which guarantees
+// that both variants use the same compute kernels.
+*/
+template< typename Kernel >  // Type of the operation
+inline void execute( Kernel& kernel, bool parallel )
+{
+   if( parallel ) {
+      kernel();
+   }
+   else BLAZE_SERIAL_SECTION {
+      kernel();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measuring the runtime of a single variant of an operation.
+//
+// \param run The parameters for the tuning run.
+// \param kernel The operation to be measured.
+// \param parallel \a true to measure the parallel variant, \a false for the serial variant.
+// \return void
+//
+// This function estimates the necessary number of steps for the given run (in case the number
+// of steps has not been specified yet) and stores the minimum runtime of several repetitions
+// of the operation as the Blaze result of the run.
+*/
+template< typename Kernel >  // Type of the operation
+void measure( Run& run, Kernel& kernel, bool parallel )
+{
+   blaze::timing::WcTimer timer;
+
+   if( run.getSteps() == 0UL )
+   {
+      size_t steps( 1UL );
+
+      while( true ) {
+         timer.start();
+         for( size_t step=0UL; step<steps; ++step ) {
+            execute( kernel, parallel );
+         }
+         timer.end();
+         if( timer.last() >= mintime ) break;
+         steps *= 2UL;
+      }
+
+      run.setSteps( steps );
+   }
+
+   double result( blaze::inf );
+
+   for( size_t rep=0UL; rep<blazemark::reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<run.getSteps(); ++step ) {
+         execute( kernel, parallel );
+      }
+      timer.end();
+      result = blaze::min( result, timer.last() );
+   }
+
+   run.setBlazeResult( result );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Determining the serial/parallel crossover of an operation.
+//
+// \param name The name of the according SMP threshold.
+// \param sizes The problem sizes to be measured.
+// \param setup Functor for the setup of the operation for a given problem size.
+// \param elements Functor for the conversion of a problem size into the threshold quantity.
+// \return void
+//
+// This function measures both the serial and the parallel variant of an operation for all
+// given problem sizes and writes the according threshold setting to the standard output. The
+// threshold is the smallest problem size from which on the parallel variant is faster than
+// the serial variant (by at least the minimum speedup) for all larger problem sizes. In case
+// the parallel variant is not faster for the largest problem size, the default threshold is
+// retained.
+*/
+template< typename Setup      // Type of the setup functor
+        , typename Elements >  // Type of the conversion functor
+void crossover( const std::string& name, const std::vector<size_t>& sizes,
+                Setup setup, Elements elements )
+{
+   std::cerr << "   " << name << "\n";
+
+   std::vector<Run> serialRuns, parallelRuns;
+
+   for( size_t size : sizes )
+   {
+      auto kernel( setup( size ) );
+
+      serialRuns.push_back( Run( size ) );
+      parallelRuns.push_back( Run( size ) );
+
+      measure( serialRuns.back(), kernel, false );
+      parallelRuns.back().setSteps( serialRuns.back().getSteps() );
+      measure( parallelRuns.back(), kernel, true );
+
+      std::cerr << "     " << std::setw(12) << size
+                << std::setw(14) << serialRuns.back().getBlazeResult()
+                << std::setw(14) << parallelRuns.back().getBlazeResult() << "\n";
+   }
+
+   size_t index( sizes.size() );
+
+   while( index > 0UL &&
+          speedup * parallelRuns[index-1UL].getBlazeResult() < serialRuns[index-1UL].getBlazeResult() ) {
+      --index;
+   }
+
+   if( index == sizes.size() ) {
+      std::cout << "// " << name << ": no parallel speedup measured, default retained\n";
+   }
+   else {
+      std::cout << "#ifndef " << name << "\n"
+                << "#define " << name << " " << elements( sizes[index] ) << "UL\n"
+                << "#endif\n";
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a vector size into the threshold quantity of vector operations.
+//
+// \param size The size of the vectors.
+// \return The number of elements of the target vector.
+*/
+size_t vectorElements( size_t size )
+{
+   return size;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion of a matrix size into the threshold quantity of matrix operations.
+//
+// \param size The number of rows and columns of the matrices.
+// \return The number of elements of the target matrix.
+*/
+size_t matrixElements( size_t size )
+{
+   return size * size;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TUNING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Tuning of the SMP thresholds.
+//
+// \return void
+//
+// This function determines the serial/parallel crossover of all dense vector and dense matrix
+// operations with a tunable SMP threshold and writes the according threshold settings to the
+// standard output.
+*/
+void tuneSMP()
+{
+#if BLAZEMARK_TUNE_SMP
+   using blaze::trans;
+
+   if( blaze::getNumThreads() < 2UL ) {
+      std::cout << "// SMP thresholds: single-threaded configuration, defaults retained\n";
+      return;
+   }
+
+   ::blaze::setSeed( ::blazemark::seed );
+
+   const std::vector<size_t> vectorSizes( sweep( 1024UL, 4194304UL ) );
+   const std::vector<size_t> outerSizes ( sweep( 16UL, 2048UL ) );
+   const std::vector<size_t> mvSizes    ( sweep( 16UL, 2048UL ) );
+   const std::vector<size_t> matrixSizes( sweep( 16UL, 2048UL ) );
+   const std::vector<size_t> mmSizes    ( sweep( 8UL, 512UL ) );
+
+   const auto vectors = []( size_t N ) {
+      ColumnVector a( N ), b( N ), c( N );
+      blazemark::blaze::init( a );
+      blazemark::blaze::init( b );
+      return std::make_tuple( a, b, c );
+   };
+
+   const auto matrices = []( size_t N ) {
+      RowMajorMatrix A( N, N ), B( N, N ), C( N, N );
+      ColumnMajorMatrix TB( N, N );
+      blazemark::blaze::init( A );
+      blazemark::blaze::init( B );
+      blazemark::blaze::init( TB );
+      return std::make_tuple( A, B, TB, C );
+   };
+
+   // Dense vector operations
+   crossover( "BLAZE_SMP_DVECASSIGN_THRESHOLD", vectorSizes, [=]( size_t N ) {
+      auto v( vectors( N ) );
+      return [v]() mutable {
+         auto& a( std::get<0>( v ) ); auto& c( std::get<2>( v ) );
+         c = a;
+      };
+   }, vectorElements );
+
+   crossover( "BLAZE_SMP_DVECSCALARMULT_THRESHOLD", vectorSizes, [=]( size_t N ) {
+      auto v( vectors( N ) );
+      return [v]() mutable {
+         auto& a( std::get<0>( v ) ); auto& c( std::get<2>( v ) );
+         c = a * 2.1;
+      };
+   }, vectorElements );
+
+   crossover( "BLAZE_SMP_DVECDVECADD_THRESHOLD", vectorSizes, [=]( size_t N ) {
+      auto v( vectors( N ) );
+      return [v]() mutable {
+         auto& a( std::get<0>( v ) ); auto& b( std::get<1>( v ) ); auto& c( std::get<2>( v ) );
+         c = a + b;
+      };
+   }, vectorElements );
+
+   crossover( "BLAZE_SMP_DVECDVECSUB_THRESHOLD", vectorSizes, [=]( size_t N ) {
+      auto v( vectors( N ) );
+      return [v]() mutable {
+         auto& a( std::get<0>( v ) ); auto& b( std::get<1>( v ) ); auto& c( std::get<2>( v ) );
+         c = a - b;
+      };
+   }, vectorElements );
+
+   crossover( "BLAZE_SMP_DVECDVECMULT_THRESHOLD", vectorSizes, [=]( size_t N ) {
+      auto v( vectors( N ) );
+      return [v]() mutable {
+         auto& a( std::get<0>( v ) ); auto& b( std::get<1>( v ) ); auto& c( std::get<2>( v ) );
+         c = a * b;
+      };
+   }, vectorElements );
+
+   crossover( "BLAZE_SMP_DVECDVECDIV_THRESHOLD", vectorSizes, [=]( size_t N ) {
+      auto v( vectors( N ) );
+      return [v]() mutable {
+         auto& a( std::get<0>( v ) ); auto& b( std::get<1>( v ) ); auto& c( std::get<2>( v ) );
+         c = a / b;
+      };
+   }, vectorElements );
+
+   crossover( "BLAZE_SMP_DVECDVECOUTER_THRESHOLD", outerSizes, [=]( size_t N ) {
+      auto v( vectors( N ) );
+      RowMajorMatrix C( N, N );
+      return [v,C]() mutable {
+         auto& a( std::get<0>( v ) ); auto& b( std::get<1>( v ) );
+         C = a * trans( b );
+      };
+   }, matrixElements );
+
+   crossover( "BLAZE_SMP_DVECREDUCE_THRESHOLD", vectorSizes, [=]( size_t N ) {
+      auto v( vectors( N ) );
+      return [v]() mutable {
+         auto& a( std::get<0>( v ) ); auto& c( std::get<2>( v ) );
+         c[0] = sum( a );
+      };
+   }, vectorElements );
+
+   // Dense matrix/dense vector multiplications
+   crossover( "BLAZE_SMP_DMATDVECMULT_THRESHOLD", mvSizes, [=]( size_t N ) {
+      auto v( vectors( N ) ); auto m( matrices( N ) );
+      return [v,m]() mutable {
+         auto& A( std::get<0>( m ) ); auto& a( std::get<0>( v ) ); auto& c( std::get<2>( v ) );
+         c = A * a;
+      };
+   }, vectorElements );
+
+   crossover( "BLAZE_SMP_TDMATDVECMULT_THRESHOLD", mvSizes, [=]( size_t N ) {
+      auto v( vectors( N ) ); auto m( matrices( N ) );
+      return [v,m]() mutable {
+         auto& A( std::get<2>( m ) ); auto& a( std::get<0>( v ) ); auto& c( std::get<2>( v ) );
+         c = A * a;
+      };
+   }, vectorElements );
+
+   crossover( "BLAZE_SMP_TDVECDMATMULT_THRESHOLD", mvSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      RowVector a( N ), c( N );
+      blazemark::blaze::init( a );
+      return [m,a,c]() mutable {
+         auto& A( std::get<0>( m ) );
+         c = a * A;
+      };
+   }, vectorElements );
+
+   crossover( "BLAZE_SMP_TDVECTDMATMULT_THRESHOLD", mvSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      RowVector a( N ), c( N );
+      blazemark::blaze::init( a );
+      return [m,a,c]() mutable {
+         auto& A( std::get<2>( m ) );
+         c = a * A;
+      };
+   }, vectorElements );
+
+   // Dense matrix operations
+   crossover( "BLAZE_SMP_DMATASSIGN_THRESHOLD", matrixSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      return [m]() mutable {
+         auto& A( std::get<0>( m ) ); auto& C( std::get<3>( m ) );
+         C = A;
+      };
+   }, matrixElements );
+
+   crossover( "BLAZE_SMP_DMATSCALARMULT_THRESHOLD", matrixSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      return [m]() mutable {
+         auto& A( std::get<0>( m ) ); auto& C( std::get<3>( m ) );
+         C = A * 2.1;
+      };
+   }, matrixElements );
+
+   crossover( "BLAZE_SMP_DMATDMATADD_THRESHOLD", matrixSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      return [m]() mutable {
+         auto& A( std::get<0>( m ) ); auto& B( std::get<1>( m ) ); auto& C( std::get<3>( m ) );
+         C = A + B;
+      };
+   }, matrixElements );
+
+   crossover( "BLAZE_SMP_DMATTDMATADD_THRESHOLD", matrixSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      return [m]() mutable {
+         auto& A( std::get<0>( m ) ); auto& B( std::get<2>( m ) ); auto& C( std::get<3>( m ) );
+         C = A + B;
+      };
+   }, matrixElements );
+
+   crossover( "BLAZE_SMP_DMATDMATSUB_THRESHOLD", matrixSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      return [m]() mutable {
+         auto& A( std::get<0>( m ) ); auto& B( std::get<1>( m ) ); auto& C( std::get<3>( m ) );
+         C = A - B;
+      };
+   }, matrixElements );
+
+   crossover( "BLAZE_SMP_DMATTDMATSUB_THRESHOLD", matrixSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      return [m]() mutable {
+         auto& A( std::get<0>( m ) ); auto& B( std::get<2>( m ) ); auto& C( std::get<3>( m ) );
+         C = A - B;
+      };
+   }, matrixElements );
+
+   crossover( "BLAZE_SMP_DMATDMATSCHUR_THRESHOLD", matrixSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      return [m]() mutable {
+         auto& A( std::get<0>( m ) ); auto& B( std::get<1>( m ) ); auto& C( std::get<3>( m ) );
+         C = A % B;
+      };
+   }, matrixElements );
+
+   crossover( "BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD", matrixSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      return [m]() mutable {
+         auto& A( std::get<0>( m ) ); auto& B( std::get<2>( m ) ); auto& C( std::get<3>( m ) );
+         C = A % B;
+      };
+   }, matrixElements );
+
+   crossover( "BLAZE_SMP_DMATREDUCE_THRESHOLD", matrixSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      return [m]() mutable {
+         auto& A( std::get<0>( m ) ); auto& C( std::get<3>( m ) );
+         C(0,0) = sum( A );
+      };
+   }, matrixElements );
+
+   // Dense matrix/dense matrix multiplications
+   crossover( "BLAZE_SMP_DMATDMATMULT_THRESHOLD", mmSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      return [m]() mutable {
+         auto& A( std::get<0>( m ) ); auto& B( std::get<1>( m ) ); auto& C( std::get<3>( m ) );
+         C = A * B;
+      };
+   }, matrixElements );
+
+   crossover( "BLAZE_SMP_DMATTDMATMULT_THRESHOLD", mmSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      return [m]() mutable {
+         auto& A( std::get<0>( m ) ); auto& B( std::get<2>( m ) ); auto& C( std::get<3>( m ) );
+         C = A * B;
+      };
+   }, matrixElements );
+
+   crossover( "BLAZE_SMP_TDMATDMATMULT_THRESHOLD", mmSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      ColumnMajorMatrix TA( std::get<0>( m ) );
+      return [m,TA]() mutable {
+         auto& B( std::get<1>( m ) ); auto& C( std::get<3>( m ) );
+         C = TA * B;
+      };
+   }, matrixElements );
+
+   crossover( "BLAZE_SMP_TDMATTDMATMULT_THRESHOLD", mmSizes, [=]( size_t N ) {
+      auto m( matrices( N ) );
+      ColumnMajorMatrix TA( std::get<0>( m ) );
+      return [m,TA]() mutable {
+         auto& B( std::get<2>( m ) ); auto& C( std::get<3>( m ) );
+         C = TA * B;
+      };
+   }, matrixElements );
+#else
+   std::cout << "// SMP thresholds: tuning deactivated, defaults retained\n";
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measuring the performance of the compiled-in matrix multiplication blocking.
+//
+// \return void
+//
+// This function measures the serial performance of the row-major and column-major dense
+// matrix/dense matrix multiplication for several mid-size problems and writes the average
+// performance in MFlop/s to the standard output. Since the blocking of the matrix multiplication
+// is derived from the L1 and L2 cache sizes at compile time, the performance of different cache
+// sizes has to be compared by means of several compilations of this tuning program (see the
+// blazemark/tune script).
+*/
+void tuneMMM()
+{
+   ::blaze::setSeed( ::blazemark::seed );
+
+   std::cerr << "   L1 cache size=" << blaze::l1CacheSize
+             << ", L2 cache size=" << blaze::l2CacheSize << "\n";
+
+   const size_t sizes[] = { 128UL, 192UL, 256UL, 384UL, 512UL, 768UL };
+
+   double total( 0.0 );
+   size_t count( 0UL );
+
+   for( size_t N : sizes )
+   {
+      RowMajorMatrix A( N, N ), B( N, N ), C( N, N );
+      ColumnMajorMatrix TA( N, N ), TB( N, N ), TC( N, N );
+
+      blazemark::blaze::init( A );
+      blazemark::blaze::init( B );
+      TA = A;
+      TB = B;
+
+      auto rowMajor = [&]() { C = A * B; };
+      auto columnMajor = [&]() { TC = TA * TB; };
+
+      Run rowMajorRun( N ), columnMajorRun( N );
+      measure( rowMajorRun, rowMajor, false );
+      measure( columnMajorRun, columnMajor, false );
+
+      const double flops( 2.0 * N * N * N );
+      const double rowMajorMFlops( flops * rowMajorRun.getSteps() / rowMajorRun.getBlazeResult() / 1E6 );
+      const double columnMajorMFlops( flops * columnMajorRun.getSteps() / columnMajorRun.getBlazeResult() / 1E6 );
+
+      std::cerr << "     " << std::setw(12) << N
+                << std::setw(14) << rowMajorMFlops
+                << std::setw(14) << columnMajorMFlops << "\n";
+
+      total += rowMajorMFlops + columnMajorMFlops;
+      count += 2UL;
+   }
+
+   std::cout << ( total / count ) << "\n";
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze tuning program.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The tuning program is usually not run directly, but by means of the blazemark/tune script
+// (which is invoked via 'make tune'). In the 'smp' mode, the SMP thresholds are determined
+// and written to the standard output in the format of the blaze/config/Tuning.h configuration
+// file. In the 'mmm' mode, the average performance of the dense matrix multiplication for the
+// compiled-in cache sizes is written to the standard output. All progress information is
+// written to the standard error.
+*/
+int main( int argc, char** argv )
+{
+   const std::string mode( ( argc == 2 )?( argv[1] ):( "" ) );
+
+   if( mode != "smp" && mode != "mmm" ) {
+      std::cerr << " Invalid use of program 'Tune'!\n"
+                << "   Use: ./tune smp|mmm\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   try {
+      if( mode == "smp" )
+         tuneSMP();
+      else
+         tuneMMM();
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "   Error during tuning: " << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+}
+//*************************************************************************************************
@@ -104,6 +104,8 @@ class GeneralTest
    void testMinimum();
    void testMaximum();
    void testTrace();
+   void testSum();
+   void testReduce();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -46,6 +46,7 @@
 #include <typeinfo>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/shims/Equal.h>
+#include <blaze/system/LAPACK.h>
 #include <blazetest/system/LAPACK.h>
 
 
@@ -135,7 +136,7 @@ class DenseTest
 template< typename Type >
 void DenseTest::testRandom2x2()
 {
-#if BLAZETEST_MATHTEST_LAPACK_MODE
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
 
    using blaze::equal;
 
@@ -181,7 +182,7 @@ void DenseTest::testRandom2x2()
 template< typename Type >
 void DenseTest::testRandom3x3()
 {
-#if BLAZETEST_MATHTEST_LAPACK_MODE
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
 
    using blaze::equal;
 
@@ -227,7 +228,7 @@ void DenseTest::testRandom3x3()
 template< typename Type >
 void DenseTest::testRandom4x4()
 {
-#if BLAZETEST_MATHTEST_LAPACK_MODE
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
 
    using blaze::equal;
 
@@ -273,7 +274,7 @@ void DenseTest::testRandom4x4()
 template< typename Type >
 void DenseTest::testRandom5x5()
 {
-#if BLAZETEST_MATHTEST_LAPACK_MODE
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
 
    using blaze::equal;
 
@@ -319,7 +320,7 @@ void DenseTest::testRandom5x5()
 template< typename Type >
 void DenseTest::testRandom6x6()
 {
-#if BLAZETEST_MATHTEST_LAPACK_MODE
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
 
    using blaze::equal;
 
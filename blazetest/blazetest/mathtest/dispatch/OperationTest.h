@@ -0,0 +1,560 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dispatch/OperationTest.h
+//  \brief Header file for the runtime dispatch operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DISPATCH_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_DISPATCH_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/dispatch/Dispatch.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the runtime dispatched kernels.
+//
+// This class represents a test suite for the dense vector addition, the dense matrix/dense
+// vector multiplication, and the dense matrix/dense matrix multiplication, which are computed
+// by runtime dispatched kernels in case the runtime dispatch mode is active. All operands are
+// initialized with small integral values such that all results are exactly representable and
+// can be compared to a scalar reference implementation without tolerance.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testAdd();
+   template< typename Type, bool SO > void testGemv();
+   template< typename Type, bool SO > void testTGemv();
+   template< typename Type, bool SO1, bool SO2, bool SO3 > void testGemm();
+   template< typename Type > void testKernels();
+
+   template< typename VT1, typename VT2 >
+   void checkResult( const VT1& result, const VT2& expected, const std::string& operation ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, bool TF > void initialize( blaze::DynamicVector<Type,TF>& v ) const;
+   template< typename Type, bool SO > void initialize( blaze::DynamicMatrix<Type,SO>& A ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the dense vector addition.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the dense vector addition for various vector sizes that are
+// not multiples of the SIMD width. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void OperationTest::testAdd()
+{
+   test_ = "Dense vector addition";
+
+   const size_t sizes[] = { 0UL, 1UL, 3UL, 7UL, 15UL, 17UL, 31UL, 33UL, 63UL, 65UL, 127UL,
+                            1001UL };
+
+   for( size_t n : sizes )
+   {
+      blaze::DynamicVector<Type,blaze::columnVector> a( n ), b( n ), c( n ), ref( n );
+      initialize( a );
+      initialize( b );
+      initialize( c );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         ref[i] = a[i] + b[i];
+      }
+
+      c = a + b;
+      checkResult( c, ref, "c = a + b" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense matrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the dense matrix/dense vector multiplication (including the
+// addition, subtraction, and scaling variants) for a matrix with storage order \a SO and various
+// matrix sizes that are not multiples of the SIMD width. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type
+        , bool SO >      // Storage order of the matrix
+void OperationTest::testGemv()
+{
+   test_ = ( SO == blaze::rowMajor ) ? "Row-major dense matrix/dense vector multiplication"
+                                     : "Column-major dense matrix/dense vector multiplication";
+
+   const size_t sizes[][2] = { {  1UL,   1UL }, {   3UL,  5UL }, { 17UL,    9UL }, { 31UL, 33UL },
+                               { 65UL, 127UL }, { 130UL, 97UL }, {  7UL, 1001UL } };
+
+   for( const auto& size : sizes )
+   {
+      const size_t m( size[0] );
+      const size_t n( size[1] );
+
+      blaze::DynamicMatrix<Type,SO> A( m, n );
+      blaze::DynamicVector<Type,blaze::columnVector> x( n ), y( m ), y0( m ), ref( m );
+      initialize( A );
+      initialize( x );
+      initialize( y0 );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         Type sum( 0 );
+         for( size_t j=0UL; j<n; ++j ) {
+            sum += A(i,j) * x[j];
+         }
+         ref[i] = sum;
+      }
+
+      y = A * x;
+      checkResult( y, ref, "y = A * x" );
+
+      y = y0;
+      y += A * x;
+      checkResult( y, y0 + ref, "y += A * x" );
+
+      y = y0;
+      y -= A * x;
+      checkResult( y, y0 - ref, "y -= A * x" );
+
+      y = Type(2) * A * x;
+      checkResult( y, Type(2) * ref, "y = 2 * A * x" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the transpose dense vector/dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the transpose dense vector/dense matrix multiplication for
+// a matrix with storage order \a SO and various matrix sizes that are not multiples of the SIMD
+// width. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type
+        , bool SO >      // Storage order of the matrix
+void OperationTest::testTGemv()
+{
+   test_ = ( SO == blaze::rowMajor )
+           ? "Transpose dense vector/row-major dense matrix multiplication"
+           : "Transpose dense vector/column-major dense matrix multiplication";
+
+   const size_t sizes[][2] = { { 1UL, 1UL }, { 5UL, 3UL }, { 33UL, 31UL }, { 97UL, 130UL } };
+
+   for( const auto& size : sizes )
+   {
+      const size_t m( size[0] );
+      const size_t n( size[1] );
+
+      blaze::DynamicMatrix<Type,SO> A( m, n );
+      blaze::DynamicVector<Type,blaze::rowVector> x( m ), y( n ), ref( n );
+      initialize( A );
+      initialize( x );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         Type sum( 0 );
+         for( size_t i=0UL; i<m; ++i ) {
+            sum += x[i] * A(i,j);
+         }
+         ref[j] = sum;
+      }
+
+      y = x * A;
+      checkResult( y, ref, "y = x * A" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense matrix/dense matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the dense matrix/dense matrix multiplication (including the
+// addition, subtraction, and scaling variants) for the target storage order \a SO1 and the
+// operand storage orders \a SO2 and \a SO3. The matrix sizes are chosen such that they are not
+// multiples of the SIMD width or of the blocking factors of the kernels. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type
+        , bool SO1       // Storage order of the target matrix
+        , bool SO2       // Storage order of the left-hand side operand
+        , bool SO3 >     // Storage order of the right-hand side operand
+void OperationTest::testGemm()
+{
+   std::ostringstream label;
+   label << "Dense matrix/dense matrix multiplication ("
+         << ( SO1 ? 'c' : 'r' ) << " = " << ( SO2 ? 'c' : 'r' ) << " * " << ( SO3 ? 'c' : 'r' )
+         << ")";
+   test_ = label.str();
+
+   const size_t sizes[][3] = { {   1UL,   1UL,   1UL }, {   3UL,   5UL,   7UL },
+                               {  17UL,  13UL,  19UL }, {  33UL,  65UL,  31UL },
+                               {  67UL,  45UL, 129UL }, { 130UL,  97UL, 261UL },
+                               {   5UL, 301UL,   3UL } };
+
+   for( const auto& size : sizes )
+   {
+      const size_t m( size[0] );
+      const size_t n( size[1] );
+      const size_t k( size[2] );
+
+      blaze::DynamicMatrix<Type,SO2> A( m, k );
+      blaze::DynamicMatrix<Type,SO3> B( k, n );
+      blaze::DynamicMatrix<Type,SO1> C( m, n ), C0( m, n ), ref( m, n );
+      initialize( A );
+      initialize( B );
+      initialize( C0 );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            Type sum( 0 );
+            for( size_t l=0UL; l<k; ++l ) {
+               sum += A(i,l) * B(l,j);
+            }
+            ref(i,j) = sum;
+         }
+      }
+
+      C = A * B;
+      checkResult( C, ref, "C = A * B" );
+
+      C = C0;
+      C += A * B;
+      checkResult( C, C0 + ref, "C += A * B" );
+
+      C = C0;
+      C -= A * B;
+      checkResult( C, C0 - ref, "C -= A * B" );
+
+      C = Type(2) * A * B;
+      checkResult( C, Type(2) * ref, "C = 2 * A * B" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all kernel variants supported by the executing CPU.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function directly calls all runtime dispatched kernel variants supported by the executing
+// CPU (and not only the selected, fastest variant) and compares their results to the results of
+// the scalar reference implementation. In case the runtime dispatch mode is not active, this
+// test is skipped. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void OperationTest::testKernels()
+{
+#if BLAZE_RUNTIME_DISPATCH_MODE
+
+   const blaze::CPUFeatures host;
+
+   for( size_t variant=0UL; variant<3UL; ++variant )
+   {
+      blaze::CPUFeatures features( host );
+
+      if( variant == 0UL ) {
+         test_ = "SSE2 kernels";
+         features.avx2 = features.fma = features.avx512f = false;
+      }
+      else if( variant == 1UL ) {
+         test_ = "AVX2 kernels";
+         if( !host.avx2 || !host.fma ) continue;
+         features.avx512f = false;
+      }
+      else {
+         test_ = "AVX-512 kernels";
+         if( !host.avx512f || !host.avx2 || !host.fma ) continue;
+      }
+
+      using blaze::dispatch::selectKernels;
+      const blaze::dispatch::KernelSet<Type> kernels( selectKernels<Type>( features ) );
+
+      const size_t m( 37UL );
+      const size_t n( 29UL );
+      const size_t k( 43UL );
+
+      // Testing the vector addition kernel
+      {
+         blaze::DynamicVector<Type,blaze::columnVector> x( n ), y( n ), z( n );
+         initialize( x );
+         initialize( y );
+
+         kernels.add( n, x.data(), y.data(), z.data() );
+         checkResult( z, x + y, "add()" );
+      }
+
+      // Testing the matrix/vector multiplication kernel
+      {
+         blaze::DynamicMatrix<Type,blaze::rowMajor> A( m, n );
+         blaze::DynamicVector<Type,blaze::columnVector> x( n ), y( m ), y0( m ), ref( m );
+         initialize( A );
+         initialize( x );
+         initialize( y0 );
+
+         for( size_t i=0UL; i<m; ++i ) {
+            Type sum( 0 );
+            for( size_t j=0UL; j<n; ++j ) {
+               sum += A(i,j) * x[j];
+            }
+            ref[i] = Type(2)*sum - y0[i];
+         }
+
+         y = y0;
+         kernels.gemv( m, n, Type(2), A.data(), A.spacing(), x.data(), Type(-1), y.data() );
+         checkResult( y, ref, "gemv()" );
+      }
+
+      // Testing the matrix/matrix multiplication kernel with row- and column-major operands
+      {
+         blaze::DynamicMatrix<Type,blaze::rowMajor>    A( m, k );
+         blaze::DynamicMatrix<Type,blaze::columnMajor> B( k, n );
+         blaze::DynamicMatrix<Type,blaze::rowMajor>    C( m, n ), C0( m, n ), ref( m, n );
+         initialize( A );
+         initialize( B );
+         initialize( C0 );
+
+         for( size_t i=0UL; i<m; ++i ) {
+            for( size_t j=0UL; j<n; ++j ) {
+               Type sum( 0 );
+               for( size_t l=0UL; l<k; ++l ) {
+                  sum += A(i,l) * B(l,j);
+               }
+               ref(i,j) = Type(2)*sum + C0(i,j);
+            }
+         }
+
+         C = C0;
+         kernels.gemm( m, n, k, Type(2), A.data(), A.spacing(), 1UL, B.data(), 1UL, B.spacing(),
+                       Type(1), C.data(), C.spacing() );
+         checkResult( C, ref, "gemm()" );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of an operation.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \param operation The label of the performed operation.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the computed result
+        , typename VT2 >  // Type of the expected result
+void OperationTest::checkResult( const VT1& result, const VT2& expected,
+                                 const std::string& operation ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << operation << " failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_<VT1> ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializing the given dense vector with small integral values.
+//
+// \param v The dense vector to be initialized.
+// \return void
+*/
+template< typename Type  // Element type
+        , bool TF >      // Transpose flag
+void OperationTest::initialize( blaze::DynamicVector<Type,TF>& v ) const
+{
+   for( size_t i=0UL; i<v.size(); ++i ) {
+      v[i] = static_cast<Type>( blaze::rand<int>( -4, 4 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializing the given dense matrix with small integral values.
+//
+// \param A The dense matrix to be initialized.
+// \return void
+*/
+template< typename Type  // Element type
+        , bool SO >      // Storage order
+void OperationTest::initialize( blaze::DynamicMatrix<Type,SO>& A ) const
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         A(i,j) = static_cast<Type>( blaze::rand<int>( -4, 4 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime dispatched kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the runtime dispatch operation test.
+*/
+#define RUN_DISPATCH_OPERATION_TEST \
+   blazetest::mathtest::dispatch::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,425 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dynamictensor/ClassTest.h
+//  \brief Header file for the DynamicTensor class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DYNAMICTENSOR_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_DYNAMICTENSOR_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CustomTensor.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicTensor.h>
+#include <blaze/util/constraints/SameType.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dynamictensor {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the DynamicTensor class template.
+//
+// This class represents a test suite for the blaze::DynamicTensor and blaze::CustomTensor class
+// templates, the tensor slices and the batched tensor products. It performs a series of both
+// compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAddAssign   ();
+   void testSubAssign   ();
+   void testSchurAssign ();
+   void testScaling     ();
+   void testFunctionCall();
+   void testAt          ();
+   void testData        ();
+   void testNonZeros    ();
+   void testReset       ();
+   void testClear       ();
+   void testResize      ();
+   void testSwap        ();
+   void testMap         ();
+   void testPageSlice   ();
+   void testRowSlice    ();
+   void testColumnSlice ();
+   void testMult        ();
+   void testCustomTensor();
+
+   template< typename Type >
+   void checkPages( const Type& tensor, size_t expectedPages ) const;
+
+   template< typename Type >
+   void checkRows( const Type& tensor, size_t expectedRows ) const;
+
+   template< typename Type >
+   void checkColumns( const Type& tensor, size_t expectedColumns ) const;
+
+   template< typename Type >
+   void checkSpacing( const Type& tensor, size_t expectedSpacing ) const;
+
+   template< typename Type >
+   void checkCapacity( const Type& tensor, size_t minCapacity ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& tensor, size_t expectedNonZeros ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static size_t paddedColumns( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::DynamicTensor<int>     TT;   //!< Integral dense tensor type.
+   typedef blaze::DynamicTensor<double>  DTT;  //!< Double precision dense tensor type.
+
+   typedef blaze::CustomTensor<int,blaze::unaligned,blaze::unpadded>  UTT;  //!< Unaligned tensor.
+   typedef blaze::CustomTensor<int,blaze::aligned,blaze::padded>      ATT;  //!< Aligned tensor.
+
+   typedef blaze::DynamicMatrix<int,blaze::rowMajor>     DRMT;  //!< Row-major dense matrix.
+   typedef blaze::DynamicMatrix<int,blaze::columnMajor>  DCMT;  //!< Column-major dense matrix.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( TT::ResultType , TT  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( DTT::ResultType, DTT );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UTT::ResultType, TT  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ATT::ResultType, TT  );
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( TT::ElementType , int    );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( DTT::ElementType, double );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UTT::ElementType, int    );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( ATT::ElementType, int    );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of pages of the given dense tensor.
+//
+// \param tensor The dense tensor to be checked.
+// \param expectedPages The expected number of pages of the dense tensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of pages of the given dense tensor. In case the actual number
+// of pages does not correspond to the given expected number of pages, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the dense tensor
+void ClassTest::checkPages( const Type& tensor, size_t expectedPages ) const
+{
+   if( tensor.pages() != expectedPages ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of pages detected\n"
+          << " Details:\n"
+          << "   Number of pages         : " << tensor.pages() << "\n"
+          << "   Expected number of pages: " << expectedPages << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given dense tensor.
+//
+// \param tensor The dense tensor to be checked.
+// \param expectedRows The expected number of rows of the dense tensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of rows of the given dense tensor. In case the actual number
+// of rows does not correspond to the given expected number of rows, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the dense tensor
+void ClassTest::checkRows( const Type& tensor, size_t expectedRows ) const
+{
+   if( tensor.rows() != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << tensor.rows() << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given dense tensor.
+//
+// \param tensor The dense tensor to be checked.
+// \param expectedColumns The expected number of columns of the dense tensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of columns of the given dense tensor. In case the actual
+// number of columns does not correspond to the given expected number of columns, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the dense tensor
+void ClassTest::checkColumns( const Type& tensor, size_t expectedColumns ) const
+{
+   if( tensor.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << tensor.columns() << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the row and page spacing of the given dense tensor.
+//
+// \param tensor The dense tensor to be checked.
+// \param expectedSpacing The expected distance between two rows of the dense tensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the storage layout of the given dense tensor: the distance between two
+// rows has to correspond to the given expected spacing, the distance between two pages has to
+// be \a rows() times the row spacing, and all padding elements have to be zero. In case any of
+// these invariants is violated, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the dense tensor
+void ClassTest::checkSpacing( const Type& tensor, size_t expectedSpacing ) const
+{
+   if( tensor.spacing() != expectedSpacing ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid spacing detected\n"
+          << " Details:\n"
+          << "   Spacing         : " << tensor.spacing() << "\n"
+          << "   Expected spacing: " << expectedSpacing << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( tensor.pageSpacing() != tensor.rows() * expectedSpacing ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid page spacing detected\n"
+          << " Details:\n"
+          << "   Page spacing         : " << tensor.pageSpacing() << "\n"
+          << "   Expected page spacing: " << tensor.rows() * expectedSpacing << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( !isIntact( tensor ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invariant violation detected\n"
+          << " Details:\n"
+          << "   Padding elements are not zero\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the capacity of the given dense tensor.
+//
+// \param tensor The dense tensor to be checked.
+// \param minCapacity The expected minimum capacity of the dense tensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the capacity of the given dense tensor. In case the actual capacity
+// is smaller than the given expected minimum capacity, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >  // Type of the dense tensor
+void ClassTest::checkCapacity( const Type& tensor, size_t minCapacity ) const
+{
+   if( tensor.capacity() < minCapacity ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Capacity                 : " << tensor.capacity() << "\n"
+          << "   Expected minimum capacity: " << minCapacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given dense tensor.
+//
+// \param tensor The dense tensor to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the dense tensor.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements of the given dense tensor. In case the
+// actual number of non-zero elements does not correspond to the given expected number, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the dense tensor
+void ClassTest::checkNonZeros( const Type& tensor, size_t expectedNonZeros ) const
+{
+   if( tensor.nonZeros() != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << tensor.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the alignment adjusted number of columns of an integral tensor.
+//
+// \param n The number of columns.
+// \return The expected row spacing of an integral DynamicTensor with \a n columns.
+*/
+inline size_t ClassTest::paddedColumns( size_t n )
+{
+   return ( blaze::usePadding ? blaze::nextMultiple<size_t>( n, blaze::SIMDTrait<int>::size ) : n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the DynamicTensor class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the DynamicTensor class test.
+*/
+#define RUN_DYNAMICTENSOR_CLASS_TEST \
+   blazetest::mathtest::dynamictensor::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dynamictensor
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
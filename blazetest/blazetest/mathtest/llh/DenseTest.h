@@ -47,6 +47,8 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Random.h>
 #include <blazetest/system/LAPACK.h>
@@ -92,6 +94,9 @@ class DenseTest
    template< typename Type >
    void testRandom();
 
+   template< typename Type >
+   void testNonPositiveDefiniteMatrix();
+
    void testGeneral();
    void testSymmetric();
    void testHermitian();
@@ -100,6 +105,7 @@ class DenseTest
    void testUpper();
    void testUniUpper();
    void testDiagonal();
+   void testNonPositiveDefinite();
    //@}
    //**********************************************************************************************
 
@@ -138,7 +144,7 @@ class DenseTest
 template< typename Type >
 void DenseTest::testRandom()
 {
-#if BLAZETEST_MATHTEST_LAPACK_MODE
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
 
    test_ = "LLH decomposition";
 
@@ -176,6 +182,76 @@ void DenseTest::testRandom()
 
 
 
+//*************************************************************************************************
+/*!\brief Test of the LLH decomposition with non-positive-definite matrices of the given type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the dense matrix LLH decomposition rejects matrices that are not
+// positive definite, i.e. a zero matrix, a matrix with a zero diagonal element, and a matrix
+// with a negative diagonal element in the last column. The matrix sizes are chosen such that
+// both the unblocked and the blocked factorization are exercised. In case a non-positive-definite
+// matrix is accepted, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseTest::testNonPositiveDefiniteMatrix()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
+
+   test_ = "LLH decomposition of non-positive-definite matrices";
+
+   using ET = blaze::ElementType_<Type>;
+
+   const size_t sizes[] = { 5UL, 2UL*blaze::DECOMPOSITION_BLOCK_SIZE + 3UL };
+
+   for( size_t n : sizes )
+   {
+      for( size_t variant=0UL; variant<3UL; ++variant )
+      {
+         Type A( n, n );
+
+         if( variant == 0UL ) {
+            reset( A );
+         }
+         else if( variant == 1UL ) {
+            makePositiveDefinite( A );
+            A(n/2UL,n/2UL) = ET( 0 );
+         }
+         else {
+            makePositiveDefinite( A );
+            A(n-1UL,n-1UL) = ET( -1 );
+         }
+
+         blaze::LowerMatrix<Type> L;
+
+         try {
+            blaze::llh( A, L );
+         }
+         catch( std::runtime_error& ) {
+            continue;
+         }
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of a non-positive-definite matrix succeeded\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( Type ).name() << "\n"
+             << "   Size: " << n << "x" << n << "\n"
+             << "   Variant: " << ( variant == 0UL ? "zero matrix" :
+                                     variant == 1UL ? "zero diagonal element" :
+                                                      "negative diagonal element" ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+
 //=================================================================================================
 //
 //  GLOBAL TEST FUNCTIONS
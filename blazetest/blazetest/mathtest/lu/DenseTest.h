@@ -40,14 +40,19 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/shims/Abs.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Random.h>
 #include <blazetest/system/LAPACK.h>
@@ -93,6 +98,9 @@ class DenseTest
    template< typename Type >
    void testRandom();
 
+   template< typename Type >
+   void testSingularMatrix();
+
    void testGeneral();
    void testSymmetric();
    void testHermitian();
@@ -101,6 +109,18 @@ class DenseTest
    void testUpper();
    void testUniUpper();
    void testDiagonal();
+   void testSingular();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT1, typename MT2 >
+   double relativeError( const MT1& A, const MT2& B ) const;
+
+   template< typename MT >
+   bool isFinite( const MT& A ) const;
    //@}
    //**********************************************************************************************
 
@@ -139,7 +159,7 @@ class DenseTest
 template< typename Type >
 void DenseTest::testRandom()
 {
-#if BLAZETEST_MATHTEST_LAPACK_MODE
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
 
    test_ = "LU decomposition";
 
@@ -186,6 +206,143 @@ void DenseTest::testRandom()
 
 
 
+//*************************************************************************************************
+/*!\brief Test of the LU decomposition with singular and nearly singular matrices of the given type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dense matrix LU decomposition for rank deficient matrices (including
+// a matrix with a zero column, which results in a zero pivot) and for nearly singular matrices.
+// The matrix sizes are chosen such that both the unblocked and the blocked factorization are
+// exercised. The decomposition must neither fail nor produce non-finite values, and the factors
+// must reproduce the original matrix. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void DenseTest::testSingularMatrix()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
+
+   test_ = "LU decomposition of singular matrices";
+
+   using ET = blaze::ElementType_<Type>;
+
+   const size_t sizes[] = { 5UL, 2UL*blaze::DECOMPOSITION_BLOCK_SIZE + 3UL };
+
+   for( size_t n : sizes )
+   {
+      for( size_t variant=0UL; variant<3UL; ++variant )
+      {
+         Type X( n, n/2UL ), Y( n/2UL, n ), L, U, P;
+         randomize( X );
+         randomize( Y );
+
+         Type A( X * Y );
+
+         if( variant == 1UL ) {
+            for( size_t i=0UL; i<n; ++i ) {
+               A(i,0UL) = ET( 0 );
+            }
+         }
+         else if( variant == 2UL ) {
+            for( size_t i=0UL; i<n; ++i ) {
+               A(i,i) += ET( 1E-12 );
+            }
+         }
+
+         blaze::lu( A, L, U, P );
+
+         Type LU( L*U );
+
+         if( blaze::IsRowMajorMatrix<Type>::value ) {
+            LU = LU * P;
+         }
+         else {
+            LU = P * LU;
+         }
+
+         if( !isFinite( L ) || !isFinite( U ) || relativeError( LU, A ) > 1E-10 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: LU decomposition failed\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Size: " << n << "x" << n << "\n"
+                << "   Variant: " << ( variant == 0UL ? "rank deficient" :
+                                       variant == 1UL ? "zero column" : "nearly singular" ) << "\n"
+                << "   Relative error: " << relativeError( LU, A ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the maximum absolute deviation between two matrices relative to the second.
+//
+// \param A The computed matrix.
+// \param B The reference matrix.
+// \return The maximum absolute deviation relative to the largest absolute element of \a B.
+*/
+template< typename MT1    // Type of the computed matrix
+        , typename MT2 >  // Type of the reference matrix
+double DenseTest::relativeError( const MT1& A, const MT2& B ) const
+{
+   double error( 0.0 );
+   double scale( 1.0 );
+
+   for( size_t i=0UL; i<B.rows(); ++i ) {
+      for( size_t j=0UL; j<B.columns(); ++j ) {
+         error = std::max<double>( error, blaze::abs( A(i,j) - B(i,j) ) );
+         scale = std::max<double>( scale, blaze::abs( B(i,j) ) );
+      }
+   }
+
+   return error / scale;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether all elements of the given matrix are finite.
+//
+// \param A The matrix to be checked.
+// \return \a true in case all elements are finite, \a false if not.
+*/
+template< typename MT >  // Type of the matrix
+bool DenseTest::isFinite( const MT& A ) const
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( !std::isfinite( blaze::abs( A(i,j) ) ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
 //=================================================================================================
 //
 //  GLOBAL TEST FUNCTIONS
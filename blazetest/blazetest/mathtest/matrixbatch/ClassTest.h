@@ -0,0 +1,314 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrixbatch/ClassTest.h
+//  \brief Header file for the MatrixBatch class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRIXBATCH_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_MATRIXBATCH_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/MatrixBatch.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/StaticAssert.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixbatch {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the MatrixBatch class template.
+//
+// This class represents a test suite for the blaze::MatrixBatch class template and the batched
+// multiplication, inversion, determinant and solver kernels. It performs a series of both
+// compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testFunctionCall();
+   void testAt          ();
+   void testData        ();
+   void testGetSet      ();
+   void testReset       ();
+   void testClear       ();
+   void testResize      ();
+   void testSwap        ();
+   void testMult        ();
+   void testInvert      ();
+   void testDet         ();
+   void testSolve       ();
+
+   template< typename Type >
+   void checkSize( const Type& batch, size_t expectedSize ) const;
+
+   template< typename Type >
+   void checkGroups( const Type& batch, size_t expectedGroups ) const;
+
+   template< typename Type >
+   void checkPadding( const Type& batch ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static double scale( size_t k );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex type.
+
+   typedef blaze::MatrixBatch<int,2UL,3UL>   BT;  //!< Integral batch of 2x3 matrices.
+   typedef blaze::StaticMatrix<int,2UL,3UL>  MT;  //!< Single integral 2x3 matrix.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( BT::MatrixType , MT  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( BT::ElementType, int );
+
+   BLAZE_STATIC_ASSERT( static_cast<size_t>( BT::lanes ) == blaze::SIMDTrait<int>::size );
+   BLAZE_STATIC_ASSERT( BT::groupSize == 6UL*BT::lanes );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of matrices of the given matrix batch.
+//
+// \param batch The matrix batch to be checked.
+// \param expectedSize The expected number of matrices of the matrix batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of matrices of the given matrix batch. In case the actual
+// number of matrices does not correspond to the given expected number of matrices, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix batch
+void ClassTest::checkSize( const Type& batch, size_t expectedSize ) const
+{
+   if( batch.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of matrices detected\n"
+          << " Details:\n"
+          << "   Number of matrices         : " << batch.size() << "\n"
+          << "   Expected number of matrices: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of lane groups of the given matrix batch.
+//
+// \param batch The matrix batch to be checked.
+// \param expectedGroups The expected number of lane groups of the matrix batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of lane groups of the given matrix batch. In case the actual
+// number of lane groups does not correspond to the given expected number of lane groups, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix batch
+void ClassTest::checkGroups( const Type& batch, size_t expectedGroups ) const
+{
+   if( batch.groups() != expectedGroups ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of lane groups detected\n"
+          << " Details:\n"
+          << "   Number of lane groups         : " << batch.groups() << "\n"
+          << "   Expected number of lane groups: " << expectedGroups << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the padding lanes of the given matrix batch.
+//
+// \param batch The matrix batch to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that all lanes of the last lane group beyond the last matrix of the
+// given matrix batch are zero. In case any padding element is not zero, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the matrix batch
+void ClassTest::checkPadding( const Type& batch ) const
+{
+   typedef typename Type::ElementType  ET;
+
+   if( batch.groups() == 0UL )
+      return;
+
+   const size_t last( batch.groups() - 1UL );
+   const size_t elements( Type::groupSize / Type::lanes );
+
+   for( size_t l=batch.size()-last*Type::lanes; l<Type::lanes; ++l ) {
+      for( size_t e=0UL; e<elements; ++e ) {
+         if( batch.data( last )[e*Type::lanes+l] != ET() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invariant violation detected\n"
+                << " Details:\n"
+                << "   Padding lane " << l << " of lane group " << last << " is not zero\n"
+                << "   Element " << e << ": " << batch.data( last )[e*Type::lanes+l] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the scaling factor of the \a k-th matrix of a test batch.
+//
+// \param k The index of the matrix within the batch.
+// \return The scaling factor \f$ 2^{k\%3} \f$.
+//
+// The power-of-two scaling factors vary the matrices across the lanes of a lane group without
+// introducing any rounding errors into the expected results.
+*/
+inline double ClassTest::scale( size_t k )
+{
+   return static_cast<double>( 1UL << ( k % 3UL ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the MatrixBatch class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the MatrixBatch class test.
+*/
+#define RUN_MATRIXBATCH_CLASS_TEST \
+   blazetest::mathtest::matrixbatch::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace matrixbatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
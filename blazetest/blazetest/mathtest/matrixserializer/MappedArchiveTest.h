@@ -0,0 +1,247 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/matrixserializer/MappedArchiveTest.h
+//  \brief Header file for the MappedArchive class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MATRIXSERIALIZER_MAPPEDARCHIVETEST_H_
+#define _BLAZETEST_MATHTEST_MATRIXSERIALIZER_MAPPEDARCHIVETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CustomCompressedMatrix.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/CustomVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/serialization/MappedArchive.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixserializer {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the MappedArchive class.
+//
+// This class represents a test suite for the blaze::MappedArchive and blaze::MappedArchiveWriter
+// classes. It writes dense vectors, dense matrices and sparse matrices to a file, maps the file
+// into memory and compares the zero-copy views with the original vectors and matrices.
+*/
+class MappedArchiveTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit MappedArchiveTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   ~MappedArchiveTest();
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDenseVectors  ();
+   void testDenseMatrices ();
+   void testSparseMatrices();
+   void testOperations    ();
+   void testFailures      ();
+
+   template< typename T >
+   void checkAlignment( const T* ptr );
+
+   template< typename VT1, typename VT2 >
+   void compareVectors( const VT1& src, const VT2& dst );
+
+   template< typename MT1, typename MT2 >
+   void compareMatrices( const MT1& src, const MT2& dst );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   std::string file_;  //!< Name of the temporary archive file.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the alignment of the given mapped array.
+//
+// \param ptr The first element of the mapped array.
+// \return void
+// \exception std::runtime_error Alignment error detected.
+*/
+template< typename T >  // Type of the array elements
+void MappedArchiveTest::checkAlignment( const T* ptr )
+{
+   if( reinterpret_cast<size_t>( ptr ) % 64UL != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid alignment of mapped data\n"
+          << " Details:\n"
+          << "   Address: " << static_cast<const void*>( ptr ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparing the original and the mapped vector.
+//
+// \param src The original vector.
+// \param dst The mapped vector.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the original vector
+        , typename VT2 >  // Type of the mapped vector
+void MappedArchiveTest::compareVectors( const VT1& src, const VT2& dst )
+{
+   if( src != dst ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapped vector does not match\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Mapped:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Comparing the original and the mapped matrix.
+//
+// \param src The original matrix.
+// \param dst The mapped matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT1    // Type of the original matrix
+        , typename MT2 >  // Type of the mapped matrix
+void MappedArchiveTest::compareMatrices( const MT1& src, const MT2& dst )
+{
+   if( src.rows() != dst.rows() || src.columns() != dst.columns() ||
+       blaze::nonZeros( src ) != blaze::nonZeros( dst ) || src != dst ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapped matrix does not match\n"
+          << " Details:\n"
+          << "   Source:\n" << src << "\n"
+          << "   Mapped:\n" << dst << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the MappedArchive class.
+//
+// \return void
+*/
+void runTest()
+{
+   MappedArchiveTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the MappedArchive class test.
+*/
+#define RUN_MAPPEDARCHIVE_CLASS_TEST \
+   blazetest::mathtest::matrixserializer::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace matrixserializer
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
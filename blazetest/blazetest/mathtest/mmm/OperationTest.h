@@ -0,0 +1,568 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/mmm/OperationTest.h
+//  \brief Header file for the dense matrix multiplication kernel test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_MMM_OPERATIONTEST_H_
+#define _BLAZETEST_MATHTEST_MMM_OPERATIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/dense/MMM.h>
+#include <blaze/math/dense/PackedMMM.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mmm {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the dense matrix multiplication kernels.
+//
+// This class represents a test suite for the mmm(), lmmm(), and ummm() dense matrix/dense matrix
+// multiplication kernels, which are computed by the packed kernels (see packedGemm()) for single
+// and double precision operands. The matrix sizes are derived from the register tile and cache
+// blocking factors of the packed kernels such that all full and partial tiles and blocks are
+// exercised. All operands are initialized with small integral values such that all results are
+// exactly representable and can be compared to a scalar reference implementation.
+*/
+class OperationTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OperationTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type, bool SO1, bool SO2, bool SO3 > void testMmm();
+   template< typename Type, bool SO1, bool SO2, bool SO3 > void testLmmm();
+   template< typename Type, bool SO1, bool SO2, bool SO3 > void testUmmm();
+   template< typename Type, bool SO1, bool SO2, bool SO3 > void testTriangular();
+
+   template< typename MT1, typename MT2 >
+   void checkResult( const MT1& result, const MT2& expected, size_t uplo,
+                     double alpha, double beta ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type > std::vector< std::array<size_t,3UL> > sizes() const;
+
+   template< typename MT > void initialize( MT& A, size_t uplo = 0UL ) const;
+
+   template< typename MT1, typename MT2, typename MT3, typename ST >
+   void reference( MT1& C, const MT2& A, const MT3& B, ST alpha, ST beta ) const;
+
+   template< bool SO1, bool SO2, bool SO3 > void label( const std::string& kernel );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the general dense matrix multiplication kernel (mmm()).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the mmm() kernel for the target storage order \a SO1 and the
+// operand storage orders \a SO2 and \a SO3 for several combinations of the scaling factors. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type
+        , bool SO1       // Storage order of the target matrix
+        , bool SO2       // Storage order of the left-hand side operand
+        , bool SO3 >     // Storage order of the right-hand side operand
+void OperationTest::testMmm()
+{
+   label<SO1,SO2,SO3>( "mmm()" );
+
+   const Type factors[][2] = { { 1, 0 }, { 1, 1 }, { -1, 1 }, { 2, 0 }, { 2, -3 } };
+
+   for( const auto& size : sizes<Type>() )
+   {
+      blaze::DynamicMatrix<Type,SO2> A( size[0], size[2] );
+      blaze::DynamicMatrix<Type,SO3> B( size[2], size[1] );
+      blaze::DynamicMatrix<Type,SO1> C0( size[0], size[1] );
+      initialize( A );
+      initialize( B );
+      initialize( C0 );
+
+      for( const auto& factor : factors )
+      {
+         blaze::DynamicMatrix<Type,SO1> C( C0 ), ref( C0 );
+
+         blaze::mmm( C, A, B, factor[0], factor[1] );
+         reference( ref, A, B, factor[0], factor[1] );
+
+         checkResult( C, ref, 0UL, factor[0], factor[1] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the lower dense matrix multiplication kernel (lmmm()).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the lmmm() kernel, which only computes the lower part of
+// the target matrix, for the target storage order \a SO1 and the operand storage orders \a SO2
+// and \a SO3. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type
+        , bool SO1       // Storage order of the target matrix
+        , bool SO2       // Storage order of the left-hand side operand
+        , bool SO3 >     // Storage order of the right-hand side operand
+void OperationTest::testLmmm()
+{
+   label<SO1,SO2,SO3>( "lmmm()" );
+
+   const Type factors[][2] = { { 1, 0 }, { 1, 1 }, { -1, 1 }, { 2, -3 } };
+
+   for( const auto& size : sizes<Type>() )
+   {
+      const size_t n( size[0] );
+
+      blaze::DynamicMatrix<Type,SO2> A( n, size[2] );
+      blaze::DynamicMatrix<Type,SO3> B( size[2], n );
+      blaze::DynamicMatrix<Type,SO1> C0( n, n );
+      initialize( A );
+      initialize( B );
+      initialize( C0 );
+
+      for( const auto& factor : factors )
+      {
+         blaze::DynamicMatrix<Type,SO1> C( C0 ), ref( C0 );
+
+         blaze::lmmm( C, A, B, factor[0], factor[1] );
+         reference( ref, A, B, factor[0], factor[1] );
+
+         checkResult( C, ref, 1UL, factor[0], factor[1] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the upper dense matrix multiplication kernel (ummm()).
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the ummm() kernel, which only computes the upper part of
+// the target matrix, for the target storage order \a SO1 and the operand storage orders \a SO2
+// and \a SO3. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type
+        , bool SO1       // Storage order of the target matrix
+        , bool SO2       // Storage order of the left-hand side operand
+        , bool SO3 >     // Storage order of the right-hand side operand
+void OperationTest::testUmmm()
+{
+   label<SO1,SO2,SO3>( "ummm()" );
+
+   const Type factors[][2] = { { 1, 0 }, { 1, 1 }, { -1, 1 }, { 2, -3 } };
+
+   for( const auto& size : sizes<Type>() )
+   {
+      const size_t n( size[0] );
+
+      blaze::DynamicMatrix<Type,SO2> A( n, size[2] );
+      blaze::DynamicMatrix<Type,SO3> B( size[2], n );
+      blaze::DynamicMatrix<Type,SO1> C0( n, n );
+      initialize( A );
+      initialize( B );
+      initialize( C0 );
+
+      for( const auto& factor : factors )
+      {
+         blaze::DynamicMatrix<Type,SO1> C( C0 ), ref( C0 );
+
+         blaze::ummm( C, A, B, factor[0], factor[1] );
+         reference( ref, A, B, factor[0], factor[1] );
+
+         checkResult( C, ref, 2UL, factor[0], factor[1] );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dense matrix multiplication kernels for triangular operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the mmm(), lmmm(), and ummm() kernels for lower and upper
+// triangular operands, for which the packed kernels skip all blocks, tiles, and ranges of the
+// inner dimension that only contribute zeros. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type
+        , bool SO1       // Storage order of the target matrix
+        , bool SO2       // Storage order of the left-hand side operand
+        , bool SO3 >     // Storage order of the right-hand side operand
+void OperationTest::testTriangular()
+{
+   label<SO1,SO2,SO3>( "Triangular operands" );
+
+   using LT2 = blaze::LowerMatrix< blaze::DynamicMatrix<Type,SO2> >;
+   using LT3 = blaze::LowerMatrix< blaze::DynamicMatrix<Type,SO3> >;
+   using UT2 = blaze::UpperMatrix< blaze::DynamicMatrix<Type,SO2> >;
+   using UT3 = blaze::UpperMatrix< blaze::DynamicMatrix<Type,SO3> >;
+
+   for( const auto& size : sizes<Type>() )
+   {
+      const size_t n( size[0] );
+
+      LT2 LA( n );
+      LT3 LB( n );
+      UT2 UA( n );
+      UT3 UB( n );
+      blaze::DynamicMatrix<Type,SO2> A( n, n );
+      blaze::DynamicMatrix<Type,SO3> B( n, n );
+      blaze::DynamicMatrix<Type,SO1> C0( n, n );
+      initialize( LA, 1UL );
+      initialize( LB, 1UL );
+      initialize( UA, 2UL );
+      initialize( UB, 2UL );
+      initialize( A );
+      initialize( B );
+      initialize( C0 );
+
+      // Lower times lower
+      {
+         blaze::DynamicMatrix<Type,SO1> C( C0 ), ref( C0 );
+         blaze::lmmm( C, LA, LB, Type(2), Type(1) );
+         reference( ref, LA, LB, Type(2), Type(1) );
+         checkResult( C, ref, 1UL, 2.0, 1.0 );
+      }
+
+      // Upper times upper
+      {
+         blaze::DynamicMatrix<Type,SO1> C( C0 ), ref( C0 );
+         blaze::ummm( C, UA, UB, Type(2), Type(1) );
+         reference( ref, UA, UB, Type(2), Type(1) );
+         checkResult( C, ref, 2UL, 2.0, 1.0 );
+      }
+
+      // Lower times upper
+      {
+         blaze::DynamicMatrix<Type,SO1> C( C0 ), ref( C0 );
+         blaze::mmm( C, LA, UB, Type(1), Type(0) );
+         reference( ref, LA, UB, Type(1), Type(0) );
+         checkResult( C, ref, 0UL, 1.0, 0.0 );
+      }
+
+      // Upper times lower
+      {
+         blaze::DynamicMatrix<Type,SO1> C( C0 ), ref( C0 );
+         blaze::mmm( C, UA, LB, Type(-1), Type(1) );
+         reference( ref, UA, LB, Type(-1), Type(1) );
+         checkResult( C, ref, 0UL, -1.0, 1.0 );
+      }
+
+      // General times lower
+      {
+         blaze::DynamicMatrix<Type,SO1> C( C0 ), ref( C0 );
+         blaze::mmm( C, A, LB, Type(1), Type(1) );
+         reference( ref, A, LB, Type(1), Type(1) );
+         checkResult( C, ref, 0UL, 1.0, 1.0 );
+      }
+
+      // Upper times general
+      {
+         blaze::DynamicMatrix<Type,SO1> C( C0 ), ref( C0 );
+         blaze::mmm( C, UA, B, Type(1), Type(1) );
+         reference( ref, UA, B, Type(1), Type(1) );
+         checkResult( C, ref, 0UL, 1.0, 1.0 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a dense matrix multiplication kernel.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \param uplo The restriction of the result (0: none, 1: lower, 2: upper).
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// In case \a uplo is 1 or 2, only the lower or upper part of the result is checked, respectively.
+*/
+template< typename MT1    // Type of the computed result
+        , typename MT2 >  // Type of the expected result
+void OperationTest::checkResult( const MT1& result, const MT2& expected, size_t uplo,
+                                 double alpha, double beta ) const
+{
+   for( size_t i=0UL; i<result.rows(); ++i ) {
+      for( size_t j=0UL; j<result.columns(); ++j )
+      {
+         if( ( uplo == 1UL && j > i ) || ( uplo == 2UL && j < i ) )
+            continue;
+
+         if( result(i,j) != expected(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( blaze::ElementType_<MT1> ).name() << "\n"
+                << "   Size: " << result.rows() << "x" << result.columns() << "\n"
+                << "   alpha = " << alpha << ", beta = " << beta << "\n"
+                << "   Element (" << i << "," << j << "): " << result(i,j)
+                << " (expected: " << expected(i,j) << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the test sizes for the given element type.
+//
+// \return The test sizes (number of rows, number of columns, and inner dimension).
+//
+// The sizes are derived from the register tile (\a MR x \a NR) and the cache blocking factors
+// (\a KC, \a MC, and \a NC) of the packed kernels such that full and partial register tiles,
+// several cache blocks, and partial cache blocks in all three dimensions are covered.
+*/
+template< typename Type >  // Element type
+std::vector< std::array<size_t,3UL> > OperationTest::sizes() const
+{
+   using Traits = blaze::PackedMMMTraits<Type>;
+
+   constexpr size_t MR( Traits::MR );
+   constexpr size_t NR( Traits::NR );
+   constexpr size_t KC( Traits::KC );
+   constexpr size_t MC( Traits::MC );
+   constexpr size_t NC( Traits::NC );
+
+   return { { 1UL, 1UL, 1UL },
+            { MR-1UL, NR+1UL, 3UL },
+            { MR, NR, KC },
+            { 2UL*MR+1UL, 3UL*NR-1UL, KC+5UL },
+            { MC+MR+1UL, NR+3UL, 2UL*KC+1UL },
+            { MC+3UL, 2UL*NR+5UL, KC-1UL },
+            { 3UL, NC+NR+1UL, 5UL } };
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializing the given dense matrix with small integral values.
+//
+// \param A The dense matrix to be initialized.
+// \param uplo The shape of the matrix (0: general, 1: lower, 2: upper).
+// \return void
+*/
+template< typename MT >  // Type of the dense matrix
+void OperationTest::initialize( MT& A, size_t uplo ) const
+{
+   using ET = blaze::ElementType_<MT>;
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( ( uplo != 1UL || j <= i ) && ( uplo != 2UL || j >= i ) )
+            A(i,j) = static_cast<ET>( blaze::rand<int>( -4, 4 ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scalar reference implementation of \f$ C=\alpha*A*B+\beta*C \f$.
+//
+// \param C The target dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+*/
+template< typename MT1   // Type of the target matrix
+        , typename MT2   // Type of the left-hand side operand
+        , typename MT3   // Type of the right-hand side operand
+        , typename ST >  // Type of the scaling factors
+void OperationTest::reference( MT1& C, const MT2& A, const MT3& B, ST alpha, ST beta ) const
+{
+   using ET = blaze::ElementType_<MT1>;
+
+   for( size_t i=0UL; i<C.rows(); ++i ) {
+      for( size_t j=0UL; j<C.columns(); ++j )
+      {
+         ET sum( 0 );
+         for( size_t l=0UL; l<A.columns(); ++l ) {
+            sum += A(i,l) * B(l,j);
+         }
+         C(i,j) = alpha * sum + beta * C(i,j);
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the label of the current test.
+//
+// \param kernel The name of the tested kernel.
+// \return void
+*/
+template< bool SO1    // Storage order of the target matrix
+        , bool SO2    // Storage order of the left-hand side operand
+        , bool SO3 >  // Storage order of the right-hand side operand
+void OperationTest::label( const std::string& kernel )
+{
+   std::ostringstream oss;
+   oss << kernel << " (" << ( SO1 ? 'c' : 'r' ) << " = "
+       << ( SO2 ? 'c' : 'r' ) << " * " << ( SO3 ? 'c' : 'r' ) << ")";
+   test_ = oss.str();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the dense matrix multiplication kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   OperationTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense matrix multiplication kernel test.
+*/
+#define RUN_MMM_OPERATION_TEST \
+   blazetest::mathtest::mmm::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace mmm
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,388 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/packedmatrix/ClassTest.h
+//  \brief Header file for the PackedMatrix class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_PACKEDMATRIX_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_PACKEDMATRIX_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/constraints/ColumnMajorMatrix.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/PackedMatrix.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/constraints/SameType.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the PackedMatrix class template.
+//
+// This class represents a test suite for the blaze::PackedMatrix class template. It performs
+// a series of both compile time as well as runtime tests.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAssignment  ();
+   void testAddAssign   ();
+   void testSubAssign   ();
+   void testFunctionCall();
+   void testAt          ();
+   void testIterator    ();
+   void testNonZeros    ();
+   void testIndex       ();
+   void testReset       ();
+   void testClear       ();
+   void testSwap        ();
+   void testIsDefault   ();
+   void testMult        ();
+   void testSolve       ();
+
+   template< typename Type >
+   void checkRows( const Type& matrix, size_t expectedRows ) const;
+
+   template< typename Type >
+   void checkColumns( const Type& matrix, size_t expectedColumns ) const;
+
+   template< typename Type >
+   void checkCapacity( const Type& matrix, size_t expectedCapacity ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const;
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cplx;  //!< Complex element type.
+
+   typedef blaze::DynamicMatrix<int,blaze::rowMajor>        RMT;   //!< Row-major matrix type.
+   typedef blaze::DynamicMatrix<int,blaze::columnMajor>     CMT;   //!< Column-major matrix type.
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>     DRMT;  //!< Row-major double matrix.
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>  DCMT;  //!< Column-major double matrix.
+   typedef blaze::DynamicMatrix<cplx,blaze::rowMajor>       CRMT;  //!< Row-major complex matrix.
+   typedef blaze::DynamicMatrix<cplx,blaze::columnMajor>    CCMT;  //!< Column-major complex matrix.
+
+   typedef blaze::PackedMatrix< blaze::SymmetricMatrix<RMT> >   SMT;   //!< Packed symmetric type.
+   typedef blaze::PackedMatrix< blaze::SymmetricMatrix<CMT> >   OSMT;  //!< Opposite symmetric type.
+   typedef blaze::PackedMatrix< blaze::HermitianMatrix<CRMT> >  HMT;   //!< Packed Hermitian type.
+   typedef blaze::PackedMatrix< blaze::HermitianMatrix<CCMT> >  OHMT;  //!< Opposite Hermitian type.
+   typedef blaze::PackedMatrix< blaze::LowerMatrix<RMT> >       LMT;   //!< Packed lower type.
+   typedef blaze::PackedMatrix< blaze::LowerMatrix<CMT> >       OLMT;  //!< Opposite lower type.
+   typedef blaze::PackedMatrix< blaze::UpperMatrix<RMT> >       UMT;   //!< Packed upper type.
+   typedef blaze::PackedMatrix< blaze::UpperMatrix<CMT> >       OUMT;  //!< Opposite upper type.
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( SMT  );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OSMT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( HMT  );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OHMT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( LMT  );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OLMT );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( UMT  );
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( OUMT );
+
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( SMT  );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( OSMT );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( HMT  );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( OHMT );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( LMT  );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( OLMT );
+   BLAZE_CONSTRAINT_MUST_BE_ROW_MAJOR_MATRIX_TYPE   ( UMT  );
+   BLAZE_CONSTRAINT_MUST_BE_COLUMN_MAJOR_MATRIX_TYPE( OUMT );
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( SMT::ResultType,  blaze::SymmetricMatrix<RMT>  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( OSMT::ResultType, blaze::SymmetricMatrix<CMT>  );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( HMT::ResultType,  blaze::HermitianMatrix<CRMT> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( OHMT::ResultType, blaze::HermitianMatrix<CCMT> );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( LMT::ResultType,  blaze::LowerMatrix<RMT>      );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( OLMT::ResultType, blaze::LowerMatrix<CMT>      );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( UMT::ResultType,  blaze::UpperMatrix<RMT>      );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( OUMT::ResultType, blaze::UpperMatrix<CMT>      );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of rows of the given packed matrix.
+//
+// \param matrix The packed matrix to be checked.
+// \param expectedRows The expected number of rows of the packed matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of rows of the given packed matrix. In case the actual number
+// of rows does not correspond to the given expected number of rows, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the packed matrix
+void ClassTest::checkRows( const Type& matrix, size_t expectedRows ) const
+{
+   if( matrix.rows() != expectedRows ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of rows detected\n"
+          << " Details:\n"
+          << "   Number of rows         : " << matrix.rows() << "\n"
+          << "   Expected number of rows: " << expectedRows << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of columns of the given packed matrix.
+//
+// \param matrix The packed matrix to be checked.
+// \param expectedColumns The expected number of columns of the packed matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of columns of the given packed matrix. In case the actual
+// number of columns does not correspond to the given expected number of columns, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the packed matrix
+void ClassTest::checkColumns( const Type& matrix, size_t expectedColumns ) const
+{
+   if( matrix.columns() != expectedColumns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of columns detected\n"
+          << " Details:\n"
+          << "   Number of columns         : " << matrix.columns() << "\n"
+          << "   Expected number of columns: " << expectedColumns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the capacity of the given packed matrix.
+//
+// \param matrix The packed matrix to be checked.
+// \param expectedCapacity The expected capacity of the packed matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the capacity of the given packed matrix. Since a packed matrix stores
+// exactly the \f$ N(N+1)/2 \f$ elements of one triangle of the matrix, the capacity has to
+// correspond exactly to the given expected capacity. Otherwise a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >  // Type of the packed matrix
+void ClassTest::checkCapacity( const Type& matrix, size_t expectedCapacity ) const
+{
+   if( matrix.capacity() != expectedCapacity || !isIntact( matrix ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid capacity detected\n"
+          << " Details:\n"
+          << "   Capacity         : " << matrix.capacity() << "\n"
+          << "   Expected capacity: " << expectedCapacity << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given packed matrix.
+//
+// \param matrix The packed matrix to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the packed matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements of the given packed matrix, including
+// the non-zero elements of the triangle that is not stored. In case the actual number of
+// non-zero elements does not correspond to the given expected number, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Type of the packed matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t expectedNonZeros ) const
+{
+   if( nonZeros( matrix ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << nonZeros( matrix ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements in a specific row/column of the given matrix.
+//
+// \param matrix The packed matrix to be checked.
+// \param index The row/column to be checked.
+// \param expectedNonZeros The expected number of non-zero elements in the specified row/column.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements in the specified row/column of the given
+// packed matrix. In case the actual number of non-zero elements does not correspond to the given
+// expected number, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the packed matrix
+void ClassTest::checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const
+{
+   if( nonZeros( matrix, index ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements in "
+          << ( blaze::IsRowMajorMatrix<Type>::value ? "row " : "column " ) << index << "\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << nonZeros( matrix, index ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the PackedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the PackedMatrix class test.
+*/
+#define RUN_PACKEDMATRIX_CLASS_TEST \
+   blazetest::mathtest::packedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -40,13 +40,18 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/shims/Abs.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/LAPACK.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Random.h>
 #include <blazetest/system/LAPACK.h>
@@ -92,6 +97,9 @@ class DenseTest
    template< typename Type >
    void testRandom();
 
+   template< typename Type >
+   void testRankDeficientMatrix();
+
    void testGeneral();
    void testSymmetric();
    void testHermitian();
@@ -100,6 +108,18 @@ class DenseTest
    void testUpper();
    void testUniUpper();
    void testDiagonal();
+   void testRankDeficient();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT1, typename MT2 >
+   double relativeError( const MT1& A, const MT2& B ) const;
+
+   template< typename MT >
+   bool isFinite( const MT& A ) const;
    //@}
    //**********************************************************************************************
 
@@ -138,7 +158,7 @@ class DenseTest
 template< typename Type >
 void DenseTest::testRandom()
 {
-#if BLAZETEST_MATHTEST_LAPACK_MODE
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
 
    test_ = "QR decomposition";
 
@@ -178,6 +198,164 @@ void DenseTest::testRandom()
 
 
 
+//*************************************************************************************************
+/*!\brief Test of the QR decomposition with rank deficient and rectangular matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dense matrix QR decomposition for full rank and rank deficient wide
+// (\f$ m<n \f$) and tall (\f$ m>n \f$) matrices, including a matrix with a zero column. The
+// matrix sizes are chosen such that both the unblocked and the blocked factorization are
+// exercised. The factors must reproduce the original matrix, \a Q must have orthonormal columns,
+// and \a R must be upper triangular. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >
+void DenseTest::testRankDeficientMatrix()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE || !BLAZE_LAPACK_MODE
+
+   test_ = "QR decomposition of rank deficient and rectangular matrices";
+
+   using ET = blaze::ElementType_<Type>;
+
+   const size_t BS( blaze::DECOMPOSITION_BLOCK_SIZE );
+
+   const size_t sizes[][2] = { { 8UL, 6UL }, { 6UL, 8UL }, { 5UL, 9UL }, { 9UL, 5UL },
+                               { 2UL*BS+5UL, BS+3UL }, { BS+3UL, 2UL*BS+5UL } };
+
+   for( const auto& size : sizes )
+   {
+      const size_t m( size[0] );
+      const size_t n( size[1] );
+      const size_t k( std::min( m, n ) );
+
+      for( size_t variant=0UL; variant<3UL; ++variant )
+      {
+         Type A( m, n ), Q, R;
+
+         if( variant == 0UL ) {
+            randomize( A );
+         }
+         else {
+            Type X( m, k/2UL ), Y( k/2UL, n );
+            randomize( X );
+            randomize( Y );
+            A = X * Y;
+
+            if( variant == 2UL ) {
+               for( size_t i=0UL; i<m; ++i ) {
+                  A(i,0UL) = ET( 0 );
+               }
+            }
+         }
+
+         blaze::qr( A, Q, R );
+
+         const Type QR( Q*R );
+         const Type QQ( ctrans( Q ) * Q );
+
+         Type I( k, k, ET( 0 ) );
+         for( size_t i=0UL; i<k; ++i ) {
+            I(i,i) = ET( 1 );
+         }
+
+         bool upper( true );
+         for( size_t i=0UL; i<R.rows(); ++i ) {
+            for( size_t j=0UL; j<i && j<R.columns(); ++j ) {
+               if( R(i,j) != ET( 0 ) )
+                  upper = false;
+            }
+         }
+
+         if( Q.rows() != m || Q.columns() != k || R.rows() != k || R.columns() != n ||
+             !upper || !isFinite( Q ) || !isFinite( R ) ||
+             relativeError( QR, A ) > 1E-10 || relativeError( QQ, I ) > 1E-10 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: QR decomposition failed\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( Type ).name() << "\n"
+                << "   Size: " << m << "x" << n << "\n"
+                << "   Variant: " << ( variant == 0UL ? "full rank" :
+                                       variant == 1UL ? "rank deficient" : "zero column" ) << "\n"
+                << "   Size of Q: " << Q.rows() << "x" << Q.columns() << "\n"
+                << "   Size of R: " << R.rows() << "x" << R.columns() << "\n"
+                << "   R upper triangular: " << upper << "\n"
+                << "   Relative error of Q*R   : " << relativeError( QR, A ) << "\n"
+                << "   Orthogonality error of Q: " << relativeError( QQ, I ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the maximum absolute deviation between two matrices relative to the second.
+//
+// \param A The computed matrix.
+// \param B The reference matrix.
+// \return The maximum absolute deviation relative to the largest absolute element of \a B.
+*/
+template< typename MT1    // Type of the computed matrix
+        , typename MT2 >  // Type of the reference matrix
+double DenseTest::relativeError( const MT1& A, const MT2& B ) const
+{
+   double error( 0.0 );
+   double scale( 1.0 );
+
+   for( size_t i=0UL; i<B.rows(); ++i ) {
+      for( size_t j=0UL; j<B.columns(); ++j ) {
+         error = std::max<double>( error, blaze::abs( A(i,j) - B(i,j) ) );
+         scale = std::max<double>( scale, blaze::abs( B(i,j) ) );
+      }
+   }
+
+   return error / scale;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks whether all elements of the given matrix are finite.
+//
+// \param A The matrix to be checked.
+// \return \a true in case all elements are finite, \a false if not.
+*/
+template< typename MT >  // Type of the matrix
+bool DenseTest::isFinite( const MT& A ) const
+{
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<A.columns(); ++j ) {
+         if( !std::isfinite( blaze::abs( A(i,j) ) ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+
 //=================================================================================================
 //
 //  GLOBAL TEST FUNCTIONS
@@ -0,0 +1,842 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/simd/NativeMathTest.h
+//  \brief Header file for the native SIMD math test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SIMD_NATIVEMATHTEST_H_
+#define _BLAZETEST_MATHTEST_SIMD_NATIVEMATHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/SIMD.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/Random.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace simd {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class template for the test of the native SIMD math kernels.
+//
+// This class template tests the native vectorized transcendental functions (see
+// blaze/math/simd/NativeMath.h) for the given floating point data type \a T. For every kernel
+// the results for a large number of random arguments are compared to a reference computed in
+// extended precision and the error is checked against the ulp bound documented for the kernel.
+// The random number generator is seeded with a fixed value, such that every run checks the
+// same arguments.
+// Additionally all special cases required by the C standard (signed zeros, infinities, and
+// NaN) are verified.
+*/
+template< typename T >  // Data type of the native math test
+class NativeMathTest : private blaze::NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using SIMD     = blaze::SIMDTrait<T>;  //!< SIMD trait for the given floating point type.
+   using SIMDType = typename SIMD::Type;  //!< SIMD type for the given floating point type.
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   enum : size_t { SIMDSIZE = SIMD::size };  //!< Number of elements in a single SIMD vector.
+   enum : size_t { N = 65536UL };            //!< Number of random arguments per accuracy test.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit NativeMathTest();
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~NativeMathTest();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testExp ();
+   void testLog ();
+   void testSin ();
+   void testCos ();
+   void testPow ();
+   void testTanh();
+   void testErf ();
+   void testErfc();
+   //@}
+   //**********************************************************************************************
+
+   //**Error detection functions*******************************************************************
+   /*!\name Error detection functions */
+   //@{
+   template< typename OP, typename REF >
+   void checkAccuracy( OP op, REF ref, double bound ) const;
+
+   template< typename OP, typename REF >
+   void checkAccuracy2( OP op, REF ref, double bound ) const;
+
+   template< typename OP >
+   void checkSpecial( OP op, T a, T expected ) const;
+
+   template< typename OP >
+   void checkSpecial( OP op, T a, T b, T expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void initialize( T* array, T min, T max );
+
+   static bool   isSame( T result, T expected );
+   static double ulps  ( T result, long double expected );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   T* a_;  //!< The first aligned array of size N.
+   T* b_;  //!< The second aligned array of size N.
+   T* c_;  //!< The third aligned array of size N.
+
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( T );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the native SIMD math test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+template< typename T >  // Data type of the native math test
+NativeMathTest<T>::NativeMathTest()
+   : a_   ( blaze::allocate<T>( N ) )  // The first aligned array of size N
+   , b_   ( blaze::allocate<T>( N ) )  // The second aligned array of size N
+   , c_   ( blaze::allocate<T>( N ) )  // The third aligned array of size N
+   , test_()                           // Label of the currently performed test
+{
+#if BLAZE_NATIVE_SIMD_MATH_MODE && !BLAZE_SVML_MODE
+   blaze::setSeed( 12345U );
+
+   testExp ();
+   testLog ();
+   testSin ();
+   testCos ();
+   testPow ();
+   testTanh();
+   testErf ();
+   testErfc();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the native SIMD math test.
+*/
+template< typename T >  // Data type of the native math test
+NativeMathTest<T>::~NativeMathTest()
+{
+   blaze::deallocate( a_ );
+   blaze::deallocate( b_ );
+   blaze::deallocate( c_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native exp() kernel.
+//
+// \return void
+// \exception std::runtime_error Error in exp() computation detected.
+*/
+template< typename T >  // Data type of the native math test
+void NativeMathTest<T>::testExp()
+{
+   const auto op = []( const SIMDType& x ) { return blaze::exp( x ); };
+
+   const T inf( std::numeric_limits<T>::infinity() );
+   const T nan( std::numeric_limits<T>::quiet_NaN() );
+   const T max( std::numeric_limits<T>::max() );
+
+   test_ = "exp() accuracy";
+
+   initialize( a_, T(-87), T(88) );
+   if( sizeof(T) == 8UL ) {
+      for( size_t i=0UL; i<N; ++i ) a_[i] *= T(8);
+   }
+   checkAccuracy( op, []( long double x ){ return std::exp( x ); }, sizeof(T) == 4UL ? 1.0 : 2.0 );
+
+   test_ = "exp() special cases";
+
+   checkSpecial( op,  T(0), T(1) );
+   checkSpecial( op, -T(0), T(1) );
+   checkSpecial( op,  inf ,  inf );
+   checkSpecial( op, -inf , T(0) );
+   checkSpecial( op,  nan ,  nan );
+   checkSpecial( op,  max ,  inf );
+   checkSpecial( op, -max , T(0) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the native log() kernel.
+//
+// \return void
+// \exception std::runtime_error Error in log() computation detected.
+*/
+template< typename T >  // Data type of the native math test
+void NativeMathTest<T>::testLog()
+{
+   const auto op = []( const SIMDType& x ) { return blaze::log( x ); };
+
+   const T inf( std::numeric_limits<T>::infinity() );
+   const T nan( std::numeric_limits<T>::quiet_NaN() );
+
+   test_ = "log() accuracy";
+
+   initialize( a_, T(-80), T(80) );
+   for( size_t i=0UL; i<N; ++i ) a_[i] = std::exp( a_[i] );
+   checkAccuracy( op, []( long double x ){ return std::log( x ); }, 1.0 );
+
+   initialize( a_, T(0.5), T(2) );
+   checkAccuracy( op, []( long double x ){ return std::log( x ); }, 1.0 );
+
+   test_ = "log() special cases";
+
+   checkSpecial( op,  T(0), -inf );
+   checkSpecial( op, -T(0), -inf );
+   checkSpecial( op,  T(1), T(0) );
+   checkSpecial( op, -T(1),  nan );
+   checkSpecial( op,  inf ,  inf );
+   checkSpecial( op, -inf ,  nan );
+   checkSpecial( op,  nan ,  nan );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the native sin() kernel.
+//
+// \return void
+// \exception std::runtime_error Error in sin() computation detected.
+*/
+template< typename T >  // Data type of the native math test
+void NativeMathTest<T>::testSin()
+{
+   const auto op = []( const SIMDType& x ) { return blaze::sin( x ); };
+
+   const T inf( std::numeric_limits<T>::infinity() );
+   const T nan( std::numeric_limits<T>::quiet_NaN() );
+
+   test_ = "sin() accuracy";
+
+   initialize( a_, T(-8), T(8) );
+   checkAccuracy( op, []( long double x ){ return std::sin( x ); }, 1.0 );
+
+   if( sizeof(T) == 8UL ) {
+      initialize( a_, T(-1E6), T(1E6) );
+      checkAccuracy( op, []( long double x ){ return std::sin( x ); }, 1.0 );
+   }
+
+   test_ = "sin() special cases";
+
+   checkSpecial( op,  T(0),  T(0) );
+   checkSpecial( op, -T(0), -T(0) );
+   checkSpecial( op,  inf ,  nan );
+   checkSpecial( op, -inf ,  nan );
+   checkSpecial( op,  nan ,  nan );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the native cos() kernel.
+//
+// \return void
+// \exception std::runtime_error Error in cos() computation detected.
+*/
+template< typename T >  // Data type of the native math test
+void NativeMathTest<T>::testCos()
+{
+   const auto op = []( const SIMDType& x ) { return blaze::cos( x ); };
+
+   const T inf( std::numeric_limits<T>::infinity() );
+   const T nan( std::numeric_limits<T>::quiet_NaN() );
+
+   test_ = "cos() accuracy";
+
+   initialize( a_, T(-8), T(8) );
+   checkAccuracy( op, []( long double x ){ return std::cos( x ); }, 1.0 );
+
+   if( sizeof(T) == 8UL ) {
+      initialize( a_, T(-1E6), T(1E6) );
+      checkAccuracy( op, []( long double x ){ return std::cos( x ); }, 1.0 );
+   }
+
+   test_ = "cos() special cases";
+
+   checkSpecial( op,  T(0), T(1) );
+   checkSpecial( op, -T(0), T(1) );
+   checkSpecial( op,  inf ,  nan );
+   checkSpecial( op, -inf ,  nan );
+   checkSpecial( op,  nan ,  nan );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the native pow() kernel.
+//
+// \return void
+// \exception std::runtime_error Error in pow() computation detected.
+*/
+template< typename T >  // Data type of the native math test
+void NativeMathTest<T>::testPow()
+{
+   const auto op = []( const SIMDType& x, const SIMDType& y ) { return blaze::pow( x, y ); };
+   const auto ref = []( long double x, long double y ) { return std::pow( x, y ); };
+
+   const T inf( std::numeric_limits<T>::infinity() );
+   const T nan( std::numeric_limits<T>::quiet_NaN() );
+   const double bound( sizeof(T) == 4UL ? 1.0 : 2.0 );
+
+   test_ = "pow() accuracy";
+
+   // Positive bases with |b*log(a)| <= 16
+   initialize( a_, T(-20), T(20) );
+   initialize( b_, T(-16), T(16) );
+   for( size_t i=0UL; i<N; ++i ) {
+      b_[i] /= std::max( std::abs( a_[i] ), T(1) );
+      a_[i]  = std::exp( a_[i] );
+   }
+
+   // Hard cases for the double-double computation of b*log(a)
+   a_[0] = T(0.70110012434141622); b_[0] = T(-15.163410534714822);
+   a_[1] = T(0.70158061416573425); b_[1] = T( 15.68723285257137 );
+   a_[2] = T(2.7785171646450713 ); b_[2] = T( 15.311118628669499);
+   a_[3] = T(1.3924650535100176 ); b_[3] = T( 14.584193728733123);
+
+   checkAccuracy2( op, ref, bound );
+
+   // Negative bases with integral exponents and |b*log(a)| <= 16
+   initialize( a_, T(-4), T(-0.25) );
+   initialize( b_, T(-11), T(11) );
+   for( size_t i=0UL; i<N; ++i ) {
+      b_[i] = std::round( b_[i] );
+   }
+   checkAccuracy2( op, ref, bound );
+
+   test_ = "pow() special cases";
+
+   checkSpecial( op,  T(0)  , -T(1)  ,  inf  );  // pow(+0,y) = +inf for odd integers y < 0
+   checkSpecial( op, -T(0)  , -T(1)  , -inf  );  // pow(-0,y) = -inf for odd integers y < 0
+   checkSpecial( op,  T(0)  , -T(2)  ,  inf  );  // pow(+-0,y) = +inf for other y < 0
+   checkSpecial( op, -T(0)  , -T(2)  ,  inf  );
+   checkSpecial( op, -T(0)  , -T(0.5),  inf  );
+   checkSpecial( op,  T(0)  , -inf   ,  inf  );  // pow(+-0,-inf) = +inf
+   checkSpecial( op, -T(0)  , -inf   ,  inf  );
+   checkSpecial( op,  T(0)  ,  T(3)  ,  T(0) );  // pow(+0,y) = +0 for odd integers y > 0
+   checkSpecial( op, -T(0)  ,  T(3)  , -T(0) );  // pow(-0,y) = -0 for odd integers y > 0
+   checkSpecial( op,  T(0)  ,  T(2)  ,  T(0) );  // pow(+-0,y) = +0 for other y > 0
+   checkSpecial( op, -T(0)  ,  T(2)  ,  T(0) );
+   checkSpecial( op, -T(0)  ,  T(0.5),  T(0) );
+   checkSpecial( op, -T(0)  ,  inf   ,  T(0) );
+   checkSpecial( op, -T(1)  ,  inf   ,  T(1) );  // pow(-1,+-inf) = 1
+   checkSpecial( op, -T(1)  , -inf   ,  T(1) );
+   checkSpecial( op,  T(1)  ,  nan   ,  T(1) );  // pow(+1,y) = 1 for any y, even NaN
+   checkSpecial( op,  T(1)  ,  inf   ,  T(1) );
+   checkSpecial( op,  nan   ,  T(0)  ,  T(1) );  // pow(x,+-0) = 1 for any x, even NaN
+   checkSpecial( op,  nan   , -T(0)  ,  T(1) );
+   checkSpecial( op, -inf   ,  T(0)  ,  T(1) );
+   checkSpecial( op, -T(2)  ,  T(0.5),  nan  );  // pow(x,y) = NaN for finite x < 0 and non-integral y
+   checkSpecial( op,  T(0.5), -inf   ,  inf  );  // pow(x,-inf) = +inf for |x| < 1
+   checkSpecial( op, -T(0.5), -inf   ,  inf  );
+   checkSpecial( op,  T(2)  , -inf   ,  T(0) );  // pow(x,-inf) = +0 for |x| > 1
+   checkSpecial( op, -T(2)  , -inf   ,  T(0) );
+   checkSpecial( op,  T(0.5),  inf   ,  T(0) );  // pow(x,+inf) = +0 for |x| < 1
+   checkSpecial( op, -T(0.5),  inf   ,  T(0) );
+   checkSpecial( op,  T(2)  ,  inf   ,  inf  );  // pow(x,+inf) = +inf for |x| > 1
+   checkSpecial( op, -T(2)  ,  inf   ,  inf  );
+   checkSpecial( op, -inf   , -T(3)  , -T(0) );  // pow(-inf,y) = -0 for odd integers y < 0
+   checkSpecial( op, -inf   , -T(2)  ,  T(0) );  // pow(-inf,y) = +0 for other y < 0
+   checkSpecial( op, -inf   , -T(0.5),  T(0) );
+   checkSpecial( op, -inf   ,  T(3)  , -inf  );  // pow(-inf,y) = -inf for odd integers y > 0
+   checkSpecial( op, -inf   ,  T(2)  ,  inf  );  // pow(-inf,y) = +inf for other y > 0
+   checkSpecial( op, -inf   ,  T(0.5),  inf  );
+   checkSpecial( op,  inf   , -T(0.5),  T(0) );  // pow(+inf,y) = +0 for y < 0
+   checkSpecial( op,  inf   ,  T(0.5),  inf  );  // pow(+inf,y) = +inf for y > 0
+   checkSpecial( op,  nan   ,  T(2)  ,  nan  );
+   checkSpecial( op,  T(2)  ,  nan   ,  nan  );
+   checkSpecial( op, -T(2)  ,  T(3)  , -T(8) );
+   checkSpecial( op, -T(2)  , -T(2)  ,  T(0.25) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the native tanh() kernel.
+//
+// \return void
+// \exception std::runtime_error Error in tanh() computation detected.
+*/
+template< typename T >  // Data type of the native math test
+void NativeMathTest<T>::testTanh()
+{
+   const auto op = []( const SIMDType& x ) { return blaze::tanh( x ); };
+
+   const T inf( std::numeric_limits<T>::infinity() );
+   const T nan( std::numeric_limits<T>::quiet_NaN() );
+
+   test_ = "tanh() accuracy";
+
+   initialize( a_, T(-1), T(1) );
+   checkAccuracy( op, []( long double x ){ return std::tanh( x ); }, 2.0 );
+
+   initialize( a_, T(-20), T(20) );
+   checkAccuracy( op, []( long double x ){ return std::tanh( x ); }, 2.0 );
+
+   test_ = "tanh() special cases";
+
+   checkSpecial( op,  T(0),  T(0) );
+   checkSpecial( op, -T(0), -T(0) );
+   checkSpecial( op,  inf ,  T(1) );
+   checkSpecial( op, -inf , -T(1) );
+   checkSpecial( op,  nan ,  nan  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the native erf() kernel.
+//
+// \return void
+// \exception std::runtime_error Error in erf() computation detected.
+*/
+template< typename T >  // Data type of the native math test
+void NativeMathTest<T>::testErf()
+{
+   const auto op = []( const SIMDType& x ) { return blaze::erf( x ); };
+
+   const T inf( std::numeric_limits<T>::infinity() );
+   const T nan( std::numeric_limits<T>::quiet_NaN() );
+
+   test_ = "erf() accuracy";
+
+   initialize( a_, T(-1), T(1) );
+   checkAccuracy( op, []( long double x ){ return std::erf( x ); }, 3.0 );
+
+   initialize( a_, T(-6), T(6) );
+   checkAccuracy( op, []( long double x ){ return std::erf( x ); }, 3.0 );
+
+   test_ = "erf() special cases";
+
+   checkSpecial( op,  T(0),  T(0) );
+   checkSpecial( op, -T(0), -T(0) );
+   checkSpecial( op,  inf ,  T(1) );
+   checkSpecial( op, -inf , -T(1) );
+   checkSpecial( op,  nan ,  nan  );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the native erfc() kernel.
+//
+// \return void
+// \exception std::runtime_error Error in erfc() computation detected.
+*/
+template< typename T >  // Data type of the native math test
+void NativeMathTest<T>::testErfc()
+{
+   const auto op = []( const SIMDType& x ) { return blaze::erfc( x ); };
+
+   const T inf( std::numeric_limits<T>::infinity() );
+   const T nan( std::numeric_limits<T>::quiet_NaN() );
+
+   test_ = "erfc() accuracy";
+
+   initialize( a_, T(-1), T(1) );
+   checkAccuracy( op, []( long double x ){ return std::erfc( x ); }, 11.0 );
+
+   initialize( a_, T(-5), sizeof(T) == 4UL ? T(9) : T(26) );
+   checkAccuracy( op, []( long double x ){ return std::erfc( x ); }, 11.0 );
+
+   test_ = "erfc() special cases";
+
+   checkSpecial( op,  T(0),  T(1) );
+   checkSpecial( op, -T(0),  T(1) );
+   checkSpecial( op,  inf ,  T(0) );
+   checkSpecial( op, -inf ,  T(2) );
+   checkSpecial( op,  nan ,  nan  );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR DETECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the accuracy of a unary kernel for the arguments in the first array.
+//
+// \param op The vectorized operation.
+// \param ref The reference operation in extended precision.
+// \param bound The maximum permitted error in ulp.
+// \return void
+// \exception std::runtime_error Error bound exceeded.
+*/
+template< typename T >    // Data type of the native math test
+template< typename OP     // Type of the vectorized operation
+        , typename REF >  // Type of the reference operation
+void NativeMathTest<T>::checkAccuracy( OP op, REF ref, double bound ) const
+{
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      blaze::storea( c_+i, op( blaze::loada( a_+i ) ) );
+   }
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      const long double expected( ref( static_cast<long double>( a_[i] ) ) );
+      const double error( ulps( c_[i], expected ) );
+
+      if( !( error <= bound ) ) {
+         std::ostringstream oss;
+         oss.precision( std::numeric_limits<T>::max_digits10 );
+         oss << " Test : " << test_ << "\n"
+             << " Error: Error bound exceeded\n"
+             << " Details:\n"
+             << "   Data type       : " << ( sizeof(T) == 4UL ? "float" : "double" ) << "\n"
+             << "   Argument        : " << a_[i] << "\n"
+             << "   Result          : " << c_[i] << "\n"
+             << "   Expected result : " << static_cast<T>( expected ) << "\n"
+             << "   Error           : " << error << " ulp (bound " << bound << " ulp)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the accuracy of a binary kernel for the arguments in the first two arrays.
+//
+// \param op The vectorized operation.
+// \param ref The reference operation in extended precision.
+// \param bound The maximum permitted error in ulp.
+// \return void
+// \exception std::runtime_error Error bound exceeded.
+*/
+template< typename T >    // Data type of the native math test
+template< typename OP     // Type of the vectorized operation
+        , typename REF >  // Type of the reference operation
+void NativeMathTest<T>::checkAccuracy2( OP op, REF ref, double bound ) const
+{
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      blaze::storea( c_+i, op( blaze::loada( a_+i ), blaze::loada( b_+i ) ) );
+   }
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      const long double expected( ref( static_cast<long double>( a_[i] ), static_cast<long double>( b_[i] ) ) );
+      const double error( ulps( c_[i], expected ) );
+
+      if( !( error <= bound ) ) {
+         std::ostringstream oss;
+         oss.precision( std::numeric_limits<T>::max_digits10 );
+         oss << " Test : " << test_ << "\n"
+             << " Error: Error bound exceeded\n"
+             << " Details:\n"
+             << "   Data type       : " << ( sizeof(T) == 4UL ? "float" : "double" ) << "\n"
+             << "   Arguments       : " << a_[i] << ", " << b_[i] << "\n"
+             << "   Result          : " << c_[i] << "\n"
+             << "   Expected result : " << static_cast<T>( expected ) << "\n"
+             << "   Error           : " << error << " ulp (bound " << bound << " ulp)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a unary kernel for a special argument.
+//
+// \param op The vectorized operation.
+// \param a The special argument.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Invalid result detected.
+//
+// The argument is placed in every element of the SIMD vector. The result is only accepted in
+// case all elements match the expected value including its sign.
+*/
+template< typename T >   // Data type of the native math test
+template< typename OP >  // Type of the vectorized operation
+void NativeMathTest<T>::checkSpecial( OP op, T a, T expected ) const
+{
+   blaze::storea( c_, op( blaze::set( a ) ) );
+
+   for( size_t i=0UL; i<SIMDSIZE; ++i )
+   {
+      if( !isSame( c_[i], expected ) ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Invalid result for special argument\n"
+             << " Details:\n"
+             << "   Data type       : " << ( sizeof(T) == 4UL ? "float" : "double" ) << "\n"
+             << "   Argument        : " << a << "\n"
+             << "   Result          : " << c_[i] << "\n"
+             << "   Expected result : " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a binary kernel for a pair of special arguments.
+//
+// \param op The vectorized operation.
+// \param a The first special argument.
+// \param b The second special argument.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Invalid result detected.
+*/
+template< typename T >   // Data type of the native math test
+template< typename OP >  // Type of the vectorized operation
+void NativeMathTest<T>::checkSpecial( OP op, T a, T b, T expected ) const
+{
+   blaze::storea( c_, op( blaze::set( a ), blaze::set( b ) ) );
+
+   for( size_t i=0UL; i<SIMDSIZE; ++i )
+   {
+      if( !isSame( c_[i], expected ) ) {
+         std::ostringstream oss;
+         oss << " Test : " << test_ << "\n"
+             << " Error: Invalid result for special arguments\n"
+             << " Details:\n"
+             << "   Data type       : " << ( sizeof(T) == 4UL ? "float" : "double" ) << "\n"
+             << "   Arguments       : " << a << ", " << b << "\n"
+             << "   Result          : " << c_[i] << "\n"
+             << "   Expected result : " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given array with random values in the range \f$ [min..max] \f$.
+//
+// \param array The array to be initialized.
+// \param min The smallest possible random value.
+// \param max The largest possible random value.
+// \return void
+*/
+template< typename T >  // Data type of the native math test
+void NativeMathTest<T>::initialize( T* array, T min, T max )
+{
+   using blaze::randomize;
+
+   for( size_t i=0UL; i<N; ++i ) {
+      randomize( array[i], min, max );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Bitwise comparison of a result with the expected value.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return \a true if both values are NaN or equal including their sign, \a false if not.
+*/
+template< typename T >  // Data type of the native math test
+bool NativeMathTest<T>::isSame( T result, T expected )
+{
+   if( std::isnan( expected ) )
+      return std::isnan( result );
+   return result == expected && std::signbit( result ) == std::signbit( expected );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the error of a result in units of the last place.
+//
+// \param result The computed result.
+// \param expected The exact result in extended precision.
+// \return The distance to the correctly rounded result in ulp of the correctly rounded result.
+*/
+template< typename T >  // Data type of the native math test
+double NativeMathTest<T>::ulps( T result, long double expected )
+{
+   const T rounded( static_cast<T>( expected ) );
+
+   if( isSame( result, rounded ) || result == rounded )
+      return 0.0;
+   if( std::isnan( result ) || std::isnan( rounded ) || std::isinf( result ) || std::isinf( rounded ) )
+      return std::numeric_limits<double>::infinity();
+
+   const T absval( std::abs( rounded ) );
+   const T ulp( std::nextafter( absval, std::numeric_limits<T>::infinity() ) - absval );
+
+   return static_cast<double>( std::abs( result - rounded ) / ulp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the native SIMD math kernels of a specific floating point data type.
+//
+// \return void
+*/
+template< typename T >  // Data type of the native math test
+void runNativeMathTest()
+{
+   NativeMathTest<T>();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of a native SIMD math test case.
+*/
+#define RUN_SIMD_NATIVEMATH_TEST( T ) \
+   blazetest::mathtest::simd::runNativeMathTest<T>()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace simd
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
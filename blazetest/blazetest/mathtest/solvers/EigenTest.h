@@ -0,0 +1,506 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/EigenTest.h
+//  \brief Header file for the eigenvalue solver test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_EIGENTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_EIGENTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/util/Complex.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the iterative eigenvalue solvers.
+//
+// This class represents a test suite for the Krylov subspace eigenvalue solvers of the Blaze
+// library, i.e. the thick-restart Lanczos method (lanczos()) and the restarted Arnoldi method
+// (arnoldi()). It checks the computed eigenvalues against analytically known eigenvalues or
+// against the eigenvalues computed by the dense LAPACK eigenvalue solvers and checks the
+// residuals of the computed eigenpairs.
+*/
+class EigenTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit EigenTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testLanczos();
+   void testArnoldi();
+   void testShiftInvert();
+   void testErrors();
+
+   template< typename MT, typename VT1, typename VT2 >
+   void checkEigenvalues( const MT& A, const VT1& w, const VT2& ref,
+                          const blaze::SolverControl& control, double tol ) const;
+
+   template< typename MT, typename VT, typename MT2 >
+   void checkEigenvectors( const MT& A, const VT& w, const MT2& V, double tol ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::CompressedMatrix<Type,blaze::rowMajor> laplace( size_t k );
+
+   static blaze::CompressedMatrix<double,blaze::rowMajor> laplace2( size_t k );
+
+   static blaze::CompressedMatrix<blaze::complex<double>,blaze::rowMajor> hermitian( size_t k );
+
+   template< typename Type >
+   static blaze::CompressedMatrix<Type,blaze::rowMajor> convection( size_t k );
+
+   template< typename MT >
+   static blaze::DynamicVector<double,blaze::columnVector> symmetricSpectrum( const MT& A );
+
+   template< typename MT >
+   static blaze::DynamicVector<blaze::complex<double>,blaze::columnVector> generalSpectrum( const MT& A );
+
+   template< typename VT >
+   static VT select( VT w, size_t nev, blaze::EigenSpectrum spectrum );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the computed eigenvalues against the given reference eigenvalues.
+//
+// \param A The matrix.
+// \param w The computed eigenvalues.
+// \param ref The expected eigenvalues in the order of the selected spectrum.
+// \param control The convergence control of the eigenvalue solver.
+// \param tol The absolute tolerance.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the eigenvalue solver has converged and that the computed
+// eigenvalues match the expected eigenvalues. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename MT     // Type of the matrix
+        , typename VT1    // Type of the computed eigenvalues
+        , typename VT2 >  // Type of the reference eigenvalues
+void EigenTest::checkEigenvalues( const MT& A, const VT1& w, const VT2& ref,
+                                  const blaze::SolverControl& control, double tol ) const
+{
+   bool equal( w.size() == ref.size() );
+
+   for( size_t i=0UL; equal && i<w.size(); ++i ) {
+      equal = ( std::abs( w[i] - ref[i] ) <= tol );
+   }
+
+   if( !control.converged() || !equal ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Eigenvalue computation failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( typename MT::ElementType ).name() << "\n"
+          << "   Size: " << A.rows() << "\n"
+          << "   Converged: " << control.converged() << "\n"
+          << "   Restarts: " << control.iterations() << "\n"
+          << "   Residual: " << control.residual() << "\n"
+          << "   Result:\n" << w << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the residuals of the computed eigenpairs.
+//
+// \param A The matrix.
+// \param w The computed eigenvalues.
+// \param V The computed eigenvectors.
+// \param tol The relative tolerance.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the columns of \a V are normalized and that the residuals \f$
+// \|A v_i - \lambda_i v_i\| \f$ are small. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT     // Type of the matrix
+        , typename VT     // Type of the eigenvalues
+        , typename MT2 >  // Type of the eigenvectors
+void EigenTest::checkEigenvectors( const MT& A, const VT& w, const MT2& V, double tol ) const
+{
+   for( size_t i=0UL; i<w.size(); ++i )
+   {
+      const auto v( column( V, i ) );
+      const double vnorm( norm( v ) );
+      const double residual( norm( A * v - w[i] * v ) );
+
+      if( V.rows() != A.rows() || V.columns() != w.size() ||
+          std::abs( vnorm - 1.0 ) > 1E-10 || residual > tol * std::max( 1.0, double( std::abs( w[i] ) ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid eigenvector detected\n"
+             << " Details:\n"
+             << "   Size: " << A.rows() << "\n"
+             << "   Index: " << i << "\n"
+             << "   Eigenvalue: " << w[i] << "\n"
+             << "   Norm: " << vnorm << "\n"
+             << "   Residual: " << residual << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the symmetric matrix of the 1D Laplace operator.
+//
+// \param n The number of grid points.
+// \return The \f$ n \times n \f$ tridiagonal Laplace matrix.
+//
+// The eigenvalues of the matrix are \f$ 2 - 2 \cos( j \pi / (n+1) ) \f$, \f$ j = 1..n \f$.
+*/
+template< typename Type >  // Data type of the matrix
+blaze::CompressedMatrix<Type,blaze::rowMajor> EigenTest::laplace( size_t n )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( n, n );
+   A.reserve( 3UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i > 0UL ) A.append( i, i-1UL, Type(-1) );
+      A.append( i, i, Type(2) );
+      if( i+1UL < n ) A.append( i, i+1UL, Type(-1) );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the symmetric matrix of an anisotropic 2D Laplace operator.
+//
+// \param k The number of grid points per dimension.
+// \return The \f$ k^2 \times k^2 \f$ five-point Laplace matrix.
+//
+// Due to the different coupling in the two dimensions the eigenvalues of the matrix are simple.
+*/
+inline blaze::CompressedMatrix<double,blaze::rowMajor> EigenTest::laplace2( size_t k )
+{
+   const size_t n( k*k );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i >= k ) A.append( i, i-k, -0.7 );
+      if( i % k != 0UL ) A.append( i, i-1UL, -1.0 );
+      A.append( i, i, 3.4 );
+      if( ( i+1UL ) % k != 0UL ) A.append( i, i+1UL, -1.0 );
+      if( i+k < n ) A.append( i, i+k, -0.7 );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a Hermitian matrix with the pattern of the 2D Laplace operator.
+//
+// \param k The number of grid points per dimension.
+// \return The \f$ k^2 \times k^2 \f$ Hermitian matrix.
+*/
+inline blaze::CompressedMatrix<blaze::complex<double>,blaze::rowMajor> EigenTest::hermitian( size_t k )
+{
+   const size_t n( k*k );
+
+   blaze::CompressedMatrix<cdouble,blaze::rowMajor> A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i >= k ) A.append( i, i-k, cdouble( -1.0, -0.25 ) );
+      if( i % k != 0UL ) A.append( i, i-1UL, cdouble( -1.0, -0.5 ) );
+      A.append( i, i, cdouble( 4.0 + 0.01 * double( i % 7UL ), 0.0 ) );
+      if( ( i+1UL ) % k != 0UL ) A.append( i, i+1UL, cdouble( -1.0, 0.5 ) );
+      if( i+k < n ) A.append( i, i+k, cdouble( -1.0, 0.25 ) );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the nonsymmetric matrix of a 2D convection-diffusion operator.
+//
+// \param k The number of grid points per dimension.
+// \return The \f$ k^2 \times k^2 \f$ convection-diffusion matrix.
+//
+// The matrix has a real spectrum in case of a real element type and a complex spectrum in case
+// of a complex element type.
+*/
+template< typename Type >  // Data type of the matrix
+blaze::CompressedMatrix<Type,blaze::rowMajor> EigenTest::convection( size_t k )
+{
+   const size_t n( k*k );
+
+   const Type cx( Type( 0.2 ) );
+   const Type cy( blaze::IsComplex<Type>::value ? Type( 0.5 ) : Type( -0.3 ) );
+   const Type ci( blaze::IsComplex<Type>::value ? Type( 0.3 ) : Type( 0 ) );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i >= k ) A.append( i, i-k, Type(-1) - cy );
+      if( i % k != 0UL ) A.append( i, i-1UL, Type(-1) - cx );
+      A.append( i, i, Type(4) + ci * Type( double( i % 5UL ) ) );
+      if( ( i+1UL ) % k != 0UL ) A.append( i, i+1UL, Type(-1) + cx );
+      if( i+k < n ) A.append( i, i+k, Type(-1) + cy );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes all eigenvalues of the given symmetric matrix by means of LAPACK.
+//
+// \param A The symmetric matrix.
+// \return The eigenvalues in ascending order.
+*/
+template< typename MT >  // Type of the matrix
+blaze::DynamicVector<double,blaze::columnVector> EigenTest::symmetricSpectrum( const MT& A )
+{
+   using ET = typename MT::ElementType;
+
+   blaze::DynamicMatrix<ET,blaze::columnMajor> D( A );
+   blaze::DynamicVector<double,blaze::columnVector> w( A.rows() );
+
+   blaze::syevd( D, w, 'N', 'L' );
+
+   return w;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes all eigenvalues of the given Hermitian matrix by means of LAPACK.
+//
+// \param A The Hermitian matrix.
+// \return The eigenvalues in ascending order.
+*/
+template<>
+inline blaze::DynamicVector<double,blaze::columnVector>
+   EigenTest::symmetricSpectrum( const blaze::CompressedMatrix<blaze::complex<double>,blaze::rowMajor>& A )
+{
+   blaze::DynamicMatrix<cdouble,blaze::columnMajor> D( A );
+   blaze::DynamicVector<double,blaze::columnVector> w( A.rows() );
+
+   blaze::heevd( D, w, 'N', 'L' );
+
+   return w;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes all eigenvalues of the given general matrix by means of LAPACK.
+//
+// \param A The general square matrix.
+// \return The complex eigenvalues.
+*/
+template< typename MT >  // Type of the matrix
+blaze::DynamicVector<blaze::complex<double>,blaze::columnVector> EigenTest::generalSpectrum( const MT& A )
+{
+   using ET = typename MT::ElementType;
+
+   blaze::DynamicMatrix<ET,blaze::columnMajor> D( A );
+   blaze::DynamicVector<cdouble,blaze::columnVector> w( A.rows() );
+
+   blaze::geev( D, w );
+
+   return w;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Selects the given number of eigenvalues according to the given spectrum.
+//
+// \param w The eigenvalues.
+// \param nev The number of selected eigenvalues.
+// \param spectrum The selected part of the spectrum.
+// \return The selected eigenvalues.
+*/
+template< typename VT >  // Type of the eigenvalue vector
+VT EigenTest::select( VT w, size_t nev, blaze::EigenSpectrum spectrum )
+{
+   std::stable_sort( w.begin(), w.end(), [spectrum]( const auto& a, const auto& b )
+   {
+      const double ka( ( spectrum == blaze::largestMagnitude )?( std::abs( a ) ):( std::real( a ) ) );
+      const double kb( ( spectrum == blaze::largestMagnitude )?( std::abs( b ) ):( std::real( b ) ) );
+
+      if( ka != kb ) {
+         return ( spectrum == blaze::smallestReal )?( ka < kb ):( ka > kb );
+      }
+
+      return std::imag( a ) > std::imag( b );
+   } );
+
+   w.resize( nev, true );
+
+   return w;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the iterative eigenvalue solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   EigenTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the eigenvalue solver test.
+*/
+#define RUN_SOLVERS_EIGEN_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,281 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/KrylovTest.h
+//  \brief Header file for the Krylov solver test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_KRYLOVTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_KRYLOVTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/solvers/TestMatrices.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the Krylov subspace solvers.
+//
+// This class represents a test suite for the iterative Krylov subspace solvers of the Blaze
+// library (cg(), bicgstab(), gmres(), and minres()). It solves a series of linear systems with
+// different system matrices, matrix-free operators, and preconditioners and checks the true
+// residual of the computed solutions.
+*/
+class KrylovTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit KrylovTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testControl();
+   void testCG();
+   void testBiCGSTAB();
+   void testGMRES();
+   void testMINRES();
+   void testInitialGuess();
+   void testErrors();
+   void testParallel();
+
+   template< typename Op, typename VT1, typename VT2, typename Ref >
+   void checkSolution( const Op& A, const VT1& x, const VT2& b,
+                       const blaze::SolverControl& control, const Ref& ref ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::CompressedMatrix<Type,blaze::rowMajor> indefinite( size_t n );
+
+   template< typename Type >
+   static blaze::DynamicVector<Type,blaze::columnVector> rhs( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the solution computed by an iterative solver.
+//
+// \param A The system matrix.
+// \param x The computed solution.
+// \param b The right-hand side vector.
+// \param control The convergence control of the solve.
+// \param ref The reference norm of the true residual relative to the norm of \a b.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver reports convergence and that the true residual of the
+// solution is in accordance with the requested tolerance. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Op     // Type of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename Ref >  // Type of the reference tolerance
+void KrylovTest::checkSolution( const Op& A, const VT1& x, const VT2& b,
+                                const blaze::SolverControl& control, const Ref& ref ) const
+{
+   const double residual( norm( b - A * x ) );
+   const double limit   ( ref * norm( b ) );
+
+   if( !control.converged() || !( residual <= limit ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solver failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( typename VT1::ElementType ).name() << "\n"
+          << "   Size: " << b.size() << "\n"
+          << "   Converged: " << control.converged() << "\n"
+          << "   Iterations: " << control.iterations() << "\n"
+          << "   Reported residual: " << control.residual() << "\n"
+          << "   True residual: " << residual << "\n"
+          << "   Limit: " << limit << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a symmetric indefinite matrix.
+//
+// \param n The size of the matrix.
+// \return The \f$ n \times n \f$ symmetric indefinite matrix.
+*/
+template< typename Type >  // Data type of the matrix
+blaze::CompressedMatrix<Type,blaze::rowMajor> KrylovTest::indefinite( size_t n )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( n, n );
+   A.reserve( 3UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i > 0UL ) A.append( i, i-1UL, Type(-1) );
+      A.append( i, i, ( i % 3UL == 0UL )?( Type(-3) ):( Type(4) ) );
+      if( i+1UL < n ) A.append( i, i+1UL, Type(-1) );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deterministic right-hand side vector.
+//
+// \param n The size of the vector.
+// \return The right-hand side vector.
+*/
+template< typename Type >  // Data type of the vector
+blaze::DynamicVector<Type,blaze::columnVector> KrylovTest::rhs( size_t n )
+{
+   blaze::DynamicVector<Type,blaze::columnVector> b( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      b[i] = Type( std::sin( double( i+1UL ) ) );
+   }
+
+   return b;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the Krylov subspace solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   KrylovTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Krylov solver test.
+*/
+#define RUN_SOLVERS_KRYLOV_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,385 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/PreconditionerTest.h
+//  \brief Header file for the preconditioner test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_PRECONDITIONERTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_PRECONDITIONERTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/solvers/TestMatrices.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the preconditioners of the iterative solvers.
+//
+// This class represents a test suite for the preconditioners of the iterative solvers of the
+// Blaze library (JacobiPreconditioner, BlockJacobiPreconditioner, SSORPreconditioner,
+// ILU0Preconditioner, and IC0Preconditioner) and the in-place incomplete decompositions ilu0()
+// and ic0(). It checks the computed factors against the defining properties of the incomplete
+// decompositions and the effect of the preconditioners on the convergence of the solvers.
+*/
+class PreconditionerTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit PreconditionerTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testJacobi();
+   void testBlockJacobi();
+   void testSSOR();
+   void testILU0();
+   void testIC0();
+   void testErrors();
+   void testParallel();
+
+   template< typename MT, typename LT, typename UT >
+   void checkPattern( const MT& A, const LT& L, const UT& U, double tol ) const;
+
+   template< typename MT, typename PC >
+   void checkExact( const MT& A, const PC& M, double tol ) const;
+
+   void checkIterations( const blaze::SolverControl& control, size_t limit ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::CompressedMatrix<Type,blaze::rowMajor> tridiagonal( size_t n );
+
+   template< typename Type >
+   static blaze::DynamicVector<Type,blaze::columnVector> rhs( size_t n );
+
+   template< typename Type >
+   static blaze::DynamicMatrix<Type,blaze::rowMajor>
+      lowerPart( const blaze::CompressedMatrix<Type,blaze::rowMajor>& F, bool unit );
+
+   template< typename Type >
+   static blaze::DynamicMatrix<Type,blaze::rowMajor>
+      upperPart( const blaze::CompressedMatrix<Type,blaze::rowMajor>& F );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking an incomplete decomposition on the sparsity pattern of the decomposed matrix.
+//
+// \param A The decomposed matrix.
+// \param L The lower triangular factor.
+// \param U The upper triangular factor.
+// \param tol The absolute tolerance.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the defining property of the incomplete decompositions without fill-in,
+// i.e. that the product \f$ L U \f$ matches \a A on all non-zero elements of \a A. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT    // Type of the decomposed matrix
+        , typename LT    // Type of the lower triangular factor
+        , typename UT >  // Type of the upper triangular factor
+void PreconditionerTest::checkPattern( const MT& A, const LT& L, const UT& U, double tol ) const
+{
+   const blaze::DynamicMatrix<typename MT::ElementType,blaze::rowMajor> LU( L * U );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element )
+      {
+         const size_t j( element->index() );
+
+         if( !( std::abs( LU(i,j) - element->value() ) <= tol ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Incomplete decomposition failed\n"
+                << " Details:\n"
+                << "   Element type:\n"
+                << "     " << typeid( typename MT::ElementType ).name() << "\n"
+                << "   Element (" << i << "," << j << ")\n"
+                << "   Result: " << LU(i,j) << "\n"
+                << "   Expected result: " << element->value() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that a preconditioner represents the exact inverse of the given matrix.
+//
+// \param A The system matrix.
+// \param M The preconditioner.
+// \param tol The relative tolerance.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function applies the preconditioner to a vector and checks that the result solves the
+// according linear system. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename MT    // Type of the system matrix
+        , typename PC >  // Type of the preconditioner
+void PreconditionerTest::checkExact( const MT& A, const PC& M, double tol ) const
+{
+   using ET = typename MT::ElementType;
+
+   const blaze::DynamicVector<ET,blaze::columnVector> r( rhs<ET>( A.rows() ) );
+   blaze::DynamicVector<ET,blaze::columnVector> z( A.rows() );
+
+   M( z, r );
+
+   const double residual( norm( A * z - r ) );
+
+   if( !( residual <= tol * norm( r ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Exact preconditioner failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( ET ).name() << "\n"
+          << "   Size: " << A.rows() << "\n"
+          << "   Residual: " << residual << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a non-symmetric, diagonally dominant tridiagonal matrix.
+//
+// \param n The size of the matrix.
+// \return The \f$ n \times n \f$ tridiagonal matrix.
+*/
+template< typename Type >  // Data type of the matrix
+blaze::CompressedMatrix<Type,blaze::rowMajor> PreconditionerTest::tridiagonal( size_t n )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( n, n );
+   A.reserve( 3UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i > 0UL ) A.append( i, i-1UL, Type(-1.5) );
+      A.append( i, i, Type( 4.0 + double( i % 3UL ) ) );
+      if( i+1UL < n ) A.append( i, i+1UL, Type(-0.5) );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a deterministic right-hand side vector.
+//
+// \param n The size of the vector.
+// \return The right-hand side vector.
+*/
+template< typename Type >  // Data type of the vector
+blaze::DynamicVector<Type,blaze::columnVector> PreconditionerTest::rhs( size_t n )
+{
+   blaze::DynamicVector<Type,blaze::columnVector> b( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      b[i] = Type( std::sin( double( i+1UL ) ) );
+   }
+
+   return b;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extracts the lower triangular part of the given factorization.
+//
+// \param F The matrix containing the factors of an incomplete decomposition.
+// \param unit \a true in case the lower factor has an implicit unit diagonal.
+// \return The dense lower triangular factor.
+*/
+template< typename Type >  // Data type of the matrix
+blaze::DynamicMatrix<Type,blaze::rowMajor>
+   PreconditionerTest::lowerPart( const blaze::CompressedMatrix<Type,blaze::rowMajor>& F, bool unit )
+{
+   blaze::DynamicMatrix<Type,blaze::rowMajor> L( F.rows(), F.columns(), Type(0) );
+
+   for( size_t i=0UL; i<F.rows(); ++i ) {
+      for( auto element=F.begin(i); element!=F.end(i); ++element ) {
+         if( element->index() < i || ( !unit && element->index() == i ) )
+            L(i,element->index()) = element->value();
+      }
+      if( unit ) L(i,i) = Type(1);
+   }
+
+   return L;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Extracts the upper triangular part of the given factorization.
+//
+// \param F The matrix containing the factors of an incomplete decomposition.
+// \return The dense upper triangular factor.
+*/
+template< typename Type >  // Data type of the matrix
+blaze::DynamicMatrix<Type,blaze::rowMajor>
+   PreconditionerTest::upperPart( const blaze::CompressedMatrix<Type,blaze::rowMajor>& F )
+{
+   blaze::DynamicMatrix<Type,blaze::rowMajor> U( F.rows(), F.columns(), Type(0) );
+
+   for( size_t i=0UL; i<F.rows(); ++i ) {
+      for( auto element=F.begin(i); element!=F.end(i); ++element ) {
+         if( element->index() >= i )
+            U(i,element->index()) = element->value();
+      }
+   }
+
+   return U;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the preconditioners of the iterative solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   PreconditionerTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the preconditioner test.
+*/
+#define RUN_SOLVERS_PRECONDITIONER_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,399 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/SupernodalTest.h
+//  \brief Header file for the supernodal sparse decomposition test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_SUPERNODALTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_SUPERNODALTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SparseDecomposition.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/solvers/TestMatrices.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the supernodal sparse decompositions.
+//
+// This class represents a test suite for the sparse direct solvers of the Blaze library, i.e.
+// the approximate minimum degree ordering (amd()), the symbolic analysis of the sparse Cholesky
+// decomposition (SymbolicFactorization) and the supernodal Cholesky and LDLH decompositions
+// (SparseLLH and SparseLDLH). It checks the fill of the computed orderings and the residuals of
+// the solutions of a variety of symmetric and Hermitian systems.
+*/
+class SupernodalTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SupernodalTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testOrdering();
+   void testAnalysis();
+   void testLLH();
+   void testLDLH();
+   void testRefactorization();
+   void testErrors();
+   void testParallel();
+
+   void checkPermutation( const std::vector<size_t>& p, size_t n ) const;
+
+   template< typename MT, typename ST >
+   void checkSolve( const MT& A, const ST& solver, double tol ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::CompressedMatrix<Type,blaze::rowMajor> laplace3( size_t k );
+
+   static blaze::CompressedMatrix<blaze::complex<double>,blaze::rowMajor> hermitian( size_t k );
+
+   static blaze::CompressedMatrix<double,blaze::rowMajor> quasiDefinite( size_t k, size_t m );
+
+   template< typename Type >
+   static blaze::DynamicVector<Type,blaze::columnVector> rhs( size_t n );
+
+   template< typename MT >
+   static size_t denseNonZeros( const MT& A, const std::vector<size_t>& p );
+   //@}
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   typedef blaze::complex<double>  cdouble;  //!< Double precision complex test type.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the solution of a linear system by means of a sparse decomposition.
+//
+// \param A The system matrix.
+// \param solver The decomposition of the system matrix.
+// \param tol The relative tolerance.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves a linear system with the given decomposition and checks the residual of
+// the solution. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT    // Type of the system matrix
+        , typename ST >  // Type of the sparse decomposition
+void SupernodalTest::checkSolve( const MT& A, const ST& solver, double tol ) const
+{
+   using ET = typename MT::ElementType;
+
+   const blaze::DynamicVector<ET,blaze::columnVector> b( rhs<ET>( A.rows() ) );
+   blaze::DynamicVector<ET,blaze::columnVector> x;
+
+   solver.solve( x, b );
+
+   const double residual( norm( A * x - b ) );
+
+   if( x.size() != A.rows() || !( residual <= tol * norm( b ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Sparse direct solve failed\n"
+          << " Details:\n"
+          << "   Element type:\n"
+          << "     " << typeid( ET ).name() << "\n"
+          << "   Size: " << A.rows() << "\n"
+          << "   Supernodes: " << solver.supernodes() << "\n"
+          << "   Residual: " << residual << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the symmetric positive definite matrix of the 3D Laplace operator.
+//
+// \param k The number of grid points per dimension.
+// \return The \f$ k^3 \times k^3 \f$ seven-point Laplace matrix.
+*/
+template< typename Type >  // Data type of the matrix
+blaze::CompressedMatrix<Type,blaze::rowMajor> SupernodalTest::laplace3( size_t k )
+{
+   const size_t n( k*k*k );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( n, n );
+   A.reserve( 7UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i >= k*k ) A.append( i, i-k*k, Type(-1) );
+      if( ( i / k ) % k != 0UL ) A.append( i, i-k, Type(-1) );
+      if( i % k != 0UL ) A.append( i, i-1UL, Type(-1) );
+      A.append( i, i, Type(6) );
+      if( ( i+1UL ) % k != 0UL ) A.append( i, i+1UL, Type(-1) );
+      if( ( i / k + 1UL ) % k != 0UL ) A.append( i, i+k, Type(-1) );
+      if( i+k*k < n ) A.append( i, i+k*k, Type(-1) );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a Hermitian positive definite matrix with the pattern of the 2D Laplace operator.
+//
+// \param k The number of grid points per dimension.
+// \return The \f$ k^2 \times k^2 \f$ Hermitian matrix.
+*/
+inline blaze::CompressedMatrix<blaze::complex<double>,blaze::rowMajor>
+   SupernodalTest::hermitian( size_t k )
+{
+   const size_t n( k*k );
+
+   blaze::CompressedMatrix<cdouble,blaze::rowMajor> A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i >= k ) A.append( i, i-k, cdouble( -1.0, -0.25 ) );
+      if( i % k != 0UL ) A.append( i, i-1UL, cdouble( -1.0, -0.5 ) );
+      A.append( i, i, cdouble( 6.0, 0.0 ) );
+      if( ( i+1UL ) % k != 0UL ) A.append( i, i+1UL, cdouble( -1.0, 0.5 ) );
+      if( i+k < n ) A.append( i, i+k, cdouble( -1.0, 0.25 ) );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a symmetric quasi-definite saddle point matrix.
+//
+// \param k The number of grid points per dimension of the positive definite block.
+// \param m The number of constraints.
+// \return The \f$ (k^2+m) \times (k^2+m) \f$ matrix \f$ \left(\begin{array}{cc} A & B^T \\ B & -C
+//         \end{array}\right) \f$ with the 2D Laplace matrix \a A and a diagonal matrix \a C.
+*/
+inline blaze::CompressedMatrix<double,blaze::rowMajor>
+   SupernodalTest::quasiDefinite( size_t k, size_t m )
+{
+   const size_t n( k*k );
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( k ) );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> K( n+m, n+m );
+   K.reserve( A.nonZeros() + 2UL*n + m );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         K.append( i, element->index(), element->value() );
+      }
+      for( size_t c=0UL; c<m; ++c ) {
+         if( ( i + c ) % ( m+3UL ) == 0UL ) K.append( i, n+c, 1.0 + double( c % 3UL ) );
+      }
+      K.finalize( i );
+   }
+
+   for( size_t c=0UL; c<m; ++c ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( ( j + c ) % ( m+3UL ) == 0UL ) K.append( n+c, j, 1.0 + double( c % 3UL ) );
+      }
+      K.append( n+c, n+c, -2.0 );
+      K.finalize( n+c );
+   }
+
+   return K;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates the right-hand side vector of the tests.
+//
+// \param n The size of the vector.
+// \return The right-hand side vector.
+*/
+template< typename Type >  // Data type of the vector
+blaze::DynamicVector<Type,blaze::columnVector> SupernodalTest::rhs( size_t n )
+{
+   blaze::DynamicVector<Type,blaze::columnVector> b( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      b[i] = Type( std::sin( double( i+1UL ) ) );
+   }
+
+   return b;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Counts the non-zero elements of the dense Cholesky factor of the permuted matrix.
+//
+// \param A The symmetric positive definite matrix.
+// \param p The permutation vector.
+// \return The number of non-zero elements of the lower triangular Cholesky factor.
+*/
+template< typename MT >  // Type of the sparse matrix
+size_t SupernodalTest::denseNonZeros( const MT& A, const std::vector<size_t>& p )
+{
+   using ET = typename MT::ElementType;
+
+   const size_t n( A.rows() );
+
+   blaze::DynamicMatrix<ET,blaze::columnMajor> D( n, n, ET(0) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         D(i,j) = A(p[i],p[j]);
+      }
+   }
+
+   blaze::blockedPotrf( D, 'L' );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      for( size_t i=j; i<n; ++i ) {
+         if( std::abs( D(i,j) ) > 1E-14 ) ++nonzeros;
+      }
+   }
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the supernodal sparse decompositions.
+//
+// \return void
+*/
+void runTest()
+{
+   SupernodalTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the supernodal decomposition test.
+*/
+#define RUN_SOLVERS_SUPERNODAL_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
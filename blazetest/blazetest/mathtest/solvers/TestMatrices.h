@@ -0,0 +1,116 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/TestMatrices.h
+//  \brief Header file for the test matrices of the solver tests
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_TESTMATRICES_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_TESTMATRICES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/CompressedMatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  TEST MATRICES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates the symmetric positive definite matrix of the 2D Laplace operator.
+//
+// \param k The number of grid points per dimension.
+// \return The \f$ k^2 \times k^2 \f$ five-point Laplace matrix.
+*/
+template< typename Type >  // Data type of the matrix
+blaze::CompressedMatrix<Type,blaze::rowMajor> laplace( size_t k )
+{
+   const size_t n( k*k );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( n, n );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i >= k ) A.append( i, i-k, Type(-1) );
+      if( i % k != 0UL ) A.append( i, i-1UL, Type(-1) );
+      A.append( i, i, Type(4) );
+      if( ( i+1UL ) % k != 0UL ) A.append( i, i+1UL, Type(-1) );
+      if( i+k < n ) A.append( i, i+k, Type(-1) );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a non-symmetric, diagonally dominant convection-diffusion matrix.
+//
+// \param n The size of the matrix.
+// \return The \f$ n \times n \f$ convection-diffusion matrix.
+*/
+template< typename Type >  // Data type of the matrix
+blaze::CompressedMatrix<Type,blaze::rowMajor> convection( size_t n )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( n, n );
+   A.reserve( 4UL*n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( i > 0UL ) A.append( i, i-1UL, Type(-1.5) );
+      A.append( i, i, Type(4) );
+      if( i+1UL < n ) A.append( i, i+1UL, Type(-0.5) );
+      if( i+7UL < n ) A.append( i, i+7UL, Type(0.3) );
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
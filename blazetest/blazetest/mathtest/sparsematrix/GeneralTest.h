@@ -43,6 +43,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
 
 
 namespace blazetest {
@@ -104,6 +105,13 @@ class GeneralTest
    void testMinimum();
    void testMaximum();
    void testTrace();
+   void testSum();
+   void testProd();
+   void testReduce();
+   void testSpGEMM();
+
+   template< bool SO >
+   void testSMPAssign();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -119,6 +127,9 @@ class GeneralTest
 
    template< typename Type >
    void checkNonZeros( const Type& matrix, size_t index, size_t expectedNonZeros ) const;
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& expected ) const;
    //@}
    //**********************************************************************************************
 
@@ -303,6 +314,46 @@ void GeneralTest::checkNonZeros( const Type& matrix, size_t index, size_t expect
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking the result of an SMP assignment against a serially evaluated reference.
+//
+// \param result The result of the SMP assignment.
+// \param expected The serially evaluated reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the values of the given result matrix and the number of non-zero
+// elements in all of its rows (row-major) or columns (column-major) against the given serially
+// evaluated reference. In case any difference is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type1    // Type of the result matrix
+        , typename Type2 >  // Type of the reference matrix
+void GeneralTest::checkResult( const Type1& result, const Type2& expected ) const
+{
+   checkRows    ( result, expected.rows() );
+   checkColumns ( result, expected.columns() );
+   checkNonZeros( result, expected.nonZeros() );
+
+   const size_t lines( blaze::IsRowMajorMatrix<Type1>::value ? result.rows() : result.columns() );
+
+   for( size_t k=0UL; k<lines; ++k ) {
+      checkNonZeros( result, k, expected.nonZeros( k ) );
+   }
+
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: SMP assignment failed\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
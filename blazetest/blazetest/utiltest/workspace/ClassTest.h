@@ -0,0 +1,211 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/workspace/ClassTest.h
+//  \brief Header file for the Workspace class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_WORKSPACE_CLASSTEST_H_
+#define _BLAZETEST_UTILTEST_WORKSPACE_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Workspace.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace workspace {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the test of the Workspace class.
+//
+// This class represents the collection of tests for the Workspace class and the associated
+// WorkspaceScope and WorkspaceArray classes.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testAllocation();
+   void testScope();
+   void testArray();
+   void testSteadyState();
+
+   template< typename Type >
+   void checkSize( const Type& workspace, size_t expectedSize ) const;
+
+   template< typename Type >
+   void checkAllocations( const Type& workspace, size_t expectedAllocations ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of bytes in use of the given workspace.
+//
+// \param workspace The workspace to be checked.
+// \param expectedSize The expected number of bytes in use.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Type of the workspace
+void ClassTest::checkSize( const Type& workspace, size_t expectedSize ) const
+{
+   if( workspace.size() != expectedSize ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid workspace size detected\n"
+          << " Details:\n"
+          << "   Size         : " << workspace.size() << "\n"
+          << "   Expected size: " << expectedSize << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of heap allocations of the given workspace.
+//
+// \param workspace The workspace to be checked.
+// \param expectedAllocations The expected number of heap allocations.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Type >  // Type of the workspace
+void ClassTest::checkAllocations( const Type& workspace, size_t expectedAllocations ) const
+{
+   if( workspace.allocations() != expectedAllocations ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of heap allocations detected\n"
+          << " Details:\n"
+          << "   Number of allocations         : " << workspace.allocations() << "\n"
+          << "   Expected number of allocations: " << expectedAllocations << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the Workspace class.
+//
+// \return void
+*/
+inline void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the Workspace class test.
+*/
+#define RUN_WORKSPACE_CLASS_TEST \
+   blazetest::utiltest::workspace::runTest();
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace workspace
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,3988 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/bandmatrix/ClassTest.cpp
+//  \brief Source file for the BandMatrix class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/math/views/Band.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blazetest/mathtest/bandmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace bandmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BandMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testScaling();
+   testFunctionCall();
+   testAt();
+   testIterator();
+   testNonZeros();
+   testInBand();
+   testIndex();
+   testReset();
+   testClear();
+   testResize();
+   testSwap();
+   testIsDefault();
+   testMult();
+   testBandView();
+   testSolve();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the BandMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   const DRMT ref{ { 1, 2, 3, 0 },
+                   { 4, 5, 6, 7 },
+                   { 0, 8, 9, 1 },
+                   { 0, 0, 2, 3 } };
+
+
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix default constructor";
+
+      MT mat;
+
+      checkRows      ( mat, 0UL );
+      checkColumns   ( mat, 0UL );
+      checkBandwidths( mat, 0UL, 0UL );
+      checkCapacity  ( mat, 0UL );
+      checkNonZeros  ( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix size constructor (0x0)";
+
+      MT mat( 0UL, 0UL, 0UL );
+
+      checkRows      ( mat, 0UL );
+      checkColumns   ( mat, 0UL );
+      checkBandwidths( mat, 0UL, 0UL );
+      checkCapacity  ( mat, 0UL );
+      checkNonZeros  ( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major BandMatrix size constructor (4x4)";
+
+      MT mat( 4UL, 1UL, 2UL );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 4UL );
+      checkBandwidths( mat, 1UL, 2UL );
+      checkCapacity  ( mat, 16UL );
+      checkNonZeros  ( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major BandMatrix size constructor (invalid lower bandwidth)";
+
+      try {
+         MT mat( 3UL, 3UL, 1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of band matrix with invalid lower bandwidth succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major BandMatrix size constructor (invalid upper bandwidth)";
+
+      try {
+         MT mat( 3UL, 1UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of band matrix with invalid upper bandwidth succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major BandMatrix size constructor (0x0 with bandwidth)";
+
+      try {
+         MT mat( 0UL, 1UL, 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of empty band matrix with bandwidth succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Row-major homogeneous initialization
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix homogeneous initialization constructor";
+
+      MT mat( 4UL, 1UL, 0UL, 2 );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 4UL );
+      checkBandwidths( mat, 1UL, 0UL );
+      checkCapacity  ( mat, 8UL );
+      checkNonZeros  ( mat, 7UL );
+      checkNonZeros  ( mat, 0UL, 1UL );
+      checkNonZeros  ( mat, 1UL, 2UL );
+      checkNonZeros  ( mat, 2UL, 2UL );
+      checkNonZeros  ( mat, 3UL, 2UL );
+
+      if( mat != DRMT{ { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 0, 2, 2, 0 }, { 0, 0, 2, 2 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 0 )\n( 2 2 0 0 )\n( 0 2 2 0 )\n( 0 0 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix conversion constructor (0x0)";
+
+      MT mat( DRMT{} );
+
+      checkRows      ( mat, 0UL );
+      checkColumns   ( mat, 0UL );
+      checkBandwidths( mat, 0UL, 0UL );
+      checkCapacity  ( mat, 0UL );
+      checkNonZeros  ( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major BandMatrix conversion constructor (row-major dense matrix)";
+
+      MT mat( ref );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 4UL );
+      checkBandwidths( mat, 1UL, 2UL );
+      checkCapacity  ( mat, 16UL );
+      checkNonZeros  ( mat, 12UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix conversion constructor (column-major sparse matrix)";
+
+      SCMT sparse( 3UL, 3UL );
+      sparse(0,0) = 1;
+      sparse(2,0) = 3;
+      sparse(1,2) = 5;
+
+      MT mat( sparse );
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 2UL, 1UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 3UL );
+
+      if( mat != DRMT{ { 1, 0, 0 }, { 0, 0, 5 }, { 3, 0, 0 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 0 5 )\n( 3 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix conversion constructor (non-square matrix)";
+
+      try {
+         MT mat( DRMT( 2UL, 3UL, 1 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of band matrix from non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Row-major conversion constructor with explicit bandwidths
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix conversion constructor (explicit bandwidths)";
+
+      MT mat( ref, 2UL, 3UL );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 4UL );
+      checkBandwidths( mat, 2UL, 3UL );
+      checkCapacity  ( mat, 24UL );
+      checkNonZeros  ( mat, 12UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix conversion constructor (too small lower bandwidth)";
+
+      try {
+         MT mat( ref, 0UL, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of band matrix with elements below the band succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major BandMatrix conversion constructor (too small upper bandwidth)";
+
+      try {
+         MT mat( ref, 1UL, 1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of band matrix with elements above the band succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major BandMatrix conversion constructor (invalid bandwidth)";
+
+      try {
+         MT mat( ref, 1UL, 4UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of band matrix with invalid upper bandwidth succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major BandMatrix conversion constructor (non-square matrix, bandwidths)";
+
+      try {
+         MT mat( DRMT( 2UL, 3UL, 1 ), 1UL, 1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of band matrix from non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Row-major copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix copy constructor";
+
+      const MT mat1( ref );
+      const MT mat2( mat1 );
+
+      checkRows      ( mat2, 4UL );
+      checkColumns   ( mat2, 4UL );
+      checkBandwidths( mat2, 1UL, 2UL );
+      checkCapacity  ( mat2, 16UL );
+      checkNonZeros  ( mat2, 12UL );
+
+      if( mat2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix default constructor";
+
+      OMT mat;
+
+      checkRows      ( mat, 0UL );
+      checkColumns   ( mat, 0UL );
+      checkBandwidths( mat, 0UL, 0UL );
+      checkCapacity  ( mat, 0UL );
+      checkNonZeros  ( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix size constructor (4x4)";
+
+      OMT mat( 4UL, 1UL, 2UL );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 4UL );
+      checkBandwidths( mat, 1UL, 2UL );
+      checkCapacity  ( mat, 16UL );
+      checkNonZeros  ( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major BandMatrix size constructor (invalid lower bandwidth)";
+
+      try {
+         OMT mat( 3UL, 3UL, 1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of band matrix with invalid lower bandwidth succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major homogeneous initialization
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix homogeneous initialization constructor";
+
+      OMT mat( 4UL, 1UL, 0UL, 2 );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 4UL );
+      checkBandwidths( mat, 1UL, 0UL );
+      checkCapacity  ( mat, 8UL );
+      checkNonZeros  ( mat, 7UL );
+      checkNonZeros  ( mat, 0UL, 2UL );
+      checkNonZeros  ( mat, 1UL, 2UL );
+      checkNonZeros  ( mat, 2UL, 2UL );
+      checkNonZeros  ( mat, 3UL, 1UL );
+
+      if( mat != DRMT{ { 2, 0, 0, 0 }, { 2, 2, 0, 0 }, { 0, 2, 2, 0 }, { 0, 0, 2, 2 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 0 )\n( 2 2 0 0 )\n( 0 2 2 0 )\n( 0 0 2 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix conversion constructor (row-major dense matrix)";
+
+      OMT mat( ref );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 4UL );
+      checkBandwidths( mat, 1UL, 2UL );
+      checkCapacity  ( mat, 16UL );
+      checkNonZeros  ( mat, 12UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix conversion constructor (row-major sparse matrix)";
+
+      SRMT sparse( 3UL, 3UL );
+      sparse(0,0) = 1;
+      sparse(2,0) = 3;
+      sparse(1,2) = 5;
+
+      OMT mat( sparse );
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 2UL, 1UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 3UL );
+
+      if( mat != DRMT{ { 1, 0, 0 }, { 0, 0, 5 }, { 3, 0, 0 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 0 5 )\n( 3 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix conversion constructor (non-square matrix)";
+
+      try {
+         OMT mat( DCMT( 3UL, 2UL, 1 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of band matrix from non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major conversion constructor with explicit bandwidths
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix conversion constructor (explicit bandwidths)";
+
+      OMT mat( ref, 3UL, 2UL );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 4UL );
+      checkBandwidths( mat, 3UL, 2UL );
+      checkCapacity  ( mat, 24UL );
+      checkNonZeros  ( mat, 12UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix conversion constructor (too small bandwidths)";
+
+      try {
+         OMT mat( ref, 0UL, 1UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of band matrix with elements outside the band succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix copy constructor";
+
+      const OMT mat1( ref );
+      const OMT mat2( mat1 );
+
+      checkRows      ( mat2, 4UL );
+      checkColumns   ( mat2, 4UL );
+      checkBandwidths( mat2, 1UL, 2UL );
+      checkCapacity  ( mat2, 16UL );
+      checkNonZeros  ( mat2, 12UL );
+
+      if( mat2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix conversion constructor (row-major band matrix)";
+
+      const MT mat1( ref );
+      const OMT mat2( mat1 );
+
+      checkRows      ( mat2, 4UL );
+      checkColumns   ( mat2, 4UL );
+      checkBandwidths( mat2, 1UL, 2UL );
+      checkCapacity  ( mat2, 16UL );
+      checkNonZeros  ( mat2, 12UL );
+
+      if( mat2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the BandMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   const DRMT ref{ { 1, 2, 3, 0 },
+                   { 4, 5, 6, 7 },
+                   { 0, 8, 9, 1 },
+                   { 0, 0, 2, 3 } };
+
+
+   //=====================================================================================
+   // Row-major BandMatrix copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix copy assignment";
+
+      const MT mat1( ref );
+      MT mat2( 2UL, 0UL, 1UL, 5 );
+
+      mat2 = mat1;
+
+      checkRows      ( mat2, 4UL );
+      checkColumns   ( mat2, 4UL );
+      checkBandwidths( mat2, 1UL, 2UL );
+      checkCapacity  ( mat2, 16UL );
+      checkNonZeros  ( mat2, 12UL );
+
+      if( mat2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix copy assignment stress test";
+
+      MT mat( ref );
+
+      mat = mat;
+
+      checkRows      ( mat, 4UL );
+      checkBandwidths( mat, 1UL, 2UL );
+      checkCapacity  ( mat, 16UL );
+      checkNonZeros  ( mat, 12UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Self-assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix dense matrix assignment";
+
+      MT mat( 2UL, 0UL, 1UL, 5 );
+
+      mat = DRMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 4, 5 } };
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 0UL );
+      checkCapacity  ( mat, 6UL );
+      checkNonZeros  ( mat, 5UL );
+
+      if( mat != DRMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 4, 5 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 2 3 0 )\n( 0 4 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix dense matrix assignment (non-square matrix)";
+
+      MT mat( ref );
+
+      try {
+         mat = DRMT( 2UL, 3UL, 1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkRows      ( mat, 4UL );
+      checkBandwidths( mat, 1UL, 2UL );
+      checkCapacity  ( mat, 16UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed assignment modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix sparse matrix assignment";
+
+      SRMT sparse( 3UL, 3UL );
+      sparse(0,2) = 7;
+      sparse(1,1) = 8;
+
+      MT mat( ref );
+
+      mat = sparse;
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 0UL, 2UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 2UL );
+
+      if( mat != DRMT{ { 0, 0, 7 }, { 0, 8, 0 }, { 0, 0, 0 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 7 )\n( 0 8 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major BandMatrix copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix copy assignment";
+
+      const OMT mat1( ref );
+      OMT mat2( 2UL, 0UL, 1UL, 5 );
+
+      mat2 = mat1;
+
+      checkRows      ( mat2, 4UL );
+      checkColumns   ( mat2, 4UL );
+      checkBandwidths( mat2, 1UL, 2UL );
+      checkCapacity  ( mat2, 16UL );
+      checkNonZeros  ( mat2, 12UL );
+
+      if( mat2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix row-major band matrix assignment";
+
+      const MT mat1( ref );
+      OMT mat2;
+
+      mat2 = mat1;
+
+      checkRows      ( mat2, 4UL );
+      checkColumns   ( mat2, 4UL );
+      checkBandwidths( mat2, 1UL, 2UL );
+      checkCapacity  ( mat2, 16UL );
+      checkNonZeros  ( mat2, 12UL );
+
+      if( mat2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix dense matrix assignment";
+
+      OMT mat( 2UL, 0UL, 1UL, 5 );
+
+      mat = DCMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 4, 5 } };
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 0UL );
+      checkCapacity  ( mat, 6UL );
+      checkNonZeros  ( mat, 5UL );
+
+      if( mat != DRMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 4, 5 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 2 3 0 )\n( 0 4 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix dense matrix assignment (non-square matrix)";
+
+      OMT mat( ref );
+
+      try {
+         mat = DCMT( 3UL, 2UL, 1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-square matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkRows      ( mat, 4UL );
+      checkBandwidths( mat, 1UL, 2UL );
+      checkCapacity  ( mat, 16UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed assignment modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix addition assignment operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operator of the BandMatrix class
+// template. Next to the addition within the band this includes the extension of the band in
+// case the right-hand side matrix has non-zero elements outside of the band. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   //=====================================================================================
+   // Row-major BandMatrix addition assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix addition assignment (within the band)";
+
+      MT mat( 3UL, 1UL, 1UL, 1 );
+
+      mat += DRMT{ { 1, 2, 0 }, { 0, 3, 0 }, { 0, -1, 4 } };
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 6UL );
+
+      if( mat != DRMT{ { 2, 3, 0 }, { 1, 4, 1 }, { 0, 0, 5 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 3 0 )\n( 1 4 1 )\n( 0 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix addition assignment (band extension)";
+
+      MT mat( 3UL, 0UL, 1UL, 1 );
+
+      mat += DRMT{ { 0, 0, 3 }, { 2, 0, 0 }, { 0, 0, 0 } };
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 2UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 7UL );
+
+      if( mat != DRMT{ { 1, 1, 3 }, { 2, 1, 1 }, { 0, 0, 1 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 1 3 )\n( 2 1 1 )\n( 0 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix addition assignment (sparse matrix)";
+
+      SCMT sparse( 3UL, 3UL );
+      sparse(2,0) = 4;
+
+      MT mat( 3UL, 0UL, 0UL, 1 );
+
+      mat += sparse;
+
+      checkBandwidths( mat, 2UL, 0UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 4UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 1 || mat(2,2) != 1 || mat(2,0) != 4 ||
+          mat(1,0) != 0 || mat(2,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 1 0 )\n( 4 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix addition assignment (aliasing)";
+
+      MT mat( DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } );
+
+      mat += mat;
+
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 7UL );
+
+      if( mat != DRMT{ { 2, 4, 0 }, { 6, 8, 10 }, { 0, 12, 14 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 4 0 )\n( 6 8 10 )\n( 0 12 14 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix addition assignment (invalid size)";
+
+      MT mat( 3UL, 1UL, 1UL, 1 );
+
+      try {
+         mat += DRMT( 4UL, 4UL, 1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major BandMatrix addition assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix addition assignment (within the band)";
+
+      OMT mat( 3UL, 1UL, 1UL, 1 );
+
+      mat += DCMT{ { 1, 2, 0 }, { 0, 3, 0 }, { 0, -1, 4 } };
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 6UL );
+
+      if( mat != DRMT{ { 2, 3, 0 }, { 1, 4, 1 }, { 0, 0, 5 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 3 0 )\n( 1 4 1 )\n( 0 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix addition assignment (band extension)";
+
+      OMT mat( 3UL, 0UL, 1UL, 1 );
+
+      mat += DRMT{ { 0, 0, 3 }, { 2, 0, 0 }, { 0, 0, 0 } };
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 2UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 7UL );
+
+      if( mat != DRMT{ { 1, 1, 3 }, { 2, 1, 1 }, { 0, 0, 1 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 1 3 )\n( 2 1 1 )\n( 0 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix addition assignment (invalid size)";
+
+      OMT mat( 3UL, 1UL, 1UL, 1 );
+
+      try {
+         mat += DCMT( 4UL, 4UL, 1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix subtraction assignment operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operator of the BandMatrix class
+// template. Next to the subtraction within the band this includes the extension of the band in
+// case the right-hand side matrix has non-zero elements outside of the band. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   //=====================================================================================
+   // Row-major BandMatrix subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix subtraction assignment (within the band)";
+
+      MT mat( 3UL, 1UL, 1UL, 1 );
+
+      mat -= DRMT{ { 1, 2, 0 }, { 0, 3, 0 }, { 0, -1, 4 } };
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 6UL );
+
+      if( mat != DRMT{ { 0, -1, 0 }, { 1, -2, 1 }, { 0, 2, -3 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 -1 0 )\n( 1 -2 1 )\n( 0 2 -3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix subtraction assignment (band extension)";
+
+      MT mat( 3UL, 0UL, 0UL, 1 );
+
+      mat -= DRMT{ { 0, 0, 3 }, { 0, 0, 0 }, { 2, 0, 0 } };
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 2UL, 2UL );
+      checkCapacity  ( mat, 15UL );
+      checkNonZeros  ( mat, 5UL );
+
+      if( mat != DRMT{ { 1, 0, -3 }, { 0, 1, 0 }, { -2, 0, 1 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 -3 )\n( 0 1 0 )\n( -2 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix subtraction assignment (aliasing)";
+
+      MT mat( DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } );
+
+      mat -= mat;
+
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major BandMatrix subtraction assignment (invalid size)";
+
+      MT mat( 3UL, 1UL, 1UL, 1 );
+
+      try {
+         mat -= DRMT( 2UL, 2UL, 1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment of matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major BandMatrix subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix subtraction assignment (within the band)";
+
+      OMT mat( 3UL, 1UL, 1UL, 1 );
+
+      mat -= DCMT{ { 1, 2, 0 }, { 0, 3, 0 }, { 0, -1, 4 } };
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 6UL );
+
+      if( mat != DRMT{ { 0, -1, 0 }, { 1, -2, 1 }, { 0, 2, -3 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 -1 0 )\n( 1 -2 1 )\n( 0 2 -3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix subtraction assignment (band extension)";
+
+      OMT mat( 3UL, 0UL, 0UL, 1 );
+
+      mat -= DCMT{ { 0, 0, 3 }, { 0, 0, 0 }, { 2, 0, 0 } };
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 2UL, 2UL );
+      checkCapacity  ( mat, 15UL );
+      checkNonZeros  ( mat, 5UL );
+
+      if( mat != DRMT{ { 1, 0, -3 }, { 0, 1, 0 }, { -2, 0, 1 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 -3 )\n( 0 1 0 )\n( -2 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all BandMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the BandMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   //=====================================================================================
+   // Row-major self-scaling (M*=s)
+   //=====================================================================================
+
+   {
+      test_ = "Row-major self-scaling (M*=s)";
+
+      MT mat( DRMT{ { 1, 2, 0 }, { 0, 3, 4 }, { 0, 0, -5 } } );
+
+      mat *= 3;
+
+      checkBandwidths( mat, 0UL, 1UL );
+      checkCapacity  ( mat, 6UL );
+      checkNonZeros  ( mat, 5UL );
+
+      if( mat != DRMT{ { 3, 6, 0 }, { 0, 9, 12 }, { 0, 0, -15 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 6 0 )\n( 0 9 12 )\n( 0 0 -15 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major self-scaling (M/=s)
+   //=====================================================================================
+
+   {
+      test_ = "Row-major self-scaling (M/=s)";
+
+      MT mat( DRMT{ { 2, 4, 0 }, { 0, 6, 8 }, { 0, 0, -10 } } );
+
+      mat /= 2;
+
+      checkBandwidths( mat, 0UL, 1UL );
+      checkCapacity  ( mat, 6UL );
+      checkNonZeros  ( mat, 5UL );
+
+      if( mat != DRMT{ { 1, 2, 0 }, { 0, 3, 4 }, { 0, 0, -5 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 0 3 4 )\n( 0 0 -5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major self-scaling (M*=s)
+   //=====================================================================================
+
+   {
+      test_ = "Column-major self-scaling (M*=s)";
+
+      OMT mat( DRMT{ { 1, 2, 0 }, { 0, 3, 4 }, { 0, 0, -5 } } );
+
+      mat *= 3;
+
+      checkBandwidths( mat, 0UL, 1UL );
+      checkCapacity  ( mat, 6UL );
+      checkNonZeros  ( mat, 5UL );
+
+      if( mat != DRMT{ { 3, 6, 0 }, { 0, 9, 12 }, { 0, 0, -15 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 6 0 )\n( 0 9 12 )\n( 0 0 -15 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major self-scaling (M/=s)
+   //=====================================================================================
+
+   {
+      test_ = "Column-major self-scaling (M/=s)";
+
+      OMT mat( DRMT{ { 2, 4, 0 }, { 0, 6, 8 }, { 0, 0, -10 } } );
+
+      mat /= 2;
+
+      checkBandwidths( mat, 0UL, 1UL );
+      checkCapacity  ( mat, 6UL );
+      checkNonZeros  ( mat, 5UL );
+
+      if( mat != DRMT{ { 1, 2, 0 }, { 0, 3, 4 }, { 0, 0, -5 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 0 3 4 )\n( 0 0 -5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the BandMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix::operator()";
+
+      MT mat( 4UL, 1UL, 1UL );
+
+      // Writing the diagonal element (0,0)
+      mat(0,0) = 1;
+
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 1UL );
+      checkNonZeros  ( mat, 0UL, 1UL );
+
+      // Writing the subdiagonal element (1,0)
+      mat(1,0) = 2;
+
+      checkCapacity( mat, 12UL );
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+
+      // Writing the superdiagonal element (2,3)
+      mat(2,3) = 3;
+
+      checkCapacity( mat, 12UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      // Adding to the diagonal element (3,3)
+      mat(3,3) += 4;
+
+      // Subtracting from the superdiagonal element (2,3)
+      mat(2,3) -= 5;
+
+      // Multiplying the subdiagonal element (1,0)
+      mat(1,0) *= -3;
+
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 4UL );
+
+      if( mat != DRMT{ { 1, 0, 0, 0 }, { -6, 0, 0, 0 }, { 0, 0, 0, -2 }, { 0, 0, 0, 4 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 0 )\n( -6 0 0 0 )\n( 0 0 0 -2 )\n( 0 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix::operator() const";
+
+      MT mat( DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } );
+      const MT& cmat( mat );
+
+      if( cmat(0,0) != 1 || cmat(0,1) != 2 || cmat(0,2) != 0 ||
+          cmat(1,0) != 3 || cmat(1,1) != 4 || cmat(1,2) != 5 ||
+          cmat(2,0) != 0 || cmat(2,1) != 6 || cmat(2,2) != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << cmat << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 3 4 5 )\n( 0 6 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix::operator()";
+
+      OMT mat( 4UL, 1UL, 1UL );
+
+      // Writing the diagonal element (0,0)
+      mat(0,0) = 1;
+
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 1UL );
+      checkNonZeros  ( mat, 0UL, 1UL );
+
+      // Writing the subdiagonal element (1,0)
+      mat(1,0) = 2;
+
+      checkCapacity( mat, 12UL );
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 0UL, 2UL );
+
+      // Writing the superdiagonal element (2,3)
+      mat(2,3) = 3;
+
+      checkCapacity( mat, 12UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 3UL, 1UL );
+
+      // Adding to the diagonal element (3,3)
+      mat(3,3) += 4;
+
+      // Subtracting from the superdiagonal element (2,3)
+      mat(2,3) -= 5;
+
+      // Multiplying the subdiagonal element (1,0)
+      mat(1,0) *= -3;
+
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 4UL );
+
+      if( mat != DRMT{ { 1, 0, 0, 0 }, { -6, 0, 0, 0 }, { 0, 0, 0, -2 }, { 0, 0, 0, 4 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 0 )\n( -6 0 0 0 )\n( 0 0 0 -2 )\n( 0 0 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix::operator() const";
+
+      OMT mat( DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } );
+      const OMT& cmat( mat );
+
+      if( cmat(0,0) != 1 || cmat(0,1) != 2 || cmat(0,2) != 0 ||
+          cmat(1,0) != 3 || cmat(1,1) != 4 || cmat(1,2) != 5 ||
+          cmat(2,0) != 0 || cmat(2,1) != 6 || cmat(2,2) != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << cmat << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 3 4 5 )\n( 0 6 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the \c at() member
+// function of the BandMatrix class template. This includes the enforcement of the band limits,
+// i.e. the rejection of write accesses to elements outside of the band. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix::at()";
+
+      MT mat( 4UL, 1UL, 1UL );
+
+      mat.at(0,0) = 1;
+      mat.at(1,2) = 2;
+      mat.at(3,2) = 3;
+      mat.at(3,2) += 4;
+
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 3UL );
+
+      if( mat.at(0,0) != 1 || mat.at(1,2) != 2 || mat.at(3,2) != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via at() function failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 0 )\n( 0 0 2 0 )\n( 0 0 0 0 )\n( 0 0 7 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix::at() (write above the band)";
+
+      MT mat( 4UL, 1UL, 1UL, 1 );
+
+      try {
+         mat.at(0,2) = 5;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Write access above the band succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 10UL );
+
+      if( mat != DRMT{ { 1, 1, 0, 0 }, { 1, 1, 1, 0 }, { 0, 1, 1, 1 }, { 0, 0, 1, 1 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Rejected write access modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 1 0 0 )\n( 1 1 1 0 )\n( 0 1 1 1 )\n( 0 0 1 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix::at() (write below the band)";
+
+      MT mat( 4UL, 1UL, 1UL, 1 );
+
+      try {
+         mat.at(3,0) = 5;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Write access below the band succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 10UL );
+   }
+
+   {
+      test_ = "Row-major BandMatrix::at() (invalid row index)";
+
+      MT mat( 4UL, 1UL, 1UL );
+
+      try {
+         mat.at(4,0) = 5;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+
+   {
+      test_ = "Row-major BandMatrix::at() (invalid column index)";
+
+      MT mat( 4UL, 1UL, 1UL );
+
+      try {
+         mat.at(0,4) = 5;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+
+   {
+      test_ = "Row-major BandMatrix::at() const";
+
+      const MT mat( 4UL, 1UL, 1UL, 1 );
+
+      if( mat.at(0,0) != 1 || mat.at(1,0) != 1 || mat.at(0,2) != 0 || mat.at(3,0) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via at() function failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 1 0 0 )\n( 1 1 1 0 )\n( 0 1 1 1 )\n( 0 0 1 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat.at(0,4);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix::at()";
+
+      OMT mat( 4UL, 1UL, 1UL );
+
+      mat.at(0,0) = 1;
+      mat.at(1,2) = 2;
+      mat.at(3,2) = 3;
+      mat.at(3,2) += 4;
+
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 3UL );
+
+      if( mat.at(0,0) != 1 || mat.at(1,2) != 2 || mat.at(3,2) != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via at() function failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 0 )\n( 0 0 2 0 )\n( 0 0 0 0 )\n( 0 0 7 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix::at() (write above the band)";
+
+      OMT mat( 4UL, 1UL, 0UL, 1 );
+
+      try {
+         mat.at(1,2) = 5;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Write access above the band succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkBandwidths( mat, 1UL, 0UL );
+      checkCapacity  ( mat, 8UL );
+      checkNonZeros  ( mat, 7UL );
+   }
+
+   {
+      test_ = "Column-major BandMatrix::at() (write below the band)";
+
+      OMT mat( 4UL, 1UL, 0UL, 1 );
+
+      try {
+         mat.at(2,0) = 5;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Write access below the band succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkBandwidths( mat, 1UL, 0UL );
+      checkCapacity  ( mat, 8UL );
+      checkNonZeros  ( mat, 7UL );
+
+      if( mat != DRMT{ { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 0, 1, 1, 0 }, { 0, 0, 1, 1 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Rejected write access modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 0 )\n( 1 1 0 0 )\n( 0 1 1 0 )\n( 0 0 1 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix::at() (invalid index)";
+
+      OMT mat( 4UL, 1UL, 1UL );
+
+      try {
+         mat.at(4,4) = 5;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound access succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the BandMatrix class
+// template. The iterators traverse a complete row/column of the matrix, including all zero
+// elements outside of the band. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      typedef MT::ConstIterator  ConstIterator;
+
+      const MT mat( DRMT{ { 1, 2, 3, 0 }, { 4, 5, 6, 7 }, { 0, 8, 9, 1 }, { 0, 0, 2, 3 } } );
+
+      // Counting the number of elements in 0th row via ConstIterator (end-begin)
+      {
+         test_ = "Row-major ConstIterator subtraction (end-begin)";
+
+         const ptrdiff_t number( cend( mat, 0UL ) - cbegin( mat, 0UL ) );
+
+         if( number != 4L ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of elements detected\n"
+                << " Details:\n"
+                << "   Number of elements         : " << number << "\n"
+                << "   Expected number of elements: 4\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Counting the number of elements in 3rd row via ConstIterator (begin-end)
+      {
+         test_ = "Row-major ConstIterator subtraction (begin-end)";
+
+         const ptrdiff_t number( cbegin( mat, 3UL ) - cend( mat, 3UL ) );
+
+         if( number != -4L ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of elements detected\n"
+                << " Details:\n"
+                << "   Number of elements         : " << number << "\n"
+                << "   Expected number of elements: -4\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Testing read-only access via ConstIterator
+      {
+         test_ = "Row-major read-only access via ConstIterator";
+
+         ConstIterator it ( cbegin( mat, 2UL ) );
+         ConstIterator end( cend( mat, 2UL ) );
+
+         if( it == end || *it != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid initial iterator detected\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         ++it;
+
+         if( it == end || *it != 8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator pre-increment failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         it++;
+
+         if( it == end || *it != 9 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator post-increment failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         --it;
+
+         if( it == end || *it != 8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator pre-decrement failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         it += 2UL;
+
+         if( it == end || *it != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator addition assignment failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         it -= 3UL;
+
+         if( it == end || *it != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator subtraction assignment failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         it = it + 4UL;
+
+         if( it != end ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator end not reached\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Testing the traversal of all rows via ConstIterator
+      {
+         test_ = "Row-major traversal via ConstIterator";
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            size_t j( 0UL );
+            for( ConstIterator it=mat.begin(i); it!=mat.end(i); ++it, ++j ) {
+               if( *it != mat(i,j) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Invalid element (" << i << "," << j << ") detected\n"
+                      << " Details:\n"
+                      << "   Value         : " << *it << "\n"
+                      << "   Expected value: " << mat(i,j) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      typedef OMT::ConstIterator  ConstIterator;
+
+      const OMT mat( DRMT{ { 1, 2, 3, 0 }, { 4, 5, 6, 7 }, { 0, 8, 9, 1 }, { 0, 0, 2, 3 } } );
+
+      // Counting the number of elements in 0th column via ConstIterator (end-begin)
+      {
+         test_ = "Column-major ConstIterator subtraction (end-begin)";
+
+         const ptrdiff_t number( cend( mat, 0UL ) - cbegin( mat, 0UL ) );
+
+         if( number != 4L ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of elements detected\n"
+                << " Details:\n"
+                << "   Number of elements         : " << number << "\n"
+                << "   Expected number of elements: 4\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Testing read-only access via ConstIterator
+      {
+         test_ = "Column-major read-only access via ConstIterator";
+
+         ConstIterator it ( cbegin( mat, 2UL ) );
+         ConstIterator end( cend( mat, 2UL ) );
+
+         if( it == end || *it != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid initial iterator detected\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         ++it;
+
+         if( it == end || *it != 6 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator pre-increment failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         it += 2UL;
+
+         if( it == end || *it != 2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator addition assignment failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         it--;
+
+         if( it == end || *it != 9 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator post-decrement failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         it = 2UL + it;
+
+         if( it != end ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator end not reached\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Testing the traversal of all columns via ConstIterator
+      {
+         test_ = "Column-major traversal via ConstIterator";
+
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            size_t i( 0UL );
+            for( ConstIterator it=mat.begin(j); it!=mat.end(j); ++it, ++i ) {
+               if( *it != mat(i,j) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Invalid element (" << i << "," << j << ") detected\n"
+                      << " Details:\n"
+                      << "   Value         : " << *it << "\n"
+                      << "   Expected value: " << mat(i,j) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the BandMatrix class
+// template. Only the non-zero elements inside of the band are counted, stored zeros are not.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix::nonZeros()";
+
+      MT mat( 4UL, 1UL, 2UL );
+
+      checkCapacity( mat, 16UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+      checkNonZeros( mat, 3UL, 0UL );
+
+      mat(0,2) = 1;
+      mat(1,0) = 2;
+      mat(1,1) = 3;
+      mat(1,3) = 4;
+      mat(3,3) = 5;
+
+      checkCapacity( mat, 16UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 3UL );
+      checkNonZeros( mat, 2UL, 0UL );
+      checkNonZeros( mat, 3UL, 1UL );
+
+      mat(1,1) = 0;
+
+      checkCapacity( mat, 16UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 1UL, 2UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix::nonZeros()";
+
+      OMT mat( 4UL, 1UL, 2UL );
+
+      checkCapacity( mat, 16UL );
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+      checkNonZeros( mat, 3UL, 0UL );
+
+      mat(0,2) = 1;
+      mat(1,0) = 2;
+      mat(1,1) = 3;
+      mat(1,3) = 4;
+      mat(3,3) = 5;
+
+      checkCapacity( mat, 16UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkNonZeros( mat, 3UL, 2UL );
+
+      mat(1,1) = 0;
+
+      checkCapacity( mat, 16UL );
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 1UL, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c inBand() member function of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c inBand() member function of the BandMatrix class
+// template, which defines the band limits of the matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInBand()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix::inBand()";
+
+      const MT mat( 5UL, 1UL, 2UL );
+
+      for( size_t i=0UL; i<5UL; ++i ) {
+         for( size_t j=0UL; j<5UL; ++j ) {
+            const bool expected( i <= j+1UL && j <= i+2UL );
+            if( mat.inBand( i, j ) != expected ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid band limit detected\n"
+                   << " Details:\n"
+                   << "   Element        : (" << i << "," << j << ")\n"
+                   << "   Result         : " << mat.inBand( i, j ) << "\n"
+                   << "   Expected result: " << expected << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      if( !mat.inBand( 2UL, 1UL ) || mat.inBand( 3UL, 1UL ) ||
+          !mat.inBand( 0UL, 2UL ) || mat.inBand( 0UL, 3UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid band limit detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix::inBand()";
+
+      const OMT mat( 5UL, 2UL, 0UL );
+
+      for( size_t i=0UL; i<5UL; ++i ) {
+         for( size_t j=0UL; j<5UL; ++j ) {
+            const bool expected( i <= j+2UL && j <= i );
+            if( mat.inBand( i, j ) != expected ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid band limit detected\n"
+                   << " Details:\n"
+                   << "   Element        : (" << i << "," << j << ")\n"
+                   << "   Result         : " << mat.inBand( i, j ) << "\n"
+                   << "   Expected result: " << expected << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c index() member function of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c index() and \c data() member functions of the
+// BandMatrix class template, i.e. of the band storage layout. Row-major matrices store row
+// \f$ i \f$ at offset \f$ i(KL+KU+1) \f$ with element \f$ a_{ij} \f$ at position
+// \f$ KL+j-i \f$, column-major matrices use the LAPACK band layout. All storage positions that
+// do not correspond to an element of the matrix have to remain 0. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndex()
+{
+   const DRMT ref{ { 1, 2, 3, 0 },
+                   { 4, 5, 6, 7 },
+                   { 0, 8, 9, 1 },
+                   { 0, 0, 2, 3 } };
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix::index()";
+
+      const MT mat( ref );
+
+      if( mat.index(0,0) !=  1UL || mat.index(0,2) !=  3UL || mat.index(1,0) !=  4UL ||
+          mat.index(1,3) !=  7UL || mat.index(2,1) !=  8UL || mat.index(2,3) != 10UL ||
+          mat.index(3,2) != 12UL || mat.index(3,3) != 13UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid storage position detected\n"
+             << " Details:\n"
+             << "   Position of (0,0): " << mat.index(0,0) << " (expected 1)\n"
+             << "   Position of (1,0): " << mat.index(1,0) << " (expected 4)\n"
+             << "   Position of (3,3): " << mat.index(3,3) << " (expected 13)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix::data()";
+
+      const MT mat( ref );
+      const int expected[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 1, 0, 2, 3, 0, 0 };
+
+      for( size_t k=0UL; k<16UL; ++k ) {
+         if( mat.data()[k] != expected[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid band storage detected\n"
+                << " Details:\n"
+                << "   Position      : " << k << "\n"
+                << "   Value         : " << mat.data()[k] << "\n"
+                << "   Expected value: " << expected[k] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( mat.data( 1UL ) != nullptr ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Row-wise data access returned a non-null pointer\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix::data() (write access)";
+
+      MT mat( ref );
+      mat.data()[mat.index(3,2)] = 11;
+      mat.data()[mat.index(0,1)] = 0;
+
+      checkCapacity( mat, 16UL );
+      checkNonZeros( mat, 11UL );
+
+      if( mat(3,2) != 11 || mat(0,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Write access via data() failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 11 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix::index()";
+
+      const OMT mat( ref );
+
+      if( mat.index(0,0) !=  2UL || mat.index(1,0) !=  3UL || mat.index(0,1) !=  5UL ||
+          mat.index(2,1) !=  7UL || mat.index(0,2) !=  8UL || mat.index(3,2) != 11UL ||
+          mat.index(1,3) != 12UL || mat.index(3,3) != 14UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid storage position detected\n"
+             << " Details:\n"
+             << "   Position of (0,0): " << mat.index(0,0) << " (expected 2)\n"
+             << "   Position of (0,2): " << mat.index(0,2) << " (expected 8)\n"
+             << "   Position of (3,3): " << mat.index(3,3) << " (expected 14)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix::data()";
+
+      const OMT mat( ref );
+      const int expected[16] = { 0, 0, 1, 4, 0, 2, 5, 8, 3, 6, 9, 2, 7, 1, 3, 0 };
+
+      for( size_t k=0UL; k<16UL; ++k ) {
+         if( mat.data()[k] != expected[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid band storage detected\n"
+                << " Details:\n"
+                << "   Position      : " << k << "\n"
+                << "   Value         : " << mat.data()[k] << "\n"
+                << "   Expected value: " << expected[k] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( mat.data( 1UL ) != nullptr ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Column-wise data access returned a non-null pointer\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix::data() (write access)";
+
+      OMT mat( ref );
+      mat.data()[mat.index(3,2)] = 11;
+      mat.data()[mat.index(0,1)] = 0;
+
+      checkCapacity( mat, 16UL );
+      checkNonZeros( mat, 11UL );
+
+      if( mat(3,2) != 11 || mat(0,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Write access via data() failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 3 0 )\n( 4 5 6 7 )\n( 0 8 9 1 )\n( 0 0 11 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the BandMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   using blaze::reset;
+
+
+   //=====================================================================================
+   // Row-major BandMatrix::reset()
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix::reset()";
+
+      MT mat( DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } );
+
+      // Resetting a single element
+      reset( mat(1,1) );
+
+      checkRows      ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 6UL );
+
+      if( mat != DRMT{ { 1, 2, 0 }, { 3, 0, 5 }, { 0, 6, 7 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 3 0 5 )\n( 0 6 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Resetting the entire matrix
+      reset( mat );
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major BandMatrix::reset()
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix::reset()";
+
+      OMT mat( DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } );
+
+      // Resetting a single element
+      reset( mat(1,1) );
+
+      checkRows      ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 6UL );
+
+      if( mat != DRMT{ { 1, 2, 0 }, { 3, 0, 5 }, { 0, 6, 7 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 3 0 5 )\n( 0 6 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Resetting the entire matrix
+      reset( mat );
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the BandMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   using blaze::clear;
+
+
+   //=====================================================================================
+   // Row-major BandMatrix::clear()
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix::clear()";
+
+      MT mat( DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } );
+
+      clear( mat );
+
+      checkRows      ( mat, 0UL );
+      checkColumns   ( mat, 0UL );
+      checkBandwidths( mat, 0UL, 0UL );
+      checkCapacity  ( mat, 0UL );
+      checkNonZeros  ( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major BandMatrix::clear()
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix::clear()";
+
+      OMT mat( DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } );
+
+      clear( mat );
+
+      checkRows      ( mat, 0UL );
+      checkColumns   ( mat, 0UL );
+      checkBandwidths( mat, 0UL, 0UL );
+      checkCapacity  ( mat, 0UL );
+      checkNonZeros  ( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the BandMatrix class
+// template. Next to the size this includes the change of the bandwidths, which drops all
+// elements outside of the new band. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   //=====================================================================================
+   // Row-major BandMatrix::resize()
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix::resize()";
+
+      MT mat( DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } );
+
+      // Increasing the size of the matrix
+      mat.resize( 4UL, 1UL, 1UL );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 4UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 7UL );
+
+      if( mat != DRMT{ { 1, 2, 0, 0 }, { 3, 4, 5, 0 }, { 0, 6, 7, 0 }, { 0, 0, 0, 0 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 0 0 )\n( 3 4 5 0 )\n( 0 6 7 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Changing the bandwidths of the matrix
+      mat.resize( 4UL, 0UL, 2UL );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 4UL );
+      checkBandwidths( mat, 0UL, 2UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 5UL );
+
+      if( mat != DRMT{ { 1, 2, 0, 0 }, { 0, 4, 5, 0 }, { 0, 0, 7, 0 }, { 0, 0, 0, 0 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Changing the bandwidths failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 0 0 )\n( 0 4 5 0 )\n( 0 0 7 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Decreasing the size of the matrix
+      mat.resize( 2UL, 0UL, 1UL );
+
+      checkRows      ( mat, 2UL );
+      checkColumns   ( mat, 2UL );
+      checkBandwidths( mat, 0UL, 1UL );
+      checkCapacity  ( mat, 4UL );
+      checkNonZeros  ( mat, 3UL );
+
+      if( mat != DRMT{ { 1, 2 }, { 0, 4 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 )\n( 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Resizing the matrix without preserving the elements
+      mat.resize( 3UL, 1UL, 1UL, false );
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 0UL );
+
+      // Resizing to 0x0
+      mat.resize( 0UL, 0UL, 0UL );
+
+      checkRows      ( mat, 0UL );
+      checkColumns   ( mat, 0UL );
+      checkBandwidths( mat, 0UL, 0UL );
+      checkCapacity  ( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major BandMatrix::resize() (invalid bandwidth)";
+
+      MT mat( 3UL, 1UL, 1UL, 1 );
+
+      try {
+         mat.resize( 2UL, 2UL, 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to an invalid bandwidth succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkRows      ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 7UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major BandMatrix::resize()
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix::resize()";
+
+      OMT mat( DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } );
+
+      // Increasing the size of the matrix
+      mat.resize( 4UL, 1UL, 1UL );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 4UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 7UL );
+
+      if( mat != DRMT{ { 1, 2, 0, 0 }, { 3, 4, 5, 0 }, { 0, 6, 7, 0 }, { 0, 0, 0, 0 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 0 0 )\n( 3 4 5 0 )\n( 0 6 7 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Changing the bandwidths of the matrix
+      mat.resize( 4UL, 2UL, 0UL );
+
+      checkRows      ( mat, 4UL );
+      checkColumns   ( mat, 4UL );
+      checkBandwidths( mat, 2UL, 0UL );
+      checkCapacity  ( mat, 12UL );
+      checkNonZeros  ( mat, 5UL );
+
+      if( mat != DRMT{ { 1, 0, 0, 0 }, { 3, 4, 0, 0 }, { 0, 6, 7, 0 }, { 0, 0, 0, 0 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Changing the bandwidths failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 0 )\n( 3 4 0 0 )\n( 0 6 7 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Decreasing the size of the matrix
+      mat.resize( 2UL, 1UL, 0UL );
+
+      checkRows      ( mat, 2UL );
+      checkColumns   ( mat, 2UL );
+      checkBandwidths( mat, 1UL, 0UL );
+      checkCapacity  ( mat, 4UL );
+      checkNonZeros  ( mat, 3UL );
+
+      if( mat != DRMT{ { 1, 0 }, { 3, 4 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 )\n( 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Resizing the matrix without preserving the elements
+      mat.resize( 3UL, 1UL, 1UL, false );
+
+      checkRows      ( mat, 3UL );
+      checkColumns   ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major BandMatrix::resize() (invalid bandwidth)";
+
+      OMT mat( 3UL, 1UL, 1UL, 1 );
+
+      try {
+         mat.resize( 2UL, 0UL, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to an invalid bandwidth succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkRows      ( mat, 3UL );
+      checkBandwidths( mat, 1UL, 1UL );
+      checkCapacity  ( mat, 9UL );
+      checkNonZeros  ( mat, 7UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the BandMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   //=====================================================================================
+   // Row-major BandMatrix swap
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix swap";
+
+      MT mat1( DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } );
+      MT mat2( 2UL, 0UL, 0UL, 8 );
+
+      swap( mat1, mat2 );
+
+      checkRows      ( mat1, 2UL );
+      checkColumns   ( mat1, 2UL );
+      checkBandwidths( mat1, 0UL, 0UL );
+      checkCapacity  ( mat1, 2UL );
+      checkNonZeros  ( mat1, 2UL );
+
+      if( mat1 != DRMT{ { 8, 0 }, { 0, 8 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the first matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n( 8 0 )\n( 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkRows      ( mat2, 3UL );
+      checkColumns   ( mat2, 3UL );
+      checkBandwidths( mat2, 1UL, 1UL );
+      checkCapacity  ( mat2, 9UL );
+      checkNonZeros  ( mat2, 7UL );
+
+      if( mat2 != DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the second matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 3 4 5 )\n( 0 6 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major BandMatrix swap
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix swap";
+
+      OMT mat1( DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } );
+      OMT mat2( 2UL, 0UL, 0UL, 8 );
+
+      swap( mat1, mat2 );
+
+      checkRows      ( mat1, 2UL );
+      checkColumns   ( mat1, 2UL );
+      checkBandwidths( mat1, 0UL, 0UL );
+      checkCapacity  ( mat1, 2UL );
+      checkNonZeros  ( mat1, 2UL );
+
+      if( mat1 != DRMT{ { 8, 0 }, { 0, 8 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the first matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n( 8 0 )\n( 0 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkRows      ( mat2, 3UL );
+      checkColumns   ( mat2, 3UL );
+      checkBandwidths( mat2, 1UL, 1UL );
+      checkCapacity  ( mat2, 9UL );
+      checkNonZeros  ( mat2, 7UL );
+
+      if( mat2 != DRMT{ { 1, 2, 0 }, { 3, 4, 5 }, { 0, 6, 7 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the second matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 3 4 5 )\n( 0 6 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the BandMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the BandMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   using blaze::isDefault;
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major isDefault() function";
+
+      // isDefault with 0x0 matrix
+      {
+         MT mat;
+
+         if( isDefault( mat ) != true ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isDefault evaluation\n"
+                << " Details:\n"
+                << "   Matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // isDefault with default 3x3 matrix
+      {
+         MT mat( 3UL, 1UL, 1UL );
+
+         if( isDefault( mat(0,0) ) != true || isDefault( mat(1,0) ) != true ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isDefault evaluation\n"
+                << " Details:\n"
+                << "   Matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         if( isDefault( mat ) != false ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isDefault evaluation\n"
+                << " Details:\n"
+                << "   Matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // isDefault with non-default 3x3 matrix
+      {
+         MT mat( 3UL, 1UL, 1UL );
+         mat(1,0) = 1;
+
+         if( isDefault( mat(0,0) ) != true || isDefault( mat(1,0) ) != false ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isDefault evaluation\n"
+                << " Details:\n"
+                << "   Matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         clear( mat );
+
+         if( isDefault( mat ) != true ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isDefault evaluation\n"
+                << " Details:\n"
+                << "   Matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major isDefault() function";
+
+      // isDefault with 0x0 matrix
+      {
+         OMT mat;
+
+         if( isDefault( mat ) != true ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isDefault evaluation\n"
+                << " Details:\n"
+                << "   Matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // isDefault with 3x3 matrix
+      {
+         OMT mat( 3UL, 1UL, 1UL );
+         mat(0,1) = 1;
+
+         if( isDefault( mat(0,1) ) != false || isDefault( mat ) != false ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isDefault evaluation\n"
+                << " Details:\n"
+                << "   Matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BandMatrix multiplications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of band matrices with dense vectors,
+// dense matrices and band matrices. Next to small matrices with explicitly given results, the
+// products are tested with matrices of ones for various sizes, including sizes that exceed the
+// SMP thresholds. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMult()
+{
+   using blaze::min;
+
+   typedef blaze::DynamicVector<int,blaze::columnVector>  VT;
+   typedef blaze::DynamicVector<int,blaze::rowVector>     TVT;
+
+   const DRMT ref{ { 1, 2, 3, 0 },
+                   { 4, 5, 6, 7 },
+                   { 0, 8, 9, 1 },
+                   { 0, 0, 2, 3 } };
+
+   const size_t sizes[] = { 1UL, 2UL, 3UL, 5UL, 8UL, 16UL, 17UL, 33UL, 4000UL };
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major BandMatrix/dense vector multiplication";
+
+      const MT mat( ref );
+      const VT x{ 1, 2, 3, 4 };
+
+      VT y( mat * x );
+
+      if( y.size() != 4UL || y[0] != 14 || y[1] != 60 || y[2] != 47 || y[3] != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 14 )\n( 60 )\n( 47 )\n( 18 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      y += mat * x;
+
+      if( y[0] != 28 || y[1] != 120 || y[2] != 94 || y[3] != 36 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 28 )\n( 120 )\n( 94 )\n( 36 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      y -= mat * x;
+
+      if( y[0] != 14 || y[1] != 60 || y[2] != 47 || y[3] != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 14 )\n( 60 )\n( 47 )\n( 18 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const TVT z( trans( x ) * mat );
+
+      if( z.size() != 4UL || z[0] != 9 || z[1] != 36 || z[2] != 50 || z[3] != 29 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose vector multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << z << "\n"
+             << "   Expected result:\n( 9 36 50 29 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix/dense matrix multiplication";
+
+      const MT mat( ref );
+      const DRMT B{ { 1, 0 }, { 0, 1 }, { 1, 0 }, { 0, 1 } };
+      const DCMT C{ { 1, 0, 1, 0 }, { 0, 1, 0, 1 } };
+
+      const DRMT D( mat * B );
+
+      if( D != DRMT{ { 4, 2 }, { 10, 12 }, { 9, 9 }, { 2, 3 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n( 4 2 )\n( 10 12 )\n( 9 9 )\n( 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const DCMT E( C * mat );
+
+      if( E != DRMT{ { 1, 10, 12, 1 }, { 4, 5, 8, 10 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Dense matrix/BandMatrix multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << E << "\n"
+             << "   Expected result:\n( 1 10 12 1 )\n( 4 5 8 10 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix/BandMatrix multiplication";
+
+      const MT  A( ref );
+      const OMT B( DRMT{ { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 0, 1, 1, 0 }, { 0, 0, 1, 1 } } );
+
+      const MT C( A * B );
+
+      checkRows      ( C, 4UL );
+      checkColumns   ( C, 4UL );
+      checkBandwidths( C, 2UL, 2UL );
+      checkCapacity  ( C, 20UL );
+      checkNonZeros  ( C, 14UL );
+
+      if( C != DRMT{ { 3, 5, 3, 0 }, { 9, 11, 13, 7 }, { 8, 17, 10, 1 }, { 0, 2, 5, 3 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n( 3 5 3 0 )\n( 9 11 13 7 )\n( 8 17 10 1 )\n( 0 2 5 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major BandMatrix/BandMatrix multiplication (invalid size)";
+
+      const MT A( 3UL, 1UL, 1UL, 1 );
+      const MT B( 4UL, 1UL, 1UL, 1 );
+
+      try {
+         const MT C( A * B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of matrices with invalid sizes succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major BandMatrix multiplications (band of ones)";
+
+      for( size_t n : sizes )
+      {
+         const size_t kl( min( n-1UL, 9UL ) );
+         const size_t ku( min( n-1UL, 7UL ) );
+
+         const MT A( n, kl, ku, 1 );
+         const VT x( n, 1 );
+
+         const VT   y( A * x );
+         const TVT  z( trans( x ) * A );
+         const DCMT D( A * DRMT( n, 3UL, 1 ) );
+         const DRMT E( DCMT( 3UL, n, 1 ) * A );
+
+         for( size_t i=0UL; i<n; ++i )
+         {
+            const int rowCount( int( min( n, i+ku+1UL ) - ( i > kl ? i-kl : 0UL ) ) );
+            const int colCount( int( min( n, i+kl+1UL ) - ( i > ku ? i-ku : 0UL ) ) );
+
+            if( y[i] != rowCount || z[i] != colCount ||
+                D(i,0UL) != rowCount || D(i,2UL) != rowCount ||
+                E(0UL,i) != colCount || E(2UL,i) != colCount ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Size                    : " << n << "\n"
+                   << "   Index                   : " << i << "\n"
+                   << "   A*x / A*B               : " << y[i] << " / " << D(i,0UL) << "\n"
+                   << "   Expected result         : " << rowCount << "\n"
+                   << "   trans(x)*A / C*A        : " << z[i] << " / " << E(0UL,i) << "\n"
+                   << "   Expected transpose value: " << colCount << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         const MT C( A * A );
+
+         checkRows      ( C, n );
+         checkBandwidths( C, min( n-1UL, 2UL*kl ), min( n-1UL, 2UL*ku ) );
+         checkCapacity  ( C, n*( min( n-1UL, 2UL*kl ) + min( n-1UL, 2UL*ku ) + 1UL ) );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            const size_t jbegin( i > 2UL*kl ? i-2UL*kl : 0UL );
+            const size_t jend  ( min( n, i+2UL*ku+1UL ) );
+            for( size_t j=jbegin; j<jend; ++j )
+            {
+               const size_t pbegin( blaze::max( i > kl ? i-kl : 0UL, j > ku ? j-ku : 0UL ) );
+               const size_t pend  ( min( n, i+ku+1UL, j+kl+1UL ) );
+               const int expected( pend > pbegin ? int( pend-pbegin ) : 0 );
+
+               if( C(i,j) != expected ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: BandMatrix/BandMatrix multiplication failed\n"
+                      << " Details:\n"
+                      << "   Size          : " << n << "\n"
+                      << "   Element       : (" << i << "," << j << ")\n"
+                      << "   Value         : " << C(i,j) << "\n"
+                      << "   Expected value: " << expected << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major BandMatrix/dense vector multiplication";
+
+      const OMT mat( ref );
+      const VT x{ 1, 2, 3, 4 };
+
+      VT y( mat * x );
+
+      if( y.size() != 4UL || y[0] != 14 || y[1] != 60 || y[2] != 47 || y[3] != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 14 )\n( 60 )\n( 47 )\n( 18 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      y -= mat * x * 2;
+
+      if( y[0] != -14 || y[1] != -60 || y[2] != -47 || y[3] != -18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( -14 )\n( -60 )\n( -47 )\n( -18 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      TVT z( trans( x ) * mat );
+
+      if( z.size() != 4UL || z[0] != 9 || z[1] != 36 || z[2] != 50 || z[3] != 29 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose vector multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << z << "\n"
+             << "   Expected result:\n( 9 36 50 29 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      z += trans( x ) * mat;
+
+      if( z[0] != 18 || z[1] != 72 || z[2] != 100 || z[3] != 58 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose vector multiplication with addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << z << "\n"
+             << "   Expected result:\n( 18 72 100 58 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix/dense matrix multiplication";
+
+      const OMT mat( ref );
+      const DCMT B{ { 1, 0 }, { 0, 1 }, { 1, 0 }, { 0, 1 } };
+      const DRMT C{ { 1, 0, 1, 0 }, { 0, 1, 0, 1 } };
+
+      const DCMT D( mat * B );
+
+      if( D != DRMT{ { 4, 2 }, { 10, 12 }, { 9, 9 }, { 2, 3 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n( 4 2 )\n( 10 12 )\n( 9 9 )\n( 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const DRMT E( C * mat );
+
+      if( E != DRMT{ { 1, 10, 12, 1 }, { 4, 5, 8, 10 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Dense matrix/BandMatrix multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << E << "\n"
+             << "   Expected result:\n( 1 10 12 1 )\n( 4 5 8 10 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix/BandMatrix multiplication";
+
+      const OMT A( ref );
+      const MT  B( DRMT{ { 1, 0, 0, 0 }, { 1, 1, 0, 0 }, { 0, 1, 1, 0 }, { 0, 0, 1, 1 } } );
+
+      const OMT C( A * B );
+
+      checkRows      ( C, 4UL );
+      checkColumns   ( C, 4UL );
+      checkBandwidths( C, 2UL, 2UL );
+      checkCapacity  ( C, 20UL );
+      checkNonZeros  ( C, 14UL );
+
+      if( C != DRMT{ { 3, 5, 3, 0 }, { 9, 11, 13, 7 }, { 8, 17, 10, 1 }, { 0, 2, 5, 3 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n( 3 5 3 0 )\n( 9 11 13 7 )\n( 8 17 10 1 )\n( 0 2 5 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major BandMatrix multiplications (band of ones)";
+
+      for( size_t n : sizes )
+      {
+         const size_t kl( min( n-1UL, 7UL ) );
+         const size_t ku( min( n-1UL, 9UL ) );
+
+         const OMT A( n, kl, ku, 1 );
+         const VT x( n, 1 );
+
+         const VT   y( A * x );
+         const TVT  z( trans( x ) * A );
+         const DRMT D( A * DCMT( n, 3UL, 1 ) );
+         const DCMT E( DRMT( 3UL, n, 1 ) * A );
+
+         for( size_t i=0UL; i<n; ++i )
+         {
+            const int rowCount( int( min( n, i+ku+1UL ) - ( i > kl ? i-kl : 0UL ) ) );
+            const int colCount( int( min( n, i+kl+1UL ) - ( i > ku ? i-ku : 0UL ) ) );
+
+            if( y[i] != rowCount || z[i] != colCount ||
+                D(i,0UL) != rowCount || D(i,2UL) != rowCount ||
+                E(0UL,i) != colCount || E(2UL,i) != colCount ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Size                    : " << n << "\n"
+                   << "   Index                   : " << i << "\n"
+                   << "   A*x / A*B               : " << y[i] << " / " << D(i,0UL) << "\n"
+                   << "   Expected result         : " << rowCount << "\n"
+                   << "   trans(x)*A / C*A        : " << z[i] << " / " << E(0UL,i) << "\n"
+                   << "   Expected transpose value: " << colCount << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         const OMT C( A * MT( A ) );
+
+         checkRows      ( C, n );
+         checkBandwidths( C, min( n-1UL, 2UL*kl ), min( n-1UL, 2UL*ku ) );
+         checkCapacity  ( C, n*( min( n-1UL, 2UL*kl ) + min( n-1UL, 2UL*ku ) + 1UL ) );
+
+         for( size_t j=0UL; j<n; ++j ) {
+            const size_t ibegin( j > 2UL*ku ? j-2UL*ku : 0UL );
+            const size_t iend  ( min( n, j+2UL*kl+1UL ) );
+            for( size_t i=ibegin; i<iend; ++i )
+            {
+               const size_t pbegin( blaze::max( i > kl ? i-kl : 0UL, j > ku ? j-ku : 0UL ) );
+               const size_t pend  ( min( n, i+ku+1UL, j+kl+1UL ) );
+               const int expected( pend > pbegin ? int( pend-pbegin ) : 0 );
+
+               if( C(i,j) != expected ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: BandMatrix/BandMatrix multiplication failed\n"
+                      << " Details:\n"
+                      << "   Size          : " << n << "\n"
+                      << "   Element       : (" << i << "," << j << ")\n"
+                      << "   Value         : " << C(i,j) << "\n"
+                      << "   Expected value: " << expected << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the band view.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the band() view on dense matrices, band matrices and
+// matrix expressions. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testBandView()
+{
+   typedef blaze::DynamicVector<int,blaze::columnVector>  VT;
+
+
+   //=====================================================================================
+   // Band view on dense matrices
+   //=====================================================================================
+
+   {
+      test_ = "Band view on a dense matrix";
+
+      DRMT mat( 4UL, 5UL, 0 );
+
+      auto b1 = blaze::band( mat, 1L );
+      auto b2 = blaze::band( mat, -2L );
+
+      if( b1.size() != 4UL || b2.size() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid band size\n"
+             << " Details:\n"
+             << "   Sizes         : " << b1.size() << " and " << b2.size() << "\n"
+             << "   Expected sizes: 4 and 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      b1 = VT{ 1, 2, 3, 4 };
+      b2 = VT{ 5, 6 };
+      blaze::band( mat, 0L ) += blaze::band( mat, 1L );
+      blaze::band( mat, 0L ) *= 2;
+
+      if( mat != DRMT{ { 2, 1, 0, 0, 0 },
+                       { 0, 4, 2, 0, 0 },
+                       { 5, 0, 6, 3, 0 },
+                       { 0, 6, 0, 8, 4 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Band assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 1 0 0 0 )\n( 0 4 2 0 0 )\n( 5 0 6 3 0 )\n"
+                                     "( 0 6 0 8 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      reset( b1 );
+
+      if( b1 != VT( 4UL, 0 ) || mat(0,0) != 2 || mat(2,0) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Band reset failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 0 0 )\n( 0 4 0 0 0 )\n( 5 0 6 0 0 )\n"
+                                     "( 0 6 0 8 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Band view on a dense matrix (invalid band index)";
+
+      DRMT mat( 3UL, 4UL );
+
+      try {
+         blaze::band( mat, 4L );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of out-of-bounds superdiagonal succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::band( mat, -3L );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of out-of-bounds subdiagonal succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Band view on band matrices
+   //=====================================================================================
+
+   {
+      test_ = "Band view on a row-major band matrix";
+
+      const MT mat( DRMT{ { 1, 2, 3, 0 }, { 4, 5, 6, 7 }, { 0, 8, 9, 1 }, { 0, 0, 2, 3 } } );
+
+      const VT sub  ( blaze::band( mat, -1L ) );
+      const VT super( blaze::band( mat,  2L ) );
+      const VT outer( blaze::band( mat, -2L ) );
+
+      if( sub   != VT{ 4, 8, 2 } || super != VT{ 3, 7 } || outer != VT{ 0, 0 } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid band elements\n"
+             << " Details:\n"
+             << "   Subdiagonal  :\n" << sub << "\n"
+             << "   Expected subdiagonal:\n( 4 )\n( 8 )\n( 2 )\n"
+             << "   Superdiagonal:\n" << super << "\n"
+             << "   Expected superdiagonal:\n( 3 )\n( 7 )\n"
+             << "   Second subdiagonal:\n" << outer << "\n"
+             << "   Expected second subdiagonal:\n( 0 )\n( 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Band view on a column-major band matrix";
+
+      const OMT mat( DRMT{ { 1, 2, 3, 0 }, { 4, 5, 6, 7 }, { 0, 8, 9, 1 }, { 0, 0, 2, 3 } } );
+
+      const VT diag ( blaze::band( mat, 0L ) );
+      const VT super( blaze::band( mat, 1L ) );
+
+      if( diag != VT{ 1, 5, 9, 3 } || super != VT{ 2, 6, 1 } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid band elements\n"
+             << " Details:\n"
+             << "   Diagonal     :\n" << diag << "\n"
+             << "   Expected diagonal:\n( 1 )\n( 5 )\n( 9 )\n( 3 )\n"
+             << "   Superdiagonal:\n" << super << "\n"
+             << "   Expected superdiagonal:\n( 2 )\n( 6 )\n( 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Band view on matrix expressions
+   //=====================================================================================
+
+   {
+      test_ = "Band view on a matrix expression";
+
+      const DCMT mat{ { 1, 2 }, { 3, 4 }, { 5, 6 } };
+
+      const VT diag ( blaze::band( mat * trans( mat ), 0L ) );
+      const VT super( blaze::band( mat * trans( mat ), 1L ) );
+
+      if( diag != VT{ 5, 25, 61 } || super != VT{ 11, 39 } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid band elements\n"
+             << " Details:\n"
+             << "   Diagonal     :\n" << diag << "\n"
+             << "   Expected diagonal:\n( 5 )\n( 25 )\n( 61 )\n"
+             << "   Superdiagonal:\n" << super << "\n"
+             << "   Expected superdiagonal:\n( 11 )\n( 39 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the band solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the banded LU solver (gbsv(), gbtrf() and gbtrs()), the
+// banded Cholesky solver (pbsv()) and the Thomas algorithm (thomas()). In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSolve()
+{
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VT;
+   typedef blaze::DynamicVector<double,blaze::rowVector>     TVT;
+   typedef blaze::DynamicMatrix<double,blaze::rowMajor>      RMT;
+   typedef blaze::DynamicMatrix<double,blaze::columnMajor>   CMT;
+
+
+   //=====================================================================================
+   // Banded LU decomposition
+   //=====================================================================================
+
+   {
+      test_ = "Row-major gbsv() (tridiagonal matrix)";
+
+      DMT A( RMT{ {  4.0, -1.0,  0.0,  0.0 },
+                  { -1.0,  4.0, -1.0,  0.0 },
+                  {  0.0, -1.0,  4.0, -1.0 },
+                  {  0.0,  0.0, -1.0,  4.0 } } );
+      VT b{ 2.0, 4.0, 6.0, 13.0 };
+      std::vector<int> ipiv( 4UL );
+
+      gbsv( A, b, ipiv.data() );
+
+      checkRows      ( A, 4UL );
+      checkBandwidths( A, 1UL, 2UL );
+
+      if( b != VT{ 1.0, 2.0, 3.0, 4.0 } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the linear system failed\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n"
+             << "   Expected result:\n( 1 )\n( 2 )\n( 3 )\n( 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major gbsv() (pivoting)";
+
+      DMT A( 6UL, 1UL, 1UL );
+      for( size_t i=0UL; i<6UL; ++i ) {
+         A(i,i) = ( i % 2UL )?( 0.0 ):( 1E-3 );
+         if( i+1UL < 6UL ) {
+            A(i,i+1UL) = 1.0;
+            A(i+1UL,i) = 2.0;
+         }
+      }
+
+      const VT x{ 1.0, -2.0, 3.0, -4.0, 5.0, -6.0 };
+      VT b( A * x );
+      std::vector<int> ipiv( 6UL );
+
+      gbsv( A, b, ipiv.data() );
+
+      if( b != x ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the linear system failed\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n"
+             << "   Expected result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major gbsv() (singular matrix)";
+
+      DMT A( 4UL, 1UL, 1UL );
+      VT b( 4UL, 1.0 );
+      std::vector<int> ipiv( 4UL );
+
+      try {
+         gbsv( A, b, ipiv.data() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a singular system succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+      }
+   }
+
+   {
+      test_ = "Row-major gbsv() (invalid right-hand side)";
+
+      DMT A( 4UL, 1UL, 1UL, 1.0 );
+      VT b( 3UL, 1.0 );
+      std::vector<int> ipiv( 4UL );
+
+      try {
+         gbsv( A, b, ipiv.data() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with an invalid right-hand side succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Column-major gbtrf()/gbtrs() (multiple right-hand sides)";
+
+      DOMT A( RMT{ { 4.0, 1.0, 1.0, 0.0 },
+                   { 1.0, 4.0, 1.0, 1.0 },
+                   { 0.0, 1.0, 4.0, 1.0 },
+                   { 0.0, 0.0, 1.0, 4.0 } } );
+      CMT B{ { 5.0, 1.0 }, { 2.0, 5.0 }, { 4.0, 2.0 }, { 1.0, 4.0 } };
+      std::vector<int> ipiv( 4UL );
+
+      gbtrf( A, ipiv.data() );
+      gbtrs( A, B, ipiv.data() );
+
+      if( B != RMT{ { 1.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 0.0 }, { 0.0, 1.0 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the linear systems failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n( 1 0 )\n( 0 1 )\n( 1 0 )\n( 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Banded Cholesky decomposition
+   //=====================================================================================
+
+   {
+      test_ = "Column-major pbsv()";
+
+      DOMT A( RMT{ { 4.0, -1.0, 0.0 }, { -1.0, 4.0, -1.0 }, { 0.0, -1.0, 4.0 } } );
+      VT b{ 2.0, 4.0, 10.0 };
+
+      pbsv( A, b );
+
+      if( b != VT{ 1.0, 2.0, 3.0 } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the linear system failed\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n"
+             << "   Expected result:\n( 1 )\n( 2 )\n( 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Thomas algorithm
+   //=====================================================================================
+
+   {
+      test_ = "Row-major thomas()";
+
+      const DMT A( RMT{ {  4.0, -1.0,  0.0,  0.0 },
+                        { -1.5,  4.0, -1.0,  0.0 },
+                        {  0.0, -1.5,  4.0, -1.0 },
+                        {  0.0,  0.0, -1.5,  4.0 } } );
+
+      VT b{ 2.0, 3.5, 5.0, 11.5 };
+      thomas( A, b );
+
+      if( b != VT{ 1.0, 2.0, 3.0, 4.0 } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the linear system failed\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n"
+             << "   Expected result:\n( 1 )\n( 2 )\n( 3 )\n( 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      TVT c{ 2.0, 3.5, 5.0, 11.5 };
+      thomas( A, c );
+
+      if( c != TVT{ 1.0, 2.0, 3.0, 4.0 } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the linear system failed\n"
+             << " Details:\n"
+             << "   Result:\n" << c << "\n"
+             << "   Expected result:\n( 1 2 3 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      RMT B{ { 4.0, -1.0 }, { -2.5, 4.0 }, { 4.0, -2.5 }, { -1.5, 4.0 } };
+      thomas( A, B );
+
+      if( B != RMT{ { 1.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 0.0 }, { 0.0, 1.0 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the linear systems failed\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n( 1 0 )\n( 0 1 )\n( 1 0 )\n( 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major thomas() (non-tridiagonal matrix)";
+
+      const DMT A( 5UL, 2UL, 1UL, 1.0 );
+      VT b( 5UL, 1.0 );
+
+      try {
+         thomas( A, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with a non-tridiagonal matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Large systems
+   //=====================================================================================
+
+   {
+      test_ = "Column-major band solvers (large system)";
+
+      const size_t n( 2000UL );
+      const size_t nrhs( 16UL );
+
+      DOMT A( n, 1UL, 1UL );
+      CMT B( n, nrhs );
+
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) = 4.0;
+         if( i+1UL < n ) {
+            A(i,i+1UL) = -1.0;
+            A(i+1UL,i) = -1.0;
+         }
+         for( size_t j=0UL; j<nrhs; ++j ) {
+            B(i,j) = 4.0 - ( i > 0UL ? 1.0 : 0.0 ) - ( i+1UL < n ? 1.0 : 0.0 );
+         }
+      }
+
+      const CMT X( n, nrhs, 1.0 );
+
+      {
+         DOMT LU( A );
+         CMT Y( B );
+         std::vector<int> ipiv( n );
+
+         gbtrf( LU, ipiv.data() );
+         gbtrs( LU, Y, ipiv.data() );
+
+         if( Y != X ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Banded LU solver failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         DOMT L( A );
+         CMT Y( B );
+
+         pbsv( L, Y );
+
+         if( Y != X ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Banded Cholesky solver failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         CMT Y( B );
+
+         thomas( A, Y );
+
+         if( Y != X ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Thomas algorithm failed\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace bandmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running BandMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_BANDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during BandMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,2418 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compactdiagonalmatrix/ClassTest.cpp
+//  \brief Source file for the CompactDiagonalMatrix class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DiagonalMatrix.h>
+#include <blaze/math/IdentityMatrix.h>
+#include <blazetest/mathtest/compactdiagonalmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compactdiagonalmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompactDiagonalMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testSchurAssign();
+   testMultAssign();
+   testScaling();
+   testFunctionCall();
+   testAt();
+   testIterator();
+   testNonZeros();
+   testReset();
+   testClear();
+   testResize();
+   testSwap();
+   testSet();
+   testErase();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testTranspose();
+   testIsDefault();
+   testMult();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CompactDiagonalMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix default constructor";
+
+      MT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkCapacity( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix size constructor (0x0)";
+
+      MT mat( 0UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkCapacity( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix size constructor (3x3)";
+
+      MT mat( 3UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,0) != 0 || mat(1,1) != 0 || mat(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major homogeneous initialization
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix homogeneous initialization constructor (3x3)";
+
+      MT mat( 3UL, 2 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 0 || mat(1,1) != 2 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 2 0 )\n( 0 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major list and vector initialization
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix initializer list constructor";
+
+      MT mat{ 1, -2, 3 };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 1 || mat(0,1) !=  0 || mat(0,2) != 0 ||
+          mat(1,0) != 0 || mat(1,1) != -2 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) !=  0 || mat(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1  0 0 )\n( 0 -2 0 )\n( 0  0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix vector constructor";
+
+      const blaze::DynamicVector<int,blaze::columnVector> vec{ 4, 0 };
+      MT mat( vec );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkCapacity( mat, 2UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,0) != 4 || mat(0,1) != 0 || mat(1,0) != 0 || mat(1,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 4 0 )\n( 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix copy constructor";
+
+      const MT mat1{ 1, 2, 3 };
+      const MT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkCapacity( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2(0,0) != 1 || mat2(1,1) != 2 || mat2(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 2 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix conversion constructor (diagonal dense matrix)";
+
+      const DCMT dense{ { 1, 0, 0 }, { 0, 0, 0 }, { 0, 0, 7 } };
+      MT mat( dense );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 0 || mat(2,2) != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 0 0 )\n( 0 0 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix conversion constructor (diagonal sparse matrix)";
+
+      SRMT sparse( 3UL, 3UL );
+      sparse(1,1) = 5;
+
+      MT mat( sparse );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 0 || mat(1,1) != 5 || mat(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 5 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix conversion constructor (non-diagonal matrix)";
+
+      const DRMT dense{ { 1, 0 }, { 2, 3 } };
+
+      try {
+         MT mat( dense );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-diagonal CompactDiagonalMatrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix conversion constructor (non-square matrix)";
+
+      const SRMT sparse( 2UL, 3UL );
+
+      try {
+         MT mat( sparse );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-square CompactDiagonalMatrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major constructors
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix homogeneous initialization constructor (2x2)";
+
+      OMT mat( 2UL, 3 );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkCapacity( mat, 2UL );
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+
+      if( mat(0,0) != 3 || mat(0,1) != 0 || mat(1,0) != 0 || mat(1,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 0 )\n( 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix conversion constructor (row-major diagonal)";
+
+      const MT mat1{ 1, 2, 3 };
+      OMT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkCapacity( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2(0,0) != 1 || mat2(1,1) != 2 || mat2(2,2) != 3 || mat2(2,0) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 2 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix conversion constructor (non-diagonal matrix)";
+
+      SCMT sparse( 3UL, 3UL );
+      sparse(2,0) = 1;
+
+      try {
+         OMT mat( sparse );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-diagonal CompactDiagonalMatrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the CompactDiagonalMatrix class
+// template. Only diagonal matrices may be assigned; in case of a non-diagonal matrix the
+// assignment has to fail and leave the matrix unchanged. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Row-major copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix copy assignment";
+
+      const MT mat1{ 1, 2, 3 };
+      MT mat2{ 4 };
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkCapacity( mat2, 3UL );
+      checkNonZeros( mat2, 3UL );
+
+      if( mat2(0,0) != 1 || mat2(1,1) != 2 || mat2(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 2 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix dense matrix assignment (DiagonalMatrix)";
+
+      blaze::DiagonalMatrix<DRMT> diag( 3UL );
+      diag(0,0) =  1;
+      diag(2,2) = -4;
+
+      MT mat;
+      mat = diag;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 0 || mat(2,2) != -4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0  0 )\n( 0 0  0 )\n( 0 0 -4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix dense matrix assignment (non-diagonal matrix)";
+
+      MT mat{ 1, 2 };
+
+      try {
+         mat = DRMT{ { 1, 1 }, { 0, 1 } };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-diagonal matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkCapacity( mat, 2UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed assignment modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 )\n( 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major sparse matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix sparse matrix assignment";
+
+      SRMT sparse( 4UL, 4UL );
+      sparse(1,1) = 2;
+      sparse(3,3) = 6;
+
+      OMT mat( 2UL, 1 );
+      mat = sparse;
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat(0,0) != 0 || mat(1,1) != 2 || mat(2,2) != 0 || mat(3,3) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 0 2 0 0 )\n( 0 0 0 0 )\n( 0 0 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix sparse matrix assignment (non-diagonal matrix)";
+
+      SCMT sparse( 2UL, 2UL );
+      sparse(0,1) = 1;
+
+      OMT mat{ 3, 4 };
+
+      try {
+         mat = sparse;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-diagonal matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat(0,0) != 3 || mat(1,1) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed assignment modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 0 )\n( 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the CompactDiagonalMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   //=====================================================================================
+   // Row-major addition assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix addition assignment (CompactDiagonalMatrix)";
+
+      MT mat{ 1, 2, 3 };
+      mat += OMT{ 2, -2, 2 };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 3 || mat(1,1) != 0 || mat(2,2) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 0 0 )\n( 0 0 0 )\n( 0 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix addition assignment (dense matrix)";
+
+      MT mat{ 1, 2 };
+      mat += DCMT{ { 4, 0 }, { 0, 5 } };
+
+      if( mat(0,0) != 5 || mat(0,1) != 0 || mat(1,0) != 0 || mat(1,1) != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 5 0 )\n( 0 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix addition assignment (non-diagonal matrix)";
+
+      MT mat{ 1, 2 };
+
+      try {
+         mat += DRMT{ { 4, 0 }, { 1, 5 } };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of non-diagonal matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat(0,0) != 1 || mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed addition assignment modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 )\n( 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix addition assignment (invalid size)";
+
+      MT mat{ 1, 2, 3 };
+
+      try {
+         mat += MT( 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major addition assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix addition assignment (sparse matrix)";
+
+      SRMT sparse( 3UL, 3UL );
+      sparse(2,2) = 4;
+
+      OMT mat{ 1, 2, 3 };
+      mat += sparse;
+
+      if( mat(0,0) != 1 || mat(1,1) != 2 || mat(2,2) != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 2 0 )\n( 0 0 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the
+// CompactDiagonalMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   //=====================================================================================
+   // Row-major subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix subtraction assignment (dense matrix)";
+
+      MT mat{ 1, 2, 3 };
+      mat -= DCMT{ { 2, 0, 0 }, { 0, 2, 0 }, { 0, 0, 2 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != -1 || mat(1,1) != 0 || mat(2,2) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( -1 0 0 )\n( 0 0 0 )\n( 0 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix subtraction assignment (non-diagonal matrix)";
+
+      SRMT sparse( 2UL, 2UL );
+      sparse(0,1) = 3;
+
+      MT mat{ 1, 2 };
+
+      try {
+         mat -= sparse;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment of non-diagonal matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat(0,0) != 1 || mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed subtraction assignment modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 )\n( 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix subtraction assignment (CompactDiagonalMatrix)";
+
+      OMT mat{ 5, 6 };
+      mat -= MT{ 1, 6 };
+
+      if( mat(0,0) != 4 || mat(1,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 4 0 )\n( 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix Schur product assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the Schur product assignment operators of the
+// CompactDiagonalMatrix class template. Since the Schur product with any matrix results in a
+// diagonal matrix, non-diagonal right-hand side matrices are accepted. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSchurAssign()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix Schur product assignment (general matrix)";
+
+      MT mat{ 1, 2, 3 };
+      mat %= DRMT{ { 2, 9, 9 }, { 9, 3, 9 }, { 9, 9, 0 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 0 || mat(1,1) != 6 || mat(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Schur product assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 6 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix Schur product assignment (invalid size)";
+
+      OMT mat{ 1, 2 };
+
+      try {
+         mat %= DCMT( 2UL, 3UL, 1 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Schur product assignment of matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix multiplication assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication assignment operators of the
+// CompactDiagonalMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testMultAssign()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix multiplication assignment (CompactDiagonalMatrix)";
+
+      MT mat{ 1, 2, 3 };
+      mat *= OMT{ 2, 2, -1 };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 2 || mat(1,1) != 4 || mat(2,2) != -3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 4 0 )\n( 0 0 -3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix multiplication assignment (non-diagonal matrix)";
+
+      MT mat{ 1, 2 };
+
+      try {
+         mat *= DRMT{ { 1, 0 }, { 1, 1 } };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment of non-diagonal matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat(0,0) != 1 || mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed multiplication assignment modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 )\n( 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix multiplication assignment (dense matrix)";
+
+      OMT mat{ 3, 4 };
+      mat *= DCMT{ { 2, 0 }, { 0, 0 } };
+
+      if( mat(0,0) != 6 || mat(1,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 6 0 )\n( 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all CompactDiagonalMatrix (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the
+// CompactDiagonalMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   {
+      test_ = "Row-major self-scaling (M*=s)";
+
+      MT mat{ 1, -2, 3 };
+      mat *= 3;
+
+      if( mat(0,0) != 3 || mat(1,1) != -6 || mat(2,2) != 9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 3 0 0 )\n( 0 -6 0 )\n( 0 0 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major self-scaling (M/=s)";
+
+      MT mat{ 4, -2, 6 };
+      mat /= 2;
+
+      if( mat(0,0) != 2 || mat(1,1) != -1 || mat(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 -1 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix::scale()";
+
+      OMT mat{ 1, 2 };
+      mat.scale( 2 );
+
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,0) != 2 || mat(1,1) != 4 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Scale operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 )\n( 0 4 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of reading elements via the function call operator of the
+// CompactDiagonalMatrix class template. All off-diagonal elements have to be zero. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix::operator()";
+
+      const MT mat{ 1, 0, -3 };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) !=  0 ||
+          mat(1,0) != 0 || mat(1,1) != 0 || mat(1,2) !=  0 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != -3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0  0 )\n( 0 0  0 )\n( 0 0 -3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix::operator()";
+
+      const OMT mat{ 2, 5 };
+
+      if( mat(0,0) != 2 || mat(0,1) != 0 || mat(1,0) != 0 || mat(1,1) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 )\n( 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of reading elements via the \c at() member function of the
+// CompactDiagonalMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix::at()";
+
+      const MT mat{ 1, 2, 3 };
+
+      if( mat.at(1,1) != 2 || mat.at(1,2) != 0 || mat.at(2,0) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via at() function failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 2 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat.at(3,0);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound row access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+
+      try {
+         mat.at(0,3);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound column access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompactDiagonalMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the CompactDiagonalMatrix
+// class template. Each row/column has to contain exactly one element, which refers to the
+// diagonal element. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      MT mat{ 1, 0, 3 };
+
+      // Counting the number of elements in each row via Iterator and ConstIterator
+      {
+         test_ = "Row-major iterator subtraction";
+
+         for( size_t i=0UL; i<mat.rows(); ++i )
+         {
+            const ptrdiff_t number1( mat.end(i) - mat.begin(i) );
+            const ptrdiff_t number2( mat.cend(i) - mat.cbegin(i) );
+
+            if( number1 != 1L || number2 != 1L ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid number of elements detected\n"
+                   << " Details:\n"
+                   << "   Row                        : " << i << "\n"
+                   << "   Number of elements         : " << number1 << " / " << number2 << "\n"
+                   << "   Expected number of elements: 1\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      // Testing the index and value of the diagonal elements
+      {
+         test_ = "Row-major read-only access via ConstIterator";
+
+         const int expected[] = { 1, 0, 3 };
+
+         for( size_t i=0UL; i<mat.rows(); ++i )
+         {
+            MT::ConstIterator it( mat.cbegin(i) );
+
+            if( it->index() != i || it->value() != expected[i] || ++it != mat.cend(i) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid diagonal element detected\n"
+                   << " Details:\n"
+                   << "   Row           : " << i << "\n"
+                   << "   Expected value: " << expected[i] << "\n"
+                   << "   Result:\n" << mat << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      // Testing assignment via Iterator
+      {
+         test_ = "Row-major assignment via Iterator";
+
+         int value( 7 );
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            mat.begin(i)->value() = value++;
+         }
+
+         checkNonZeros( mat, 3UL );
+
+         if( mat(0,0) != 7 || mat(1,1) != 8 || mat(2,2) != 9 || mat(1,0) != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment via iterator failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 7 0 0 )\n( 0 8 0 )\n( 0 0 9 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Testing multiplication assignment via Iterator
+      {
+         test_ = "Row-major multiplication assignment via Iterator";
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            mat.begin(i)->value() *= 2;
+         }
+
+         if( mat(0,0) != 14 || mat(1,1) != 16 || mat(2,2) != 18 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication assignment via iterator failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 14 0 0 )\n( 0 16 0 )\n( 0 0 18 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major read-only access via ConstIterator";
+
+      const OMT mat{ 4, 5 };
+
+      for( size_t j=0UL; j<mat.columns(); ++j )
+      {
+         OMT::ConstIterator it( mat.begin(j) );
+
+         if( it->index() != j || it->value() != int( j+4UL ) || ++it != mat.end(j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid diagonal element detected\n"
+                << " Details:\n"
+                << "   Column        : " << j << "\n"
+                << "   Expected value: " << j+4UL << "\n"
+                << "   Result:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the CompactDiagonalMatrix
+// class template. Since all diagonal elements are stored explicitly, the number of non-zero
+// elements corresponds to the number of rows, independent of the values of the diagonal
+// elements. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix::nonZeros()";
+
+      MT mat( 3UL );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      mat.set( 1UL, 1UL, 5 );
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix::nonZeros()";
+
+      const OMT mat{ 1, 2 };
+
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the CompactDiagonalMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix::reset( size_t )";
+
+      MT mat{ 1, 2, 3 };
+
+      reset( mat, 1UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 0 || mat(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 0 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix::reset()";
+
+      MT mat{ 1, 2, 3 };
+
+      reset( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 0 || mat(1,1) != 0 || mat(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix::reset( size_t )";
+
+      OMT mat{ 4, 5 };
+
+      reset( mat, 0UL );
+
+      if( mat(0,0) != 0 || mat(1,1) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 )\n( 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the CompactDiagonalMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix::clear()";
+
+      MT mat{ 1, 2, 3 };
+
+      clear( mat );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkCapacity( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix::clear()";
+
+      OMT mat( 4UL, 1 );
+
+      clear( mat );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkCapacity( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the CompactDiagonalMatrix
+// class template. New diagonal elements have to be default initialized. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix::resize()";
+
+      MT mat{ 1, 2 };
+
+      // Increasing the size of the matrix
+      mat.resize( 4UL );
+
+      checkRows    ( mat, 4UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 2 || mat(2,2) != 0 || mat(3,3) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 0 )\n( 0 2 0 0 )\n( 0 0 0 0 )\n( 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Decreasing the size of the matrix
+      mat.resize( 1UL );
+
+      checkRows    ( mat, 1UL );
+      checkColumns ( mat, 1UL );
+      checkCapacity( mat, 1UL );
+      checkNonZeros( mat, 1UL );
+
+      if( mat(0,0) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Resizing to 0x0
+      mat.resize( 0UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix::resize() (without preservation)";
+
+      OMT mat{ 1, 2 };
+
+      mat.resize( 3UL, false );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 0 || mat(1,1) != 0 || mat(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the CompactDiagonalMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix swap";
+
+      MT mat1{ 1, 2 };
+      MT mat2{ 3, 4, 5 };
+
+      swap( mat1, mat2 );
+
+      checkRows    ( mat1, 3UL );
+      checkColumns ( mat1, 3UL );
+      checkCapacity( mat1, 3UL );
+      checkNonZeros( mat1, 3UL );
+
+      if( mat1(0,0) != 3 || mat1(1,1) != 4 || mat1(2,2) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the first matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n( 3 0 0 )\n( 0 4 0 )\n( 0 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 2UL );
+      checkCapacity( mat2, 2UL );
+      checkNonZeros( mat2, 2UL );
+
+      if( mat2(0,0) != 1 || mat2(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the second matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 )\n( 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c set() and \c insert() member functions of the CompactDiagonalMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c set() and \c insert() member functions of the
+// CompactDiagonalMatrix class template. Only diagonal elements can be written; writing an
+// off-diagonal element has to fail and leave the matrix unchanged. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSet()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix::set()";
+
+      MT mat( 3UL );
+
+      MT::Iterator pos = mat.set( 0UL, 0UL, 1 );
+
+      if( pos->index() != 0UL || pos->value() != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid iterator returned\n"
+             << " Details:\n"
+             << "   Value: " << pos->value() << "\n"
+             << "   Index: " << pos->index() << "\n"
+             << "   Expected value: 1\n"
+             << "   Expected index: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      mat.insert( 2UL, 2UL, 3 );
+      mat.set( 0UL, 0UL, 2 );
+
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 2 || mat(1,1) != 0 || mat(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a diagonal element failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 0 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix::set() (off-diagonal element)";
+
+      MT mat{ 1, 2, 3 };
+
+      try {
+         mat.set( 0UL, 1UL, 4 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting an off-diagonal element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         mat.insert( 2UL, 0UL, 4 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inserting an off-diagonal element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(1,1) != 2 || mat(2,0) != 0 || mat(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed write modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 2 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix::set() (off-diagonal element)";
+
+      OMT mat{ 1, 2 };
+      mat.set( 1UL, 1UL, 5 );
+
+      try {
+         mat.set( 1UL, 0UL, 4 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting an off-diagonal element succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat(0,0) != 1 || mat(1,0) != 0 || mat(1,1) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a diagonal element failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 )\n( 0 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c erase() member functions of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c erase() member functions of the CompactDiagonalMatrix
+// class template. Erasing a diagonal element resets it to its default value, erasing an
+// off-diagonal element has no effect. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testErase()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix::erase( size_t, size_t )";
+
+      MT mat{ 1, 2, 3 };
+
+      mat.erase( 0UL, 0UL );
+      mat.erase( 1UL, 2UL );
+
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 0 || mat(1,1) != 2 || mat(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing an element failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 2 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix::erase( size_t, Iterator )";
+
+      MT mat{ 1, 2, 3 };
+
+      MT::Iterator pos = mat.erase( 2UL, mat.begin(2UL) );
+
+      if( pos != mat.end(2UL) || mat(2,2) != 0 || mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing an element failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 2 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      pos = mat.erase( 1UL, mat.end(1UL) );
+
+      if( pos != mat.end(1UL) || mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing the end iterator modified the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 2 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix::erase( size_t, Iterator, Iterator )";
+
+      OMT mat{ 1, 2 };
+
+      OMT::Iterator pos = mat.erase( 0UL, mat.begin(0UL), mat.end(0UL) );
+
+      if( pos != mat.end(0UL) || mat(0,0) != 0 || mat(1,1) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Erasing a range failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 )\n( 0 2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the CompactDiagonalMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix::find()";
+
+      const MT mat{ 1, 2, 3 };
+
+      MT::ConstIterator pos( mat.find( 1UL, 1UL ) );
+
+      if( pos == mat.end(1UL) || pos->index() != 1UL || pos->value() != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Diagonal element could not be found\n"
+             << " Details:\n"
+             << "   Required position = (1,1)\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat.find( 1UL, 0UL ) != mat.end(1UL) || mat.find( 1UL, 2UL ) != mat.end(1UL) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Off-diagonal element found\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix::find()";
+
+      const OMT mat{ 1, 2, 3 };
+
+      OMT::ConstIterator pos( mat.find( 2UL, 2UL ) );
+
+      if( pos == mat.end(2UL) || pos->index() != 2UL || pos->value() != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Diagonal element could not be found\n"
+             << " Details:\n"
+             << "   Required position = (2,2)\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( mat.find( 0UL, 2UL ) != mat.end(2UL) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Off-diagonal element found\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the
+// CompactDiagonalMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix::lowerBound()";
+
+      const MT mat{ 1, 2, 3 };
+
+      if( mat.lowerBound( 1UL, 0UL ) != mat.begin(1UL) ||
+          mat.lowerBound( 1UL, 1UL ) != mat.begin(1UL) ||
+          mat.lowerBound( 1UL, 2UL ) != mat.end(1UL) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lower bound detected\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix::lowerBound()";
+
+      const OMT mat{ 1, 2, 3 };
+
+      if( mat.lowerBound( 0UL, 1UL ) != mat.begin(1UL) ||
+          mat.lowerBound( 1UL, 1UL ) != mat.begin(1UL) ||
+          mat.lowerBound( 2UL, 1UL ) != mat.end(1UL) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid lower bound detected\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the
+// CompactDiagonalMatrix class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix::upperBound()";
+
+      const MT mat{ 1, 2, 3 };
+
+      if( mat.upperBound( 1UL, 0UL ) != mat.begin(1UL) ||
+          mat.upperBound( 1UL, 1UL ) != mat.end(1UL) ||
+          mat.upperBound( 1UL, 2UL ) != mat.end(1UL) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid upper bound detected\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix::upperBound()";
+
+      const OMT mat{ 1, 2, 3 };
+
+      if( mat.upperBound( 0UL, 1UL ) != mat.begin(1UL) ||
+          mat.upperBound( 1UL, 1UL ) != mat.end(1UL) ||
+          mat.upperBound( 2UL, 1UL ) != mat.end(1UL) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid upper bound detected\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c transpose() functionality of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the in-place transpose and of the transpose expression of
+// the CompactDiagonalMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testTranspose()
+{
+   {
+      test_ = "Row-major CompactDiagonalMatrix::transpose()";
+
+      MT mat{ 1, 2, 3 };
+
+      transpose( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 2 || mat(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 2 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix transpose expression";
+
+      const MT mat{ 1, 2, 3 };
+      const OMT tmat( trans( mat ) );
+
+      checkRows    ( tmat, 3UL );
+      checkColumns ( tmat, 3UL );
+      checkCapacity( tmat, 3UL );
+      checkNonZeros( tmat, 3UL );
+
+      if( tmat(0,0) != 1 || tmat(1,1) != 2 || tmat(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tmat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 2 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the CompactDiagonalMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   {
+      test_ = "isDefault() function";
+
+      // isDefault with 0x0 matrix
+      {
+         MT mat;
+
+         if( isDefault( mat ) != true ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isDefault evaluation\n"
+                << " Details:\n"
+                << "   Matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // isDefault with 3x3 matrix
+      {
+         OMT mat( 3UL );
+
+         if( isDefault( mat ) != false ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isDefault evaluation\n"
+                << " Details:\n"
+                << "   Matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // isDefault with cleared matrix
+      {
+         MT mat{ 1, 2, 3 };
+         clear( mat );
+
+         if( isDefault( mat ) != true ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid isDefault evaluation\n"
+                << " Details:\n"
+                << "   Matrix:\n" << mat << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication operations of the CompactDiagonalMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the row scaling (\f$ D*A \f$) and column scaling
+// (\f$ A*D \f$) of dense and sparse matrices, of the multiplication with dense vectors, and
+// of the multiplication of two diagonal matrices. Besides small matrices with explicitly given
+// results, large matrices (beyond the SMP thresholds) are scaled, for which the result is known
+// in closed form. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMult()
+{
+   typedef blaze::DynamicVector<int,blaze::columnVector>  VT;
+   typedef blaze::DynamicVector<int,blaze::rowVector>     TVT;
+
+
+   //=====================================================================================
+   // Dense matrix scaling
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompactDiagonalMatrix/dense matrix multiplication (row scaling)";
+
+      const MT diag{ 1, 2, 3 };
+      const DRMT mat{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+
+      const DRMT res1( diag * mat );
+      const DCMT res2( diag * mat );
+      const DRMT ref{ { 1, 2, 3 }, { 8, 10, 12 }, { 21, 24, 27 } };
+
+      if( res1 != ref || res2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Row-major result:\n" << res1 << "\n"
+             << "   Column-major result:\n" << res2 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      DRMT res3( 3UL, 3UL, 1 );
+      res3 += diag * mat;
+      res3 -= diag * DRMT( 3UL, 3UL, 1 );
+
+      const DRMT ref3{ { 1, 2, 3 }, { 7, 9, 11 }, { 19, 22, 25 } };
+
+      if( res3 != ref3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with addition/subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res3 << "\n"
+             << "   Expected result:\n" << ref3 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major CompactDiagonalMatrix/dense matrix multiplication (column scaling)";
+
+      const OMT diag{ 1, 2, 3 };
+      const DCMT mat{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+
+      const DRMT res1( mat * diag );
+      const DCMT res2( mat * diag );
+      const DRMT ref{ { 1, 4, 9 }, { 4, 10, 18 }, { 7, 16, 27 } };
+
+      if( res1 != ref || res2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Row-major result:\n" << res1 << "\n"
+             << "   Column-major result:\n" << res2 << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix/dense matrix multiplication (aliasing)";
+
+      const MT diag{ 1, 2, 3 };
+      DRMT mat{ { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+
+      mat = diag * mat * diag;
+
+      const DRMT ref{ { 1, 4, 9 }, { 8, 20, 36 }, { 21, 48, 81 } };
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix/dense matrix multiplication (invalid sizes)";
+
+      const MT diag( 3UL );
+      const DRMT mat( 4UL, 3UL );
+
+      try {
+         const DRMT res( diag * mat );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of matrices with invalid sizes succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix/dense matrix multiplication (large matrices)";
+
+      const size_t m( 257UL );
+      const size_t n( 213UL );
+
+      MT  diag1( m );
+      OMT diag2( n );
+      for( size_t i=0UL; i<m; ++i )
+         diag1.set( i, i, int( i+1UL ) );
+      for( size_t j=0UL; j<n; ++j )
+         diag2.set( j, j, int( j+1UL ) );
+
+      const DRMT res1( diag1 * DCMT( m, n, 1 ) );
+      const DCMT res2( DRMT( m, n, 1 ) * diag2 );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            if( res1(i,j) != int( i+1UL ) || res2(i,j) != int( j+1UL ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Element                      : (" << i << "," << j << ")\n"
+                   << "   Row scaling result           : " << res1(i,j) << "\n"
+                   << "   Expected row scaling result  : " << i+1UL << "\n"
+                   << "   Column scaling result        : " << res2(i,j) << "\n"
+                   << "   Expected column scaling result: " << j+1UL << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Sparse matrix scaling
+   //=====================================================================================
+
+   {
+      test_ = "CompactDiagonalMatrix/sparse matrix multiplication";
+
+      const MT diag{ 1, 2, 3 };
+
+      SRMT mat( 3UL, 3UL );
+      mat(0,1) = 2;
+      mat(2,0) = 1;
+
+      const SRMT res1( diag * mat );
+      const SCMT res2( mat * diag );
+
+      checkNonZeros( res1, 2UL );
+      checkNonZeros( res2, 2UL );
+
+      if( res1(0,1) != 2 || res1(2,0) != 3 || res2(0,1) != 4 || res2(2,0) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Row scaling result:\n" << res1 << "\n"
+             << "   Expected row scaling result:\n( 0 2 0 )\n( 0 0 0 )\n( 3 0 0 )\n"
+             << "   Column scaling result:\n" << res2 << "\n"
+             << "   Expected column scaling result:\n( 0 4 0 )\n( 0 0 0 )\n( 1 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CompactDiagonalMatrix/sparse matrix multiplication (large matrices)";
+
+      const size_t m( 257UL );
+      const size_t n( 213UL );
+
+      MT diag( m );
+      for( size_t i=0UL; i<m; ++i )
+         diag.set( i, i, int( i+1UL ) );
+
+      SCMT mat( m, n );
+      for( size_t i=0UL; i<m; ++i )
+         mat(i,i%n) = 1;
+
+      const SRMT res( diag * mat );
+
+      checkNonZeros( res, m );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         if( res(i,i%n) != int( i+1UL ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Element        : (" << i << "," << i%n << ")\n"
+                << "   Result         : " << res(i,i%n) << "\n"
+                << "   Expected result: " << i+1UL << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Vector multiplication
+   //=====================================================================================
+
+   {
+      test_ = "CompactDiagonalMatrix/dense vector multiplication";
+
+      const MT diag{ 1, 2, 3 };
+      const VT x{ 1, 1, -1 };
+
+      const VT  y1( diag * x );
+      const VT  y2( diag * ( x * 2 ) );
+      const TVT y3( trans( x ) * diag );
+
+      if( y1[0] != 1 || y1[1] != 2 || y1[2] != -3 ||
+          y2[0] != 2 || y2[1] != 4 || y2[2] != -6 ||
+          y3[0] != 1 || y3[1] != 2 || y3[2] != -3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y1 << "\n" << y2 << "\n" << y3 << "\n"
+             << "   Expected result:\n( 1 2 -3 )\n( 2 4 -6 )\n( 1 2 -3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         const VT y4( diag * VT( 2UL, 1 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with vector of invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << y4 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Diagonal matrix multiplication
+   //=====================================================================================
+
+   {
+      test_ = "CompactDiagonalMatrix/CompactDiagonalMatrix multiplication";
+
+      const MT  diag1{ 1, 2, 3 };
+      const OMT diag2{ 2, 2, -1 };
+
+      const MT res1( diag1 * diag2 );
+      const MT res2( blaze::IdentityMatrix<int>( 3UL ) * diag1 );
+
+      checkRows    ( res1, 3UL );
+      checkColumns ( res1, 3UL );
+      checkCapacity( res1, 3UL );
+      checkNonZeros( res1, 3UL );
+
+      if( res1(0,0) != 2 || res1(1,1) != 4 || res1(2,2) != -3 ||
+          res2(0,0) != 1 || res2(1,1) != 2 || res2(2,2) !=  3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res1 << "\n"
+             << "   Expected result:\n( 2 0 0 )\n( 0 4 0 )\n( 0 0 -3 )\n"
+             << "   Identity result:\n" << res2 << "\n"
+             << "   Expected identity result:\n( 1 0 0 )\n( 0 2 0 )\n( 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         const MT res3( diag1 * OMT( 2UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of matrices with invalid sizes succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << res3 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace compactdiagonalmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompactDiagonalMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPACTDIAGONALMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompactDiagonalMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
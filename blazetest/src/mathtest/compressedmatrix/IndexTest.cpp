@@ -0,0 +1,508 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedmatrix/IndexTest.cpp
+//  \brief Source file for the CompressedMatrix sparse index test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Configuration
+//*************************************************************************************************
+
+#define BLAZE_SPARSE_INDEX_TYPE uint16_t
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <blaze/math/Column.h>
+#include <blaze/math/Row.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/compressedmatrix/IndexTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedMatrix sparse index test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+IndexTest::IndexTest()
+{
+   testElementSize();
+   testLargeIndices();
+   testRange();
+   testOperations();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the size of the stored elements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the elements of compressed vectors and matrices store the index
+// in the configured sparse index type. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void IndexTest::testElementSize()
+{
+   test_ = "Element size";
+
+   using blaze::ValueIndexPair;
+
+   RSM A( 3UL, 3UL, 1UL );
+   A.append( 0UL, 2UL, 1.0F );
+   A.finalize( 0UL );
+
+   SV x( 5UL, 1UL );
+   x.append( 4UL, 1.0F );
+
+   if( sizeof( blaze::SparseIndex ) != sizeof( uint16_t ) ||
+       sizeof( *A.begin( 0UL ) ) != sizeof( ValueIndexPair<float,uint16_t> ) ||
+       sizeof( *x.begin() ) != sizeof( ValueIndexPair<float,uint16_t> ) ||
+       sizeof( *A.begin( 0UL ) ) >= sizeof( ValueIndexPair<float,size_t> ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid element size detected\n"
+          << " Details:\n"
+          << "   Size of the sparse index type: " << sizeof( blaze::SparseIndex ) << "\n"
+          << "   Size of the matrix elements  : " << sizeof( *A.begin( 0UL ) ) << "\n"
+          << "   Size of the vector elements  : " << sizeof( *x.begin() ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the largest representable indices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the insertion, lookup, and iteration of elements at the largest indices
+// that are representable by the sparse index type. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void IndexTest::testLargeIndices()
+{
+   const size_t N( std::numeric_limits<blaze::SparseIndex>::max() );
+
+   //=====================================================================================
+   // Row-major matrix
+   //=====================================================================================
+
+   {
+      test_ = "Row-major largest column index";
+
+      RSM A( 3UL, N );
+      A(0UL,N-1UL) = 1.0F;
+      A(0UL,1UL)   = 2.0F;
+      A(2UL,N-2UL) = 3.0F;
+
+      if( A.nonZeros() != 3UL || A.begin(0UL)->index() != 1UL ||
+          ( A.begin(0UL)+1UL )->index() != N-1UL || A.find( 2UL, N-2UL ) == A.end( 2UL ) ||
+          A(0UL,N-1UL) != 1.0F || A(2UL,N-2UL) != 3.0F ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access to the largest column index failed\n"
+             << " Details:\n"
+             << "   Number of columns: " << N << "\n"
+             << "   Number of non-zeros: " << A.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      DV x( N, 1.0F );
+      x[N-1UL] = 4.0F;
+
+      const DV y( A * x );
+      const DV ref{ 6.0F, 0.0F, 3.0F };
+
+      checkResult( y, ref );
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix
+   //=====================================================================================
+
+   {
+      test_ = "Column-major largest row index";
+
+      CSM A( N, 2UL );
+      A(N-1UL,1UL) = 5.0F;
+      A(7UL,1UL)   = 1.0F;
+
+      if( A.nonZeros() != 2UL || ( A.begin(1UL)+1UL )->index() != N-1UL ||
+          A.lowerBound( N-1UL, 1UL ) == A.end( 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access to the largest row index failed\n"
+             << " Details:\n"
+             << "   Number of rows: " << N << "\n"
+             << "   Number of non-zeros: " << A.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const RSM B( trans( A ) );
+
+      if( B.columns() != N || B(1UL,N-1UL) != 5.0F || B(1UL,7UL) != 1.0F ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Number of columns: " << B.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Compressed vector
+   //=====================================================================================
+
+   {
+      test_ = "Compressed vector largest index";
+
+      SV x( N );
+      x[N-1UL] = 2.0F;
+      x[3UL]   = 1.0F;
+
+      const DV y( x );
+
+      if( x.nonZeros() != 2UL || ( x.begin()+1UL )->index() != N-1UL || y[N-1UL] != 2.0F ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access to the largest index failed\n"
+             << " Details:\n"
+             << "   Size: " << N << "\n"
+             << "   Number of non-zeros: " << x.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the range checks of the compressed vector and matrix dimensions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the attempt to create or resize a compressed vector or matrix beyond
+// the range of the sparse index type results in a \a std::invalid_argument exception. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void IndexTest::testRange()
+{
+   const size_t N( std::numeric_limits<blaze::SparseIndex>::max() + 1UL );
+
+   //=====================================================================================
+   // Row-major matrix
+   //=====================================================================================
+
+   {
+      test_ = "Row-major matrix constructor";
+
+      try {
+         RSM A( 2UL, N );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with too many columns succeeded\n"
+             << " Details:\n"
+             << "   Number of columns: " << A.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      RSM A( N, 2UL, 3UL );
+
+      if( A.rows() != N ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with many rows failed\n"
+             << " Details:\n"
+             << "   Number of rows: " << A.rows() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major matrix resize";
+
+      RSM A( 2UL, 2UL );
+      A(1UL,1UL) = 1.0F;
+
+      try {
+         A.resize( 2UL, N );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to too many columns succeeded\n"
+             << " Details:\n"
+             << "   Number of columns: " << A.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( A.rows() != 2UL || A.columns() != 2UL || A(1UL,1UL) != 1.0F ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed resize operation changed the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << A << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major matrix conversion";
+
+      try {
+         const DM D( 1UL, N, 0.0F );
+         RSM A( D );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion with too many columns succeeded\n"
+             << " Details:\n"
+             << "   Number of columns: " << A.columns() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix
+   //=====================================================================================
+
+   {
+      test_ = "Column-major matrix constructor";
+
+      try {
+         CSM A( N, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with too many rows succeeded\n"
+             << " Details:\n"
+             << "   Number of rows: " << A.rows() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         const RSM B( 2UL, N-1UL );
+         CSM A( trans( B ) );
+         A.resize( N, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to too many rows succeeded\n"
+             << " Details:\n"
+             << "   Number of rows: " << A.rows() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Compressed vector
+   //=====================================================================================
+
+   {
+      test_ = "Compressed vector constructor";
+
+      try {
+         SV x( N );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with too large size succeeded\n"
+             << " Details:\n"
+             << "   Size: " << x.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      SV x( 3UL );
+      x[2UL] = 1.0F;
+
+      try {
+         x.resize( N );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing to too large size succeeded\n"
+             << " Details:\n"
+             << "   Size: " << x.size() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( x.size() != 3UL || x[2UL] != 1.0F ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed resize operation changed the vector\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of several sparse operations with the reduced sparse index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the results of several sparse operations with the results of the
+// according dense operations. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void IndexTest::testOperations()
+{
+   const size_t M( 37UL );
+   const size_t N( 4111UL );
+
+   DM D1( M, N, 0.0F ), D2( N, M, 0.0F );
+   for( size_t k=0UL; k<400UL; ++k ) {
+      D1(blaze::rand<size_t>(0UL,M-1UL),blaze::rand<size_t>(0UL,N-1UL)) = blaze::rand<int>(-5,5);
+      D2(blaze::rand<size_t>(0UL,N-1UL),blaze::rand<size_t>(0UL,M-1UL)) = blaze::rand<int>(-5,5);
+   }
+
+   const RSM A( D1 );
+   const CSM B( D2 );
+
+   DV x( N );
+   for( size_t i=0UL; i<N; ++i ) {
+      x[i] = blaze::rand<int>(-5,5);
+   }
+
+   {
+      test_ = "Row-major matrix/dense vector multiplication";
+      checkResult( DV( A * x ), DV( D1 * x ) );
+   }
+
+   {
+      test_ = "Column-major matrix/dense vector multiplication";
+      checkResult( DV( trans( B ) * x ), DV( trans( D2 ) * x ) );
+   }
+
+   {
+      test_ = "Sparse matrix/sparse matrix multiplication";
+      checkResult( DM( A * B ), DM( D1 * D2 ) );
+   }
+
+   {
+      test_ = "Sparse matrix addition";
+      checkResult( DM( A + trans( B ) ), DM( D1 + trans( D2 ) ) );
+   }
+
+   {
+      test_ = "Sparse vector operations";
+
+      const SV s( trans( row( A, 3UL ) ) );
+      const DV d( trans( row( D1, 3UL ) ) );
+
+      checkResult( DV( s + column( B, 5UL ) ), DV( d + column( D2, 5UL ) ) );
+      checkResult( ( trans( s ) * x ), ( trans( d ) * x ) );
+   }
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrix sparse index test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_INDEX_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrix sparse index test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -79,6 +79,8 @@ GeneralTest::GeneralTest()
    testMinimum();
    testMaximum();
    testTrace();
+   testSum();
+   testReduce();
 }
 //*************************************************************************************************
 
@@ -4709,6 +4711,362 @@ void GeneralTest::testTrace()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for dense matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSum()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major sum()";
+
+      // Computing the sum of a 0x0 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat;
+
+         checkRows   ( mat, 0UL );
+         checkColumns( mat, 0UL );
+
+         const int sum = blaze::sum( mat );
+
+         if( sum != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << sum << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the sum of a 2x3 matrix
+      {
+         const blaze::DynamicMatrix<int,blaze::rowMajor> mat{ { 1, 0, 2 }
+                                                            , { 1, 3, 4 } };
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 5UL );
+
+         const int sum = blaze::sum( mat );
+
+         if( sum != 11 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << sum << "\n"
+                << "   Expected result: 11\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the row-wise sum of a 2x3 matrix
+      {
+         const blaze::DynamicMatrix<int,blaze::rowMajor> mat{ { 1, 0, 2 }
+                                                            , { 1, 3, 4 } };
+
+         const blaze::DynamicVector<int,blaze::columnVector> sum( blaze::sum<blaze::rowwise>( mat ) );
+
+         if( sum.size() != 2UL || sum[0] != 3 || sum[1] != 8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Third computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << sum << "\n"
+                << "   Expected result:\n( 3 8 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the column-wise sum of a 2x3 matrix
+      {
+         const blaze::DynamicMatrix<int,blaze::rowMajor> mat{ { 1, 0, 2 }
+                                                            , { 1, 3, 4 } };
+
+         const blaze::DynamicVector<int,blaze::rowVector> sum( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( sum.size() != 3UL || sum[0] != 2 || sum[1] != 3 || sum[2] != 6 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fourth computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << sum << "\n"
+                << "   Expected result:\n( 2 3 6 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the row-wise and column-wise sums of a 37x19 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::rowMajor> mat( 37UL, 19UL, 1 );
+
+         const blaze::DynamicVector<int,blaze::columnVector> rowsum( blaze::sum<blaze::rowwise>( mat ) );
+         const blaze::DynamicVector<int,blaze::rowVector> colsum( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( rowsum != blaze::DynamicVector<int,blaze::columnVector>( 37UL, 19 ) ||
+             colsum != blaze::DynamicVector<int,blaze::rowVector>( 19UL, 37 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fifth computation failed\n"
+                << " Details:\n"
+                << "   Row-wise result:\n" << rowsum << "\n"
+                << "   Column-wise result:\n" << colsum << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major sum()";
+
+      // Computing the sum of a 0x0 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat;
+
+         checkRows   ( mat, 0UL );
+         checkColumns( mat, 0UL );
+
+         const int sum = blaze::sum( mat );
+
+         if( sum != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << sum << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the sum of a 2x3 matrix
+      {
+         const blaze::DynamicMatrix<int,blaze::columnMajor> mat{ { 1, 0, 2 }
+                                                               , { 1, 3, 4 } };
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 5UL );
+
+         const int sum = blaze::sum( mat );
+
+         if( sum != 11 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << sum << "\n"
+                << "   Expected result: 11\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the row-wise sum of a 2x3 matrix
+      {
+         const blaze::DynamicMatrix<int,blaze::columnMajor> mat{ { 1, 0, 2 }
+                                                               , { 1, 3, 4 } };
+
+         const blaze::DynamicVector<int,blaze::columnVector> sum( blaze::sum<blaze::rowwise>( mat ) );
+
+         if( sum.size() != 2UL || sum[0] != 3 || sum[1] != 8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Third computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << sum << "\n"
+                << "   Expected result:\n( 3 8 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the column-wise sum of a 2x3 matrix
+      {
+         const blaze::DynamicMatrix<int,blaze::columnMajor> mat{ { 1, 0, 2 }
+                                                               , { 1, 3, 4 } };
+
+         const blaze::DynamicVector<int,blaze::rowVector> sum( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( sum.size() != 3UL || sum[0] != 2 || sum[1] != 3 || sum[2] != 6 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fourth computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << sum << "\n"
+                << "   Expected result:\n( 2 3 6 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the row-wise and column-wise sums of a 37x19 matrix
+      {
+         blaze::DynamicMatrix<int,blaze::columnMajor> mat( 37UL, 19UL, 1 );
+
+         const blaze::DynamicVector<int,blaze::columnVector> rowsum( blaze::sum<blaze::rowwise>( mat ) );
+         const blaze::DynamicVector<int,blaze::rowVector> colsum( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( rowsum != blaze::DynamicVector<int,blaze::columnVector>( 37UL, 19 ) ||
+             colsum != blaze::DynamicVector<int,blaze::rowVector>( 19UL, 37 ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fifth computation failed\n"
+                << " Details:\n"
+                << "   Row-wise result:\n" << rowsum << "\n"
+                << "   Column-wise result:\n" << colsum << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reduce() function for dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reduce() function for dense matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testReduce()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major reduce()";
+
+      const blaze::DynamicMatrix<int,blaze::rowMajor> mat{ { 1, -5, 2 }
+                                                         , { 7,  3, 4 } };
+
+      // Total reduction with the Max functor
+      {
+         const int maximum = blaze::reduce( mat, blaze::Max() );
+
+         if( maximum != 7 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << maximum << "\n"
+                << "   Expected result: 7\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Row-wise reduction with a custom lambda
+      {
+         const blaze::DynamicVector<int,blaze::columnVector> minimum(
+            blaze::reduce<blaze::rowwise>( mat, []( int a, int b ){ return ( b < a )?( b ):( a ); } ) );
+
+         if( minimum.size() != 2UL || minimum[0] != -5 || minimum[1] != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << minimum << "\n"
+                << "   Expected result:\n( -5 3 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Column-wise reduction with the Mult functor
+      {
+         const blaze::DynamicVector<int,blaze::rowVector> product(
+            blaze::reduce<blaze::columnwise>( mat, blaze::Mult() ) );
+
+         if( product.size() != 3UL || product[0] != 7 || product[1] != -15 || product[2] != 8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Third computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << product << "\n"
+                << "   Expected result:\n( 7 -15 8 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major reduce()";
+
+      const blaze::DynamicMatrix<int,blaze::columnMajor> mat{ { 1, -5, 2 }
+                                                            , { 7,  3, 4 } };
+
+      // Total reduction with the Max functor
+      {
+         const int maximum = blaze::reduce( mat, blaze::Max() );
+
+         if( maximum != 7 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << maximum << "\n"
+                << "   Expected result: 7\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Row-wise reduction with a custom lambda
+      {
+         const blaze::DynamicVector<int,blaze::columnVector> minimum(
+            blaze::reduce<blaze::rowwise>( mat, []( int a, int b ){ return ( b < a )?( b ):( a ); } ) );
+
+         if( minimum.size() != 2UL || minimum[0] != -5 || minimum[1] != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << minimum << "\n"
+                << "   Expected result:\n( -5 3 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Column-wise reduction with the Mult functor
+      {
+         const blaze::DynamicVector<int,blaze::rowVector> product(
+            blaze::reduce<blaze::columnwise>( mat, blaze::Mult() ) );
+
+         if( product.size() != 3UL || product[0] != 7 || product[1] != -15 || product[2] != 8 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Third computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << product << "\n"
+                << "   Expected result:\n( 7 -15 8 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace densematrix
 
 } // namespace mathtest
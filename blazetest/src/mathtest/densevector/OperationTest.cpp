@@ -38,6 +38,7 @@
 //*************************************************************************************************
 
 #include <cstdlib>
+#include <cmath>
 #include <iostream>
 #include <blaze/math/dense/DenseVector.h>
 #include <blaze/math/DynamicVector.h>
@@ -69,6 +70,10 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testSum();
+   testProd();
+   testReduce();
+   testNorms();
 }
 //*************************************************************************************************
 
@@ -564,6 +569,272 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for dense vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSum()
+{
+   test_ = "sum() function";
+
+   // sum with 0-dimensional vector
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec;
+
+      const int sum = blaze::sum( vec );
+
+      if( sum != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // sum with 4-dimensional vector
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec{ 1, -2, 3, -4 };
+
+      const int sum = blaze::sum( vec );
+
+      if( sum != -2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: -2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // sum with 1023-dimensional vector (vectorized kernel and remainder loop)
+   {
+      blaze::DynamicVector<int,blaze::columnVector> vec( 1023UL );
+      for( size_t i=0UL; i<vec.size(); ++i ) {
+         vec[i] = static_cast<int>( i );
+      }
+
+      const int sum = blaze::sum( vec );
+
+      if( sum != 522753 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Third computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: 522753\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // sum with dense vector expression
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec{ 1, -2, 3, -4, 5 };
+
+      const int sum = blaze::sum( vec + vec );
+
+      if( sum != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fourth computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c prod() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c prod() function for dense vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testProd()
+{
+   test_ = "prod() function";
+
+   // prod with 0-dimensional vector
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec;
+
+      const int prod = blaze::prod( vec );
+
+      if( prod != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << prod << "\n"
+             << "   Expected result: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // prod with 4-dimensional vector
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec{ 1, -2, 3, -4 };
+
+      const int prod = blaze::prod( vec );
+
+      if( prod != 24 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << prod << "\n"
+             << "   Expected result: 24\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // prod with 37-dimensional vector (vectorized kernel and remainder loop)
+   {
+      blaze::DynamicVector<double,blaze::columnVector> vec( 37UL, 1.0 );
+      vec[ 3] = 2.0;
+      vec[17] = 0.5;
+      vec[36] = 3.0;
+
+      const double prod = blaze::prod( vec );
+
+      if( prod != 3.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Third computation failed\n"
+             << " Details:\n"
+             << "   Result: " << prod << "\n"
+             << "   Expected result: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reduce() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reduce() function for dense vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testReduce()
+{
+   test_ = "reduce() function";
+
+   // Reduction with the Add functor
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec{ 1, -2, 3, -4, 5, -6, 7, -8, 9 };
+
+      const int sum = blaze::reduce( vec, blaze::Add() );
+
+      if( sum != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: 5\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Reduction with a custom lambda
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec{ 1, -2, 3, -4, 5, -6, 7, -8, 9 };
+
+      const int maximum = blaze::reduce( vec, []( int a, int b ){ return ( a < b )?( b ):( a ); } );
+
+      if( maximum != 9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << maximum << "\n"
+             << "   Expected result: 9\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the norm functions for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sqrNorm(), \c norm(), \c l1Norm(), \c l2Norm(),
+// and \c linfNorm() functions for dense vectors. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testNorms()
+{
+   test_ = "norm functions";
+
+   blaze::DynamicVector<double,blaze::rowVector> vec{ 3.0, -4.0, 0.0, 12.0, -1.0 };
+
+   if( blaze::sqrNorm( vec ) != 170.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Squared L2 norm computation failed\n"
+          << " Details:\n"
+          << "   Result: " << blaze::sqrNorm( vec ) << "\n"
+          << "   Expected result: 170\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( blaze::norm( vec ) != std::sqrt( 170.0 ) || blaze::l2Norm( vec ) != std::sqrt( 170.0 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: L2 norm computation failed\n"
+          << " Details:\n"
+          << "   Result: " << blaze::norm( vec ) << "\n"
+          << "   Expected result: " << std::sqrt( 170.0 ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( blaze::l1Norm( vec ) != 20.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: L1 norm computation failed\n"
+          << " Details:\n"
+          << "   Result: " << blaze::l1Norm( vec ) << "\n"
+          << "   Expected result: 20\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( blaze::linfNorm( vec ) != 12.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Infinity norm computation failed\n"
+          << " Details:\n"
+          << "   Result: " << blaze::linfNorm( vec ) << "\n"
+          << "   Expected result: 12\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
 } // namespace densevector
 
 } // namespace mathtest
@@ -0,0 +1,149 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dispatch/OperationTest.cpp
+//  \brief Source file for the runtime dispatch operation test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/dispatch/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dispatch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+
+   //=====================================================================================
+   // Single precision tests
+   //=====================================================================================
+
+   testAdd<float>();
+
+   testGemv<float,rowMajor>();
+   testGemv<float,columnMajor>();
+
+   testTGemv<float,rowMajor>();
+   testTGemv<float,columnMajor>();
+
+   testGemm<float,rowMajor,rowMajor,rowMajor>();
+   testGemm<float,rowMajor,rowMajor,columnMajor>();
+   testGemm<float,rowMajor,columnMajor,rowMajor>();
+   testGemm<float,rowMajor,columnMajor,columnMajor>();
+   testGemm<float,columnMajor,rowMajor,rowMajor>();
+   testGemm<float,columnMajor,rowMajor,columnMajor>();
+   testGemm<float,columnMajor,columnMajor,rowMajor>();
+   testGemm<float,columnMajor,columnMajor,columnMajor>();
+
+   testKernels<float>();
+
+
+   //=====================================================================================
+   // Double precision tests
+   //=====================================================================================
+
+   testAdd<double>();
+
+   testGemv<double,rowMajor>();
+   testGemv<double,columnMajor>();
+
+   testTGemv<double,rowMajor>();
+   testTGemv<double,columnMajor>();
+
+   testGemm<double,rowMajor,rowMajor,rowMajor>();
+   testGemm<double,rowMajor,rowMajor,columnMajor>();
+   testGemm<double,rowMajor,columnMajor,rowMajor>();
+   testGemm<double,rowMajor,columnMajor,columnMajor>();
+   testGemm<double,columnMajor,rowMajor,rowMajor>();
+   testGemm<double,columnMajor,rowMajor,columnMajor>();
+   testGemm<double,columnMajor,columnMajor,rowMajor>();
+   testGemm<double,columnMajor,columnMajor,columnMajor>();
+
+   testKernels<double>();
+}
+//*************************************************************************************************
+
+} // namespace dispatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime dispatch operation test..." << std::endl;
+
+   try
+   {
+      RUN_DISPATCH_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime dispatch operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
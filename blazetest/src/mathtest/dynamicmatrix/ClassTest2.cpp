@@ -5281,6 +5281,60 @@ void ClassTest::testTranspose()
       }
    }
 
+   {
+      test_ = "Row-major self-transpose (rectangular stress test)";
+
+      const size_t m( blaze::rand<size_t>( 0UL, 100UL ) );
+      const size_t n( blaze::rand<size_t>( 0UL, 100UL ) );
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( m, n, 0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat2( mat1 );
+
+      transpose( mat1 );
+
+      checkRows   ( mat1, n );
+      checkColumns( mat1, m );
+
+      if( mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << trans( mat2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major transpose assignment (stress test)";
+
+      const size_t m( blaze::rand<size_t>( 0UL, 100UL ) );
+      const size_t n( blaze::rand<size_t>( 0UL, 100UL ) );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat1( m, n, 0.0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<double,blaze::rowMajor> mat2( trans( mat1 ) );
+
+      checkRows   ( mat2, n );
+      checkColumns( mat2, m );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            if( mat2(j,i) != mat1(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Transpose assignment failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << mat2 << "\n"
+                   << "   Expected result:\n" << trans( mat1 ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
 
    //=====================================================================================
    // Column-major matrix tests
@@ -5443,6 +5497,60 @@ void ClassTest::testTranspose()
          throw std::runtime_error( oss.str() );
       }
    }
+
+   {
+      test_ = "Column-major self-transpose (rectangular stress test)";
+
+      const size_t m( blaze::rand<size_t>( 0UL, 100UL ) );
+      const size_t n( blaze::rand<size_t>( 0UL, 100UL ) );
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1( m, n, 0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat2( mat1 );
+
+      transpose( mat1 );
+
+      checkRows   ( mat1, n );
+      checkColumns( mat1, m );
+
+      if( mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n" << trans( mat2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major transpose assignment (stress test)";
+
+      const size_t m( blaze::rand<size_t>( 0UL, 100UL ) );
+      const size_t n( blaze::rand<size_t>( 0UL, 100UL ) );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat1( m, n, 0.0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<double,blaze::columnMajor> mat2( trans( mat1 ) );
+
+      checkRows   ( mat2, n );
+      checkColumns( mat2, m );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            if( mat2(j,i) != mat1(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Transpose assignment failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << mat2 << "\n"
+                   << "   Expected result:\n" << trans( mat1 ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
 }
 //*************************************************************************************************
 
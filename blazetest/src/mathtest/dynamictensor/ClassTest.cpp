@@ -0,0 +1,2884 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dynamictensor/ClassTest.cpp
+//  \brief Source file for the DynamicTensor class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <blaze/util/AlignmentCheck.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blazetest/mathtest/dynamictensor/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dynamictensor {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DynamicTensor class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testSchurAssign();
+   testScaling();
+   testFunctionCall();
+   testAt();
+   testData();
+   testNonZeros();
+   testReset();
+   testClear();
+   testResize();
+   testSwap();
+   testMap();
+   testPageSlice();
+   testRowSlice();
+   testColumnSlice();
+   testMult();
+   testCustomTensor();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicTensor constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the DynamicTensor class template. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor default constructor";
+
+      TT tens;
+
+      checkPages   ( tens, 0UL );
+      checkRows    ( tens, 0UL );
+      checkColumns ( tens, 0UL );
+      checkCapacity( tens, 0UL );
+      checkNonZeros( tens, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor size constructor (0x0x0)";
+
+      TT tens( 0UL, 0UL, 0UL );
+
+      checkPages   ( tens, 0UL );
+      checkRows    ( tens, 0UL );
+      checkColumns ( tens, 0UL );
+      checkNonZeros( tens, 0UL );
+   }
+
+   {
+      test_ = "DynamicTensor size constructor (0x3x4)";
+
+      TT tens( 0UL, 3UL, 4UL );
+
+      checkPages   ( tens, 0UL );
+      checkRows    ( tens, 3UL );
+      checkColumns ( tens, 4UL );
+      checkNonZeros( tens, 0UL );
+   }
+
+   {
+      test_ = "DynamicTensor size constructor (2x3x5)";
+
+      TT tens( 2UL, 3UL, 5UL );
+
+      checkPages   ( tens, 2UL );
+      checkRows    ( tens, 3UL );
+      checkColumns ( tens, 5UL );
+      checkSpacing ( tens, paddedColumns( 5UL ) );
+      checkCapacity( tens, 2UL*3UL*paddedColumns( 5UL ) );
+   }
+
+
+   //=====================================================================================
+   // Homogeneous initialization
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor homogeneous initialization constructor (2x3x5)";
+
+      TT tens( 2UL, 3UL, 5UL, 7 );
+
+      checkPages   ( tens,  2UL );
+      checkRows    ( tens,  3UL );
+      checkColumns ( tens,  5UL );
+      checkSpacing ( tens, paddedColumns( 5UL ) );
+      checkCapacity( tens, 30UL );
+      checkNonZeros( tens, 30UL );
+
+      for( size_t k=0UL; k<2UL; ++k ) {
+         for( size_t i=0UL; i<3UL; ++i ) {
+            for( size_t j=0UL; j<5UL; ++j ) {
+               if( tens(k,i,j) != 7 ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Construction failed\n"
+                      << " Details:\n"
+                      << "   Result:\n" << tens << "\n"
+                      << "   Expected result: all elements equal to 7\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "DynamicTensor homogeneous initialization constructor (9x111x123)";
+
+      TT tens( 9UL, 111UL, 123UL, 2 );
+
+      checkPages   ( tens,   9UL );
+      checkRows    ( tens, 111UL );
+      checkColumns ( tens, 123UL );
+      checkSpacing ( tens, paddedColumns( 123UL ) );
+      checkNonZeros( tens, 9UL*111UL*123UL );
+
+      if( tens(0,0,0) != 2 || tens(4,55,61) != 2 || tens(8,110,122) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result: " << tens(0,0,0) << " " << tens(4,55,61) << " "
+             << tens(8,110,122) << "\n"
+             << "   Expected result: 2 2 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // List initialization
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor initializer list constructor (complete list)";
+
+      TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+      checkPages   ( tens,  2UL );
+      checkRows    ( tens,  2UL );
+      checkColumns ( tens,  3UL );
+      checkSpacing ( tens, paddedColumns( 3UL ) );
+      checkCapacity( tens, 12UL );
+      checkNonZeros( tens, 12UL );
+
+      if( tens(0,0,0) !=  1 || tens(0,0,1) !=  2 || tens(0,0,2) !=  3 ||
+          tens(0,1,0) !=  4 || tens(0,1,1) !=  5 || tens(0,1,2) !=  6 ||
+          tens(1,0,0) !=  7 || tens(1,0,1) !=  8 || tens(1,0,2) !=  9 ||
+          tens(1,1,0) != 10 || tens(1,1,1) != 11 || tens(1,1,2) != 12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n\n( 7 8 9 )\n( 10 11 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor initializer list constructor (incomplete list)";
+
+      TT tens{ { { 1, 2, 3 }, { 4, 5 } }, { { 6 } } };
+
+      checkPages   ( tens, 2UL );
+      checkRows    ( tens, 2UL );
+      checkColumns ( tens, 3UL );
+      checkSpacing ( tens, paddedColumns( 3UL ) );
+      checkNonZeros( tens, 6UL );
+
+      if( tens(0,0,0) != 1 || tens(0,0,1) != 2 || tens(0,0,2) != 3 ||
+          tens(0,1,0) != 4 || tens(0,1,1) != 5 || tens(0,1,2) != 0 ||
+          tens(1,0,0) != 6 || tens(1,0,1) != 0 || tens(1,0,2) != 0 ||
+          tens(1,1,0) != 0 || tens(1,1,1) != 0 || tens(1,1,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 0 )\n\n( 6 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor copy constructor (0x0x0)";
+
+      TT tens1;
+      TT tens2( tens1 );
+
+      checkPages   ( tens2, 0UL );
+      checkRows    ( tens2, 0UL );
+      checkColumns ( tens2, 0UL );
+      checkNonZeros( tens2, 0UL );
+   }
+
+   {
+      test_ = "DynamicTensor copy constructor (2x2x3)";
+
+      TT tens1{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+      TT tens2( tens1 );
+
+      checkPages   ( tens2,  2UL );
+      checkRows    ( tens2,  2UL );
+      checkColumns ( tens2,  3UL );
+      checkSpacing ( tens2, paddedColumns( 3UL ) );
+      checkNonZeros( tens2, 12UL );
+
+      tens1(0,0,0) = 0;
+
+      if( tens2 != TT{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n\n( 7 8 9 )\n( 10 11 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Move constructor
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor move constructor (2x2x3)";
+
+      TT tens1{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+      const int* const ptr( tens1.data() );
+      TT tens2( std::move( tens1 ) );
+
+      checkPages   ( tens2,  2UL );
+      checkRows    ( tens2,  2UL );
+      checkColumns ( tens2,  3UL );
+      checkSpacing ( tens2, paddedColumns( 3UL ) );
+      checkNonZeros( tens2, 12UL );
+
+      checkPages   ( tens1, 0UL );
+      checkRows    ( tens1, 0UL );
+      checkColumns ( tens1, 0UL );
+
+      if( tens2.data() != ptr ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Move construction copied the tensor elements\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( tens2 != TT{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n\n( 7 8 9 )\n( 10 11 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Dense tensor constructor
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor dense tensor constructor (expression)";
+
+      const TT tens1{ { { 1, 2 }, { 3, 4 } }, { { 5, 6 }, { 7, 8 } } };
+      TT tens2( tens1 + tens1 * 2 );
+
+      checkPages   ( tens2, 2UL );
+      checkRows    ( tens2, 2UL );
+      checkColumns ( tens2, 2UL );
+      checkSpacing ( tens2, paddedColumns( 2UL ) );
+      checkNonZeros( tens2, 8UL );
+
+      if( tens2 != TT{ { { 3, 6 }, { 9, 12 } }, { { 15, 18 }, { 21, 24 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 3 6 )\n( 9 12 )\n\n( 15 18 )\n( 21 24 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor dense tensor constructor (CustomTensor)";
+
+      int array[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+      const UTT tens1( array, 2UL, 2UL, 2UL );
+      TT tens2( tens1 );
+
+      checkPages   ( tens2, 2UL );
+      checkRows    ( tens2, 2UL );
+      checkColumns ( tens2, 2UL );
+      checkSpacing ( tens2, paddedColumns( 2UL ) );
+      checkNonZeros( tens2, 8UL );
+
+      if( tens2 != TT{ { { 1, 2 }, { 3, 4 } }, { { 5, 6 }, { 7, 8 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 1 2 )\n( 3 4 )\n\n( 5 6 )\n( 7 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicTensor assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the DynamicTensor class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Homogeneous assignment
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor homogeneous assignment";
+
+      TT tens( 2UL, 3UL, 4UL );
+      tens = 2;
+
+      checkPages   ( tens,  2UL );
+      checkRows    ( tens,  3UL );
+      checkColumns ( tens,  4UL );
+      checkSpacing ( tens, paddedColumns( 4UL ) );
+      checkNonZeros( tens, 24UL );
+
+      if( tens(0,0,0) != 2 || tens(0,2,3) != 2 || tens(1,0,0) != 2 || tens(1,2,3) != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result: all elements equal to 2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // List assignment
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor initializer list assignment (complete list)";
+
+      TT tens;
+      tens = { { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+      checkPages   ( tens,  2UL );
+      checkRows    ( tens,  2UL );
+      checkColumns ( tens,  3UL );
+      checkSpacing ( tens, paddedColumns( 3UL ) );
+      checkNonZeros( tens, 12UL );
+
+      if( tens(0,0,0) !=  1 || tens(0,0,1) !=  2 || tens(0,0,2) !=  3 ||
+          tens(0,1,0) !=  4 || tens(0,1,1) !=  5 || tens(0,1,2) !=  6 ||
+          tens(1,0,0) !=  7 || tens(1,0,1) !=  8 || tens(1,0,2) !=  9 ||
+          tens(1,1,0) != 10 || tens(1,1,1) != 11 || tens(1,1,2) != 12 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n\n( 7 8 9 )\n( 10 11 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor initializer list assignment (incomplete list)";
+
+      TT tens( 3UL, 4UL, 5UL, 9 );
+      tens = { { { 1 }, { 2, 3 } }, { { 4, 5, 6 } } };
+
+      checkPages   ( tens, 2UL );
+      checkRows    ( tens, 2UL );
+      checkColumns ( tens, 3UL );
+      checkSpacing ( tens, paddedColumns( 3UL ) );
+      checkNonZeros( tens, 6UL );
+
+      if( tens != TT{ { { 1, 0, 0 }, { 2, 3, 0 } }, { { 4, 5, 6 }, { 0, 0, 0 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 2 3 0 )\n\n( 4 5 6 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor copy assignment";
+
+      const TT tens1{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+      TT tens2( 1UL, 5UL, 17UL, 3 );
+      tens2 = tens1;
+
+      checkPages   ( tens2,  2UL );
+      checkRows    ( tens2,  2UL );
+      checkColumns ( tens2,  3UL );
+      checkSpacing ( tens2, paddedColumns( 3UL ) );
+      checkNonZeros( tens2, 12UL );
+
+      if( tens2 != TT{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n\n( 7 8 9 )\n( 10 11 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor copy assignment stress test";
+
+      TT tens1;
+
+      for( size_t o=0UL; o<4UL; ++o ) {
+         for( size_t n=0UL; n<20UL; n+=3UL )
+         {
+            const TT tens2( o, 3UL, n, 5 );
+            tens1 = tens2;
+
+            checkPages   ( tens1, o );
+            checkRows    ( tens1, 3UL );
+            checkColumns ( tens1, n );
+            checkSpacing ( tens1, paddedColumns( n ) );
+            checkNonZeros( tens1, o*3UL*n );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Move assignment
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor move assignment";
+
+      TT tens1{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+      const int* const ptr( tens1.data() );
+      TT tens2( 1UL, 5UL, 17UL, 3 );
+      tens2 = std::move( tens1 );
+
+      checkPages   ( tens2,  2UL );
+      checkRows    ( tens2,  2UL );
+      checkColumns ( tens2,  3UL );
+      checkSpacing ( tens2, paddedColumns( 3UL ) );
+      checkNonZeros( tens2, 12UL );
+
+      if( tens2.data() != ptr ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Move assignment copied the tensor elements\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( tens2 != TT{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n\n( 7 8 9 )\n( 10 11 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Dense tensor assignment
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor dense tensor assignment (expression)";
+
+      const TT tens1{ { { 1, -2 }, { 3, -4 } }, { { 5, -6 }, { 7, -8 } } };
+      TT tens2;
+      tens2 = 2 * tens1 - tens1 % tens1;
+
+      checkPages   ( tens2, 2UL );
+      checkRows    ( tens2, 2UL );
+      checkColumns ( tens2, 2UL );
+      checkSpacing ( tens2, paddedColumns( 2UL ) );
+      checkNonZeros( tens2, 8UL );
+
+      if( tens2 != TT{ { { 1, -8 }, { -3, -24 } }, { { -15, -48 }, { -35, -80 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 1 -8 )\n( -3 -24 )\n\n( -15 -48 )\n( -35 -80 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor dense tensor assignment (aliased expression)";
+
+      TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+      tens = tens + tens % tens;
+
+      checkPages   ( tens,  2UL );
+      checkRows    ( tens,  2UL );
+      checkColumns ( tens,  3UL );
+      checkNonZeros( tens, 12UL );
+
+      if( tens != TT{ { { 2, 6, 12 }, { 20, 30, 42 } }, { { 56, 72, 90 }, { 110, 132, 156 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 2 6 12 )\n( 20 30 42 )\n\n"
+                "( 56 72 90 )\n( 110 132 156 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor dense tensor assignment (large tensor)";
+
+      TT tens1( 9UL, 111UL, 123UL );
+
+      for( size_t k=0UL; k<9UL; ++k )
+         for( size_t i=0UL; i<111UL; ++i )
+            for( size_t j=0UL; j<123UL; ++j )
+               tens1(k,i,j) = int( k + i + j );
+
+      TT tens2;
+      tens2 = tens1 * 3 - tens1;
+
+      checkPages  ( tens2,   9UL );
+      checkRows   ( tens2, 111UL );
+      checkColumns( tens2, 123UL );
+      checkSpacing( tens2, paddedColumns( 123UL ) );
+
+      for( size_t k=0UL; k<9UL; ++k ) {
+         for( size_t i=0UL; i<111UL; ++i ) {
+            for( size_t j=0UL; j<123UL; ++j ) {
+               if( tens2(k,i,j) != int( 2UL*( k+i+j ) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Assignment failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << "): "
+                      << tens2(k,i,j) << "\n"
+                      << "   Expected value: " << 2UL*( k+i+j ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicTensor addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the DynamicTensor
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   {
+      test_ = "DynamicTensor dense tensor addition assignment";
+
+      const TT tens1{ { { 1, 0, -3 }, { 0, 0, 0 } }, { { -7, 0, 1 }, { 0, 1, 0 } } };
+      TT tens2{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+      tens2 += tens1;
+
+      checkPages   ( tens2,  2UL );
+      checkRows    ( tens2,  2UL );
+      checkColumns ( tens2,  3UL );
+      checkSpacing ( tens2, paddedColumns( 3UL ) );
+      checkNonZeros( tens2, 10UL );
+
+      if( tens2 != TT{ { { 2, 2, 0 }, { 4, 5, 6 } }, { { 0, 8, 10 }, { 10, 12, 12 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 2 2 0 )\n( 4 5 6 )\n\n( 0 8 10 )\n( 10 12 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor dense tensor addition assignment (aliased expression)";
+
+      TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+      tens += tens * 2;
+
+      checkPages   ( tens,  2UL );
+      checkRows    ( tens,  2UL );
+      checkColumns ( tens,  3UL );
+      checkNonZeros( tens, 12UL );
+
+      if( tens != TT{ { { 3, 6, 9 }, { 12, 15, 18 } }, { { 21, 24, 27 }, { 30, 33, 36 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 3 6 9 )\n( 12 15 18 )\n\n( 21 24 27 )\n( 30 33 36 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor dense tensor addition assignment (mismatching sizes)";
+
+      const TT tens1{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+      TT tens2( 2UL, 3UL, 3UL, 1 );
+
+      try {
+         tens2 += tens1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of mismatching tensors succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkPages   ( tens2,  2UL );
+      checkRows    ( tens2,  3UL );
+      checkColumns ( tens2,  3UL );
+      checkNonZeros( tens2, 18UL );
+   }
+
+   {
+      test_ = "DynamicTensor dense tensor addition assignment (large tensor)";
+
+      TT tens1( 9UL, 111UL, 123UL );
+
+      for( size_t k=0UL; k<9UL; ++k )
+         for( size_t i=0UL; i<111UL; ++i )
+            for( size_t j=0UL; j<123UL; ++j )
+               tens1(k,i,j) = int( k + i + j );
+
+      TT tens2( 9UL, 111UL, 123UL, 1 );
+      tens2 += tens1;
+
+      checkSpacing( tens2, paddedColumns( 123UL ) );
+
+      for( size_t k=0UL; k<9UL; ++k ) {
+         for( size_t i=0UL; i<111UL; ++i ) {
+            for( size_t j=0UL; j<123UL; ++j ) {
+               if( tens2(k,i,j) != int( k+i+j+1UL ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Addition assignment failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << "): "
+                      << tens2(k,i,j) << "\n"
+                      << "   Expected value: " << k+i+j+1UL << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicTensor subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the DynamicTensor
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   {
+      test_ = "DynamicTensor dense tensor subtraction assignment";
+
+      const TT tens1{ { { 1, 0, -3 }, { 0, 0, 0 } }, { { -7, 0, 1 }, { 0, 1, 0 } } };
+      TT tens2{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+      tens2 -= tens1;
+
+      checkPages   ( tens2,  2UL );
+      checkRows    ( tens2,  2UL );
+      checkColumns ( tens2,  3UL );
+      checkSpacing ( tens2, paddedColumns( 3UL ) );
+      checkNonZeros( tens2, 11UL );
+
+      if( tens2 != TT{ { { 0, 2, 6 }, { 4, 5, 6 } }, { { 14, 8, 8 }, { 10, 10, 12 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 0 2 6 )\n( 4 5 6 )\n\n( 14 8 8 )\n( 10 10 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor dense tensor subtraction assignment (aliased expression)";
+
+      TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+      tens -= tens * 3;
+
+      checkPages   ( tens,  2UL );
+      checkRows    ( tens,  2UL );
+      checkColumns ( tens,  3UL );
+      checkNonZeros( tens, 12UL );
+
+      if( tens != TT{ { { -2, -4, -6 }, { -8, -10, -12 } },
+                      { { -14, -16, -18 }, { -20, -22, -24 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( -2 -4 -6 )\n( -8 -10 -12 )\n\n"
+                "( -14 -16 -18 )\n( -20 -22 -24 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor dense tensor subtraction assignment (mismatching sizes)";
+
+      const TT tens1{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+      TT tens2( 3UL, 2UL, 3UL, 1 );
+
+      try {
+         tens2 -= tens1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment of mismatching tensors succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkPages   ( tens2,  3UL );
+      checkRows    ( tens2,  2UL );
+      checkColumns ( tens2,  3UL );
+      checkNonZeros( tens2, 18UL );
+   }
+
+   {
+      test_ = "DynamicTensor dense tensor subtraction assignment (large tensor)";
+
+      TT tens1( 9UL, 111UL, 123UL );
+
+      for( size_t k=0UL; k<9UL; ++k )
+         for( size_t i=0UL; i<111UL; ++i )
+            for( size_t j=0UL; j<123UL; ++j )
+               tens1(k,i,j) = int( k + i + j );
+
+      TT tens2( 9UL, 111UL, 123UL, 1 );
+      tens2 -= tens1;
+
+      checkSpacing( tens2, paddedColumns( 123UL ) );
+
+      for( size_t k=0UL; k<9UL; ++k ) {
+         for( size_t i=0UL; i<111UL; ++i ) {
+            for( size_t j=0UL; j<123UL; ++j ) {
+               if( tens2(k,i,j) != 1 - int( k+i+j ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Subtraction assignment failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << "): "
+                      << tens2(k,i,j) << "\n"
+                      << "   Expected value: " << 1 - int( k+i+j ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicTensor Schur product assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the Schur product assignment operators of the DynamicTensor
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSchurAssign()
+{
+   {
+      test_ = "DynamicTensor dense tensor Schur product assignment";
+
+      const TT tens1{ { { 1, 0, -3 }, { 0, 0, 0 } }, { { -7, 0, 1 }, { 0, 1, 0 } } };
+      TT tens2{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+      tens2 %= tens1;
+
+      checkPages   ( tens2, 2UL );
+      checkRows    ( tens2, 2UL );
+      checkColumns ( tens2, 3UL );
+      checkSpacing ( tens2, paddedColumns( 3UL ) );
+      checkNonZeros( tens2, 5UL );
+
+      if( tens2 != TT{ { { 1, 0, -9 }, { 0, 0, 0 } }, { { -49, 0, 9 }, { 0, 11, 0 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Schur product assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 1 0 -9 )\n( 0 0 0 )\n\n( -49 0 9 )\n( 0 11 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor dense tensor Schur product assignment (aliased expression)";
+
+      TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+      tens %= tens;
+
+      checkPages   ( tens,  2UL );
+      checkRows    ( tens,  2UL );
+      checkColumns ( tens,  3UL );
+      checkNonZeros( tens, 12UL );
+
+      if( tens != TT{ { { 1, 4, 9 }, { 16, 25, 36 } }, { { 49, 64, 81 }, { 100, 121, 144 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Schur product assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 1 4 9 )\n( 16 25 36 )\n\n"
+                "( 49 64 81 )\n( 100 121 144 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor dense tensor Schur product assignment (mismatching sizes)";
+
+      const TT tens1{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+      TT tens2( 2UL, 2UL, 4UL, 1 );
+
+      try {
+         tens2 %= tens1;
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Schur product assignment of mismatching tensors succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkPages   ( tens2,  2UL );
+      checkRows    ( tens2,  2UL );
+      checkColumns ( tens2,  4UL );
+      checkNonZeros( tens2, 16UL );
+   }
+
+   {
+      test_ = "DynamicTensor dense tensor Schur product assignment (large tensor)";
+
+      TT tens1( 9UL, 111UL, 123UL );
+
+      for( size_t k=0UL; k<9UL; ++k )
+         for( size_t i=0UL; i<111UL; ++i )
+            for( size_t j=0UL; j<123UL; ++j )
+               tens1(k,i,j) = int( k + i + j );
+
+      TT tens2( 9UL, 111UL, 123UL, 3 );
+      tens2 %= tens1;
+
+      checkSpacing ( tens2, paddedColumns( 123UL ) );
+      checkNonZeros( tens2, 9UL*111UL*123UL - 1UL );
+
+      for( size_t k=0UL; k<9UL; ++k ) {
+         for( size_t i=0UL; i<111UL; ++i ) {
+            for( size_t j=0UL; j<123UL; ++j ) {
+               if( tens2(k,i,j) != int( 3UL*( k+i+j ) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Schur product assignment failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << "): "
+                      << tens2(k,i,j) << "\n"
+                      << "   Expected value: " << 3UL*( k+i+j ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of all DynamicTensor (self-)scaling operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all available ways to scale an instance of the DynamicTensor
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScaling()
+{
+   //=====================================================================================
+   // Self-scaling (v*=s)
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor self-scaling (T*=s)";
+
+      TT tens{ { { 1, 0, -2 }, { 0, 3, 0 } }, { { 0, 0, 4 }, { -5, 0, 0 } } };
+
+      tens *= 3;
+
+      checkPages   ( tens, 2UL );
+      checkRows    ( tens, 2UL );
+      checkColumns ( tens, 3UL );
+      checkSpacing ( tens, paddedColumns( 3UL ) );
+      checkNonZeros( tens, 5UL );
+
+      if( tens != TT{ { { 3, 0, -6 }, { 0, 9, 0 } }, { { 0, 0, 12 }, { -15, 0, 0 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 3 0 -6 )\n( 0 9 0 )\n\n( 0 0 12 )\n( -15 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Self-scaling (v=v*s)
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor self-scaling (T=T*s)";
+
+      TT tens{ { { 1, 0, -2 }, { 0, 3, 0 } }, { { 0, 0, 4 }, { -5, 0, 0 } } };
+
+      tens = tens * 3;
+
+      checkNonZeros( tens, 5UL );
+
+      if( tens != TT{ { { 3, 0, -6 }, { 0, 9, 0 } }, { { 0, 0, 12 }, { -15, 0, 0 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 3 0 -6 )\n( 0 9 0 )\n\n( 0 0 12 )\n( -15 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Self-scaling (v=s*v)
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor self-scaling (T=s*T)";
+
+      TT tens{ { { 1, 0, -2 }, { 0, 3, 0 } }, { { 0, 0, 4 }, { -5, 0, 0 } } };
+
+      tens = -3 * tens;
+
+      checkNonZeros( tens, 5UL );
+
+      if( tens != TT{ { { -3, 0, 6 }, { 0, -9, 0 } }, { { 0, 0, -12 }, { 15, 0, 0 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( -3 0 6 )\n( 0 -9 0 )\n\n( 0 0 -12 )\n( 15 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Negation (v=-v)
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor negation (T=-T)";
+
+      TT tens{ { { 1, 0, -2 }, { 0, 3, 0 } }, { { 0, 0, 4 }, { -5, 0, 0 } } };
+
+      tens = -tens;
+
+      checkNonZeros( tens, 5UL );
+
+      if( tens != TT{ { { -1, 0, 2 }, { 0, -3, 0 } }, { { 0, 0, -4 }, { 5, 0, 0 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed negation operation\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( -1 0 2 )\n( 0 -3 0 )\n\n( 0 0 -4 )\n( 5 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Self-scaling (v/=s)
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor self-scaling (T/=s)";
+
+      DTT tens{ { { 2.0, 0.0, -4.0 }, { 0.0, 6.0, 0.0 } },
+                { { 0.0, 0.0, 8.0 }, { -3.0, 0.0, 0.0 } } };
+
+      tens /= 4.0;
+
+      checkPages   ( tens, 2UL );
+      checkRows    ( tens, 2UL );
+      checkColumns ( tens, 3UL );
+      checkNonZeros( tens, 5UL );
+
+      if( tens != DTT{ { { 0.5, 0.0, -1.0 }, { 0.0, 1.5, 0.0 } },
+                       { { 0.0, 0.0, 2.0 }, { -0.75, 0.0, 0.0 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 0.5 0 -1 )\n( 0 1.5 0 )\n\n( 0 0 2 )\n( -0.75 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Self-scaling (v=v/s)
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor self-scaling (T=T/s)";
+
+      DTT tens{ { { 2.0, 0.0, -4.0 }, { 0.0, 6.0, 0.0 } },
+                { { 0.0, 0.0, 8.0 }, { -3.0, 0.0, 0.0 } } };
+
+      tens = tens / 4.0;
+
+      checkNonZeros( tens, 5UL );
+
+      if( tens != DTT{ { { 0.5, 0.0, -1.0 }, { 0.0, 1.5, 0.0 } },
+                       { { 0.0, 0.0, 2.0 }, { -0.75, 0.0, 0.0 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed self-scaling operation\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 0.5 0 -1 )\n( 0 1.5 0 )\n\n( 0 0 2 )\n( -0.75 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Self-scaling of a large tensor
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor self-scaling (large tensor)";
+
+      TT tens( 9UL, 111UL, 123UL );
+
+      for( size_t k=0UL; k<9UL; ++k )
+         for( size_t i=0UL; i<111UL; ++i )
+            for( size_t j=0UL; j<123UL; ++j )
+               tens(k,i,j) = int( k + i + j );
+
+      tens *= -2;
+
+      checkSpacing( tens, paddedColumns( 123UL ) );
+
+      for( size_t k=0UL; k<9UL; ++k ) {
+         for( size_t i=0UL; i<111UL; ++i ) {
+            for( size_t j=0UL; j<123UL; ++j ) {
+               if( tens(k,i,j) != -2 * int( k+i+j ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Failed self-scaling operation\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << "): "
+                      << tens(k,i,j) << "\n"
+                      << "   Expected value: " << -2 * int( k+i+j ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the DynamicTensor function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the DynamicTensor class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "DynamicTensor::operator()";
+
+   TT tens( 2UL, 3UL, 4UL, 0 );
+
+   // Assignment to the element (1,2,3)
+   tens(1,2,3) = 1;
+
+   checkNonZeros( tens, 1UL );
+
+   // Assignment to the element (0,0,0)
+   tens(0,0,0) = 2;
+
+   checkNonZeros( tens, 2UL );
+
+   // Assignment to the element (1,0,2)
+   tens(1,0,2) = 3;
+
+   checkNonZeros( tens, 3UL );
+
+   // Assignment to the element (0,2,1)
+   tens(0,2,1) = tens(1,0,2);
+
+   checkPages   ( tens, 2UL );
+   checkRows    ( tens, 3UL );
+   checkColumns ( tens, 4UL );
+   checkSpacing ( tens, paddedColumns( 4UL ) );
+   checkNonZeros( tens, 4UL );
+
+   if( tens != TT{ { { 2, 0, 0, 0 }, { 0, 0, 0, 0 }, { 0, 3, 0, 0 } },
+                   { { 0, 0, 3, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 1 } } } ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Function call operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << tens << "\n"
+          << "   Expected result:\n( 2 0 0 0 )\n( 0 0 0 0 )\n( 0 3 0 0 )\n\n"
+             "( 0 0 3 0 )\n( 0 0 0 0 )\n( 0 0 0 1 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Addition assignment to the element (1,2,3)
+   tens(1,2,3) += tens(0,0,0);
+
+   // Subtraction assignment to the element (0,0,0)
+   tens(0,0,0) -= 5;
+
+   // Multiplication assignment to the element (1,0,2)
+   tens(1,0,2) *= -2;
+
+   // Division assignment to the element (0,2,1)
+   tens(0,2,1) /= 3;
+
+   checkSpacing ( tens, paddedColumns( 4UL ) );
+   checkNonZeros( tens, 4UL );
+
+   if( tens != TT{ { { -3, 0,  0, 0 }, { 0, 0, 0, 0 }, { 0, 1, 0, 0 } },
+                   { {  0, 0, -6, 0 }, { 0, 0, 0, 0 }, { 0, 0, 0, 3 } } } ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Function call operator failed\n"
+          << " Details:\n"
+          << "   Result:\n" << tens << "\n"
+          << "   Expected result:\n( -3 0 0 0 )\n( 0 0 0 0 )\n( 0 1 0 0 )\n\n"
+             "( 0 0 -6 0 )\n( 0 0 0 0 )\n( 0 0 0 3 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the at() member function of the DynamicTensor class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the at() member function
+// of the DynamicTensor class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "DynamicTensor::at()";
+
+   TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+   const TT& ctens( tens );
+
+   if( ctens.at(0UL,0UL,0UL) != 1 || ctens.at(0UL,1UL,0UL) != 4 ||
+       ctens.at(1UL,0UL,2UL) != 9 || ctens.at(1UL,1UL,2UL) != 12 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access via at() function failed\n"
+          << " Details:\n"
+          << "   Result: " << ctens.at(0UL,0UL,0UL) << " " << ctens.at(0UL,1UL,0UL) << " "
+          << ctens.at(1UL,0UL,2UL) << " " << ctens.at(1UL,1UL,2UL) << "\n"
+          << "   Expected result: 1 4 9 12\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   tens.at(1UL,0UL,1UL) = -8;
+   tens.at(0UL,1UL,2UL) += 4;
+
+   if( tens != TT{ { { 1, 2, 3 }, { 4, 5, 10 } }, { { 7, -8, 9 }, { 10, 11, 12 } } } ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment via at() function failed\n"
+          << " Details:\n"
+          << "   Result:\n" << tens << "\n"
+          << "   Expected result:\n( 1 2 3 )\n( 4 5 10 )\n\n( 7 -8 9 )\n( 10 11 12 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      tens.at( 2UL, 0UL, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound page access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      tens.at( 0UL, 2UL, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound row access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      ctens.at( 0UL, 0UL, 3UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound column access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the data() member functions of the DynamicTensor class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the low-level data access of the DynamicTensor class
+// template. It checks that the element \f$ (k,i,j) \f$ is stored at the position
+// \f$ (k \cdot M + i) \cdot N' + j \f$ of the aligned array, that the padding elements at the
+// end of every row are zero, and that writes via the data pointer are visible via the function
+// call operator. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testData()
+{
+   test_ = "DynamicTensor::data()";
+
+   TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+   const size_t nn( paddedColumns( 3UL ) );
+
+   checkSpacing( tens, nn );
+
+   if( !blaze::checkAlignment( tens.data() ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid alignment detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t k=0UL; k<2UL; ++k ) {
+      for( size_t i=0UL; i<2UL; ++i )
+      {
+         if( tens.data(k,i) != tens.data() + ( k*2UL+i )*nn ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid row pointer detected\n"
+                << " Details:\n"
+                << "   Page: " << k << ", row: " << i << "\n"
+                << "   Offset         : " << tens.data(k,i) - tens.data() << "\n"
+                << "   Expected offset: " << ( k*2UL+i )*nn << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t j=0UL; j<nn; ++j )
+         {
+            const int expected( j < 3UL ? int( k*6UL + i*3UL + j + 1UL ) : 0 );
+
+            if( tens.data()[( k*2UL+i )*nn+j] != expected ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid storage detected\n"
+                   << " Details:\n"
+                   << "   Position " << ( k*2UL+i )*nn+j << ": "
+                   << tens.data()[( k*2UL+i )*nn+j] << "\n"
+                   << "   Expected value: " << expected << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   tens.data(1UL,0UL)[2] = 20;
+   tens.data()[tens.pageSpacing()+tens.spacing()] = -10;
+
+   checkSpacing( tens, nn );
+
+   if( tens != TT{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 20 }, { -10, 11, 12 } } } ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Assignment via data pointer failed\n"
+          << " Details:\n"
+          << "   Result:\n" << tens << "\n"
+          << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n\n( 7 8 20 )\n( -10 11 12 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the nonZeros() member function of the DynamicTensor class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the nonZeros() member function of the DynamicTensor class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   {
+      test_ = "DynamicTensor::nonZeros()";
+
+      TT tens( 2UL, 2UL, 3UL, 0 );
+
+      checkNonZeros( tens, 0UL );
+
+      tens(0,1,2) =  1;
+      tens(1,0,0) =  2;
+      tens(1,1,2) = -3;
+
+      checkNonZeros( tens, 3UL );
+
+      tens(0,1,2) = 0;
+
+      checkNonZeros( tens, 2UL );
+
+      if( tens != TT{ { { 0, 0, 0 }, { 0, 0, 0 } }, { { 2, 0, 0 }, { 0, 0, -3 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Initialization failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n\n( 2 0 0 )\n( 0 0 -3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor::nonZeros() (large tensor)";
+
+      TT tens( 9UL, 111UL, 123UL );
+
+      for( size_t k=0UL; k<9UL; ++k )
+         for( size_t i=0UL; i<111UL; ++i )
+            for( size_t j=0UL; j<123UL; ++j )
+               tens(k,i,j) = int( ( k+i+j ) % 3UL );
+
+      checkNonZeros( tens, 81918UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reset() member function of the DynamicTensor class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reset() member function of the DynamicTensor class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   using blaze::reset;
+
+
+   test_ = "DynamicTensor::reset()";
+
+   // Initialization check
+   TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+   checkPages   ( tens,  2UL );
+   checkRows    ( tens,  2UL );
+   checkColumns ( tens,  3UL );
+   checkNonZeros( tens, 12UL );
+
+   // Resetting a single element
+   reset( tens(0,1,1) );
+
+   checkNonZeros( tens, 11UL );
+
+   if( tens != TT{ { { 1, 2, 3 }, { 4, 0, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } } ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << tens << "\n"
+          << "   Expected result:\n( 1 2 3 )\n( 4 0 6 )\n\n( 7 8 9 )\n( 10 11 12 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Resetting the entire tensor
+   reset( tens );
+
+   checkPages   ( tens, 2UL );
+   checkRows    ( tens, 2UL );
+   checkColumns ( tens, 3UL );
+   checkSpacing ( tens, paddedColumns( 3UL ) );
+   checkCapacity( tens, 12UL );
+   checkNonZeros( tens, 0UL );
+
+   // Resetting a tensor via the member function
+   tens = 5;
+   tens.reset();
+
+   checkPages   ( tens, 2UL );
+   checkRows    ( tens, 2UL );
+   checkColumns ( tens, 3UL );
+   checkNonZeros( tens, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clear() member function of the DynamicTensor class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the clear() member function of the DynamicTensor class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   using blaze::clear;
+
+
+   test_ = "DynamicTensor::clear()";
+
+   // Initialization check
+   TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+   checkPages   ( tens,  2UL );
+   checkRows    ( tens,  2UL );
+   checkColumns ( tens,  3UL );
+   checkNonZeros( tens, 12UL );
+
+   // Clearing a single element
+   clear( tens(1,0,2) );
+
+   checkPages   ( tens,  2UL );
+   checkRows    ( tens,  2UL );
+   checkColumns ( tens,  3UL );
+   checkNonZeros( tens, 11UL );
+
+   if( tens != TT{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 0 }, { 10, 11, 12 } } } ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clear operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << tens << "\n"
+          << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n\n( 7 8 0 )\n( 10 11 12 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Clearing the tensor
+   clear( tens );
+
+   checkPages   ( tens, 0UL );
+   checkRows    ( tens, 0UL );
+   checkColumns ( tens, 0UL );
+   checkNonZeros( tens, 0UL );
+
+   // Clearing a tensor via the member function
+   tens.resize( 3UL, 4UL, 5UL );
+   tens.clear();
+
+   checkPages   ( tens, 0UL );
+   checkRows    ( tens, 0UL );
+   checkColumns ( tens, 0UL );
+   checkNonZeros( tens, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() member function of the DynamicTensor class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the resize() member function of the DynamicTensor class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "DynamicTensor::resize()";
+
+   // Initialization check
+   TT tens;
+
+   checkPages   ( tens, 0UL );
+   checkRows    ( tens, 0UL );
+   checkColumns ( tens, 0UL );
+   checkNonZeros( tens, 0UL );
+
+   // Resizing to 0x0x0
+   tens.resize( 0UL, 0UL, 0UL );
+
+   checkPages   ( tens, 0UL );
+   checkRows    ( tens, 0UL );
+   checkColumns ( tens, 0UL );
+   checkNonZeros( tens, 0UL );
+
+   // Resizing to 2x1x2
+   tens.resize( 2UL, 1UL, 2UL );
+
+   checkPages   ( tens, 2UL );
+   checkRows    ( tens, 1UL );
+   checkColumns ( tens, 2UL );
+   checkSpacing ( tens, paddedColumns( 2UL ) );
+   checkCapacity( tens, 4UL );
+
+   // Resizing to 3x2x3 and preserving the elements
+   tens(0,0,0) = 1;
+   tens(0,0,1) = 2;
+   tens(1,0,0) = 3;
+   tens(1,0,1) = 4;
+   tens.resize( 3UL, 2UL, 3UL, true );
+
+   checkPages   ( tens, 3UL );
+   checkRows    ( tens, 2UL );
+   checkColumns ( tens, 3UL );
+   checkSpacing ( tens, paddedColumns( 3UL ) );
+   checkCapacity( tens, 18UL );
+
+   if( tens(0,0,0) != 1 || tens(0,0,1) != 2 || tens(1,0,0) != 3 || tens(1,0,1) != 4 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing the tensor failed\n"
+          << " Details:\n"
+          << "   Result:\n" << tens << "\n"
+          << "   Expected result:\n( 1 2 x )\n( x x x )\n\n( 3 4 x )\n( x x x )\n\n"
+             "( x x x )\n( x x x )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Resizing to 1x1x2 and preserving the elements
+   tens.resize( 1UL, 1UL, 2UL, true );
+
+   checkPages   ( tens, 1UL );
+   checkRows    ( tens, 1UL );
+   checkColumns ( tens, 2UL );
+   checkSpacing ( tens, paddedColumns( 2UL ) );
+   checkCapacity( tens, 2UL );
+   checkNonZeros( tens, 2UL );
+
+   if( tens(0,0,0) != 1 || tens(0,0,1) != 2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing the tensor failed\n"
+          << " Details:\n"
+          << "   Result:\n" << tens << "\n"
+          << "   Expected result:\n( 1 2 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Resizing to 4x5x17 without preserving the elements
+   tens.resize( 4UL, 5UL, 17UL, false );
+
+   checkPages   ( tens,  4UL );
+   checkRows    ( tens,  5UL );
+   checkColumns ( tens, 17UL );
+   checkSpacing ( tens, paddedColumns( 17UL ) );
+   checkCapacity( tens, 4UL*5UL*paddedColumns( 17UL ) );
+
+   // Resizing to 2x2x2 without preserving the elements
+   tens.resize( 2UL, 2UL, 2UL, false );
+
+   checkPages   ( tens, 2UL );
+   checkRows    ( tens, 2UL );
+   checkColumns ( tens, 2UL );
+   checkSpacing ( tens, paddedColumns( 2UL ) );
+   checkCapacity( tens, 4UL*5UL*paddedColumns( 17UL ) );
+
+   // Resizing to 0x0x0
+   tens.resize( 0UL, 0UL, 0UL );
+
+   checkPages   ( tens, 0UL );
+   checkRows    ( tens, 0UL );
+   checkColumns ( tens, 0UL );
+   checkNonZeros( tens, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the swap functionality of the DynamicTensor class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the swap function of the DynamicTensor class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "DynamicTensor swap";
+
+   TT tens1{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+   TT tens2{ { { 6, 5 }, { 4, 0 } } };
+
+   swap( tens1, tens2 );
+
+   checkPages   ( tens1, 1UL );
+   checkRows    ( tens1, 2UL );
+   checkColumns ( tens1, 2UL );
+   checkSpacing ( tens1, paddedColumns( 2UL ) );
+   checkCapacity( tens1, 4UL );
+   checkNonZeros( tens1, 3UL );
+
+   if( tens1(0,0,0) != 6 || tens1(0,0,1) != 5 || tens1(0,1,0) != 4 || tens1(0,1,1) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the first tensor failed\n"
+          << " Details:\n"
+          << "   Result:\n" << tens1 << "\n"
+          << "   Expected result:\n( 6 5 )\n( 4 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkPages   ( tens2,  2UL );
+   checkRows    ( tens2,  2UL );
+   checkColumns ( tens2,  3UL );
+   checkSpacing ( tens2, paddedColumns( 3UL ) );
+   checkCapacity( tens2, 12UL );
+   checkNonZeros( tens2, 12UL );
+
+   if( tens2 != TT{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } } ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the second tensor failed\n"
+          << " Details:\n"
+          << "   Result:\n" << tens2 << "\n"
+          << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n\n( 7 8 9 )\n( 10 11 12 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   tens1.swap( tens2 );
+
+   checkPages   ( tens1,  2UL );
+   checkRows    ( tens1,  2UL );
+   checkColumns ( tens1,  3UL );
+   checkNonZeros( tens1, 12UL );
+   checkPages   ( tens2,  1UL );
+   checkRows    ( tens2,  2UL );
+   checkColumns ( tens2,  2UL );
+   checkNonZeros( tens2,  3UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the elementwise map operations on dense tensors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the unary and binary map() functions and the functions
+// based on them (abs(), sqrt(), min(), and max()) for dense tensors. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMap()
+{
+   const TT a{ { { 1, -2, 3 }, { -4, 5, -6 } }, { { 7, -8, 9 }, { -10, 11, -12 } } };
+   const TT b{ { { 2, 2, 2 }, { 3, 3, 3 } }, { { 4, 4, 4 }, { 5, 5, 5 } } };
+
+   {
+      test_ = "abs() function";
+
+      TT tens( abs( a ) );
+
+      checkPages   ( tens,  2UL );
+      checkRows    ( tens,  2UL );
+      checkColumns ( tens,  3UL );
+      checkSpacing ( tens, paddedColumns( 3UL ) );
+      checkNonZeros( tens, 12UL );
+
+      if( tens != TT{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Absolute value computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n\n( 7 8 9 )\n( 10 11 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "sqrt() function";
+
+      const DTT tens1{ { { 1.0, 4.0 }, { 9.0, 16.0 } }, { { 25.0, 0.0 }, { 49.0, 64.0 } } };
+      DTT tens2( sqrt( tens1 ) );
+
+      checkNonZeros( tens2, 7UL );
+
+      if( tens2 != DTT{ { { 1.0, 2.0 }, { 3.0, 4.0 } }, { { 5.0, 0.0 }, { 7.0, 8.0 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Square root computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 1 2 )\n( 3 4 )\n\n( 5 0 )\n( 7 8 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "map() function (unary operation)";
+
+      TT tens( map( a, []( int x ){ return x*x; } ) );
+
+      checkNonZeros( tens, 12UL );
+
+      if( tens != TT{ { { 1, 4, 9 }, { 16, 25, 36 } }, { { 49, 64, 81 }, { 100, 121, 144 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Unary map operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 1 4 9 )\n( 16 25 36 )\n\n"
+                "( 49 64 81 )\n( 100 121 144 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "map() function (binary operation)";
+
+      TT tens( map( a, b, []( int x, int y ){ return x + 2*y; } ) );
+
+      checkNonZeros( tens, 9UL );
+
+      if( tens != TT{ { { 5, 2, 7 }, { 2, 11, 0 } }, { { 15, 0, 17 }, { 0, 21, -2 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Binary map operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 5 2 7 )\n( 2 11 0 )\n\n( 15 0 17 )\n( 0 21 -2 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "min() function";
+
+      TT tens( min( a, b ) );
+
+      if( tens != TT{ { { 1, -2, 2 }, { -4, 3, -6 } }, { { 4, -8, 4 }, { -10, 5, -12 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Minimum computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 1 -2 2 )\n( -4 3 -6 )\n\n( 4 -8 4 )\n( -10 5 -12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "max() function";
+
+      TT tens( max( a, b ) );
+
+      if( tens != TT{ { { 2, 2, 3 }, { 3, 5, 3 } }, { { 7, 4, 9 }, { 5, 11, 5 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Maximum computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 2 2 3 )\n( 3 5 3 )\n\n( 7 4 9 )\n( 5 11 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "map() function (mismatching sizes)";
+
+      try {
+         TT tens( a + TT( 2UL, 3UL, 2UL, 1 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition of mismatching tensors succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the pageslice() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the page slices of dense tensors. It checks that a page
+// slice is a view on the contiguous, padded storage of a single page and that modifications
+// via the view only affect the selected page. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPageSlice()
+{
+   {
+      test_ = "pageslice() read access";
+
+      TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+      auto ps = pageslice( tens, 1UL );
+
+      checkRows   ( ps, 2UL );
+      checkColumns( ps, 3UL );
+
+      if( ps.data() != tens.data(1UL,0UL) || ps.spacing() != tens.spacing() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Page slice does not refer to the tensor storage\n"
+             << " Details:\n"
+             << "   Offset         : " << ps.data() - tens.data() << "\n"
+             << "   Expected offset: " << tens.pageSpacing() << "\n"
+             << "   Spacing         : " << ps.spacing() << "\n"
+             << "   Expected spacing: " << tens.spacing() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( ps != DRMT{ { 7, 8, 9 }, { 10, 11, 12 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Page slice access failed\n"
+             << " Details:\n"
+             << "   Result:\n" << ps << "\n"
+             << "   Expected result:\n( 7 8 9 )\n( 10 11 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const TT& ctens( tens );
+
+      if( pageslice( ctens, 0UL ) != DRMT{ { 1, 2, 3 }, { 4, 5, 6 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Constant page slice access failed\n"
+             << " Details:\n"
+             << "   Result:\n" << pageslice( ctens, 0UL ) << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "pageslice() assignment";
+
+      TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+      pageslice( tens, 0UL ) = DRMT{ { -1, -2, -3 }, { -4, -5, -6 } };
+      pageslice( tens, 1UL ) += trans( DCMT{ { 1, 1 }, { 1, 1 }, { 1, 1 } } );
+
+      checkSpacing ( tens, paddedColumns( 3UL ) );
+      checkNonZeros( tens, 12UL );
+
+      if( tens != TT{ { { -1, -2, -3 }, { -4, -5, -6 } }, { { 8, 9, 10 }, { 11, 12, 13 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Page slice assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( -1 -2 -3 )\n( -4 -5 -6 )\n\n( 8 9 10 )\n( 11 12 13 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      pageslice( tens, 1UL ) = 0;
+
+      checkSpacing ( tens, paddedColumns( 3UL ) );
+      checkNonZeros( tens, 6UL );
+
+      if( tens != TT{ { { -1, -2, -3 }, { -4, -5, -6 } }, { { 0, 0, 0 }, { 0, 0, 0 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Homogeneous page slice assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( -1 -2 -3 )\n( -4 -5 -6 )\n\n( 0 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "pageslice() assignment (large tensor)";
+
+      TT tens( 9UL, 111UL, 123UL );
+
+      for( size_t k=0UL; k<9UL; ++k )
+         for( size_t i=0UL; i<111UL; ++i )
+            for( size_t j=0UL; j<123UL; ++j )
+               tens(k,i,j) = int( k + i + j );
+
+      pageslice( tens, 4UL ) *= 2;
+
+      checkSpacing( tens, paddedColumns( 123UL ) );
+
+      for( size_t k=0UL; k<9UL; ++k ) {
+         for( size_t i=0UL; i<111UL; ++i ) {
+            for( size_t j=0UL; j<123UL; ++j )
+            {
+               const int expected( int( ( k == 4UL ? 2UL : 1UL )*( k+i+j ) ) );
+
+               if( tens(k,i,j) != expected ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Page slice assignment failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << "): "
+                      << tens(k,i,j) << "\n"
+                      << "   Expected value: " << expected << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "pageslice() invalid index";
+
+      TT tens( 2UL, 2UL, 3UL, 1 );
+
+      try {
+         pageslice( tens, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds page slice succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the rowslice() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the row slices of dense tensors. It checks that a row slice
+// is a view with a spacing of one page, i.e. that the \a k-th row of the slice refers to the
+// selected row of the \a k-th page. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testRowSlice()
+{
+   {
+      test_ = "rowslice() read access";
+
+      TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+      auto rs = rowslice( tens, 1UL );
+
+      checkRows   ( rs, 2UL );
+      checkColumns( rs, 3UL );
+
+      if( rs.data() != tens.data(0UL,1UL) || rs.spacing() != tens.pageSpacing() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Row slice does not refer to the tensor storage\n"
+             << " Details:\n"
+             << "   Offset         : " << rs.data() - tens.data() << "\n"
+             << "   Expected offset: " << tens.spacing() << "\n"
+             << "   Spacing         : " << rs.spacing() << "\n"
+             << "   Expected spacing: " << tens.pageSpacing() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( rs != DRMT{ { 4, 5, 6 }, { 10, 11, 12 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Row slice access failed\n"
+             << " Details:\n"
+             << "   Result:\n" << rs << "\n"
+             << "   Expected result:\n( 4 5 6 )\n( 10 11 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "rowslice() assignment";
+
+      TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+      rowslice( tens, 0UL ) = DRMT{ { -1, -2, -3 }, { -7, -8, -9 } };
+      rowslice( tens, 1UL ) *= 2;
+
+      checkSpacing ( tens, paddedColumns( 3UL ) );
+      checkNonZeros( tens, 12UL );
+
+      if( tens != TT{ { { -1, -2, -3 }, { 8, 10, 12 } }, { { -7, -8, -9 }, { 20, 22, 24 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Row slice assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( -1 -2 -3 )\n( 8 10 12 )\n\n( -7 -8 -9 )\n( 20 22 24 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "rowslice() invalid index";
+
+      TT tens( 2UL, 2UL, 3UL, 1 );
+
+      try {
+         rowslice( tens, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds row slice succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the columnslice() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the column slices of dense tensors. The \a k-th row of a
+// column slice refers to the selected column of the \a k-th page, its elements are accessed
+// with a stride of one row spacing. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testColumnSlice()
+{
+   {
+      test_ = "columnslice() read access";
+
+      TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+      auto cs = columnslice( tens, 2UL );
+
+      checkRows    ( cs, 2UL );
+      checkColumns ( cs, 2UL );
+      checkNonZeros( cs, 4UL );
+
+      if( cs != DRMT{ { 3, 6 }, { 9, 12 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Column slice access failed\n"
+             << " Details:\n"
+             << "   Result:\n" << cs << "\n"
+             << "   Expected result:\n( 3 6 )\n( 9 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( &cs(1,1) != &tens(1,1,2) || cs.at(1UL,0UL) != 9 ||
+          *( cs.begin(1UL) + 1L ) != 12 || cs.end(0UL) - cs.begin(0UL) != 2L ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Column slice iteration failed\n"
+             << " Details:\n"
+             << "   Result:\n" << cs << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         cs.at( 2UL, 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound column slice access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+
+      const TT& ctens( tens );
+      const DRMT prod( columnslice( ctens, 0UL ) * DRMT{ { 1 }, { 1 } } );
+
+      if( prod != DRMT{ { 5 }, { 17 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Column slice multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << prod << "\n"
+             << "   Expected result:\n( 5 )\n( 17 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "columnslice() assignment";
+
+      TT tens{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+      auto cs = columnslice( tens, 1UL );
+      cs = DRMT{ { -2, -5 }, { -8, -11 } };
+      cs -= DCMT{ { 1, 1 }, { 1, 1 } };
+
+      checkSpacing ( tens, paddedColumns( 3UL ) );
+      checkNonZeros( tens, 12UL );
+
+      if( tens != TT{ { { 1, -3, 3 }, { 4, -6, 6 } }, { { 7, -9, 9 }, { 10, -12, 12 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Column slice assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 1 -3 3 )\n( 4 -6 6 )\n\n( 7 -9 9 )\n( 10 -12 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      columnslice( tens, 0UL ) = columnslice( tens, 2UL );
+      reset( columnslice( tens, 2UL ) );
+
+      checkSpacing ( tens, paddedColumns( 3UL ) );
+      checkNonZeros( tens, 8UL );
+
+      if( tens != TT{ { { 3, -3, 0 }, { 6, -6, 0 } }, { { 9, -9, 0 }, { 12, -12, 0 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Column slice copy failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 3 -3 0 )\n( 6 -6 0 )\n\n( 9 -9 0 )\n( 12 -12 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "columnslice() assignment (aliased expression)";
+
+      TT tens{ { { 3, 0 }, { 6, 0 } }, { { 9, 0 }, { 12, 0 } } };
+
+      auto cs = columnslice( tens, 0UL );
+      cs = trans( cs );
+
+      if( tens != TT{ { { 3, 0 }, { 9, 0 } }, { { 6, 0 }, { 12, 0 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Aliased column slice assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 3 0 )\n( 9 0 )\n\n( 6 0 )\n( 12 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "columnslice() invalid index";
+
+      TT tens( 2UL, 2UL, 3UL, 1 );
+
+      try {
+         columnslice( tens, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bounds column slice succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched tensor products.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the batched products of dense tensors with dense tensors
+// and dense matrices. Next to small tensors with explicitly given results, the products are
+// tested with closed-form initialized tensors both for many small pages (which are distributed
+// among the threads) and for few large pages (which are multiplied in parallel one after
+// another). In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMult()
+{
+   //=====================================================================================
+   // Small products
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor/DynamicTensor multiplication";
+
+      const TT tens1{ { { 1, 2 }, { 3, 4 } }, { { 5, 6 }, { 7, 8 } } };
+      const TT tens2( tens1 * tens1 );
+
+      checkPages   ( tens2, 2UL );
+      checkRows    ( tens2, 2UL );
+      checkColumns ( tens2, 2UL );
+      checkSpacing ( tens2, paddedColumns( 2UL ) );
+      checkNonZeros( tens2, 8UL );
+
+      if( tens2 != TT{ { { 7, 10 }, { 15, 22 } }, { { 67, 78 }, { 91, 106 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 7 10 )\n( 15 22 )\n\n( 67 78 )\n( 91 106 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const TT tens3( ( tens1 + tens1 ) * tens1 );
+
+      if( tens3 != TT{ { { 14, 20 }, { 30, 44 } }, { { 134, 156 }, { 182, 212 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of an expression failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens3 << "\n"
+             << "   Expected result:\n( 14 20 )\n( 30 44 )\n\n( 134 156 )\n( 182 212 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor/DynamicMatrix multiplication";
+
+      const TT tens1{ { { 1, 2 }, { 3, 4 } }, { { 5, 6 }, { 7, 8 } } };
+      const TT tens2( tens1 * DRMT{ { 1, 0, 1 }, { 0, 1, 1 } } );
+
+      checkPages   ( tens2,  2UL );
+      checkRows    ( tens2,  2UL );
+      checkColumns ( tens2,  3UL );
+      checkSpacing ( tens2, paddedColumns( 3UL ) );
+      checkNonZeros( tens2, 12UL );
+
+      if( tens2 != TT{ { { 1, 2, 3 }, { 3, 4, 7 } }, { { 5, 6, 11 }, { 7, 8, 15 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 3 4 7 )\n\n( 5 6 11 )\n( 7 8 15 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicMatrix/DynamicTensor multiplication";
+
+      const TT tens1{ { { 1, 2 }, { 3, 4 } }, { { 5, 6 }, { 7, 8 } } };
+      const TT tens2( DCMT{ { 1, 1 }, { 0, 1 }, { 1, 0 } } * tens1 );
+
+      checkPages   ( tens2,  2UL );
+      checkRows    ( tens2,  3UL );
+      checkColumns ( tens2,  2UL );
+      checkSpacing ( tens2, paddedColumns( 2UL ) );
+      checkNonZeros( tens2, 12UL );
+
+      if( tens2 != TT{ { { 4, 6 }, { 3, 4 }, { 1, 2 } }, { { 12, 14 }, { 7, 8 }, { 5, 6 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens2 << "\n"
+             << "   Expected result:\n( 4 6 )\n( 3 4 )\n( 1 2 )\n\n( 12 14 )\n( 7 8 )\n( 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "DynamicTensor/DynamicTensor multiplication (empty inner dimension)";
+
+      const TT tens( TT( 2UL, 3UL, 0UL ) * TT( 2UL, 0UL, 4UL ) );
+
+      checkPages   ( tens, 2UL );
+      checkRows    ( tens, 3UL );
+      checkColumns ( tens, 4UL );
+      checkSpacing ( tens, paddedColumns( 4UL ) );
+      checkNonZeros( tens, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Mismatching sizes
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor/DynamicTensor multiplication (mismatching pages)";
+
+      try {
+         const TT tens( TT( 2UL, 2UL, 3UL, 1 ) * TT( 3UL, 3UL, 2UL, 1 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of mismatching tensors succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "DynamicTensor/DynamicTensor multiplication (mismatching inner dimension)";
+
+      try {
+         const TT tens( TT( 2UL, 2UL, 3UL, 1 ) * TT( 2UL, 2UL, 2UL, 1 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of mismatching tensors succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "DynamicTensor/DynamicMatrix multiplication (mismatching sizes)";
+
+      try {
+         const TT tens( TT( 2UL, 2UL, 3UL, 1 ) * DRMT( 2UL, 2UL, 1 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of mismatching operands succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "DynamicMatrix/DynamicTensor multiplication (mismatching sizes)";
+
+      try {
+         const TT tens( DCMT( 2UL, 3UL, 1 ) * TT( 2UL, 2UL, 3UL, 1 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of mismatching operands succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Large products
+   //=====================================================================================
+
+   {
+      test_ = "DynamicTensor/DynamicTensor multiplication (many small pages)";
+
+      // A(k,i,l) = k+i+1 and B(k,l,j) = j+1, therefore C(k,i,j) = 13*(k+i+1)*(j+1)
+      TT tens1( 64UL, 12UL, 13UL );
+      TT tens2( 64UL, 13UL, 14UL );
+
+      for( size_t k=0UL; k<64UL; ++k ) {
+         for( size_t l=0UL; l<13UL; ++l ) {
+            for( size_t i=0UL; i<12UL; ++i ) tens1(k,i,l) = int( k+i+1UL );
+            for( size_t j=0UL; j<14UL; ++j ) tens2(k,l,j) = int( j+1UL );
+         }
+      }
+
+      const TT tens3( tens1 * tens2 );
+
+      checkPages  ( tens3, 64UL );
+      checkRows   ( tens3, 12UL );
+      checkColumns( tens3, 14UL );
+      checkSpacing( tens3, paddedColumns( 14UL ) );
+
+      for( size_t k=0UL; k<64UL; ++k ) {
+         for( size_t i=0UL; i<12UL; ++i ) {
+            for( size_t j=0UL; j<14UL; ++j ) {
+               if( tens3(k,i,j) != int( 13UL*( k+i+1UL )*( j+1UL ) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Multiplication failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << "): "
+                      << tens3(k,i,j) << "\n"
+                      << "   Expected value: " << 13UL*( k+i+1UL )*( j+1UL ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "DynamicTensor/DynamicTensor multiplication (large pages)";
+
+      // A(k,i,l) = k+i+1 and B(k,l,j) = j+1, therefore C(k,i,j) = 67*(k+i+1)*(j+1)
+      TT tens1( 3UL, 151UL, 67UL );
+      TT tens2( 3UL, 67UL, 123UL );
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t l=0UL; l<67UL; ++l ) {
+            for( size_t i=0UL; i<151UL; ++i ) tens1(k,i,l) = int( k+i+1UL );
+            for( size_t j=0UL; j<123UL; ++j ) tens2(k,l,j) = int( j+1UL );
+         }
+      }
+
+      const TT tens3( tens1 * tens2 );
+
+      checkPages  ( tens3,   3UL );
+      checkRows   ( tens3, 151UL );
+      checkColumns( tens3, 123UL );
+      checkSpacing( tens3, paddedColumns( 123UL ) );
+
+      for( size_t k=0UL; k<3UL; ++k ) {
+         for( size_t i=0UL; i<151UL; ++i ) {
+            for( size_t j=0UL; j<123UL; ++j ) {
+               if( tens3(k,i,j) != int( 67UL*( k+i+1UL )*( j+1UL ) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Multiplication failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << "): "
+                      << tens3(k,i,j) << "\n"
+                      << "   Expected value: " << 67UL*( k+i+1UL )*( j+1UL ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "DynamicTensor/DynamicMatrix multiplication (many small pages)";
+
+      // A(k,i,l) = k+i+1 and M(l,j) = j+1, therefore C(k,i,j) = 13*(k+i+1)*(j+1)
+      TT   tens1( 64UL, 12UL, 13UL );
+      DCMT mat  ( 13UL, 14UL );
+
+      for( size_t l=0UL; l<13UL; ++l ) {
+         for( size_t k=0UL; k<64UL; ++k )
+            for( size_t i=0UL; i<12UL; ++i ) tens1(k,i,l) = int( k+i+1UL );
+         for( size_t j=0UL; j<14UL; ++j ) mat(l,j) = int( j+1UL );
+      }
+
+      const TT tens2( tens1 * mat );
+
+      checkPages  ( tens2, 64UL );
+      checkRows   ( tens2, 12UL );
+      checkColumns( tens2, 14UL );
+      checkSpacing( tens2, paddedColumns( 14UL ) );
+
+      for( size_t k=0UL; k<64UL; ++k ) {
+         for( size_t i=0UL; i<12UL; ++i ) {
+            for( size_t j=0UL; j<14UL; ++j ) {
+               if( tens2(k,i,j) != int( 13UL*( k+i+1UL )*( j+1UL ) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Multiplication failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << "): "
+                      << tens2(k,i,j) << "\n"
+                      << "   Expected value: " << 13UL*( k+i+1UL )*( j+1UL ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "DynamicMatrix/DynamicTensor multiplication (many small pages)";
+
+      // M(i,l) = 1 and A(k,l,j) = k+j+1, therefore C(k,i,j) = 13*(k+j+1)
+      const DRMT mat( 12UL, 13UL, 1 );
+      TT tens1( 64UL, 13UL, 14UL );
+
+      for( size_t k=0UL; k<64UL; ++k )
+         for( size_t l=0UL; l<13UL; ++l )
+            for( size_t j=0UL; j<14UL; ++j )
+               tens1(k,l,j) = int( k+j+1UL );
+
+      const TT tens2( mat * tens1 );
+
+      checkPages  ( tens2, 64UL );
+      checkRows   ( tens2, 12UL );
+      checkColumns( tens2, 14UL );
+      checkSpacing( tens2, paddedColumns( 14UL ) );
+
+      for( size_t k=0UL; k<64UL; ++k ) {
+         for( size_t i=0UL; i<12UL; ++i ) {
+            for( size_t j=0UL; j<14UL; ++j ) {
+               if( tens2(k,i,j) != int( 13UL*( k+j+1UL ) ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Multiplication failed\n"
+                      << " Details:\n"
+                      << "   Element (" << k << "," << i << "," << j << "): "
+                      << tens2(k,i,j) << "\n"
+                      << "   Expected value: " << 13UL*( k+j+1UL ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CustomTensor class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the CustomTensor class template, both for unaligned and
+// unpadded as well as for aligned and padded arrays. It checks that the custom tensor operates
+// directly on the given array with the given row spacing. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testCustomTensor()
+{
+   {
+      test_ = "CustomTensor<unaligned,unpadded> constructor";
+
+      int array[13] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+      UTT tens( array+1UL, 2UL, 2UL, 3UL );
+
+      checkPages   ( tens,  2UL );
+      checkRows    ( tens,  2UL );
+      checkColumns ( tens,  3UL );
+      checkSpacing ( tens,  3UL );
+      checkCapacity( tens, 12UL );
+      checkNonZeros( tens, 12UL );
+
+      if( tens != TT{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n\n( 7 8 9 )\n( 10 11 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CustomTensor<unaligned,unpadded> addition assignment";
+
+      int array[12] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+      UTT tens( array, 2UL, 2UL, 3UL );
+
+      tens += TT{ { { 1, 1, 1 }, { 1, 1, 1 } }, { { 2, 2, 2 }, { 2, 2, 2 } } };
+      tens(1,1,2) = -1;
+
+      if( array[0] !=  2 || array[2] !=  4 || array[5] !=  7 ||
+          array[6] !=  9 || array[10] != 13 || array[11] != -1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 2 3 4 )\n( 5 6 7 )\n\n( 9 10 11 )\n( 12 13 -1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      if( pageslice( tens, 1UL ) != DRMT{ { 9, 10, 11 }, { 12, 13, -1 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Page slice access failed\n"
+             << " Details:\n"
+             << "   Result:\n" << pageslice( tens, 1UL ) << "\n"
+             << "   Expected result:\n( 9 10 11 )\n( 12 13 -1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CustomTensor<aligned,padded> assignment";
+
+      const size_t nn( blaze::nextMultiple<size_t>( 3UL, blaze::SIMDTrait<int>::size ) );
+      std::unique_ptr<int[],blaze::Deallocate> memory( blaze::allocate<int>( 2UL*2UL*nn ) );
+      ATT tens( memory.get(), 2UL, 2UL, 3UL, nn );
+
+      tens = TT{ { { 1, 2, 3 }, { 4, 5, 6 } }, { { 7, 8, 9 }, { 10, 11, 12 } } };
+
+      checkPages   ( tens,  2UL );
+      checkRows    ( tens,  2UL );
+      checkColumns ( tens,  3UL );
+      checkSpacing ( tens, nn );
+      checkCapacity( tens, 4UL*nn );
+      checkNonZeros( tens, 12UL );
+
+      if( memory[nn] != 4 || memory[2UL*nn+2UL] != 9 || memory[3UL*nn] != 10 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid storage detected\n"
+             << " Details:\n"
+             << "   Result:\n" << tens << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n\n( 7 8 9 )\n( 10 11 12 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const TT prod( tens * DRMT{ { 1, 0, 0 }, { 0, 2, 0 }, { 0, 0, 3 } } );
+
+      if( prod != TT{ { { 1, 4, 9 }, { 4, 10, 18 } }, { { 7, 16, 27 }, { 10, 22, 36 } } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << prod << "\n"
+             << "   Expected result:\n( 1 4 9 )\n( 4 10 18 )\n\n( 7 16 27 )\n( 10 22 36 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CustomTensor<unaligned,unpadded> constructor (invalid spacing)";
+
+      int array[12];
+
+      try {
+         UTT tens( array, 2UL, 2UL, 3UL, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with invalid spacing succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "CustomTensor<aligned,padded> constructor (unaligned spacing)";
+
+      std::unique_ptr<int[],blaze::Deallocate> memory( blaze::allocate<int>( 64UL ) );
+
+      try {
+         ATT tens( memory.get(), 2UL, 2UL, 3UL, 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with unaligned spacing succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace dynamictensor
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running DynamicTensor class test..." << std::endl;
+
+   try
+   {
+      RUN_DYNAMICTENSOR_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during DynamicTensor class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -76,6 +76,7 @@ DenseTest::DenseTest()
    testUpper();
    testUniUpper();
    testDiagonal();
+   testNonPositiveDefinite();
 }
 //*************************************************************************************************
 
@@ -295,6 +296,26 @@ void DenseTest::testDiagonal()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the LLH decomposition functionality for non-positive-definite matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the dense matrix LLH decomposition rejects matrices that are not
+// positive definite. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testNonPositiveDefinite()
+{
+   testNonPositiveDefiniteMatrix< blaze::DynamicMatrix<double,blaze::rowMajor   > >();
+   testNonPositiveDefiniteMatrix< blaze::DynamicMatrix<double,blaze::columnMajor> >();
+
+   testNonPositiveDefiniteMatrix< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >();
+   testNonPositiveDefiniteMatrix< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+}
+//*************************************************************************************************
+
 } // namespace llh
 
 } // namespace mathtest
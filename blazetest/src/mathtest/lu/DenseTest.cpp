@@ -77,6 +77,7 @@ DenseTest::DenseTest()
    testUpper();
    testUniUpper();
    testDiagonal();
+   testSingular();
 }
 //*************************************************************************************************
 
@@ -296,6 +297,26 @@ void DenseTest::testDiagonal()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the LU decomposition functionality for singular matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dense matrix LU decomposition for singular and nearly singular
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testSingular()
+{
+   testSingularMatrix< blaze::DynamicMatrix<double,blaze::rowMajor   > >();
+   testSingularMatrix< blaze::DynamicMatrix<double,blaze::columnMajor> >();
+
+   testSingularMatrix< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >();
+   testSingularMatrix< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+}
+//*************************************************************************************************
+
 } // namespace lu
 
 } // namespace mathtest
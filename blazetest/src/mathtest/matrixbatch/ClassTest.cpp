@@ -0,0 +1,2267 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrixbatch/ClassTest.cpp
+//  \brief Source file for the MatrixBatch class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <blaze/util/AlignmentCheck.h>
+#include <blazetest/mathtest/matrixbatch/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixbatch {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MatrixBatch class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testAt();
+   testData();
+   testGetSet();
+   testReset();
+   testClear();
+   testResize();
+   testSwap();
+   testMult();
+   testInvert();
+   testDet();
+   testSolve();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the MatrixBatch constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the MatrixBatch class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch default constructor";
+
+      BT batch;
+
+      checkSize  ( batch, 0UL );
+      checkGroups( batch, 0UL );
+
+      if( batch.data() != nullptr ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid data pointer detected\n"
+             << " Details:\n"
+             << "   Data pointer of an empty batch is not a null pointer\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch size constructor (0)";
+
+      BT batch( 0UL );
+
+      checkSize  ( batch, 0UL );
+      checkGroups( batch, 0UL );
+   }
+
+   {
+      test_ = "MatrixBatch size constructor (lanes)";
+
+      BT batch( BT::lanes );
+
+      checkSize   ( batch, BT::lanes );
+      checkGroups ( batch, 1UL );
+      checkPadding( batch );
+
+      for( size_t k=0UL; k<batch.size(); ++k ) {
+         if( batch.get( k ) != MT() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << batch.get( k ) << "\n"
+                << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch size constructor (lanes+1)";
+
+      BT batch( BT::lanes+1UL );
+
+      checkSize   ( batch, BT::lanes+1UL );
+      checkGroups ( batch, 2UL );
+      checkPadding( batch );
+
+      for( size_t k=0UL; k<batch.size(); ++k ) {
+         if( batch.get( k ) != MT() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Construction failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << batch.get( k ) << "\n"
+                << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch copy constructor";
+
+      BT batch1( BT::lanes+1UL );
+      batch1.set( BT::lanes, MT{ { 1, 2, 3 }, { 4, 5, 6 } } );
+      batch1(0,1,2) = 7;
+
+      BT batch2( batch1 );
+      batch1(0,1,2) = 8;
+      batch1(BT::lanes,0,0) = 9;
+
+      checkSize   ( batch2, BT::lanes+1UL );
+      checkGroups ( batch2, 2UL );
+      checkPadding( batch2 );
+
+      if( batch2.data() == batch1.data() ||
+          batch2.get( 0UL ) != MT{ { 0, 0, 0 }, { 0, 0, 7 } } ||
+          batch2.get( 1UL ) != MT() ||
+          batch2.get( BT::lanes ) != MT{ { 1, 2, 3 }, { 4, 5, 6 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result (matrix 0):\n" << batch2.get( 0UL ) << "\n"
+             << "   Result (matrix " << BT::lanes << "):\n" << batch2.get( BT::lanes ) << "\n"
+             << "   Expected result (matrix 0):\n( 0 0 0 )\n( 0 0 7 )\n"
+             << "   Expected result (matrix " << BT::lanes << "):\n( 1 2 3 )\n( 4 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Move constructor
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch move constructor";
+
+      BT batch1( BT::lanes+1UL );
+      batch1.set( BT::lanes, MT{ { 1, 2, 3 }, { 4, 5, 6 } } );
+      const int* data( batch1.data() );
+
+      BT batch2( std::move( batch1 ) );
+
+      checkSize  ( batch1, 0UL );
+      checkGroups( batch1, 0UL );
+
+      checkSize   ( batch2, BT::lanes+1UL );
+      checkGroups ( batch2, 2UL );
+      checkPadding( batch2 );
+
+      if( batch2.data() != data || batch1.data() != nullptr ||
+          batch2.get( BT::lanes ) != MT{ { 1, 2, 3 }, { 4, 5, 6 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Data pointer was not transferred\n"
+             << "   Result (matrix " << BT::lanes << "):\n" << batch2.get( BT::lanes ) << "\n"
+             << "   Expected result (matrix " << BT::lanes << "):\n( 1 2 3 )\n( 4 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the MatrixBatch assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the copy and move assignment operators of the MatrixBatch
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch copy assignment";
+
+      BT batch1( BT::lanes+1UL );
+      batch1.set( 1UL, MT{ { 1, 2, 3 }, { 4, 5, 6 } } );
+      batch1.set( BT::lanes, MT{ { -1, 0, 1 }, { 0, 2, 0 } } );
+
+      BT batch2( 3UL );
+      batch2.set( 0UL, MT{ { 9, 9, 9 }, { 9, 9, 9 } } );
+
+      batch2 = batch1;
+      batch1(1,0,0) = 10;
+
+      checkSize   ( batch2, BT::lanes+1UL );
+      checkGroups ( batch2, 2UL );
+      checkPadding( batch2 );
+
+      if( batch2.get( 0UL ) != MT() ||
+          batch2.get( 1UL ) != MT{ { 1, 2, 3 }, { 4, 5, 6 } } ||
+          batch2.get( BT::lanes ) != MT{ { -1, 0, 1 }, { 0, 2, 0 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result (matrix 0):\n" << batch2.get( 0UL ) << "\n"
+             << "   Result (matrix 1):\n" << batch2.get( 1UL ) << "\n"
+             << "   Result (matrix " << BT::lanes << "):\n" << batch2.get( BT::lanes ) << "\n"
+             << "   Expected result (matrix 0):\n( 0 0 0 )\n( 0 0 0 )\n"
+             << "   Expected result (matrix 1):\n( 1 2 3 )\n( 4 5 6 )\n"
+             << "   Expected result (matrix " << BT::lanes << "):\n( -1 0 1 )\n(  0 2 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "MatrixBatch copy assignment (empty batch)";
+
+      BT batch1;
+      BT batch2( 3UL );
+
+      batch2 = batch1;
+
+      checkSize  ( batch2, 0UL );
+      checkGroups( batch2, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Move assignment
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch move assignment";
+
+      BT batch1( BT::lanes+1UL );
+      batch1.set( BT::lanes, MT{ { 1, 2, 3 }, { 4, 5, 6 } } );
+      const int* data( batch1.data() );
+
+      BT batch2( 3UL );
+      batch2 = std::move( batch1 );
+
+      checkSize   ( batch2, BT::lanes+1UL );
+      checkGroups ( batch2, 2UL );
+      checkPadding( batch2 );
+
+      if( batch2.data() != data || batch2.get( BT::lanes ) != MT{ { 1, 2, 3 }, { 4, 5, 6 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Data pointer was not transferred\n"
+             << "   Result (matrix " << BT::lanes << "):\n" << batch2.get( BT::lanes ) << "\n"
+             << "   Expected result (matrix " << BT::lanes << "):\n( 1 2 3 )\n( 4 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the MatrixBatch function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the function call operator
+// of the MatrixBatch class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "MatrixBatch::operator()";
+
+   BT batch( BT::lanes+2UL );
+
+   // Writing the first element of the first matrix
+   batch(0,0,0) = 1;
+
+   // Writing the last element of the last matrix
+   batch(BT::lanes+1UL,1,2) = 2;
+
+   // Writing an element of the second matrix
+   batch(1,0,1) = 3;
+
+   // Copying an element into the first matrix of the second lane group
+   batch(BT::lanes,1,0) = batch(1,0,1);
+
+   // Modifying elements via compound assignments
+   batch(0,0,0) += 4;
+   batch(BT::lanes+1UL,1,2) *= -3;
+   batch(1,0,1) -= 1;
+
+   checkSize   ( batch, BT::lanes+2UL );
+   checkGroups ( batch, 2UL );
+   checkPadding( batch );
+
+   const BT& cbatch( batch );
+
+   for( size_t k=0UL; k<batch.size(); ++k )
+   {
+      const MT ref( k == 0UL ? MT{ { 5, 0, 0 }, { 0, 0, 0 } }
+                  : k == 1UL ? MT{ { 0, 2, 0 }, { 0, 0, 0 } }
+                  : k == BT::lanes ? MT{ { 0, 0, 0 }, { 3, 0, 0 } }
+                  : k == BT::lanes+1UL ? MT{ { 0, 0, 0 }, { 0, 0, -6 } }
+                  : MT() );
+
+      for( size_t i=0UL; i<2UL; ++i ) {
+         for( size_t j=0UL; j<3UL; ++j ) {
+            if( cbatch(k,i,j) != ref(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Function call operator failed\n"
+                   << " Details:\n"
+                   << "   Element (k,i,j): (" << k << "," << i << "," << j << ")\n"
+                   << "   Result:\n" << batch.get( k ) << "\n"
+                   << "   Expected result:\n" << ref << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the MatrixBatch class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of adding and accessing elements via the \c at() member function
+// of the MatrixBatch class template. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "MatrixBatch::at()";
+
+   BT batch( BT::lanes+1UL );
+
+   batch.at(0,0,0) = 1;
+   batch.at(BT::lanes,1,2) = 2;
+   batch.at(1,0,1) = 3;
+   batch.at(BT::lanes,0,1) = batch.at(1,0,1);
+   batch.at(1,0,1) *= 2;
+
+   checkPadding( batch );
+
+   const BT& cbatch( batch );
+
+   if( cbatch.at(0,0,0) != 1 || cbatch.at(1,0,1) != 6 ||
+       batch.get( BT::lanes ) != MT{ { 0, 3, 0 }, { 0, 0, 2 } } ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access via at() function failed\n"
+          << " Details:\n"
+          << "   Result (matrix 0):\n" << batch.get( 0UL ) << "\n"
+          << "   Result (matrix 1):\n" << batch.get( 1UL ) << "\n"
+          << "   Result (matrix " << BT::lanes << "):\n" << batch.get( BT::lanes ) << "\n"
+          << "   Expected result (matrix 0):\n( 1 0 0 )\n( 0 0 0 )\n"
+          << "   Expected result (matrix 1):\n( 0 6 0 )\n( 0 0 0 )\n"
+          << "   Expected result (matrix " << BT::lanes << "):\n( 0 3 0 )\n( 0 0 2 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      batch.at(BT::lanes+1UL,0,0) = 4;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound batch access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      cbatch.at(0,2,0);
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound row access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      batch.at(0,0,3) = 4;
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound column access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c data() member functions of the MatrixBatch class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c data() member functions of the MatrixBatch class
+// template. It checks the interleaved storage layout, i.e. that element \f$ (i,j) \f$ of matrix
+// \a k is stored at position \f$ (i*N+j)*lanes+k\%lanes \f$ of lane group \f$ k/lanes \f$, and
+// the alignment of the lane groups. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testData()
+{
+   {
+      test_ = "MatrixBatch::data() (storage layout)";
+
+      BT batch( BT::lanes+1UL );
+
+      for( size_t k=0UL; k<batch.size(); ++k ) {
+         for( size_t i=0UL; i<2UL; ++i ) {
+            for( size_t j=0UL; j<3UL; ++j ) {
+               batch(k,i,j) = static_cast<int>( 10UL*k + 3UL*i + j );
+            }
+         }
+      }
+
+      checkPadding( batch );
+
+      const BT& cbatch( batch );
+
+      for( size_t k=0UL; k<batch.size(); ++k ) {
+         for( size_t i=0UL; i<2UL; ++i ) {
+            for( size_t j=0UL; j<3UL; ++j )
+            {
+               const size_t g( k / BT::lanes );
+               const size_t l( k % BT::lanes );
+               const int value( cbatch.data( g )[(i*3UL+j)*BT::lanes+l] );
+
+               if( value != static_cast<int>( 10UL*k + 3UL*i + j ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Invalid storage layout detected\n"
+                      << " Details:\n"
+                      << "   Element (k,i,j): (" << k << "," << i << "," << j << ")\n"
+                      << "   Stored value: " << value << "\n"
+                      << "   Expected value: " << ( 10UL*k + 3UL*i + j ) << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch::data() (lane groups)";
+
+      BT batch( 2UL*BT::lanes+1UL );
+
+      for( size_t g=0UL; g<batch.groups(); ++g )
+      {
+         if( batch.data( g ) != batch.data() + g*BT::groupSize ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid lane group offset detected\n"
+                << " Details:\n"
+                << "   Lane group: " << g << "\n"
+                << "   Offset         : " << ( batch.data( g ) - batch.data() ) << "\n"
+                << "   Expected offset: " << g*BT::groupSize << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         if( !blaze::checkAlignment( batch.data( g ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid alignment detected\n"
+                << " Details:\n"
+                << "   Lane group: " << g << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch::data() (write access)";
+
+      BT batch( BT::lanes+1UL );
+
+      batch.data( 1UL )[5UL*BT::lanes] = -1;
+      batch.data()[BT::lanes+1UL] = 2;
+
+      if( batch.get( 1UL ) != MT{ { 0, 2, 0 }, { 0, 0, 0 } } ||
+          batch.get( BT::lanes ) != MT{ { 0, 0, 0 }, { 0, 0, -1 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Write access via data() failed\n"
+             << " Details:\n"
+             << "   Result (matrix 1):\n" << batch.get( 1UL ) << "\n"
+             << "   Result (matrix " << BT::lanes << "):\n" << batch.get( BT::lanes ) << "\n"
+             << "   Expected result (matrix 1):\n( 0 2 0 )\n( 0 0 0 )\n"
+             << "   Expected result (matrix " << BT::lanes << "):\n( 0 0 0 )\n( 0 0 -1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c get() and \c set() member functions of the MatrixBatch class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c get() and \c set() member functions of the MatrixBatch
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testGetSet()
+{
+   {
+      test_ = "MatrixBatch::set() (row-major static matrix)";
+
+      BT batch( 3UL );
+      batch.set( 2UL, MT{ { 1, 2, 3 }, { 4, 5, 6 } } );
+
+      if( batch.get( 0UL ) != MT() || batch.get( 1UL ) != MT() ||
+          batch(2,0,0) != 1 || batch(2,0,1) != 2 || batch(2,0,2) != 3 ||
+          batch(2,1,0) != 4 || batch(2,1,1) != 5 || batch(2,1,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << batch.get( 2UL ) << "\n"
+             << "   Expected result:\n( 1 2 3 )\n( 4 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "MatrixBatch::set() (column-major dynamic matrix)";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat{ { 1, 2, 3 }, { 4, 5, 6 } };
+
+      BT batch( BT::lanes+1UL );
+      batch.set( BT::lanes, mat );
+      batch.set( 0UL, mat );
+      batch.set( 0UL, -mat );
+
+      checkPadding( batch );
+
+      if( batch.get( 0UL ) != MT{ { -1, -2, -3 }, { -4, -5, -6 } } ||
+          batch.get( BT::lanes ) != MT{ { 1, 2, 3 }, { 4, 5, 6 } } ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a matrix failed\n"
+             << " Details:\n"
+             << "   Result (matrix 0):\n" << batch.get( 0UL ) << "\n"
+             << "   Result (matrix " << BT::lanes << "):\n" << batch.get( BT::lanes ) << "\n"
+             << "   Expected result (matrix 0):\n( -1 -2 -3 )\n( -4 -5 -6 )\n"
+             << "   Expected result (matrix " << BT::lanes << "):\n( 1 2 3 )\n( 4 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "MatrixBatch::set() (invalid matrix size)";
+
+      BT batch( 2UL );
+
+      try {
+         batch.set( 0UL, blaze::StaticMatrix<int,3UL,2UL>() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a 3x2 matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         batch.set( 1UL, blaze::DynamicMatrix<int>( 2UL, 2UL, 1 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setting a 2x2 matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the MatrixBatch class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the MatrixBatch class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "MatrixBatch::reset()";
+
+   BT batch( BT::lanes+1UL );
+   batch.set( 0UL, MT{ { 1, 2, 3 }, { 4, 5, 6 } } );
+   batch.set( BT::lanes, MT{ { 1, 2, 3 }, { 4, 5, 6 } } );
+
+   // Resetting a single element
+   batch(0,1,1) = 0;
+
+   if( batch.get( 0UL ) != MT{ { 1, 2, 3 }, { 4, 0, 6 } } ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << batch.get( 0UL ) << "\n"
+          << "   Expected result:\n( 1 2 3 )\n( 4 0 6 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Resetting the entire batch
+   reset( batch );
+
+   checkSize   ( batch, BT::lanes+1UL );
+   checkGroups ( batch, 2UL );
+   checkPadding( batch );
+
+   for( size_t k=0UL; k<batch.size(); ++k ) {
+      if( batch.get( k ) != MT() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Matrix index: " << k << "\n"
+             << "   Result:\n" << batch.get( k ) << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the MatrixBatch class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the MatrixBatch class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "MatrixBatch::clear()";
+
+   BT batch( BT::lanes+1UL );
+   batch.set( BT::lanes, MT{ { 1, 2, 3 }, { 4, 5, 6 } } );
+
+   clear( batch );
+
+   checkSize  ( batch, 0UL );
+   checkGroups( batch, 0UL );
+
+   batch.resize( 1UL );
+
+   checkSize   ( batch, 1UL );
+   checkGroups ( batch, 1UL );
+   checkPadding( batch );
+
+   if( batch.get( 0UL ) != MT() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clear operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << batch.get( 0UL ) << "\n"
+          << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c resize() member function of the MatrixBatch class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c resize() member function of the MatrixBatch class
+// template. It checks that the existing matrices are preserved, that all new matrices are
+// zero-initialized and that the padding lanes of the last lane group are kept zero. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "MatrixBatch::resize()";
+
+   const size_t L( BT::lanes );
+
+   BT batch;
+
+   // Resizing to 2*lanes+1 matrices
+   batch.resize( 2UL*L+1UL );
+
+   checkSize   ( batch, 2UL*L+1UL );
+   checkGroups ( batch, 3UL );
+   checkPadding( batch );
+
+   for( size_t k=0UL; k<batch.size(); ++k ) {
+      batch(k,0,0) = static_cast<int>( k+1UL );
+      batch(k,1,2) = static_cast<int>( k+1UL );
+   }
+
+   // Shrinking to lanes+1 matrices
+   batch.resize( L+1UL );
+
+   checkSize   ( batch, L+1UL );
+   checkGroups ( batch, 2UL );
+   checkPadding( batch );
+
+   // Growing to lanes+3 matrices within the same lane groups
+   batch.resize( L+3UL );
+
+   checkSize   ( batch, L+3UL );
+   checkGroups ( batch, 2UL );
+   checkPadding( batch );
+
+   for( size_t k=0UL; k<batch.size(); ++k )
+   {
+      const int v( k <= L ? static_cast<int>( k+1UL ) : 0 );
+      const MT ref{ { v, 0, 0 }, { 0, 0, v } };
+
+      if( batch.get( k ) != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the batch failed\n"
+             << " Details:\n"
+             << "   Matrix index: " << k << "\n"
+             << "   Result:\n" << batch.get( k ) << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Growing to 3*lanes matrices
+   batch.resize( 3UL*L );
+
+   checkSize   ( batch, 3UL*L );
+   checkGroups ( batch, 3UL );
+   checkPadding( batch );
+
+   for( size_t k=0UL; k<batch.size(); ++k )
+   {
+      const int v( k <= L ? static_cast<int>( k+1UL ) : 0 );
+      const MT ref{ { v, 0, 0 }, { 0, 0, v } };
+
+      if( batch.get( k ) != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the batch failed\n"
+             << " Details:\n"
+             << "   Matrix index: " << k << "\n"
+             << "   Result:\n" << batch.get( k ) << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Resizing to 0 matrices
+   batch.resize( 0UL );
+
+   checkSize  ( batch, 0UL );
+   checkGroups( batch, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the MatrixBatch class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the MatrixBatch class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "MatrixBatch swap";
+
+   BT batch1( 2UL );
+   batch1.set( 1UL, MT{ { 1, 2, 3 }, { 4, 5, 6 } } );
+
+   BT batch2( BT::lanes+1UL );
+   batch2.set( BT::lanes, MT{ { 6, 5, 4 }, { 3, 2, 1 } } );
+
+   const int* data1( batch1.data() );
+   const int* data2( batch2.data() );
+
+   swap( batch1, batch2 );
+
+   checkSize   ( batch1, BT::lanes+1UL );
+   checkGroups ( batch1, 2UL );
+   checkPadding( batch1 );
+
+   checkSize   ( batch2, 2UL );
+   checkGroups ( batch2, 1UL );
+   checkPadding( batch2 );
+
+   if( batch1.data() != data2 || batch2.data() != data1 ||
+       batch1.get( BT::lanes ) != MT{ { 6, 5, 4 }, { 3, 2, 1 } } ||
+       batch2.get( 1UL ) != MT{ { 1, 2, 3 }, { 4, 5, 6 } } ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the first batch failed\n"
+          << " Details:\n"
+          << "   Result (first batch, matrix " << BT::lanes << "):\n"
+          << batch1.get( BT::lanes ) << "\n"
+          << "   Result (second batch, matrix 1):\n" << batch2.get( 1UL ) << "\n"
+          << "   Expected result (first batch, matrix " << BT::lanes << "):\n"
+          << "( 6 5 4 )\n( 3 2 1 )\n"
+          << "   Expected result (second batch, matrix 1):\n( 1 2 3 )\n( 4 5 6 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched multiplication of two MatrixBatch instances.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c mult() function and the multiplication operator for
+// matrix batches, including aliased operands and batches beyond the SMP batch threshold. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMult()
+{
+   //=====================================================================================
+   // Non-square matrices
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch mult (2x3 * 3x2, int)";
+
+      const size_t n( BT::lanes+1UL );
+
+      BT A( n );
+      blaze::MatrixBatch<int,3UL,2UL> B( n );
+      blaze::MatrixBatch<int,2UL,2UL> C( 3UL );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         const int v( static_cast<int>( k ) );
+         A.set( k, MT{ { 1, 0, v }, { 0, 1, 1 } } );
+         B.set( k, blaze::StaticMatrix<int,3UL,2UL>{ { 1, 2 }, { 3, 4 }, { 1, v } } );
+      }
+
+      mult( C, A, B );
+
+      checkSize   ( C, n );
+      checkGroups ( C, 2UL );
+      checkPadding( C );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const int v( static_cast<int>( k ) );
+         const blaze::StaticMatrix<int,2UL,2UL> ref{ { 1+v, 2+v*v }, { 4, 4+v } };
+
+         if( C.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << C.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch multiplication operator (2x3 * 3x2, double)";
+
+      typedef blaze::MatrixBatch<double,2UL,3UL>  DBT;
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+      blaze::MatrixBatch<double,3UL,2UL> B( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         const double v( k );
+         A.set( k, blaze::StaticMatrix<double,2UL,3UL>{ { 1.0, 0.0, v }, { 0.0, 1.0, 1.0 } } );
+         B.set( k, blaze::StaticMatrix<double,3UL,2UL>{ { 1.0, 2.0 }, { 3.0, 4.0 }, { 1.0, v } } );
+      }
+
+      const blaze::MatrixBatch<double,2UL,2UL> C( A * B );
+
+      checkSize   ( C, n );
+      checkGroups ( C, 2UL );
+      checkPadding( C );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const double v( k );
+         const blaze::StaticMatrix<double,2UL,2UL> ref{ { 1.0+v, 2.0+v*v }, { 4.0, 4.0+v } };
+
+         if( C.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << C.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch mult (empty batches)";
+
+      blaze::MatrixBatch<double,2UL,2UL> A, B, C( 5UL );
+
+      mult( C, A, B );
+
+      checkSize  ( C, 0UL );
+      checkGroups( C, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Aliased operands
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch mult (aliased right-hand side operand)";
+
+      typedef blaze::MatrixBatch<double,2UL,2UL>   DBT;
+      typedef blaze::StaticMatrix<double,2UL,2UL>  DMT;
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n ), B( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, DMT{ { 1.0, double( k ) }, { 0.0, 1.0 } } );
+         B.set( k, DMT{ { 1.0, 0.0 }, { 1.0, 1.0 } } );
+      }
+
+      mult( B, A, B );
+
+      checkSize   ( B, n );
+      checkPadding( B );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const DMT ref{ { 1.0+k, double( k ) }, { 1.0, 1.0 } };
+
+         if( B.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << B.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch mult (aliased left-hand side operand)";
+
+      typedef blaze::MatrixBatch<double,2UL,2UL>   DBT;
+      typedef blaze::StaticMatrix<double,2UL,2UL>  DMT;
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n ), B( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, DMT{ { 1.0, double( k ) }, { 0.0, 1.0 } } );
+         B.set( k, DMT{ { 1.0, 0.0 }, { 1.0, 1.0 } } );
+      }
+
+      mult( A, A, B );
+
+      checkSize   ( A, n );
+      checkPadding( A );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const DMT ref{ { 1.0+k, double( k ) }, { 1.0, 1.0 } };
+
+         if( A.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << A.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Invalid batch sizes
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch mult (non-matching batch sizes)";
+
+      blaze::MatrixBatch<double,2UL,2UL> A( 3UL ), B( 4UL ), C;
+
+      try {
+         mult( C, A, B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication of batches of different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Large batches
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch mult (large batch)";
+
+      typedef blaze::MatrixBatch<double,2UL,2UL>   DBT;
+      typedef blaze::StaticMatrix<double,2UL,2UL>  DMT;
+
+      const size_t n( 10007UL );
+
+      DBT A( n ), B( n ), C;
+
+      for( size_t k=0UL; k<n; ++k ) {
+         const double a( k % 7UL );
+         const double b( k % 5UL );
+         A.set( k, DMT{ { 1.0, a }, { 0.0, 1.0 } } );
+         B.set( k, DMT{ { 1.0, 0.0 }, { b, 1.0 } } );
+      }
+
+      mult( C, A, B );
+
+      checkSize   ( C, n );
+      checkGroups ( C, ( n + DBT::lanes - 1UL ) / DBT::lanes );
+      checkPadding( C );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const double a( k % 7UL );
+         const double b( k % 5UL );
+         const DMT ref{ { 1.0+a*b, a }, { b, 1.0 } };
+
+         if( C.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << C.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched inversion of the matrices of a MatrixBatch.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c invert() function for matrix batches. It covers the
+// closed-form kernels for matrices up to \f$ 4 \times 4 \f$, the pivoting Gauss-Jordan kernel
+// for larger matrices, complex matrices, singular matrices and batches beyond the SMP batch
+// threshold. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInvert()
+{
+   //=====================================================================================
+   // Real matrices
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch invert (1x1)";
+
+      typedef blaze::MatrixBatch<double,1UL,1UL>   DBT;
+      typedef blaze::StaticMatrix<double,1UL,1UL>  DMT;
+
+      const DMT base{ { 4.0 } };
+      const DMT inv { { 0.25 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      invert( A );
+
+      checkSize   ( A, n );
+      checkPadding( A );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const DMT ref( inv / scale( k ) );
+
+         if( A.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched inversion failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << A.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch invert (2x2)";
+
+      typedef blaze::MatrixBatch<double,2UL,2UL>   DBT;
+      typedef blaze::StaticMatrix<double,2UL,2UL>  DMT;
+
+      const DMT base{ { 2.0, 1.0 }, { 1.0, 1.0 } };
+      const DMT inv { {  1.0, -1.0 }, { -1.0,  2.0 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      invert( A );
+
+      checkSize   ( A, n );
+      checkPadding( A );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const DMT ref( inv / scale( k ) );
+
+         if( A.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched inversion failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << A.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch invert (3x3)";
+
+      typedef blaze::MatrixBatch<double,3UL,3UL>   DBT;
+      typedef blaze::StaticMatrix<double,3UL,3UL>  DMT;
+
+      const DMT base{ { 1.0, 2.0, 0.0 },
+                      { 0.0, 1.0, 0.0 },
+                      { 0.0, 0.0, 2.0 } };
+      const DMT inv { {  1.0, -2.0,  0.0 },
+                      {  0.0,  1.0,  0.0 },
+                      {  0.0,  0.0,  0.5 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      invert( A );
+
+      checkSize   ( A, n );
+      checkPadding( A );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const DMT ref( inv / scale( k ) );
+
+         if( A.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched inversion failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << A.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch invert (4x4)";
+
+      typedef blaze::MatrixBatch<double,4UL,4UL>   DBT;
+      typedef blaze::StaticMatrix<double,4UL,4UL>  DMT;
+
+      const DMT base{ { 1.0, 1.0, 0.0, 0.0 },
+                      { 0.0, 1.0, 1.0, 0.0 },
+                      { 0.0, 0.0, 1.0, 1.0 },
+                      { 0.0, 0.0, 0.0, 1.0 } };
+      const DMT inv { {  1.0, -1.0,  1.0, -1.0 },
+                      {  0.0,  1.0, -1.0,  1.0 },
+                      {  0.0,  0.0,  1.0, -1.0 },
+                      {  0.0,  0.0,  0.0,  1.0 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      invert( A );
+
+      checkSize   ( A, n );
+      checkPadding( A );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const DMT ref( inv / scale( k ) );
+
+         if( A.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched inversion failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << A.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch invert (5x5, pivoting)";
+
+      typedef blaze::MatrixBatch<double,5UL,5UL>   DBT;
+      typedef blaze::StaticMatrix<double,5UL,5UL>  DMT;
+
+      const DMT base{ { 0.0, 1.0, 0.0, 0.0, 0.0 },
+                      { 1.0, 0.0, 0.0, 0.0, 0.0 },
+                      { 0.0, 0.0, 2.0, 0.0, 0.0 },
+                      { 0.0, 0.0, 0.0, 1.0, 1.0 },
+                      { 0.0, 0.0, 0.0, 0.0, 1.0 } };
+      const DMT inv { {  0.0,  1.0,  0.0,  0.0,  0.0 },
+                      {  1.0,  0.0,  0.0,  0.0,  0.0 },
+                      {  0.0,  0.0,  0.5,  0.0,  0.0 },
+                      {  0.0,  0.0,  0.0,  1.0, -1.0 },
+                      {  0.0,  0.0,  0.0,  0.0,  1.0 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      invert( A );
+
+      checkSize   ( A, n );
+      checkPadding( A );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const DMT ref( inv / scale( k ) );
+
+         if( A.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched inversion failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << A.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch invert (3x3, large batch)";
+
+      typedef blaze::MatrixBatch<double,3UL,3UL>   DBT;
+      typedef blaze::StaticMatrix<double,3UL,3UL>  DMT;
+
+      const DMT base{ { 1.0, 2.0, 0.0 },
+                      { 0.0, 1.0, 0.0 },
+                      { 0.0, 0.0, 2.0 } };
+      const DMT inv { {  1.0, -2.0,  0.0 },
+                      {  0.0,  1.0,  0.0 },
+                      {  0.0,  0.0,  0.5 } };
+
+      const size_t n( 10007UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      invert( A );
+
+      checkSize   ( A, n );
+      checkPadding( A );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const DMT ref( inv / scale( k ) );
+
+         if( A.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched inversion failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << A.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch invert (5x5, large batch)";
+
+      typedef blaze::MatrixBatch<double,5UL,5UL>   DBT;
+      typedef blaze::StaticMatrix<double,5UL,5UL>  DMT;
+
+      const DMT base{ { 0.0, 1.0, 0.0, 0.0, 0.0 },
+                      { 1.0, 0.0, 0.0, 0.0, 0.0 },
+                      { 0.0, 0.0, 2.0, 0.0, 0.0 },
+                      { 0.0, 0.0, 0.0, 1.0, 1.0 },
+                      { 0.0, 0.0, 0.0, 0.0, 1.0 } };
+      const DMT inv { {  0.0,  1.0,  0.0,  0.0,  0.0 },
+                      {  1.0,  0.0,  0.0,  0.0,  0.0 },
+                      {  0.0,  0.0,  0.5,  0.0,  0.0 },
+                      {  0.0,  0.0,  0.0,  1.0, -1.0 },
+                      {  0.0,  0.0,  0.0,  0.0,  1.0 } };
+
+      const size_t n( 10007UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      invert( A );
+
+      checkSize   ( A, n );
+      checkPadding( A );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const DMT ref( inv / scale( k ) );
+
+         if( A.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched inversion failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << A.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Complex matrices
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch invert (2x2, complex)";
+
+      typedef blaze::MatrixBatch<cdouble,2UL,2UL>   CBT;
+      typedef blaze::StaticMatrix<cdouble,2UL,2UL>  CMT;
+
+      const cdouble i( 0.0, 1.0 );
+
+      const size_t n( CBT::lanes+1UL );
+
+      CBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         if( k % 2UL == 0UL ) A.set( k, CMT{ { i, 0.0 }, { 0.0, 2.0 } } );
+         else                 A.set( k, CMT{ { 1.0, i }, { 0.0, 1.0 } } );
+      }
+
+      invert( A );
+
+      checkSize   ( A, n );
+      checkPadding( A );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const CMT ref( k % 2UL == 0UL ? CMT{ { -i, 0.0 }, { 0.0, 0.5 } }
+                                       : CMT{ { 1.0, -i }, { 0.0, 1.0 } } );
+
+         if( A.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched inversion failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << A.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Singular matrices
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch invert (2x2, singular)";
+
+      typedef blaze::MatrixBatch<double,2UL,2UL>   DBT;
+      typedef blaze::StaticMatrix<double,2UL,2UL>  DMT;
+
+      DBT A( DBT::lanes+1UL );
+
+      for( size_t k=0UL; k<A.size(); ++k ) {
+         A.set( k, DMT{ { 1.0, 0.0 }, { 0.0, 1.0 } } );
+      }
+      A.set( 1UL, DMT{ { 1.0, 2.0 }, { 2.0, 4.0 } } );
+
+      try {
+         invert( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of a singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Test:" ) != std::string::npos )
+            throw;
+      }
+   }
+
+   {
+      test_ = "MatrixBatch invert (5x5, singular)";
+
+      typedef blaze::MatrixBatch<double,5UL,5UL>   DBT;
+      typedef blaze::StaticMatrix<double,5UL,5UL>  DMT;
+
+      DBT A( DBT::lanes+1UL );
+
+      for( size_t k=0UL; k<A.size(); ++k ) {
+         for( size_t i=0UL; i<5UL; ++i ) {
+            A(k,i,i) = 1.0;
+         }
+      }
+      A.set( DBT::lanes, DMT{ { 1.0, 2.0, 0.0, 0.0, 0.0 },
+                              { 0.0, 1.0, 0.0, 0.0, 0.0 },
+                              { 2.0, 4.0, 0.0, 0.0, 0.0 },
+                              { 0.0, 0.0, 0.0, 1.0, 0.0 },
+                              { 0.0, 0.0, 0.0, 0.0, 1.0 } } );
+
+      try {
+         invert( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of a singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Test:" ) != std::string::npos )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched determinant computation of the matrices of a MatrixBatch.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c det() function for matrix batches. It covers the
+// closed-form kernels for matrices up to \f$ 4 \times 4 \f$, the pivoting elimination kernel
+// for larger matrices, complex matrices, singular matrices and batches beyond the SMP batch
+// threshold. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testDet()
+{
+   //=====================================================================================
+   // Real matrices
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch det (1x1)";
+
+      typedef blaze::MatrixBatch<double,1UL,1UL>   DBT;
+      typedef blaze::StaticMatrix<double,1UL,1UL>  DMT;
+
+      const DMT base{ { 4.0 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      const blaze::DynamicVector<double> d( det( A ) );
+
+      checkSize( d, n );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const double ref( 4.0 * std::pow( scale( k ), 1 ) );
+
+         if( !blaze::equal( d[k], ref ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched determinant computation failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result: " << d[k] << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch det (2x2)";
+
+      typedef blaze::MatrixBatch<double,2UL,2UL>   DBT;
+      typedef blaze::StaticMatrix<double,2UL,2UL>  DMT;
+
+      const DMT base{ { 2.0, 1.0 }, { 1.0, 1.0 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      const blaze::DynamicVector<double> d( det( A ) );
+
+      checkSize( d, n );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const double ref( 1.0 * std::pow( scale( k ), 2 ) );
+
+         if( !blaze::equal( d[k], ref ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched determinant computation failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result: " << d[k] << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch det (3x3)";
+
+      typedef blaze::MatrixBatch<double,3UL,3UL>   DBT;
+      typedef blaze::StaticMatrix<double,3UL,3UL>  DMT;
+
+      const DMT base{ { 1.0, 2.0, 0.0 },
+                      { 0.0, 1.0, 0.0 },
+                      { 0.0, 0.0, 2.0 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      const blaze::DynamicVector<double> d( det( A ) );
+
+      checkSize( d, n );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const double ref( 2.0 * std::pow( scale( k ), 3 ) );
+
+         if( !blaze::equal( d[k], ref ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched determinant computation failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result: " << d[k] << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch det (4x4)";
+
+      typedef blaze::MatrixBatch<double,4UL,4UL>   DBT;
+      typedef blaze::StaticMatrix<double,4UL,4UL>  DMT;
+
+      const DMT base{ { 1.0, 1.0, 0.0, 0.0 },
+                      { 0.0, 1.0, 1.0, 0.0 },
+                      { 0.0, 0.0, 1.0, 1.0 },
+                      { 0.0, 0.0, 0.0, 1.0 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      const blaze::DynamicVector<double> d( det( A ) );
+
+      checkSize( d, n );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const double ref( 1.0 * std::pow( scale( k ), 4 ) );
+
+         if( !blaze::equal( d[k], ref ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched determinant computation failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result: " << d[k] << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch det (5x5, pivoting)";
+
+      typedef blaze::MatrixBatch<double,5UL,5UL>   DBT;
+      typedef blaze::StaticMatrix<double,5UL,5UL>  DMT;
+
+      const DMT base{ { 0.0, 1.0, 0.0, 0.0, 0.0 },
+                      { 1.0, 0.0, 0.0, 0.0, 0.0 },
+                      { 0.0, 0.0, 2.0, 0.0, 0.0 },
+                      { 0.0, 0.0, 0.0, 1.0, 1.0 },
+                      { 0.0, 0.0, 0.0, 0.0, 1.0 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      const blaze::DynamicVector<double> d( det( A ) );
+
+      checkSize( d, n );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const double ref( -2.0 * std::pow( scale( k ), 5 ) );
+
+         if( !blaze::equal( d[k], ref ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched determinant computation failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result: " << d[k] << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch det (4x4, large batch)";
+
+      typedef blaze::MatrixBatch<double,4UL,4UL>   DBT;
+      typedef blaze::StaticMatrix<double,4UL,4UL>  DMT;
+
+      const DMT base{ { 1.0, 1.0, 0.0, 0.0 },
+                      { 0.0, 1.0, 1.0, 0.0 },
+                      { 0.0, 0.0, 1.0, 1.0 },
+                      { 0.0, 0.0, 0.0, 1.0 } };
+
+      const size_t n( 10007UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      const blaze::DynamicVector<double> d( det( A ) );
+
+      checkSize( d, n );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const double ref( 1.0 * std::pow( scale( k ), 4 ) );
+
+         if( !blaze::equal( d[k], ref ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched determinant computation failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result: " << d[k] << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch det (5x5, large batch)";
+
+      typedef blaze::MatrixBatch<double,5UL,5UL>   DBT;
+      typedef blaze::StaticMatrix<double,5UL,5UL>  DMT;
+
+      const DMT base{ { 0.0, 1.0, 0.0, 0.0, 0.0 },
+                      { 1.0, 0.0, 0.0, 0.0, 0.0 },
+                      { 0.0, 0.0, 2.0, 0.0, 0.0 },
+                      { 0.0, 0.0, 0.0, 1.0, 1.0 },
+                      { 0.0, 0.0, 0.0, 0.0, 1.0 } };
+
+      const size_t n( 10007UL );
+
+      DBT A( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+      }
+
+      const blaze::DynamicVector<double> d( det( A ) );
+
+      checkSize( d, n );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const double ref( -2.0 * std::pow( scale( k ), 5 ) );
+
+         if( !blaze::equal( d[k], ref ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched determinant computation failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result: " << d[k] << "\n"
+                << "   Expected result: " << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Complex matrices
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch det (2x2, complex)";
+
+      typedef blaze::MatrixBatch<cdouble,2UL,2UL>   CBT;
+      typedef blaze::StaticMatrix<cdouble,2UL,2UL>  CMT;
+
+      const cdouble i( 0.0, 1.0 );
+
+      CBT A( 2UL );
+      A.set( 0UL, CMT{ { i, 0.0 }, { 0.0, 2.0 } } );
+      A.set( 1UL, CMT{ { 1.0, i }, { i, 1.0 } } );
+
+      const blaze::DynamicVector<cdouble> d( det( A ) );
+
+      checkSize( d, 2UL );
+
+      if( !blaze::equal( d[0], cdouble( 0.0, 2.0 ) ) ||
+          !blaze::equal( d[1], cdouble( 2.0, 0.0 ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Batched determinant computation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << d << "\n"
+             << "   Expected result:\n( (0,2) (2,0) )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Singular matrices
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch det (singular)";
+
+      blaze::MatrixBatch<double,2UL,2UL> A( 2UL );
+      A.set( 1UL, blaze::StaticMatrix<double,2UL,2UL>{ { 1.0, 2.0 }, { 2.0, 4.0 } } );
+
+      blaze::MatrixBatch<double,5UL,5UL> B( 1UL );
+      B.set( 0UL, blaze::StaticMatrix<double,5UL,5UL>{ { 1.0, 2.0, 0.0, 0.0, 0.0 },
+                                                        { 0.0, 1.0, 0.0, 0.0, 0.0 },
+                                                        { 2.0, 4.0, 0.0, 0.0, 0.0 },
+                                                        { 0.0, 0.0, 0.0, 1.0, 0.0 },
+                                                        { 0.0, 0.0, 0.0, 0.0, 1.0 } } );
+
+      const blaze::DynamicVector<double> d1( det( A ) );
+      const blaze::DynamicVector<double> d2( det( B ) );
+
+      if( d1[0] != 0.0 || d1[1] != 0.0 || d2[0] != 0.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Batched determinant computation failed\n"
+             << " Details:\n"
+             << "   Result (2x2):\n" << d1 << "\n"
+             << "   Result (5x5):\n" << d2 << "\n"
+             << "   Expected result (2x2):\n( 0 0 )\n"
+             << "   Expected result (5x5):\n( 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched solution of linear systems of equations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c solve() function for matrix batches, including
+// multiple right-hand sides, in-place solutions, singular systems and batches beyond the SMP
+// batch threshold. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSolve()
+{
+   //=====================================================================================
+   // Closed-form solutions
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch solve (2x2, two right-hand sides)";
+
+      typedef blaze::MatrixBatch<double,2UL,2UL>   DBT;
+      typedef blaze::StaticMatrix<double,2UL,2UL>  DMT;
+
+      const DMT base{ { 2.0, 1.0 }, { 1.0, 1.0 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n ), B( n ), X;
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+         B.set( k, scale( k ) * DMT{ { 1.0, 2.0*k+2.0 }, { 0.0, k+2.0 } } );
+      }
+
+      solve( A, X, B );
+
+      checkSize   ( X, n );
+      checkGroups ( X, 2UL );
+      checkPadding( X );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const DMT ref{ { 1.0, double( k ) }, { -1.0, 2.0 } };
+
+         if( X.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched solution failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << X.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "MatrixBatch solve (3x3, in-place)";
+
+      typedef blaze::MatrixBatch<double,3UL,3UL>   DBT;
+      typedef blaze::MatrixBatch<double,3UL,1UL>   DVBT;
+      typedef blaze::StaticMatrix<double,3UL,3UL>  DMT;
+      typedef blaze::StaticMatrix<double,3UL,1UL>  DVT;
+
+      const DMT base{ { 1.0, 2.0, 0.0 },
+                      { 0.0, 1.0, 0.0 },
+                      { 0.0, 0.0, 2.0 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+      DVBT Y( n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+         Y.set( k, scale( k ) * DVT{ { 5.0 }, { 2.0 }, { 6.0 } } );
+      }
+
+      solve( A, Y, Y );
+
+      checkSize   ( Y, n );
+      checkPadding( Y );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const DVT ref{ { 1.0 }, { 2.0 }, { 3.0 } };
+
+         if( Y.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched solution failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << Y.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Pivoting solutions
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch solve (5x5, pivoting)";
+
+      typedef blaze::MatrixBatch<double,5UL,5UL>   DBT;
+      typedef blaze::MatrixBatch<double,5UL,1UL>   DVBT;
+      typedef blaze::StaticMatrix<double,5UL,5UL>  DMT;
+      typedef blaze::StaticMatrix<double,5UL,1UL>  DVT;
+
+      const DMT base{ { 0.0, 1.0, 0.0, 0.0, 0.0 },
+                      { 1.0, 0.0, 0.0, 0.0, 0.0 },
+                      { 0.0, 0.0, 2.0, 0.0, 0.0 },
+                      { 0.0, 0.0, 0.0, 1.0, 1.0 },
+                      { 0.0, 0.0, 0.0, 0.0, 1.0 } };
+
+      const size_t n( DBT::lanes+1UL );
+
+      DBT A( n );
+      DVBT B( n ), X;
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A.set( k, scale( k ) * base );
+         B.set( k, scale( k ) * DVT{ { 2.0 }, { 1.0 }, { 6.0 }, { 9.0 }, { 5.0 } } );
+      }
+
+      solve( A, X, B );
+
+      checkSize   ( X, n );
+      checkPadding( X );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const DVT ref{ { 1.0 }, { 2.0 }, { 3.0 }, { 4.0 }, { 5.0 } };
+
+         if( X.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched solution failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << X.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Invalid systems
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch solve (non-matching batch sizes)";
+
+      blaze::MatrixBatch<double,2UL,2UL> A( 3UL );
+      blaze::MatrixBatch<double,2UL,1UL> B( 4UL ), X;
+
+      try {
+         solve( A, X, B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving with batches of different size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "MatrixBatch solve (singular system)";
+
+      typedef blaze::MatrixBatch<double,3UL,3UL>   DBT;
+      typedef blaze::MatrixBatch<double,3UL,1UL>   DVBT;
+      typedef blaze::StaticMatrix<double,3UL,3UL>  DMT;
+
+      DBT A( DBT::lanes+1UL );
+      DVBT B( DBT::lanes+1UL ), X;
+
+      for( size_t k=0UL; k<A.size(); ++k ) {
+         A.set( k, DMT{ { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } } );
+      }
+      A.set( DBT::lanes, DMT{ { 1.0, 2.0, 3.0 }, { 2.0, 4.0, 6.0 }, { 0.0, 0.0, 1.0 } } );
+
+      try {
+         solve( A, X, B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a singular system succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Test:" ) != std::string::npos )
+            throw;
+      }
+   }
+
+
+   //=====================================================================================
+   // Large batches
+   //=====================================================================================
+
+   {
+      test_ = "MatrixBatch solve (5x5, large batch)";
+
+      typedef blaze::MatrixBatch<double,5UL,5UL>   DBT;
+      typedef blaze::MatrixBatch<double,5UL,1UL>   DVBT;
+      typedef blaze::StaticMatrix<double,5UL,5UL>  DMT;
+      typedef blaze::StaticMatrix<double,5UL,1UL>  DVT;
+
+      const DMT base{ { 0.0, 1.0, 0.0, 0.0, 0.0 },
+                      { 1.0, 0.0, 0.0, 0.0, 0.0 },
+                      { 0.0, 0.0, 2.0, 0.0, 0.0 },
+                      { 0.0, 0.0, 0.0, 1.0, 1.0 },
+                      { 0.0, 0.0, 0.0, 0.0, 1.0 } };
+
+      const size_t n( 10007UL );
+
+      DBT A( n );
+      DVBT B( n ), X;
+
+      for( size_t k=0UL; k<n; ++k ) {
+         const double v( k % 11UL );
+         A.set( k, scale( k ) * base );
+         B.set( k, scale( k ) * DVT{ { 2.0 }, { v }, { 6.0 }, { 9.0 }, { 5.0 } } );
+      }
+
+      solve( A, X, B );
+
+      checkSize   ( X, n );
+      checkGroups ( X, ( n + DVBT::lanes - 1UL ) / DVBT::lanes );
+      checkPadding( X );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         const double v( k % 11UL );
+         const DVT ref{ { v }, { 2.0 }, { 3.0 }, { 4.0 }, { 5.0 } };
+
+         if( X.get( k ) != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched solution failed\n"
+                << " Details:\n"
+                << "   Matrix index: " << k << "\n"
+                << "   Result:\n" << X.get( k ) << "\n"
+                << "   Expected result:\n" << ref << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace matrixbatch
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MatrixBatch class test..." << std::endl;
+
+   try
+   {
+      RUN_MATRIXBATCH_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MatrixBatch class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
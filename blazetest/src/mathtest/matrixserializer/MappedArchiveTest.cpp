@@ -0,0 +1,570 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/matrixserializer/MappedArchiveTest.cpp
+//  \brief Source file for the MappedArchive class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/matrixserializer/MappedArchiveTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace matrixserializer {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the MappedArchive class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+MappedArchiveTest::MappedArchiveTest()
+   : test_()
+   , file_( "mappedarchivetest.blaze" )
+{
+   testDenseVectors();
+   testDenseMatrices();
+   testSparseMatrices();
+   testOperations();
+   testFailures();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destructor for the MappedArchive class test.
+//
+// The destructor removes the temporary archive file.
+*/
+MappedArchiveTest::~MappedArchiveTest()
+{
+   std::remove( file_.c_str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy access to dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void MappedArchiveTest::testDenseVectors()
+{
+   test_ = "Dense vectors";
+
+   blaze::DynamicVector<double,blaze::columnVector> a;
+   blaze::DynamicVector<double,blaze::columnVector> b( 33UL );
+   blaze::DynamicVector<int,blaze::rowVector> c( 7UL );
+   blaze::DynamicVector<blaze::complex<float>,blaze::columnVector> d( 5UL );
+
+   randomize( b );
+   randomize( c );
+   randomize( d );
+
+   {
+      blaze::MappedArchiveWriter writer( file_ );
+      writer << a << b << c << d;
+
+      if( writer.size() != 4UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of written records\n"
+             << " Details:\n"
+             << "   Result: " << writer.size() << "\n"
+             << "   Expected result: 4\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   blaze::MappedArchive archive( file_ );
+
+   if( archive.size() != 4UL || archive.rows( 1UL ) != 33UL || archive.columns( 1UL ) != 1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid archive meta information\n"
+          << " Details:\n"
+          << "   Number of records: " << archive.size() << "\n"
+          << "   Size of the second record: " << archive.rows( 1UL ) << "x" << archive.columns( 1UL ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const auto ma( archive.denseVector<double,blaze::columnVector>( 0UL ) );
+   const auto mb( archive.denseVector<double,blaze::columnVector>( 1UL ) );
+   const auto mc( archive.denseVector<int,blaze::rowVector>( 2UL ) );
+   const auto md( archive.denseVector<blaze::complex<float>,blaze::columnVector>( 3UL ) );
+
+   compareVectors( a, ma );
+   compareVectors( b, mb );
+   compareVectors( c, mc );
+   compareVectors( d, md );
+
+   checkAlignment( mb.data() );
+   checkAlignment( mc.data() );
+   checkAlignment( md.data() );
+
+   const auto mct( archive.denseVector<int,blaze::columnVector>( 2UL ) );
+   compareVectors( trans( c ), mct );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy access to dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void MappedArchiveTest::testDenseMatrices()
+{
+   test_ = "Dense matrices";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 5UL, 7UL );
+   blaze::DynamicMatrix<float,blaze::columnMajor> B( 9UL, 3UL );
+   blaze::DynamicMatrix<blaze::complex<double>,blaze::rowMajor> C( 4UL, 4UL );
+   blaze::DynamicMatrix<int,blaze::columnMajor> D;
+
+   randomize( A );
+   randomize( B );
+   randomize( C );
+
+   {
+      blaze::MappedArchiveWriter writer( file_ );
+      writer << A << B << C << D << trans( A );
+   }
+
+   blaze::MappedArchive archive( file_ );
+
+   const auto mA( archive.denseMatrix<double,blaze::rowMajor>( 0UL ) );
+   const auto mB( archive.denseMatrix<float,blaze::columnMajor>( 1UL ) );
+   const auto mC( archive.denseMatrix<blaze::complex<double>,blaze::rowMajor>( 2UL ) );
+   const auto mD( archive.denseMatrix<int,blaze::columnMajor>( 3UL ) );
+   const auto mT( archive.denseMatrix<double,blaze::columnMajor>( 4UL ) );
+
+   compareMatrices( A, mA );
+   compareMatrices( B, mB );
+   compareMatrices( C, mC );
+   compareMatrices( D, mD );
+   compareMatrices( trans( A ), mT );
+
+   if( mA.spacing() != 8UL || mB.spacing() != 16UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid padding of mapped matrices\n"
+          << " Details:\n"
+          << "   Spacing (double): " << mA.spacing() << " (expected 8)\n"
+          << "   Spacing (float): " << mB.spacing() << " (expected 16)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<mA.rows(); ++i ) {
+      checkAlignment( mA.data( i ) );
+   }
+   for( size_t j=0UL; j<mB.columns(); ++j ) {
+      checkAlignment( mB.data( j ) );
+   }
+   for( size_t i=0UL; i<mC.rows(); ++i ) {
+      checkAlignment( mC.data( i ) );
+   }
+
+   test_ = "Empty dense matrices";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> E( 5UL, 0UL );
+   blaze::DynamicMatrix<double,blaze::rowMajor> F( 0UL, 5UL );
+   blaze::DynamicMatrix<double,blaze::columnMajor> G( 0UL, 5UL );
+   blaze::DynamicMatrix<double,blaze::columnMajor> H( 5UL, 0UL );
+
+   {
+      blaze::MappedArchiveWriter writer( file_ );
+      writer << E << F << G << H;
+   }
+
+   blaze::MappedArchive empty( file_ );
+
+   const auto mE( empty.denseMatrix<double,blaze::rowMajor>( 0UL ) );
+   const auto mF( empty.denseMatrix<double,blaze::rowMajor>( 1UL ) );
+   const auto mG( empty.denseMatrix<double,blaze::columnMajor>( 2UL ) );
+   const auto mH( empty.denseMatrix<double,blaze::columnMajor>( 3UL ) );
+
+   compareMatrices( E, mE );
+   compareMatrices( F, mF );
+   compareMatrices( G, mG );
+   compareMatrices( H, mH );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy access to sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void MappedArchiveTest::testSparseMatrices()
+{
+   test_ = "Sparse matrices";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( 10UL, 8UL );
+   blaze::CompressedMatrix<float,blaze::columnMajor> B( 6UL, 11UL );
+   blaze::CompressedMatrix<blaze::complex<double>,blaze::rowMajor> C( 3UL, 3UL );
+   blaze::CompressedMatrix<int,blaze::rowMajor> D( 4UL, 5UL );
+
+   randomize( A, 23UL );
+   randomize( B, 17UL );
+   randomize( C, 4UL );
+
+   {
+      blaze::MappedArchiveWriter writer( file_ );
+      writer << A << B << C << D << trans( B );
+   }
+
+   blaze::MappedArchive archive( file_ );
+
+   const blaze::CustomCompressedMatrix<double,blaze::rowMajor> mA(
+      archive.sparseMatrix<double,blaze::rowMajor>( 0UL ) );
+   const blaze::CustomCompressedMatrix<float,blaze::columnMajor> mB(
+      archive.sparseMatrix<float,blaze::columnMajor>( 1UL ) );
+   const blaze::CustomCompressedMatrix<blaze::complex<double>,blaze::rowMajor> mC(
+      archive.sparseMatrix<blaze::complex<double>,blaze::rowMajor>( 2UL ) );
+   const blaze::CustomCompressedMatrix<int,blaze::rowMajor> mD(
+      archive.sparseMatrix<int,blaze::rowMajor>( 3UL ) );
+   const blaze::CustomCompressedMatrix<float,blaze::rowMajor> mT(
+      archive.sparseMatrix<float,blaze::rowMajor>( 4UL ) );
+
+   compareMatrices( A, mA );
+   compareMatrices( B, mB );
+   compareMatrices( C, mC );
+   compareMatrices( D, mD );
+   compareMatrices( trans( B ), mT );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+   {
+      if( mA.nonZeros( i ) != A.nonZeros( i ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements in row " << i << "\n"
+             << " Details:\n"
+             << "   Result: " << mA.nonZeros( i ) << "\n"
+             << "   Expected result: " << A.nonZeros( i ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         const auto pos( mA.find( i, j ) );
+         const bool found( pos != mA.end( i ) );
+
+         if( found != ( A.find( i, j ) != A.end( i ) ) || ( found && pos->value() != A(i,j) ) ||
+             mA.at( i, j ) != A(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element lookup failed\n"
+                << " Details:\n"
+                << "   Element: (" << i << "," << j << ")\n"
+                << "   Source:\n" << A << "\n"
+                << "   Mapped:\n" << mA << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         if( mA.lowerBound( i, j ) - mA.begin( i ) != A.lowerBound( i, j ) - A.begin( i ) ||
+             mA.upperBound( i, j ) - mA.begin( i ) != A.upperBound( i, j ) - A.begin( i ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Bound lookup failed\n"
+                << " Details:\n"
+                << "   Element: (" << i << "," << j << ")\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   checkAlignment( &mA.begin( 0UL )->value() );
+   checkAlignment( &mB.begin( 0UL )->value() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of arithmetic operations on mapped vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void MappedArchiveTest::testOperations()
+{
+   test_ = "Operations on mapped data";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 13UL, 21UL );
+   blaze::CompressedMatrix<double,blaze::rowMajor> S( 13UL, 21UL );
+   blaze::CompressedMatrix<double,blaze::columnMajor> T( 21UL, 13UL );
+   blaze::DynamicVector<double,blaze::columnVector> x( 21UL );
+
+   randomize( A );
+   randomize( S, 40UL );
+   randomize( T, 40UL );
+   randomize( x );
+
+   {
+      blaze::MappedArchiveWriter writer( file_ );
+      writer << A << S << T << x;
+      writer.close();
+   }
+
+   blaze::MappedArchive archive( file_ );
+
+   const auto mA( archive.denseMatrix<double,blaze::rowMajor>( 0UL ) );
+   const auto mS( archive.sparseMatrix<double,blaze::rowMajor>( 1UL ) );
+   const auto mT( archive.sparseMatrix<double,blaze::columnMajor>( 2UL ) );
+   const auto mx( archive.denseVector<double,blaze::columnVector>( 3UL ) );
+
+   {
+      const blaze::DynamicVector<double,blaze::columnVector> ref( A*x + S*x );
+      const blaze::DynamicVector<double,blaze::columnVector> res( mA*mx + mS*mx );
+
+      compareVectors( ref, res );
+   }
+
+   {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> ref( A * T );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> res( mA * mT );
+
+      compareMatrices( ref, res );
+   }
+
+   {
+      const blaze::CompressedMatrix<double,blaze::rowMajor> ref( S * T );
+      const blaze::CompressedMatrix<double,blaze::rowMajor> res( mS * mT );
+
+      compareMatrices( ref, res );
+   }
+
+   {
+      const blaze::DynamicMatrix<double,blaze::rowMajor> ref( A + S );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> res( mA + mS );
+
+      compareMatrices( ref, res );
+   }
+
+   {
+      const blaze::CompressedVector<double,blaze::rowVector> ref( row( S, 4UL ) );
+      const blaze::CompressedVector<double,blaze::rowVector> res( row( mS, 4UL ) );
+
+      compareVectors( ref, res );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the MappedArchive class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void MappedArchiveTest::testFailures()
+{
+   test_ = "Mapped archive failures";
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 3UL, 4UL );
+   blaze::CompressedMatrix<double,blaze::rowMajor> S( 3UL, 4UL );
+
+   randomize( A );
+   randomize( S, 5UL );
+
+   {
+      blaze::MappedArchiveWriter writer( file_ );
+      writer << A << S;
+   }
+
+   blaze::MappedArchive archive( file_ );
+
+   try {
+      archive.denseMatrix<float,blaze::rowMajor>( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element type difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   try {
+      archive.denseMatrix<double,blaze::columnMajor>( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Storage order difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   try {
+      archive.sparseMatrix<double,blaze::rowMajor>( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Record type difference succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   try {
+      archive.denseVector<double,blaze::columnVector>( 2UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bounds record access succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& )
+   {}
+
+   try {
+      blaze::MappedArchive missing( "mappedarchivetest.missing" );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a missing file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   const std::string corrupt( "mappedarchivetest.corrupt" );
+
+   {
+      std::ofstream out( corrupt.c_str(), std::ofstream::binary );
+      out << "BLAZEMAX and some more bytes that do not form a valid mapped archive header ...";
+   }
+
+   try {
+      blaze::MappedArchive invalid( corrupt );
+
+      std::remove( corrupt.c_str() );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a corrupt file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      std::remove( corrupt.c_str() );
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+
+   {
+      std::ifstream in( file_.c_str(), std::ifstream::binary );
+      std::ofstream out( corrupt.c_str(), std::ofstream::binary );
+      std::string content( ( std::istreambuf_iterator<char>( in ) ), std::istreambuf_iterator<char>() );
+      out.write( content.data(), static_cast<std::streamsize>( content.size() - 64UL ) );
+   }
+
+   try {
+      blaze::MappedArchive truncated( corrupt );
+
+      std::remove( corrupt.c_str() );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Mapping a truncated file succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::runtime_error& ex ) {
+      std::remove( corrupt.c_str() );
+      if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+   }
+}
+//*************************************************************************************************
+
+} // namespace matrixserializer
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running MappedArchive class test..." << std::endl;
+
+   try
+   {
+      RUN_MAPPEDARCHIVE_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during MappedArchive class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
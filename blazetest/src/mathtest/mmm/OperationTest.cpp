@@ -0,0 +1,183 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/mmm/OperationTest.cpp
+//  \brief Source file for the dense matrix multiplication kernel test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/mmm/OperationTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace mmm {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OperationTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OperationTest::OperationTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+
+   //=====================================================================================
+   // Single precision tests
+   //=====================================================================================
+
+   testMmm<float,rowMajor,rowMajor,rowMajor>();
+   testMmm<float,rowMajor,rowMajor,columnMajor>();
+   testMmm<float,rowMajor,columnMajor,rowMajor>();
+   testMmm<float,rowMajor,columnMajor,columnMajor>();
+   testMmm<float,columnMajor,rowMajor,rowMajor>();
+   testMmm<float,columnMajor,rowMajor,columnMajor>();
+   testMmm<float,columnMajor,columnMajor,rowMajor>();
+   testMmm<float,columnMajor,columnMajor,columnMajor>();
+
+   testLmmm<float,rowMajor,rowMajor,rowMajor>();
+   testLmmm<float,rowMajor,rowMajor,columnMajor>();
+   testLmmm<float,rowMajor,columnMajor,rowMajor>();
+   testLmmm<float,rowMajor,columnMajor,columnMajor>();
+   testLmmm<float,columnMajor,rowMajor,rowMajor>();
+   testLmmm<float,columnMajor,rowMajor,columnMajor>();
+   testLmmm<float,columnMajor,columnMajor,rowMajor>();
+   testLmmm<float,columnMajor,columnMajor,columnMajor>();
+
+   testUmmm<float,rowMajor,rowMajor,rowMajor>();
+   testUmmm<float,rowMajor,rowMajor,columnMajor>();
+   testUmmm<float,rowMajor,columnMajor,rowMajor>();
+   testUmmm<float,rowMajor,columnMajor,columnMajor>();
+   testUmmm<float,columnMajor,rowMajor,rowMajor>();
+   testUmmm<float,columnMajor,rowMajor,columnMajor>();
+   testUmmm<float,columnMajor,columnMajor,rowMajor>();
+   testUmmm<float,columnMajor,columnMajor,columnMajor>();
+
+   testTriangular<float,rowMajor,rowMajor,rowMajor>();
+   testTriangular<float,rowMajor,rowMajor,columnMajor>();
+   testTriangular<float,rowMajor,columnMajor,rowMajor>();
+   testTriangular<float,rowMajor,columnMajor,columnMajor>();
+   testTriangular<float,columnMajor,rowMajor,rowMajor>();
+   testTriangular<float,columnMajor,rowMajor,columnMajor>();
+   testTriangular<float,columnMajor,columnMajor,rowMajor>();
+   testTriangular<float,columnMajor,columnMajor,columnMajor>();
+
+
+   //=====================================================================================
+   // Double precision tests
+   //=====================================================================================
+
+   testMmm<double,rowMajor,rowMajor,rowMajor>();
+   testMmm<double,rowMajor,rowMajor,columnMajor>();
+   testMmm<double,rowMajor,columnMajor,rowMajor>();
+   testMmm<double,rowMajor,columnMajor,columnMajor>();
+   testMmm<double,columnMajor,rowMajor,rowMajor>();
+   testMmm<double,columnMajor,rowMajor,columnMajor>();
+   testMmm<double,columnMajor,columnMajor,rowMajor>();
+   testMmm<double,columnMajor,columnMajor,columnMajor>();
+
+   testLmmm<double,rowMajor,rowMajor,rowMajor>();
+   testLmmm<double,rowMajor,rowMajor,columnMajor>();
+   testLmmm<double,rowMajor,columnMajor,rowMajor>();
+   testLmmm<double,rowMajor,columnMajor,columnMajor>();
+   testLmmm<double,columnMajor,rowMajor,rowMajor>();
+   testLmmm<double,columnMajor,rowMajor,columnMajor>();
+   testLmmm<double,columnMajor,columnMajor,rowMajor>();
+   testLmmm<double,columnMajor,columnMajor,columnMajor>();
+
+   testUmmm<double,rowMajor,rowMajor,rowMajor>();
+   testUmmm<double,rowMajor,rowMajor,columnMajor>();
+   testUmmm<double,rowMajor,columnMajor,rowMajor>();
+   testUmmm<double,rowMajor,columnMajor,columnMajor>();
+   testUmmm<double,columnMajor,rowMajor,rowMajor>();
+   testUmmm<double,columnMajor,rowMajor,columnMajor>();
+   testUmmm<double,columnMajor,columnMajor,rowMajor>();
+   testUmmm<double,columnMajor,columnMajor,columnMajor>();
+
+   testTriangular<double,rowMajor,rowMajor,rowMajor>();
+   testTriangular<double,rowMajor,rowMajor,columnMajor>();
+   testTriangular<double,rowMajor,columnMajor,rowMajor>();
+   testTriangular<double,rowMajor,columnMajor,columnMajor>();
+   testTriangular<double,columnMajor,rowMajor,rowMajor>();
+   testTriangular<double,columnMajor,rowMajor,columnMajor>();
+   testTriangular<double,columnMajor,columnMajor,rowMajor>();
+   testTriangular<double,columnMajor,columnMajor,columnMajor>();
+}
+//*************************************************************************************************
+
+} // namespace mmm
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense matrix multiplication kernel test..." << std::endl;
+
+   try
+   {
+      RUN_MMM_OPERATION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense matrix multiplication kernel test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,2720 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/packedmatrix/ClassTest.cpp
+//  \brief Source file for the PackedMatrix class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/StrictlyLowerMatrix.h>
+#include <blaze/math/StrictlyUpperMatrix.h>
+#include <blaze/math/UniLowerMatrix.h>
+#include <blaze/math/UniUpperMatrix.h>
+#include <blazetest/mathtest/packedmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PackedMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testAddAssign();
+   testSubAssign();
+   testFunctionCall();
+   testAt();
+   testIterator();
+   testNonZeros();
+   testIndex();
+   testReset();
+   testClear();
+   testSwap();
+   testIsDefault();
+   testMult();
+   testSolve();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the PackedMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Row-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix default constructor";
+
+      SMT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkCapacity( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Row-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix size constructor (0x0)";
+
+      LMT mat( 0UL );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkCapacity( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major PackedMatrix size constructor (3x3)";
+
+      LMT mat( 3UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major PackedMatrix size constructor (unilower 3x3)";
+
+      blaze::PackedMatrix< blaze::UniLowerMatrix<RMT> > mat( 3UL );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 0 || mat(1,1) != 1 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 1 0 )\n( 0 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix conversion constructor (symmetric matrix)";
+
+      const blaze::SymmetricMatrix<RMT> sym{ { 1, 2, 4 },
+                                             { 2, 3, 0 },
+                                             { 4, 0, 6 } };
+
+      SMT mat( sym );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 7UL );
+      checkNonZeros( mat, 0UL, 3UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 2 || mat(0,2) != 4 ||
+          mat(1,0) != 2 || mat(1,1) != 3 || mat(1,2) != 0 ||
+          mat(2,0) != 4 || mat(2,1) != 0 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 4 )\n( 2 3 0 )\n( 4 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix conversion constructor (general lower matrix)";
+
+      const RMT lower{ { 1, 0, 0 },
+                       { 2, 3, 0 },
+                       { 0, 5, 6 } };
+
+      LMT mat( lower );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 2 || mat(1,1) != 3 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 5 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 2 3 0 )\n( 0 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix conversion constructor (strictly lower matrix)";
+
+      const RMT lower{ { 0, 0, 0 },
+                       { 1, 0, 0 },
+                       { 2, 3, 0 } };
+
+      blaze::PackedMatrix< blaze::StrictlyLowerMatrix<RMT> > mat( lower );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 1 || mat(1,1) != 0 || mat(1,2) != 0 ||
+          mat(2,0) != 2 || mat(2,1) != 3 || mat(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 1 0 0 )\n( 2 3 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix conversion constructor (non-square matrix)";
+
+      try {
+         SMT mat( RMT( 2UL, 3UL, 0 ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of non-square PackedMatrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major PackedMatrix conversion constructor (non-symmetric matrix)";
+
+      const RMT A{ { 1, 2 },
+                   { 3, 4 } };
+
+      try {
+         SMT mat( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of symmetric PackedMatrix with non-symmetric matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major PackedMatrix conversion constructor (non-lower matrix)";
+
+      const RMT A{ { 1, 2 },
+                   { 0, 3 } };
+
+      try {
+         LMT mat( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of lower PackedMatrix with non-lower matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major PackedMatrix conversion constructor (non-unilower matrix)";
+
+      const blaze::LowerMatrix<RMT> A{ { 1, 0 },
+                                       { 2, 3 } };
+
+      try {
+         blaze::PackedMatrix< blaze::UniLowerMatrix<RMT> > mat( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of unilower PackedMatrix with non-unilower matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major PackedMatrix conversion constructor (non-strictly lower matrix)";
+
+      const RMT A{ { 0, 0 },
+                   { 2, 1 } };
+
+      try {
+         blaze::PackedMatrix< blaze::StrictlyLowerMatrix<RMT> > mat( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of strictly lower PackedMatrix with invalid matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Row-major PackedMatrix conversion constructor (non-Hermitian matrix)";
+
+      const CRMT A{ { cplx( 1, 1 ), cplx( 2, 1 ) },
+                    { cplx( 2,-1 ), cplx( 3, 0 ) } };
+
+      try {
+         HMT mat( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of Hermitian PackedMatrix with non-real diagonal succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Row-major copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix copy constructor";
+
+      const LMT mat1( RMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 5, 6 } } );
+      const LMT mat2( mat1 );
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkCapacity( mat2, 6UL );
+      checkNonZeros( mat2, 5UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 0 || mat2(0,2) != 0 ||
+          mat2(1,0) != 2 || mat2(1,1) != 3 || mat2(1,2) != 0 ||
+          mat2(2,0) != 0 || mat2(2,1) != 5 || mat2(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 2 3 0 )\n( 0 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major default constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix default constructor";
+
+      OSMT mat;
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkCapacity( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major size constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix size constructor (uniupper 4x4)";
+
+      blaze::PackedMatrix< blaze::UniUpperMatrix<CMT> > mat( 4UL );
+
+      checkRows    ( mat,  4UL );
+      checkColumns ( mat,  4UL );
+      checkCapacity( mat, 10UL );
+      checkNonZeros( mat,  4UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkNonZeros( mat, 3UL, 1UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 1 || mat(2,2) != 1 || mat(3,3) != 1 ||
+          mat(0,3) != 0 || mat(3,0) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 0 )\n( 0 1 0 0 )\n( 0 0 1 0 )\n( 0 0 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix conversion constructor (upper matrix)";
+
+      const blaze::UpperMatrix<CMT> upper{ { 1, 2, 0 },
+                                           { 0, 3, 5 },
+                                           { 0, 0, 6 } };
+
+      OUMT mat( upper );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 2 || mat(0,2) != 0 ||
+          mat(1,0) != 0 || mat(1,1) != 3 || mat(1,2) != 5 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 0 3 5 )\n( 0 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix conversion constructor (Hermitian matrix)";
+
+      const CCMT A{ { cplx( 1, 0 ), cplx( 2, 1 ) },
+                    { cplx( 2,-1 ), cplx( 3, 0 ) } };
+
+      OHMT mat( A );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat(0,0) != cplx( 1, 0 ) || mat(0,1) != cplx( 2, 1 ) ||
+          mat(1,0) != cplx( 2,-1 ) || mat(1,1) != cplx( 3, 0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( (1,0) (2,1) )\n( (2,-1) (3,0) )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix conversion constructor (non-upper matrix)";
+
+      const CMT A{ { 1, 0 },
+                   { 2, 3 } };
+
+      try {
+         OUMT mat( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of upper PackedMatrix with non-upper matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Column-major PackedMatrix conversion constructor (non-Hermitian matrix)";
+
+      const CCMT A{ { cplx( 1, 0 ), cplx( 2, 1 ) },
+                    { cplx( 2, 1 ), cplx( 3, 0 ) } };
+
+      try {
+         OHMT mat( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of Hermitian PackedMatrix with non-Hermitian matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the PackedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Row-major copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix copy assignment";
+
+      const LMT mat1( RMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 5, 6 } } );
+      LMT mat2( 2UL );
+      mat2 = mat1;
+
+      checkRows    ( mat2, 3UL );
+      checkColumns ( mat2, 3UL );
+      checkCapacity( mat2, 6UL );
+      checkNonZeros( mat2, 5UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 0 || mat2(0,2) != 0 ||
+          mat2(1,0) != 2 || mat2(1,1) != 3 || mat2(1,2) != 0 ||
+          mat2(2,0) != 0 || mat2(2,1) != 5 || mat2(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 2 3 0 )\n( 0 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Row-major dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix assignment";
+
+      SMT mat( 2UL );
+      mat = blaze::SymmetricMatrix<CMT>{ { 1, 2, 4 },
+                                         { 2, 3, 0 },
+                                         { 4, 0, 6 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 7UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 2 || mat(0,2) != 4 ||
+          mat(1,0) != 2 || mat(1,1) != 3 || mat(1,2) != 0 ||
+          mat(2,0) != 4 || mat(2,1) != 0 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 4 )\n( 2 3 0 )\n( 4 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix assignment (non-lower matrix)";
+
+      LMT mat( RMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 5, 6 } } );
+
+      try {
+         mat = RMT{ { 1, 0, 7 },
+                    { 2, 3, 0 },
+                    { 0, 5, 6 } };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-lower matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 2 || mat(1,1) != 3 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 5 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed assignment changed the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 2 3 0 )\n( 0 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix dense matrix assignment";
+
+      OHMT mat;
+      mat = blaze::HermitianMatrix<CRMT>{ { cplx( 1, 0 ), cplx( 2, 1 ), cplx( 0, 0 ) },
+                                          { cplx( 2,-1 ), cplx( 3, 0 ), cplx( 0,-4 ) },
+                                          { cplx( 0, 0 ), cplx( 0, 4 ), cplx( 5, 0 ) } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 7UL );
+
+      if( mat(0,0) != cplx( 1, 0 ) || mat(0,1) != cplx( 2, 1 ) || mat(0,2) != cplx( 0, 0 ) ||
+          mat(1,0) != cplx( 2,-1 ) || mat(1,1) != cplx( 3, 0 ) || mat(1,2) != cplx( 0,-4 ) ||
+          mat(2,0) != cplx( 0, 0 ) || mat(2,1) != cplx( 0, 4 ) || mat(2,2) != cplx( 5, 0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( (1,0) (2,1) (0,0) )\n( (2,-1) (3,0) (0,-4) )\n"
+                                     "( (0,0) (0,4) (5,0) )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix dense matrix assignment (non-uniupper matrix)";
+
+      blaze::PackedMatrix< blaze::UniUpperMatrix<CMT> > mat( 2UL );
+
+      try {
+         mat = blaze::UpperMatrix<CMT>{ { 1, 2 },
+                                        { 0, 2 } };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment of non-uniupper matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(1,0) != 0 || mat(1,1) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed assignment changed the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 )\n( 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix addition assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the addition assignment operators of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAddAssign()
+{
+   //=====================================================================================
+   // Row-major dense matrix addition assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix addition assignment";
+
+      SMT mat( blaze::SymmetricMatrix<RMT>{ { 1, 2, 4 }, { 2, 3, 0 }, { 4, 0, 6 } } );
+
+      mat += blaze::SymmetricMatrix<RMT>{ { 1, 0, 1 },
+                                          { 0, 2, 0 },
+                                          { 1, 0, 3 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 7UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 2 || mat(0,2) != 5 ||
+          mat(1,0) != 2 || mat(1,1) != 5 || mat(1,2) != 0 ||
+          mat(2,0) != 5 || mat(2,1) != 0 || mat(2,2) != 9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 2 5 )\n( 2 5 0 )\n( 5 0 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix packed matrix addition assignment";
+
+      SMT mat( blaze::SymmetricMatrix<RMT>{ { 1, 2, 4 }, { 2, 3, 0 }, { 4, 0, 6 } } );
+
+      mat += SMT( blaze::SymmetricMatrix<RMT>{ { 1, 0, 1 }, { 0, 2, 0 }, { 1, 0, 3 } } );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 7UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 2 || mat(0,2) != 5 ||
+          mat(1,0) != 2 || mat(1,1) != 5 || mat(1,2) != 0 ||
+          mat(2,0) != 5 || mat(2,1) != 0 || mat(2,2) != 9 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 2 5 )\n( 2 5 0 )\n( 5 0 9 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix addition assignment (unilower matrix)";
+
+      blaze::PackedMatrix< blaze::UniLowerMatrix<RMT> > mat( 3UL );
+
+      mat += RMT{ { 0, 0, 0 },
+                  { 2, 0, 0 },
+                  { 0, 3, 0 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 2 || mat(1,1) != 1 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 3 || mat(2,2) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 2 1 0 )\n( 0 3 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat += blaze::UniLowerMatrix<RMT>( 3UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment to the diagonal of a unilower matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,0) != 1 || mat(1,1) != 1 || mat(2,2) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed addition assignment changed the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 2 1 0 )\n( 0 3 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix addition assignment (non-lower matrix)";
+
+      LMT mat( RMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 5, 6 } } );
+
+      try {
+         mat += RMT{ { 0, 1, 0 },
+                     { 0, 0, 0 },
+                     { 0, 0, 0 } };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of non-lower matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,0) != 1 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 2 || mat(1,1) != 3 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 5 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed addition assignment changed the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 2 3 0 )\n( 0 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix addition assignment (size mismatch)";
+
+      LMT mat( 3UL );
+
+      try {
+         mat += RMT( 4UL, 4UL, 0 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of matrix with invalid size succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major dense matrix addition assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix dense matrix addition assignment";
+
+      OUMT mat( CMT{ { 1, 2, 0 }, { 0, 3, 5 }, { 0, 0, 6 } } );
+
+      mat += RMT{ { 1, 0, 4 },
+                  { 0,-3, 0 },
+                  { 0, 0, 1 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 3UL );
+
+      if( mat(0,0) != 2 || mat(0,1) != 2 || mat(0,2) != 4 ||
+          mat(1,0) != 0 || mat(1,1) != 0 || mat(1,2) != 5 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 2 2 4 )\n( 0 0 5 )\n( 0 0 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix dense matrix addition assignment (non-Hermitian matrix)";
+
+      OHMT mat( 2UL );
+
+      try {
+         mat += CCMT{ { cplx( 0, 1 ), cplx( 0, 0 ) },
+                      { cplx( 0, 0 ), cplx( 0, 0 ) } };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment of non-Hermitian matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix subtraction assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the subtraction assignment operators of the PackedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSubAssign()
+{
+   //=====================================================================================
+   // Row-major dense matrix subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix subtraction assignment";
+
+      SMT mat( blaze::SymmetricMatrix<RMT>{ { 1, 2, 4 }, { 2, 3, 0 }, { 4, 0, 6 } } );
+
+      mat -= blaze::SymmetricMatrix<RMT>{ { 1, 0, 1 },
+                                          { 0, 2, 0 },
+                                          { 1, 0, 3 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 6UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 2 || mat(0,2) != 3 ||
+          mat(1,0) != 2 || mat(1,1) != 1 || mat(1,2) != 0 ||
+          mat(2,0) != 3 || mat(2,1) != 0 || mat(2,2) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 2 3 )\n( 2 1 0 )\n( 3 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix packed matrix subtraction assignment";
+
+      LMT mat( RMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 5, 6 } } );
+
+      mat -= LMT( RMT{ { 1, 0, 0 }, { 1, 1, 0 }, { 1, 1, 1 } } );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,0) !=  0 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) !=  1 || mat(1,1) != 2 || mat(1,2) != 0 ||
+          mat(2,0) != -1 || mat(2,1) != 4 || mat(2,2) != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 1 2 0 )\n( -1 4 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix dense matrix subtraction assignment (non-symmetric matrix)";
+
+      SMT mat( blaze::SymmetricMatrix<RMT>{ { 1, 2 }, { 2, 3 } } );
+
+      try {
+         mat -= RMT{ { 0, 1 },
+                     { 0, 0 } };
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment of non-symmetric matrix succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( mat(0,0) != 1 || mat(0,1) != 2 || mat(1,0) != 2 || mat(1,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed subtraction assignment changed the matrix\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 )\n( 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major dense matrix subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix dense matrix subtraction assignment";
+
+      OLMT mat( CMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 5, 6 } } );
+
+      mat -= blaze::StrictlyLowerMatrix<RMT>{ { 0, 0, 0 },
+                                              { 2, 0, 0 },
+                                              { 1, 0, 0 } };
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 2UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      if( mat(0,0) !=  1 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) !=  0 || mat(1,1) != 3 || mat(1,2) != 0 ||
+          mat(2,0) != -1 || mat(2,1) != 5 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 3 0 )\n( -1 5 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator of the
+// PackedMatrix class template. Elements of the triangle that is not stored have to be returned
+// as the mirrored (symmetric), conjugated mirrored (Hermitian), or zero (triangular) element.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix::operator() (symmetric matrix)";
+
+      SMT mat( 3UL );
+      mat.data()[mat.index(1,0)] = 2;
+      mat.data()[mat.index(2,0)] = 4;
+      mat.data()[mat.index(2,2)] = 6;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 2 || mat(0,2) != 4 ||
+          mat(1,0) != 2 || mat(1,1) != 0 || mat(1,2) != 0 ||
+          mat(2,0) != 4 || mat(2,1) != 0 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 2 4 )\n( 2 0 0 )\n( 4 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix::operator() (Hermitian matrix)";
+
+      HMT mat( 2UL );
+      mat.data()[mat.index(0,0)] = cplx( 1, 0 );
+      mat.data()[mat.index(1,0)] = cplx( 2,-1 );
+      mat.data()[mat.index(1,1)] = cplx( 3, 0 );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat(0,0) != cplx( 1, 0 ) || mat(0,1) != cplx( 2, 1 ) ||
+          mat(1,0) != cplx( 2,-1 ) || mat(1,1) != cplx( 3, 0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( (1,0) (2,1) )\n( (2,-1) (3,0) )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix::operator() (upper matrix)";
+
+      UMT mat( 3UL );
+      mat.data()[mat.index(0,2)] = 4;
+      mat.data()[mat.index(1,1)] = 3;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 0 || mat(0,2) != 4 ||
+          mat(1,0) != 0 || mat(1,1) != 3 || mat(1,2) != 0 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 4 )\n( 0 3 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix::operator() (symmetric matrix)";
+
+      OSMT mat( 3UL );
+      mat.data()[mat.index(0,1)] = 2;
+      mat.data()[mat.index(0,2)] = 4;
+      mat.data()[mat.index(2,2)] = 6;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 5UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 2 || mat(0,2) != 4 ||
+          mat(1,0) != 2 || mat(1,1) != 0 || mat(1,2) != 0 ||
+          mat(2,0) != 4 || mat(2,1) != 0 || mat(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 2 4 )\n( 2 0 0 )\n( 4 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix::operator() (Hermitian matrix)";
+
+      OHMT mat( 2UL );
+      mat.data()[mat.index(0,0)] = cplx( 1, 0 );
+      mat.data()[mat.index(0,1)] = cplx( 2, 1 );
+      mat.data()[mat.index(1,1)] = cplx( 3, 0 );
+
+      checkRows    ( mat, 2UL );
+      checkColumns ( mat, 2UL );
+      checkCapacity( mat, 3UL );
+      checkNonZeros( mat, 4UL );
+
+      if( mat(0,0) != cplx( 1, 0 ) || mat(0,1) != cplx( 2, 1 ) ||
+          mat(1,0) != cplx( 2,-1 ) || mat(1,1) != cplx( 3, 0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( (1,0) (2,1) )\n( (2,-1) (3,0) )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix::operator() (lower matrix)";
+
+      OLMT mat( 3UL );
+      mat.data()[mat.index(2,0)] = 4;
+      mat.data()[mat.index(1,1)] = 3;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 2UL );
+
+      if( mat(0,0) != 0 || mat(0,1) != 0 || mat(0,2) != 0 ||
+          mat(1,0) != 0 || mat(1,1) != 3 || mat(1,2) != 0 ||
+          mat(2,0) != 4 || mat(2,1) != 0 || mat(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Function call operator failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 3 0 )\n( 4 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the \c at() member function of the
+// PackedMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testAt()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix::at()";
+
+      const SMT mat( blaze::SymmetricMatrix<RMT>{ { 1, 2, 4 }, { 2, 3, 0 }, { 4, 0, 6 } } );
+
+      if( mat.at(0,2) != 4 || mat.at(2,0) != 4 || mat.at(1,1) != 3 || mat.at(2,1) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via at() function failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 4 )\n( 2 3 0 )\n( 4 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat.at(3,0);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound row access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+
+      try {
+         mat.at(0,3);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound column access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix::at()";
+
+      const OUMT mat( CMT{ { 1, 2, 0 }, { 0, 3, 5 }, { 0, 0, 6 } } );
+
+      if( mat.at(0,1) != 2 || mat.at(1,0) != 0 || mat.at(1,2) != 5 || mat.at(2,2) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Access via at() function failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 2 0 )\n( 0 3 5 )\n( 0 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      try {
+         mat.at(2,3);
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Out-of-bound column access succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::out_of_range& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the PackedMatrix class
+// template. The iterators traverse all elements of a row (or column), including the elements
+// of the triangle that is not stored. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      const SMT mat( blaze::SymmetricMatrix<RMT>{ { 1, 2, 4 }, { 2, 3, 0 }, { 4, 0, 6 } } );
+
+      // Counting the number of elements in row 0 via ConstIterator (end-begin)
+      {
+         test_ = "Row-major ConstIterator subtraction (end-begin)";
+
+         const ptrdiff_t number( mat.cend(0) - mat.cbegin(0) );
+
+         if( number != 3L ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of elements detected\n"
+                << " Details:\n"
+                << "   Number of elements         : " << number << "\n"
+                << "   Expected number of elements: 3\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Traversing row 0 including the mirrored elements
+      {
+         test_ = "Row-major ConstIterator traversal";
+
+         SMT::ConstIterator it( mat.cbegin(0) );
+
+         if( *it != 1 || *(++it) != 2 || *(it++) != 2 || *it != 4 || ++it != mat.cend(0) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator traversal failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected row 0: ( 1 2 4 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Traversing row 2 backwards
+      {
+         test_ = "Row-major ConstIterator decrement";
+
+         SMT::ConstIterator it( mat.cend(2) );
+
+         if( *(--it) != 6 || *(it--) != 6 || *it != 0 || *(--it) != 4 || it != mat.cbegin(2) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Iterator decrement failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected row 2: ( 4 0 6 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major ConstIterator traversal (lower matrix)";
+
+      const LMT mat( RMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 5, 6 } } );
+
+      const int expected[] = { 2, 3, 0 };
+      size_t j( 0UL );
+
+      for( LMT::ConstIterator it=mat.begin(1); it!=mat.end(1); ++it, ++j ) {
+         if( *it != expected[j] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element detected\n"
+                << " Details:\n"
+                << "   Index         : " << j << "\n"
+                << "   Value         : " << *it << "\n"
+                << "   Expected value: " << expected[j] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( j != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << j << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major ConstIterator traversal (upper matrix)";
+
+      const OUMT mat( CMT{ { 1, 2, 0 }, { 0, 3, 5 }, { 0, 0, 6 } } );
+
+      const int expected[] = { 0, 5, 6 };
+      size_t i( 0UL );
+
+      for( OUMT::ConstIterator it=mat.cbegin(2); it!=mat.cend(2); ++it, ++i ) {
+         if( *it != expected[i] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid element detected\n"
+                << " Details:\n"
+                << "   Index         : " << i << "\n"
+                << "   Value         : " << *it << "\n"
+                << "   Expected value: " << expected[i] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( i != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of elements detected\n"
+             << " Details:\n"
+             << "   Number of elements         : " << i << "\n"
+             << "   Expected number of elements: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member function of the PackedMatrix class
+// template. The mirrored off-diagonal elements of symmetric and Hermitian matrices have to be
+// counted twice. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix::nonZeros()";
+
+      SMT mat( 3UL );
+
+      checkNonZeros( mat, 0UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+
+      mat.data()[mat.index(1,0)] = 5;
+
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 0UL );
+
+      mat.data()[mat.index(2,2)] = 7;
+
+      checkNonZeros( mat, 3UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+
+      mat.data()[mat.index(1,0)] = 0;
+
+      checkNonZeros( mat, 1UL );
+      checkNonZeros( mat, 0UL, 0UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 1UL );
+   }
+
+   {
+      test_ = "Row-major PackedMatrix::nonZeros() (strictly upper matrix)";
+
+      const blaze::PackedMatrix< blaze::StrictlyUpperMatrix<RMT> >
+         mat( RMT{ { 0, 1, 2 }, { 0, 0, 0 }, { 0, 0, 0 } } );
+
+      checkNonZeros( mat, 2UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 0UL );
+      checkNonZeros( mat, 2UL, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix::nonZeros()";
+
+      const OHMT mat( CCMT{ { cplx( 1, 0 ), cplx( 0, 1 ), cplx( 0, 0 ) },
+                            { cplx( 0,-1 ), cplx( 0, 0 ), cplx( 0, 0 ) },
+                            { cplx( 0, 0 ), cplx( 0, 0 ), cplx( 2, 0 ) } } );
+
+      checkNonZeros( mat, 4UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the packed storage layout of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the offsets of the stored elements within the packed storage of the
+// PackedMatrix class template. The stored triangle has to be stored line by line in the packed
+// format of LAPACK without any padding. The offsets returned by the \c index() function are
+// compared to the expected offsets and the packed elements are written via the \c data()
+// function and compared to the expected matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndex()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix::index() (lower matrix)";
+
+      LMT mat( 4UL );
+
+      checkCapacity( mat, 10UL );
+
+      const size_t expected[] = { 0UL, 1UL, 2UL, 3UL, 4UL, 5UL, 6UL, 7UL, 8UL, 9UL };
+      size_t k( 0UL );
+
+      for( size_t i=0UL; i<4UL; ++i ) {
+         for( size_t j=0UL; j<=i; ++j, ++k ) {
+            if( mat.index(i,j) != expected[k] ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid packed offset detected\n"
+                   << " Details:\n"
+                   << "   Element        : (" << i << "," << j << ")\n"
+                   << "   Offset         : " << mat.index(i,j) << "\n"
+                   << "   Expected offset: " << expected[k] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+            mat.data()[mat.index(i,j)] = int( expected[k] + 1UL );
+         }
+      }
+
+      const RMT ref{ { 1, 0, 0,  0 },
+                     { 2, 3, 0,  0 },
+                     { 4, 5, 6,  0 },
+                     { 7, 8, 9, 10 } };
+
+      checkNonZeros( mat, 10UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid packed layout detected\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix::index() (upper matrix)";
+
+      UMT mat( 4UL );
+
+      checkCapacity( mat, 10UL );
+
+      const size_t expected[] = { 0UL, 1UL, 2UL, 3UL, 4UL, 5UL, 6UL, 7UL, 8UL, 9UL };
+      size_t k( 0UL );
+
+      for( size_t i=0UL; i<4UL; ++i ) {
+         for( size_t j=i; j<4UL; ++j, ++k ) {
+            if( mat.index(i,j) != expected[k] ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid packed offset detected\n"
+                   << " Details:\n"
+                   << "   Element        : (" << i << "," << j << ")\n"
+                   << "   Offset         : " << mat.index(i,j) << "\n"
+                   << "   Expected offset: " << expected[k] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+            mat.data()[mat.index(i,j)] = int( expected[k] + 1UL );
+         }
+      }
+
+      const RMT ref{ { 1, 2, 3,  4 },
+                     { 0, 5, 6,  7 },
+                     { 0, 0, 8,  9 },
+                     { 0, 0, 0, 10 } };
+
+      checkNonZeros( mat, 10UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid packed layout detected\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix::index() (symmetric matrix)";
+
+      SMT mat( 4UL );
+
+      checkCapacity( mat, 10UL );
+
+      const size_t expected[] = { 0UL, 1UL, 2UL, 3UL, 4UL, 5UL, 6UL, 7UL, 8UL, 9UL };
+      size_t k( 0UL );
+
+      for( size_t i=0UL; i<4UL; ++i ) {
+         for( size_t j=0UL; j<=i; ++j, ++k ) {
+            if( mat.index(i,j) != expected[k] ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid packed offset detected\n"
+                   << " Details:\n"
+                   << "   Element        : (" << i << "," << j << ")\n"
+                   << "   Offset         : " << mat.index(i,j) << "\n"
+                   << "   Expected offset: " << expected[k] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+            mat.data()[mat.index(i,j)] = int( expected[k] + 1UL );
+         }
+      }
+
+      const RMT ref{ { 1, 2, 4,  7 },
+                     { 2, 3, 5,  8 },
+                     { 4, 5, 6,  9 },
+                     { 7, 8, 9, 10 } };
+
+      checkNonZeros( mat, 16UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid packed layout detected\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix::index() (lower matrix)";
+
+      OLMT mat( 4UL );
+
+      checkCapacity( mat, 10UL );
+
+      const size_t expected[] = { 0UL, 1UL, 4UL, 2UL, 5UL, 7UL, 3UL, 6UL, 8UL, 9UL };
+      size_t k( 0UL );
+
+      for( size_t i=0UL; i<4UL; ++i ) {
+         for( size_t j=0UL; j<=i; ++j, ++k ) {
+            if( mat.index(i,j) != expected[k] ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid packed offset detected\n"
+                   << " Details:\n"
+                   << "   Element        : (" << i << "," << j << ")\n"
+                   << "   Offset         : " << mat.index(i,j) << "\n"
+                   << "   Expected offset: " << expected[k] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+            mat.data()[mat.index(i,j)] = int( expected[k] + 1UL );
+         }
+      }
+
+      const CMT ref{ { 1, 0, 0,  0 },
+                     { 2, 5, 0,  0 },
+                     { 3, 6, 8,  0 },
+                     { 4, 7, 9, 10 } };
+
+      checkNonZeros( mat, 10UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid packed layout detected\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix::index() (upper matrix)";
+
+      OUMT mat( 4UL );
+
+      checkCapacity( mat, 10UL );
+
+      const size_t expected[] = { 0UL, 1UL, 3UL, 6UL, 2UL, 4UL, 7UL, 5UL, 8UL, 9UL };
+      size_t k( 0UL );
+
+      for( size_t i=0UL; i<4UL; ++i ) {
+         for( size_t j=i; j<4UL; ++j, ++k ) {
+            if( mat.index(i,j) != expected[k] ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid packed offset detected\n"
+                   << " Details:\n"
+                   << "   Element        : (" << i << "," << j << ")\n"
+                   << "   Offset         : " << mat.index(i,j) << "\n"
+                   << "   Expected offset: " << expected[k] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+            mat.data()[mat.index(i,j)] = int( expected[k] + 1UL );
+         }
+      }
+
+      const CMT ref{ { 1, 2, 4,  7 },
+                     { 0, 3, 5,  8 },
+                     { 0, 0, 6,  9 },
+                     { 0, 0, 0, 10 } };
+
+      checkNonZeros( mat, 10UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid packed layout detected\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix::index() (symmetric matrix)";
+
+      OSMT mat( 4UL );
+
+      checkCapacity( mat, 10UL );
+
+      const size_t expected[] = { 0UL, 1UL, 3UL, 6UL, 2UL, 4UL, 7UL, 5UL, 8UL, 9UL };
+      size_t k( 0UL );
+
+      for( size_t i=0UL; i<4UL; ++i ) {
+         for( size_t j=i; j<4UL; ++j, ++k ) {
+            if( mat.index(i,j) != expected[k] ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid packed offset detected\n"
+                   << " Details:\n"
+                   << "   Element        : (" << i << "," << j << ")\n"
+                   << "   Offset         : " << mat.index(i,j) << "\n"
+                   << "   Expected offset: " << expected[k] << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+            mat.data()[mat.index(i,j)] = int( expected[k] + 1UL );
+         }
+      }
+
+      const CMT ref{ { 1, 2, 4,  7 },
+                     { 2, 3, 5,  8 },
+                     { 4, 5, 6,  9 },
+                     { 7, 8, 9, 10 } };
+
+      checkNonZeros( mat, 16UL );
+
+      if( mat != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid packed layout detected\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix::reset()";
+
+      SMT mat( blaze::SymmetricMatrix<RMT>{ { 1, 2, 4 }, { 2, 3, 0 }, { 4, 0, 6 } } );
+
+      reset( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Row-major PackedMatrix::reset() (unilower matrix)";
+
+      blaze::PackedMatrix< blaze::UniLowerMatrix<RMT> >
+         mat( RMT{ { 1, 0, 0 }, { 2, 1, 0 }, { 3, 4, 1 } } );
+
+      reset( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 3UL );
+
+      if( mat(0,0) != 1 || mat(1,0) != 0 || mat(1,1) != 1 ||
+          mat(2,0) != 0 || mat(2,1) != 0 || mat(2,2) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Reset operation failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 1 0 0 )\n( 0 1 0 )\n( 0 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix::reset()";
+
+      OUMT mat( CMT{ { 1, 2, 0 }, { 0, 3, 5 }, { 0, 0, 6 } } );
+
+      reset( mat );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 3UL );
+      checkCapacity( mat, 6UL );
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   {
+      test_ = "Row-major PackedMatrix::clear()";
+
+      SMT mat( blaze::SymmetricMatrix<RMT>{ { 1, 2 }, { 2, 3 } } );
+
+      clear( mat );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkCapacity( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+
+   {
+      test_ = "Column-major PackedMatrix::clear()";
+
+      blaze::PackedMatrix< blaze::UniUpperMatrix<CMT> > mat( 3UL );
+
+      clear( mat );
+
+      checkRows    ( mat, 0UL );
+      checkColumns ( mat, 0UL );
+      checkCapacity( mat, 0UL );
+      checkNonZeros( mat, 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the PackedMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   {
+      test_ = "Row-major PackedMatrix swap";
+
+      SMT mat1( blaze::SymmetricMatrix<RMT>{ { 1, 2 }, { 2, 3 } } );
+      SMT mat2( blaze::SymmetricMatrix<RMT>{ { 4, 0, 5 }, { 0, 6, 0 }, { 5, 0, 7 } } );
+
+      swap( mat1, mat2 );
+
+      checkRows    ( mat1, 3UL );
+      checkColumns ( mat1, 3UL );
+      checkCapacity( mat1, 6UL );
+      checkNonZeros( mat1, 5UL );
+
+      if( mat1(0,0) != 4 || mat1(0,1) != 0 || mat1(0,2) != 5 ||
+          mat1(1,0) != 0 || mat1(1,1) != 6 || mat1(1,2) != 0 ||
+          mat1(2,0) != 5 || mat1(2,1) != 0 || mat1(2,2) != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the first matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n( 4 0 5 )\n( 0 6 0 )\n( 5 0 7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkRows    ( mat2, 2UL );
+      checkColumns ( mat2, 2UL );
+      checkCapacity( mat2, 3UL );
+      checkNonZeros( mat2, 4UL );
+
+      if( mat2(0,0) != 1 || mat2(0,1) != 2 || mat2(1,0) != 2 || mat2(1,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the second matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat2 << "\n"
+             << "   Expected result:\n( 1 2 )\n( 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix swap";
+
+      OLMT mat1( 2UL );
+      OLMT mat2( CMT{ { 1, 0 }, { 2, 3 } } );
+
+      swap( mat1, mat2 );
+
+      checkRows    ( mat1, 2UL );
+      checkColumns ( mat1, 2UL );
+      checkCapacity( mat1, 3UL );
+      checkNonZeros( mat1, 3UL );
+      checkNonZeros( mat2, 0UL );
+
+      if( mat1(0,0) != 1 || mat1(0,1) != 0 || mat1(1,0) != 2 || mat1(1,1) != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Swapping the first matrix failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat1 << "\n"
+             << "   Expected result:\n( 1 0 )\n( 2 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c isDefault() function with the PackedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c isDefault() function with the PackedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIsDefault()
+{
+   {
+      test_ = "isDefault() function";
+
+      SMT mat1;
+      LMT mat2( 3UL );
+
+      if( !isDefault( mat1 ) || isDefault( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   First matrix:\n" << mat1 << "\n"
+             << "   Second matrix:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      clear( mat2 );
+
+      if( !isDefault( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid isDefault evaluation\n"
+             << " Details:\n"
+             << "   Matrix:\n" << mat2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the PackedMatrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of a PackedMatrix with a dense vector
+// and of a transposed dense vector with a PackedMatrix, including the addition and subtraction
+// assignment of the products. Besides small matrices with explicitly given results, matrices
+// of various sizes (including sizes beyond the SMP thresholds) are multiplied with a vector of
+// ones, for which the result is known in closed form. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMult()
+{
+   typedef blaze::DynamicVector<int,blaze::columnVector>   VT;
+   typedef blaze::DynamicVector<int,blaze::rowVector>      TVT;
+   typedef blaze::DynamicVector<cplx,blaze::columnVector>  CVT;
+   typedef blaze::DynamicVector<cplx,blaze::rowVector>     CTVT;
+
+   const size_t sizes[] = { 1UL, 2UL, 3UL, 4UL, 5UL, 7UL, 8UL, 9UL, 15UL, 16UL, 17UL, 33UL, 400UL };
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major PackedMatrix/dense vector multiplication (symmetric matrix)";
+
+      const SMT mat( blaze::SymmetricMatrix<RMT>{ { 1, 2, 4 }, { 2, 3, 0 }, { 4, 0, 6 } } );
+      const VT x{ 1, 2, 3 };
+
+      VT y( mat * x );
+
+      if( y.size() != 3UL || y[0] != 17 || y[1] != 8 || y[2] != 22 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 17 )\n( 8 )\n( 22 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      y += mat * x;
+
+      if( y[0] != 34 || y[1] != 16 || y[2] != 44 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 34 )\n( 16 )\n( 44 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      y -= mat * x;
+
+      if( y[0] != 17 || y[1] != 8 || y[2] != 22 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 17 )\n( 8 )\n( 22 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix/dense vector multiplication (Hermitian matrix)";
+
+      const HMT mat( CRMT{ { cplx( 1, 0 ), cplx( 2, 1 ) }, { cplx( 2,-1 ), cplx( 3, 0 ) } } );
+      const CVT x{ cplx( 1, 0 ), cplx( 0, 1 ) };
+
+      const CVT y( mat * x );
+
+      if( y.size() != 2UL || y[0] != cplx( 0, 2 ) || y[1] != cplx( 2, 2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( (0,2) )\n( (2,2) )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const CTVT z( trans( x ) * mat );
+
+      if( z.size() != 2UL || z[0] != cplx( 2, 2 ) || z[1] != cplx( 2, 4 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose vector multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << z << "\n"
+             << "   Expected result:\n( (2,2) (2,4) )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix/dense vector multiplication (upper matrix)";
+
+      const UMT mat( RMT{ { 1, 2, 0 }, { 0, 3, 5 }, { 0, 0, 6 } } );
+      const VT x{ 1, 2, 3 };
+
+      const VT y( mat * x );
+
+      if( y.size() != 3UL || y[0] != 5 || y[1] != 21 || y[2] != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 5 )\n( 21 )\n( 18 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const TVT z( trans( x ) * mat );
+
+      if( z.size() != 3UL || z[0] != 1 || z[1] != 8 || z[2] != 28 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose vector multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << z << "\n"
+             << "   Expected result:\n( 1 8 28 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix/dense vector multiplication (symmetric matrix of ones)";
+
+      for( size_t n : sizes )
+      {
+         SMT mat( n );
+         for( size_t i=0UL; i<n; ++i )
+            for( size_t j=0UL; j<=i; ++j )
+               mat.data()[mat.index(i,j)] = int( i+j+1UL );
+
+         const VT x( n, 1 );
+         const VT y( mat * x );
+         const TVT z( trans( x ) * mat );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            const int expected( int( n*(i+1UL) + n*(n-1UL)/2UL ) );
+            if( y[i] != expected || z[i] != expected ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Size             : " << n << "\n"
+                   << "   Index            : " << i << "\n"
+                   << "   Result           : " << y[i] << "\n"
+                   << "   Transpose result : " << z[i] << "\n"
+                   << "   Expected result  : " << expected << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix/dense vector multiplication (Hermitian matrix of ones)";
+
+      for( size_t n : sizes )
+      {
+         HMT mat( n );
+         for( size_t i=0UL; i<n; ++i )
+            for( size_t j=0UL; j<=i; ++j )
+               mat.data()[mat.index(i,j)] = cplx( double( i+j+1UL ), double( i ) - double( j ) );
+
+         const CVT x( n, cplx( 1, 0 ) );
+         CVT y( n, cplx( 1, 1 ) );
+         y += mat * x;
+
+         for( size_t i=0UL; i<n; ++i ) {
+            const cplx expected( double( n*(i+1UL) + n*(n-1UL)/2UL ) + 1.0,
+                                 double( n*i ) - double( n*(n-1UL)/2UL ) + 1.0 );
+            if( y[i] != expected ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication with addition assignment failed\n"
+                   << " Details:\n"
+                   << "   Size            : " << n << "\n"
+                   << "   Index           : " << i << "\n"
+                   << "   Result          : " << y[i] << "\n"
+                   << "   Expected result : " << expected << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major PackedMatrix/dense vector multiplication (lower matrix of ones)";
+
+      for( size_t n : sizes )
+      {
+         LMT mat( n );
+         for( size_t i=0UL; i<n; ++i )
+            for( size_t j=0UL; j<=i; ++j )
+               mat.data()[mat.index(i,j)] = int( i+j+1UL );
+
+         const VT x( n, 1 );
+         VT y( n, 0 );
+         y -= mat * x;
+         const TVT z( trans( x ) * mat );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            const int expected1( int( (i+1UL)*(i+1UL) + i*(i+1UL)/2UL ) );
+            const int expected2( int( (n-i)*(i+1UL) + n*(n-1UL)/2UL - i*(i-1UL)/2UL ) );
+            if( y[i] != -expected1 || z[i] != expected2 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Size                       : " << n << "\n"
+                   << "   Index                      : " << i << "\n"
+                   << "   Result                     : " << y[i] << "\n"
+                   << "   Expected result            : " << -expected1 << "\n"
+                   << "   Transpose result           : " << z[i] << "\n"
+                   << "   Expected transpose result  : " << expected2 << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major PackedMatrix/dense vector multiplication (lower matrix)";
+
+      const OLMT mat( CMT{ { 1, 0, 0 }, { 2, 3, 0 }, { 0, 5, 6 } } );
+      const VT x{ 1, 2, 3 };
+
+      VT y( mat * x );
+
+      if( y.size() != 3UL || y[0] != 1 || y[1] != 8 || y[2] != 28 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 1 )\n( 8 )\n( 28 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      y -= mat * x;
+
+      if( y[0] != 0 || y[1] != 0 || y[2] != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 0 )\n( 0 )\n( 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const TVT z( trans( x ) * mat );
+
+      if( z.size() != 3UL || z[0] != 5 || z[1] != 21 || z[2] != 18 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose vector multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << z << "\n"
+             << "   Expected result:\n( 5 21 18 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix/dense vector multiplication (symmetric matrix of ones)";
+
+      for( size_t n : sizes )
+      {
+         OSMT mat( n );
+         for( size_t j=0UL; j<n; ++j )
+            for( size_t i=0UL; i<=j; ++i )
+               mat.data()[mat.index(i,j)] = int( i+j+1UL );
+
+         const VT x( n, 1 );
+         VT y( n, 0 );
+         y += mat * x;
+
+         for( size_t i=0UL; i<n; ++i ) {
+            const int expected( int( n*(i+1UL) + n*(n-1UL)/2UL ) );
+            if( y[i] != expected ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication with addition assignment failed\n"
+                   << " Details:\n"
+                   << "   Size            : " << n << "\n"
+                   << "   Index           : " << i << "\n"
+                   << "   Result          : " << y[i] << "\n"
+                   << "   Expected result : " << expected << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix/dense vector multiplication (Hermitian matrix of ones)";
+
+      for( size_t n : sizes )
+      {
+         OHMT mat( n );
+         for( size_t j=0UL; j<n; ++j )
+            for( size_t i=0UL; i<=j; ++i )
+               mat.data()[mat.index(i,j)] = cplx( double( i+j+1UL ), double( i ) - double( j ) );
+
+         const CVT x( n, cplx( 1, 0 ) );
+         const CVT y( mat * x );
+         const CTVT z( trans( x ) * mat );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            const cplx expected( double( n*(i+1UL) + n*(n-1UL)/2UL ),
+                                 double( n*i ) - double( n*(n-1UL)/2UL ) );
+            if( y[i] != expected || z[i] != conj( expected ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Size                       : " << n << "\n"
+                   << "   Index                      : " << i << "\n"
+                   << "   Result                     : " << y[i] << "\n"
+                   << "   Expected result            : " << expected << "\n"
+                   << "   Transpose result           : " << z[i] << "\n"
+                   << "   Expected transpose result  : " << conj( expected ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Column-major PackedMatrix/dense vector multiplication (upper matrix of ones)";
+
+      for( size_t n : sizes )
+      {
+         OUMT mat( n );
+         for( size_t j=0UL; j<n; ++j )
+            for( size_t i=0UL; i<=j; ++i )
+               mat.data()[mat.index(i,j)] = int( i+j+1UL );
+
+         const VT x( n, 1 );
+         const VT y( mat * x );
+         TVT z( n, 0 );
+         z += trans( x ) * mat;
+
+         for( size_t i=0UL; i<n; ++i ) {
+            const int expected1( int( (n-i)*(i+1UL) + n*(n-1UL)/2UL - i*(i-1UL)/2UL ) );
+            const int expected2( int( (i+1UL)*(i+1UL) + i*(i+1UL)/2UL ) );
+            if( y[i] != expected1 || z[i] != expected2 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Size                       : " << n << "\n"
+                   << "   Index                      : " << i << "\n"
+                   << "   Result                     : " << y[i] << "\n"
+                   << "   Expected result            : " << expected1 << "\n"
+                   << "   Transpose result           : " << z[i] << "\n"
+                   << "   Expected transpose result  : " << expected2 << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solution of triangular systems in packed storage.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c trsv() function for lower, upper, unilower, and
+// uniupper PackedMatrix instances. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSolve()
+{
+   typedef blaze::DynamicVector<double,blaze::columnVector>  VT;
+
+   const size_t sizes[] = { 1UL, 2UL, 3UL, 4UL, 5UL, 7UL, 8UL, 9UL, 15UL, 16UL, 17UL, 33UL, 400UL };
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major trsv() (lower matrix)";
+
+      const blaze::PackedMatrix< blaze::LowerMatrix<DRMT> >
+         mat( DRMT{ { 2.0, 0.0, 0.0 }, { 1.0, 4.0, 0.0 }, { 3.0, 2.0, 5.0 } } );
+
+      VT b{ 2.0, 9.0, 22.0 };
+      trsv( mat, b );
+
+      if( b[0] != 1.0 || b[1] != 2.0 || b[2] != 3.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the triangular system failed\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n"
+             << "   Expected result:\n( 1 )\n( 2 )\n( 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major trsv() (uniupper matrix)";
+
+      const blaze::PackedMatrix< blaze::UniUpperMatrix<DRMT> >
+         mat( DRMT{ { 1.0, 2.0, 3.0 }, { 0.0, 1.0, 4.0 }, { 0.0, 0.0, 1.0 } } );
+
+      VT b{ 14.0, 14.0, 3.0 };
+      trsv( mat, b );
+
+      if( b[0] != 1.0 || b[1] != 2.0 || b[2] != 3.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the triangular system failed\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n"
+             << "   Expected result:\n( 1 )\n( 2 )\n( 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major trsv() (unilower matrix of ones)";
+
+      for( size_t n : sizes )
+      {
+         blaze::PackedMatrix< blaze::UniLowerMatrix<DRMT> > mat( n );
+         for( size_t i=1UL; i<n; ++i )
+            for( size_t j=0UL; j<i; ++j )
+               mat.data()[mat.index(i,j)] = 1.0;
+
+         VT b( n );
+         for( size_t i=0UL; i<n; ++i )
+            b[i] = double( i+1UL );
+
+         trsv( mat, b );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            if( b[i] != 1.0 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Solving the triangular system failed\n"
+                   << " Details:\n"
+                   << "   Size            : " << n << "\n"
+                   << "   Index           : " << i << "\n"
+                   << "   Result          : " << b[i] << "\n"
+                   << "   Expected result : 1\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "Row-major trsv() (invalid right-hand side vector)";
+
+      const blaze::PackedMatrix< blaze::LowerMatrix<DRMT> > mat( 3UL );
+      VT b( 2UL, 1.0 );
+
+      try {
+         trsv( mat, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a system with an invalid right-hand side succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major trsv() (upper matrix)";
+
+      const blaze::PackedMatrix< blaze::UpperMatrix<DCMT> >
+         mat( DCMT{ { 2.0, 1.0, 3.0 }, { 0.0, 4.0, 2.0 }, { 0.0, 0.0, 5.0 } } );
+
+      VT b{ 13.0, 14.0, 15.0 };
+      trsv( mat, b );
+
+      if( b[0] != 1.0 || b[1] != 2.0 || b[2] != 3.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the triangular system failed\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n"
+             << "   Expected result:\n( 1 )\n( 2 )\n( 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major trsv() (unilower matrix)";
+
+      const blaze::PackedMatrix< blaze::UniLowerMatrix<DCMT> >
+         mat( DCMT{ { 1.0, 0.0, 0.0 }, { 2.0, 1.0, 0.0 }, { 3.0, 4.0, 1.0 } } );
+
+      VT b{ 1.0, 4.0, 14.0 };
+      trsv( mat, b );
+
+      if( b[0] != 1.0 || b[1] != 2.0 || b[2] != 3.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving the triangular system failed\n"
+             << " Details:\n"
+             << "   Result:\n" << b << "\n"
+             << "   Expected result:\n( 1 )\n( 2 )\n( 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major trsv() (uniupper matrix of ones)";
+
+      for( size_t n : sizes )
+      {
+         blaze::PackedMatrix< blaze::UniUpperMatrix<DCMT> > mat( n );
+         for( size_t j=1UL; j<n; ++j )
+            for( size_t i=0UL; i<j; ++i )
+               mat.data()[mat.index(i,j)] = 1.0;
+
+         VT b( n );
+         for( size_t i=0UL; i<n; ++i )
+            b[i] = double( n-i );
+
+         trsv( mat, b );
+
+         for( size_t i=0UL; i<n; ++i ) {
+            if( b[i] != 1.0 ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Solving the triangular system failed\n"
+                   << " Details:\n"
+                   << "   Size            : " << n << "\n"
+                   << "   Index           : " << i << "\n"
+                   << "   Result          : " << b[i] << "\n"
+                   << "   Expected result : 1\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PackedMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_PACKEDMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PackedMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
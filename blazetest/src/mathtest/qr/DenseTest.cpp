@@ -77,6 +77,7 @@ DenseTest::DenseTest()
    testUpper();
    testUniUpper();
    testDiagonal();
+   testRankDeficient();
 }
 //*************************************************************************************************
 
@@ -296,6 +297,26 @@ void DenseTest::testDiagonal()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the QR decomposition functionality for rank deficient matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the dense matrix QR decomposition for rank deficient and rectangular
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testRankDeficient()
+{
+   testRankDeficientMatrix< blaze::DynamicMatrix<double,blaze::rowMajor   > >();
+   testRankDeficientMatrix< blaze::DynamicMatrix<double,blaze::columnMajor> >();
+
+   testRankDeficientMatrix< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >();
+   testRankDeficientMatrix< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+}
+//*************************************************************************************************
+
 } // namespace qr
 
 } // namespace mathtest
@@ -0,0 +1,1978 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/sellmatrix/ClassTest.cpp
+//  \brief Source file for the SellMatrix class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <utility>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/Subvector.h>
+#include <blazetest/mathtest/sellmatrix/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sellmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SellMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testConstructors();
+   testAssignment();
+   testFunctionCall();
+   testAt();
+   testIterator();
+   testNonZeros();
+   testChunks();
+   testPermutation();
+   testReset();
+   testClear();
+   testSwap();
+   testFind();
+   testLowerBound();
+   testUpperBound();
+   testMult();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the SellMatrix class template. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testConstructors()
+{
+   //=====================================================================================
+   // Default constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix default constructor";
+
+      MT sell;
+
+      checkRows    ( sell, 0UL );
+      checkColumns ( sell, 0UL );
+      checkSigma   ( sell, MT::defaultSigma );
+      checkChunks  ( sell, 0UL );
+      checkNonZeros( sell, 0UL );
+   }
+
+
+   //=====================================================================================
+   // Size constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix size constructor (0x0)";
+
+      MT sell( 0UL, 0UL );
+
+      checkRows    ( sell, 0UL );
+      checkColumns ( sell, 0UL );
+      checkSigma   ( sell, MT::defaultSigma );
+      checkChunks  ( sell, 0UL );
+      checkNonZeros( sell, 0UL );
+   }
+
+   {
+      test_ = "SellMatrix size constructor (5x6)";
+
+      MT sell( 5UL, 6UL, 3UL );
+
+      checkRows    ( sell, 5UL );
+      checkColumns ( sell, 6UL );
+      checkSigma   ( sell, 3UL );
+      checkChunks  ( sell, ( 5UL + MT::SIMDSIZE - 1UL ) / MT::SIMDSIZE );
+      checkNonZeros( sell, 0UL );
+      checkNonZeros( sell, 0UL, 0UL );
+      checkNonZeros( sell, 4UL, 0UL );
+
+      if( capacity( sell ) != 0UL || sell(0,0) != 0 || sell(4,5) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Capacity: " << capacity( sell ) << "\n"
+             << "   Result:\n" << sell << "\n"
+             << "   Expected result:\n( 0 0 0 0 0 0 )\n( 0 0 0 0 0 0 )\n( 0 0 0 0 0 0 )\n"
+                                     "( 0 0 0 0 0 0 )\n( 0 0 0 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix conversion constructor (row-major compressed matrix)";
+
+      CMT mat( 5UL, 6UL );
+      mat(0,1) =  1;
+      mat(0,4) =  2;
+      mat(2,0) =  3;
+      mat(2,2) =  4;
+      mat(2,3) =  5;
+      mat(2,5) =  6;
+      mat(4,5) = -7;
+
+      MT sell( mat );
+
+      checkRows    ( sell, 5UL );
+      checkColumns ( sell, 6UL );
+      checkSigma   ( sell, MT::defaultSigma );
+      checkChunks  ( sell, ( 5UL + MT::SIMDSIZE - 1UL ) / MT::SIMDSIZE );
+      checkCapacity( sell, 7UL );
+      checkNonZeros( sell, 7UL );
+      checkNonZeros( sell, 0UL, 2UL );
+      checkNonZeros( sell, 1UL, 0UL );
+      checkNonZeros( sell, 2UL, 4UL );
+      checkNonZeros( sell, 3UL, 0UL );
+      checkNonZeros( sell, 4UL, 1UL );
+
+      if( sell(0,1) != 1 || sell(0,4) != 2 ||
+          sell(2,0) != 3 || sell(2,2) != 4 || sell(2,3) != 5 || sell(2,5) != 6 ||
+          sell(4,5) != -7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sell << "\n"
+             << "   Expected result:\n( 0 1 0 0 2  0 )\n( 0 0 0 0 0  0 )\n( 3 0 4 5 0  6 )\n"
+                                     "( 0 0 0 0 0  0 )\n( 0 0 0 0 0 -7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix conversion constructor (column-major compressed matrix)";
+
+      OMT mat( 5UL, 6UL );
+      mat(0,1) =  1;
+      mat(0,4) =  2;
+      mat(2,0) =  3;
+      mat(2,2) =  4;
+      mat(2,3) =  5;
+      mat(2,5) =  6;
+      mat(4,5) = -7;
+
+      MT sell( mat, 1UL );
+
+      checkRows    ( sell, 5UL );
+      checkColumns ( sell, 6UL );
+      checkSigma   ( sell, 1UL );
+      checkNonZeros( sell, 7UL );
+      checkNonZeros( sell, 0UL, 2UL );
+      checkNonZeros( sell, 1UL, 0UL );
+      checkNonZeros( sell, 2UL, 4UL );
+      checkNonZeros( sell, 3UL, 0UL );
+      checkNonZeros( sell, 4UL, 1UL );
+
+      if( sell(0,1) != 1 || sell(0,4) != 2 ||
+          sell(2,0) != 3 || sell(2,2) != 4 || sell(2,3) != 5 || sell(2,5) != 6 ||
+          sell(4,5) != -7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sell << "\n"
+             << "   Expected result:\n( 0 1 0 0 2  0 )\n( 0 0 0 0 0  0 )\n( 3 0 4 5 0  6 )\n"
+                                     "( 0 0 0 0 0  0 )\n( 0 0 0 0 0 -7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix conversion constructor (dense matrix)";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat{ { 0, 1, 0, 0, 2,  0 },
+                                                     { 0, 0, 0, 0, 0,  0 },
+                                                     { 3, 0, 4, 5, 0,  6 },
+                                                     { 0, 0, 0, 0, 0,  0 },
+                                                     { 0, 0, 0, 0, 0, -7 } };
+
+      MT sell( mat, 2UL );
+
+      checkRows    ( sell, 5UL );
+      checkColumns ( sell, 6UL );
+      checkSigma   ( sell, 2UL );
+      checkNonZeros( sell, 7UL );
+      checkNonZeros( sell, 0UL, 2UL );
+      checkNonZeros( sell, 1UL, 0UL );
+      checkNonZeros( sell, 2UL, 4UL );
+      checkNonZeros( sell, 3UL, 0UL );
+      checkNonZeros( sell, 4UL, 1UL );
+
+      if( sell(0,1) != 1 || sell(0,4) != 2 ||
+          sell(2,0) != 3 || sell(2,2) != 4 || sell(2,3) != 5 || sell(2,5) != 6 ||
+          sell(4,5) != -7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sell << "\n"
+             << "   Expected result:\n( 0 1 0 0 2  0 )\n( 0 0 0 0 0  0 )\n( 3 0 4 5 0  6 )\n"
+                                     "( 0 0 0 0 0  0 )\n( 0 0 0 0 0 -7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix conversion constructor (invalid sorting scope)";
+
+      try {
+         MT sell( CMT( 3UL, 3UL ), 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with invalid sorting scope succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << sell << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Copy constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix copy constructor";
+
+      CMT mat( 5UL, 6UL );
+      mat(0,1) =  1;
+      mat(0,4) =  2;
+      mat(2,0) =  3;
+      mat(2,2) =  4;
+      mat(2,3) =  5;
+      mat(2,5) =  6;
+      mat(4,5) = -7;
+
+      MT sell1( mat, 3UL );
+      MT sell2( sell1 );
+
+      checkRows    ( sell2, 5UL );
+      checkColumns ( sell2, 6UL );
+      checkSigma   ( sell2, 3UL );
+      checkNonZeros( sell2, 7UL );
+      checkNonZeros( sell2, 0UL, 2UL );
+      checkNonZeros( sell2, 1UL, 0UL );
+      checkNonZeros( sell2, 2UL, 4UL );
+      checkNonZeros( sell2, 3UL, 0UL );
+      checkNonZeros( sell2, 4UL, 1UL );
+
+      if( sell2(0,1) != 1 || sell2(0,4) != 2 ||
+          sell2(2,0) != 3 || sell2(2,2) != 4 || sell2(2,3) != 5 || sell2(2,5) != 6 ||
+          sell2(4,5) != -7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sell2 << "\n"
+             << "   Expected result:\n( 0 1 0 0 2  0 )\n( 0 0 0 0 0  0 )\n( 3 0 4 5 0  6 )\n"
+                                     "( 0 0 0 0 0  0 )\n( 0 0 0 0 0 -7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Move constructor
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix move constructor";
+
+      CMT mat( 5UL, 6UL );
+      mat(0,1) =  1;
+      mat(0,4) =  2;
+      mat(2,0) =  3;
+      mat(2,2) =  4;
+      mat(2,3) =  5;
+      mat(2,5) =  6;
+      mat(4,5) = -7;
+
+      MT sell1( mat, 3UL );
+      MT sell2( std::move( sell1 ) );
+
+      checkRows    ( sell2, 5UL );
+      checkColumns ( sell2, 6UL );
+      checkSigma   ( sell2, 3UL );
+      checkNonZeros( sell2, 7UL );
+      checkNonZeros( sell2, 0UL, 2UL );
+      checkNonZeros( sell2, 1UL, 0UL );
+      checkNonZeros( sell2, 2UL, 4UL );
+      checkNonZeros( sell2, 3UL, 0UL );
+      checkNonZeros( sell2, 4UL, 1UL );
+
+      if( sell2(0,1) != 1 || sell2(0,4) != 2 ||
+          sell2(2,0) != 3 || sell2(2,2) != 4 || sell2(2,3) != 5 || sell2(2,5) != 6 ||
+          sell2(4,5) != -7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sell2 << "\n"
+             << "   Expected result:\n( 0 1 0 0 2  0 )\n( 0 0 0 0 0  0 )\n( 3 0 4 5 0  6 )\n"
+                                     "( 0 0 0 0 0  0 )\n( 0 0 0 0 0 -7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix assignment operators.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all assignment operators of the SellMatrix class template
+// and of the conversion of a SellMatrix back into a compressed matrix. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssignment()
+{
+   //=====================================================================================
+   // Copy assignment
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix copy assignment";
+
+      CMT mat( 5UL, 6UL );
+      mat(0,1) =  1;
+      mat(0,4) =  2;
+      mat(2,0) =  3;
+      mat(2,2) =  4;
+      mat(2,3) =  5;
+      mat(2,5) =  6;
+      mat(4,5) = -7;
+
+      const MT sell1( mat, 3UL );
+      MT sell2( 2UL, 2UL );
+      sell2 = sell1;
+
+      checkRows    ( sell2, 5UL );
+      checkColumns ( sell2, 6UL );
+      checkSigma   ( sell2, 3UL );
+      checkNonZeros( sell2, 7UL );
+      checkNonZeros( sell2, 0UL, 2UL );
+      checkNonZeros( sell2, 1UL, 0UL );
+      checkNonZeros( sell2, 2UL, 4UL );
+      checkNonZeros( sell2, 3UL, 0UL );
+      checkNonZeros( sell2, 4UL, 1UL );
+
+      if( sell2(0,1) != 1 || sell2(0,4) != 2 ||
+          sell2(2,0) != 3 || sell2(2,2) != 4 || sell2(2,3) != 5 || sell2(2,5) != 6 ||
+          sell2(4,5) != -7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sell2 << "\n"
+             << "   Expected result:\n( 0 1 0 0 2  0 )\n( 0 0 0 0 0  0 )\n( 3 0 4 5 0  6 )\n"
+                                     "( 0 0 0 0 0  0 )\n( 0 0 0 0 0 -7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Compressed matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix compressed matrix assignment";
+
+      CMT mat( 5UL, 6UL );
+      mat(0,1) =  1;
+      mat(0,4) =  2;
+      mat(2,0) =  3;
+      mat(2,2) =  4;
+      mat(2,3) =  5;
+      mat(2,5) =  6;
+      mat(4,5) = -7;
+
+      MT sell( 2UL, 2UL, 4UL );
+      sell = mat;
+
+      checkRows    ( sell, 5UL );
+      checkColumns ( sell, 6UL );
+      checkSigma   ( sell, 4UL );
+      checkNonZeros( sell, 7UL );
+      checkNonZeros( sell, 0UL, 2UL );
+      checkNonZeros( sell, 1UL, 0UL );
+      checkNonZeros( sell, 2UL, 4UL );
+      checkNonZeros( sell, 3UL, 0UL );
+      checkNonZeros( sell, 4UL, 1UL );
+
+      if( sell(0,1) != 1 || sell(0,4) != 2 ||
+          sell(2,0) != 3 || sell(2,2) != 4 || sell(2,3) != 5 || sell(2,5) != 6 ||
+          sell(4,5) != -7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sell << "\n"
+             << "   Expected result:\n( 0 1 0 0 2  0 )\n( 0 0 0 0 0  0 )\n( 3 0 4 5 0  6 )\n"
+                                     "( 0 0 0 0 0  0 )\n( 0 0 0 0 0 -7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix self assignment";
+
+      CMT mat( 5UL, 6UL );
+      mat(0,1) =  1;
+      mat(0,4) =  2;
+      mat(2,0) =  3;
+      mat(2,2) =  4;
+      mat(2,3) =  5;
+      mat(2,5) =  6;
+      mat(4,5) = -7;
+
+      MT sell( mat, 2UL );
+      const MT& ref( sell );
+      sell = ref;
+
+      checkRows    ( sell, 5UL );
+      checkColumns ( sell, 6UL );
+      checkSigma   ( sell, 2UL );
+      checkNonZeros( sell, 7UL );
+
+      if( sell(0,1) != 1 || sell(0,4) != 2 ||
+          sell(2,0) != 3 || sell(2,2) != 4 || sell(2,3) != 5 || sell(2,5) != 6 ||
+          sell(4,5) != -7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sell << "\n"
+             << "   Expected result:\n( 0 1 0 0 2  0 )\n( 0 0 0 0 0  0 )\n( 3 0 4 5 0  6 )\n"
+                                     "( 0 0 0 0 0  0 )\n( 0 0 0 0 0 -7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Conversion into a compressed matrix
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix conversion into a compressed matrix";
+
+      CMT mat( 5UL, 6UL );
+      mat(0,1) =  1;
+      mat(0,4) =  2;
+      mat(2,0) =  3;
+      mat(2,2) =  4;
+      mat(2,3) =  5;
+      mat(2,5) =  6;
+      mat(4,5) = -7;
+
+      const MT sell( mat, 5UL );
+
+      const CMT res1( sell );
+      OMT res2;
+      res2 = sell;
+
+      checkRows    ( res1, 5UL );
+      checkColumns ( res1, 6UL );
+      checkNonZeros( res1, 7UL );
+      checkRows    ( res2, 5UL );
+      checkColumns ( res2, 6UL );
+      checkNonZeros( res2, 7UL );
+
+      if( res1 != mat || res2 != mat ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion failed\n"
+             << " Details:\n"
+             << "   Result (row-major):\n" << res1 << "\n"
+             << "   Result (column-major):\n" << res2 << "\n"
+             << "   Expected result:\n( 0 1 0 0 2  0 )\n( 0 0 0 0 0  0 )\n( 3 0 4 5 0  6 )\n"
+                                     "( 0 0 0 0 0  0 )\n( 0 0 0 0 0 -7 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix function call operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the function call operator of the
+// SellMatrix class template, including the zero elements of the padded chunk slots. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFunctionCall()
+{
+   test_ = "SellMatrix::operator()";
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 0, 1, 0, 0, 2,  0 },
+                                                        { 0, 0, 0, 0, 0,  0 },
+                                                        { 3, 0, 4, 5, 0,  6 },
+                                                        { 0, 0, 0, 0, 0,  0 },
+                                                        { 0, 0, 0, 0, 0, -7 } };
+
+   for( size_t sigma=1UL; sigma<=6UL; ++sigma )
+   {
+      const MT sell( ref, sigma );
+
+      for( size_t i=0UL; i<ref.rows(); ++i ) {
+         for( size_t j=0UL; j<ref.columns(); ++j ) {
+            if( sell(i,j) != ref(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Function call operator failed\n"
+                   << " Details:\n"
+                   << "   Sorting scope: " << sigma << "\n"
+                   << "   Element (i,j): (" << i << "," << j << ")\n"
+                   << "   Result:\n" << sell << "\n"
+                   << "   Expected result:\n( 0 1 0 0 2  0 )\n( 0 0 0 0 0  0 )\n"
+                                           "( 3 0 4 5 0  6 )\n( 0 0 0 0 0  0 )\n"
+                                           "( 0 0 0 0 0 -7 )\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c at() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of accessing elements via the \c at() member function of the
+// SellMatrix class template. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testAt()
+{
+   test_ = "SellMatrix::at()";
+
+   CMT mat( 5UL, 6UL );
+   mat(0,1) =  1;
+   mat(0,4) =  2;
+   mat(2,0) =  3;
+   mat(2,2) =  4;
+   mat(2,3) =  5;
+   mat(2,5) =  6;
+   mat(4,5) = -7;
+
+   const MT sell( mat, 2UL );
+
+   if( sell.at(0,1) != 1 || sell.at(2,3) != 5 || sell.at(4,5) != -7 ||
+       sell.at(1,1) != 0 || sell.at(3,5) != 0 || sell.at(4,0) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Access via at() function failed\n"
+          << " Details:\n"
+          << "   Result:\n" << sell << "\n"
+          << "   Expected result:\n( 0 1 0 0 2  0 )\n( 0 0 0 0 0  0 )\n( 3 0 4 5 0  6 )\n"
+                                  "( 0 0 0 0 0  0 )\n( 0 0 0 0 0 -7 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      const int value( sell.at( 5UL, 0UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound row access succeeded\n"
+          << " Details:\n"
+          << "   Result: " << value << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+
+   try {
+      const int value( sell.at( 0UL, 6UL ) );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Out-of-bound column access succeeded\n"
+          << " Details:\n"
+          << "   Result: " << value << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix iterator implementation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the iterator implementation of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIterator()
+{
+   typedef MT::ConstIterator  ConstIterator;
+
+   CMT mat( 5UL, 6UL );
+   mat(0,1) =  1;
+   mat(0,4) =  2;
+   mat(2,0) =  3;
+   mat(2,2) =  4;
+   mat(2,3) =  5;
+   mat(2,5) =  6;
+   mat(4,5) = -7;
+
+   const MT sell( mat, 5UL );
+
+   // Testing the ConstIterator default constructor
+   {
+      test_ = "ConstIterator default constructor";
+
+      ConstIterator it{};
+
+      if( it != ConstIterator() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Failed iterator default constructor\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Counting the number of elements in each row via ConstIterator (end-begin)
+   {
+      test_ = "Row-wise iterator subtraction (end-begin)";
+
+      const ptrdiff_t expected[5] = { 2L, 0L, 4L, 0L, 1L };
+
+      for( size_t i=0UL; i<5UL; ++i )
+      {
+         const ptrdiff_t number( sell.end(i) - sell.begin(i) );
+
+         if( number != expected[i] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of elements detected\n"
+                << " Details:\n"
+                << "   Row: " << i << "\n"
+                << "   Number of elements         : " << number << "\n"
+                << "   Expected number of elements: " << expected[i] << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Testing the empty rows
+   {
+      test_ = "Iteration over an empty row";
+
+      if( sell.begin(1) != sell.end(1) || sell.cbegin(3) != sell.cend(3) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Empty row contains elements\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing read-only access via ConstIterator
+   {
+      test_ = "Read-only access via ConstIterator";
+
+      ConstIterator it ( sell.cbegin(2) );
+      ConstIterator end( sell.cend(2) );
+
+      if( it == end || it->value() != 3 || it->index() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid initial iterator detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ++it;
+
+      if( it == end || it->value() != 4 || it->index() != 2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator pre-increment failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      it++;
+
+      if( it == end || (*it).value() != 5 || (*it).index() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator post-increment failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ++it;
+
+      if( it == end || it->value() != 6 || it->index() != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator pre-increment failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      it++;
+
+      if( it != end ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Iterator post-increment failed\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Testing the equivalence of begin() and cbegin()
+   {
+      test_ = "Equivalence of begin() and cbegin()";
+
+      for( size_t i=0UL; i<5UL; ++i ) {
+         if( sell.begin(i) != sell.cbegin(i) || sell.end(i) != sell.cend(i) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Non-equivalent iterators detected\n"
+                << " Details:\n"
+                << "   Row: " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c nonZeros() member functions of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c nonZeros() member functions of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNonZeros()
+{
+   {
+      test_ = "SellMatrix::nonZeros() (empty rows)";
+
+      const MT sell( CMT( 3UL, 4UL ) );
+
+      checkRows    ( sell, 3UL );
+      checkColumns ( sell, 4UL );
+      checkNonZeros( sell, 0UL );
+      checkNonZeros( sell, 0UL, 0UL );
+      checkNonZeros( sell, 1UL, 0UL );
+      checkNonZeros( sell, 2UL, 0UL );
+   }
+
+   {
+      test_ = "SellMatrix::nonZeros() (irregular rows)";
+
+      CMT mat( 5UL, 6UL );
+      mat(0,1) =  1;
+      mat(0,4) =  2;
+      mat(2,0) =  3;
+      mat(2,2) =  4;
+      mat(2,3) =  5;
+      mat(2,5) =  6;
+      mat(4,5) = -7;
+
+      const MT sell( mat, 5UL );
+
+      checkRows    ( sell, 5UL );
+      checkColumns ( sell, 6UL );
+      checkNonZeros( sell, 7UL );
+      checkNonZeros( sell, 0UL, 2UL );
+      checkNonZeros( sell, 1UL, 0UL );
+      checkNonZeros( sell, 2UL, 4UL );
+      checkNonZeros( sell, 3UL, 0UL );
+      checkNonZeros( sell, 4UL, 1UL );
+   }
+
+   {
+      test_ = "SellMatrix::nonZeros() (explicitly stored zero)";
+
+      CMT mat( 3UL, 4UL );
+      mat.insert( 1UL, 2UL, 0 );
+      mat(2,3) = 1;
+
+      const MT sell( mat );
+
+      checkNonZeros( sell, 2UL );
+      checkNonZeros( sell, 0UL, 0UL );
+      checkNonZeros( sell, 1UL, 1UL );
+      checkNonZeros( sell, 2UL, 1UL );
+
+      if( sell(1,2) != 0 || sell(2,3) != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup failed\n"
+             << " Details:\n"
+             << "   Result:\n" << sell << "\n"
+             << "   Expected result:\n( 0 0 0 0 )\n( 0 0 0 0 )\n( 0 0 0 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the chunk layout of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the chunk layout of the SellMatrix class template. The
+// test matrix consists of 2C rows (where C is the chunk height) that alternately contain one
+// and three non-zero elements. Without sorting all chunks are padded to a width of three,
+// whereas a sorting scope spanning both chunks groups the long and the short rows into
+// separate chunks. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testChunks()
+{
+   const size_t C( DMT::SIMDSIZE );
+   const size_t m( 2UL*C );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> mat( m, 7UL );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      const size_t length( i % 2UL == 1UL ? 3UL : 1UL );
+      for( size_t t=0UL; t<length; ++t ) {
+         mat(i,(i+t)%7UL) = 1.0;
+      }
+   }
+
+   //=====================================================================================
+   // Unsorted rows
+   //=====================================================================================
+
+   for( size_t sigma=1UL; sigma<=C; sigma*=2UL )
+   {
+      test_ = "SellMatrix chunk layout (sigma <= C)";
+
+      const DMT sell( mat, sigma );
+
+      checkRows    ( sell, m );
+      checkColumns ( sell, 7UL );
+      checkSigma   ( sell, sigma );
+      checkChunks  ( sell, 2UL );
+      checkNonZeros( sell, 4UL*C );
+
+      const size_t expected( C == 1UL ? 4UL : 6UL*C );
+
+      if( capacity( sell ) != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity detected\n"
+             << " Details:\n"
+             << "   Sorting scope    : " << sigma << "\n"
+             << "   Capacity         : " << capacity( sell ) << "\n"
+             << "   Expected capacity: " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<m; ++i )
+      {
+         const size_t length( i % 2UL == 1UL ? 3UL : 1UL );
+         const size_t width( C == 1UL ? length : 3UL );
+
+         checkNonZeros( sell, i, length );
+
+         if( capacity( sell, i ) != width ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid chunk width detected\n"
+                << " Details:\n"
+                << "   Sorting scope : " << sigma << "\n"
+                << "   Row           : " << i << "\n"
+                << "   Width         : " << capacity( sell, i ) << "\n"
+                << "   Expected width: " << width << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Sorted rows
+   //=====================================================================================
+
+   for( size_t sigma=m; sigma<=4UL*m; sigma*=2UL )
+   {
+      test_ = "SellMatrix chunk layout (sigma >= 2C)";
+
+      const DMT sell( mat, sigma );
+
+      checkRows    ( sell, m );
+      checkColumns ( sell, 7UL );
+      checkSigma   ( sell, sigma );
+      checkChunks  ( sell, 2UL );
+      checkNonZeros( sell, 4UL*C );
+
+      if( capacity( sell ) != 4UL*C ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity detected\n"
+             << " Details:\n"
+             << "   Sorting scope    : " << sigma << "\n"
+             << "   Capacity         : " << capacity( sell ) << "\n"
+             << "   Expected capacity: " << 4UL*C << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<m; ++i )
+      {
+         const size_t length( i % 2UL == 1UL ? 3UL : 1UL );
+
+         checkNonZeros( sell, i, length );
+
+         if( capacity( sell, i ) != length ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid chunk width detected\n"
+                << " Details:\n"
+                << "   Sorting scope : " << sigma << "\n"
+                << "   Row           : " << i << "\n"
+                << "   Width         : " << capacity( sell, i ) << "\n"
+                << "   Expected width: " << length << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Partial last chunk
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix chunk layout (partial last chunk)";
+
+      const DMT sell( blaze::CompressedMatrix<double,blaze::rowMajor>( 2UL*C+1UL, 3UL ) );
+
+      checkRows    ( sell, 2UL*C+1UL );
+      checkChunks  ( sell, 3UL );
+      checkNonZeros( sell, 0UL );
+
+      if( capacity( sell ) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity detected\n"
+             << " Details:\n"
+             << "   Capacity         : " << capacity( sell ) << "\n"
+             << "   Expected capacity: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the row permutation of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the row permutation of the SellMatrix class template. For
+// a matrix with rows of irregular length and various sorting scopes it checks that the rows
+// remain accessible under their original indices, that the conversion back into a compressed
+// matrix reproduces the original matrix and that the multiplication with a dense vector
+// scatters the results back into the original row order. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPermutation()
+{
+   const size_t C( DMT::SIMDSIZE );
+   const size_t m( 3UL*C+1UL );
+
+   // Row i contains the elements 10*i+t+1 at the columns 2*t+i%2 for t < (5*i)%4
+   blaze::CompressedMatrix<double,blaze::rowMajor> mat( m, 8UL );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t t=0UL; t<(5UL*i)%4UL; ++t ) {
+         mat(i,2UL*t+i%2UL) = double( 10UL*i+t+1UL );
+      }
+   }
+
+   const blaze::DynamicVector<double,blaze::columnVector> x{ 1.0, 2.0, 3.0, 4.0,
+                                                             5.0, 6.0, 7.0, 8.0 };
+
+   for( size_t sigma=1UL; sigma<=2UL*m; sigma=( sigma < C ? sigma+1UL : sigma+C ) )
+   {
+      const DMT sell( mat, sigma );
+
+      // Access to the rows under their original indices
+      {
+         test_ = "SellMatrix row permutation (row access)";
+
+         checkRows    ( sell, m );
+         checkColumns ( sell, 8UL );
+         checkSigma   ( sell, sigma );
+
+         for( size_t i=0UL; i<m; ++i )
+         {
+            const size_t length( (5UL*i)%4UL );
+
+            checkNonZeros( sell, i, length );
+
+            size_t t( 0UL );
+            for( DMT::ConstIterator it=sell.begin(i); it!=sell.end(i); ++it, ++t ) {
+               if( it->index() != 2UL*t+i%2UL || it->value() != double( 10UL*i+t+1UL ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Invalid row element detected\n"
+                      << " Details:\n"
+                      << "   Sorting scope : " << sigma << "\n"
+                      << "   Row           : " << i << "\n"
+                      << "   Index         : " << it->index() << "\n"
+                      << "   Value         : " << it->value() << "\n"
+                      << "   Expected index: " << 2UL*t+i%2UL << "\n"
+                      << "   Expected value: " << 10UL*i+t+1UL << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Conversion back into a compressed matrix
+      {
+         test_ = "SellMatrix row permutation (round-trip conversion)";
+
+         const blaze::CompressedMatrix<double,blaze::rowMajor> res( sell );
+
+         checkNonZeros( res, nonZeros( mat ) );
+
+         for( size_t i=0UL; i<m; ++i ) {
+            for( size_t t=0UL; t<(5UL*i)%4UL; ++t ) {
+               if( res(i,2UL*t+i%2UL) != double( 10UL*i+t+1UL ) ) {
+                  std::ostringstream oss;
+                  oss << " Test: " << test_ << "\n"
+                      << " Error: Round-trip conversion failed\n"
+                      << " Details:\n"
+                      << "   Sorting scope: " << sigma << "\n"
+                      << "   Element (i,j): (" << i << "," << 2UL*t+i%2UL << ")\n"
+                      << "   Result: " << res(i,2UL*t+i%2UL) << "\n"
+                      << "   Expected value: " << 10UL*i+t+1UL << "\n";
+                  throw std::runtime_error( oss.str() );
+               }
+            }
+         }
+      }
+
+      // Multiplication with a dense vector
+      {
+         test_ = "SellMatrix row permutation (multiplication)";
+
+         const blaze::DynamicVector<double,blaze::columnVector> y( sell * x );
+
+         for( size_t i=0UL; i<m; ++i )
+         {
+            double expected( 0.0 );
+            for( size_t t=0UL; t<(5UL*i)%4UL; ++t ) {
+               expected += double( 10UL*i+t+1UL ) * double( 2UL*t+i%2UL+1UL );
+            }
+
+            if( y[i] != expected ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Sorting scope: " << sigma << "\n"
+                   << "   Row: " << i << "\n"
+                   << "   Result: " << y[i] << "\n"
+                   << "   Expected value: " << expected << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reset() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reset() member function of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "SellMatrix::reset()";
+
+   CMT mat( 5UL, 6UL );
+   mat(0,1) =  1;
+   mat(0,4) =  2;
+   mat(2,0) =  3;
+   mat(2,2) =  4;
+   mat(2,3) =  5;
+   mat(2,5) =  6;
+   mat(4,5) = -7;
+
+   MT sell( mat, 3UL );
+
+   checkNonZeros( sell, 7UL );
+
+   reset( sell );
+
+   checkRows    ( sell, 5UL );
+   checkColumns ( sell, 6UL );
+   checkSigma   ( sell, 3UL );
+   checkChunks  ( sell, ( 5UL + MT::SIMDSIZE - 1UL ) / MT::SIMDSIZE );
+   checkNonZeros( sell, 0UL );
+   checkNonZeros( sell, 2UL, 0UL );
+
+   if( sell(0,1) != 0 || sell(2,3) != 0 || sell(4,5) != 0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Result:\n" << sell << "\n"
+          << "   Expected result:\n( 0 0 0 0 0 0 )\n( 0 0 0 0 0 0 )\n( 0 0 0 0 0 0 )\n"
+                                  "( 0 0 0 0 0 0 )\n( 0 0 0 0 0 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c clear() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c clear() member function of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testClear()
+{
+   test_ = "SellMatrix::clear()";
+
+   CMT mat( 5UL, 6UL );
+   mat(0,1) =  1;
+   mat(2,3) =  5;
+   mat(4,5) = -7;
+
+   MT sell( mat, 3UL );
+
+   clear( sell );
+
+   checkRows    ( sell, 0UL );
+   checkColumns ( sell, 0UL );
+   checkSigma   ( sell, 3UL );
+   checkChunks  ( sell, 0UL );
+   checkNonZeros( sell, 0UL );
+
+   sell = mat;
+
+   checkRows    ( sell, 5UL );
+   checkColumns ( sell, 6UL );
+   checkSigma   ( sell, 3UL );
+   checkNonZeros( sell, 3UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c swap() functionality of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c swap() function of the SellMatrix class template.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSwap()
+{
+   test_ = "SellMatrix swap";
+
+   CMT mat1( 5UL, 6UL );
+   mat1(0,1) =  1;
+   mat1(2,3) =  5;
+   mat1(4,5) = -7;
+
+   CMT mat2( 2UL, 3UL );
+   mat2(1,0) = 2;
+
+   MT sell1( mat1, 3UL );
+   MT sell2( mat2, 1UL );
+
+   swap( sell1, sell2 );
+
+   checkRows    ( sell1, 2UL );
+   checkColumns ( sell1, 3UL );
+   checkSigma   ( sell1, 1UL );
+   checkNonZeros( sell1, 1UL );
+   checkNonZeros( sell1, 0UL, 0UL );
+   checkNonZeros( sell1, 1UL, 1UL );
+
+   if( sell1(1,0) != 2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the first matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << sell1 << "\n"
+          << "   Expected result:\n( 0 0 0 )\n( 2 0 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkRows    ( sell2, 5UL );
+   checkColumns ( sell2, 6UL );
+   checkSigma   ( sell2, 3UL );
+   checkNonZeros( sell2, 3UL );
+   checkNonZeros( sell2, 0UL, 1UL );
+   checkNonZeros( sell2, 2UL, 1UL );
+   checkNonZeros( sell2, 4UL, 1UL );
+
+   if( sell2(0,1) != 1 || sell2(2,3) != 5 || sell2(4,5) != -7 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Swapping the second matrix failed\n"
+          << " Details:\n"
+          << "   Result:\n" << sell2 << "\n"
+          << "   Expected result:\n( 0 1 0 0 0  0 )\n( 0 0 0 0 0  0 )\n( 0 0 0 5 0  0 )\n"
+                                  "( 0 0 0 0 0  0 )\n( 0 0 0 0 0 -7 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c find() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c find() member function of the SellMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFind()
+{
+   test_ = "SellMatrix::find()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   CMT mat( 5UL, 6UL );
+   mat(0,1) =  1;
+   mat(0,4) =  2;
+   mat(2,0) =  3;
+   mat(2,2) =  4;
+   mat(2,3) =  5;
+   mat(2,5) =  6;
+   mat(4,5) = -7;
+
+   const MT sell( mat, 5UL );
+
+   // Searching for the existing elements
+   {
+      const size_t i[7] = { 0UL, 0UL, 2UL, 2UL, 2UL, 2UL, 4UL };
+      const size_t j[7] = { 1UL, 4UL, 0UL, 2UL, 3UL, 5UL, 5UL };
+      const int    v[7] = { 1, 2, 3, 4, 5, 6, -7 };
+
+      for( size_t k=0UL; k<7UL; ++k )
+      {
+         const ConstIterator pos( sell.find( i[k], j[k] ) );
+
+         if( pos == sell.end( i[k] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Element could not be found\n"
+                << " Details:\n"
+                << "   Required position = (" << i[k] << "," << j[k] << ")\n"
+                << "   Current matrix:\n" << sell << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         else if( pos->index() != j[k] || pos->value() != v[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong element found\n"
+                << " Details:\n"
+                << "   Required index = " << j[k] << "\n"
+                << "   Found index    = " << pos->index() << "\n"
+                << "   Expected value = " << v[k] << "\n"
+                << "   Value at index = " << pos->value() << "\n"
+                << "   Current matrix:\n" << sell << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Searching for non-existing elements
+   {
+      const size_t i[4] = { 0UL, 1UL, 2UL, 4UL };
+      const size_t j[4] = { 0UL, 1UL, 4UL, 4UL };
+
+      for( size_t k=0UL; k<4UL; ++k )
+      {
+         const ConstIterator pos( sell.find( i[k], j[k] ) );
+
+         if( pos != sell.end( i[k] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Non-existing element could be found\n"
+                << " Details:\n"
+                << "   Required position = (" << i[k] << "," << j[k] << ")\n"
+                << "   Found index       = " << pos->index() << "\n"
+                << "   Current matrix:\n" << sell << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c lowerBound() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c lowerBound() member function of the SellMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLowerBound()
+{
+   test_ = "SellMatrix::lowerBound()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   CMT mat( 5UL, 6UL );
+   mat(0,1) =  1;
+   mat(0,4) =  2;
+   mat(2,0) =  3;
+   mat(2,2) =  4;
+   mat(2,3) =  5;
+   mat(2,5) =  6;
+   mat(4,5) = -7;
+
+   const MT sell( mat, 5UL );
+
+   // Determining the lower bound for existing and non-existing elements
+   {
+      const size_t i[7] = { 0UL, 0UL, 2UL, 2UL, 2UL, 2UL, 4UL };
+      const size_t j[7] = { 0UL, 2UL, 1UL, 2UL, 4UL, 5UL, 0UL };
+      const size_t x[7] = { 1UL, 4UL, 2UL, 2UL, 5UL, 5UL, 5UL };
+      const int    v[7] = { 1, 2, 4, 4, 6, 6, -7 };
+
+      for( size_t k=0UL; k<7UL; ++k )
+      {
+         const ConstIterator pos( sell.lowerBound( i[k], j[k] ) );
+
+         if( pos == sell.end( i[k] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Lower bound could not be determined\n"
+                << " Details:\n"
+                << "   Required position = (" << i[k] << "," << j[k] << ")\n"
+                << "   Current matrix:\n" << sell << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         else if( pos->index() != x[k] || pos->value() != v[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong element found\n"
+                << " Details:\n"
+                << "   Required position = (" << i[k] << "," << j[k] << ")\n"
+                << "   Expected index    = " << x[k] << "\n"
+                << "   Found index       = " << pos->index() << "\n"
+                << "   Expected value    = " << v[k] << "\n"
+                << "   Value at index    = " << pos->value() << "\n"
+                << "   Current matrix:\n" << sell << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Determining the lower bound behind the last element of a row
+   {
+      if( sell.lowerBound( 0UL, 5UL ) != sell.end( 0UL ) ||
+          sell.lowerBound( 1UL, 0UL ) != sell.end( 1UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Lower bound behind the last element is not the end of the row\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << sell << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c upperBound() member function of the SellMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c upperBound() member function of the SellMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testUpperBound()
+{
+   test_ = "SellMatrix::upperBound()";
+
+   typedef MT::ConstIterator  ConstIterator;
+
+   CMT mat( 5UL, 6UL );
+   mat(0,1) =  1;
+   mat(0,4) =  2;
+   mat(2,0) =  3;
+   mat(2,2) =  4;
+   mat(2,3) =  5;
+   mat(2,5) =  6;
+   mat(4,5) = -7;
+
+   const MT sell( mat, 5UL );
+
+   // Determining the upper bound for existing and non-existing elements
+   {
+      const size_t i[6] = { 0UL, 0UL, 2UL, 2UL, 2UL, 4UL };
+      const size_t j[6] = { 0UL, 1UL, 0UL, 2UL, 4UL, 4UL };
+      const size_t x[6] = { 1UL, 4UL, 2UL, 3UL, 5UL, 5UL };
+      const int    v[6] = { 1, 2, 4, 5, 6, -7 };
+
+      for( size_t k=0UL; k<6UL; ++k )
+      {
+         const ConstIterator pos( sell.upperBound( i[k], j[k] ) );
+
+         if( pos == sell.end( i[k] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Upper bound could not be determined\n"
+                << " Details:\n"
+                << "   Required position = (" << i[k] << "," << j[k] << ")\n"
+                << "   Current matrix:\n" << sell << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         else if( pos->index() != x[k] || pos->value() != v[k] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Wrong element found\n"
+                << " Details:\n"
+                << "   Required position = (" << i[k] << "," << j[k] << ")\n"
+                << "   Expected index    = " << x[k] << "\n"
+                << "   Found index       = " << pos->index() << "\n"
+                << "   Expected value    = " << v[k] << "\n"
+                << "   Value at index    = " << pos->value() << "\n"
+                << "   Current matrix:\n" << sell << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   // Determining the upper bound of the last element of a row
+   {
+      if( sell.upperBound( 0UL, 4UL ) != sell.end( 0UL ) ||
+          sell.upperBound( 2UL, 5UL ) != sell.end( 2UL ) ||
+          sell.upperBound( 4UL, 5UL ) != sell.end( 4UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Upper bound of the last element is not the end of the row\n"
+             << " Details:\n"
+             << "   Current matrix:\n" << sell << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SellMatrix/dense vector multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the multiplication of SELL-C-sigma matrices with dense
+// vectors for various element types and sorting scopes, including the addition and subtraction
+// assignment, compound expressions, non-finite vector elements in the positions of padding
+// elements and matrices beyond the SMP threshold. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMult()
+{
+   //=====================================================================================
+   // Multiplication assignment
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix multiplication assignment (int)";
+
+      CMT mat( 5UL, 6UL );
+      mat(0,1) =  1;
+      mat(0,4) =  2;
+      mat(2,0) =  3;
+      mat(2,2) =  4;
+      mat(2,3) =  5;
+      mat(2,5) =  6;
+      mat(4,5) = -7;
+
+      const MT sell( mat, 2UL );
+
+      const blaze::DynamicVector<int,blaze::columnVector> x{ 1, 2, 3, 4, 5, 6 };
+      blaze::DynamicVector<int,blaze::columnVector> y( 2UL );
+
+      y = sell * x;
+
+      if( y.size() != 5UL || y[0] != 12 || y[1] != 0 || y[2] != 71 || y[3] != 0 || y[4] != -42 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 12 0 71 0 -42 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix multiplication assignment (double)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> mat( 5UL, 6UL );
+      mat(0,1) =  1.0;
+      mat(0,4) =  2.0;
+      mat(2,0) =  3.0;
+      mat(2,2) =  4.0;
+      mat(2,3) =  5.0;
+      mat(2,5) =  6.0;
+      mat(4,5) = -7.0;
+
+      const blaze::DynamicVector<double,blaze::columnVector> x{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+
+      for( size_t sigma=1UL; sigma<=5UL; sigma+=4UL )
+      {
+         const DMT sell( mat, sigma );
+
+         blaze::DynamicVector<double,blaze::columnVector> y;
+         y = sell * x;
+
+         if( y.size() != 5UL || y[0] != 12.0 || y[1] != 0.0 || y[2] != 71.0 ||
+             y[3] != 0.0 || y[4] != -42.0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Sorting scope: " << sigma << "\n"
+                << "   Result:\n" << y << "\n"
+                << "   Expected result:\n( 12 0 71 0 -42 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "SellMatrix multiplication assignment (complex)";
+
+      blaze::CompressedMatrix<cdouble,blaze::rowMajor> mat( 3UL, 4UL );
+      mat(0,1) = cdouble( 1.0, 1.0 );
+      mat(2,0) = cdouble( 2.0, 0.0 );
+      mat(2,3) = cdouble( 0.0, 2.0 );
+
+      const blaze::SellMatrix<cdouble> sell( mat );
+
+      const blaze::DynamicVector<cdouble,blaze::columnVector> x{ 1.0, 2.0, 3.0, 4.0 };
+      blaze::DynamicVector<cdouble,blaze::columnVector> y;
+
+      y = sell * x;
+
+      if( y.size() != 3UL || y[0] != cdouble( 2.0, 2.0 ) || y[1] != cdouble() ||
+          y[2] != cdouble( 2.0, 8.0 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( (2,2) (0,0) (2,8) )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Addition and subtraction assignment
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix multiplication addition assignment";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> mat( 5UL, 6UL );
+      mat(0,1) =  1.0;
+      mat(0,4) =  2.0;
+      mat(2,0) =  3.0;
+      mat(2,2) =  4.0;
+      mat(2,3) =  5.0;
+      mat(2,5) =  6.0;
+      mat(4,5) = -7.0;
+
+      const DMT sell( mat, 5UL );
+
+      const blaze::DynamicVector<double,blaze::columnVector> x{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+      blaze::DynamicVector<double,blaze::columnVector> y{ 1.0, 1.0, 1.0, 1.0, 1.0 };
+
+      y += sell * x;
+
+      if( y[0] != 13.0 || y[1] != 1.0 || y[2] != 72.0 || y[3] != 1.0 || y[4] != -41.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Addition assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 13 1 72 1 -41 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix multiplication subtraction assignment";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> mat( 5UL, 6UL );
+      mat(0,1) =  1.0;
+      mat(0,4) =  2.0;
+      mat(2,0) =  3.0;
+      mat(2,2) =  4.0;
+      mat(2,3) =  5.0;
+      mat(2,5) =  6.0;
+      mat(4,5) = -7.0;
+
+      const DMT sell( mat, 5UL );
+
+      const blaze::DynamicVector<double,blaze::columnVector> x{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+      blaze::DynamicVector<double,blaze::columnVector> y{ 1.0, 1.0, 1.0, 1.0, 1.0 };
+
+      y -= sell * x;
+
+      if( y[0] != -11.0 || y[1] != 1.0 || y[2] != -70.0 || y[3] != 1.0 || y[4] != 43.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Subtraction assignment failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( -11 1 -70 1 43 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Compound expressions
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix multiplication within a compound expression";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> mat( 5UL, 6UL );
+      mat(0,1) =  1.0;
+      mat(0,4) =  2.0;
+      mat(2,0) =  3.0;
+      mat(2,2) =  4.0;
+      mat(2,3) =  5.0;
+      mat(2,5) =  6.0;
+      mat(4,5) = -7.0;
+
+      const DMT sell( mat, 5UL );
+
+      const blaze::DynamicVector<double,blaze::columnVector> x{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+      const blaze::DynamicVector<double,blaze::columnVector> z{ 1.0, 2.0, 3.0, 4.0, 5.0 };
+
+      const blaze::DynamicVector<double,blaze::columnVector> y( 2.0 * ( sell * x ) + z );
+
+      if( y[0] != 25.0 || y[1] != 2.0 || y[2] != 145.0 || y[3] != 4.0 || y[4] != -79.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 25 2 145 4 -79 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "SellMatrix multiplication assignment to a subvector";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> mat( 5UL, 6UL );
+      mat(0,1) =  1.0;
+      mat(0,4) =  2.0;
+      mat(2,0) =  3.0;
+      mat(2,2) =  4.0;
+      mat(2,3) =  5.0;
+      mat(2,5) =  6.0;
+      mat(4,5) = -7.0;
+
+      const DMT sell( mat, 5UL );
+
+      const blaze::DynamicVector<double,blaze::columnVector> x{ 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+      blaze::DynamicVector<double,blaze::columnVector> y( 7UL, 1.0 );
+
+      subvector( y, 1UL, 5UL ) = sell * subvector( x, 0UL, 6UL );
+
+      if( y[0] != 1.0 || y[1] != 12.0 || y[2] != 0.0 || y[3] != 71.0 ||
+          y[4] != 0.0 || y[5] != -42.0 || y[6] != 1.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 1 12 0 71 0 -42 1 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Padding elements
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix multiplication (non-finite vector element)";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> mat( 9UL, 4UL );
+      mat(0,1) = 1.0;
+      mat(0,2) = 1.0;
+      mat(0,3) = 1.0;
+      mat(1,1) = 2.0;
+      mat(8,3) = 3.0;
+
+      const DMT sell( mat );
+
+      const blaze::DynamicVector<double,blaze::columnVector> x{
+         std::numeric_limits<double>::infinity(), 1.0, 1.0, 1.0 };
+
+      const blaze::DynamicVector<double,blaze::columnVector> y( sell * x );
+
+      if( y[0] != 3.0 || y[1] != 2.0 || y[2] != 0.0 || y[3] != 0.0 || y[4] != 0.0 ||
+          y[5] != 0.0 || y[6] != 0.0 || y[7] != 0.0 || y[8] != 3.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Padding elements affect the result\n"
+             << " Details:\n"
+             << "   Result:\n" << y << "\n"
+             << "   Expected result:\n( 3 2 0 0 0 0 0 0 3 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Large matrices
+   //=====================================================================================
+
+   {
+      test_ = "SellMatrix multiplication (large matrix, double)";
+
+      // Row i contains the elements t+1 at the columns (7*i+13*t)%1009 for t < i%9
+      const size_t m( 20011UL );
+      const size_t n( 1009UL );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> mat( m, n );
+      mat.reserve( 4UL*m );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t t=0UL; t<i%9UL; ++t ) {
+            mat(i,(7UL*i+13UL*t)%n) = double( t+1UL );
+         }
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> x( n );
+      for( size_t j=0UL; j<n; ++j ) {
+         x[j] = double( j%5UL+1UL );
+      }
+
+      for( size_t sigma=1UL; sigma<=m; sigma*=64UL )
+      {
+         const DMT sell( mat, sigma );
+
+         blaze::DynamicVector<double,blaze::columnVector> y( m, 1.0 );
+         y += sell * x;
+
+         for( size_t i=0UL; i<m; ++i )
+         {
+            double expected( 1.0 );
+            for( size_t t=0UL; t<i%9UL; ++t ) {
+               expected += double( t+1UL ) * double( ( (7UL*i+13UL*t)%n )%5UL+1UL );
+            }
+
+            if( y[i] != expected ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Multiplication failed\n"
+                   << " Details:\n"
+                   << "   Sorting scope: " << sigma << "\n"
+                   << "   Row: " << i << "\n"
+                   << "   Result: " << y[i] << "\n"
+                   << "   Expected value: " << expected << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+   }
+
+   {
+      test_ = "SellMatrix multiplication (large matrix, float)";
+
+      // Row i contains the elements t+1 at the columns (5*i+11*t)%211 for t < i%7
+      const size_t m( 4099UL );
+      const size_t n( 211UL );
+
+      blaze::CompressedMatrix<float,blaze::rowMajor> mat( m, n );
+      mat.reserve( 3UL*m );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t t=0UL; t<i%7UL; ++t ) {
+            mat(i,(5UL*i+11UL*t)%n) = float( t+1UL );
+         }
+      }
+
+      blaze::DynamicVector<float,blaze::columnVector> x( n );
+      for( size_t j=0UL; j<n; ++j ) {
+         x[j] = float( j%3UL+1UL );
+      }
+
+      const blaze::SellMatrix<float> sell( mat, 256UL );
+
+      const blaze::DynamicVector<float,blaze::columnVector> y( sell * x );
+
+      for( size_t i=0UL; i<m; ++i )
+      {
+         float expected( 0.0F );
+         for( size_t t=0UL; t<i%7UL; ++t ) {
+            expected += float( t+1UL ) * float( ( (5UL*i+11UL*t)%n )%3UL+1UL );
+         }
+
+         if( y[i] != expected ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Multiplication failed\n"
+                << " Details:\n"
+                << "   Row: " << i << "\n"
+                << "   Result: " << y[i] << "\n"
+                << "   Expected value: " << expected << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace sellmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SellMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_SELLMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SellMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
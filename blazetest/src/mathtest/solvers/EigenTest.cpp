@@ -0,0 +1,462 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/EigenTest.cpp
+//  \brief Source file for the eigenvalue solver test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/SparseDecomposition.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blazetest/mathtest/solvers/EigenTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the eigenvalue solver test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+EigenTest::EigenTest()
+{
+   testLanczos();
+   testArnoldi();
+   testShiftInvert();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the thick-restart Lanczos method.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the lanczos() function for real symmetric and complex Hermitian matrices,
+// symmetric adaptors, and matrix-free operators. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void EigenTest::testLanczos()
+{
+   using blaze::largestMagnitude;
+   using blaze::largestReal;
+   using blaze::smallestReal;
+
+   const double pi( 3.14159265358979323846 );
+
+   {
+      test_ = "Lanczos method for the largest eigenvalues of the 1D Laplace operator";
+
+      const size_t n( 400UL );
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( n ) );
+
+      blaze::DynamicVector<double,blaze::columnVector> w, ref( 6UL );
+      blaze::DynamicMatrix<double,blaze::columnMajor> V;
+      blaze::SolverControl control( 500UL, 1E-10 );
+
+      for( size_t j=0UL; j<6UL; ++j ) {
+         ref[j] = 2.0 - 2.0*std::cos( double( n-j ) * pi / double( n+1UL ) );
+      }
+
+      blaze::lanczos( A, w, V, 6UL, control, largestReal );
+
+      checkEigenvalues( A, w, ref, control, 1E-8 );
+      checkEigenvectors( A, w, V, 1E-6 );
+   }
+
+   {
+      test_ = "Lanczos method for the smallest eigenvalues of the 1D Laplace operator";
+
+      const size_t n( 100UL );
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( n ) );
+
+      blaze::DynamicVector<double,blaze::columnVector> w, ref( 4UL );
+      blaze::DynamicMatrix<double,blaze::columnMajor> V;
+      blaze::SolverControl control( 1000UL, 1E-10 );
+
+      for( size_t j=0UL; j<4UL; ++j ) {
+         ref[j] = 2.0 - 2.0*std::cos( double( j+1UL ) * pi / double( n+1UL ) );
+      }
+
+      blaze::lanczos( A, w, V, 4UL, control, smallestReal, 40UL );
+
+      checkEigenvalues( A, w, ref, control, 1E-9 );
+      checkEigenvectors( A, w, V, 1E-6 );
+   }
+
+   {
+      test_ = "Lanczos method for a small matrix with invariant Krylov subspace";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 8UL ) );
+
+      blaze::DynamicVector<double,blaze::columnVector> w;
+      blaze::DynamicMatrix<double,blaze::columnMajor> V;
+      blaze::SolverControl control( 10UL, 1E-12 );
+
+      blaze::lanczos( A, w, V, 8UL, control, smallestReal );
+
+      checkEigenvalues( A, w, select( symmetricSpectrum( A ), 8UL, smallestReal ), control, 1E-12 );
+      checkEigenvectors( A, w, V, 1E-10 );
+   }
+
+   {
+      test_ = "Lanczos method for a complex Hermitian matrix";
+
+      const blaze::CompressedMatrix<cdouble,blaze::rowMajor> A( hermitian( 12UL ) );
+
+      blaze::DynamicVector<double,blaze::columnVector> w;
+      blaze::DynamicMatrix<cdouble,blaze::columnMajor> V;
+      blaze::SolverControl control( 500UL, 1E-10 );
+
+      blaze::lanczos( A, w, V, 5UL, control );
+
+      checkEigenvalues( A, w, select( symmetricSpectrum( A ), 5UL, largestMagnitude ), control, 1E-8 );
+      checkEigenvectors( A, w, V, 1E-6 );
+   }
+
+   {
+      test_ = "Lanczos method for a symmetric sparse adaptor";
+
+      const blaze::SymmetricMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > A( laplace2( 15UL ) );
+
+      blaze::DynamicVector<double,blaze::columnVector> w;
+      blaze::DynamicMatrix<double,blaze::columnMajor> V;
+      blaze::SolverControl control( 500UL, 1E-10 );
+
+      blaze::lanczos( A, w, V, 3UL, control, largestReal );
+
+      checkEigenvalues( A, w, select( symmetricSpectrum( A ), 3UL, largestReal ), control, 1E-8 );
+      checkEigenvectors( A, w, V, 1E-6 );
+   }
+
+   {
+      test_ = "Lanczos method for a matrix-free operator";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace2( 12UL ) );
+      auto op = [&A]( auto& y, const auto& x ) { y = A * x; };
+
+      blaze::DynamicVector<double,blaze::columnVector> w;
+      blaze::DynamicMatrix<double,blaze::columnMajor> V( A.rows(), 1UL, 1.0 );
+      blaze::SolverControl control( 500UL, 1E-10 );
+
+      blaze::lanczos( op, w, V, 4UL, control, largestReal, 30UL );
+
+      checkEigenvalues( A, w, select( symmetricSpectrum( A ), 4UL, largestReal ), control, 1E-8 );
+      checkEigenvectors( A, w, V, 1E-6 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the restarted Arnoldi method.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the arnoldi() function for real and complex nonsymmetric matrices. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void EigenTest::testArnoldi()
+{
+   using blaze::largestMagnitude;
+   using blaze::largestReal;
+   using blaze::smallestReal;
+
+   {
+      test_ = "Arnoldi method for a real nonsymmetric matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( 14UL ) );
+
+      blaze::DynamicVector<cdouble,blaze::columnVector> w;
+      blaze::DynamicMatrix<cdouble,blaze::columnMajor> V;
+      blaze::SolverControl control( 500UL, 1E-10 );
+
+      blaze::arnoldi( A, w, V, 4UL, control, largestReal );
+
+      checkEigenvalues( A, w, select( generalSpectrum( A ), 4UL, largestReal ), control, 1E-8 );
+      checkEigenvectors( A, w, V, 1E-6 );
+   }
+
+   {
+      test_ = "Arnoldi method for a real matrix with complex eigenvalues";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 120UL, 120UL );
+
+      for( size_t i=0UL; i<60UL; ++i ) {
+         const double a( 1.0 + 0.05*double(i) );
+         const double b( 0.5 + 0.01*double(i) );
+         A(2UL*i    ,2UL*i    ) =  a;
+         A(2UL*i    ,2UL*i+1UL) =  b;
+         A(2UL*i+1UL,2UL*i    ) = -b;
+         A(2UL*i+1UL,2UL*i+1UL) =  a;
+         if( i > 0UL ) A(2UL*i,2UL*i-1UL) = 0.1;
+      }
+
+      blaze::DynamicVector<cdouble,blaze::columnVector> w;
+      blaze::DynamicMatrix<cdouble,blaze::columnMajor> V;
+      blaze::SolverControl control( 500UL, 1E-10 );
+
+      blaze::arnoldi( A, w, V, 6UL, control, largestMagnitude );
+
+      checkEigenvalues( A, w, select( generalSpectrum( A ), 6UL, largestMagnitude ), control, 1E-8 );
+      checkEigenvectors( A, w, V, 1E-6 );
+   }
+
+   {
+      test_ = "Arnoldi method for a complex nonsymmetric matrix";
+
+      const blaze::CompressedMatrix<cdouble,blaze::rowMajor> A( convection<cdouble>( 12UL ) );
+
+      blaze::DynamicVector<cdouble,blaze::columnVector> w;
+      blaze::DynamicMatrix<cdouble,blaze::columnMajor> V;
+      blaze::SolverControl control( 500UL, 1E-10 );
+
+      blaze::arnoldi( A, w, V, 4UL, control, smallestReal );
+
+      checkEigenvalues( A, w, select( generalSpectrum( A ), 4UL, smallestReal ), control, 1E-8 );
+      checkEigenvectors( A, w, V, 1E-6 );
+   }
+
+   {
+      test_ = "Arnoldi method for a matrix-free operator";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( 10UL ) );
+      auto op = [&A]( auto& y, const auto& x ) { y = A * x; };
+
+      blaze::DynamicVector<cdouble,blaze::columnVector> w;
+      blaze::DynamicMatrix<cdouble,blaze::columnMajor> V( A.rows(), 1UL, cdouble( 1.0, 0.0 ) );
+      blaze::SolverControl control( 500UL, 1E-10 );
+
+      blaze::arnoldi( op, w, V, 3UL, control, largestReal );
+
+      checkEigenvalues( A, w, select( generalSpectrum( A ), 3UL, largestReal ), control, 1E-8 );
+      checkEigenvectors( A, w, V, 1E-6 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the shift-invert operator.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the computation of interior eigenvalues by means of the ShiftInvert
+// operator in combination with a sparse direct solver. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void EigenTest::testShiftInvert()
+{
+   {
+      test_ = "Lanczos method with shift-invert operator";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace2( 20UL ) );
+      const double sigma( 2.05 );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> S( A );
+      for( size_t i=0UL; i<S.rows(); ++i ) {
+         S(i,i) -= sigma;
+      }
+
+      const blaze::SparseLDLH<double> solver( S );
+
+      blaze::DynamicVector<double,blaze::columnVector> w;
+      blaze::DynamicMatrix<double,blaze::columnMajor> V;
+      blaze::SolverControl control( 100UL, 1E-10 );
+
+      blaze::lanczos( blaze::shiftInvert( solver, sigma ), w, V, 5UL, control );
+
+      blaze::DynamicVector<double,blaze::columnVector> ref( symmetricSpectrum( A ) );
+      for( size_t i=0UL; i<ref.size(); ++i ) {
+         ref[i] = 1.0 / ( ref[i] - sigma );
+      }
+
+      ref = select( ref, 5UL, blaze::largestMagnitude );
+
+      for( size_t i=0UL; i<ref.size(); ++i ) {
+         ref[i] = sigma + 1.0 / ref[i];
+      }
+
+      checkEigenvalues( A, w, ref, control, 1E-10 );
+      checkEigenvectors( A, w, V, 1E-8 );
+   }
+
+   {
+      test_ = "Arnoldi method with shift-invert operator";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace2( 12UL ) );
+      const double sigma( 1.3 );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> S( A );
+      for( size_t i=0UL; i<S.rows(); ++i ) {
+         S(i,i) -= sigma;
+      }
+
+      const blaze::SparseLDLH<double> solver( S );
+
+      blaze::DynamicVector<cdouble,blaze::columnVector> w;
+      blaze::DynamicMatrix<cdouble,blaze::columnMajor> V;
+      blaze::SolverControl control( 100UL, 1E-10 );
+
+      blaze::arnoldi( blaze::shiftInvert( solver, sigma ), w, V, 3UL, control );
+
+      blaze::DynamicVector<double,blaze::columnVector> ref( symmetricSpectrum( A ) );
+      for( size_t i=0UL; i<ref.size(); ++i ) {
+         ref[i] = 1.0 / ( ref[i] - sigma );
+      }
+
+      ref = select( ref, 3UL, blaze::largestMagnitude );
+
+      for( size_t i=0UL; i<ref.size(); ++i ) {
+         ref[i] = sigma + 1.0 / ref[i];
+      }
+
+      checkEigenvalues( A, w, ref, control, 1E-10 );
+      checkEigenvectors( A, w, V, 1E-8 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the eigenvalue solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the eigenvalue solvers reject invalid arguments. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void EigenTest::testErrors()
+{
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 10UL ) );
+
+   blaze::DynamicVector<double,blaze::columnVector> w;
+   blaze::DynamicMatrix<double,blaze::columnMajor> V;
+   blaze::SolverControl control;
+
+   const auto fails = [&]( auto&& call, const char* label )
+   {
+      test_ = label;
+
+      try {
+         call();
+      }
+      catch( std::invalid_argument& ) {
+         return;
+      }
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid argument not detected\n";
+      throw std::runtime_error( oss.str() );
+   };
+
+   fails( [&]() { blaze::lanczos( blaze::CompressedMatrix<double>( 3UL, 4UL ), w, V, 1UL, control ); },
+          "Eigenvalues of a non-square matrix" );
+
+   fails( [&]() { blaze::lanczos( A, w, V, 0UL, control ); },
+          "Zero requested eigenvalues" );
+
+   fails( [&]() { blaze::lanczos( A, w, V, 11UL, control ); },
+          "Too many requested eigenvalues" );
+
+   fails( [&]() { blaze::lanczos( A, w, V, 3UL, control, blaze::largestReal, 4UL ); },
+          "Too small subspace dimension" );
+
+   fails( [&]() { blaze::lanczos( A, w, V, 3UL, control, blaze::largestReal, 11UL ); },
+          "Too large subspace dimension" );
+
+   fails( [&]() { blaze::lanczos( [&A]( auto& y, const auto& x ) { y = A * x; }, w, V, 3UL, control ); },
+          "Matrix-free operator without starting vector" );
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running eigenvalue solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_EIGEN_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during eigenvalue solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
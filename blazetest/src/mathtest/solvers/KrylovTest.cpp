@@ -0,0 +1,608 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/KrylovTest.cpp
+//  \brief Source file for the Krylov solver test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blazetest/mathtest/solvers/KrylovTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Krylov solver test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+KrylovTest::KrylovTest()
+{
+   testControl();
+   testCG();
+   testBiCGSTAB();
+   testGMRES();
+   testMINRES();
+   testInitialGuess();
+   testErrors();
+   testParallel();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the SolverControl class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the settings and the stopping criterion of the SolverControl class. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testControl()
+{
+   test_ = "SolverControl stopping criterion";
+
+   blaze::SolverControl control( 10UL, 1E-2, 1E-3 );
+
+   if( control.maxIterations() != 10UL || control.tolerance() != 1E-2 ||
+       control.absTolerance() != 1E-3 || control.iterations() != 0UL || control.converged() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( control.start( 1.0, 0.5 ) || !control.check( 3UL, 0.01 ) || control.iterations() != 3UL ||
+       control.residual() != 0.01 || control.reference() != 1.0 || !control.converged() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Relative stopping criterion failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( control.start( 0.0, 2E-3 ) || !control.check( 1UL, 1E-3 ) || control.exhausted( 9UL ) ||
+       !control.exhausted( 10UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Absolute stopping criterion failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   try {
+      control.setTolerance( -1.0 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Setting a negative tolerance succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the conjugate gradient method.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves symmetric positive definite systems by means of the cg() function with
+// sparse, dense, and adapted system matrices, a matrix-free operator, and a Jacobi preconditioner.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testCG()
+{
+   {
+      test_ = "CG with a sparse matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 17UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-10 );
+      cg( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-9 );
+   }
+
+   {
+      test_ = "CG with a single precision sparse matrix";
+
+      const blaze::CompressedMatrix<float,blaze::rowMajor> A( laplace<float>( 11UL ) );
+      const blaze::DynamicVector<float,blaze::columnVector> b( rhs<float>( A.rows() ) );
+      blaze::DynamicVector<float,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-5 );
+      cg( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-4 );
+   }
+
+   {
+      test_ = "CG with a symmetric dense matrix";
+
+      const blaze::SymmetricMatrix< blaze::DynamicMatrix<double,blaze::columnMajor> > A( laplace<double>( 6UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-10 );
+      cg( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-9 );
+   }
+
+   {
+      test_ = "CG with a Hermitian complex matrix";
+
+      blaze::DynamicMatrix<cdouble,blaze::rowMajor> A( 40UL, 40UL, cdouble() );
+      for( size_t i=0UL; i<40UL; ++i ) {
+         A(i,i) = cdouble( 4.0, 0.0 );
+         if( i > 0UL ) {
+            A(i,i-1UL) = cdouble( -1.0,  0.5 );
+            A(i-1UL,i) = cdouble( -1.0, -0.5 );
+         }
+      }
+
+      const blaze::DynamicVector<cdouble,blaze::columnVector> b( rhs<cdouble>( 40UL ) );
+      blaze::DynamicVector<cdouble,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-10 );
+      cg( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-9 );
+   }
+
+   {
+      test_ = "CG with a matrix-free operator and a Jacobi preconditioner";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 13UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( A.rows() ) );
+      const blaze::DynamicVector<double,blaze::columnVector> d( A.rows(), 0.25 );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-10 );
+      cg( [&A]( auto& y, const auto& v ) { y = A * v; }, x, b, control,
+          [&d]( auto& z, const auto& r ) { z = d * r; } );
+
+      checkSolution( A, x, b, control, 1E-9 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BiCGSTAB method.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves non-symmetric systems by means of the bicgstab() function with real and
+// complex system matrices and a Jacobi preconditioner. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testBiCGSTAB()
+{
+   for( size_t n=1UL; n<40UL; n+=3UL )
+   {
+      test_ = "BiCGSTAB with a sparse matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( n ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( n ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-10 );
+      bicgstab( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-9 );
+   }
+
+   {
+      test_ = "BiCGSTAB with a complex matrix";
+
+      const blaze::CompressedMatrix<cdouble,blaze::rowMajor> A( convection<cdouble>( 77UL ) + cdouble( 0.0, 1.0 ) * blaze::IdentityMatrix<cdouble>( 77UL ) );
+      const blaze::DynamicVector<cdouble,blaze::columnVector> b( rhs<cdouble>( 77UL ) );
+      blaze::DynamicVector<cdouble,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-10 );
+      bicgstab( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-9 );
+   }
+
+   {
+      test_ = "BiCGSTAB with a Jacobi preconditioner";
+
+      const blaze::CompressedMatrix<float,blaze::rowMajor> A( convection<float>( 211UL ) );
+      const blaze::DynamicVector<float,blaze::columnVector> b( rhs<float>( 211UL ) );
+      blaze::DynamicVector<float,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-5 );
+      bicgstab( A, x, b, control, []( auto& z, const auto& r ) { z = 0.25F * r; } );
+
+      checkSolution( A, x, b, control, 1E-4 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the restarted GMRES method.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves non-symmetric systems by means of the gmres() function with different
+// restart lengths, real and complex system matrices, and a Jacobi preconditioner. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testGMRES()
+{
+   for( size_t n=1UL; n<40UL; n+=3UL )
+   {
+      test_ = "GMRES with a sparse matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( n ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( n ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-10 );
+      gmres( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-9 );
+   }
+
+   for( size_t restart=1UL; restart<12UL; restart+=5UL )
+   {
+      test_ = "GMRES with a short restart length";
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> A( convection<double>( 97UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( 97UL ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl control( 1000UL, 1E-10 );
+      gmres( A, x, b, control, blaze::IdentityPreconditioner(), restart );
+
+      checkSolution( A, x, b, control, 1E-9 );
+   }
+
+   {
+      test_ = "GMRES with a complex matrix";
+
+      const blaze::CompressedMatrix<cdouble,blaze::rowMajor> A( convection<cdouble>( 77UL ) + cdouble( 0.0, 1.0 ) * blaze::IdentityMatrix<cdouble>( 77UL ) );
+      const blaze::DynamicVector<cdouble,blaze::columnVector> b( rhs<cdouble>( 77UL ) );
+      blaze::DynamicVector<cdouble,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-10 );
+      gmres( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-9 );
+   }
+
+   {
+      test_ = "GMRES with a Jacobi preconditioner";
+
+      const blaze::CompressedMatrix<float,blaze::rowMajor> A( convection<float>( 211UL ) );
+      const blaze::DynamicVector<float,blaze::columnVector> b( rhs<float>( 211UL ) );
+      blaze::DynamicVector<float,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-5 );
+      gmres( A, x, b, control, []( auto& z, const auto& r ) { z = 0.25F * r; }, 10UL );
+
+      checkSolution( A, x, b, control, 1E-4 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the MINRES method.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves symmetric indefinite systems by means of the minres() function with
+// real and complex system matrices and a Jacobi preconditioner. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testMINRES()
+{
+   for( size_t n=1UL; n<40UL; n+=3UL )
+   {
+      test_ = "MINRES with a symmetric indefinite matrix";
+
+      const blaze::SymmetricMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > A( indefinite<double>( n ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( n ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-10 );
+      minres( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-9 );
+   }
+
+   {
+      test_ = "MINRES with a Hermitian indefinite matrix";
+
+      blaze::DynamicMatrix<cdouble,blaze::rowMajor> A( indefinite<cdouble>( 64UL ) );
+      for( size_t i=1UL; i<64UL; ++i ) {
+         A(i,i-1UL) = cdouble( -1.0,  0.5 );
+         A(i-1UL,i) = cdouble( -1.0, -0.5 );
+      }
+
+      const blaze::DynamicVector<cdouble,blaze::columnVector> b( rhs<cdouble>( 64UL ) );
+      blaze::DynamicVector<cdouble,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-10 );
+      minres( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-9 );
+   }
+
+   {
+      test_ = "MINRES with a Jacobi preconditioner";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( indefinite<double>( 301UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( 301UL ) );
+      blaze::DynamicVector<double,blaze::columnVector> d( 301UL );
+      for( size_t i=0UL; i<301UL; ++i ) {
+         d[i] = 1.0 / std::abs( A(i,i) );
+      }
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-10 );
+      minres( A, x, b, control, [&d]( auto& z, const auto& r ) { z = d * r; } );
+
+      checkSolution( A, x, b, control, 1E-8 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the handling of the initial guess.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that all solvers use the given values of the solution vector as initial
+// guess and stop immediately in case the initial guess already solves the system. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testInitialGuess()
+{
+   test_ = "Krylov solvers with an exact initial guess";
+
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 5UL ) );
+   const blaze::DynamicVector<double,blaze::columnVector> x0( rhs<double>( A.rows() ) );
+   const blaze::DynamicVector<double,blaze::columnVector> b( A * x0 );
+
+   blaze::SolverControl control( 100UL, 1E-10 );
+
+   for( size_t solver=0UL; solver<4UL; ++solver )
+   {
+      blaze::DynamicVector<double,blaze::columnVector> x( x0 );
+
+      switch( solver ) {
+         case 0UL: cg      ( A, x, b, control ); break;
+         case 1UL: bicgstab( A, x, b, control ); break;
+         case 2UL: gmres   ( A, x, b, control ); break;
+         default : minres  ( A, x, b, control ); break;
+      }
+
+      if( !control.converged() || control.iterations() != 0UL || x != x0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Initial guess not used\n"
+             << " Details:\n"
+             << "   Solver: " << solver << "\n"
+             << "   Iterations: " << control.iterations() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Krylov solvers with a fixed-size solution vector";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> B( convection<double>( 4UL ) );
+      const blaze::StaticVector<double,4UL,blaze::columnVector> c{ 1.0, 2.0, 3.0, 4.0 };
+      blaze::StaticVector<double,4UL,blaze::columnVector> x;
+
+      bicgstab( B, x, c, control );
+
+      checkSolution( B, x, c, control, 1E-9 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the Krylov solvers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the solvers reject non-square system matrices, right-hand side
+// vectors of invalid size, non-resizable solution vectors of invalid size, and an invalid
+// restart length. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void KrylovTest::testErrors()
+{
+   const blaze::CompressedMatrix<double,blaze::rowMajor> A( 5UL, 4UL );
+   const blaze::CompressedMatrix<double,blaze::rowMajor> B( convection<double>( 5UL ) );
+   const blaze::DynamicVector<double,blaze::columnVector> b( 5UL, 1.0 );
+   const blaze::DynamicVector<double,blaze::columnVector> c( 4UL, 1.0 );
+   blaze::DynamicVector<double,blaze::columnVector> x;
+   blaze::StaticVector<double,3UL,blaze::columnVector> y;
+
+   blaze::SolverControl control;
+
+   for( size_t error=0UL; error<4UL; ++error )
+   {
+      try {
+         switch( error ) {
+            case 0UL: test_ = "Krylov solver with a non-square matrix";
+                      cg( A, x, b, control );
+                      break;
+            case 1UL: test_ = "Krylov solver with an invalid right-hand side vector";
+                      minres( B, x, c, control );
+                      break;
+            case 2UL: test_ = "Krylov solver with a non-resizable solution vector";
+                      bicgstab( B, y, b, control );
+                      break;
+            default : test_ = "Krylov solver with an invalid restart length";
+                      gmres( B, x, b, control, blaze::IdentityPreconditioner(), 0UL );
+                      break;
+         }
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid solve succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Krylov solvers for large systems.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function solves large systems, whose vector kernels are executed in parallel in case a
+// parallelization is enabled. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void KrylovTest::testParallel()
+{
+   {
+      test_ = "CG with a large sparse matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 211UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl control( 2000UL, 1E-8 );
+      cg( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-7 );
+   }
+
+   {
+      test_ = "BiCGSTAB with a large sparse matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( 40009UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-10 );
+      bicgstab( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-9 );
+   }
+
+   {
+      test_ = "MINRES with a large sparse matrix";
+
+      const blaze::CompressedMatrix<float,blaze::rowMajor> A( indefinite<float>( 40009UL ) );
+      const blaze::DynamicVector<float,blaze::columnVector> b( rhs<float>( A.rows() ) );
+      blaze::DynamicVector<float,blaze::columnVector> x;
+
+      blaze::SolverControl control( 500UL, 1E-5 );
+      minres( A, x, b, control );
+
+      checkSolution( A, x, b, control, 1E-4 );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Krylov solver test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_KRYLOV_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Krylov solver test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,752 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/PreconditionerTest.cpp
+//  \brief Source file for the preconditioner test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/smp/SerialSection.h>
+#include <blazetest/mathtest/solvers/PreconditionerTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the preconditioner test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+PreconditionerTest::PreconditionerTest()
+{
+   testJacobi();
+   testBlockJacobi();
+   testSSOR();
+   testILU0();
+   testIC0();
+   testErrors();
+   testParallel();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the convergence of a preconditioned solve.
+//
+// \param control The convergence control of the preconditioned solve.
+// \param limit The number of iterations of the solve without preconditioner.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the preconditioned solve converged in fewer iterations than the
+// solve without preconditioner. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void PreconditionerTest::checkIterations( const blaze::SolverControl& control, size_t limit ) const
+{
+   if( !control.converged() || control.iterations() >= limit ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Preconditioned solve failed\n"
+          << " Details:\n"
+          << "   Converged: " << control.converged() << "\n"
+          << "   Iterations: " << control.iterations() << "\n"
+          << "   Iterations without preconditioner: " << limit << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the JacobiPreconditioner class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the application of the Jacobi preconditioner and its effect on the
+// conjugate gradient method for a badly scaled system. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void PreconditionerTest::testJacobi()
+{
+   {
+      test_ = "Jacobi preconditioner application";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( tridiagonal<double>( 25UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> r( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> z( A.rows() );
+
+      const blaze::JacobiPreconditioner<double> M( A );
+      M( z, r );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         if( std::abs( z[i] * A(i,i) - r[i] ) > 1E-14 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Application failed\n"
+                << " Details:\n"
+                << "   Result:\n" << z << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "CG with a Jacobi preconditioner";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 15UL ) );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+            element->value() *= double( 1UL + i%7UL ) * double( 1UL + element->index()%7UL );
+         }
+      }
+
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl plain( 1000UL, 1E-10 );
+      cg( A, x, b, plain );
+
+      x.clear();
+      blaze::SolverControl control( 1000UL, 1E-10 );
+      cg( A, x, b, control, blaze::JacobiPreconditioner<double>( A ) );
+
+      checkIterations( control, plain.iterations() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the BlockJacobiPreconditioner class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the block-Jacobi preconditioner for block diagonal matrices (for which the
+// preconditioner is exact) and its effect on the GMRES method. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void PreconditionerTest::testBlockJacobi()
+{
+   {
+      test_ = "Block-Jacobi preconditioner with block size 1";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( 30UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> r( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> z1( A.rows() ), z2( A.rows() );
+
+      const blaze::JacobiPreconditioner<double> M1( A );
+      const blaze::BlockJacobiPreconditioner<double> M2( A, 1UL );
+
+      M1( z1, r );
+      M2( z2, r );
+
+      if( max( abs( z1 - z2 ) ) > 1E-14 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Application failed\n"
+             << " Details:\n"
+             << "   Result:\n" << z2 << "\n"
+             << "   Expected result:\n" << z1 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t n=1UL; n<40UL; n+=5UL )
+   {
+      test_ = "Block-Jacobi preconditioner of a block diagonal matrix";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( n ) );
+      for( size_t i=0UL; i<n; ++i ) {
+         for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+            if( i/4UL != element->index()/4UL ) element->value() = 0.0;
+         }
+      }
+
+      checkExact( A, blaze::BlockJacobiPreconditioner<double>( A, 4UL ), 1E-13 );
+   }
+
+   {
+      test_ = "Block-Jacobi preconditioner of a dense complex matrix";
+
+      blaze::DynamicMatrix<cdouble,blaze::columnMajor> A( 13UL, 13UL );
+      for( size_t i=0UL; i<13UL; ++i ) {
+         for( size_t j=0UL; j<13UL; ++j ) {
+            A(i,j) = cdouble( std::sin( double( 3UL*i*j+1UL ) ), std::cos( double( i+2UL*j*j ) ) );
+         }
+      }
+
+      checkExact( A, blaze::BlockJacobiPreconditioner<cdouble>( A, 13UL ), 1E-12 );
+   }
+
+   {
+      test_ = "GMRES with a block-Jacobi preconditioner";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( 300UL ) );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+            element->value() *= double( 1UL + 10UL*( ( i/3UL ) % 5UL ) );
+         }
+      }
+
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl plain( 1000UL, 1E-10 );
+      gmres( A, x, b, plain );
+
+      x.clear();
+      blaze::SolverControl control( 1000UL, 1E-10 );
+      gmres( A, x, b, control, blaze::BlockJacobiPreconditioner<double>( A, 3UL ) );
+
+      checkIterations( control, plain.iterations() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SSORPreconditioner class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SSOR preconditioner for triangular matrices (for which the Gauss-Seidel
+// variant with \f$ \omega = 1 \f$ is exact), the symmetry of the preconditioner, and its effect
+// on the conjugate gradient method. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void PreconditionerTest::testSSOR()
+{
+   {
+      test_ = "SSOR preconditioner of a triangular matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 6UL ) );
+      const blaze::CompressedMatrix<double,blaze::rowMajor> L( lowerPart( A, false ) );
+      const blaze::CompressedMatrix<double,blaze::rowMajor> U( upperPart( A ) );
+
+      checkExact( L, blaze::SSORPreconditioner<double>( L ), 1E-13 );
+      checkExact( U, blaze::SSORPreconditioner<double>( U ), 1E-13 );
+   }
+
+   {
+      test_ = "Symmetry of the SSOR preconditioner";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 5UL ) );
+      const blaze::SSORPreconditioner<double> M( A, 1.3 );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> Minv( A.rows(), A.rows() );
+      blaze::DynamicVector<double,blaze::columnVector> e( A.rows(), 0.0 ), z( A.rows() );
+
+      for( size_t j=0UL; j<A.rows(); ++j ) {
+         e[j] = 1.0;
+         M( z, e );
+         column( Minv, j ) = z;
+         e[j] = 0.0;
+      }
+
+      if( max( abs( Minv - trans( Minv ) ) ) > 1E-14 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-symmetric preconditioner detected\n"
+             << " Details:\n"
+             << "   Result:\n" << Minv << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "CG with a SSOR preconditioner";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 20UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl plain( 1000UL, 1E-10 );
+      cg( A, x, b, plain );
+
+      x.clear();
+      blaze::SolverControl control( 1000UL, 1E-10 );
+      cg( A, x, b, control, blaze::SSORPreconditioner<double>( A, 1.5 ) );
+
+      checkIterations( control, plain.iterations() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ilu0() function and the ILU0Preconditioner class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the incomplete LU decomposition on the sparsity pattern of real and
+// complex matrices, the exactness of the decomposition for matrices without fill-in, and the
+// effect of the ILU(0) preconditioner on the BiCGSTAB method. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void PreconditionerTest::testILU0()
+{
+   {
+      test_ = "ILU(0) decomposition of a sparse matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( 60UL ) );
+      blaze::CompressedMatrix<double,blaze::rowMajor> F( A );
+
+      ilu0( F );
+
+      if( F.nonZeros() != A.nonZeros() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fill-in detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkPattern( A, lowerPart( F, true ), upperPart( F ), 1E-13 );
+   }
+
+   {
+      test_ = "ILU(0) decomposition of a Laplace matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 9UL ) );
+      const blaze::ILU0Preconditioner<double> M( A );
+
+      checkPattern( A, lowerPart( M.factors(), true ), upperPart( M.factors() ), 1E-13 );
+   }
+
+   {
+      test_ = "ILU(0) decomposition of a complex matrix";
+
+      blaze::CompressedMatrix<cdouble,blaze::rowMajor> A( convection<cdouble>( 45UL ) );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+            element->value() *= cdouble( 1.0, 0.1 * double( element->index() % 5UL ) );
+         }
+      }
+
+      const blaze::ILU0Preconditioner<cdouble> M( A );
+
+      checkPattern( A, lowerPart( M.factors(), true ), upperPart( M.factors() ), 1E-13 );
+   }
+
+   for( size_t n=1UL; n<50UL; n+=7UL )
+   {
+      test_ = "ILU(0) preconditioner of a tridiagonal matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( tridiagonal<double>( n ) );
+      checkExact( A, blaze::ILU0Preconditioner<double>( A ), 1E-13 );
+   }
+
+   {
+      test_ = "BiCGSTAB with an ILU(0) preconditioner";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( 2000UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl plain( 1000UL, 1E-10 );
+      bicgstab( A, x, b, plain );
+
+      x.clear();
+      blaze::SolverControl control( 1000UL, 1E-10 );
+      bicgstab( A, x, b, control, blaze::ILU0Preconditioner<double>( A ) );
+
+      checkIterations( control, plain.iterations() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the ic0() function and the IC0Preconditioner class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the incomplete Cholesky decomposition on the sparsity pattern of real
+// and complex matrices, the exactness of the decomposition for matrices without fill-in, and
+// the effect of the IC(0) preconditioner on the conjugate gradient method. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void PreconditionerTest::testIC0()
+{
+   {
+      test_ = "IC(0) decomposition of a Laplace matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 9UL ) );
+      blaze::CompressedMatrix<double,blaze::rowMajor> F( A );
+
+      ic0( F );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( size_t j=i+1UL; j<A.columns(); ++j ) {
+            if( F(i,j) != A(i,j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Modification of the upper part detected\n"
+                   << " Details:\n"
+                   << "   Element (" << i << "," << j << ")\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      const blaze::DynamicMatrix<double,blaze::rowMajor> L( lowerPart( F, false ) );
+      checkPattern( A, L, trans( L ), 1E-13 );
+   }
+
+   {
+      test_ = "IC(0) decomposition of a Hermitian complex matrix";
+
+      blaze::CompressedMatrix<cdouble,blaze::rowMajor> A( 40UL, 40UL );
+      for( size_t i=0UL; i<40UL; ++i ) {
+         if( i >= 5UL ) A(i,i-5UL) = cdouble( 0.3, -0.2 );
+         if( i >= 1UL ) A(i,i-1UL) = cdouble( -1.0, 0.5 );
+         A(i,i) = cdouble( 4.0, 0.0 );
+         if( i+1UL < 40UL ) A(i,i+1UL) = cdouble( -1.0, -0.5 );
+         if( i+5UL < 40UL ) A(i,i+5UL) = cdouble( 0.3, 0.2 );
+      }
+
+      const blaze::IC0Preconditioner<cdouble> M( A );
+
+      checkPattern( A, M.factor(), ctrans( M.factor() ), 1E-13 );
+   }
+
+   for( size_t n=1UL; n<50UL; n+=7UL )
+   {
+      test_ = "IC(0) preconditioner of a tridiagonal matrix";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( tridiagonal<double>( n ) );
+      A = A + trans( A );
+
+      checkExact( A, blaze::IC0Preconditioner<double>( A ), 1E-13 );
+   }
+
+   {
+      test_ = "CG with an IC(0) preconditioner";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 30UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      blaze::SolverControl plain( 1000UL, 1E-10 );
+      cg( A, x, b, plain );
+
+      x.clear();
+      blaze::SolverControl control( 1000UL, 1E-10 );
+      cg( A, x, b, control, blaze::IC0Preconditioner<double>( A ) );
+
+      checkIterations( control, plain.iterations() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the preconditioners.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the detection of invalid system matrices and arguments. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void PreconditionerTest::testErrors()
+{
+   {
+      test_ = "Preconditioner of a non-square matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 4UL );
+
+      try {
+         const blaze::ILU0Preconditioner<double> M( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of a preconditioner of a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Preconditioner of a matrix with missing diagonal element";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 3UL ) );
+      A.erase( 4UL, 4UL );
+
+      try {
+         ic0( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of a matrix with missing diagonal element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         const blaze::SSORPreconditioner<double> M( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of a preconditioner of a matrix with missing diagonal element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         const blaze::JacobiPreconditioner<double> M( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of a preconditioner of a matrix with zero diagonal element succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "ILU(0) decomposition of a singular matrix";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 3UL );
+      A(0,0) = 1.0; A(0,1) = 1.0;
+      A(1,0) = 1.0; A(1,1) = 1.0;
+      A(2,2) = 1.0;
+
+      try {
+         blaze::CompressedMatrix<double,blaze::rowMajor> F( A );
+         ilu0( F );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of a singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+      }
+
+      try {
+         const blaze::BlockJacobiPreconditioner<double> M( A, 2UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of a block-Jacobi preconditioner with singular block succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+      }
+   }
+
+   {
+      test_ = "IC(0) decomposition of an indefinite matrix";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 2UL, 2UL );
+      A(0,0) = 1.0; A(0,1) = 2.0;
+      A(1,0) = 2.0; A(1,1) = 1.0;
+
+      try {
+         ic0( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of an indefinite matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "Test:" ) != std::string::npos ) throw;
+      }
+   }
+
+   {
+      test_ = "Invalid preconditioner arguments";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 3UL ) );
+
+      try {
+         const blaze::SSORPreconditioner<double> M( A, 2.0 );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with invalid relaxation parameter succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         const blaze::BlockJacobiPreconditioner<double> M( A, 0UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup with invalid block size succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the preconditioners for large systems.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function decomposes and applies the preconditioners for large systems, whose levels are
+// processed in parallel in case a parallelization is enabled, and checks that the results are
+// identical to the results of a serial execution. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void PreconditionerTest::testParallel()
+{
+   {
+      test_ = "IC(0) preconditioner of a large sparse matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 211UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> r( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> z1( A.rows() ), z2( A.rows() );
+
+      const blaze::IC0Preconditioner<double> M1( A );
+      M1( z1, r );
+
+      BLAZE_SERIAL_SECTION
+      {
+         const blaze::IC0Preconditioner<double> M2( A );
+         M2( z2, r );
+
+         if( M1.factor() != M2.factor() || z1 != z2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Parallel decomposition differs from serial decomposition\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> x;
+      blaze::SolverControl control( 2000UL, 1E-8 );
+      cg( A, x, r, control, M1 );
+
+      checkIterations( control, 2000UL );
+   }
+
+   {
+      test_ = "ILU(0) preconditioner of a large sparse matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( convection<double>( 40009UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> r( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> z1( A.rows() ), z2( A.rows() );
+
+      const blaze::ILU0Preconditioner<double> M1( A );
+      M1( z1, r );
+
+      BLAZE_SERIAL_SECTION
+      {
+         const blaze::ILU0Preconditioner<double> M2( A );
+         M2( z2, r );
+
+         if( M1.factors() != M2.factors() || z1 != z2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Parallel decomposition differs from serial decomposition\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      blaze::DynamicVector<double,blaze::columnVector> x;
+      blaze::SolverControl control( 500UL, 1E-10 );
+      bicgstab( A, x, r, control, M1 );
+
+      checkIterations( control, 500UL );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running preconditioner test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_PRECONDITIONER_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during preconditioner test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
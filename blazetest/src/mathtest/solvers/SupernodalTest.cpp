@@ -0,0 +1,666 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/solvers/SupernodalTest.cpp
+//  \brief Source file for the supernodal sparse decomposition test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blazetest/mathtest/solvers/SupernodalTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the supernodal decomposition test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SupernodalTest::SupernodalTest()
+{
+   testOrdering();
+   testAnalysis();
+   testLLH();
+   testLDLH();
+   testRefactorization();
+   testErrors();
+   testParallel();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking that the given vector represents a permutation.
+//
+// \param p The permutation vector.
+// \param n The expected size of the permutation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the given vector contains every index in the range \f$ [0..n) \f$
+// exactly once. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SupernodalTest::checkPermutation( const std::vector<size_t>& p, size_t n ) const
+{
+   std::vector<size_t> count( n, 0UL );
+
+   for( size_t i : p ) {
+      if( i < n ) ++count[i];
+   }
+
+   if( p.size() != n || std::count( count.begin(), count.end(), 1UL ) != long( n ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid permutation detected\n"
+          << " Details:\n"
+          << "   Size: " << p.size() << "\n"
+          << "   Expected size: " << n << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the approximate minimum degree ordering.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the amd() function for a number of matrices with known structure and
+// checks that the ordering reduces the fill of the Cholesky factor in comparison to the natural
+// ordering. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SupernodalTest::testOrdering()
+{
+   {
+      test_ = "AMD ordering of empty and diagonal matrices";
+
+      checkPermutation( blaze::amd( blaze::CompressedMatrix<double,blaze::rowMajor>() ), 0UL );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> D( 7UL, 7UL );
+      for( size_t i=0UL; i<7UL; ++i ) {
+         D(i,i) = 1.0;
+      }
+
+      checkPermutation( blaze::amd( D ), 7UL );
+   }
+
+   {
+      test_ = "AMD ordering of a 2D Laplace matrix";
+
+      for( size_t k=1UL; k<=12UL; ++k )
+      {
+         const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( k ) );
+         const std::vector<size_t> p( blaze::amd( A ) );
+
+         checkPermutation( p, A.rows() );
+
+         std::vector<size_t> natural( A.rows() );
+         for( size_t i=0UL; i<A.rows(); ++i ) {
+            natural[i] = i;
+         }
+
+         const size_t fill( denseNonZeros( A, p ) );
+
+         if( k >= 6UL && fill >= denseNonZeros( A, natural ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fill reduction failed\n"
+                << " Details:\n"
+                << "   Grid size: " << k << "\n"
+                << "   Non-zeros of the factor: " << fill << "\n"
+                << "   Non-zeros with natural ordering: " << denseNonZeros( A, natural ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   {
+      test_ = "AMD ordering of a matrix with a dense row";
+
+      const size_t n( 200UL );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( n, n );
+      for( size_t i=0UL; i<n; ++i ) {
+         A(i,i) = 4.0;
+         if( i != 5UL ) {
+            A(i,5UL) = 1.0;
+            A(5UL,i) = 1.0;
+         }
+      }
+
+      const std::vector<size_t> p( blaze::amd( A ) );
+
+      checkPermutation( p, n );
+
+      if( p.back() != 5UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Dense row not ordered last\n"
+             << " Details:\n"
+             << "   Last pivot: " << p.back() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SymbolicFactorization class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the symbolic analysis of the sparse Cholesky decomposition, i.e. the
+// predicted number of non-zero elements of the factor and the consistency of the supernodal
+// structure. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SupernodalTest::testAnalysis()
+{
+   test_ = "Symbolic analysis of a 2D Laplace matrix";
+
+   for( size_t k=1UL; k<=12UL; ++k )
+   {
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( k ) );
+      const blaze::SymbolicFactorization S( A );
+
+      checkPermutation( S.permutation(), A.rows() );
+
+      if( S.rows() != A.rows() || S.nonZeros() != denseNonZeros( A, S.permutation() ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements of the factor\n"
+             << " Details:\n"
+             << "   Grid size: " << k << "\n"
+             << "   Result: " << S.nonZeros() << "\n"
+             << "   Expected result: " << denseNonZeros( A, S.permutation() ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      size_t columns( 0UL ), nonzeros( 0UL ), nodes( 0UL );
+
+      for( size_t s=0UL; s<S.supernodes(); ++s ) {
+         columns  += S.columns(s);
+         nonzeros += S.columns(s) * S.size(s) - ( S.columns(s) * ( S.columns(s) - 1UL ) ) / 2UL;
+      }
+
+      for( size_t l=0UL; l<S.levels(); ++l ) {
+         nodes += S.levelEnd(l) - S.levelBegin(l);
+      }
+
+      if( columns != A.rows() || nonzeros != S.nonZeros() || nodes != S.supernodes() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inconsistent supernodal structure\n"
+             << " Details:\n"
+             << "   Grid size: " << k << "\n"
+             << "   Columns: " << columns << "\n"
+             << "   Non-zeros: " << nonzeros << "\n"
+             << "   Supernodes in levels: " << nodes << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SparseLLH class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the supernodal sparse Cholesky decomposition for a variety of symmetric
+// and Hermitian positive definite matrices. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SupernodalTest::testLLH()
+{
+   {
+      test_ = "Cholesky decomposition of a 2D Laplace matrix";
+
+      for( size_t k=1UL; k<=25UL; k+=4UL ) {
+         const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( k ) );
+         checkSolve( A, blaze::SparseLLH<double>( A ), 1E-12 );
+      }
+   }
+
+   {
+      test_ = "Cholesky decomposition of a 3D Laplace matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace3<double>( 9UL ) );
+      checkSolve( A, blaze::SparseLLH<double>( A ), 1E-12 );
+
+      const blaze::CompressedMatrix<float,blaze::rowMajor> B( laplace3<float>( 7UL ) );
+      checkSolve( B, blaze::SparseLLH<float>( B ), 1E-4 );
+   }
+
+   {
+      test_ = "Cholesky decomposition of a Hermitian matrix";
+
+      const blaze::CompressedMatrix<cdouble,blaze::rowMajor> A( hermitian( 14UL ) );
+      checkSolve( A, blaze::SparseLLH<cdouble>( A ), 1E-12 );
+   }
+
+   {
+      test_ = "Cholesky decomposition of a column-major matrix";
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> A( laplace<double>( 13UL ) );
+      checkSolve( A, blaze::SparseLLH<double>( A ), 1E-12 );
+
+      const blaze::CompressedMatrix<cdouble,blaze::columnMajor> B( hermitian( 9UL ) );
+      checkSolve( B, blaze::SparseLLH<cdouble>( B ), 1E-12 );
+   }
+
+   {
+      test_ = "Cholesky decomposition of a symmetric sparse matrix adaptor";
+
+      const blaze::SymmetricMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > A( laplace<double>( 11UL ) );
+      checkSolve( A, blaze::SparseLLH<double>( A ), 1E-12 );
+   }
+
+   {
+      test_ = "Cholesky decomposition of the lower part of a matrix";
+
+      const blaze::CompressedMatrix<cdouble,blaze::rowMajor> A( hermitian( 10UL ) );
+
+      blaze::CompressedMatrix<cdouble,blaze::rowMajor> L( A.rows(), A.columns() );
+      L.reserve( A.nonZeros() );
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( auto element=A.begin(i); element!=A.end(i) && element->index()<=i; ++element ) {
+            L.append( i, element->index(), element->value() );
+         }
+         L.finalize( i );
+      }
+
+      checkSolve( A, blaze::SparseLLH<cdouble>( L ), 1E-12 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SparseLDLH class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the supernodal sparse LDLH decomposition for symmetric indefinite and
+// Hermitian matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SupernodalTest::testLDLH()
+{
+   {
+      test_ = "LDLH decomposition of a quasi-definite matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> K( quasiDefinite( 12UL, 17UL ) );
+      checkSolve( K, blaze::SparseLDLH<double>( K ), 1E-12 );
+
+      try {
+         const blaze::SparseLLH<double> chol( K );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Cholesky decomposition of an indefinite matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ) {}
+   }
+
+   {
+      test_ = "LDLH decomposition of an indefinite diagonal matrix";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> D( 9UL, 9UL );
+      for( size_t i=0UL; i<9UL; ++i ) {
+         D(i,i) = ( i % 2UL )?( -double( i+1UL ) ):( double( i+1UL ) );
+      }
+
+      checkSolve( D, blaze::SparseLDLH<double>( D ), 1E-14 );
+   }
+
+   {
+      test_ = "LDLH decomposition of a Hermitian matrix";
+
+      const blaze::CompressedMatrix<cdouble,blaze::rowMajor> A( hermitian( 12UL ) );
+      checkSolve( A, blaze::SparseLDLH<cdouble>( A ), 1E-12 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the repeated factorization based on a single symbolic analysis.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the numeric factorization of several matrices with identical sparsity
+// pattern based on a single symbolic analysis. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SupernodalTest::testRefactorization()
+{
+   test_ = "Refactorization with a reused symbolic analysis";
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 15UL ) );
+   const blaze::SymbolicFactorization S( A );
+
+   blaze::SparseLLH<double> chol( S );
+   blaze::SparseLDLH<double> ldl( S );
+
+   if( chol.isFactorized() || chol.rows() != A.rows() || chol.nonZeros() != S.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid state of an unfactorized decomposition\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t step=0UL; step<3UL; ++step )
+   {
+      chol.factorize( A );
+      ldl.factorize( A );
+
+      if( chol.symbolic().permutation() != S.permutation() || chol.supernodes() != S.supernodes() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symbolic analysis not reused\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkSolve( A, chol, 1E-12 );
+      checkSolve( A, ldl, 1E-12 );
+
+      for( size_t i=0UL; i<A.rows(); ++i ) {
+         for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+            element->value() *= ( element->index() == i )?( 1.5 ):( 0.75 );
+         }
+      }
+   }
+
+   {
+      test_ = "Refactorization of a matrix with a subset of the analyzed pattern";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> B( laplace<double>( 15UL ) );
+      for( size_t i=7UL; i<B.rows(); i+=11UL ) {
+         B.erase( i, i-1UL );
+         B.erase( i-1UL, i );
+      }
+
+      chol.factorize( B );
+      checkSolve( B, chol, 1E-12 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the sparse decompositions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the detection of invalid matrices and invalid uses of the sparse
+// decompositions. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SupernodalTest::testErrors()
+{
+   {
+      test_ = "Decomposition of a non-square matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 4UL );
+
+      try {
+         const blaze::SymbolicFactorization S( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Analysis of a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::SparseLLH<double> chol;
+         chol.factorize( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of a non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Cholesky decomposition of a non-positive-definite matrix";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 6UL ) );
+      A(20,20) = -4.0;
+
+      try {
+         const blaze::SparseLLH<double> chol( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of a non-positive-definite matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ) {}
+   }
+
+   {
+      test_ = "LDLH decomposition of a singular matrix";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 3UL, 3UL );
+      A(0,0) = 1.0; A(0,1) = 1.0;
+      A(1,0) = 1.0; A(1,1) = 1.0;
+      A(2,2) = 1.0;
+
+      try {
+         const blaze::SparseLDLH<double> ldl( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of a singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ) {}
+   }
+
+   {
+      test_ = "Factorization of a matrix with a different sparsity pattern";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 4UL ) );
+      blaze::SparseLLH<double> chol( A );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> B( A );
+      B(15,0) = 0.5;
+      B(0,15) = 0.5;
+
+      try {
+         chol.factorize( B );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Factorization of a matrix with a different pattern succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Solve with an unfactorized matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 4UL ) );
+      const blaze::SparseLLH<double> chol( ( blaze::SymbolicFactorization( A ) ) );
+
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      try {
+         chol.solve( x, rhs<double>( A.rows() ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solve with an unfactorized matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::logic_error& ) {}
+   }
+
+   {
+      test_ = "Solve with an invalid right-hand side vector";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace<double>( 4UL ) );
+      const blaze::SparseLLH<double> chol( A );
+
+      blaze::DynamicVector<double,blaze::columnVector> x;
+
+      try {
+         chol.solve( x, rhs<double>( A.rows()+1UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solve with an invalid right-hand side vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel factorization of large sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the level-scheduled parallel factorization of the supernodal elimination
+// tree in comparison to the serial factorization. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SupernodalTest::testParallel()
+{
+   {
+      test_ = "Cholesky decomposition of a large 3D Laplace matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A( laplace3<double>( 22UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> b( rhs<double>( A.rows() ) );
+      blaze::DynamicVector<double,blaze::columnVector> x1, x2;
+
+      const blaze::SparseLLH<double> chol1( A );
+      chol1.solve( x1, b );
+
+      BLAZE_SERIAL_SECTION
+      {
+         const blaze::SparseLLH<double> chol2( A );
+         chol2.solve( x2, b );
+      }
+
+      if( norm( x1 - x2 ) > 1E-12 * norm( x2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Parallel decomposition differs from serial decomposition\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkSolve( A, chol1, 1E-12 );
+   }
+
+   {
+      test_ = "LDLH decomposition of a large quasi-definite matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> K( quasiDefinite( 120UL, 500UL ) );
+      checkSolve( K, blaze::SparseLDLH<double>( K ), 1E-10 );
+   }
+}
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running supernodal decomposition test..." << std::endl;
+
+   try
+   {
+      RUN_SOLVERS_SUPERNODAL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during supernodal decomposition test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
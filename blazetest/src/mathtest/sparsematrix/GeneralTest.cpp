@@ -41,6 +41,8 @@
 #include <iostream>
 #include <blaze/math/sparse/SparseMatrix.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blazetest/mathtest/sparsematrix/GeneralTest.h>
 
 
@@ -79,6 +81,12 @@ GeneralTest::GeneralTest()
    testMinimum();
    testMaximum();
    testTrace();
+   testSum();
+   testProd();
+   testReduce();
+   testSpGEMM();
+   testSMPAssign<blaze::rowMajor>();
+   testSMPAssign<blaze::columnMajor>();
 }
 //*************************************************************************************************
 
@@ -4790,6 +4798,929 @@ void GeneralTest::testTrace()
 //*************************************************************************************************
 
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for sparse matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSum()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major sum()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+      mat(0,0) =  1;
+      mat(0,3) =  2;
+      mat(2,1) = -3;
+      mat(2,3) =  5;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+
+      // Computing the total sum
+      {
+         const int sum = blaze::sum( mat );
+
+         if( sum != 5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << sum << "\n"
+                << "   Expected result: 5\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the row-wise sum
+      {
+         const blaze::DynamicVector<int,blaze::columnVector> sum( blaze::sum<blaze::rowwise>( mat ) );
+
+         if( sum.size() != 3UL || sum[0] != 3 || sum[1] != 0 || sum[2] != 2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << sum << "\n"
+                << "   Expected result:\n( 3 0 2 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the column-wise sum
+      {
+         const blaze::DynamicVector<int,blaze::rowVector> sum( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( sum.size() != 4UL || sum[0] != 1 || sum[1] != -3 || sum[2] != 0 || sum[3] != 7 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Third computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << sum << "\n"
+                << "   Expected result:\n( 1 -3 0 7 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major sum()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 4UL );
+      mat(0,0) =  1;
+      mat(0,3) =  2;
+      mat(2,1) = -3;
+      mat(2,3) =  5;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 4UL );
+
+      // Computing the total sum
+      {
+         const int sum = blaze::sum( mat );
+
+         if( sum != 5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << sum << "\n"
+                << "   Expected result: 5\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the row-wise sum
+      {
+         const blaze::DynamicVector<int,blaze::columnVector> sum( blaze::sum<blaze::rowwise>( mat ) );
+
+         if( sum.size() != 3UL || sum[0] != 3 || sum[1] != 0 || sum[2] != 2 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << sum << "\n"
+                << "   Expected result:\n( 3 0 2 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the column-wise sum
+      {
+         const blaze::DynamicVector<int,blaze::rowVector> sum( blaze::sum<blaze::columnwise>( mat ) );
+
+         if( sum.size() != 4UL || sum[0] != 1 || sum[1] != -3 || sum[2] != 0 || sum[3] != 7 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Third computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << sum << "\n"
+                << "   Expected result:\n( 1 -3 0 7 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the \c prod() function for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c prod() function for sparse matrices. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testProd()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major prod()";
+
+      // Product of a 0x0 matrix
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat;
+
+         const int prod = blaze::prod( mat );
+
+         if( prod != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << prod << "\n"
+                << "   Expected result: 1\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Product of a completely filled matrix
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 2UL, 2UL );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(1,0) =  3;
+         mat(1,1) = -4;
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 2UL );
+         checkNonZeros( mat, 4UL );
+
+         const int prod = blaze::prod( mat );
+
+         if( prod != 24 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << prod << "\n"
+                << "   Expected result: 24\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Product of a partially filled matrix
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 2UL, 3UL );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(0,2) =  3;
+         mat(1,1) = -4;
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 4UL );
+
+         const int prod = blaze::prod( mat );
+
+         if( prod != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Third computation failed\n"
+                << " Details:\n"
+                << "   Result: " << prod << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::columnVector> rowprod( blaze::prod<blaze::rowwise>( mat ) );
+
+         if( rowprod.size() != 2UL || rowprod[0] != -6 || rowprod[1] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fourth computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowprod << "\n"
+                << "   Expected result:\n( -6 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::rowVector> colprod( blaze::prod<blaze::columnwise>( mat ) );
+
+         if( colprod.size() != 3UL || colprod[0] != 0 || colprod[1] != 8 || colprod[2] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fifth computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << colprod << "\n"
+                << "   Expected result:\n( 0 8 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major prod()";
+
+      // Product of a 0x0 matrix
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat;
+
+         const int prod = blaze::prod( mat );
+
+         if( prod != 1 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << prod << "\n"
+                << "   Expected result: 1\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Product of a completely filled matrix
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 2UL, 2UL );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(1,0) =  3;
+         mat(1,1) = -4;
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 2UL );
+         checkNonZeros( mat, 4UL );
+
+         const int prod = blaze::prod( mat );
+
+         if( prod != 24 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result: " << prod << "\n"
+                << "   Expected result: 24\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Product of a partially filled matrix
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 2UL, 3UL );
+         mat(0,0) =  1;
+         mat(0,1) = -2;
+         mat(0,2) =  3;
+         mat(1,1) = -4;
+
+         checkRows    ( mat, 2UL );
+         checkColumns ( mat, 3UL );
+         checkNonZeros( mat, 4UL );
+
+         const int prod = blaze::prod( mat );
+
+         if( prod != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Third computation failed\n"
+                << " Details:\n"
+                << "   Result: " << prod << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::columnVector> rowprod( blaze::prod<blaze::rowwise>( mat ) );
+
+         if( rowprod.size() != 2UL || rowprod[0] != -6 || rowprod[1] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fourth computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << rowprod << "\n"
+                << "   Expected result:\n( -6 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         const blaze::DynamicVector<int,blaze::rowVector> colprod( blaze::prod<blaze::columnwise>( mat ) );
+
+         if( colprod.size() != 3UL || colprod[0] != 0 || colprod[1] != 8 || colprod[2] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fifth computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << colprod << "\n"
+                << "   Expected result:\n( 0 8 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reduce() function for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reduce() function for sparse matrices, in particular
+// of the treatment of implicit zero elements. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testReduce()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major reduce()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+      mat(0,0) = -1;
+      mat(0,1) = -7;
+      mat(0,2) = -2;
+      mat(0,3) = -8;
+      mat(2,0) = -3;
+      mat(2,3) = -6;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 6UL );
+
+      // Computing the total maximum
+      {
+         const int maximum = blaze::reduce( mat, blaze::Max() );
+
+         if( maximum != 0 || maximum != blaze::max( mat ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << maximum << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the row-wise maximum
+      {
+         const blaze::DynamicVector<int,blaze::columnVector> maximum(
+            blaze::reduce<blaze::rowwise>( mat, blaze::Max() ) );
+
+         if( maximum.size() != 3UL || maximum[0] != -1 || maximum[1] != 0 || maximum[2] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << maximum << "\n"
+                << "   Expected result:\n( -1 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            if( maximum[i] != blaze::max( blaze::row( mat, i ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Third computation failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << maximum << "\n"
+                   << "   Expected result:\n( -1 0 0 )\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      // Computing the column-wise maximum
+      {
+         const blaze::DynamicVector<int,blaze::rowVector> maximum(
+            blaze::reduce<blaze::columnwise>( mat, blaze::Max() ) );
+
+         if( maximum.size() != 4UL || maximum[0] != 0 || maximum[1] != 0 ||
+             maximum[2] != 0 || maximum[3] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fourth computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << maximum << "\n"
+                << "   Expected result:\n( 0 0 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( maximum[j] != blaze::max( blaze::column( mat, j ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Fifth computation failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << maximum << "\n"
+                   << "   Expected result:\n( 0 0 0 0 )\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      // Computing the row-wise minimum
+      {
+         const blaze::DynamicVector<int,blaze::columnVector> minimum(
+            blaze::reduce<blaze::rowwise>( -mat, blaze::Min() ) );
+
+         if( minimum.size() != 3UL || minimum[0] != 1 || minimum[1] != 0 || minimum[2] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Sixth computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << minimum << "\n"
+                << "   Expected result:\n( 1 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major reduce()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 4UL );
+      mat(0,0) = -1;
+      mat(0,1) = -7;
+      mat(0,2) = -2;
+      mat(0,3) = -8;
+      mat(2,0) = -3;
+      mat(2,3) = -6;
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 6UL );
+
+      // Computing the total maximum
+      {
+         const int maximum = blaze::reduce( mat, blaze::Max() );
+
+         if( maximum != 0 || maximum != blaze::max( mat ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: First computation failed\n"
+                << " Details:\n"
+                << "   Result: " << maximum << "\n"
+                << "   Expected result: 0\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Computing the row-wise maximum
+      {
+         const blaze::DynamicVector<int,blaze::columnVector> maximum(
+            blaze::reduce<blaze::rowwise>( mat, blaze::Max() ) );
+
+         if( maximum.size() != 3UL || maximum[0] != -1 || maximum[1] != 0 || maximum[2] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Second computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << maximum << "\n"
+                << "   Expected result:\n( -1 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t i=0UL; i<mat.rows(); ++i ) {
+            if( maximum[i] != blaze::max( blaze::row( mat, i ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Third computation failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << maximum << "\n"
+                   << "   Expected result:\n( -1 0 0 )\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      // Computing the column-wise maximum
+      {
+         const blaze::DynamicVector<int,blaze::rowVector> maximum(
+            blaze::reduce<blaze::columnwise>( mat, blaze::Max() ) );
+
+         if( maximum.size() != 4UL || maximum[0] != 0 || maximum[1] != 0 ||
+             maximum[2] != 0 || maximum[3] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Fourth computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << maximum << "\n"
+                << "   Expected result:\n( 0 0 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( maximum[j] != blaze::max( blaze::column( mat, j ) ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Fifth computation failed\n"
+                   << " Details:\n"
+                   << "   Result:\n" << maximum << "\n"
+                   << "   Expected result:\n( 0 0 0 0 )\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      // Computing the row-wise minimum
+      {
+         const blaze::DynamicVector<int,blaze::columnVector> minimum(
+            blaze::reduce<blaze::rowwise>( -mat, blaze::Min() ) );
+
+         if( minimum.size() != 3UL || minimum[0] != 1 || minimum[1] != 0 || minimum[2] != 0 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Sixth computation failed\n"
+                << " Details:\n"
+                << "   Result:\n" << minimum << "\n"
+                << "   Expected result:\n( 1 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c spgemmSymbolic(), \c spgemmNumeric(), and \c spgemm() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the two-phase sparse matrix/sparse matrix multiplication
+// functions \c spgemmSymbolic(), \c spgemmNumeric(), and \c spgemm(). In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void GeneralTest::testSpGEMM()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major spgemm()";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 3UL );
+      A(0,0) =  1;
+      A(0,2) =  2;
+      A(1,1) =  3;
+      A(2,0) =  4;
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> B( 3UL, 3UL );
+      B(0,0) =  1;
+      B(0,1) =  1;
+      B(1,2) =  2;
+      B(2,0) = -1;
+      B(2,2) =  1;
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> C;
+
+      // Computing the sparsity pattern of the product
+      blaze::spgemmSymbolic( C, A, B );
+
+      checkRows    ( C, 3UL );
+      checkColumns ( C, 3UL );
+      checkNonZeros( C, 6UL );
+      checkNonZeros( C, 0UL, 3UL );
+      checkNonZeros( C, 1UL, 1UL );
+      checkNonZeros( C, 2UL, 2UL );
+
+      if( C != blaze::CompressedMatrix<int,blaze::rowMajor>( 3UL, 3UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symbolic phase failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Computing the values of the product within the given sparsity pattern
+      blaze::spgemmNumeric( C, A, B );
+
+      checkNonZeros( C, 6UL );
+
+      if( C(0,0) != -1 || C(0,1) != 1 || C(0,2) != 2 ||
+          C(1,0) !=  0 || C(1,1) != 0 || C(1,2) != 6 ||
+          C(2,0) !=  4 || C(2,1) != 4 || C(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First numeric phase failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n( -1 1 2 )\n(  0 0 6 )\n(  4 4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Recomputing the values of the product after changing the values of A
+      A(0,2) = 1;
+
+      blaze::spgemmNumeric( C, A, B );
+
+      checkNonZeros( C, 6UL );
+
+      if( C(0,0) != 0 || C(0,1) != 1 || C(0,2) != 1 ||
+          C(1,0) != 0 || C(1,1) != 0 || C(1,2) != 6 ||
+          C(2,0) != 4 || C(2,1) != 4 || C(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second numeric phase failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n( 0 1 1 )\n( 0 0 6 )\n( 4 4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Computing the product without explicit zero elements
+      blaze::CompressedMatrix<int,blaze::rowMajor> D;
+      blaze::spgemm( D, A, B );
+
+      checkRows    ( D, 3UL );
+      checkColumns ( D, 3UL );
+      checkNonZeros( D, 5UL );
+
+      if( D != C ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n( 0 1 1 )\n( 0 0 6 )\n( 4 4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major spgemm()";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> A( 3UL, 3UL );
+      A(0,0) =  1;
+      A(0,2) =  2;
+      A(1,1) =  3;
+      A(2,0) =  4;
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> B( 3UL, 3UL );
+      B(0,0) =  1;
+      B(0,1) =  1;
+      B(1,2) =  2;
+      B(2,0) = -1;
+      B(2,2) =  1;
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> C;
+
+      // Computing the sparsity pattern of the product
+      blaze::spgemmSymbolic( C, A, B );
+
+      checkRows    ( C, 3UL );
+      checkColumns ( C, 3UL );
+      checkNonZeros( C, 6UL );
+      checkNonZeros( C, 0UL, 2UL );
+      checkNonZeros( C, 1UL, 2UL );
+      checkNonZeros( C, 2UL, 2UL );
+
+      if( C != blaze::CompressedMatrix<int,blaze::columnMajor>( 3UL, 3UL ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symbolic phase failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n( 0 0 0 )\n( 0 0 0 )\n( 0 0 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Computing the values of the product within the given sparsity pattern
+      blaze::spgemmNumeric( C, A, B );
+
+      checkNonZeros( C, 6UL );
+
+      if( C(0,0) != -1 || C(0,1) != 1 || C(0,2) != 2 ||
+          C(1,0) !=  0 || C(1,1) != 0 || C(1,2) != 6 ||
+          C(2,0) !=  4 || C(2,1) != 4 || C(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First numeric phase failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n( -1 1 2 )\n(  0 0 6 )\n(  4 4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Recomputing the values of the product after changing the values of A
+      A(0,2) = 1;
+
+      blaze::spgemmNumeric( C, A, B );
+
+      checkNonZeros( C, 6UL );
+
+      if( C(0,0) != 0 || C(0,1) != 1 || C(0,2) != 1 ||
+          C(1,0) != 0 || C(1,1) != 0 || C(1,2) != 6 ||
+          C(2,0) != 4 || C(2,1) != 4 || C(2,2) != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second numeric phase failed\n"
+             << " Details:\n"
+             << "   Result:\n" << C << "\n"
+             << "   Expected result:\n( 0 1 1 )\n( 0 0 6 )\n( 4 4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      // Computing the product without explicit zero elements
+      blaze::CompressedMatrix<int,blaze::columnMajor> D;
+      blaze::spgemm( D, A, B );
+
+      checkRows    ( D, 3UL );
+      checkColumns ( D, 3UL );
+      checkNonZeros( D, 5UL );
+
+      if( D != C ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication failed\n"
+             << " Details:\n"
+             << "   Result:\n" << D << "\n"
+             << "   Expected result:\n( 0 1 1 )\n( 0 0 6 )\n( 4 4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the SMP assignment, addition assignment, and subtraction assignment to a
+//        compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the SMP assignment, addition assignment, and subtraction
+// assignment of dense matrices and of sparse matrix additions and subtractions to a compressed
+// matrix with storage order \a SO. All operands are large enough to exceed the SMP thresholds
+// and contain empty rows/columns. The results are compared to serially evaluated references.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the compressed matrices
+void GeneralTest::testSMPAssign()
+{
+   const std::string order( SO ? "Column-major" : "Row-major" );
+
+   const size_t M( 640UL );
+   const size_t N( 600UL );
+
+   blaze::DynamicMatrix<int,SO> D( M, N, 0 );
+   blaze::CompressedMatrix<int,SO> A( M, N );
+   blaze::CompressedMatrix<int,SO> B( M, N );
+
+   // Initialization of the operands with every fourth row/column being empty. The values of
+   // D contain zeros and some of the elements of A and B cancel each other out.
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( ( SO ? j : i ) % 4UL == 3UL )
+            continue;
+         if( ( i*7UL + j*3UL ) % 11UL == 0UL )
+            D(i,j) = static_cast<int>( ( i + j ) % 5UL ) - 2;
+         if( ( i + j*2UL ) % 13UL == 0UL )
+            A(i,j) = static_cast<int>( i % 3UL ) + 1;
+         if( ( i*2UL + j ) % 9UL == 0UL )
+            B(i,j) = -static_cast<int>( i % 3UL ) - 1;
+      }
+   }
+
+   {
+      test_ = order + " assignment of a dense matrix";
+
+      blaze::CompressedMatrix<int,SO> C( 3UL, 4UL );
+      C(1,2) = 5;
+
+      C = D;
+
+      const blaze::CompressedMatrix<int,SO> ref( blaze::serial( D ) );
+      checkResult( C, ref );
+
+      for( size_t k=3UL; k<( SO ? N : M ); k+=4UL ) {
+         checkNonZeros( C, k, 0UL );
+      }
+   }
+
+   {
+      test_ = order + " assignment of a sparse matrix addition";
+
+      blaze::CompressedMatrix<int,SO> C;
+      C = A + B;
+
+      const blaze::CompressedMatrix<int,SO> ref( blaze::serial( A + B ) );
+      checkResult( C, ref );
+
+      for( size_t k=3UL; k<( SO ? N : M ); k+=4UL ) {
+         checkNonZeros( C, k, 0UL );
+      }
+   }
+
+   {
+      test_ = order + " assignment of a sparse matrix subtraction";
+
+      blaze::CompressedMatrix<int,SO> C;
+      C = A - B;
+
+      const blaze::CompressedMatrix<int,SO> ref( blaze::serial( A - B ) );
+      checkResult( C, ref );
+   }
+
+   {
+      test_ = order + " addition assignment of a dense matrix";
+
+      blaze::CompressedMatrix<int,SO> C( A );
+      C += D;
+
+      const blaze::CompressedMatrix<int,SO> ref( blaze::serial( A + D ) );
+      checkResult( C, ref );
+   }
+
+   {
+      test_ = order + " subtraction assignment of a dense matrix";
+
+      blaze::CompressedMatrix<int,SO> C( A );
+      C -= D;
+
+      const blaze::CompressedMatrix<int,SO> ref( blaze::serial( A - D ) );
+      checkResult( C, ref );
+   }
+
+   {
+      test_ = order + " addition assignment of a sparse matrix addition";
+
+      blaze::CompressedMatrix<int,SO> C( B );
+      C += A + B;
+
+      const blaze::CompressedMatrix<int,SO> ref( blaze::serial( B + A + B ) );
+      checkResult( C, ref );
+
+      for( size_t k=3UL; k<( SO ? N : M ); k+=4UL ) {
+         checkNonZeros( C, k, 0UL );
+      }
+   }
+
+   {
+      test_ = order + " subtraction assignment of a sparse matrix subtraction";
+
+      blaze::CompressedMatrix<int,SO> C( B );
+      C -= A - B;
+
+      const blaze::CompressedMatrix<int,SO> ref( blaze::serial( B - ( A - B ) ) );
+      checkResult( C, ref );
+   }
+}
+//*************************************************************************************************
+
 } // namespace sparsematrix
 
 } // namespace mathtest
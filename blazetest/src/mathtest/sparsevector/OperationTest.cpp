@@ -69,6 +69,9 @@ OperationTest::OperationTest()
    testNormalize();
    testMinimum();
    testMaximum();
+   testSum();
+   testProd();
+   testReduce();
 }
 //*************************************************************************************************
 
@@ -577,6 +580,241 @@ void OperationTest::testMaximum()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c sum() function for sparse vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c sum() function for sparse vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testSum()
+{
+   test_ = "sum() function";
+
+   // sum with empty 9-dimensional vector
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec( 9UL );
+
+      const int sum = blaze::sum( vec );
+
+      if( sum != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // sum with filled 9-dimensional vector
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec( 9UL );
+      vec[3] =  1;
+      vec[4] = -2;
+      vec[6] =  3;
+      vec[8] =  4;
+
+      const int sum = blaze::sum( vec );
+
+      if( sum != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: 6\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Test of the \c prod() function for sparse vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c prod() function for sparse vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testProd()
+{
+   test_ = "prod() function";
+
+   // prod with 0-dimensional vector
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec;
+
+      const int prod = blaze::prod( vec );
+
+      if( prod != 1 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << prod << "\n"
+             << "   Expected result: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // prod with empty 5-dimensional vector
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec( 5UL );
+
+      const int prod = blaze::prod( vec );
+
+      if( prod != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << prod << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // prod with partially filled 5-dimensional vector
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec( 5UL );
+      vec[2] = -2;
+
+      const int prod = blaze::prod( vec );
+
+      if( prod != 0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Third computation failed\n"
+             << " Details:\n"
+             << "   Result: " << prod << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // prod with completely filled 4-dimensional vector
+   {
+      blaze::CompressedVector<int,blaze::columnVector> vec( 4UL );
+      vec[0] =  1;
+      vec[1] = -2;
+      vec[2] =  3;
+      vec[3] = -4;
+
+      const int prod = blaze::prod( vec );
+
+      if( prod != 24 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fourth computation failed\n"
+             << " Details:\n"
+             << "   Result: " << prod << "\n"
+             << "   Expected result: 24\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c reduce() function for sparse vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c reduce() function for sparse vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OperationTest::testReduce()
+{
+   test_ = "reduce() function";
+
+   // Maximum of a partially filled vector with negative non-zero elements
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec( 5UL );
+      vec[1] = -4;
+      vec[3] = -2;
+
+      const int maximum = blaze::reduce( vec, blaze::Max() );
+
+      if( maximum != 0 || maximum != blaze::max( vec ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: First computation failed\n"
+             << " Details:\n"
+             << "   Result: " << maximum << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Minimum of a partially filled vector with positive non-zero elements
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec( 5UL );
+      vec[0] = 3;
+      vec[4] = 7;
+
+      const int minimum = blaze::reduce( vec, blaze::Min() );
+
+      if( minimum != 0 || minimum != blaze::min( vec ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Second computation failed\n"
+             << " Details:\n"
+             << "   Result: " << minimum << "\n"
+             << "   Expected result: 0\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Minimum of a completely filled vector with positive non-zero elements
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec( 3UL );
+      vec[0] = 3;
+      vec[1] = 5;
+      vec[2] = 7;
+
+      const int minimum = blaze::reduce( vec, blaze::Min() );
+
+      if( minimum != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Third computation failed\n"
+             << " Details:\n"
+             << "   Result: " << minimum << "\n"
+             << "   Expected result: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Sum of a partially filled vector
+   {
+      blaze::CompressedVector<int,blaze::rowVector> vec( 9UL );
+      vec[2] =  4;
+      vec[5] = -1;
+
+      const int sum = blaze::reduce( vec, blaze::Add() );
+
+      if( sum != 3 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fourth computation failed\n"
+             << " Details:\n"
+             << "   Result: " << sum << "\n"
+             << "   Expected result: 3\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
 } // namespace sparsevector
 
 } // namespace mathtest
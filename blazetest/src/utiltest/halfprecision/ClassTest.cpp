@@ -0,0 +1,416 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/halfprecision/ClassTest.cpp
+//  \brief Source file for the float16 and bfloat16 class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <blaze/math/traits/AddTrait.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/util/constraints/SameType.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blazetest/utiltest/halfprecision/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace halfprecision {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the float16 and bfloat16 class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testFloat16();
+   testBFloat16();
+   testArithmetic();
+   testVector();
+   testMatrix();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the conversion between float16 and float.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the rounding of single precision values to float16 and of
+// the conversion of all float16 values to single precision and back. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFloat16()
+{
+   using blaze::float16;
+
+   test_ = "float16 conversion";
+
+   // Exactly representable values
+   checkBits( float16(  0.0F     ), 0x0000U );
+   checkBits( float16( -0.0F     ), 0x8000U );
+   checkBits( float16(  1.0F     ), 0x3C00U );
+   checkBits( float16( -2.0F     ), 0xC000U );
+   checkBits( float16(  65504.0F ), 0x7BFFU );
+
+   // Rounding to nearest, ties to even
+   checkBits( float16( 1.0F + std::ldexp( 1.0F, -11 ) ), 0x3C00U );
+   checkBits( float16( 1.0F + std::ldexp( 3.0F, -11 ) ), 0x3C02U );
+   checkBits( float16( 1.0F + std::ldexp( 5.0F, -13 ) ), 0x3C01U );
+
+   // Overflow, subnormal values and underflow
+   checkBits( float16(  65520.0F ), 0x7C00U );
+   checkBits( float16( -1.0E10F  ), 0xFC00U );
+   checkBits( float16( std::numeric_limits<float>::infinity() ), 0x7C00U );
+   checkBits( float16( std::ldexp( 1.0F, -14 ) ), 0x0400U );
+   checkBits( float16( std::ldexp( 1.0F, -24 ) ), 0x0001U );
+   checkBits( float16( std::ldexp( 1.0F, -25 ) ), 0x0000U );
+   checkBits( float16( std::ldexp( 3.0F, -26 ) ), 0x0001U );
+
+   // NaN values
+   if( !std::isnan( static_cast<float>( float16( std::numeric_limits<float>::quiet_NaN() ) ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: NaN conversion failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Round trip of all float16 values
+   for( size_t i=0UL; i<65536UL; ++i )
+   {
+      const float16 value( float16::fromBits( static_cast<blaze::uint16_t>( i ) ) );
+      const float tmp( value );
+
+      if( !std::isnan( tmp ) ) {
+         checkBits( float16( tmp ), value.bits() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the conversion between bfloat16 and float.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the rounding of single precision values to bfloat16 and of
+// the conversion of all bfloat16 values to single precision and back. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testBFloat16()
+{
+   using blaze::bfloat16;
+
+   test_ = "bfloat16 conversion";
+
+   // Exactly representable values
+   checkBits( bfloat16(  0.0F ), 0x0000U );
+   checkBits( bfloat16( -0.0F ), 0x8000U );
+   checkBits( bfloat16(  1.0F ), 0x3F80U );
+   checkBits( bfloat16( -2.0F ), 0xC000U );
+
+   // Rounding to nearest, ties to even
+   checkBits( bfloat16( 1.0F + std::ldexp( 1.0F, -8 ) ), 0x3F80U );
+   checkBits( bfloat16( 1.0F + std::ldexp( 3.0F, -8 ) ), 0x3F82U );
+   checkBits( bfloat16( 1.0F + std::ldexp( 5.0F, -10 ) ), 0x3F81U );
+
+   // Overflow
+   checkBits( bfloat16( std::numeric_limits<float>::max() ), 0x7F80U );
+   checkBits( bfloat16( std::numeric_limits<float>::infinity() ), 0x7F80U );
+
+   // NaN values
+   if( !std::isnan( static_cast<float>( bfloat16( std::numeric_limits<float>::quiet_NaN() ) ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: NaN conversion failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Round trip of all bfloat16 values
+   for( size_t i=0UL; i<65536UL; ++i )
+   {
+      const bfloat16 value( bfloat16::fromBits( static_cast<blaze::uint16_t>( i ) ) );
+      const float tmp( value );
+
+      if( !std::isnan( tmp ) ) {
+         checkBits( bfloat16( tmp ), value.bits() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the arithmetic operations with float16 and bfloat16 values.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the arithmetic operations with float16 and bfloat16 values,
+// which are computed in single precision. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testArithmetic()
+{
+   using blaze::float16;
+   using blaze::bfloat16;
+
+   test_ = "Arithmetic operations";
+
+   using AddType  = blaze::AddTrait_<float16,float16>;
+   using MultType = blaze::MultTrait_<bfloat16,float>;
+
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( AddType , float );
+   BLAZE_CONSTRAINT_MUST_BE_SAME_TYPE( MultType, float );
+
+   static_assert( blaze::IsNumeric<float16>::value, "Non-numeric float16 type detected" );
+   static_assert( blaze::IsNumeric<const bfloat16>::value, "Non-numeric bfloat16 type detected" );
+   static_assert( blaze::IsSIMDCombinable<float16,float,bfloat16>::value, "Non-combinable types detected" );
+
+   float16  a( 1.5F  );
+   bfloat16 b( 0.25F );
+
+   const float c( a * b );
+   const float d( a + b );
+
+   a += b;
+   b *= 4;
+   a -= 0.5F;
+
+   if( c != 0.375F || d != 1.75F || a != 1.25F || b != 1.0F ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Arithmetic operation failed\n"
+          << " Details:\n"
+          << "   Result: " << c << " " << d << " " << a << " " << b << "\n"
+          << "   Expected result: 0.375 1.75 1.25 1\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of dense vector operations with float16 and bfloat16 elements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the elementwise and inner product operations of dense
+// vectors with float16 and bfloat16 elements, which are vectorized in case the according
+// conversion instructions are available. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testVector()
+{
+   using blaze::float16;
+   using blaze::bfloat16;
+
+   test_ = "Dense vector operations";
+
+   const size_t n( 77UL );
+
+   blaze::DynamicVector<float16>  a( n );
+   blaze::DynamicVector<bfloat16> b( n );
+   blaze::DynamicVector<float>    refa( n ), refb( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      refa[i] = 0.25F * static_cast<float>( i % 17UL ) - 2.0F;
+      refb[i] = 0.5F  * static_cast<float>( i % 13UL ) - 3.0F;
+      a[i] = refa[i];
+      b[i] = refb[i];
+   }
+
+   const blaze::DynamicVector<float16> sum ( a + b );
+   const blaze::DynamicVector<float>   prod( a * b );
+   const float dot( trans( a ) * b );
+
+   const blaze::DynamicVector<float> refsum ( refa + refb );
+   const blaze::DynamicVector<float> refprod( refa * refb );
+   const float refdot( trans( refa ) * refb );
+
+   if( sum != refsum || prod != refprod || dot != refdot ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Vector operation failed\n"
+          << " Details:\n"
+          << "   Result (sum):\n" << sum << "\n"
+          << "   Expected result (sum):\n" << refsum << "\n"
+          << "   Result (inner product): " << dot << "\n"
+          << "   Expected result (inner product): " << refdot << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   a += b;
+   b *= 2.0F;
+
+   if( a != refsum || b != 2.0F*refb ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Vector assignment failed\n"
+          << " Details:\n"
+          << "   Result:\n" << a << "\n" << b << "\n"
+          << "   Expected result:\n" << refsum << "\n" << ( 2.0F*refb ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of dense matrix/vector multiplications with float16 and bfloat16 elements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the dense matrix/dense vector multiplication with float16
+// and bfloat16 elements, both for dynamic and custom matrices. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMatrix()
+{
+   using blaze::float16;
+   using blaze::bfloat16;
+   using blaze::unaligned;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   test_ = "Dense matrix/vector multiplication";
+
+   const size_t m(  9UL );
+   const size_t n( 45UL );
+
+   blaze::DynamicMatrix<float16,rowMajor>     A( m, n );
+   blaze::DynamicMatrix<bfloat16,columnMajor> B( m, n );
+   blaze::DynamicMatrix<float,rowMajor>       refA( m, n );
+
+   std::vector<float16> memory( m*n );
+   blaze::CustomMatrix<float16,unaligned,unpadded,rowMajor> C( memory.data(), m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         refA(i,j) = 0.125F * static_cast<float>( ( i*7UL + j*3UL ) % 11UL ) - 0.5F;
+         A(i,j) = refA(i,j);
+         B(i,j) = refA(i,j);
+         C(i,j) = refA(i,j);
+      }
+   }
+
+   blaze::DynamicVector<float16> x( n );
+   blaze::DynamicVector<float>   refx( n );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      refx[j] = static_cast<float>( j % 5UL ) - 2.0F;
+      x[j] = refx[j];
+   }
+
+   const blaze::DynamicVector<float>   y1( A * x );
+   const blaze::DynamicVector<float>   y2( B * x );
+   const blaze::DynamicVector<float16> y3( C * x );
+   const blaze::DynamicVector<float>   refy( refA * refx );
+
+   if( y1 != refy || y2 != refy || y3 != refy ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication failed\n"
+          << " Details:\n"
+          << "   Result (float16, row-major):\n" << y1 << "\n"
+          << "   Result (bfloat16, column-major):\n" << y2 << "\n"
+          << "   Result (float16, custom):\n" << y3 << "\n"
+          << "   Expected result:\n" << refy << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace halfprecision
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running float16/bfloat16 class test..." << std::endl;
+
+   try
+   {
+      RUN_HALFPRECISION_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during float16/bfloat16 class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
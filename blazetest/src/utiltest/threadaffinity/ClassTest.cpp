@@ -0,0 +1,410 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadaffinity/ClassTest.cpp
+//  \brief Source file for the thread affinity class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/utiltest/threadaffinity/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadaffinity {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the thread affinity class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testPinThread();
+   testOversubscribedPool();
+   testResize();
+   testFirstTouch();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the pinThread() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function binds a separate thread to processor indices that exceed the number of
+// available processors and checks that the indices are mapped in a round-robin fashion to the
+// processors the thread is allowed to run on. The binding is performed in a separate thread
+// since threads inherit the affinity of the creating thread. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testPinThread()
+{
+   test_ = "pinThread()";
+
+   const size_t count( processors() );
+   const size_t indices[] = { 0UL, 1UL, count, count+1UL, 2UL*count+3UL };
+
+   std::string error;
+
+   std::thread thread( [&]()
+   {
+#if defined(__linux__)
+      cpu_set_t allowed;
+      CPU_ZERO( &allowed );
+
+      if( pthread_getaffinity_np( pthread_self(), sizeof( cpu_set_t ), &allowed ) != 0 ) {
+         error = "Querying the affinity mask failed";
+         return;
+      }
+
+      std::vector<int> cpus;
+      for( int cpu=0; cpu<CPU_SETSIZE; ++cpu ) {
+         if( CPU_ISSET( cpu, &allowed ) )
+            cpus.push_back( cpu );
+      }
+
+      for( size_t index : indices )
+      {
+         if( !blaze::pinThread( index ) ) {
+            error = "Binding to index " + std::to_string( index ) + " failed";
+            return;
+         }
+
+         cpu_set_t current;
+         CPU_ZERO( &current );
+         pthread_getaffinity_np( pthread_self(), sizeof( cpu_set_t ), &current );
+
+         const int expected( cpus[index % cpus.size()] );
+
+         if( CPU_COUNT( &current ) != 1 || !CPU_ISSET( expected, &current ) ) {
+            error = "Invalid binding for index " + std::to_string( index ) + " detected";
+            return;
+         }
+
+         // Restoring the original affinity mask for the next binding
+         pthread_setaffinity_np( pthread_self(), sizeof( cpu_set_t ), &allowed );
+      }
+#else
+      for( size_t index : indices ) {
+         blaze::pinThread( index );
+      }
+#endif
+   } );
+
+   thread.join();
+
+   if( !error.empty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Number of processors: " << count << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a thread pool with bound threads and more threads than processors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function creates a thread pool with bound threads that contains more threads than
+// available processors and checks that forked, handed, and scheduled tasks as well as parallel
+// loops are executed exactly once. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testOversubscribedPool()
+{
+   test_ = "Thread pool with more threads than processors";
+
+   const size_t threads( 2UL*processors() + 1UL );
+   const size_t N( 4UL*threads + 3UL );
+
+   Pool pool( threads, true );
+
+   if( !pool.hasAffinity() || pool.size() != threads ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid thread pool setup detected\n"
+          << " Details:\n"
+          << "   Affinity                  : " << pool.hasAffinity() << "\n"
+          << "   Number of threads         : " << pool.size() << "\n"
+          << "   Expected number of threads: " << threads << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Handing tasks to specific threads, including indices beyond the number of threads
+   {
+      std::vector< std::atomic<unsigned int> > counts( N );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         pool.fork( i, [&counts,i]() { ++counts[i]; } );
+      }
+
+      pool.join();
+
+      checkCounts( counts );
+   }
+
+   // Executing a parallel loop
+   {
+      std::vector< std::atomic<unsigned int> > counts( 1001UL );
+
+      pool.parallelFor( 0UL, counts.size(), 7UL, [&counts]( size_t begin, size_t end ) {
+         for( size_t i=begin; i<end; ++i ) {
+            ++counts[i];
+         }
+      } );
+
+      checkCounts( counts );
+   }
+
+   // Scheduling tasks
+   {
+      std::vector< std::atomic<unsigned int> > counts( N );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         pool.schedule( [&counts,i]() { ++counts[i]; } );
+      }
+
+      pool.wait();
+
+      checkCounts( counts );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resizing of a thread pool with bound threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function grows and shrinks a thread pool with bound threads beyond the number of
+// available processors and checks that the pool remains functional. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "Resizing a thread pool with bound threads";
+
+   const size_t threads( processors() + 2UL );
+
+   Pool pool( 1UL, true );
+
+   for( size_t n : { threads, 1UL, 2UL*threads } )
+   {
+      pool.resize( n, true );
+
+      if( pool.size() != n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing the thread pool failed\n"
+             << " Details:\n"
+             << "   Number of threads         : " << pool.size() << "\n"
+             << "   Expected number of threads: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      std::vector< std::atomic<unsigned int> > counts( 2UL*n + 1UL );
+
+      for( size_t i=0UL; i<counts.size(); ++i ) {
+         pool.fork( i, [&counts,i]() { ++counts[i]; } );
+      }
+
+      pool.join();
+
+      checkCounts( counts );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the first-touch initialization of dense vectors and matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the initialization of dense vectors and matrices, which in thread
+// affinity mode is performed in parallel by the threads that later work on the respective
+// parts of the data. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFirstTouch()
+{
+   test_ = "First-touch initialization";
+
+   const size_t m( 1031UL );
+   const size_t n( 517UL );
+
+   blaze::DynamicVector<double,blaze::columnVector> a( m*n, 2.0 );
+   blaze::DynamicMatrix<double,blaze::rowMajor>     A( m, n, 3.0 );
+   blaze::DynamicMatrix<float,blaze::columnMajor>   B( m, n, 4.0F );
+
+   for( size_t i=0UL; i<a.size(); ++i ) {
+      if( a[i] != 2.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid vector element detected\n"
+             << " Details:\n"
+             << "   Index: " << i << "\n"
+             << "   Value: " << a[i] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( A(i,j) != 3.0 || B(i,j) != 4.0F ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid matrix element detected\n"
+                << " Details:\n"
+                << "   Index: (" << i << "," << j << ")\n"
+                << "   Row-major value   : " << A(i,j) << "\n"
+                << "   Column-major value: " << B(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   blaze::DynamicVector<double,blaze::columnVector> b( m*n );
+   b = a + a;
+
+   if( b[0] != 4.0 || b[m*n-1UL] != 4.0 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Addition of first-touch initialized vectors failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that every counter has been incremented exactly once.
+//
+// \param counts The counters to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkCounts( const std::vector< std::atomic<unsigned int> >& counts ) const
+{
+   for( size_t i=0UL; i<counts.size(); ++i )
+   {
+      if( counts[i].load() != 1U ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of task executions detected\n"
+             << " Details:\n"
+             << "   Task                         : " << i << "\n"
+             << "   Number of executions         : " << counts[i].load() << "\n"
+             << "   Expected number of executions: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of processors available to the process.
+//
+// \return The number of available processors (at least 1).
+*/
+size_t ClassTest::processors() const
+{
+   const size_t count( std::thread::hardware_concurrency() );
+   return ( count > 0UL )?( count ):( 1UL );
+}
+//*************************************************************************************************
+
+} // namespace threadaffinity
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running thread affinity class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADAFFINITY_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during thread affinity class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,575 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/ClassTest.cpp
+//  \brief Source file for the ThreadPool class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/utiltest/threadpool/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadPool class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testQueueOrder();
+   testQueueGrowth();
+   testQueueContention();
+   testForkJoin();
+   testAffineFork();
+   testNestedForkJoin();
+   testWorkerJoin();
+   testParallelFor();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the order of the jobs of the WorkQueue class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the owner of a WorkQueue removes the jobs in LIFO order, whereas
+// thieves remove the jobs in FIFO order. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testQueueOrder()
+{
+   using blaze::threadpool::WorkQueue;
+
+   test_ = "WorkQueue order";
+
+   std::vector<CountingJob> jobs( 4UL );
+   WorkQueue queue( 4UL );
+
+   if( !queue.isEmpty() || queue.pop() != nullptr || queue.steal() != nullptr ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-empty work queue detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( CountingJob& job : jobs ) {
+      queue.push( &job );
+   }
+
+   if( queue.isEmpty() || queue.pop() != &jobs[3] || queue.pop() != &jobs[2] ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid LIFO order of pop() detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( queue.steal() != &jobs[0] || queue.steal() != &jobs[1] ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid FIFO order of steal() detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( !queue.isEmpty() || queue.pop() != nullptr || queue.steal() != nullptr ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-empty work queue detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the growth of the WorkQueue class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function pushes a large number of jobs into a work queue with a small initial capacity
+// and checks that no job is lost or reordered during the growth of the queue. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testQueueGrowth()
+{
+   using blaze::threadpool::WorkQueue;
+
+   test_ = "WorkQueue growth";
+
+   const size_t N( 1000UL );
+
+   std::vector<CountingJob> jobs( N );
+   WorkQueue queue( 2UL );
+
+   // Growing the queue with a wrapped-around top index
+   queue.push( &jobs[0] );
+   queue.steal();
+
+   for( size_t i=1UL; i<N; ++i ) {
+      queue.push( &jobs[i] );
+   }
+
+   for( size_t i=1UL; i<11UL; ++i )
+   {
+      if( queue.steal() != &jobs[i] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid stolen job detected\n"
+             << " Details:\n"
+             << "   Expected job: " << i << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t i=N; i>11UL; --i )
+   {
+      if( queue.pop() != &jobs[i-1UL] ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid popped job detected\n"
+             << " Details:\n"
+             << "   Expected job: " << i-1UL << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( !queue.isEmpty() || queue.pop() != nullptr ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-empty work queue detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the WorkQueue class under contention.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function concurrently pushes, pops, and steals jobs from a work queue with a small
+// initial capacity and checks that every job is executed exactly once. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testQueueContention()
+{
+   using blaze::threadpool::Job;
+   using blaze::threadpool::WorkQueue;
+
+   test_ = "WorkQueue contention";
+
+   const size_t N( 200000UL );
+   const size_t thieves( 3UL );
+
+   std::vector<CountingJob> jobs( N );
+   WorkQueue queue( 2UL );
+   std::atomic<bool> finished( false );
+
+   std::vector<std::thread> threads;
+
+   for( size_t t=0UL; t<thieves; ++t ) {
+      threads.emplace_back( [&queue,&finished]()
+      {
+         while( !finished.load() || !queue.isEmpty() ) {
+            if( Job* job = queue.steal() )
+               job->run();
+         }
+      } );
+   }
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      queue.push( &jobs[i] );
+
+      if( i % 3UL == 2UL ) {
+         if( Job* job = queue.pop() )
+            job->run();
+      }
+   }
+
+   while( Job* job = queue.pop() ) {
+      job->run();
+   }
+
+   finished.store( true );
+
+   for( std::thread& thread : threads ) {
+      thread.join();
+   }
+
+   checkCounts( jobs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the fork() and join() functions of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function forks a large number of tasks from the main thread and checks that every task
+// has been executed exactly once as soon as join() returns. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testForkJoin()
+{
+   test_ = "ThreadPool fork/join";
+
+   const size_t N( 1000UL );
+
+   Pool pool( 3UL );
+   std::vector< std::atomic<unsigned int> > counts( N );
+
+   for( size_t rep=0UL; rep<10UL; ++rep )
+   {
+      for( std::atomic<unsigned int>& count : counts ) {
+         count.store( 0U );
+      }
+
+      for( size_t i=0UL; i<N; ++i ) {
+         pool.fork( [&counts,i]() { ++counts[i]; } );
+      }
+
+      pool.join();
+
+      checkCounts( counts );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the indexed fork() function of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function hands tasks to specific threads of the thread pool, including indices beyond
+// the number of threads, and checks that every task has been executed exactly once as soon as
+// join() returns. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAffineFork()
+{
+   test_ = "ThreadPool affine fork";
+
+   const size_t N( 64UL );
+
+   Pool pool( 4UL );
+   std::vector< std::atomic<unsigned int> > counts( N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      pool.fork( i % 6UL, [&counts,i]() { ++counts[i]; } );
+   }
+
+   pool.join();
+
+   checkCounts( counts );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested fork/join regions of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function forks tasks that again fork and join tasks on the same thread pool and checks
+// that every inner task has been executed exactly once. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNestedForkJoin()
+{
+   test_ = "ThreadPool nested fork/join";
+
+   const size_t M( 16UL );
+   const size_t N( 32UL );
+
+   Pool pool( 4UL );
+   std::vector< std::atomic<unsigned int> > counts( M*N );
+   std::atomic<size_t> incomplete( 0UL );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      pool.fork( [&pool,&counts,&incomplete,i,N]()
+      {
+         for( size_t j=0UL; j<N; ++j ) {
+            pool.fork( [&counts,i,j,N]() { ++counts[i*N+j]; } );
+         }
+
+         pool.join();
+
+         for( size_t j=0UL; j<N; ++j ) {
+            if( counts[i*N+j].load() != 1U )
+               ++incomplete;
+         }
+      } );
+   }
+
+   pool.join();
+
+   if( incomplete.load() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Inner join() returned before the completion of its tasks\n"
+          << " Details:\n"
+          << "   Number of incomplete tasks: " << incomplete.load() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkCounts( counts );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the join() function called by a thread of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules tasks that fork and join tasks on the thread pool they are executed
+// by and checks that join() only returns after the completion of the forked tasks. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testWorkerJoin()
+{
+   test_ = "ThreadPool join() on a thread of the pool";
+
+   const size_t M( 8UL );
+   const size_t N( 100UL );
+
+   Pool pool( 2UL );
+   std::vector< std::atomic<unsigned int> > counts( M*N );
+   std::atomic<size_t> incomplete( 0UL );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      pool.schedule( [&pool,&counts,&incomplete,i,N]()
+      {
+         for( size_t j=0UL; j<N; ++j ) {
+            pool.fork( [&counts,i,j,N]() { ++counts[i*N+j]; } );
+         }
+
+         pool.join();
+
+         for( size_t j=0UL; j<N; ++j ) {
+            if( counts[i*N+j].load() != 1U )
+               ++incomplete;
+         }
+      } );
+   }
+
+   pool.wait();
+
+   if( incomplete.load() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: join() returned before the completion of its tasks\n"
+          << " Details:\n"
+          << "   Number of incomplete tasks: " << incomplete.load() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkCounts( counts );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallelFor() function of the ThreadPool class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function executes a kernel for an index range whose size is not a multiple of the
+// grain size and checks that every index is processed exactly once and that no chunk exceeds
+// the grain size. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testParallelFor()
+{
+   test_ = "ThreadPool parallelFor()";
+
+   const size_t begin( 3UL );
+   const size_t end  ( 10010UL );
+   const size_t grain( 16UL );
+
+   Pool pool( 3UL );
+   std::vector< std::atomic<unsigned int> > counts( end - begin );
+   std::atomic<size_t> oversized( 0UL );
+
+   auto kernel = [&counts,&oversized,begin,grain]( size_t first, size_t last )
+   {
+      if( last <= first || last - first > grain )
+         ++oversized;
+
+      for( size_t i=first; i<last; ++i ) {
+         ++counts[i-begin];
+      }
+   };
+
+   pool.parallelFor( begin, end, grain, kernel );
+
+   if( oversized.load() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid chunk size detected\n"
+          << " Details:\n"
+          << "   Number of invalid chunks: " << oversized.load() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkCounts( counts );
+
+   // Executing an empty range
+   pool.parallelFor( end, end, grain, [&oversized]( size_t, size_t ) { ++oversized; } );
+
+   if( oversized.load() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Kernel executed for an empty range\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that every given job has been executed exactly once.
+//
+// \param jobs The jobs to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkCounts( const std::vector<CountingJob>& jobs ) const
+{
+   for( size_t i=0UL; i<jobs.size(); ++i )
+   {
+      if( jobs[i].count() != 1U ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of job executions detected\n"
+             << " Details:\n"
+             << "   Job                         : " << i << "\n"
+             << "   Number of executions         : " << jobs[i].count() << "\n"
+             << "   Expected number of executions: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that every counter has been incremented exactly once.
+//
+// \param counts The counters to be checked.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkCounts( const std::vector< std::atomic<unsigned int> >& counts ) const
+{
+   for( size_t i=0UL; i<counts.size(); ++i )
+   {
+      if( counts[i].load() != 1U ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of task executions detected\n"
+             << " Details:\n"
+             << "   Task                        : " << i << "\n"
+             << "   Number of executions         : " << counts[i].load() << "\n"
+             << "   Expected number of executions: 1\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadPool class test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadPool class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,438 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/workspace/ClassTest.cpp
+//  \brief Source file for the Workspace class test
+//
+//  Copyright (C) 2012-2017 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/utiltest/workspace/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace workspace {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the Workspace class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testAllocation();
+   testScope();
+   testArray();
+   testSteadyState();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the allocation functions of the Workspace class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the allocation, release and utility functions of the
+// Workspace class. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAllocation()
+{
+   using blaze::Workspace;
+
+   test_ = "Workspace allocation";
+
+   Workspace ws;
+
+   checkSize( ws, 0UL );
+   checkAllocations( ws, 0UL );
+
+   const Workspace::Mark mark0( ws.mark() );
+
+   blaze::byte_t* const a( ws.allocate(   1UL ) );
+   blaze::byte_t* const b( ws.allocate( 100UL ) );
+
+   if( reinterpret_cast<size_t>( a ) % Workspace::alignment != 0UL ||
+       reinterpret_cast<size_t>( b ) % Workspace::alignment != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid alignment detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkSize( ws, 192UL );
+   checkAllocations( ws, 1UL );
+
+   const Workspace::Mark mark1( ws.mark() );
+
+   ws.allocate( 200000UL );
+
+   checkSize( ws, 200192UL );
+   checkAllocations( ws, 2UL );
+
+   ws.release( mark1 );
+   checkSize( ws, 192UL );
+
+   ws.release( mark0 );
+   checkSize( ws, 0UL );
+
+   if( ws.highWaterMark() != 200192UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid high-water mark detected\n"
+          << " Details:\n"
+          << "   High-water mark         : " << ws.highWaterMark() << "\n"
+          << "   Expected high-water mark: 200192\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Merging the chunks of the unused workspace
+   ws.allocate( 64UL );
+   checkAllocations( ws, 3UL );
+   ws.release( mark0 );
+
+   // Steady state without any further heap allocation
+   for( size_t i=0UL; i<10UL; ++i ) {
+      const Workspace::Mark mark( ws.mark() );
+      ws.allocate( 192UL );
+      ws.allocate( 200000UL );
+      ws.release( mark );
+   }
+
+   checkSize( ws, 0UL );
+   checkAllocations( ws, 3UL );
+
+   ws.resetHighWaterMark();
+   ws.shrink();
+
+   if( ws.capacity() != 0UL || ws.highWaterMark() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Shrinking the workspace failed\n"
+          << " Details:\n"
+          << "   Capacity       : " << ws.capacity() << "\n"
+          << "   High-water mark: " << ws.highWaterMark() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   ws.reserve( 1000000UL );
+
+   if( ws.capacity() < 1000000UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reserving memory failed\n"
+          << " Details:\n"
+          << "   Capacity         : " << ws.capacity() << "\n"
+          << "   Expected capacity: >= 1000000\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the WorkspaceScope class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of nested workspace scopes. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testScope()
+{
+   test_ = "WorkspaceScope";
+
+   blaze::Workspace& ws( blaze::workspace() );
+   const size_t size( ws.size() );
+
+   {
+      blaze::WorkspaceScope outer;
+
+      double* const ptr( outer.allocate<double>( 10UL ) );
+
+      for( size_t i=0UL; i<10UL; ++i ) {
+         ptr[i] = static_cast<double>( i );
+      }
+
+      {
+         blaze::WorkspaceScope inner;
+         inner.allocate<int>( 1000UL );
+         inner.allocate<blaze::complex<float>>( 5000UL );
+         checkSize( ws, size + 128UL + 4032UL + 40000UL );
+      }
+
+      checkSize( ws, size + 128UL );
+
+      if( outer.size() != 128UL || ptr[9] != 9.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid outer scope detected\n"
+             << " Details:\n"
+             << "   Scope size         : " << outer.size() << "\n"
+             << "   Expected scope size: 128\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkSize( ws, size );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the WorkspaceArray class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the WorkspaceArray class template. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testArray()
+{
+   test_ = "WorkspaceArray";
+
+   const blaze::Workspace& ws( blaze::workspace() );
+   const size_t size( ws.size() );
+
+   {
+      blaze::WorkspaceArray<double> a( 100UL );
+      blaze::WorkspaceArray< blaze::complex<double> > b( 10UL );
+
+      for( size_t i=0UL; i<a.size(); ++i ) {
+         a.data()[i] = static_cast<double>( i );
+      }
+
+      if( a.size() != 100UL || b.size() != 10UL ||
+          reinterpret_cast<size_t>( a.data() ) % blaze::Workspace::alignment != 0UL ||
+          reinterpret_cast<size_t>( b.data() ) % blaze::Workspace::alignment != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid array detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      for( size_t i=0UL; i<b.size(); ++i ) {
+         if( b.data()[i] != blaze::complex<double>() ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Uninitialized complex element detected\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( blaze::useWorkspace ) {
+         checkSize( ws, size + 832UL + 192UL );
+      }
+   }
+
+   checkSize( ws, size );
+
+   // Arrays exceeding the workspace limit are allocated on the heap
+   {
+      const size_t capacity( ws.capacity() );
+      const size_t allocations( ws.allocations() );
+
+      blaze::WorkspaceArray<char> c( blaze::workspaceLimit + 1UL );
+
+      if( c.size() != blaze::workspaceLimit + 1UL ||
+          reinterpret_cast<size_t>( c.data() ) % blaze::Workspace::alignment != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid array detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkSize( ws, size );
+      checkAllocations( ws, allocations );
+
+      if( ws.capacity() != capacity ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Workspace grew beyond the workspace limit\n"
+             << " Details:\n"
+             << "   Capacity         : " << ws.capacity() << "\n"
+             << "   Expected capacity: " << capacity << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the workspace-backed temporaries of expression evaluations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly evaluates transpose operations, aliased assignments and matrix
+// multiplications and checks that the results are correct and that the workspace does not
+// perform any heap allocation after the first evaluation. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSteadyState()
+{
+   test_ = "Steady state of expression temporaries";
+
+   const size_t m( 67UL );
+   const size_t n( 45UL );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor>    A( m, n );
+   blaze::DynamicMatrix<double,blaze::columnMajor> B( m, n );
+   blaze::DynamicMatrix<double,blaze::rowMajor>    S( 150UL, 150UL );
+   blaze::DynamicMatrix<double,blaze::rowMajor>    T( 150UL, 150UL );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         A(i,j) = B(i,j) = static_cast<double>( i*n + j );
+      }
+   }
+
+   for( size_t i=0UL; i<150UL; ++i ) {
+      for( size_t j=0UL; j<150UL; ++j ) {
+         S(i,j) = static_cast<double>( ( i + 2UL*j ) % 5UL );
+         T(i,j) = ( i == j )?( 1.0 ):( 0.0 );
+      }
+   }
+
+   const blaze::DynamicMatrix<double,blaze::rowMajor> refS( S );
+
+   const blaze::Workspace& ws( blaze::workspace() );
+   size_t allocations( 0UL );
+
+   for( size_t rep=0UL; rep<10UL; ++rep )
+   {
+      A.transpose();
+      B.transpose();
+      A = trans( A );
+      B = trans( B );
+      A.transpose();
+      B.transpose();
+
+      S *= T;
+      S = S * T;
+
+      if( rep == 0UL ) {
+         allocations = ws.allocations();
+      }
+   }
+
+   checkAllocations( ws, allocations );
+
+   if( A.rows() != m || A.columns() != n || B.rows() != m || B.columns() != n ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix size detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( A(i,j) != static_cast<double>( i*n + j ) || B(i,j) != A(i,j) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Transpose operation failed\n"
+                << " Details:\n"
+                << "   Result (row-major):\n" << A << "\n"
+                << "   Result (column-major):\n" << B << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   if( S != refS ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication assignment failed\n"
+          << " Details:\n"
+          << "   Result:\n" << S << "\n"
+          << "   Expected result:\n" << refS << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace workspace
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running Workspace class test..." << std::endl;
+
+   try
+   {
+      RUN_WORKSPACE_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during Workspace class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************